@@ -1,3 +1,4 @@
+#define CRASHC_IMPLEMENTATION
 #include "crashC.all.in.one.h"
 
 TESTS_START
@@ -0,0 +1,64 @@
+# CMAKE generated file: DO NOT EDIT!
+# Generated by "Unix Makefiles" Generator, CMake Version 3.25
+
+# The generator used is:
+set(CMAKE_DEPENDS_GENERATOR "Unix Makefiles")
+
+# The top level Makefile was generated from the following files:
+set(CMAKE_MAKEFILE_DEPENDS
+  "CMakeCache.txt"
+  "/root/repo/crashc/CMakeLists.txt"
+  "CMakeFiles/3.25.1/CMakeCCompiler.cmake"
+  "CMakeFiles/3.25.1/CMakeCXXCompiler.cmake"
+  "CMakeFiles/3.25.1/CMakeSystem.cmake"
+  "/root/repo/crashc/doc.script.cmake.in"
+  "/root/repo/crashc/src/bench/c/CMakeLists.txt"
+  "/root/repo/crashc/src/main/c/CMakeLists.txt"
+  "/root/repo/crashc/src/test/c/CMakeLists.txt"
+  "/root/repo/crashc/src/tool/c/CMakeLists.txt"
+  "/usr/share/cmake-3.25/Modules/CMakeCInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeCXXInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeCommonLanguageInclude.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeGenericSystem.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeInitializeConfigs.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeLanguageInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeSystemSpecificInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeSystemSpecificInitialize.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/CMakeCommonCompilerMacros.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/GNU-C.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/GNU-CXX.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/GNU.cmake"
+  "/usr/share/cmake-3.25/Modules/GNUInstallDirs.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux-GNU-C.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux-GNU-CXX.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux-GNU.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/UnixPaths.cmake"
+  )
+
+# The corresponding makefile is:
+set(CMAKE_MAKEFILE_OUTPUTS
+  "Makefile"
+  "CMakeFiles/cmake.check_cache"
+  )
+
+# Byproducts of CMake generate step:
+set(CMAKE_MAKEFILE_PRODUCTS
+  "doc.script.cmake"
+  "CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/main/c/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/tool/c/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/bench/c/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/test/c/CMakeFiles/CMakeDirectoryInformation.cmake"
+  )
+
+# Dependency information for all targets:
+set(CMAKE_DEPEND_INFO_FILES
+  "CMakeFiles/doc.dir/DependInfo.cmake"
+  "src/main/c/CMakeFiles/CrashC.dir/DependInfo.cmake"
+  "src/main/c/CMakeFiles/BuildAllInOnHeader.dir/DependInfo.cmake"
+  "src/main/c/CMakeFiles/uninstall.dir/DependInfo.cmake"
+  "src/tool/c/CMakeFiles/crashc-report.dir/DependInfo.cmake"
+  "src/bench/c/CMakeFiles/crashc_bench.dir/DependInfo.cmake"
+  "src/test/c/CMakeFiles/CrashCTest.dir/DependInfo.cmake"
+  )
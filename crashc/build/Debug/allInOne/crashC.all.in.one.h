@@ -0,0 +1,17403 @@
+#ifndef CRASHC_ALL_IN_ONE_H_
+#define CRASHC_ALL_IN_ONE_H_
+/**
+ * @file
+ *
+ * Contains all the general purpose typedefs used in @crashc
+ *
+ * @author koldar
+ * @date Oct 11, 2017
+ */
+
+#ifndef TYPEDEFS_H_
+#define TYPEDEFS_H_
+
+struct ct_model;
+struct ct_section;
+struct ct_test_report;
+struct ct_snapshot;
+struct ct_assert_report;
+
+/**
+ * Represents the signature of a function which release a structure from the memory
+ *
+ * @param[inout] obj the structure to release from the memory. See <a ref="http://yarchive.net/comp/const.html">Linus thread</a>
+ * for the rationale behind *const*.
+ */
+typedef void (*ct_destroyer_c)(const void* obj);
+
+/**
+ * Function signature used to point at the functions which represent @testsuite
+ */
+typedef void (*ct_test_c)(void);
+
+/**
+ * Function signature of the code run by every thread of a stress test
+ *
+ * @param[in] thread_id the index of the thread calling the function, from 0 to the number of threads of the stress test (excluded)
+ * @param[in] iteration the iteration the thread is performing, from 0 to the number of iterations of the stress test (excluded)
+ * @see STRESS
+ */
+typedef void (*ct_stress_c)(int thread_id, long iteration);
+
+/**
+ * Function signature for a teardown function parameter
+ *
+ * The type of the function pointer of the global teardown function
+ *
+ * @see ct_model::ct_teardown
+ */
+typedef void (*ct_teardown_c)(void);
+
+/**
+ * @addtogroup reportFunctionType Report Function Types
+ * @brief function types used in ::ct_report_producer in order to build a test report human readable
+ * @{
+ */
+
+/**
+ * This type defines the function pointer to the function used to produce the report of a single test.
+ *
+ * This function usually calls a ct_snapshot_tree_reporter.
+ *
+ * @param[inout] model the model under analysis
+ * @param[in] test_report the test report we need to create a human readable representation of
+ */
+typedef void (*ct_test_reporter_c)(struct ct_model* model, struct ct_test_report* test_report);
+
+/**
+ * This type defines the function pointer to the function used to produce the report of a snapshot tree
+ *
+ * @param[inout] model the model under analysis
+ * @param[in] snapshot the ::ct_snapshot we need to create a human readable representation of
+ * @param[in] level the depth (in the snapshot tree) of the \c snapshot
+ */
+typedef void (*ct_snapshot_tree_reporter_c)(struct ct_model* model, struct ct_snapshot* snapshot, int level);
+
+/**
+ * This type defines the function pointer to the function used to produce the tests summary.
+ *
+ * The statistics of the tests, if used by the model, can be reached through it, so they are not passed
+ * as an argument explicitly
+ *
+ * @param[inout] model the model to use to create the human readable report of the statistics
+ */
+typedef void (*ct_summary_reporter_c)(struct ct_model* model);
+
+/**
+ * This type defines the function pointer to the function used to produce the reports for the assertions executed during a specific snapshot.
+ *
+ * @param[inout] model the model under analysis
+ * @param[in] snapshot the ::ct_snapshot containing the relevant asseritons. This argument **can be used** to get the list of struct ct_assert_report.
+ * @param[in] level the depth (in the snapshot tree) of the \c snapshot
+ */
+typedef void (*ct_assert_reporter_c)(struct ct_model* model, struct ct_snapshot* snapshot, int level);
+
+/**
+ * This type defines the function pointer to the function used to produce the report of the backtrace captured when a snapshot raised a signal.
+ *
+ * @param[inout] model the model under analysis
+ * @param[in] snapshot the ::ct_snapshot containing the backtrace. The function is called even if the snapshot has no backtrace at all
+ * @param[in] level the depth (in the snapshot tree) of the \c snapshot
+ */
+typedef void (*ct_backtrace_reporter_c)(struct ct_model* model, struct ct_snapshot* snapshot, int level);
+
+/**
+ * This type defines the function pointer to the function used to produce the report of the operating system resources a snapshot has consumed.
+ *
+ * @param[inout] model the model under analysis
+ * @param[in] snapshot the ::ct_snapshot containing the resource usage. The function is called even if the resource usage has not been measured
+ * @param[in] level the depth (in the snapshot tree) of the \c snapshot
+ */
+typedef void (*ct_resource_usage_reporter_c)(struct ct_model* model, struct ct_snapshot* snapshot, int level);
+
+/**
+ * This type defines the function pointer to the function used to produce the report of the elapsed time and of the hardware events of a snapshot.
+ *
+ * @param[inout] model the model under analysis
+ * @param[in] snapshot the ::ct_snapshot containing the measurements. The function is called even if the snapshot has not been measured
+ * @param[in] level the depth (in the snapshot tree) of the \c snapshot
+ */
+typedef void (*ct_performance_reporter_c)(struct ct_model* model, struct ct_snapshot* snapshot, int level);
+
+/**
+ * This type defines the function pointer to the function used to produce the report of the stress test a snapshot has run.
+ *
+ * @param[inout] model the model under analysis
+ * @param[in] snapshot the ::ct_snapshot containing the stress test measurements. The function is called even if the snapshot has not run any stress test
+ * @param[in] level the depth (in the snapshot tree) of the \c snapshot
+ */
+typedef void (*ct_stress_reporter_c)(struct ct_model* model, struct ct_snapshot* snapshot, int level);
+
+/**
+ * This type defines the function pointer to the function used to produce the report of the benchmark a snapshot has run.
+ *
+ * @param[inout] model the model under analysis
+ * @param[in] snapshot the ::ct_snapshot containing the benchmark measurements. The function is called even if the snapshot has not run any benchmark
+ * @param[in] level the depth (in the snapshot tree) of the \c snapshot
+ */
+typedef void (*ct_benchmark_reporter_c)(struct ct_model* model, struct ct_snapshot* snapshot, int level);
+
+/**
+ * This type defines the function pointer to the function used to produce the report of how a test behaved across its repetitions.
+ *
+ * @param[inout] model the model under analysis
+ * @param[in] test_report the report of a repetition of the test. The function is called even if the tests have not been repeated
+ */
+typedef void (*ct_flakiness_reporter_c)(struct ct_model* model, struct ct_test_report* test_report);
+
+/**
+ * function pointer type used to create the whole report by calling the other \ref reportFunctionType.
+ *
+ * The list of test reports is passed through the model. In the same way it is possible to reach
+ * the report_producer implementation.
+ *
+ * @param[inout] model the model to consider
+ */
+typedef void (*ct_reporter_c)(struct ct_model* model);
+
+///@}
+
+/**
+ * @defgroup eventListenerType Event listener types
+ * @brief Represents the function types a struct ct_event_listener can subscribe with
+ * @{
+ */
+
+/**
+ * Function called when a @testsuite starts
+ *
+ * @param[inout] model the model under analysis
+ * @param[in] data the data the listener has subscribed with
+ * @param[in] suite_name the id of the @testsuite as passed to ::REG_SUITE
+ */
+typedef void (*ct_suite_start_listener_c)(struct ct_model* model, void* data, const char* suite_name);
+
+/**
+ * Function called when the execution enters in a section
+ *
+ * @param[inout] model the model under analysis
+ * @param[in] data the data the listener has subscribed with
+ * @param[in] section the section just entered
+ */
+typedef void (*ct_section_enter_listener_c)(struct ct_model* model, void* data, struct ct_section* section);
+
+/**
+ * Function called when an assertion fails
+ *
+ * @param[inout] model the model under analysis
+ * @param[in] data the data the listener has subscribed with
+ * @param[in] report the report of the failed assertion
+ */
+typedef void (*ct_assert_fail_listener_c)(struct ct_model* model, void* data, struct ct_assert_report* report);
+
+/**
+ * Function called when a test ends, either normally or because of a failed assertion or a signal
+ *
+ * @param[inout] model the model under analysis
+ * @param[in] data the data the listener has subscribed with
+ * @param[in] report the report of the test, whose outcome is final
+ */
+typedef void (*ct_test_end_listener_c)(struct ct_model* model, void* data, struct ct_test_report* report);
+
+/**
+ * Function called when every @testsuite has been run, before the report is produced
+ *
+ * @param[inout] model the model under analysis
+ * @param[in] data the data the listener has subscribed with
+ */
+typedef void (*ct_run_end_listener_c)(struct ct_model* model, void* data);
+
+///@}
+
+#endif /* TYPEDEFS_H_ */
+/*
+Copyright (c) 2003-2016, Troy D. Hanson     http://troydhanson.github.com/uthash/
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS
+IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A
+PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER
+OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#ifndef UTHASH_H
+#define UTHASH_H
+
+#define UTHASH_VERSION 2.0.1
+
+#include <string.h>   /* memcmp,strlen */
+#include <stddef.h>   /* ptrdiff_t */
+#include <stdlib.h>   /* exit() */
+
+/* These macros use decltype or the earlier __typeof GNU extension.
+   As decltype is only available in newer compilers (VS2010 or gcc 4.3+
+   when compiling c++ source) this code uses whatever method is needed
+   or, for VS2008 where neither is available, uses casting workarounds. */
+#if defined(_MSC_VER)   /* MS compiler */
+#if _MSC_VER >= 1600 && defined(__cplusplus)  /* VS2010 or newer in C++ mode */
+#define DECLTYPE(x) (decltype(x))
+#else                   /* VS2008 or older (or VS2010 in C mode) */
+#define NO_DECLTYPE
+#define DECLTYPE(x)
+#endif
+#elif defined(__BORLANDC__) || defined(__LCC__) || defined(__WATCOMC__)
+#define NO_DECLTYPE
+#define DECLTYPE(x)
+#else                   /* GNU, Sun and other compilers */
+#define DECLTYPE(x) (__typeof(x))
+#endif
+
+#ifdef NO_DECLTYPE
+#define DECLTYPE_ASSIGN(dst,src)                                                 \
+do {                                                                             \
+  char **_da_dst = (char**)(&(dst));                                             \
+  *_da_dst = (char*)(src);                                                       \
+} while (0)
+#else
+#define DECLTYPE_ASSIGN(dst,src)                                                 \
+do {                                                                             \
+  (dst) = DECLTYPE(dst)(src);                                                    \
+} while (0)
+#endif
+
+/* a number of the hash function use uint32_t which isn't defined on Pre VS2010 */
+#if defined(_WIN32)
+#if defined(_MSC_VER) && _MSC_VER >= 1600
+#include <stdint.h>
+#elif defined(__WATCOMC__) || defined(__MINGW32__) || defined(__CYGWIN__)
+#include <stdint.h>
+#else
+typedef unsigned int uint32_t;
+typedef unsigned char uint8_t;
+#endif
+#elif defined(__GNUC__) && !defined(__VXWORKS__)
+#include <stdint.h>
+#else
+typedef unsigned int uint32_t;
+typedef unsigned char uint8_t;
+#endif
+
+#ifndef uthash_fatal
+#define uthash_fatal(msg) exit(-1)        /* fatal error (out of memory,etc) */
+#endif
+#ifndef uthash_malloc
+#define uthash_malloc(sz) malloc(sz)      /* malloc fcn                      */
+#endif
+#ifndef uthash_free
+#define uthash_free(ptr,sz) free(ptr)     /* free fcn                        */
+#endif
+#ifndef uthash_strlen
+#define uthash_strlen(s) strlen(s)
+#endif
+#ifndef uthash_memcmp
+#define uthash_memcmp(a,b,n) memcmp(a,b,n)
+#endif
+
+#ifndef uthash_noexpand_fyi
+#define uthash_noexpand_fyi(tbl)          /* can be defined to log noexpand  */
+#endif
+#ifndef uthash_expand_fyi
+#define uthash_expand_fyi(tbl)            /* can be defined to log expands   */
+#endif
+
+/* initial number of buckets */
+#define HASH_INITIAL_NUM_BUCKETS 32U     /* initial number of buckets        */
+#define HASH_INITIAL_NUM_BUCKETS_LOG2 5U /* lg2 of initial number of buckets */
+#define HASH_BKT_CAPACITY_THRESH 10U     /* expand when bucket count reaches */
+
+/* calculate the element whose hash handle address is hhp */
+#define ELMT_FROM_HH(tbl,hhp) ((void*)(((char*)(hhp)) - ((tbl)->hho)))
+/* calculate the hash handle from element address elp */
+#define HH_FROM_ELMT(tbl,elp) ((UT_hash_handle *)(((char*)(elp)) + ((tbl)->hho)))
+
+#define HASH_VALUE(keyptr,keylen,hashv)                                          \
+do {                                                                             \
+  HASH_FCN(keyptr, keylen, hashv);                                               \
+} while (0)
+
+#define HASH_FIND_BYHASHVALUE(hh,head,keyptr,keylen,hashval,out)                 \
+do {                                                                             \
+  (out) = NULL;                                                                  \
+  if (head) {                                                                    \
+    unsigned _hf_bkt;                                                            \
+    HASH_TO_BKT(hashval, (head)->hh.tbl->num_buckets, _hf_bkt);                  \
+    if (HASH_BLOOM_TEST((head)->hh.tbl, hashval) != 0) {                         \
+      HASH_FIND_IN_BKT((head)->hh.tbl, hh, (head)->hh.tbl->buckets[ _hf_bkt ], keyptr, keylen, hashval, out); \
+    }                                                                            \
+  }                                                                              \
+} while (0)
+
+#define HASH_FIND(hh,head,keyptr,keylen,out)                                     \
+do {                                                                             \
+  unsigned _hf_hashv;                                                            \
+  HASH_VALUE(keyptr, keylen, _hf_hashv);                                         \
+  HASH_FIND_BYHASHVALUE(hh, head, keyptr, keylen, _hf_hashv, out);               \
+} while (0)
+
+#ifdef HASH_BLOOM
+#define HASH_BLOOM_BITLEN (1UL << HASH_BLOOM)
+#define HASH_BLOOM_BYTELEN (HASH_BLOOM_BITLEN/8UL) + (((HASH_BLOOM_BITLEN%8UL)!=0UL) ? 1UL : 0UL)
+#define HASH_BLOOM_MAKE(tbl)                                                     \
+do {                                                                             \
+  (tbl)->bloom_nbits = HASH_BLOOM;                                               \
+  (tbl)->bloom_bv = (uint8_t*)uthash_malloc(HASH_BLOOM_BYTELEN);                 \
+  if (!((tbl)->bloom_bv))  { uthash_fatal( "out of memory"); }                   \
+  memset((tbl)->bloom_bv, 0, HASH_BLOOM_BYTELEN);                                \
+  (tbl)->bloom_sig = HASH_BLOOM_SIGNATURE;                                       \
+} while (0)
+
+#define HASH_BLOOM_FREE(tbl)                                                     \
+do {                                                                             \
+  uthash_free((tbl)->bloom_bv, HASH_BLOOM_BYTELEN);                              \
+} while (0)
+
+#define HASH_BLOOM_BITSET(bv,idx) (bv[(idx)/8U] |= (1U << ((idx)%8U)))
+#define HASH_BLOOM_BITTEST(bv,idx) (bv[(idx)/8U] & (1U << ((idx)%8U)))
+
+#define HASH_BLOOM_ADD(tbl,hashv)                                                \
+  HASH_BLOOM_BITSET((tbl)->bloom_bv, (hashv & (uint32_t)((1ULL << (tbl)->bloom_nbits) - 1U)))
+
+#define HASH_BLOOM_TEST(tbl,hashv)                                               \
+  HASH_BLOOM_BITTEST((tbl)->bloom_bv, (hashv & (uint32_t)((1ULL << (tbl)->bloom_nbits) - 1U)))
+
+#else
+#define HASH_BLOOM_MAKE(tbl)
+#define HASH_BLOOM_FREE(tbl)
+#define HASH_BLOOM_ADD(tbl,hashv)
+#define HASH_BLOOM_TEST(tbl,hashv) (1)
+#define HASH_BLOOM_BYTELEN 0U
+#endif
+
+#define HASH_MAKE_TABLE(hh,head)                                                 \
+do {                                                                             \
+  (head)->hh.tbl = (UT_hash_table*)uthash_malloc(                                \
+                  sizeof(UT_hash_table));                                        \
+  if (!((head)->hh.tbl))  { uthash_fatal( "out of memory"); }                    \
+  memset((head)->hh.tbl, 0, sizeof(UT_hash_table));                              \
+  (head)->hh.tbl->tail = &((head)->hh);                                          \
+  (head)->hh.tbl->num_buckets = HASH_INITIAL_NUM_BUCKETS;                        \
+  (head)->hh.tbl->log2_num_buckets = HASH_INITIAL_NUM_BUCKETS_LOG2;              \
+  (head)->hh.tbl->hho = (char*)(&(head)->hh) - (char*)(head);                    \
+  (head)->hh.tbl->buckets = (UT_hash_bucket*)uthash_malloc(                      \
+          HASH_INITIAL_NUM_BUCKETS*sizeof(struct UT_hash_bucket));               \
+  if (! (head)->hh.tbl->buckets) { uthash_fatal( "out of memory"); }             \
+  memset((head)->hh.tbl->buckets, 0,                                             \
+          HASH_INITIAL_NUM_BUCKETS*sizeof(struct UT_hash_bucket));               \
+  HASH_BLOOM_MAKE((head)->hh.tbl);                                               \
+  (head)->hh.tbl->signature = HASH_SIGNATURE;                                    \
+} while (0)
+
+#define HASH_REPLACE_BYHASHVALUE_INORDER(hh,head,fieldname,keylen_in,hashval,add,replaced,cmpfcn) \
+do {                                                                             \
+  (replaced) = NULL;                                                             \
+  HASH_FIND_BYHASHVALUE(hh, head, &((add)->fieldname), keylen_in, hashval, replaced); \
+  if (replaced) {                                                                \
+     HASH_DELETE(hh, head, replaced);                                            \
+  }                                                                              \
+  HASH_ADD_KEYPTR_BYHASHVALUE_INORDER(hh, head, &((add)->fieldname), keylen_in, hashval, add, cmpfcn); \
+} while (0)
+
+#define HASH_REPLACE_BYHASHVALUE(hh,head,fieldname,keylen_in,hashval,add,replaced) \
+do {                                                                             \
+  (replaced) = NULL;                                                             \
+  HASH_FIND_BYHASHVALUE(hh, head, &((add)->fieldname), keylen_in, hashval, replaced); \
+  if (replaced) {                                                                \
+     HASH_DELETE(hh, head, replaced);                                            \
+  }                                                                              \
+  HASH_ADD_KEYPTR_BYHASHVALUE(hh, head, &((add)->fieldname), keylen_in, hashval, add); \
+} while (0)
+
+#define HASH_REPLACE(hh,head,fieldname,keylen_in,add,replaced)                   \
+do {                                                                             \
+  unsigned _hr_hashv;                                                            \
+  HASH_VALUE(&((add)->fieldname), keylen_in, _hr_hashv);                         \
+  HASH_REPLACE_BYHASHVALUE(hh, head, fieldname, keylen_in, _hr_hashv, add, replaced); \
+} while (0)
+
+#define HASH_REPLACE_INORDER(hh,head,fieldname,keylen_in,add,replaced,cmpfcn)    \
+do {                                                                             \
+  unsigned _hr_hashv;                                                            \
+  HASH_VALUE(&((add)->fieldname), keylen_in, _hr_hashv);                         \
+  HASH_REPLACE_BYHASHVALUE_INORDER(hh, head, fieldname, keylen_in, _hr_hashv, add, replaced, cmpfcn); \
+} while (0)
+
+#define HASH_APPEND_LIST(hh, head, add)                                          \
+do {                                                                             \
+  (add)->hh.next = NULL;                                                         \
+  (add)->hh.prev = ELMT_FROM_HH((head)->hh.tbl, (head)->hh.tbl->tail);           \
+  (head)->hh.tbl->tail->next = (add);                                            \
+  (head)->hh.tbl->tail = &((add)->hh);                                           \
+} while (0)
+
+#define HASH_ADD_KEYPTR_BYHASHVALUE_INORDER(hh,head,keyptr,keylen_in,hashval,add,cmpfcn) \
+do {                                                                             \
+  unsigned _ha_bkt;                                                              \
+  (add)->hh.hashv = (hashval);                                                   \
+  (add)->hh.key = (char*) (keyptr);                                              \
+  (add)->hh.keylen = (unsigned) (keylen_in);                                     \
+  if (!(head)) {                                                                 \
+    (add)->hh.next = NULL;                                                       \
+    (add)->hh.prev = NULL;                                                       \
+    (head) = (add);                                                              \
+    HASH_MAKE_TABLE(hh, head);                                                   \
+  } else {                                                                       \
+    void *_hs_iter = (head);                                                     \
+    (add)->hh.tbl = (head)->hh.tbl;                                              \
+    do {                                                                         \
+      if (cmpfcn(DECLTYPE(head)(_hs_iter), add) > 0)                             \
+        break;                                                                   \
+    } while ((_hs_iter = HH_FROM_ELMT((head)->hh.tbl, _hs_iter)->next));         \
+    if (_hs_iter) {                                                              \
+      (add)->hh.next = _hs_iter;                                                 \
+      if (((add)->hh.prev = HH_FROM_ELMT((head)->hh.tbl, _hs_iter)->prev)) {     \
+        HH_FROM_ELMT((head)->hh.tbl, (add)->hh.prev)->next = (add);              \
+      } else {                                                                   \
+        (head) = (add);                                                          \
+      }                                                                          \
+      HH_FROM_ELMT((head)->hh.tbl, _hs_iter)->prev = (add);                      \
+    } else {                                                                     \
+      HASH_APPEND_LIST(hh, head, add);                                           \
+    }                                                                            \
+  }                                                                              \
+  (head)->hh.tbl->num_items++;                                                   \
+  HASH_TO_BKT(hashval, (head)->hh.tbl->num_buckets, _ha_bkt);                    \
+  HASH_ADD_TO_BKT((head)->hh.tbl->buckets[_ha_bkt], &(add)->hh);                 \
+  HASH_BLOOM_ADD((head)->hh.tbl, hashval);                                       \
+  HASH_EMIT_KEY(hh, head, keyptr, keylen_in);                                    \
+  HASH_FSCK(hh, head);                                                           \
+} while (0)
+
+#define HASH_ADD_KEYPTR_INORDER(hh,head,keyptr,keylen_in,add,cmpfcn)             \
+do {                                                                             \
+  unsigned _hs_hashv;                                                            \
+  HASH_VALUE(keyptr, keylen_in, _hs_hashv);                                      \
+  HASH_ADD_KEYPTR_BYHASHVALUE_INORDER(hh, head, keyptr, keylen_in, _hs_hashv, add, cmpfcn); \
+} while (0)
+
+#define HASH_ADD_BYHASHVALUE_INORDER(hh,head,fieldname,keylen_in,hashval,add,cmpfcn) \
+  HASH_ADD_KEYPTR_BYHASHVALUE_INORDER(hh, head, &((add)->fieldname), keylen_in, hashval, add, cmpfcn)
+
+#define HASH_ADD_INORDER(hh,head,fieldname,keylen_in,add,cmpfcn)                 \
+  HASH_ADD_KEYPTR_INORDER(hh, head, &((add)->fieldname), keylen_in, add, cmpfcn)
+
+#define HASH_ADD_KEYPTR_BYHASHVALUE(hh,head,keyptr,keylen_in,hashval,add)        \
+do {                                                                             \
+  unsigned _ha_bkt;                                                              \
+  (add)->hh.hashv = (hashval);                                                   \
+  (add)->hh.key = (char*) (keyptr);                                              \
+  (add)->hh.keylen = (unsigned) (keylen_in);                                     \
+  if (!(head)) {                                                                 \
+    (add)->hh.next = NULL;                                                       \
+    (add)->hh.prev = NULL;                                                       \
+    (head) = (add);                                                              \
+    HASH_MAKE_TABLE(hh, head);                                                   \
+  } else {                                                                       \
+    (add)->hh.tbl = (head)->hh.tbl;                                              \
+    HASH_APPEND_LIST(hh, head, add);                                             \
+  }                                                                              \
+  (head)->hh.tbl->num_items++;                                                   \
+  HASH_TO_BKT(hashval, (head)->hh.tbl->num_buckets, _ha_bkt);                    \
+  HASH_ADD_TO_BKT((head)->hh.tbl->buckets[_ha_bkt], &(add)->hh);                 \
+  HASH_BLOOM_ADD((head)->hh.tbl, hashval);                                       \
+  HASH_EMIT_KEY(hh, head, keyptr, keylen_in);                                    \
+  HASH_FSCK(hh, head);                                                           \
+} while (0)
+
+#define HASH_ADD_KEYPTR(hh,head,keyptr,keylen_in,add)                            \
+do {                                                                             \
+  unsigned _ha_hashv;                                                            \
+  HASH_VALUE(keyptr, keylen_in, _ha_hashv);                                      \
+  HASH_ADD_KEYPTR_BYHASHVALUE(hh, head, keyptr, keylen_in, _ha_hashv, add);      \
+} while (0)
+
+#define HASH_ADD_BYHASHVALUE(hh,head,fieldname,keylen_in,hashval,add)            \
+  HASH_ADD_KEYPTR_BYHASHVALUE(hh, head, &((add)->fieldname), keylen_in, hashval, add)
+
+#define HASH_ADD(hh,head,fieldname,keylen_in,add)                                \
+  HASH_ADD_KEYPTR(hh, head, &((add)->fieldname), keylen_in, add)
+
+#define HASH_TO_BKT(hashv,num_bkts,bkt)                                          \
+do {                                                                             \
+  bkt = ((hashv) & ((num_bkts) - 1U));                                           \
+} while (0)
+
+/* delete "delptr" from the hash table.
+ * "the usual" patch-up process for the app-order doubly-linked-list.
+ * The use of _hd_hh_del below deserves special explanation.
+ * These used to be expressed using (delptr) but that led to a bug
+ * if someone used the same symbol for the head and deletee, like
+ *  HASH_DELETE(hh,users,users);
+ * We want that to work, but by changing the head (users) below
+ * we were forfeiting our ability to further refer to the deletee (users)
+ * in the patch-up process. Solution: use scratch space to
+ * copy the deletee pointer, then the latter references are via that
+ * scratch pointer rather than through the repointed (users) symbol.
+ */
+#define HASH_DELETE(hh,head,delptr)                                              \
+do {                                                                             \
+    struct UT_hash_handle *_hd_hh_del;                                           \
+    if ( ((delptr)->hh.prev == NULL) && ((delptr)->hh.next == NULL) )  {         \
+        uthash_free((head)->hh.tbl->buckets,                                     \
+                    (head)->hh.tbl->num_buckets*sizeof(struct UT_hash_bucket) ); \
+        HASH_BLOOM_FREE((head)->hh.tbl);                                         \
+        uthash_free((head)->hh.tbl, sizeof(UT_hash_table));                      \
+        head = NULL;                                                             \
+    } else {                                                                     \
+        unsigned _hd_bkt;                                                        \
+        _hd_hh_del = &((delptr)->hh);                                            \
+        if ((delptr) == ELMT_FROM_HH((head)->hh.tbl,(head)->hh.tbl->tail)) {     \
+            (head)->hh.tbl->tail =                                               \
+                (UT_hash_handle*)((ptrdiff_t)((delptr)->hh.prev) +               \
+                (head)->hh.tbl->hho);                                            \
+        }                                                                        \
+        if ((delptr)->hh.prev != NULL) {                                         \
+            ((UT_hash_handle*)((ptrdiff_t)((delptr)->hh.prev) +                  \
+                    (head)->hh.tbl->hho))->next = (delptr)->hh.next;             \
+        } else {                                                                 \
+            DECLTYPE_ASSIGN(head,(delptr)->hh.next);                             \
+        }                                                                        \
+        if (_hd_hh_del->next != NULL) {                                          \
+            ((UT_hash_handle*)((ptrdiff_t)_hd_hh_del->next +                     \
+                    (head)->hh.tbl->hho))->prev =                                \
+                    _hd_hh_del->prev;                                            \
+        }                                                                        \
+        HASH_TO_BKT( _hd_hh_del->hashv, (head)->hh.tbl->num_buckets, _hd_bkt);   \
+        HASH_DEL_IN_BKT(hh,(head)->hh.tbl->buckets[_hd_bkt], _hd_hh_del);        \
+        (head)->hh.tbl->num_items--;                                             \
+    }                                                                            \
+    HASH_FSCK(hh,head);                                                          \
+} while (0)
+
+
+/* convenience forms of HASH_FIND/HASH_ADD/HASH_DEL */
+#define HASH_FIND_STR(head,findstr,out)                                          \
+    HASH_FIND(hh,head,findstr,(unsigned)uthash_strlen(findstr),out)
+#define HASH_ADD_STR(head,strfield,add)                                          \
+    HASH_ADD(hh,head,strfield[0],(unsigned)uthash_strlen(add->strfield),add)
+#define HASH_REPLACE_STR(head,strfield,add,replaced)                             \
+    HASH_REPLACE(hh,head,strfield[0],(unsigned)uthash_strlen(add->strfield),add,replaced)
+#define HASH_FIND_INT(head,findint,out)                                          \
+    HASH_FIND(hh,head,findint,sizeof(int),out)
+#define HASH_ADD_INT(head,intfield,add)                                          \
+    HASH_ADD(hh,head,intfield,sizeof(int),add)
+#define HASH_REPLACE_INT(head,intfield,add,replaced)                             \
+    HASH_REPLACE(hh,head,intfield,sizeof(int),add,replaced)
+#define HASH_FIND_PTR(head,findptr,out)                                          \
+    HASH_FIND(hh,head,findptr,sizeof(void *),out)
+#define HASH_ADD_PTR(head,ptrfield,add)                                          \
+    HASH_ADD(hh,head,ptrfield,sizeof(void *),add)
+#define HASH_REPLACE_PTR(head,ptrfield,add,replaced)                             \
+    HASH_REPLACE(hh,head,ptrfield,sizeof(void *),add,replaced)
+#define HASH_DEL(head,delptr)                                                    \
+    HASH_DELETE(hh,head,delptr)
+
+/* HASH_FSCK checks hash integrity on every add/delete when HASH_DEBUG is defined.
+ * This is for uthash developer only; it compiles away if HASH_DEBUG isn't defined.
+ */
+#ifdef HASH_DEBUG
+#define HASH_OOPS(...) do { fprintf(stderr,__VA_ARGS__); exit(-1); } while (0)
+#define HASH_FSCK(hh,head)                                                       \
+do {                                                                             \
+    struct UT_hash_handle *_thh;                                                 \
+    if (head) {                                                                  \
+        unsigned _bkt_i;                                                         \
+        unsigned _count;                                                         \
+        char *_prev;                                                             \
+        _count = 0;                                                              \
+        for( _bkt_i = 0; _bkt_i < (head)->hh.tbl->num_buckets; _bkt_i++) {       \
+            unsigned _bkt_count = 0;                                             \
+            _thh = (head)->hh.tbl->buckets[_bkt_i].hh_head;                      \
+            _prev = NULL;                                                        \
+            while (_thh) {                                                       \
+               if (_prev != (char*)(_thh->hh_prev)) {                            \
+                   HASH_OOPS("invalid hh_prev %p, actual %p\n",                  \
+                    _thh->hh_prev, _prev );                                      \
+               }                                                                 \
+               _bkt_count++;                                                     \
+               _prev = (char*)(_thh);                                            \
+               _thh = _thh->hh_next;                                             \
+            }                                                                    \
+            _count += _bkt_count;                                                \
+            if ((head)->hh.tbl->buckets[_bkt_i].count !=  _bkt_count) {          \
+               HASH_OOPS("invalid bucket count %u, actual %u\n",                 \
+                (head)->hh.tbl->buckets[_bkt_i].count, _bkt_count);              \
+            }                                                                    \
+        }                                                                        \
+        if (_count != (head)->hh.tbl->num_items) {                               \
+            HASH_OOPS("invalid hh item count %u, actual %u\n",                   \
+                (head)->hh.tbl->num_items, _count );                             \
+        }                                                                        \
+        /* traverse hh in app order; check next/prev integrity, count */         \
+        _count = 0;                                                              \
+        _prev = NULL;                                                            \
+        _thh =  &(head)->hh;                                                     \
+        while (_thh) {                                                           \
+           _count++;                                                             \
+           if (_prev !=(char*)(_thh->prev)) {                                    \
+              HASH_OOPS("invalid prev %p, actual %p\n",                          \
+                    _thh->prev, _prev );                                         \
+           }                                                                     \
+           _prev = (char*)ELMT_FROM_HH((head)->hh.tbl, _thh);                    \
+           _thh = ( _thh->next ?  (UT_hash_handle*)((char*)(_thh->next) +        \
+                                  (head)->hh.tbl->hho) : NULL );                 \
+        }                                                                        \
+        if (_count != (head)->hh.tbl->num_items) {                               \
+            HASH_OOPS("invalid app item count %u, actual %u\n",                  \
+                (head)->hh.tbl->num_items, _count );                             \
+        }                                                                        \
+    }                                                                            \
+} while (0)
+#else
+#define HASH_FSCK(hh,head)
+#endif
+
+/* When compiled with -DHASH_EMIT_KEYS, length-prefixed keys are emitted to
+ * the descriptor to which this macro is defined for tuning the hash function.
+ * The app can #include <unistd.h> to get the prototype for write(2). */
+#ifdef HASH_EMIT_KEYS
+#define HASH_EMIT_KEY(hh,head,keyptr,fieldlen)                                   \
+do {                                                                             \
+    unsigned _klen = fieldlen;                                                   \
+    write(HASH_EMIT_KEYS, &_klen, sizeof(_klen));                                \
+    write(HASH_EMIT_KEYS, keyptr, (unsigned long)fieldlen);                      \
+} while (0)
+#else
+#define HASH_EMIT_KEY(hh,head,keyptr,fieldlen)
+#endif
+
+/* default to Jenkin's hash unless overridden e.g. DHASH_FUNCTION=HASH_SAX */
+#ifdef HASH_FUNCTION
+#define HASH_FCN HASH_FUNCTION
+#else
+#define HASH_FCN HASH_JEN
+#endif
+
+/* The Bernstein hash function, used in Perl prior to v5.6. Note (x<<5+x)=x*33. */
+#define HASH_BER(key,keylen,hashv)                                               \
+do {                                                                             \
+  unsigned _hb_keylen=(unsigned)keylen;                                          \
+  const unsigned char *_hb_key=(const unsigned char*)(key);                      \
+  (hashv) = 0;                                                                   \
+  while (_hb_keylen-- != 0U) {                                                   \
+      (hashv) = (((hashv) << 5) + (hashv)) + *_hb_key++;                         \
+  }                                                                              \
+} while (0)
+
+
+/* SAX/FNV/OAT/JEN hash functions are macro variants of those listed at
+ * http://eternallyconfuzzled.com/tuts/algorithms/jsw_tut_hashing.aspx */
+#define HASH_SAX(key,keylen,hashv)                                               \
+do {                                                                             \
+  unsigned _sx_i;                                                                \
+  const unsigned char *_hs_key=(const unsigned char*)(key);                      \
+  hashv = 0;                                                                     \
+  for(_sx_i=0; _sx_i < keylen; _sx_i++) {                                        \
+      hashv ^= (hashv << 5) + (hashv >> 2) + _hs_key[_sx_i];                     \
+  }                                                                              \
+} while (0)
+/* FNV-1a variation */
+#define HASH_FNV(key,keylen,hashv)                                               \
+do {                                                                             \
+  unsigned _fn_i;                                                                \
+  const unsigned char *_hf_key=(const unsigned char*)(key);                      \
+  hashv = 2166136261U;                                                           \
+  for(_fn_i=0; _fn_i < keylen; _fn_i++) {                                        \
+      hashv = hashv ^ _hf_key[_fn_i];                                            \
+      hashv = hashv * 16777619U;                                                 \
+  }                                                                              \
+} while (0)
+
+#define HASH_OAT(key,keylen,hashv)                                               \
+do {                                                                             \
+  unsigned _ho_i;                                                                \
+  const unsigned char *_ho_key=(const unsigned char*)(key);                      \
+  hashv = 0;                                                                     \
+  for(_ho_i=0; _ho_i < keylen; _ho_i++) {                                        \
+      hashv += _ho_key[_ho_i];                                                   \
+      hashv += (hashv << 10);                                                    \
+      hashv ^= (hashv >> 6);                                                     \
+  }                                                                              \
+  hashv += (hashv << 3);                                                         \
+  hashv ^= (hashv >> 11);                                                        \
+  hashv += (hashv << 15);                                                        \
+} while (0)
+
+#define HASH_JEN_MIX(a,b,c)                                                      \
+do {                                                                             \
+  a -= b; a -= c; a ^= ( c >> 13 );                                              \
+  b -= c; b -= a; b ^= ( a << 8 );                                               \
+  c -= a; c -= b; c ^= ( b >> 13 );                                              \
+  a -= b; a -= c; a ^= ( c >> 12 );                                              \
+  b -= c; b -= a; b ^= ( a << 16 );                                              \
+  c -= a; c -= b; c ^= ( b >> 5 );                                               \
+  a -= b; a -= c; a ^= ( c >> 3 );                                               \
+  b -= c; b -= a; b ^= ( a << 10 );                                              \
+  c -= a; c -= b; c ^= ( b >> 15 );                                              \
+} while (0)
+
+#define HASH_JEN(key,keylen,hashv)                                               \
+do {                                                                             \
+  unsigned _hj_i,_hj_j,_hj_k;                                                    \
+  unsigned const char *_hj_key=(unsigned const char*)(key);                      \
+  hashv = 0xfeedbeefu;                                                           \
+  _hj_i = _hj_j = 0x9e3779b9u;                                                   \
+  _hj_k = (unsigned)(keylen);                                                    \
+  while (_hj_k >= 12U) {                                                         \
+    _hj_i +=    (_hj_key[0] + ( (unsigned)_hj_key[1] << 8 )                      \
+        + ( (unsigned)_hj_key[2] << 16 )                                         \
+        + ( (unsigned)_hj_key[3] << 24 ) );                                      \
+    _hj_j +=    (_hj_key[4] + ( (unsigned)_hj_key[5] << 8 )                      \
+        + ( (unsigned)_hj_key[6] << 16 )                                         \
+        + ( (unsigned)_hj_key[7] << 24 ) );                                      \
+    hashv += (_hj_key[8] + ( (unsigned)_hj_key[9] << 8 )                         \
+        + ( (unsigned)_hj_key[10] << 16 )                                        \
+        + ( (unsigned)_hj_key[11] << 24 ) );                                     \
+                                                                                 \
+     HASH_JEN_MIX(_hj_i, _hj_j, hashv);                                          \
+                                                                                 \
+     _hj_key += 12;                                                              \
+     _hj_k -= 12U;                                                               \
+  }                                                                              \
+  hashv += (unsigned)(keylen);                                                   \
+  switch ( _hj_k ) {                                                             \
+     case 11: hashv += ( (unsigned)_hj_key[10] << 24 ); /* FALLTHROUGH */        \
+     case 10: hashv += ( (unsigned)_hj_key[9] << 16 );  /* FALLTHROUGH */        \
+     case 9:  hashv += ( (unsigned)_hj_key[8] << 8 );   /* FALLTHROUGH */        \
+     case 8:  _hj_j += ( (unsigned)_hj_key[7] << 24 );  /* FALLTHROUGH */        \
+     case 7:  _hj_j += ( (unsigned)_hj_key[6] << 16 );  /* FALLTHROUGH */        \
+     case 6:  _hj_j += ( (unsigned)_hj_key[5] << 8 );   /* FALLTHROUGH */        \
+     case 5:  _hj_j += _hj_key[4];                      /* FALLTHROUGH */        \
+     case 4:  _hj_i += ( (unsigned)_hj_key[3] << 24 );  /* FALLTHROUGH */        \
+     case 3:  _hj_i += ( (unsigned)_hj_key[2] << 16 );  /* FALLTHROUGH */        \
+     case 2:  _hj_i += ( (unsigned)_hj_key[1] << 8 );   /* FALLTHROUGH */        \
+     case 1:  _hj_i += _hj_key[0];                                               \
+  }                                                                              \
+  HASH_JEN_MIX(_hj_i, _hj_j, hashv);                                             \
+} while (0)
+
+/* The Paul Hsieh hash function */
+#undef get16bits
+#if (defined(__GNUC__) && defined(__i386__)) || defined(__WATCOMC__)             \
+  || defined(_MSC_VER) || defined (__BORLANDC__) || defined (__TURBOC__)
+#define get16bits(d) (*((const uint16_t *) (d)))
+#endif
+
+#if !defined (get16bits)
+#define get16bits(d) ((((uint32_t)(((const uint8_t *)(d))[1])) << 8)             \
+                       +(uint32_t)(((const uint8_t *)(d))[0]) )
+#endif
+#define HASH_SFH(key,keylen,hashv)                                               \
+do {                                                                             \
+  unsigned const char *_sfh_key=(unsigned const char*)(key);                     \
+  uint32_t _sfh_tmp, _sfh_len = (uint32_t)keylen;                                \
+                                                                                 \
+  unsigned _sfh_rem = _sfh_len & 3U;                                             \
+  _sfh_len >>= 2;                                                                \
+  hashv = 0xcafebabeu;                                                           \
+                                                                                 \
+  /* Main loop */                                                                \
+  for (;_sfh_len > 0U; _sfh_len--) {                                             \
+    hashv    += get16bits (_sfh_key);                                            \
+    _sfh_tmp  = ((uint32_t)(get16bits (_sfh_key+2)) << 11) ^ hashv;              \
+    hashv     = (hashv << 16) ^ _sfh_tmp;                                        \
+    _sfh_key += 2U*sizeof (uint16_t);                                            \
+    hashv    += hashv >> 11;                                                     \
+  }                                                                              \
+                                                                                 \
+  /* Handle end cases */                                                         \
+  switch (_sfh_rem) {                                                            \
+    case 3: hashv += get16bits (_sfh_key);                                       \
+            hashv ^= hashv << 16;                                                \
+            hashv ^= (uint32_t)(_sfh_key[sizeof (uint16_t)]) << 18;              \
+            hashv += hashv >> 11;                                                \
+            break;                                                               \
+    case 2: hashv += get16bits (_sfh_key);                                       \
+            hashv ^= hashv << 11;                                                \
+            hashv += hashv >> 17;                                                \
+            break;                                                               \
+    case 1: hashv += *_sfh_key;                                                  \
+            hashv ^= hashv << 10;                                                \
+            hashv += hashv >> 1;                                                 \
+  }                                                                              \
+                                                                                 \
+    /* Force "avalanching" of final 127 bits */                                  \
+    hashv ^= hashv << 3;                                                         \
+    hashv += hashv >> 5;                                                         \
+    hashv ^= hashv << 4;                                                         \
+    hashv += hashv >> 17;                                                        \
+    hashv ^= hashv << 25;                                                        \
+    hashv += hashv >> 6;                                                         \
+} while (0)
+
+#ifdef HASH_USING_NO_STRICT_ALIASING
+/* The MurmurHash exploits some CPU's (x86,x86_64) tolerance for unaligned reads.
+ * For other types of CPU's (e.g. Sparc) an unaligned read causes a bus error.
+ * MurmurHash uses the faster approach only on CPU's where we know it's safe.
+ *
+ * Note the preprocessor built-in defines can be emitted using:
+ *
+ *   gcc -m64 -dM -E - < /dev/null                  (on gcc)
+ *   cc -## a.c (where a.c is a simple test file)   (Sun Studio)
+ */
+#if (defined(__i386__) || defined(__x86_64__)  || defined(_M_IX86))
+#define MUR_GETBLOCK(p,i) p[i]
+#else /* non intel */
+#define MUR_PLUS0_ALIGNED(p) (((unsigned long)p & 3UL) == 0UL)
+#define MUR_PLUS1_ALIGNED(p) (((unsigned long)p & 3UL) == 1UL)
+#define MUR_PLUS2_ALIGNED(p) (((unsigned long)p & 3UL) == 2UL)
+#define MUR_PLUS3_ALIGNED(p) (((unsigned long)p & 3UL) == 3UL)
+#define WP(p) ((uint32_t*)((unsigned long)(p) & ~3UL))
+#if (defined(__BIG_ENDIAN__) || defined(SPARC) || defined(__ppc__) || defined(__ppc64__))
+#define MUR_THREE_ONE(p) ((((*WP(p))&0x00ffffff) << 8) | (((*(WP(p)+1))&0xff000000) >> 24))
+#define MUR_TWO_TWO(p)   ((((*WP(p))&0x0000ffff) <<16) | (((*(WP(p)+1))&0xffff0000) >> 16))
+#define MUR_ONE_THREE(p) ((((*WP(p))&0x000000ff) <<24) | (((*(WP(p)+1))&0xffffff00) >>  8))
+#else /* assume little endian non-intel */
+#define MUR_THREE_ONE(p) ((((*WP(p))&0xffffff00) >> 8) | (((*(WP(p)+1))&0x000000ff) << 24))
+#define MUR_TWO_TWO(p)   ((((*WP(p))&0xffff0000) >>16) | (((*(WP(p)+1))&0x0000ffff) << 16))
+#define MUR_ONE_THREE(p) ((((*WP(p))&0xff000000) >>24) | (((*(WP(p)+1))&0x00ffffff) <<  8))
+#endif
+#define MUR_GETBLOCK(p,i) (MUR_PLUS0_ALIGNED(p) ? ((p)[i]) :           \
+                            (MUR_PLUS1_ALIGNED(p) ? MUR_THREE_ONE(p) : \
+                             (MUR_PLUS2_ALIGNED(p) ? MUR_TWO_TWO(p) :  \
+                                                      MUR_ONE_THREE(p))))
+#endif
+#define MUR_ROTL32(x,r) (((x) << (r)) | ((x) >> (32 - (r))))
+#define MUR_FMIX(_h) \
+do {                 \
+  _h ^= _h >> 16;    \
+  _h *= 0x85ebca6bu; \
+  _h ^= _h >> 13;    \
+  _h *= 0xc2b2ae35u; \
+  _h ^= _h >> 16;    \
+} while (0)
+
+#define HASH_MUR(key,keylen,hashv)                                     \
+do {                                                                   \
+  const uint8_t *_mur_data = (const uint8_t*)(key);                    \
+  const int _mur_nblocks = (int)(keylen) / 4;                          \
+  uint32_t _mur_h1 = 0xf88D5353u;                                      \
+  uint32_t _mur_c1 = 0xcc9e2d51u;                                      \
+  uint32_t _mur_c2 = 0x1b873593u;                                      \
+  uint32_t _mur_k1 = 0;                                                \
+  const uint8_t *_mur_tail;                                            \
+  const uint32_t *_mur_blocks = (const uint32_t*)(_mur_data+(_mur_nblocks*4)); \
+  int _mur_i;                                                          \
+  for(_mur_i = -_mur_nblocks; _mur_i!=0; _mur_i++) {                   \
+    _mur_k1 = MUR_GETBLOCK(_mur_blocks,_mur_i);                        \
+    _mur_k1 *= _mur_c1;                                                \
+    _mur_k1 = MUR_ROTL32(_mur_k1,15);                                  \
+    _mur_k1 *= _mur_c2;                                                \
+                                                                       \
+    _mur_h1 ^= _mur_k1;                                                \
+    _mur_h1 = MUR_ROTL32(_mur_h1,13);                                  \
+    _mur_h1 = (_mur_h1*5U) + 0xe6546b64u;                              \
+  }                                                                    \
+  _mur_tail = (const uint8_t*)(_mur_data + (_mur_nblocks*4));          \
+  _mur_k1=0;                                                           \
+  switch((keylen) & 3U) {                                              \
+    case 3: _mur_k1 ^= (uint32_t)_mur_tail[2] << 16; /* FALLTHROUGH */ \
+    case 2: _mur_k1 ^= (uint32_t)_mur_tail[1] << 8;  /* FALLTHROUGH */ \
+    case 1: _mur_k1 ^= (uint32_t)_mur_tail[0];                         \
+    _mur_k1 *= _mur_c1;                                                \
+    _mur_k1 = MUR_ROTL32(_mur_k1,15);                                  \
+    _mur_k1 *= _mur_c2;                                                \
+    _mur_h1 ^= _mur_k1;                                                \
+  }                                                                    \
+  _mur_h1 ^= (uint32_t)(keylen);                                       \
+  MUR_FMIX(_mur_h1);                                                   \
+  hashv = _mur_h1;                                                     \
+} while (0)
+#endif  /* HASH_USING_NO_STRICT_ALIASING */
+
+/* iterate over items in a known bucket to find desired item */
+#define HASH_FIND_IN_BKT(tbl,hh,head,keyptr,keylen_in,hashval,out)               \
+do {                                                                             \
+  if ((head).hh_head != NULL) {                                                  \
+    DECLTYPE_ASSIGN(out, ELMT_FROM_HH(tbl, (head).hh_head));                     \
+  } else {                                                                       \
+    (out) = NULL;                                                                \
+  }                                                                              \
+  while ((out) != NULL) {                                                        \
+    if ((out)->hh.hashv == (hashval) && (out)->hh.keylen == (keylen_in)) {       \
+      if (uthash_memcmp((out)->hh.key, keyptr, keylen_in) == 0) {                \
+        break;                                                                   \
+      }                                                                          \
+    }                                                                            \
+    if ((out)->hh.hh_next != NULL) {                                             \
+      DECLTYPE_ASSIGN(out, ELMT_FROM_HH(tbl, (out)->hh.hh_next));                \
+    } else {                                                                     \
+      (out) = NULL;                                                              \
+    }                                                                            \
+  }                                                                              \
+} while (0)
+
+/* add an item to a bucket  */
+#define HASH_ADD_TO_BKT(head,addhh)                                              \
+do {                                                                             \
+ head.count++;                                                                   \
+ (addhh)->hh_next = head.hh_head;                                                \
+ (addhh)->hh_prev = NULL;                                                        \
+ if (head.hh_head != NULL) { (head).hh_head->hh_prev = (addhh); }                \
+ (head).hh_head=addhh;                                                           \
+ if ((head.count >= ((head.expand_mult+1U) * HASH_BKT_CAPACITY_THRESH))          \
+     && ((addhh)->tbl->noexpand != 1U)) {                                        \
+       HASH_EXPAND_BUCKETS((addhh)->tbl);                                        \
+ }                                                                               \
+} while (0)
+
+/* remove an item from a given bucket */
+#define HASH_DEL_IN_BKT(hh,head,hh_del)                                          \
+    (head).count--;                                                              \
+    if ((head).hh_head == hh_del) {                                              \
+      (head).hh_head = hh_del->hh_next;                                          \
+    }                                                                            \
+    if (hh_del->hh_prev) {                                                       \
+        hh_del->hh_prev->hh_next = hh_del->hh_next;                              \
+    }                                                                            \
+    if (hh_del->hh_next) {                                                       \
+        hh_del->hh_next->hh_prev = hh_del->hh_prev;                              \
+    }
+
+/* Bucket expansion has the effect of doubling the number of buckets
+ * and redistributing the items into the new buckets. Ideally the
+ * items will distribute more or less evenly into the new buckets
+ * (the extent to which this is true is a measure of the quality of
+ * the hash function as it applies to the key domain).
+ *
+ * With the items distributed into more buckets, the chain length
+ * (item count) in each bucket is reduced. Thus by expanding buckets
+ * the hash keeps a bound on the chain length. This bounded chain
+ * length is the essence of how a hash provides constant time lookup.
+ *
+ * The calculation of tbl->ideal_chain_maxlen below deserves some
+ * explanation. First, keep in mind that we're calculating the ideal
+ * maximum chain length based on the *new* (doubled) bucket count.
+ * In fractions this is just n/b (n=number of items,b=new num buckets).
+ * Since the ideal chain length is an integer, we want to calculate
+ * ceil(n/b). We don't depend on floating point arithmetic in this
+ * hash, so to calculate ceil(n/b) with integers we could write
+ *
+ *      ceil(n/b) = (n/b) + ((n%b)?1:0)
+ *
+ * and in fact a previous version of this hash did just that.
+ * But now we have improved things a bit by recognizing that b is
+ * always a power of two. We keep its base 2 log handy (call it lb),
+ * so now we can write this with a bit shift and logical AND:
+ *
+ *      ceil(n/b) = (n>>lb) + ( (n & (b-1)) ? 1:0)
+ *
+ */
+#define HASH_EXPAND_BUCKETS(tbl)                                                 \
+do {                                                                             \
+    unsigned _he_bkt;                                                            \
+    unsigned _he_bkt_i;                                                          \
+    struct UT_hash_handle *_he_thh, *_he_hh_nxt;                                 \
+    UT_hash_bucket *_he_new_buckets, *_he_newbkt;                                \
+    _he_new_buckets = (UT_hash_bucket*)uthash_malloc(                            \
+             2UL * tbl->num_buckets * sizeof(struct UT_hash_bucket));            \
+    if (!_he_new_buckets) { uthash_fatal( "out of memory"); }                    \
+    memset(_he_new_buckets, 0,                                                   \
+            2UL * tbl->num_buckets * sizeof(struct UT_hash_bucket));             \
+    tbl->ideal_chain_maxlen =                                                    \
+       (tbl->num_items >> (tbl->log2_num_buckets+1U)) +                          \
+       (((tbl->num_items & ((tbl->num_buckets*2U)-1U)) != 0U) ? 1U : 0U);        \
+    tbl->nonideal_items = 0;                                                     \
+    for(_he_bkt_i = 0; _he_bkt_i < tbl->num_buckets; _he_bkt_i++)                \
+    {                                                                            \
+        _he_thh = tbl->buckets[ _he_bkt_i ].hh_head;                             \
+        while (_he_thh != NULL) {                                                \
+           _he_hh_nxt = _he_thh->hh_next;                                        \
+           HASH_TO_BKT( _he_thh->hashv, tbl->num_buckets*2U, _he_bkt);           \
+           _he_newbkt = &(_he_new_buckets[ _he_bkt ]);                           \
+           if (++(_he_newbkt->count) > tbl->ideal_chain_maxlen) {                \
+             tbl->nonideal_items++;                                              \
+             _he_newbkt->expand_mult = _he_newbkt->count /                       \
+                                        tbl->ideal_chain_maxlen;                 \
+           }                                                                     \
+           _he_thh->hh_prev = NULL;                                              \
+           _he_thh->hh_next = _he_newbkt->hh_head;                               \
+           if (_he_newbkt->hh_head != NULL) { _he_newbkt->hh_head->hh_prev =     \
+                _he_thh; }                                                       \
+           _he_newbkt->hh_head = _he_thh;                                        \
+           _he_thh = _he_hh_nxt;                                                 \
+        }                                                                        \
+    }                                                                            \
+    uthash_free( tbl->buckets, tbl->num_buckets*sizeof(struct UT_hash_bucket) ); \
+    tbl->num_buckets *= 2U;                                                      \
+    tbl->log2_num_buckets++;                                                     \
+    tbl->buckets = _he_new_buckets;                                              \
+    tbl->ineff_expands = (tbl->nonideal_items > (tbl->num_items >> 1)) ?         \
+        (tbl->ineff_expands+1U) : 0U;                                            \
+    if (tbl->ineff_expands > 1U) {                                               \
+        tbl->noexpand=1;                                                         \
+        uthash_noexpand_fyi(tbl);                                                \
+    }                                                                            \
+    uthash_expand_fyi(tbl);                                                      \
+} while (0)
+
+
+/* This is an adaptation of Simon Tatham's O(n log(n)) mergesort */
+/* Note that HASH_SORT assumes the hash handle name to be hh.
+ * HASH_SRT was added to allow the hash handle name to be passed in. */
+#define HASH_SORT(head,cmpfcn) HASH_SRT(hh,head,cmpfcn)
+#define HASH_SRT(hh,head,cmpfcn)                                                 \
+do {                                                                             \
+  unsigned _hs_i;                                                                \
+  unsigned _hs_looping,_hs_nmerges,_hs_insize,_hs_psize,_hs_qsize;               \
+  struct UT_hash_handle *_hs_p, *_hs_q, *_hs_e, *_hs_list, *_hs_tail;            \
+  if (head != NULL) {                                                            \
+      _hs_insize = 1;                                                            \
+      _hs_looping = 1;                                                           \
+      _hs_list = &((head)->hh);                                                  \
+      while (_hs_looping != 0U) {                                                \
+          _hs_p = _hs_list;                                                      \
+          _hs_list = NULL;                                                       \
+          _hs_tail = NULL;                                                       \
+          _hs_nmerges = 0;                                                       \
+          while (_hs_p != NULL) {                                                \
+              _hs_nmerges++;                                                     \
+              _hs_q = _hs_p;                                                     \
+              _hs_psize = 0;                                                     \
+              for ( _hs_i = 0; _hs_i  < _hs_insize; _hs_i++ ) {                  \
+                  _hs_psize++;                                                   \
+                  _hs_q = (UT_hash_handle*)((_hs_q->next != NULL) ?              \
+                          ((void*)((char*)(_hs_q->next) +                        \
+                          (head)->hh.tbl->hho)) : NULL);                         \
+                  if (! (_hs_q) ) { break; }                                     \
+              }                                                                  \
+              _hs_qsize = _hs_insize;                                            \
+              while ((_hs_psize > 0U) || ((_hs_qsize > 0U) && (_hs_q != NULL))) {\
+                  if (_hs_psize == 0U) {                                         \
+                      _hs_e = _hs_q;                                             \
+                      _hs_q = (UT_hash_handle*)((_hs_q->next != NULL) ?          \
+                              ((void*)((char*)(_hs_q->next) +                    \
+                              (head)->hh.tbl->hho)) : NULL);                     \
+                      _hs_qsize--;                                               \
+                  } else if ( (_hs_qsize == 0U) || (_hs_q == NULL) ) {           \
+                      _hs_e = _hs_p;                                             \
+                      if (_hs_p != NULL){                                        \
+                        _hs_p = (UT_hash_handle*)((_hs_p->next != NULL) ?        \
+                                ((void*)((char*)(_hs_p->next) +                  \
+                                (head)->hh.tbl->hho)) : NULL);                   \
+                       }                                                         \
+                      _hs_psize--;                                               \
+                  } else if ((                                                   \
+                      cmpfcn(DECLTYPE(head)(ELMT_FROM_HH((head)->hh.tbl,_hs_p)), \
+                             DECLTYPE(head)(ELMT_FROM_HH((head)->hh.tbl,_hs_q))) \
+                             ) <= 0) {                                           \
+                      _hs_e = _hs_p;                                             \
+                      if (_hs_p != NULL){                                        \
+                        _hs_p = (UT_hash_handle*)((_hs_p->next != NULL) ?        \
+                               ((void*)((char*)(_hs_p->next) +                   \
+                               (head)->hh.tbl->hho)) : NULL);                    \
+                       }                                                         \
+                      _hs_psize--;                                               \
+                  } else {                                                       \
+                      _hs_e = _hs_q;                                             \
+                      _hs_q = (UT_hash_handle*)((_hs_q->next != NULL) ?          \
+                              ((void*)((char*)(_hs_q->next) +                    \
+                              (head)->hh.tbl->hho)) : NULL);                     \
+                      _hs_qsize--;                                               \
+                  }                                                              \
+                  if ( _hs_tail != NULL ) {                                      \
+                      _hs_tail->next = ((_hs_e != NULL) ?                        \
+                            ELMT_FROM_HH((head)->hh.tbl,_hs_e) : NULL);          \
+                  } else {                                                       \
+                      _hs_list = _hs_e;                                          \
+                  }                                                              \
+                  if (_hs_e != NULL) {                                           \
+                  _hs_e->prev = ((_hs_tail != NULL) ?                            \
+                     ELMT_FROM_HH((head)->hh.tbl,_hs_tail) : NULL);              \
+                  }                                                              \
+                  _hs_tail = _hs_e;                                              \
+              }                                                                  \
+              _hs_p = _hs_q;                                                     \
+          }                                                                      \
+          if (_hs_tail != NULL){                                                 \
+            _hs_tail->next = NULL;                                               \
+          }                                                                      \
+          if ( _hs_nmerges <= 1U ) {                                             \
+              _hs_looping=0;                                                     \
+              (head)->hh.tbl->tail = _hs_tail;                                   \
+              DECLTYPE_ASSIGN(head,ELMT_FROM_HH((head)->hh.tbl, _hs_list));      \
+          }                                                                      \
+          _hs_insize *= 2U;                                                      \
+      }                                                                          \
+      HASH_FSCK(hh,head);                                                        \
+ }                                                                               \
+} while (0)
+
+/* This function selects items from one hash into another hash.
+ * The end result is that the selected items have dual presence
+ * in both hashes. There is no copy of the items made; rather
+ * they are added into the new hash through a secondary hash
+ * hash handle that must be present in the structure. */
+#define HASH_SELECT(hh_dst, dst, hh_src, src, cond)                              \
+do {                                                                             \
+  unsigned _src_bkt, _dst_bkt;                                                   \
+  void *_last_elt=NULL, *_elt;                                                   \
+  UT_hash_handle *_src_hh, *_dst_hh, *_last_elt_hh=NULL;                         \
+  ptrdiff_t _dst_hho = ((char*)(&(dst)->hh_dst) - (char*)(dst));                 \
+  if (src != NULL) {                                                             \
+    for(_src_bkt=0; _src_bkt < (src)->hh_src.tbl->num_buckets; _src_bkt++) {     \
+      for(_src_hh = (src)->hh_src.tbl->buckets[_src_bkt].hh_head;                \
+          _src_hh != NULL;                                                       \
+          _src_hh = _src_hh->hh_next) {                                          \
+          _elt = ELMT_FROM_HH((src)->hh_src.tbl, _src_hh);                       \
+          if (cond(_elt)) {                                                      \
+            _dst_hh = (UT_hash_handle*)(((char*)_elt) + _dst_hho);               \
+            _dst_hh->key = _src_hh->key;                                         \
+            _dst_hh->keylen = _src_hh->keylen;                                   \
+            _dst_hh->hashv = _src_hh->hashv;                                     \
+            _dst_hh->prev = _last_elt;                                           \
+            _dst_hh->next = NULL;                                                \
+            if (_last_elt_hh != NULL) { _last_elt_hh->next = _elt; }             \
+            if (dst == NULL) {                                                   \
+              DECLTYPE_ASSIGN(dst,_elt);                                         \
+              HASH_MAKE_TABLE(hh_dst,dst);                                       \
+            } else {                                                             \
+              _dst_hh->tbl = (dst)->hh_dst.tbl;                                  \
+            }                                                                    \
+            HASH_TO_BKT(_dst_hh->hashv, _dst_hh->tbl->num_buckets, _dst_bkt);    \
+            HASH_ADD_TO_BKT(_dst_hh->tbl->buckets[_dst_bkt],_dst_hh);            \
+            (dst)->hh_dst.tbl->num_items++;                                      \
+            _last_elt = _elt;                                                    \
+            _last_elt_hh = _dst_hh;                                              \
+          }                                                                      \
+      }                                                                          \
+    }                                                                            \
+  }                                                                              \
+  HASH_FSCK(hh_dst,dst);                                                         \
+} while (0)
+
+#define HASH_CLEAR(hh,head)                                                      \
+do {                                                                             \
+  if (head != NULL) {                                                            \
+    uthash_free((head)->hh.tbl->buckets,                                         \
+                (head)->hh.tbl->num_buckets*sizeof(struct UT_hash_bucket));      \
+    HASH_BLOOM_FREE((head)->hh.tbl);                                             \
+    uthash_free((head)->hh.tbl, sizeof(UT_hash_table));                          \
+    (head)=NULL;                                                                 \
+  }                                                                              \
+} while (0)
+
+#define HASH_OVERHEAD(hh,head)                                                   \
+ ((head != NULL) ? (                                                             \
+ (size_t)(((head)->hh.tbl->num_items   * sizeof(UT_hash_handle))   +             \
+          ((head)->hh.tbl->num_buckets * sizeof(UT_hash_bucket))   +             \
+           sizeof(UT_hash_table)                                   +             \
+           (HASH_BLOOM_BYTELEN))) : 0U)
+
+#ifdef NO_DECLTYPE
+#define HASH_ITER(hh,head,el,tmp)                                                \
+for(((el)=(head)), ((*(char**)(&(tmp)))=(char*)((head!=NULL)?(head)->hh.next:NULL)); \
+  (el) != NULL; ((el)=(tmp)), ((*(char**)(&(tmp)))=(char*)((tmp!=NULL)?(tmp)->hh.next:NULL)))
+#else
+#define HASH_ITER(hh,head,el,tmp)                                                \
+for(((el)=(head)), ((tmp)=DECLTYPE(el)((head!=NULL)?(head)->hh.next:NULL));      \
+  (el) != NULL; ((el)=(tmp)), ((tmp)=DECLTYPE(el)((tmp!=NULL)?(tmp)->hh.next:NULL)))
+#endif
+
+/* obtain a count of items in the hash */
+#define HASH_COUNT(head) HASH_CNT(hh,head)
+#define HASH_CNT(hh,head) ((head != NULL)?((head)->hh.tbl->num_items):0U)
+
+typedef struct UT_hash_bucket {
+   struct UT_hash_handle *hh_head;
+   unsigned count;
+
+   /* expand_mult is normally set to 0. In this situation, the max chain length
+    * threshold is enforced at its default value, HASH_BKT_CAPACITY_THRESH. (If
+    * the bucket's chain exceeds this length, bucket expansion is triggered).
+    * However, setting expand_mult to a non-zero value delays bucket expansion
+    * (that would be triggered by additions to this particular bucket)
+    * until its chain length reaches a *multiple* of HASH_BKT_CAPACITY_THRESH.
+    * (The multiplier is simply expand_mult+1). The whole idea of this
+    * multiplier is to reduce bucket expansions, since they are expensive, in
+    * situations where we know that a particular bucket tends to be overused.
+    * It is better to let its chain length grow to a longer yet-still-bounded
+    * value, than to do an O(n) bucket expansion too often.
+    */
+   unsigned expand_mult;
+
+} UT_hash_bucket;
+
+/* random signature used only to find hash tables in external analysis */
+#define HASH_SIGNATURE 0xa0111fe1u
+#define HASH_BLOOM_SIGNATURE 0xb12220f2u
+
+typedef struct UT_hash_table {
+   UT_hash_bucket *buckets;
+   unsigned num_buckets, log2_num_buckets;
+   unsigned num_items;
+   struct UT_hash_handle *tail; /* tail hh in app order, for fast append    */
+   ptrdiff_t hho; /* hash handle offset (byte pos of hash handle in element */
+
+   /* in an ideal situation (all buckets used equally), no bucket would have
+    * more than ceil(#items/#buckets) items. that's the ideal chain length. */
+   unsigned ideal_chain_maxlen;
+
+   /* nonideal_items is the number of items in the hash whose chain position
+    * exceeds the ideal chain maxlen. these items pay the penalty for an uneven
+    * hash distribution; reaching them in a chain traversal takes >ideal steps */
+   unsigned nonideal_items;
+
+   /* ineffective expands occur when a bucket doubling was performed, but
+    * afterward, more than half the items in the hash had nonideal chain
+    * positions. If this happens on two consecutive expansions we inhibit any
+    * further expansion, as it's not helping; this happens when the hash
+    * function isn't a good fit for the key domain. When expansion is inhibited
+    * the hash will still work, albeit no longer in constant time. */
+   unsigned ineff_expands, noexpand;
+
+   uint32_t signature; /* used only to find hash tables in external analysis */
+#ifdef HASH_BLOOM
+   uint32_t bloom_sig; /* used only to test bloom exists in external analysis */
+   uint8_t *bloom_bv;
+   uint8_t bloom_nbits;
+#endif
+
+} UT_hash_table;
+
+typedef struct UT_hash_handle {
+   struct UT_hash_table *tbl;
+   void *prev;                       /* prev element in app order      */
+   void *next;                       /* next element in app order      */
+   struct UT_hash_handle *hh_prev;   /* previous hh in bucket order    */
+   struct UT_hash_handle *hh_next;   /* next hh in bucket order        */
+   void *key;                        /* ptr to enclosing struct's key  */
+   unsigned keylen;                  /* enclosing struct's key len     */
+   unsigned hashv;                   /* result of hash-fcn(key)        */
+} UT_hash_handle;
+
+#endif /* UTHASH_H */
+/**
+ * @file
+ *
+ * Implements hashtables
+ *
+ * This module is just a front-end to uthash
+ *
+ * Here's an example on how to use the hashtable. Of course you can exploit all the macros available in \b ut_hash to find/loop and so on
+ * even here. Those macros are explained <a href="https://troydhanson.github.io/uthash/userguide.html#_hash_operations">here</a>
+ *
+ * ```
+ * ct_hashtable_o* ht = ct_ht_init();
+ * double* d = NULL;
+ *
+ * d = malloc(sizeof(double)); *d = 5;
+ * ct_ht_put(&ht,1, d);
+ * d = malloc(sizeof(double)); *d = 127;
+ * ct_ht_put(&ht,5, d);
+ * d = malloc(sizeof(double)); *d = -4.5;
+ * ct_ht_put(&ht,7, d);
+ *
+ * ct_ht_destroy_with_elements(&ht, free);
+ * ```
+ *
+ * @author koldar
+ * @date Jan 24, 2017
+ */
+
+#ifndef HASHTABLE_H_
+#define HASHTABLE_H_
+
+#include <stdbool.h>
+#include <stdlib.h> /* For NULL macro */
+
+
+
+
+
+/**
+ * A structure representing an entry of the hash table
+ *
+ * see <a href="http://troydhanson.github.io/uthash/userguide.html">uthash</a> for further information
+ */
+struct ct_hashtable_entry;
+typedef struct ct_hashtable_entry ct_hashtable_entry_o;
+
+/**
+ * Structure representing the facet of the hashtable data structure
+ */
+struct ct_hashtable;
+typedef struct ct_hashtable ct_hashtable_o;
+
+/**
+ * Create a new hashtable in memory
+ *
+ * @return the new hashtable just created
+ */
+ct_hashtable_o* ct_ht_init();
+
+/**
+ * number of item in the hashtable
+ *
+ * \note
+ * This operation is O(1)
+ *
+ * @param[in] ht the hash table involved
+ * @return the number of elements inside the hash table
+ */
+int ct_ht_size(const ct_hashtable_o* ht);
+
+/**
+ * get an element in the hashtable, given a certain key
+ *
+ * @param[in] ht the hashtable whwere we want to look int
+ * @param[in] key the key associated to a certain element
+ * @return
+ * 	\li the element whose key is \c key;
+ * 	\li NULL if it isn't present in the hashtable;
+ */
+void* ct_ht_get(const ct_hashtable_o* ht, unsigned long key);
+
+/**
+ * Check if a value in the hashtable has a particular key
+ *
+ * @param[in] ht the ht involved
+ * @param[in] key the key involved
+ * @return
+ * 	\li @true if there is a value within the hashtable whose key is \c key;
+ * 	\li @false otheriwse
+ */
+bool ct_ht_contains(const ct_hashtable_o* ht, unsigned long key);
+
+/**
+ * Insert or alter an element inside the hash table
+ *
+ * If the hashtable doesn't have an element indexed with \c key, a new element will be created.
+ * Otherwise we will update the existing element
+ *
+ * \attention
+ * After this operation the old data will be totally overwritten! Be sure to still have a backup reference
+ * of the previous object, otherwise memory leaks will likely happen!
+ *
+ * @param[inout] ht the hashtable to analyze
+ * @param[in] key the key of the element to update
+ * @param[in] data the new data to overwrite the old one
+ * @return
+ * 	\li @true if a new element is created;
+ * 	\li @false if we overwrote the previous one
+ */
+bool ct_ht_put_or_update(ct_hashtable_o* ht, unsigned long key, const void* data);
+
+/**
+ * Updates the value indexed by \c key to a new value
+ *
+ * \note
+ * If there is no element indexed with \c key in the hashtable, this function does nothing
+ *
+ * @param[inout] ht the hashtable to alter
+ * @param[in] key the key referring to the element to update
+ * @param[in] data the new data that will replace the old one
+ * @return
+ * 	\li @true if we have update with success the data;
+ * 	\li @false if we couldn't find any cell indexed with \c key;
+ */
+bool ct_ht_update(ct_hashtable_o* ht, unsigned long key, const void* data);
+
+/**
+ * Insert a new value within the hashtable
+ *
+ * \note
+ * Undefined behaviour if the key already exists in the hashtable
+ *
+ *
+ * @param[inout] ht the hashtable to handle
+ * @param[in] key the key of \c data
+ * @param[in] data the actual value to store in the hastable
+ */
+void ct_ht_put(ct_hashtable_o* ht, unsigned long key, const void* data);
+
+/**
+ * Release the hashtable from the memory
+ *
+ * \note
+ * If the values in the hastable are in memory as well, they won't be freed at all
+ *
+ * @param[inout] ht the hashtable to remove
+ * @see ct_ht_destroy_with_elements
+ */
+void ct_ht_destroy(ct_hashtable_o* ht);
+
+/**
+ * Like ::ct_ht_destroy but it frees the items in the hashtable from memory as well
+ *
+ * @param[inout] ht the hashtable to remove
+ * @param[in] d a function to use to free the elements in the hashtable from memory
+ */
+void ct_ht_destroy_with_elements(ct_hashtable_o* ht, ct_destroyer_c d);
+
+/**
+ * Remove an element from the hashtable
+ *
+ * \note
+ * The element won't be removed from the memory at all
+ *
+ * @param[inout] ht the hashtable to handle
+ * @param[in] key the key of the value to remove from the hashtable
+ * @see ct_ht_remove_and_destroy
+ */
+bool ct_ht_remove(ct_hashtable_o* ht, unsigned long key);
+
+/**
+ * like ::ct_ht_remove but it frees the value from memory as well
+ *
+ * @param[inout] ht the hashtable to handle
+ * @param[in] key the key of the value to remove from the hashtable
+ * @param[in] d the function to use to dispose of the value removed from the hashtable
+ */
+bool ct_ht_remove_and_destroy(ct_hashtable_o* ht, unsigned long key, ct_destroyer_c d);
+
+/**
+ * checks if the hashtable contains no values
+ *
+ * @param[in] ht the hashtable to handle
+ * @return @true if the hashtable contains no values; @false otherwise;
+ */
+bool ct_ht_is_empty(const ct_hashtable_o* ht);
+
+/**
+ * Fetch the first item the program can find within the hashtable.
+ *
+ * Nothing is said about what the software picks up: **don't assume it was the first one you have added in the hashtable!**
+ *
+ * @param[in] ht the hashtable involved
+ * @return
+ * 	\li an item inside the \c ht;
+ * 	\li @null if the \c ht is empty;
+ */
+void* ct_ht_get_first(const ct_hashtable_o* ht);
+
+/**
+ * Swap the contents of the values indexed by \c key1 and \c keys
+ *
+ * If one key does not exist in the hashtable, after this operation it will exist whilst the
+ * former one will be removed
+ *
+ * @param[inout] ht the ht to handle
+ * @param[in] key1 the first key
+ * @param[in] key2 the second key
+ * @return
+ * 	\li @true if a swap is performed;
+ * 	\li @false if both keys are not present;
+ */
+bool ct_ht_swap(ct_hashtable_o* ht, unsigned long key1, unsigned long key2);
+
+/**
+ * Clear all the elements inside the given hashtable.
+ *
+ * The values inside the hashtable won't be touched; however make sure
+ * you have other reference of them otherwise memory leak might happen
+ *
+ * @param[inout] ht the hashtable to clear
+ */
+void ct_ht_clear(ct_hashtable_o* ht);
+
+/**
+ * Clear all the elements inside the given hashtable
+ *
+ * Contrary to ::ct_ht_clear, this function will release the memory of the payloads inside the hashtable as well!
+ *
+ * \post
+ * 	\li hashtable empty;
+ * 	\li elements in hashtable released from memory
+ *
+ * @param[inout] ht the hashtable to clear
+ * @param[in] d the function to use to destroy the paylaod of the hashtable
+ */
+void ct_ht_clear_and_destroy_elements(ct_hashtable_o* ht, ct_destroyer_c d);
+
+/**
+ * Returns the head entry of the hashtable.
+ *
+ * @param[inout] ht The hashtable on which to operate
+ * @return The head entry of the hashtable
+ */
+ct_hashtable_entry_o* _ct_ht_head_entry(ct_hashtable_o* ht);
+
+/**
+ * Returns the value of the "next" field in the UT_hash_handle field of an entry.
+ * \note
+ * This function is purely instrumental towards hiding implementation details to the hashtable user
+ *
+ * @param[in] entry The hashtable entry on which the desired handle resides
+ * @return A pointer to the next value contained in the hashtable, considered by insertion order
+ */
+void* _ct_ht_entry_next(ct_hashtable_entry_o* entry);
+
+/**
+ * Returns the payload of a given hashtable entry
+ *
+ * @param[in] entry The entry which contains the desired payload
+ * @return The payload of the entry
+ */
+void* _ct_ht_entry_payload(ct_hashtable_entry_o* entry);
+
+//Picked up from uthash HASH_ITER Definition
+#ifdef CT_ITERATE_ON_HT
+#	error "CrashC - CT_ITERATE_ON_HT macro already defined!"
+#endif
+#define CT_ITERATE_ON_HT(ht,el)   																								\
+	ct_hashtable_entry_o* CT_UV(head) = _ct_ht_head_entry((ct_hashtable_o*) (ht));												\
+	ct_hashtable_entry_o* el = NULL; 																						\
+	ct_hashtable_entry_o* CT_UV(tmp) = NULL;																					\
+	for(((el)=(CT_UV(head))), ((*(char**)(&(CT_UV(tmp))))=(char*)((CT_UV(head)!=NULL)?_ct_ht_entry_next(CT_UV(head)):NULL)); 			\
+  (el) != NULL; ((el)=(CT_UV(tmp))), ((*(char**)(&(CT_UV(tmp))))=(char*)((CT_UV(tmp)!=NULL)?_ct_ht_entry_next(CT_UV(tmp)):NULL)))
+
+//TODO replace this code with the correct code in Cutils!!!!
+/**
+ * Macro allowing you to go through every element of hashtable
+ *
+ * An example of usage might be:
+ *
+ * <pre><code>
+ * ct_hashtable_o* ht;
+ * CT_ITERATE_VALUES_ON_HT(&ht, el, int) {
+ * 	printf("value %d\n", *el);
+ * }
+ * </code></pre>
+ *
+ * @param[in] ht Pointer to the hashtable on which to iterate
+ * @param[in] _data the name of the variable that will contain a value in the iteration
+ * @param[in] type the type of \c _data. So if you put \c int, data will have type <tt>int</tt>
+ */
+#ifdef CT_ITERATE_VALUES_ON_HT
+#	error "CrashC - CT_ITERATE_VALUES_ON_HT macro already defined!"
+#endif
+#define CT_ITERATE_VALUES_ON_HT(ht,_data,type) 															\
+	ct_hashtable_entry_o* CT_UV(head) = _ct_ht_head_entry((ct_hashtable_o*)(ht));						\
+	ct_hashtable_entry_o* CT_UV(el) = NULL; 															\
+	ct_hashtable_entry_o* CT_UV(tmp) = NULL;															\
+	type _data = NULL; 																					\
+	if (CT_UV(head) != NULL) { 																			\
+		_data = _ct_ht_entry_payload(CT_UV(head)); 														\
+	} 																									\
+	for(																								\
+		(CT_UV(el)=(CT_UV(head))), 																		\
+		((*(char**)(&(CT_UV(tmp))))=(char*)((CT_UV(head) != NULL)?_ct_ht_entry_next(CT_UV(head)):NULL)) \
+		; 																								\
+		CT_UV(el) != NULL 																				\
+		; 																								\
+		(CT_UV(el)=(CT_UV(tmp))), 																		\
+		_data=(CT_UV(el) != NULL) ? _ct_ht_entry_payload(CT_UV(el)) : NULL,								\
+		((*(char**)(&(CT_UV(tmp))))=(char*)((CT_UV(tmp)!=NULL)?_ct_ht_entry_next(CT_UV(tmp)):NULL))		\
+	)
+
+
+#endif /* HASHTABLE_H_ */
+/**
+ * @file
+ *
+ * Basic linked-list implementation
+ *
+ * The list implemented is a simple one (**not** double-linked).
+ * In the memory, it might resemble to:
+ *
+ * @dot
+ * digraph {
+ * 	rankdir="LR";
+ * 	A -> B -> C;
+ * }
+ * @enddot
+ *
+ * The list is composed by "entries": each entry contains a pointer to the value in the list and a pointer to the next entry
+ *
+ * @author koldar
+ * @date May 17, 2017
+ */
+
+#ifndef LIST_H_
+#define LIST_H_
+
+#include <stdlib.h>
+#include <stdbool.h>
+
+
+
+struct ct_list;
+typedef struct ct_list ct_list_o;
+
+struct ct_list_entry;
+typedef struct ct_list_entry ct_list_entry_o;
+
+/**
+ * Initialize a new list inside the memory.
+ *
+ * Use ::ct_list_destroy or ::ct_list_destroy_with_elements to release the memory from the ct_list_o
+ *
+ * @return the requested list
+ */
+ct_list_o* ct_list_init();
+
+/**
+ * Destroy the list
+ *
+ * \note
+ * The payload within it won't be release from the memory **at all**!
+ *
+ * @param[inout] l the list to handle
+ * @see ct_list_destroy_with_elements
+ */
+void ct_list_destroy(const ct_list_o* l);
+
+/**
+ * like ::ct_list_destroy but it releases from the memory all the elements within the list as well
+ *
+ * @param[inout] l the list to handle
+ * @param[in] d a function used to dispose all values within the list from memory
+ */
+void ct_list_destroy_with_elements(const ct_list_o* l, ct_destroyer_c d);
+
+/**
+ * Remove all the payloads from the list
+ *
+ * \note
+ * List items won't be removed from memory at all
+ *
+ * @param[inout] l the list to handle
+ */
+void ct_list_clear(ct_list_o* l);
+
+/**
+ * Adds a new element at the beginning of the list
+ *
+ * @param[inout] l the list we need to prepend a new item in
+ * @param[in] el the item to prepend
+ */
+void ct_list_add_head(ct_list_o* l, const void* el);
+
+/**
+ * Adds a new element at the end of the list
+ *
+ * @param[inout] l the list we need to append a new item in
+ * @param[in] el the item to append
+ */
+void ct_list_add_tail(ct_list_o* l, const void* el);
+
+/**
+ * The size of the list
+ *
+ * @param[in] l the list to handle
+ * @return the length of the list
+ */
+int ct_list_size(const ct_list_o* l);
+
+/**
+ * Adds all the elements of \c src into \c dst
+ *
+ * \note
+ * After this function, \c src will be empty
+ *
+ * @param[inout] dst the list that will accept all the elements inside \c scc;
+ * @param[inout] src the list whose elements will be tranferred to \c
+ */
+void ct_list_full_transfer(ct_list_o* restrict dst, ct_list_o* restrict src);
+
+/**
+ * Check if the given list is empty
+ *
+ * @param[in] l the list to analyze
+ * @return
+ * 	\li @true if \c l is empty;
+ * 	\li @false otherwises
+ */
+bool ct_list_is_empty(const ct_list_o* l);
+
+/**
+ * Get and remove the head from the list \c l
+ *
+ * @param[inout] l the involved list
+ * @return
+ * 	\li The payload at the head of the list;
+ * 	\li @null Wheter the list is empty;
+ */
+void* ct_list_pop(ct_list_o* l);
+
+/**
+ * Get and remove the tail from the list \c l
+ *
+ * The operation take \f$O(n)\f$ time, since the list is singly linked
+ *
+ * @param[inout] l the involved list
+ * @return
+ * 	\li The payload at the tail of the list;
+ * 	\li @null Wheter the list is empty;
+ */
+void* ct_list_pop_tail(ct_list_o* l);
+
+/**
+ * Replaces the payload at the tail of the list \c l
+ *
+ * \pre
+ * 	\li \c l is not empty
+ *
+ * @param[inout] l the involved list
+ * @param[in] el the new payload of the tail
+ * @return the payload previously at the tail of the list
+ */
+void* ct_list_replace_tail(ct_list_o* l, const void* el);
+
+/**
+ * Fetch the head of the list
+ *
+ * @param[in] l the list to handle
+ * @return
+ * 	\li the head of the list;
+ * 	\li NULL if \c l is empty;
+ */
+void* ct_list_head(const ct_list_o* l);
+
+/**
+ * Fetch the tail of the list
+ *
+ * @param[in] l the list to analyze
+ * @return
+ * 	\li the tail of the list;
+ * 	\li @null if \c l is empty
+ */
+void* ct_list_tail(const ct_list_o* l);
+
+/**
+ * Get the n-th element of the list
+ *
+ * \attention
+ * This method is **highly** inefficient and it should be used only for debugging purposes, not in production!
+ *
+ * The operation take \f$O(n)\f$ time
+ *
+ * @param[in] list the list to analyze
+ * @param[in] index the value in the \c index th position
+ * @return
+ * 	\li the payload
+ * 	\li @null if the length of \c list is smaller than \c index itself;
+ */
+void* ct_list_get(const ct_list_o* list, int index);
+
+/**
+ *
+ * \attention
+ * You should use this function only inside ::CT_VARIABLE_ITERATE_ON_LIST. Other uses may (and often will) lead to **undefined behaviour**!
+ *
+ * This function will allow you to dynamically remove elements inside a list when you're iterating it.
+ * A typical example might be:
+ *
+ * @code
+ * CT_VARIABLE_ITERATE_ON_LIST(&list, previous, entry, payload) {
+ * 	if (condition_to_payload()) {
+ * 		ct_list_remove_entry_dynamic(&list, &previous, entry);
+ * 	}
+ * }
+ * @endcode
+ *
+ * @param[in] l the list to change
+ * @param[inout] previous_entry the entry that is positioned just before the one to remove. After this, \c previous_entry pointer will contain @null
+ * @param[in] entry_to_remove the entry you want to remove
+ *
+ */
+void ct_list_remove_entry_dynamic(ct_list_o* l, ct_list_entry_o** previous_entry, ct_list_entry_o* entry_to_remove);
+
+/**
+ * Get the next entry in the list.
+ *
+ * @param[in] entry the current element of the list
+ * @return a entry containing the next element of the list or @null if we are currently on the tail of the list
+ */
+ct_list_entry_o* _ct_list_get_next_entry(const ct_list_entry_o* entry);
+
+/**
+ * Get the payload of the given list entry
+ *
+ * @param[in] entry the entry to handle
+ * @return the payload within the entry. @null values doesn't necessary mean there is no attached value in the entry: for istance, a list of integer may
+ * have such values representing a simple 0.
+ */
+void* _ct_list_get_entry_payload(const ct_list_entry_o* entry);
+
+/**
+ * Get the first entry of the list
+ *
+ * @param[in] l the list to handle
+ * @return the first entry in the list
+ */
+ct_list_entry_o* _ct_list_head_entry(const ct_list_o* l);
+
+/**
+ * Allows you to transparently iterate through a list
+ *
+ * This macro is *slightly* faster than ::CT_VARIABLE_ITERATE_ON_LIST but it doesn't allow you to
+ * safely remove entries while iterating
+ *
+ * @param[in] _l a double point to the list you want to iterate through;
+ * @param[in] entry name of the variable that will represent the entry under analysis
+ * @param[in] _payload name of the variable representing <tt>entry->payload</tt>
+ * @param[in] type type of the variable _payload
+ */
+#ifdef CT_ITERATE_ON_LIST
+#	error "CrashC - CT_ITERATE_ON_LIST macro already defined!"
+#endif
+#define CT_ITERATE_ON_LIST(_l, entry, _payload, type) 												\
+		const ct_list_o* CT_UV(l) = (_l);															\
+		ct_list_entry_o* entry = _ct_list_head_entry(CT_UV(l)); 									\
+		ct_list_entry_o* CT_UV(next) = NULL;														\
+		type _payload = NULL;																	\
+		if (entry != NULL) {																	\
+			_payload = _ct_list_get_entry_payload(entry);										\
+			if (_ct_list_get_next_entry(entry) != NULL) {										\
+				CT_UV(next) = _ct_list_get_next_entry(entry);										\
+			}																					\
+		}																						\
+		for (																					\
+				;																				\
+				entry != NULL;																	\
+				entry = CT_UV(next), 																\
+				CT_UV(next) = (entry != NULL) ? _ct_list_get_next_entry(entry) : NULL, 			\
+				_payload = (entry != NULL) ? _ct_list_get_entry_payload(entry) : NULL			\
+		)
+
+/**
+ * Allows you to transparently iterate through a list
+ *
+ * This macro is *slightly* slower than ::CT_ITERATE_ON_LIST but allows you to
+ * safely remove ct_list_entry_o while iterating.
+ *
+ * A typical example might be:
+ *
+ * @code
+ * CT_VARIABLE_ITERATE_ON_LIST(&list, previous, entry, payload) {
+ * 	if (conditionToPayload()) {
+ * 		ct_list_remove_entry_dynamic(&list, &previous, entry);
+ * 	}
+ * }
+ * @endcode
+ *
+ * @param[in] _l a double point to the ct_list_o you want to iterate through;
+ * @param[in] previous_entry name of the variable that will represent the entry just analyzed.
+ * @param[in] entry name of the variable that will represent the entry under analysis
+ * @param[in] _payload name of the variable representing <tt>entry->payload</tt>
+ * @param[in] type type of the variable _payload
+ */
+#ifdef CT_VARIABLE_ITERATE_ON_LIST
+#	error "CrashC - CT_VARIABLE_ITERATE_ON_LIST macro already defined!"
+#endif
+#define CT_VARIABLE_ITERATE_ON_LIST(_l, previous_entry, entry, _payload, type) 						\
+		ct_list_o* CT_UV(l) = (_l);																\
+		ct_list_entry_o* CT_UV(next) = NULL;														\
+		type _payload = NULL;																	\
+		if (_ct_list_head_entry(CT_UV(l)) != NULL) {												\
+			_payload = _ct_list_get_entry_payload(_ct_list_head_entry(CT_UV(l)));					\
+			if (_ct_list_get_next_entry(_ct_list_head_entry(CT_UV(l))) != NULL) {					\
+				CT_UV(next) = _ct_list_get_next_entry(_ct_list_head_entry(CT_UV(l)));					\
+			}																					\
+		}																						\
+		for (																					\
+				ct_list_entry_o 																\
+				*previous_cell = NULL, 															\
+				*CT_UV(previous_cell_tmp) = NULL, 													\
+				*entry = _ct_list_head_entry(CT_UV(l)) 											\
+				; 																				\
+				entry != NULL 																	\
+				; 																				\
+				CT_UV(previous_cell_tmp) = previous_cell == NULL ? CT_UV(previous_cell_tmp) : entry, 	\
+				previous_cell = CT_UV(previous_cell_tmp), 											\
+				entry = CT_UV(next), 																\
+				CT_UV(next) = (entry != NULL) ? _ct_list_get_next_entry(entry) : NULL, 			\
+				_payload = (entry != NULL) ? _ct_list_get_entry_payload(entry) : NULL			\
+		)
+
+
+#endif /* LIST_H_ */
+/**
+ * @file
+ *
+ * Contains API for handling tags
+ *
+ * @date Feb 16, 2017
+ * @author koldar
+ */
+
+#ifndef TAG_H_
+#define TAG_H_
+
+#include <stdbool.h>
+
+
+
+/**
+ * represents a single tag
+ *
+ * @definition Tag
+ * It's simply a string label that can be attached to a @containablesection, like @testcase, @when or even @testsuite
+ */
+struct ct_tag {
+	/**
+	 * The name of the tag
+	 */
+	char* name;
+};
+
+/**
+ * Alias to improve readability inside the code
+ */
+typedef ct_hashtable_o ct_tag_hashtable_o;
+
+/**
+ * Initialize a new tag
+ *
+ * @param[in] name the tag name
+ * @return the instance of the new tag in the heap
+ */
+struct ct_tag* ct_tag_init(const char* name);
+
+/**
+ * Removed from memory a previously created tag
+ *
+ * @param[inout] tag the tag to destroy
+ */
+void ct_tag_destroy(struct ct_tag* tag);
+
+/**
+ * Compare 2 tags
+ *
+ * @param[in] tag1 the first tag
+ * @param[in] tag2 the second tag
+ * @return
+ * 	\li \f$ ret < 0 \f$ if the name of the first tag is less than  the name of the second tag (with \c strcmp);
+ * 	\li 0 if the 2 tags are the same (either by pointer or by tag names);
+ * 	\li \f$ ret > 0 \f$ if the name of the first tag is greater than  the name of the second tag (with \c strcmp);
+ */
+int ct_tag_compare(const struct ct_tag* tag1, const struct ct_tag* tag2);
+
+/**
+ * Check if 2 tag sets have an intersection
+ *
+ * 2 tag hashtables have an intersection if at least one tag is present both in \c tag_set1 and in \c tag_set2
+ *
+ * @param[in] tag_set1 the first tagset to compute
+ * @param[in] tag_set2 the second tagset to compute
+ * @return
+ * 	\li @true if the 2 tagsets have something in common;
+ * 	\li @false otherwise;
+ */
+bool ct_have_tag_set_intersection(const ct_tag_hashtable_o* tag_set1, const ct_tag_hashtable_o* tag_set2);
+
+/**
+ * Adds a new tag inside a hashtable
+ *
+ * \post
+ * 	\li after this operation, the hastable has increased its size by 1
+ *
+ * @param[inout] tag_hashable hashtable to populate
+ * @param[in] name name of the tag to add
+ */
+void ct_tag_ht_put(ct_tag_hashtable_o* tag_hashable, const char* name);
+
+
+//TODO maybe we should put this function in utils.h
+/**
+ * the hash of a string
+ *
+ * @param[in] str the string whose hash we want to compute
+ * @return the hashcode of a string
+ */
+int ct_string_hash(const char* str);
+
+/**
+ * Fetch the next token in the stream of characters representing a tag
+ *
+ * @param[in] str the string where we need to fetch the next token
+ * @param[in] separator a character representing when a token ends and when it starts
+ * @param[in] characters_to_ignore a string containing a list of characters we can safely ignore in \c str
+ * @param[inout] output a buffer that will contain the token just read. It needs to be big enough to contain the whole token
+ * @return the first character of the next new token or 0 if we reached the end of the string
+ */
+const char* ct_next_tag_in_string(const char* const str, char separator, char* characters_to_ignore, char* output);
+
+/**
+ * adds in \c output all the tags inside the stream of tags
+ *
+ * \post
+ * 	\li \c output size increased
+ *
+ * Tags have no length limit. Empty tags (generated by 2 consecutive separators or by a separator at the beginning or at the end of \c tags)
+ * make \c tags malformed: they are ignored, but the other tags are still added.
+ *
+ * @param[inout] output the hashtable where to add every tag found in \c tags
+ * @param[in] tags a string containing tags, each of them separated by \c separator
+ * @param[in] separator a character separating 2 tags. No double separators allowed
+ * @return @true if \c tags is well formed, @false otherwise
+ */
+bool ct_tag_ht_populate(ct_tag_hashtable_o* output, const char* const tags, char separator);
+
+/**
+ * Fetch the number a tag associates to a key
+ *
+ * Such a tag has the form <tt>key:number</tt>, optionally enclosed in square brackets (e.g. \c "[max_allocs:0]").
+ * Tags with the key but without a valid number are ignored.
+ *
+ * @param[in] tags the hashtable to look into
+ * @param[in] key the key of the tag to look for
+ * @param[out] value the number the tag associates to \c key. Untouched if there is no such tag
+ * @return @true if \c tags contains a tag associating a number to \c key, @false otherwise
+ */
+bool ct_tag_ht_get_number(const ct_tag_hashtable_o* tags, const char* key, long* value);
+
+#endif /* TAG_H_ */
+/**
+ * @file
+ *
+ * Contains generic utilities used throughout all the project
+ *
+ * @author noodles
+ * @date Oct 31, 2017
+ */
+
+#ifndef CT_UTILS_H_
+#define CT_UTILS_H_
+
+#include <time.h>
+
+//TODO: Maybe improve this function
+/**
+ * Returns the basename of a file, given its absolute path.
+ *
+ * \note
+ * This function is written specifically to fit @crashc needs: we get the file name
+ * from the \c __FILE__ macro, which always expand to an absolute filename. Due to the fact that
+ * the filename is included compile-time in the binary we also return a pointer to a specific
+ * offset in the binary in order not to need any dynamic allocation
+ *
+ * TODO is this example correct?
+ * For example, if the input is <tt>/home/koldar/crashc/mytest.c</tt> the return value will be <tt>mytest.c</tt>
+ *
+ * @param[in] filename the absolute filename returned by \c __FILE__
+ * @return the basename of the absolute file
+ */
+char* const ct_file_basename(char* const filename);
+
+/**
+ * Get the time *now*
+ *
+ * @return struct holding information about the time when this function has been called
+ */
+struct timespec ct_get_time();
+/**
+ * Get a time interval
+ *
+ * @param[in] start the start of the time interval
+ * @param[in] end the end of the time interval
+ * @param[in] format_str either one of the following options:
+ * 	\li "s" if you want to the time interval in seconds;
+ *  \li "m" if you want to the time interval in milliseconds;
+ *  \li "u" if you want to the time interval in microseconds;
+ *  \li "n" if you want to the time interval in nanoseconds;
+ * @return the time elapsed between \c start and \c end
+ * @see ct_get_time
+ */
+long ct_compute_time_gap(struct timespec start, struct timespec end, const char* format_str);
+
+
+
+#endif /* CT_UTILS_H_ */
+/**
+ * @file
+ *
+ * Module measuring the operating system resources a @containablesection consumes
+ *
+ * Measurements are taken via \c getrusage, which is just a system call: no text needs to be parsed, so sampling is cheap enough
+ * to be performed every time a snapshot starts and ends.
+ *
+ * @author koldar
+ * @date Oct 19, 2026
+ */
+
+#ifndef RESOURCE_USAGE_H_
+#define RESOURCE_USAGE_H_
+
+/**
+ * The resources consumed by the process
+ *
+ * Depending on the context, the structure represents either the resources consumed by the process since it started (a sample)
+ * or the resources consumed in a given period of time (a delta). See ::ct_begin_resource_usage and ::ct_end_resource_usage
+ */
+struct ct_resource_usage {
+	/**
+	 * The peak resident set size of the process, in kilobytes
+	 *
+	 * This is never a delta: even in a delta it represents the peak reached by the process at the end of the period
+	 */
+	long max_rss;
+	/**
+	 * How much, in kilobytes, ct_resource_usage::max_rss has grown during the period
+	 *
+	 * Always 0 in a sample. A value greater than 0 means the process reached a new memory peak within the period
+	 */
+	long max_rss_growth;
+	/**
+	 * Page faults serviced without any I/O activity
+	 */
+	long minor_faults;
+	/**
+	 * Page faults which required I/O activity
+	 */
+	long major_faults;
+	/**
+	 * Number of times the process voluntarily gave up the CPU, usually because it blocked waiting for a resource (e.g. I/O)
+	 */
+	long voluntary_context_switches;
+	/**
+	 * Number of times the process has been preempted by the scheduler
+	 */
+	long involuntary_context_switches;
+	/**
+	 * CPU time spent in user mode, in microseconds
+	 */
+	long user_time;
+	/**
+	 * CPU time spent in kernel mode, in microseconds
+	 */
+	long system_time;
+};
+
+/**
+ * Samples the resources consumed by the process so far
+ *
+ * @param[out] usage the structure where to store the sample
+ */
+void ct_sample_resource_usage(struct ct_resource_usage* usage);
+
+/**
+ * Starts measuring the resources consumed from now on
+ *
+ * @param[out] usage the structure which will contain the measurement. After this call it holds a sample
+ */
+void ct_begin_resource_usage(struct ct_resource_usage* usage);
+
+/**
+ * Stops measuring the resources consumed
+ *
+ * @param[inout] usage a structure initialized with ::ct_begin_resource_usage. After this call it holds the resources consumed between
+ * 	::ct_begin_resource_usage and this call
+ */
+void ct_end_resource_usage(struct ct_resource_usage* usage);
+
+#endif /* RESOURCE_USAGE_H_ */
+/**
+ * @file
+ *
+ * Module reading the hardware performance counters of the CPU while a @containablesection runs
+ *
+ * Counters are opened as a single group via \c perf_event_open, so they are all scheduled on the PMU at the same time and their values
+ * are consistent with each other. Only user space events of the test process are counted.
+ *
+ * Counters may be unavailable: the kernel may forbid them (see \c /proc/sys/kernel/perf_event_paranoid), the program may run inside a
+ * container or a virtual machine which does not expose the PMU, or the operating system may not be Linux at all. In all those cases
+ * @crashc keeps working and measures only the elapsed time of each section. A counter the CPU does not support is excluded from the group,
+ * while the other ones keep working.
+ *
+ * You can disable the counters altogether by defining ::CT_HARDWARE_COUNTERS_ENABLED to 0.
+ *
+ * @author koldar
+ * @date Oct 19, 2026
+ */
+
+#ifndef HARDWARE_COUNTERS_H_
+#define HARDWARE_COUNTERS_H_
+
+#include <stdbool.h>
+
+/**
+ * 1 if @crashc should try to open the hardware performance counters, 0 otherwise
+ */
+#ifndef CT_HARDWARE_COUNTERS_ENABLED
+#	define CT_HARDWARE_COUNTERS_ENABLED 1
+#endif
+
+/**
+ * Value of a counter which could not be measured
+ */
+#define CT_HARDWARE_COUNTER_UNAVAILABLE -1
+
+/**
+ * The hardware events @crashc counts
+ *
+ * The values are indexes of struct ct_hardware_counters_group::fds
+ */
+enum ct_hardware_event {
+	CT_HW_INSTRUCTIONS,
+	CT_HW_CYCLES,
+	CT_HW_CACHE_MISSES,
+	CT_HW_BRANCH_MISSES,
+	/**
+	 * Not an event: the number of events in this enumeration
+	 */
+	CT_HW_EVENTS_NUMBER
+};
+
+/**
+ * The values of the hardware counters
+ *
+ * Depending on the context, the structure represents either the values the counters have right now (a sample)
+ * or the events happened in a given period of time (a delta). See ::ct_begin_hardware_counters and ::ct_end_hardware_counters.
+ * Every counter which could not be measured is set to ::CT_HARDWARE_COUNTER_UNAVAILABLE
+ */
+struct ct_hardware_counters {
+	/**
+	 * Instructions retired
+	 */
+	long long instructions;
+	/**
+	 * CPU cycles
+	 */
+	long long cycles;
+	/**
+	 * Cache accesses which missed the last level cache
+	 */
+	long long cache_misses;
+	/**
+	 * Mispredicted branch instructions
+	 */
+	long long branch_misses;
+};
+
+/**
+ * The group of hardware counters opened by @crashc
+ */
+struct ct_hardware_counters_group {
+	/**
+	 * @true if at least one counter has been opened, @false otherwise
+	 *
+	 * If @false, every operation on the group does nothing
+	 */
+	bool available;
+	/**
+	 * The file descriptor of the leader of the group, namely the first counter successfully opened
+	 *
+	 * -1 if the group is not available
+	 */
+	int leader_fd;
+	/**
+	 * The file descriptor of every counter, indexed by ::ct_hardware_event
+	 *
+	 * -1 if the specific counter could not be opened
+	 */
+	int fds[CT_HW_EVENTS_NUMBER];
+	/**
+	 * The position of every counter within the values returned by reading the group, indexed by ::ct_hardware_event
+	 *
+	 * -1 if the specific counter could not be opened
+	 */
+	int positions[CT_HW_EVENTS_NUMBER];
+	/**
+	 * The number of counters successfully opened
+	 */
+	int size;
+};
+
+/**
+ * Opens the hardware counters group, initially disabled
+ *
+ * \note
+ * Never fails: if the counters can't be opened, the returned group is simply not available
+ *
+ * @return the group of counters
+ */
+struct ct_hardware_counters_group* ct_init_hardware_counters_group();
+
+/**
+ * Closes the hardware counters and releases the group from memory
+ *
+ * @param[inout] group the group to dispose of
+ */
+void ct_destroy_hardware_counters_group(struct ct_hardware_counters_group* group);
+
+/**
+ * Starts counting the hardware events
+ *
+ * @param[inout] group the group to enable
+ */
+void ct_hardware_counters_enable(struct ct_hardware_counters_group* group);
+
+/**
+ * Stops counting the hardware events
+ *
+ * @param[inout] group the group to disable
+ */
+void ct_hardware_counters_disable(struct ct_hardware_counters_group* group);
+
+/**
+ * Reads the current values of the hardware counters
+ *
+ * @param[in] group the group to read
+ * @param[out] counters where to store the values
+ * @return @true if the counters have been read, @false otherwise. In the latter case every counter is set to ::CT_HARDWARE_COUNTER_UNAVAILABLE
+ */
+bool ct_read_hardware_counters(const struct ct_hardware_counters_group* group, struct ct_hardware_counters* counters);
+
+/**
+ * Starts measuring the hardware events happening from now on
+ *
+ * @param[in] group the group to read
+ * @param[out] counters the structure which will contain the measurement. After this call it holds a sample
+ */
+void ct_begin_hardware_counters(const struct ct_hardware_counters_group* group, struct ct_hardware_counters* counters);
+
+/**
+ * Stops measuring the hardware events
+ *
+ * @param[in] group the group to read
+ * @param[inout] counters a structure initialized with ::ct_begin_hardware_counters. After this call it holds the events happened between
+ * 	::ct_begin_hardware_counters and this call
+ */
+void ct_end_hardware_counters(const struct ct_hardware_counters_group* group, struct ct_hardware_counters* counters);
+
+#endif /* HARDWARE_COUNTERS_H_ */
+/**
+ * @file
+ *
+ * Module running a piece of code concurrently on several threads to stress the code under test
+ *
+ * A stress test runs a function (see ::ct_stress_c) on a given number of threads for a given number of iterations.
+ * All the threads wait on a barrier before starting, so they really compete against each other right from the first iteration.
+ * Assertions performed by the function are collected from every thread (see thread_context.h). For every thread we measure the throughput,
+ * while for every iteration we measure the latency, so that the tail of the latency distribution can be reported.
+ * Every thread keeps at most ::CT_STRESS_LATENCY_SAMPLES latencies, chosen uniformly among its iterations by reservoir sampling:
+ * the memory of a stress test does not grow with its iterations and the percentiles are exact as long as no thread exceeds the bound.
+ *
+ * @author koldar
+ * @date Oct 19, 2026
+ */
+
+#ifndef STRESS_H_
+#define STRESS_H_
+
+#include <stdbool.h>
+
+
+
+/**
+ * The maximum number of iteration latencies every thread of a stress test keeps to compute the percentiles
+ */
+#ifndef CT_STRESS_LATENCY_SAMPLES
+#	define CT_STRESS_LATENCY_SAMPLES 4096
+#endif
+
+/**
+ * The measurements of a single thread of a stress test
+ */
+struct ct_stress_thread_report {
+	/**
+	 * The number of iterations the thread has completed
+	 *
+	 * It's less than struct ct_stress_report::iterations if an assertion failed on the thread
+	 */
+	long completed_iterations;
+	/**
+	 * The time, in nanoseconds, the thread spent running its iterations
+	 */
+	long elapsed_time;
+	/**
+	 * The number of iterations completed per second
+	 */
+	double throughput;
+	/**
+	 * The latency, in nanoseconds, of the slowest iteration of the thread
+	 */
+	long max_latency;
+};
+
+/**
+ * The measurements of a whole stress test
+ */
+struct ct_stress_report {
+	/**
+	 * The number of threads which run the stress test
+	 */
+	int threads_number;
+	/**
+	 * The number of iterations each thread needed to perform
+	 */
+	long iterations;
+	/**
+	 * Median latency, in nanoseconds, of an iteration, considering every thread
+	 */
+	long latency_p50;
+	/**
+	 * 99th percentile of the latency, in nanoseconds, of an iteration, considering every thread
+	 */
+	long latency_p99;
+	/**
+	 * 99.9th percentile of the latency, in nanoseconds, of an iteration, considering every thread
+	 */
+	long latency_p999;
+	/**
+	 * The latency, in nanoseconds, of the slowest iteration among all the threads
+	 */
+	long max_latency;
+	/**
+	 * An array of struct ct_stress_report::threads_number cells, one for each thread
+	 */
+	struct ct_stress_thread_report* threads;
+	/**
+	 * The seed generating the thread interleaving of this run. -1 if the threads run in parallel without a scheduler
+	 *
+	 * See schedule.h
+	 */
+	long schedule_seed;
+	/**
+	 * The number of seeds explored before this run. 0 if no exploration has been performed
+	 */
+	long explored_schedules;
+	/**
+	 * The number of explored seeds which failed
+	 */
+	long failed_schedules;
+};
+
+/**
+ * Runs a stress test and stores its measurements in struct ct_model::current_snapshot
+ *
+ * The function returns only when every thread has terminated. If struct ct_model::schedule_replay_seed is set, the threads are serialized
+ * with such seed. Otherwise, if struct ct_model::schedule_seeds is positive, every seed is explored in a separate process and then the smallest
+ * failing seed (or seed 0, if none failed) is replayed within the test process.
+ *
+ * If \c threads_number or \c iterations are not positive, no thread is spawned and the snapshot fails.
+ *
+ * @param[inout] model the model to handle
+ * @param[in] function the function every thread runs at every iteration
+ * @param[in] threads_number the number of threads to spawn
+ * @param[in] iterations the number of times each thread calls \c function
+ */
+void ct_run_stress(struct ct_model* model, ct_stress_c function, int threads_number, long iterations);
+
+/**
+ * Runs a stress test serializing its threads with the interleaving generated by a seed
+ *
+ * The measurements are stored in struct ct_model::current_snapshot, but the assertions of the threads are left in struct ct_model::thread_assert_reports
+ *
+ * @param[inout] model the model to handle
+ * @param[in] function the function every thread runs at every iteration
+ * @param[in] threads_number the number of threads to spawn
+ * @param[in] iterations the number of times each thread calls \c function
+ * @param[in] seed the seed generating the thread interleaving
+ * @return @true if no thread has failed, @false otherwise
+ */
+bool ct_run_stress_schedule(struct ct_model* model, ct_stress_c function, int threads_number, long iterations, long seed);
+
+/**
+ * Releases from memory a stress report
+ *
+ * @param[inout] report the report to dispose of
+ */
+void ct_destroy_stress_report(struct ct_stress_report* report);
+
+#endif /* STRESS_H_ */
+/**
+ * @file
+ *
+ * Module measuring how the running time of a piece of code scales with a parameter, like the size of its input or the number of threads it spawns
+ *
+ * A benchmark (see ::BENCHMARK_RANGE) runs its body for every value of the parameter, doubling it from the first value up to the last one.
+ * For every value the body is timed ::CT_BENCHMARK_SAMPLES times: each sample runs the body enough times in a row to last at least
+ * ::CT_BENCHMARK_MIN_SAMPLE_TIME nanoseconds, so that even fast bodies are measured precisely. The samples farther than 1.5 times the interquartile
+ * range from the quartiles are rejected as outliers (e.g. the ones interrupted by the scheduler); the time of a value is the mean of the other
+ * samples, along with its bootstrap confidence interval.
+ *
+ * The environment of the benchmark can be controlled to make the times less noisy:
+ * \li before the first sample, the CPU spins until its clock frequency is stable, namely until ::CT_BENCHMARK_WARMUP_STABLE_CHUNKS pieces of work
+ * 	in a row take the same time (within ::CT_BENCHMARK_WARMUP_TOLERANCE), or ::CT_BENCHMARK_MAX_WARMUP_TIME nanoseconds have elapsed;
+ * \li with a warm cache (the default) the body is run once, untimed, before the samples of every value;
+ * \li with a cold cache (\c --cold_cache) a buffer as large as the last level cache is written before every sample, and every sample runs the body once;
+ * \li the benchmark can be pinned to a CPU (\c --benchmark_cpu), ideally one isolated from the scheduler (e.g. with the \c isolcpus kernel parameter).
+ * 	The threads spawned by the body inherit such affinity. The previous affinity is restored when the benchmark ends.
+ *
+ * The times are then fitted, with the least squares, to the common complexity classes (see ::ct_complexity) and the class with the smallest
+ * error is reported along with its coefficient. If an output directory is given (\c --benchmark_output) the curve is written there as a CSV file
+ * and as a gnuplot script (with its \c .dat file) drawing the measured times next to the fitted ones.
+ *
+ * @author koldar
+ * @date Oct 19, 2026
+ */
+
+#ifndef BENCHMARK_H_
+#define BENCHMARK_H_
+
+#include <stdbool.h>
+#include <time.h>
+
+
+
+/**
+ * The number of samples measured for every value of the parameter of a benchmark
+ */
+#ifndef CT_BENCHMARK_SAMPLES
+#	define CT_BENCHMARK_SAMPLES 20
+#endif
+
+/**
+ * The minimum time, in nanoseconds, a sample of a benchmark needs to last
+ */
+#ifndef CT_BENCHMARK_MIN_SAMPLE_TIME
+#	define CT_BENCHMARK_MIN_SAMPLE_TIME 1000000L
+#endif
+
+/**
+ * The maximum time, in nanoseconds, the CPU spins before a benchmark waiting for its clock frequency to stabilize
+ */
+#ifndef CT_BENCHMARK_MAX_WARMUP_TIME
+#	define CT_BENCHMARK_MAX_WARMUP_TIME 100000000L
+#endif
+
+/**
+ * The relative difference within which the times of 2 pieces of work of the warm-up are considered the same
+ */
+#ifndef CT_BENCHMARK_WARMUP_TOLERANCE
+#	define CT_BENCHMARK_WARMUP_TOLERANCE 0.02
+#endif
+
+/**
+ * How many pieces of work in a row need to take the same time for the clock frequency to be considered stable
+ */
+#ifndef CT_BENCHMARK_WARMUP_STABLE_CHUNKS
+#	define CT_BENCHMARK_WARMUP_STABLE_CHUNKS 5
+#endif
+
+/**
+ * The number of resamples computing the bootstrap confidence interval of the time of a value
+ */
+#ifndef CT_BENCHMARK_BOOTSTRAP_RESAMPLES
+#	define CT_BENCHMARK_BOOTSTRAP_RESAMPLES 1000
+#endif
+
+/**
+ * The confidence level of the interval of the time of a value
+ */
+#ifndef CT_BENCHMARK_CONFIDENCE
+#	define CT_BENCHMARK_CONFIDENCE 0.95
+#endif
+
+/**
+ * The size, in bytes, of the buffer flushing the cache if the size of the last level cache can't be known
+ */
+#ifndef CT_BENCHMARK_DEFAULT_CACHE_SIZE
+#	define CT_BENCHMARK_DEFAULT_CACHE_SIZE (32L * 1024 * 1024)
+#endif
+
+/**
+ * The number of words of the CPU masks used to pin a benchmark, hence how many CPUs (64 per word) can be handled
+ */
+#ifndef CT_BENCHMARK_AFFINITY_WORDS
+#	define CT_BENCHMARK_AFFINITY_WORDS 16
+#endif
+
+/**
+ * The complexity classes the times of a benchmark are fitted to
+ */
+enum ct_complexity {
+	///O(1)
+	CT_COMPLEXITY_CONSTANT,
+	///O(log n)
+	CT_COMPLEXITY_LOGARITHMIC,
+	///O(n)
+	CT_COMPLEXITY_LINEAR,
+	///O(n log n)
+	CT_COMPLEXITY_LINEARITHMIC,
+	///O(n^2)
+	CT_COMPLEXITY_QUADRATIC,
+	///O(n^3)
+	CT_COMPLEXITY_CUBIC,
+};
+
+/**
+ * The time measured for a value of the parameter of a benchmark
+ */
+struct ct_benchmark_point {
+	/**
+	 * The value of the parameter
+	 */
+	long parameter;
+	/**
+	 * How many times the body has been run in every sample
+	 */
+	long iterations;
+	/**
+	 * The mean, among the samples which are not outliers, of the time of a single run of the body, in nanoseconds
+	 */
+	double time;
+	/**
+	 * The lower bound of the confidence interval of struct ct_benchmark_point::time
+	 */
+	double time_low;
+	/**
+	 * The upper bound of the confidence interval of struct ct_benchmark_point::time
+	 */
+	double time_high;
+	/**
+	 * The number of samples rejected as outliers
+	 */
+	int outliers;
+	/**
+	 * The mean number of blocks a single run of the body has allocated via \c malloc, \c calloc or \c realloc
+	 *
+	 * The counts of struct ct_benchmark_point are measured over the runs of the samples, outliers included.
+	 * Meaningful only if struct ct_benchmark_report::allocations_counted is @true
+	 */
+	double allocations;
+	/**
+	 * The mean number of bytes a single run of the body has requested
+	 */
+	double allocated_bytes;
+	/**
+	 * The mean number of blocks a single run of the body has released
+	 */
+	double frees;
+};
+
+/**
+ * The measurements of a whole benchmark
+ */
+struct ct_benchmark_report {
+	/**
+	 * The name of the variable holding the parameter in the body of the benchmark
+	 */
+	const char* parameter_name;
+	/**
+	 * The number of items in struct ct_benchmark_report::points
+	 */
+	int points_number;
+	/**
+	 * The times measured, ordered by increasing parameter
+	 */
+	struct ct_benchmark_point* points;
+	/**
+	 * The complexity class fitting the times best
+	 */
+	enum ct_complexity complexity;
+	/**
+	 * The coefficient, in nanoseconds, of struct ct_benchmark_report::complexity: the time for a parameter \c n is about \c coefficient times \c f(n)
+	 */
+	double coefficient;
+	/**
+	 * The root mean square error of the fit, relative to the mean of the times
+	 */
+	double error;
+	/**
+	 * The CPU the benchmark has been pinned to. -1 if it hasn't been pinned
+	 */
+	int cpu;
+	/**
+	 * @true if every sample has been measured with a cold cache
+	 */
+	bool cold_cache;
+	/**
+	 * The time, in nanoseconds, the CPU has spun before the benchmark
+	 */
+	long warmup_time;
+	/**
+	 * @true if the allocation tracker was enabled, hence the allocations of every struct ct_benchmark_point have been counted
+	 */
+	bool allocations_counted;
+};
+
+/**
+ * The state of the benchmark running right now
+ */
+struct ct_benchmark {
+	/**
+	 * The measurements collected so far
+	 */
+	struct ct_benchmark_report* report;
+	/**
+	 * The description of the section of the benchmark
+	 */
+	const char* description;
+	/**
+	 * The index, in struct ct_benchmark_report::points, of the value of the parameter being measured
+	 */
+	int point;
+	/**
+	 * The sample of struct ct_benchmark::point being measured. -1 while the body is run to warm up the cache
+	 */
+	int sample;
+	/**
+	 * The times of a single run of the body measured by the samples of struct ct_benchmark::point
+	 */
+	double samples[CT_BENCHMARK_SAMPLES];
+	/**
+	 * How many times the body has been run in the current sample
+	 */
+	long iteration;
+	/**
+	 * When the current sample has started
+	 */
+	struct timespec sample_start;
+	/**
+	 * ct_snapshot::allocations of the benchmark when the current sample has started
+	 */
+	unsigned long sample_allocations;
+	/**
+	 * ct_snapshot::allocated_bytes of the benchmark when the current sample has started
+	 */
+	size_t sample_allocated_bytes;
+	/**
+	 * ct_snapshot::frees of the benchmark when the current sample has started
+	 */
+	unsigned long sample_frees;
+	/**
+	 * With a cold cache, the buffer written before every sample. @null with a warm cache
+	 */
+	volatile char* flush_buffer;
+	/**
+	 * The size of struct ct_benchmark::flush_buffer
+	 */
+	long flush_size;
+	/**
+	 * If struct ct_benchmark_report::cpu is set, the CPUs the process could run on before the benchmark
+	 */
+	unsigned long previous_affinity[CT_BENCHMARK_AFFINITY_WORDS];
+};
+
+/**
+ * Starts a benchmark in struct ct_model::current_section
+ *
+ * The values of the parameter are \c from, <tt>2 * from</tt>, <tt>4 * from</tt> and so on, up to \c to.
+ * The benchmark is pinned to struct ct_model::benchmark_cpu, if set, and the CPU is warmed up.
+ * If \c from is smaller than 1 or \c to is smaller than \c from, nothing is started and struct ct_model::current_snapshot fails.
+ *
+ * \post
+ * 	\li struct ct_model::benchmark is set, unless the range of the parameter is not valid
+ *
+ * @param[inout] model the model to handle
+ * @param[in] parameter_name the name of the variable holding the parameter, used to label the curve
+ * @param[in] from the first value of the parameter, at least 1
+ * @param[in] to the last value of the parameter, at least \c from
+ * @return the first value of the parameter
+ */
+long ct_start_benchmark(struct ct_model* model, const char* parameter_name, long from, long to);
+
+/**
+ * Ends a run of the body of the benchmark and decides whether it needs to be run again
+ *
+ * When the last sample of the last value has been measured, the times are fitted, the report is stored in struct ct_model::current_snapshot
+ * and, if struct ct_model::benchmark_output is set, the curve is written into such directory. If a value has allocated, per run of the body,
+ * more blocks than the ::CT_MAX_ALLOCATIONS_TAG tag of the benchmark allows, the snapshot becomes ::CT_SNAPSHOT_OVER_ALLOCATED.
+ *
+ * @param[inout] model the model whose struct ct_model::benchmark needs to be handled
+ * @param[inout] parameter the variable holding the parameter. It's updated to the next value to measure
+ * @return @true if the body needs to be run again, @false if the benchmark has ended or has not been started
+ */
+bool ct_benchmark_next(struct ct_model* model, long* parameter);
+
+/**
+ * Computes the time of a value of the parameter of a benchmark from its samples
+ *
+ * The samples farther than 1.5 times the interquartile range from the quartiles are rejected; the confidence interval of the mean
+ * of the others is computed by resampling them ::CT_BENCHMARK_BOOTSTRAP_RESAMPLES times, always with the same random numbers.
+ *
+ * \post
+ * 	\li \c samples are sorted
+ * 	\li struct ct_benchmark_point::time, struct ct_benchmark_point::time_low, struct ct_benchmark_point::time_high and struct ct_benchmark_point::outliers are set
+ *
+ * @param[inout] samples the time of a run of the body measured by every sample
+ * @param[in] samples_number the number of items in \c samples
+ * @param[inout] point the value the samples have been measured for
+ */
+void ct_estimate_benchmark_time(double* samples, int samples_number, struct ct_benchmark_point* point);
+
+/**
+ * Spins until the clock frequency of the CPU is stable
+ *
+ * @return the time, in nanoseconds, spent spinning
+ */
+long ct_benchmark_warmup();
+
+/**
+ * Fits the times of a benchmark to the complexity classes
+ *
+ * \post
+ * 	\li struct ct_benchmark_report::complexity, struct ct_benchmark_report::coefficient and struct ct_benchmark_report::error are set
+ *
+ * @param[inout] report the report whose struct ct_benchmark_report::points need to be fitted
+ */
+void ct_fit_complexity(struct ct_benchmark_report* report);
+
+/**
+ * @param[in] complexity a complexity class
+ * @param[in] n the value of the parameter
+ * @return the value of the function of \c complexity in \c n
+ */
+double ct_complexity_function(enum ct_complexity complexity, long n);
+
+/**
+ * @param[in] complexity a complexity class
+ * @return the big O notation of \c complexity, like \c "O(n log n)"
+ */
+const char* ct_complexity_to_string(enum ct_complexity complexity);
+
+/**
+ * Writes the curve of a benchmark
+ *
+ * The function writes 3 files, named after \c description with every character but letters and digits replaced by \c _ :
+ * \li \c name.csv: the measured time of every value of the parameter, with its confidence interval, the fitted one and the allocations per run;
+ * \li \c name.dat: the same data, read by the gnuplot script;
+ * \li \c name.gp: a gnuplot script drawing the curves into \c name.png. Run it with <tt>gnuplot name.gp</tt> from the directory the tests have been run in.
+ *
+ * @param[in] report the measurements to write
+ * @param[in] directory the directory where the files are written
+ * @param[in] description the description of the benchmark
+ * @return @true if the files have been written, @false otherwise
+ */
+bool ct_write_benchmark_curve(const struct ct_benchmark_report* report, const char* directory, const char* description);
+
+/**
+ * Releases from memory a benchmark report
+ *
+ * @param[inout] report the report to dispose of
+ */
+void ct_destroy_benchmark_report(struct ct_benchmark_report* report);
+
+/**
+ * Releases from memory the state of a benchmark, along with the report it has not stored yet
+ *
+ * If the benchmark has been pinned to a CPU, the previous affinity is restored.
+ *
+ * @param[inout] benchmark the state to dispose of
+ */
+void ct_destroy_benchmark(struct ct_benchmark* benchmark);
+
+#endif /* BENCHMARK_H_ */
+/**
+ * @file
+ *
+ * Provides struct ct_section, which is used to represents @containablesection
+ *
+ * @author koldar
+ * @date Feb 16, 2017
+ */
+
+#ifndef SECTION_H_
+#define SECTION_H_
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <time.h>
+
+
+
+
+
+
+
+
+
+
+/**
+ * Represents the type of a ::ct_section
+ *
+ * section type is used to uniquely determine the behaviour of the section itself.
+ */
+enum ct_section_type {
+	/**
+	 * The section is the root of the tree.
+	 */
+	CT_ROOT_SECTION,
+	/**
+	 * The section is a test suite
+	 */
+	CT_TESTSUITE_SECTION,
+	/**
+	 * The section is a testcase
+	 */
+	CT_TESTCASE_SECTION,
+	/**
+	 * The section is a when
+	 */
+	CT_WHEN_SECTION,
+	/**
+	 * The section is a then
+	 */
+	CT_THEN_SECTION,
+	/**
+	 * The section is a stress test
+	 */
+	CT_STRESS_SECTION,
+	/**
+	 * The section is a benchmark
+	 */
+	CT_BENCHMARK_SECTION,
+};
+
+/**
+ * Represents each state a ::ct_section can have
+ *
+ * ::ct_section state is used to check whether or not @crashc runtime should access to the related @containablesection code
+ * or not. This answer greatly depends on the type of the given ::ct_section as well.
+ */
+enum ct_section_status {
+	/**
+	 * Represents a section @crashc knows exists, but it didn't visited it at all
+	 */
+	CT_SECTION_UNVISITED,
+
+	/**
+	 * Represents a section @crashc has visited, but it didn't fully visited
+	 *
+	 * @definition Partially visited section
+	 * It's a section where at least one **direct** or **indirect** child section has not been visited
+	 */
+	CT_SECTION_PARTIALLY_VISITED,
+
+	/**
+	 * Represents a section CrashC has fully explored
+	 *
+	 * @definition Fully visited section
+	 * It's a section where all its direct and indirect children sections have been fully visited
+	 */
+	CT_SECTION_FULLY_VISITED,
+
+	/**
+	 * A section has this state when inside its body the program encountered a signal
+	 *
+	 * The status is set only when the code **directed** owned by the section generates a signal. So for example in
+	 * the figure below the signal was raised during the source code of section "B", after executing section "C" but before section "D"
+	 *
+	 * @dotfile signalDetectedTree.dot
+	 *
+	 * Sections with this status should not be visited anymore (so even if there are undirect children with status ::CT_SECTION_UNVISITED,
+	 * those section will never be run at all.
+	 */
+	CT_SECTION_SIGNAL_DETECTED,
+
+	/**
+	 * A section has this state when we encountered it but we didn't explore its body because the tags were uncompliant with the context
+	 *
+	 * Suppose the user chose to exclude sections whose tags contains "SKIP". If we encounter any section containing the tag "SKIP"
+	 * we need to mark it somehow. This status represents this very concept.
+	 */
+	CT_SECTION_SKIPPED_BY_TAG,
+};
+
+
+/**
+ * Defines the possible statuses in which a snapshot can be.
+ *
+ * This indicates the "exit status" of the section in the particular test
+ */
+enum ct_snapshot_status {
+	/**
+	 * A snapshot contains all **passed assertions**
+	 */
+	CT_SNAPSHOT_OK,
+
+	/**
+	 * A snapshot run a code which produced an unhandled signal
+	 */
+	CT_SNAPSHOT_SIGNALED,
+
+	/**
+	 * A snapshot contained a **failed assertions**
+	 *
+	 */
+	CT_SNAPSHOT_FAILED,
+
+	/**
+	 * A snapshot of a @testcase which didn't release all the memory it allocated
+	 *
+	 * This is set only if the allocation tracker is enabled. See allocation_tracker.h
+	 */
+	CT_SNAPSHOT_LEAKED,
+
+	/**
+	 * A snapshot which allocated more blocks than the \c max_allocs tag of its section allows
+	 *
+	 * This is set only if the allocation tracker is enabled. See ::ct_allocation_tracker_check_bound
+	 */
+	CT_SNAPSHOT_OVER_ALLOCATED,
+};
+
+/**
+ * Contains relevant test results information contained in a ::ct_section at a precise moment of the program execution
+ *
+ * @definition struct ct_section Snapshot
+ * Represents the in-test information a given ::ct_section has. Note that one ::ct_section may actually have several, different, section shapshot, since
+ * a @containablesection represented by a ::ct_section can be run multiple times in a @testcase. A section snapshot is tree because it is a run
+ * of a single cycle of a ::CT_LOOPER, like @testcase: in it, the section are organized as a **tree**, not just as a list. For example a @then may have multiple
+ * but different subsection @then.
+ *
+ * Such information are then used by the test reports to yield to the user a more detailed set of informations about a given test.
+ * Note that this structure contains only the fields of a ::ct_section which are subject to changes during the execution
+ * of the tests. Furthermore, note that this structure represents an implicit tree, used by @crashc to track the relationships between the
+ * sections involved in a precise test
+ */
+struct ct_snapshot {
+	/**
+	 * The description of the ::ct_section represented by the struct
+	 *
+	 * @notnull
+	 */
+	char* description;
+
+	/**
+	 * The tags associated to the ::ct_section represented by the struct
+	 *
+	 * @notnull
+	 */
+	ct_tag_hashtable_o*  tags;
+
+	/**
+	 * The type of the ::ct_section represented by the struct
+	 */
+	enum ct_section_type type;
+
+	/**
+	 * The status of the snapshot.
+	 *
+	 * This pretty much just mimic the status the section to which this snapshot
+	 * refers to, but without some section status which makes no sense in the
+	 * context of the snapshot: for example CT_SECTION_UNVISITED, CT_SECTION_PARTIALLY_VISITED are one of them
+	 */
+	enum ct_snapshot_status status;
+	/**
+	 * The amount of time, in microseconds, the section ran during one specific test.
+	 *
+	 * This field has no meaning until the associated ::ct_section has been completely exeuted during the specific test
+	 */
+	long elapsed_time;
+
+	/**
+	 * The time when the ::ct_section represented by the struct has started running during the specific test
+	 *
+	 * Used to compute ct_snapshot::elapsed_time
+	 */
+	struct timespec start_time;
+
+	/**
+	 * The signal raised while running the code of the ::ct_section represented by the struct
+	 *
+	 * The value is 0 if no signal has been raised within this very snapshot
+	 */
+	int signal_detected;
+
+	/**
+	 * The \c si_code the kernel associated to ct_snapshot::signal_detected
+	 *
+	 * It explains why the signal has been raised (e.g. \c SEGV_MAPERR). Meaningful only when ct_snapshot::signal_detected is not 0
+	 */
+	int signal_code;
+
+	/**
+	 * The faulting address associated to ct_snapshot::signal_detected
+	 *
+	 * Meaningful only when ct_snapshot::signal_detected is not 0
+	 */
+	void* signal_address;
+
+	/**
+	 * The return addresses of the stack frames active when ct_snapshot::signal_detected was raised
+	 *
+	 * The addresses are resolved into symbols only when the report is produced.
+	 * @null if no backtrace has been captured
+	 */
+	void** backtrace;
+
+	/**
+	 * The number of frames inside ct_snapshot::backtrace
+	 */
+	int backtrace_size;
+
+	/**
+	 * The number of blocks the code directly owned by the ::ct_section represented by the struct has allocated
+	 *
+	 * Always 0 if the allocation tracker is disabled. See allocation_tracker.h
+	 */
+	unsigned long allocations;
+
+	/**
+	 * The number of bytes requested by ct_snapshot::allocations
+	 */
+	size_t allocated_bytes;
+
+	/**
+	 * The number of blocks allocated within the test that the code directly owned by the ::ct_section represented by the struct has released
+	 */
+	unsigned long frees;
+
+	/**
+	 * The number of blocks allocated within the test which were never released
+	 *
+	 * Meaningful only for the snapshot of a @testcase
+	 */
+	unsigned long leaked_blocks;
+
+	/**
+	 * The number of bytes of the ct_snapshot::leaked_blocks
+	 */
+	size_t leaked_bytes;
+
+	/**
+	 * The operating system resources consumed while running the ::ct_section represented by the struct, children included
+	 *
+	 * Meaningful only if ct_snapshot::measurements_taken and struct ct_model::measure_resources are @true
+	 */
+	struct ct_resource_usage resource_usage;
+
+	/**
+	 * @true if the measurements of the ::ct_section represented by the struct have been stopped, since the section ended normally
+	 *
+	 * When @true, ct_snapshot::elapsed_time is complete, and so are ct_snapshot::resource_usage and ct_snapshot::hardware_counters
+	 * if they have been requested. It stays @false if the test has been interrupted by a signal or by a failed assertion
+	 */
+	bool measurements_taken;
+
+	/**
+	 * The hardware events happened while running the ::ct_section represented by the struct, children included
+	 *
+	 * Meaningful only if ct_snapshot::measurements_taken is @true and struct ct_model::hardware_counters is not @null.
+	 * Counters which could not be measured are set to ::CT_HARDWARE_COUNTER_UNAVAILABLE
+	 */
+	struct ct_hardware_counters hardware_counters;
+
+	/**
+	 * The measurements of the stress test run by the ::ct_section represented by the struct
+	 *
+	 * @null if the section is not a stress test or if the stress test has not completed
+	 */
+	struct ct_stress_report* stress;
+
+	/**
+	 * The measurements of the benchmark run by the ::ct_section represented by the struct
+	 *
+	 * @null if the section is not a benchmark or if the benchmark has not completed
+	 */
+	struct ct_benchmark_report* benchmark;
+
+	/**
+	 * The list of reports of the assertions executed in the ::ct_section represented.
+	 *
+	 * @notnull
+	 */
+	ct_list_o* assertion_reports;
+
+	/**
+	 * The pointer to the parent snapshot in the snapshot tree.
+	 *
+	 * If @null, the snapshot is actually the root of the tree
+	 */
+	struct ct_snapshot* parent;
+
+	/**
+	 * The pointer to the next sibling of this snapshot in the snapshot tree
+	 *
+	 * If @null, the snapshot is actually the last child of the parent in the snaphshot tree
+	 */
+	struct ct_snapshot* next_sibling;
+
+	/**
+	 * The pointer to the first child of this snapshot in the snapshot tree
+	 *
+	 * If @null, the snapshot has no children, therefore it's a leaf in the snapshot tree
+	 */
+	struct ct_snapshot* first_child;
+};
+
+/**
+ * The data shared by every ::ct_section created at the same place of the source code
+ *
+ * Every @containablesection macro declares a static site, so what depends only on the source code (like the tags) is computed once,
+ * the first time the @containablesection is reached, and not every time a ::ct_section is created out of it (for instance, when the
+ * @containablesection is inside a loop or when the tests are repeated).
+ */
+struct ct_section_site {
+	/**
+	 * @true if ::ct_section_site_prepare has already been called on this site
+	 */
+	bool prepared;
+	/**
+	 * The file where the @containablesection is
+	 */
+	const char* file;
+	/**
+	 * The line where the @containablesection is
+	 */
+	int line;
+	/**
+	 * The tags of the @containablesection. @null until the site is prepared
+	 */
+	ct_tag_hashtable_o* tags;
+	/**
+	 * The next prepared site. See ::ct_section_site_prepare
+	 */
+	struct ct_section_site* next;
+};
+
+/**
+ * The initializer of a struct ct_section_site of the @containablesection at the current line
+ */
+#define CT_SECTION_SITE_INITIALIZER { false, __FILE__, __LINE__, NULL, NULL }
+
+/**
+ * The character separating the descriptions of the sections in a section path
+ *
+ * For instance, <tt>"list/adding on tail/size increments"</tt> is the path of the @then "size increments" inside
+ * the @when "adding on tail" inside the @testcase "list".
+ */
+#ifndef CT_SECTION_PATH_SEPARATOR
+#	define CT_SECTION_PATH_SEPARATOR '/'
+#endif
+
+/**
+ * The hash of the path of the root section
+ */
+#define CT_ROOT_PATH_HASH 5381UL
+
+/**
+ * Main structure representing a piece of testable code
+ *
+ * @definition section
+ * It's data structure representing, in @crashc framework, a given @containablesection.
+ * ::ct_section is one of the most important data structure in @crashc. section are hierarchuically organized in a tree, called **section tree**
+ *
+ * Examples of sections may be @testcase, @when, @then and so on. Whilst this structure **does not contain**
+ * any of the code inside the section, it represents the metadata of such code. An example of metadata is the number of
+ * subsections (aka children) a section has. We need them in order to generate useful statistics.
+ *
+ * For example the following code is structure as exposed in the graph:
+ *
+ * @include exampleOfTestCase.dox
+ *
+ * Sections can be organized as in a tree, like this:
+ *
+ * @dotfile exampleOfTestCase.dot
+ *
+ * Note that the code inside "when 2" is all the code between the thens plus the code within each @then (a total of 9 lines).
+ */
+struct ct_section {
+
+	/**
+	 * An id that uniquely identifies a particular section.
+	 *
+	 * Like the pointer of the section, but more easy to read. Used internally
+	 */
+	int id;
+
+	/**
+	 * Represents the type of this section.
+	 *
+	 * For example you can use this field to get whether the section is a @when, a @then or something else
+	 */
+	enum ct_section_type type;
+
+	/**
+	 * Description of the section
+	 *
+	 * @notnull
+	 */
+	const char* description;
+
+	/**
+	 * List of tags associated to the section
+	 *
+	 * The table belongs to the struct ct_section_site of the section, hence it is shared by every section created at the same place of the source code.
+	 *
+	 * @notnull
+	 */
+	ct_tag_hashtable_o* tags;
+
+	/**
+	 * The hash of the path of the section, namely the descriptions of its ancestors and of the section itself separated by ::CT_SECTION_PATH_SEPARATOR
+	 *
+	 * It's computed with ::ct_section_path_hash from the one of the parent, so no path is ever built.
+	 */
+	unsigned long path_hash;
+
+	/**
+	 * @true if the section is an ancestor, a descendant or the section selected with ::ct_select_section_path itself
+	 *
+	 * When no section is selected, it's always @true. Sections with this field set to @false are never entered.
+	 */
+	bool on_target_path;
+
+	/**
+	 * @true if the section is the section selected with ::ct_select_section_path or one of its descendants
+	 *
+	 * When no section is selected, it's always @true.
+	 */
+	bool inside_target;
+
+	/**
+	 * determine if ::ct_section::children_number has a meaning
+	 *
+	 * The field is @true if we have already scanned the section content at least once. This means
+	 * that we explore the associated @containablesection from the beginning till the end. This has 2 effects:
+	 * 	\li we know whether there are subsections inside the @containablesection or not;
+	 *	\li we know the actual number of children the section has;
+	 *
+	 * The second effects allows us to safely use ct_section::children_number and ct_section::first_child
+	 */
+	bool children_number_known;
+
+	/**
+	 * the number of subsection this section has
+	 *
+	 * This field has only a meaning when ::ct_section::children_number_known is set to @true.
+	 * For example, given the code:
+	 *
+	 * @include exampleOfTestCase.dox
+	 *
+	 * section "when 2" has 2 children, namely "then 1" and "then 2"
+	 */
+	int children_number;
+
+	/**
+	 * Holds information about the current state of the section.
+	 *
+	 */
+	enum ct_section_status status;
+
+	/**
+	 * The number of the child we're currently analyzing
+	 *
+	 * Given the test code:
+	 *
+	 * @include exampleOfTestCase.dox
+	 *
+	 * Suppose you are in "when 3" for the first time (this also applies, although for different reasons, even if you're exploring the section
+	 * for the n-th time). Since when you just entered in "when 3" you can't possibly know the exact children of the section, since the program still needs to read
+	 * the code, you can't immediately create the relevant section tree.
+	 *
+	 * After you've done analyzing a subsection (i.e "then 3"), you need to increase a counter representing the number of children you've encoutered
+	 * so far when analyzing "when 3" and keep analyzing "when 3" by executing the code, eventually arriving to the next section child (i.e. "then 4").
+	 * This field does exactly represent such counter. When the program arrives at the end of "when 3", this counter will also represents the actual number of children
+	 * "when 3" has.
+	 */
+	int current_child;
+
+	/**
+	 * The number of times the @crashc encountered this section instance
+	 *
+	 * \note
+	 * "encounters" means that we reach the macro definition. It doesn't matter if we actually enter or not, the counter will increase nonetheless
+	 */
+	int times_encountered;
+
+	/**
+	 * The variable used to loop only once inside parent switcher in ::CT_CONTAINABLE_SECTION
+	 *
+	 * \attention this variable is for internal usage only
+	 *
+	 * The for loop is an excellent way to have, after a macro, "{ }" and to execute code after the actual "{ }" code content.
+	 * However, we need to call the for content only once. Since section are nested, we cannot define a counter to loop over otherwise
+	 * 2 nested section will generate a <c>variable redefinition</c> compile error. Hence we store the loop variable inside the section itself.
+	 */
+	bool loop1;
+
+	/**
+	 * like ::ct_section::loop1, but for the access cycle inside ::CT_CONTAINABLE_SECTION
+	 */
+	bool loop2;
+
+	/**
+	 * @true if the software has given us the access to execute the code inside the struct ct_section, @false otherwise
+	 */
+	bool access_granted;
+
+	/**
+	 * @true if the software has given us the access to execute the code tag-wise
+	 *
+	 * The software can deny the access to the underlying section for 2 reasons:
+	 * \li the section has incompatible tags with the tag context of the run test;
+	 * \li the condition of the section is not satisfied;
+	 *
+	 *
+	 * The first check is computed before the second one. Together with  ::ct_section::access_granted, this field
+	 * allow you to understand why a particular section has been denied. In particular this field is @true
+	 * if the section tags are compatible with the tag context; @false otherwise
+	 */
+	bool tag_access_granted;
+
+	/**
+	 * Used to ensure that sibling @when sections are executed in the proper order.
+	 *
+	 * Since only a single @when needs to be executed during a given @testcase loop, we use
+	 * this field in the parent section to know if during this cycle we already found and
+	 * executed a @when section.
+	 *
+	 * This implies that this field needs to be reset at every @testcase cycle.
+	 */
+	bool already_found_when;
+
+	/**
+	 * The signal detected when running this section
+	 *
+	 * The value is meaningful only when ::ct_section::status is set to ::CT_SECTION_SIGNAL_DETECTED
+	 */
+	int signal_detected;
+
+	///the parent of this section in the tree. May be @null
+	struct ct_section* parent;
+
+	///the first child this section has in the tree. May be @null
+	struct ct_section* first_child;
+
+	///the next sibling this section has in the tree. May be @null
+	struct ct_section* next_sibling;
+};
+
+/**
+ * Adds a ::ct_section inside the children list of a parent section
+ *
+ * @param[in] to_add the new child \c parent has;
+ * @param[inout] parent the parent \c toAdd have from this point on;
+ * @return \c toAdd
+ */
+struct ct_section* ct_section_add_child(struct ct_section* restrict to_add, struct ct_section* restrict parent);
+/**
+ * get the n-th child of a given ::ct_section
+ *
+ * @param[in] parent the parent involved
+ * @param[in] n the number of the child we want to fetch
+ * @return
+ * 	\li the n-th child of parent;
+ * 	\li NULL if such child does not exist
+ */
+struct ct_section* ct_section_get_child(const struct ct_section* parent, int n);
+
+/**
+ * Get the level of the given section in the hierarchy.
+ *
+ * @param[in] section The involved section
+ * @return The level of the section in the hierarchy
+ */
+int ct_section_get_level(const struct ct_section* section);
+
+/**
+ * Creates a new section
+ *
+ * \attention
+ * The function allocates data in the heap. To remove it, call ::ct_section_destroy
+ *
+ * @param[in] type the type of this section
+ * @param[in] description a text describing briefly the section
+ * @param[in] tags the tags associated to the section. The section doesn't own them. See \ref tags
+ * @return the new ::ct_section instance just created
+ */
+struct ct_section* ct_section_init(enum ct_section_type type, const char* description, ct_tag_hashtable_o* tags);
+/**
+ * Destroy a ::ct_section inside the heap
+ *
+ * \note
+ * The function will destory all the sections which have parent (directly or indirectly) \c section.
+ * Formally, the function will free from the memory the subtree generate by \c section (\c section included).
+ *
+ * There is only a ::ct_section that won't be freed by this function: all the sections with struct ct_section::levelId set to 0 won't be touched.
+ * Normally this isn't a problem because there is only one ::ct_section with such an id: struct ct_section::rootSection. The rationale is that such variable is global one
+ * allocated in the \b stack, so freeing such a variable is illegal.
+ *
+ * @param[inout] section the section to free
+ */
+void ct_section_destroy(struct ct_section* section);
+
+/**
+ * Check if we're still retrieving the number of children a given section has
+ *
+ * @param[in] section the section to analyze
+ * @return
+ * 	\li @true if we're still computing the number of children of \c section,
+ * 	\li @false otheriwse
+ */
+static inline bool ct_section_still_discovering_children(const struct ct_section* section) {
+	return !section->children_number_known;
+}
+
+/**
+ * Marks the given section as a section where the related @containablesection raised a signal
+ *
+ * @param[inout] section the section to alter
+ */
+static inline void ct_section_set_signaled(struct ct_section* section) {
+	section->status = CT_SECTION_SIGNAL_DETECTED;
+}
+
+/**
+ * Check if the related @containablesection has raise a signal
+ *
+ * @param[in] section the section to check
+ * @return true if the section was marked as signal detected; false otherwise
+ */
+static inline bool ct_section_is_signaled(const struct ct_section* section) {
+	return section->status == CT_SECTION_SIGNAL_DETECTED;
+}
+
+/**
+ * Mark the section as **partially executed**
+ *
+ * @param[inout] section the section to mark
+ */
+static inline void ct_section_set_executed(struct ct_section* section) {
+	section->status = CT_SECTION_PARTIALLY_VISITED;
+}
+
+/**
+ * Mark the section as **fully visited**
+ *
+ * @param[inout] section the section to mark
+ */
+static inline void ct_section_set_done(struct ct_section* section) {
+	section->status = CT_SECTION_FULLY_VISITED;
+}
+
+/**
+ * Mark section as a one which we didn't explore because of the tags
+ *
+ * @param[inout] section the section whose status we need to update
+ */
+static inline void ct_section_set_skipped(struct ct_section* section) {
+	section->status = CT_SECTION_SKIPPED_BY_TAG;
+}
+
+/**
+ * Tells if a given section will be executed again depending on its status.
+ *
+ * @param[in] section the section to manage
+ * @return
+ *  \li @true if the status is either ::CT_SECTION_UNVISITED or ::CT_SECTION_PARTIALLY_VISITED;
+ *  \li @false iff the status is either ::CT_SECTION_SKIPPED_BY_TAG, ::CT_SECTION_FULLY_VISITED or ::CT_SECTION_SIGNAL_DETECTED;
+ */
+static inline bool ct_section_still_needs_execution(const struct ct_section* section) {
+	return section->status == CT_SECTION_UNVISITED || section->status == CT_SECTION_PARTIALLY_VISITED;
+}
+
+/*
+ * We use this function to determine whether we can set a section as fully visited.
+ *
+ * If so, we don't need to execute it anymore.
+ * A section is considered fully executed in two cases:
+ * -# When it has no child
+ * -# When every **direct** children of the section is fully visited itself
+ *
+ * Note that we first check if the section has been executed at least once, as
+ * if a given section has never been executed it surely can not be fully visited.
+ *
+ * @param[in] section the section to manage
+ * @return
+ * 	\li @true if we don't need to visit the section anymore;
+ * 	\li @false otherwise
+ */
+bool ct_section_is_fully_visited(struct ct_section* section);
+
+/**
+ * Identifies a @testcase across different processes running the same tests
+ *
+ * Several @testcase may have the same path, for instance a @testcase inside a loop, so the path alone is not enough.
+ */
+struct ct_testcase_key {
+	/**
+	 * The struct ct_section::path_hash of the @testcase
+	 */
+	unsigned long path_hash;
+	/**
+	 * How many @testcase with the same path have been met before this one
+	 */
+	int occurrence;
+};
+
+/**
+ * Computes a hash of a ::ct_testcase_key, to index it in a hash table
+ *
+ * @param[in] key the key to hash
+ * @return the hash of \c key
+ */
+unsigned long ct_testcase_key_hash(const struct ct_testcase_key* key);
+
+/**
+ * Computes the hash of the path of a section from the hash of the path of its parent
+ *
+ * The hash is rolling: the hash of <tt>"a/b"</tt> is obtained by extending the hash of <tt>"a"</tt> with <tt>"b"</tt>. Hence
+ * the hashes of every prefix of a path are computed while scanning it once.
+ *
+ * @param[in] parent_hash the hash of the path of the parent. ::CT_ROOT_PATH_HASH for the children of the root section
+ * @param[in] description the description of the section
+ * @param[in] length the number of characters of \c description to consider
+ * @return the hash of the path of the section
+ */
+unsigned long ct_section_path_hash(unsigned long parent_hash, const char* description, size_t length);
+
+/**
+ * Computes the data of a site, unless it has already been done
+ *
+ * The tags are parsed here. If they are malformed (see ::ct_tag_ht_populate), a warning is printed: since a site is prepared only once,
+ * every malformed @containablesection is reported only once.
+ *
+ * \post
+ * 	\li \c site is prepared and it's the head of \c prepared_sites
+ *
+ * @param[inout] site the site to prepare
+ * @param[in] tags the tags of the @containablesection, separated by ::CT_TAGS_SEPARATOR
+ * @param[inout] prepared_sites the head of the list of the sites prepared so far
+ */
+void ct_section_site_prepare(struct ct_section_site* site, const char* tags, struct ct_section_site** prepared_sites);
+
+/**
+ * Releases the data of the prepared sites, so that they can be prepared again
+ *
+ * Sites are static variables, hence they survive the model: after this call they are in the same state they were before
+ * being prepared.
+ *
+ * @param[inout] prepared_sites the head of the list of the prepared sites. It's emptied
+ */
+void ct_section_sites_release(struct ct_section_site** prepared_sites);
+
+/**
+ * Generates an image of the section tree useful for debugging purposes
+ *
+ * \pre
+ * 	\li graphviz installed on your system and available in your PATH;
+ * \post
+ * 	\li a png file named like \c format will be present. The path is relative to the CWD
+ *
+ * @param[in] section the section tree where you want to start drawing
+ * @param[in] format a `printf` like format string with all the formatter strings
+ * @param[in] ... variadic components of `printf`
+ */
+void ct_section_draw_tree(const struct ct_section* section, const char* format, ...);
+
+#endif /* SECTION_H_ */
+/**
+ * @file
+ *
+ * Module containing a set of general purpose macros used throughout all the project
+ *
+ * @author koldar
+ * @date Jun 29, 2017
+ */
+
+#ifndef MACROS_H_
+#define MACROS_H_
+
+/**
+ * the character used to divide tags inside a single string
+ *
+ * Setting this macro to '#' means that the tags are required to be defined as "hello#world".
+ * See @ref tags for further information
+ */
+#ifndef CT_TAGS_SEPARATOR
+#	define CT_TAGS_SEPARATOR ' '
+#endif
+
+/**
+ * The size of temporary buffers created, when needed, throughout the project
+ *
+ * Enlarge such buffer if you happen to have to deal with longer strings
+ */
+#ifndef CT_BUFFER_SIZE
+#	define CT_BUFFER_SIZE 300
+#endif
+
+/**
+ * macro used to perform macro concatenation.
+ *
+ * @note
+ * do not used this directly. Use ::CT_TOKENPASTE2 instead
+ *
+ * @param[in] x the first identifier to concat
+ * @param[in] y the second identifier to concat
+ * @return \c x concatenated with \c y
+ * @see CT_TOKENPASTE2
+ */
+#ifdef CT_TOKENPASTE
+#	error "CrashC - CT_TOKENPASTE macro is already defined!"
+#endif
+#define CT_TOKENPASTE(x, y) x ## y
+/**
+ * Macro used to perform concatenation.
+ *
+ * @note
+ * this is the macro you want to use to perform concatenation
+ *
+ * @param[in] x the first identifier to concat
+ * @param[in] y the second identifier to concat
+ * @return \c x concatenated with \c y
+ */
+#ifdef CT_TOKENPASTE2
+#	error "CrashC - CT_TOKENPASTE2 macro is already defined!"
+#endif
+#define CT_TOKENPASTE2(x, y) CT_TOKENPASTE(x, y)
+
+/**
+ * Macro used to paste to a string \c v another sting, making \c v unique.
+ *
+ * This macro is incredible useful to produce variables names which you need to ensure are unique.
+ * For example they are useful in for loops where you don't actually care about the names of the counter, but you only
+ * want to fetch some data from a collection. For example:
+ *
+ * @code
+ * int CT_UV(a); //produce a12 assuming the code is on line 12
+ * int CT_UV(a); //produce a13 assuming the code is on line 13
+ * //produce 2 different "a" variables
+ * @endcode
+ *
+ * @param[in] v code to prepend to the line number
+ * @return if \c v is a valid C identifier, this may represent a new unique variable name
+ */
+#ifdef CT_UV
+#	error "CrashC - CT_UV macro is already defined!"
+#endif
+#define CT_UV(v) CT_TOKENPASTE2(v, __LINE__)
+
+//FOREACH macros, used to iterate on the arguments passed to the REG_SUITES macro
+#define CT_FE_0
+#define CT_FE_1(WHAT, X) WHAT(X)
+#define CT_FE_2(WHAT, X, ...) WHAT(X); CT_FE_1(WHAT, __VA_ARGS__)
+#define CT_FE_3(WHAT, X, ...) WHAT(X); CT_FE_2(WHAT, __VA_ARGS__)
+#define CT_FE_4(WHAT, X, ...) WHAT(X); CT_FE_3(WHAT, __VA_ARGS__)
+#define CT_FE_5(WHAT, X, ...) WHAT(X); CT_FE_4(WHAT, __VA_ARGS__)
+#define CT_FE_6(WHAT, X, ...) WHAT(X); CT_FE_5(WHAT, __VA_ARGS__)
+#define CT_FE_7(WHAT, X, ...) WHAT(X); CT_FE_6(WHAT, __VA_ARGS__)
+#define CT_FE_8(WHAT, X, ...) WHAT(X); CT_FE_7(WHAT, __VA_ARGS__)
+#define CT_FE_9(WHAT, X, ...) WHAT(X); CT_FE_8(WHAT, __VA_ARGS__)
+#define CT_FE_10(WHAT, X, ...) WHAT(X); CT_FE_9(WHAT, __VA_ARGS__)
+#define CT_FE_11(WHAT, X, ...) WHAT(X); CT_FE_10(WHAT, __VA_ARGS__)
+#define CT_FE_12(WHAT, X, ...) WHAT(X); CT_FE_11(WHAT, __VA_ARGS__)
+#define CT_FE_13(WHAT, X, ...) WHAT(X); CT_FE_12(WHAT, __VA_ARGS__)
+#define CT_FE_14(WHAT, X, ...) WHAT(X); CT_FE_13(WHAT, __VA_ARGS__)
+#define CT_FE_15(WHAT, X, ...) WHAT(X); CT_FE_14(WHAT, __VA_ARGS__)
+#define CT_FE_16(WHAT, X, ...) WHAT(X); CT_FE_15(WHAT, __VA_ARGS__)
+#define CT_FE_17(WHAT, X, ...) WHAT(X); CT_FE_16(WHAT, __VA_ARGS__)
+#define CT_FE_18(WHAT, X, ...) WHAT(X); CT_FE_17(WHAT, __VA_ARGS__)
+#define CT_FE_19(WHAT, X, ...) WHAT(X); CT_FE_18(WHAT, __VA_ARGS__)
+#define CT_FE_20(WHAT, X, ...) WHAT(X); CT_FE_19(WHAT, __VA_ARGS__)
+#define CT_FE_21(WHAT, X, ...) WHAT(X); CT_FE_20(WHAT, __VA_ARGS__)
+#define CT_FE_22(WHAT, X, ...) WHAT(X); CT_FE_21(WHAT, __VA_ARGS__)
+#define CT_FE_23(WHAT, X, ...) WHAT(X); CT_FE_22(WHAT, __VA_ARGS__)
+#define CT_FE_24(WHAT, X, ...) WHAT(X); CT_FE_23(WHAT, __VA_ARGS__)
+#define CT_FE_25(WHAT, X, ...) WHAT(X); CT_FE_24(WHAT, __VA_ARGS__)
+#define CT_FE_26(WHAT, X, ...) WHAT(X); CT_FE_25(WHAT, __VA_ARGS__)
+#define CT_FE_27(WHAT, X, ...) WHAT(X); CT_FE_26(WHAT, __VA_ARGS__)
+#define CT_FE_28(WHAT, X, ...) WHAT(X); CT_FE_27(WHAT, __VA_ARGS__)
+#define CT_FE_29(WHAT, X, ...) WHAT(X); CT_FE_28(WHAT, __VA_ARGS__)
+#define CT_FE_30(WHAT, X, ...) WHAT(X); CT_FE_29(WHAT, __VA_ARGS__)
+#define CT_FE_31(WHAT, X, ...) WHAT(X); CT_FE_30(WHAT, __VA_ARGS__)
+#define CT_FE_32(WHAT, X, ...) WHAT(X); CT_FE_31(WHAT, __VA_ARGS__)
+#define CT_FE_33(WHAT, X, ...) WHAT(X); CT_FE_32(WHAT, __VA_ARGS__)
+#define CT_FE_34(WHAT, X, ...) WHAT(X); CT_FE_33(WHAT, __VA_ARGS__)
+#define CT_FE_35(WHAT, X, ...) WHAT(X); CT_FE_34(WHAT, __VA_ARGS__)
+#define CT_FE_36(WHAT, X, ...) WHAT(X); CT_FE_35(WHAT, __VA_ARGS__)
+#define CT_FE_37(WHAT, X, ...) WHAT(X); CT_FE_36(WHAT, __VA_ARGS__)
+#define CT_FE_38(WHAT, X, ...) WHAT(X); CT_FE_37(WHAT, __VA_ARGS__)
+#define CT_FE_39(WHAT, X, ...) WHAT(X); CT_FE_38(WHAT, __VA_ARGS__)
+#define CT_FE_40(WHAT, X, ...) WHAT(X); CT_FE_39(WHAT, __VA_ARGS__)
+#define CT_FE_41(WHAT, X, ...) WHAT(X); CT_FE_40(WHAT, __VA_ARGS__)
+#define CT_FE_42(WHAT, X, ...) WHAT(X); CT_FE_41(WHAT, __VA_ARGS__)
+#define CT_FE_43(WHAT, X, ...) WHAT(X); CT_FE_42(WHAT, __VA_ARGS__)
+#define CT_FE_44(WHAT, X, ...) WHAT(X); CT_FE_43(WHAT, __VA_ARGS__)
+#define CT_FE_45(WHAT, X, ...) WHAT(X); CT_FE_44(WHAT, __VA_ARGS__)
+#define CT_FE_46(WHAT, X, ...) WHAT(X); CT_FE_45(WHAT, __VA_ARGS__)
+#define CT_FE_47(WHAT, X, ...) WHAT(X); CT_FE_46(WHAT, __VA_ARGS__)
+#define CT_FE_48(WHAT, X, ...) WHAT(X); CT_FE_47(WHAT, __VA_ARGS__)
+#define CT_FE_49(WHAT, X, ...) WHAT(X); CT_FE_48(WHAT, __VA_ARGS__)
+#define CT_FE_50(WHAT, X, ...) WHAT(X); CT_FE_49(WHAT, __VA_ARGS__)
+#define CT_FE_51(WHAT, X, ...) WHAT(X); CT_FE_50(WHAT, __VA_ARGS__)
+#define CT_FE_52(WHAT, X, ...) WHAT(X); CT_FE_51(WHAT, __VA_ARGS__)
+#define CT_FE_53(WHAT, X, ...) WHAT(X); CT_FE_52(WHAT, __VA_ARGS__)
+#define CT_FE_54(WHAT, X, ...) WHAT(X); CT_FE_53(WHAT, __VA_ARGS__)
+#define CT_FE_55(WHAT, X, ...) WHAT(X); CT_FE_54(WHAT, __VA_ARGS__)
+#define CT_FE_56(WHAT, X, ...) WHAT(X); CT_FE_55(WHAT, __VA_ARGS__)
+#define CT_FE_57(WHAT, X, ...) WHAT(X); CT_FE_56(WHAT, __VA_ARGS__)
+#define CT_FE_58(WHAT, X, ...) WHAT(X); CT_FE_57(WHAT, __VA_ARGS__)
+#define CT_FE_59(WHAT, X, ...) WHAT(X); CT_FE_58(WHAT, __VA_ARGS__)
+#define CT_FE_60(WHAT, X, ...) WHAT(X); CT_FE_59(WHAT, __VA_ARGS__)
+#define CT_FE_61(WHAT, X, ...) WHAT(X); CT_FE_60(WHAT, __VA_ARGS__)
+#define CT_FE_62(WHAT, X, ...) WHAT(X); CT_FE_61(WHAT, __VA_ARGS__)
+#define CT_FE_63(WHAT, X, ...) WHAT(X); CT_FE_62(WHAT, __VA_ARGS__)
+#define CT_FE_64(WHAT, X, ...) WHAT(X); CT_FE_63(WHAT, __VA_ARGS__)
+
+/**
+ * Macro used to implement macro variadic arguments
+ */
+#ifdef CT_GET_FE_NAME
+#	error "CrashC - CT_GET_FE_NAME macro is already defined!"
+#endif
+#define CT_GET_FE_NAME( 										\
+          _0, _1, _2, _3, _4, _5, _6, _7, _8, _9,_10, 		\
+         _11,_12,_13,_14,_15,_16,_17,_18,_19,_20, 			\
+         _21,_22,_23,_24,_25,_26,_27,_28,_29,_30, 			\
+         _31,_32,_33,_34,_35,_36,_37,_38,_39,_40, 			\
+         _41,_42,_43,_44,_45,_46,_47,_48,_49,_50, 			\
+         _51, _52, _53, _54, _55, _56, _57, _58, _59, 		\
+         _60, _61, _62, _63, name, ...) name
+
+#ifdef CT_VARIADIC_MACRO
+#	error "CrashC - CT_VARIADIC_MACRO macro is already defined!"
+#endif
+#define CT_VARIADIC_MACRO(name, ...) CT_GET_FE_NAME(__VA_ARGS__, CT_FE_64, CT_FE_63, CT_FE_62, 				\
+    CT_FE_61, CT_FE_60, CT_FE_59, CT_FE_58, CT_FE_57, CT_FE_56, CT_FE_55, CT_FE_54, CT_FE_53, CT_FE_52, CT_FE_51,CT_FE_50, 			\
+    CT_FE_49, CT_FE_48, CT_FE_47,CT_FE_46,CT_FE_45,CT_FE_44,CT_FE_43,CT_FE_42,CT_FE_41,CT_FE_40, 								\
+    CT_FE_39,CT_FE_38,CT_FE_37,CT_FE_36,CT_FE_35,CT_FE_34,CT_FE_33,CT_FE_32,CT_FE_31,CT_FE_30, 								\
+    CT_FE_29,CT_FE_28,CT_FE_27,CT_FE_26,CT_FE_25,CT_FE_24,CT_FE_23,CT_FE_22,CT_FE_21,CT_FE_20, 								\
+    CT_FE_19,CT_FE_18,CT_FE_17,CT_FE_16,CT_FE_15,CT_FE_14,CT_FE_13,CT_FE_12,CT_FE_11,CT_FE_10, 								\
+    CT_FE_9,CT_FE_8,CT_FE_7,CT_FE_6,CT_FE_5,CT_FE_4,CT_FE_3,CT_FE_2,CT_FE_1, CT_FE_0)(name, __VA_ARGS__)
+
+
+#endif /* MACROS_H_ */
+/**
+ * @file
+ *
+ * Module collecting all the error macros used in the project
+ *
+ * You can compile time customize the code when a specific error occurs.
+ * Normally it simply call \c exit function with a specific error code
+ *
+ * @author koldar
+ * @date Feb 15, 2017
+ */
+
+#ifndef ERRORS_H_
+#define ERRORS_H_
+
+/**
+ * C code to execute when a \c malloc returns NULL
+ *
+ */
+#ifndef CT_MALLOC_ERROR_CALLBACK
+#	define CT_MALLOC_ERROR_CALLBACK() exit(1)
+#endif
+
+
+
+#endif /* ERRORS_H_ */
+/**
+ * @file
+ *
+ * Module counting the dynamic memory allocations performed by the code under test
+ *
+ * The tracker interposes \c malloc, \c calloc, \c realloc and \c free through the linker \c --wrap option. To enable it, link your
+ * test executable with:
+ *
+ * @code
+ * -Wl,--wrap=malloc,--wrap=calloc,--wrap=realloc,--wrap=free
+ * @endcode
+ *
+ * If the executable is linked without such flags, the wrappers are never called and @crashc behaves exactly like before.
+ * When enabled, every snapshot counts the allocations, the frees and the bytes requested by the code it directly owns; furthermore
+ * every block allocated inside a test and not released by the end of it is considered leaked and makes the test fail.
+ *
+ * Only the allocations performed by the code under test are counted: the ones @crashc performs to build its own data structures are
+ * excluded (see ::ct_allocation_tracker_pause). Memory allocated by a shared library on behalf of the code under test (e.g. \c strdup)
+ * is not wrapped by the linker, hence it is never counted.
+ *
+ * A section can bound the blocks it allocates with a tag like \c max_allocs:0 (see ::CT_MAX_ALLOCATIONS_TAG): a @testcase allocating more blocks,
+ * or a benchmark allocating more blocks per run of its body, becomes ::CT_SNAPSHOT_OVER_ALLOCATED. This keeps hot paths allocation-free over time.
+ *
+ * The tracker can be used by several threads at the same time: allocations performed by the threads spawned by the code under test are
+ * accounted to the snapshot running when the thread has been spawned (see ::ct_get_thread_snapshot). This requires linking with
+ * \c -Wl,--wrap=pthread_create as well: the allocations of the threads spawned without such flag are not accounted to any snapshot.
+ *
+ * @author koldar
+ * @date Oct 19, 2026
+ */
+
+#ifndef ALLOCATION_TRACKER_H_
+#define ALLOCATION_TRACKER_H_
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <pthread.h>
+
+
+
+/**
+ * The initial number of cells of the table storing the blocks allocated by a test
+ *
+ * It needs to be a power of 2
+ */
+#ifndef CT_ALLOCATION_TABLE_INITIAL_SIZE
+#	define CT_ALLOCATION_TABLE_INITIAL_SIZE 256
+#endif
+
+/**
+ * The key of the tag bounding the blocks a section can allocate
+ *
+ * A section tagged <tt>max_allocs:N</tt> (or <tt>[max_allocs:N]</tt>) fails if it allocates more than \c N blocks. For a @testcase, the blocks
+ * allocated by the whole test but its benchmarks are counted; for a benchmark, the blocks allocated by a single run of its body.
+ * The bound is ignored if the allocation tracker is disabled.
+ */
+#ifndef CT_MAX_ALLOCATIONS_TAG
+#	define CT_MAX_ALLOCATIONS_TAG "max_allocs"
+#endif
+
+/**
+ * Keeps track of the memory blocks allocated by the code under test
+ *
+ * @definition Live block
+ * It's a memory block allocated by the code under test within the current test and not released yet
+ */
+struct ct_allocation_tracker {
+	/**
+	 * @true if the executable has been linked with the allocation wrappers, @false otherwise
+	 *
+	 * If @false, the tracker does nothing at all
+	 */
+	bool enabled;
+	/**
+	 * @true if a test is running right now
+	 *
+	 * Allocations are counted only while a test is running
+	 */
+	bool active;
+	/**
+	 * Lock protecting the table of live blocks and the allocation counters of the snapshots
+	 */
+	pthread_mutex_t lock;
+	/**
+	 * Open addressing table containing the addresses of the live blocks
+	 *
+	 * Empty cells contain @null
+	 */
+	void** blocks;
+	/**
+	 * The size, in bytes, of each block inside ct_allocation_tracker::blocks
+	 */
+	size_t* block_sizes;
+	/**
+	 * The number of cells of ct_allocation_tracker::blocks. Always a power of 2
+	 */
+	size_t capacity;
+	/**
+	 * The number of live blocks
+	 */
+	size_t live_blocks;
+	/**
+	 * The sum of the sizes of all the live blocks
+	 */
+	size_t live_bytes;
+};
+
+/**
+ * Creates a new allocation tracker in memory
+ *
+ * \note
+ * The tracker is enabled only if the allocation wrappers have been linked in the executable
+ *
+ * @return the allocation tracker
+ */
+struct ct_allocation_tracker* ct_init_allocation_tracker();
+
+/**
+ * Releases from memory an allocation tracker
+ *
+ * @param[inout] tracker the tracker to dispose of
+ */
+void ct_destroy_allocation_tracker(struct ct_allocation_tracker* tracker);
+
+/**
+ * Starts counting the allocations performed by the code under test
+ *
+ * Any block tracked so far is forgotten
+ *
+ * @param[inout] tracker the tracker to handle
+ */
+void ct_allocation_tracker_start(struct ct_allocation_tracker* tracker);
+
+/**
+ * Stops counting the allocations performed by the code under test
+ *
+ * The live blocks are still available in the tracker after this call
+ *
+ * @param[inout] tracker the tracker to handle
+ */
+void ct_allocation_tracker_stop(struct ct_allocation_tracker* tracker);
+
+/**
+ * Tells the tracker @crashc is about to perform operations on its own data structures
+ *
+ * Every allocation performed by the calling thread until the matching ::ct_allocation_tracker_resume is not accounted to the code under test.
+ * Calls can be nested. The state is kept per thread, hence no tracker is needed.
+ */
+void ct_allocation_tracker_pause();
+
+/**
+ * Tells the tracker @crashc has finished operating on its own data structures
+ *
+ * @see ct_allocation_tracker_pause
+ */
+void ct_allocation_tracker_resume();
+
+/**
+ * Stores in the snapshot the blocks leaked by the test just finished
+ *
+ * If at least one block has been leaked and the snapshot was ::CT_SNAPSHOT_OK, the snapshot becomes ::CT_SNAPSHOT_LEAKED.
+ *
+ * @param[inout] tracker the tracker to handle
+ * @param[inout] snapshot the snapshot of the @testcase just finished
+ */
+void ct_allocation_tracker_check_leaks(struct ct_allocation_tracker* tracker, struct ct_snapshot* snapshot);
+
+/**
+ * Reads the allocation counters of a snapshot while the code under test may still be updating them
+ *
+ * @param[in] tracker the tracker updating the counters
+ * @param[in] snapshot the snapshot whose counters need to be read
+ * @param[out] allocations ct_snapshot::allocations
+ * @param[out] allocated_bytes ct_snapshot::allocated_bytes
+ * @param[out] frees ct_snapshot::frees
+ */
+void ct_allocation_tracker_read(struct ct_allocation_tracker* tracker, const struct ct_snapshot* snapshot, unsigned long* allocations, size_t* allocated_bytes, unsigned long* frees);
+
+/**
+ * Checks the blocks allocated by the test just finished against the bound of its @testcase
+ *
+ * The blocks allocated by every snapshot of the test are summed, but the ones of the benchmarks, which are bounded per run of their body.
+ * If the sum exceeds the ::CT_MAX_ALLOCATIONS_TAG tag of the @testcase, or a benchmark has exceeded its own bound, and the snapshot
+ * was ::CT_SNAPSHOT_OK, the snapshot becomes ::CT_SNAPSHOT_OVER_ALLOCATED.
+ *
+ * @param[in] tracker the tracker to handle
+ * @param[inout] snapshot the snapshot of the @testcase just finished
+ */
+void ct_allocation_tracker_check_bound(struct ct_allocation_tracker* tracker, struct ct_snapshot* snapshot);
+
+/**
+ * @defgroup allocationWrappers Allocation Wrappers
+ * @brief functions replacing the standard allocation functions when the executable is linked with \c --wrap
+ * @{
+ */
+
+void* __wrap_malloc(size_t size);
+void* __wrap_calloc(size_t number, size_t size);
+void* __wrap_realloc(void* pointer, size_t size);
+void __wrap_free(void* pointer);
+
+///@}
+
+#endif /* ALLOCATION_TRACKER_H_ */
+/**
+ * @file
+ *
+ * Module allowing the code under test to use assertions from threads other than the one running the tests
+ *
+ * @crashc runs every test on a single thread, called **main thread**: it's the only one which owns struct ct_model::current_section,
+ * struct ct_model::current_snapshot and struct ct_model::jump_point. Threads spawned by the code under test (**worker threads**) never touch them:
+ * \li every worker thread spawned while the executable is linked with <tt>-Wl,--wrap=pthread_create</tt> gets its own struct ct_thread_context,
+ * 	which holds its jump point, its alternate signal stack and the snapshot it works for, namely the one running when the thread has been spawned;
+ * \li every assertion a worker thread performs is published, without any lock nor allocation, in a stack inside the model. The main thread moves the
+ * 	published assertions into the snapshot of a @containablesection when such section ends;
+ * \li a failed assertion on a worker thread terminates the worker thread only (just like \c pthread_exit). The failure is then propagated
+ * 	to the @testcase owning the section;
+ * \li a fatal signal raised on a worker thread is recorded and the worker thread jumps back to where it has been started, terminating.
+ * 	The snapshot of the section is then marked as signaled. A worker thread without a struct ct_thread_context has nowhere to jump back to:
+ * 	in that case the signal terminates the whole process;
+ * \li the allocations of a worker thread are accounted to the snapshot it works for, under the lock of the allocation tracker.
+ *
+ * Since assertions are merged when a section ends, join the threads you spawn before the section where they have been spawned ends.
+ *
+ * @author koldar
+ * @date Oct 19, 2026
+ */
+
+#ifndef THREAD_CONTEXT_H_
+#define THREAD_CONTEXT_H_
+
+#include <stdbool.h>
+#include <signal.h>
+#include <setjmp.h>
+#include <pthread.h>
+
+
+
+/**
+ * A cell of the stack containing the assertions performed by worker threads
+ *
+ * The cell is allocated together with its assertion, when the assertion starts, so that publishing it doesn't need any allocation
+ */
+struct ct_thread_assert_report {
+	/**
+	 * The assertion performed by a worker thread
+	 */
+	struct ct_assert_report* report;
+	/**
+	 * The assertion published just before this one. @null if this is the oldest one
+	 */
+	struct ct_thread_assert_report* next;
+};
+
+/**
+ * The state of a worker thread spawned via the wrapper of \c pthread_create
+ */
+struct ct_thread_context {
+	/**
+	 * The function the thread runs
+	 */
+	void* (*start)(void*);
+	/**
+	 * The argument of struct ct_thread_context::start
+	 */
+	void* arg;
+	/**
+	 * The snapshot the thread works for, i.e. the one the spawning thread was working for. @null if no test was running
+	 */
+	struct ct_snapshot* snapshot;
+	/**
+	 * Where the thread jumps back when it raises a fatal signal
+	 *
+	 * It's set just before struct ct_thread_context::start is called. A function running on the thread can set it again
+	 * to handle the signal by itself (for example, to release what other threads are waiting for): it's never restored.
+	 */
+	sigjmp_buf jump_point;
+	/**
+	 * The alternate stack where the signal handler runs on this thread
+	 */
+	stack_t signal_stack;
+};
+
+/**
+ * Checks if the calling thread is the one running the tests
+ *
+ * @param[in] model the model to handle
+ * @return @true if the calling thread is the main thread of \c model, @false if it's a worker thread
+ */
+bool ct_is_main_thread(const struct ct_model* model);
+
+/**
+ * Fetches the context of the calling thread
+ *
+ * The function is async-signal-safe.
+ *
+ * @return the context of the calling thread or @null if the calling thread is the main thread or it hasn't been spawned via the wrapper of \c pthread_create
+ */
+struct ct_thread_context* ct_get_thread_context();
+
+/**
+ * Fetches the snapshot the calling thread works for
+ *
+ * @param[in] model the model to handle
+ * @return struct ct_model::current_snapshot on the main thread, struct ct_thread_context::snapshot on a worker thread with a context, @null otherwise
+ */
+struct ct_snapshot* ct_get_thread_snapshot(const struct ct_model* model);
+
+/**
+ * Spawns a thread with its own struct ct_thread_context
+ *
+ * The linker calls it in place of \c pthread_create when the executable is linked with <tt>-Wl,--wrap=pthread_create</tt>. The arguments and
+ * the return value are the ones of \c pthread_create.
+ */
+int __wrap_pthread_create(pthread_t* thread, const pthread_attr_t* attr, void* (*start)(void*), void* arg);
+
+/**
+ * Terminates the calling worker thread after a fatal signal, by jumping back to struct ct_thread_context::jump_point
+ *
+ * The function is async-signal-safe. It returns only if the calling thread has no context, i.e. it has nowhere to jump back to.
+ *
+ * @param[in] code the value ::sigsetjmp returns after the jump
+ */
+void ct_thread_jump_back(int code);
+
+/**
+ * Prepares the cell which will publish an assertion performed by a worker thread
+ *
+ * @param[in] report the assertion which is starting
+ * @return the cell containing \c report
+ */
+struct ct_thread_assert_report* ct_init_thread_assert_report(struct ct_assert_report* report);
+
+/**
+ * Makes an assertion performed by a worker thread visible to the main thread
+ *
+ * The function is lock-free and doesn't allocate memory. After this call the worker thread can't touch \c cell nor its assertion anymore.
+ *
+ * @param[inout] model the model to handle
+ * @param[in] cell the cell containing the assertion to publish, built by ::ct_init_thread_assert_report
+ */
+void ct_publish_thread_assert_report(struct ct_model* model, struct ct_thread_assert_report* cell);
+
+/**
+ * Records a fatal signal raised on a worker thread
+ *
+ * Only the first signal is recorded until the main thread merges it. The function is async-signal-safe.
+ *
+ * @param[inout] model the model to handle
+ * @param[in] signum the signal raised
+ * @param[in] info additional information about the signal
+ */
+void ct_record_thread_signal(struct ct_model* model, int signum, const siginfo_t* info);
+
+/**
+ * Checks if a mandatory assertion published by worker threads has failed or if a worker thread has raised a signal
+ *
+ * The published assertions are left untouched.
+ *
+ * \note
+ * Call this function only from the main thread, when no worker thread is running
+ *
+ * @param[in] model the model to handle
+ * @return @true if a worker thread has failed, @false otherwise
+ */
+bool ct_thread_reports_have_failed(const struct ct_model* model);
+
+/**
+ * Moves every assertion and signal published by worker threads so far into a snapshot
+ *
+ * If a mandatory assertion has failed or a signal has been raised, the snapshot and the running test are marked as failed.
+ *
+ * \note
+ * Call this function only from the main thread
+ *
+ * @param[inout] model the model to handle
+ * @param[inout] snapshot the snapshot where to move the assertions. If @null, the published assertions and signals are simply discarded
+ */
+void ct_merge_thread_reports(struct ct_model* model, struct ct_snapshot* snapshot);
+
+#endif /* THREAD_CONTEXT_H_ */
+/**
+ * @file
+ *
+ * Module exploring the thread interleavings of a stress test in a deterministic way
+ *
+ * When schedule exploration is enabled (see the \c --schedule_seeds command line option), the threads of a ::STRESS section don't run in parallel
+ * anymore: they are serialized by a scheduler which lets exactly one thread run at a time. The running thread can be preempted only at
+ * **preemption points**:
+ * \li ::ct_yield, which you can put anywhere in the code under test;
+ * \li ::ct_mutex_lock and ::ct_mutex_unlock, which replace \c pthread_mutex_lock and \c pthread_mutex_unlock;
+ * \li the end of every iteration of the stress test.
+ *
+ * At each preemption point, the scheduler picks the next thread to run with a pseudo random generator initialized with a **seed**: hence a seed
+ * always generates the very same interleaving. Every seed is run in its own process, forked from the test process, and several seeds are run in
+ * parallel. If a seed fails, @crashc replays it within the test process so that its assertions end up in the report: you can replay it again
+ * with the \c --schedule_seed command line option.
+ *
+ * \attention
+ * While serialized, a thread blocking on something other than ::ct_mutex_lock (e.g. \c pthread_mutex_lock or a condition variable)
+ * will block every other thread as well.
+ *
+ * @author koldar
+ * @date Oct 19, 2026
+ */
+
+#ifndef SCHEDULE_H_
+#define SCHEDULE_H_
+
+#include <stdbool.h>
+#include <pthread.h>
+
+
+
+/**
+ * A scheduler serializing the threads of a stress test
+ */
+struct ct_scheduler {
+	/**
+	 * Lock protecting the whole structure
+	 */
+	pthread_mutex_t lock;
+	/**
+	 * Signaled every time ct_scheduler::running changes or a thread registers itself
+	 */
+	pthread_cond_t changed;
+	/**
+	 * The number of threads the scheduler handles
+	 */
+	int threads_number;
+	/**
+	 * The number of threads which have registered themselves via ::ct_scheduler_thread_start
+	 */
+	int registered_threads;
+	/**
+	 * The id of the only thread allowed to run. -1 if no thread can run
+	 */
+	int running;
+	/**
+	 * For each thread, @true if the thread has terminated
+	 */
+	bool* terminated;
+	/**
+	 * The number of threads which have not terminated yet
+	 */
+	int alive_threads;
+	/**
+	 * The state of the pseudo random generator deciding the interleaving
+	 */
+	unsigned long long random_state;
+};
+
+/**
+ * Creates a new scheduler
+ *
+ * @param[in] threads_number the number of threads to serialize
+ * @param[in] seed the seed generating the interleaving
+ * @return the scheduler
+ */
+struct ct_scheduler* ct_init_scheduler(int threads_number, long seed);
+
+/**
+ * Releases a scheduler from memory
+ *
+ * @param[inout] scheduler the scheduler to dispose of
+ */
+void ct_destroy_scheduler(struct ct_scheduler* scheduler);
+
+/**
+ * Lets the first thread run, once every thread has registered itself
+ *
+ * Called by the thread which has spawned the serialized threads
+ *
+ * @param[inout] scheduler the scheduler to handle
+ */
+void ct_scheduler_start(struct ct_scheduler* scheduler);
+
+/**
+ * Registers the calling thread in the scheduler and waits until it's chosen to run
+ *
+ * @param[inout] scheduler the scheduler to handle
+ * @param[in] thread_id the id of the calling thread, between 0 and struct ct_scheduler::threads_number (excluded)
+ */
+void ct_scheduler_thread_start(struct ct_scheduler* scheduler, int thread_id);
+
+/**
+ * Tells the scheduler the calling thread has terminated, hence another thread can run
+ *
+ * @param[inout] scheduler the scheduler to handle
+ */
+void ct_scheduler_thread_end(struct ct_scheduler* scheduler);
+
+/**
+ * A preemption point: the scheduler may let another thread run
+ *
+ * Does nothing if the calling thread is not serialized by a scheduler, so you can leave the call in the code under test.
+ */
+void ct_yield();
+
+/**
+ * Locks a mutex, letting other serialized threads run while the mutex is held by someone else
+ *
+ * Behaves exactly like \c pthread_mutex_lock if the calling thread is not serialized by a scheduler
+ *
+ * @param[inout] mutex the mutex to lock
+ * @return the value returned by \c pthread_mutex_lock
+ */
+int ct_mutex_lock(pthread_mutex_t* mutex);
+
+/**
+ * Unlocks a mutex and then acts as a preemption point
+ *
+ * @param[inout] mutex the mutex to unlock
+ * @return the value returned by \c pthread_mutex_unlock
+ */
+int ct_mutex_unlock(pthread_mutex_t* mutex);
+
+/**
+ * Runs every seed of the schedule exploration in a separate process
+ *
+ * At most ::ct_get_workers_number processes run at the same time. The state of the test process is never changed.
+ *
+ * @param[inout] model the model to handle
+ * @param[in] function the function every thread of the stress test runs
+ * @param[in] threads_number the number of threads of the stress test
+ * @param[in] iterations the number of iterations of the stress test
+ * @param[out] failed_schedules the number of seeds which failed
+ * @return the smallest seed which failed or -1 if every seed passed
+ */
+long ct_explore_schedules(struct ct_model* model, ct_stress_c function, int threads_number, long iterations, long* failed_schedules);
+
+#endif /* SCHEDULE_H_ */
+/**
+ * @file
+ *
+ * Module running a ::FUZZ_TESTCASE over a set of inputs
+ *
+ * A ::FUZZ_TESTCASE can be run in 2 ways:
+ * \li **replay mode**, the default one: the @testcase is run once for every file inside the corpus directory given by the \c --corpus
+ * 	command line option (or once with an empty input if no corpus is given). Files are memory-mapped. If @crashc can use more than one
+ * 	process (see ::ct_get_workers_number), the inputs are first split among several forked processes: each of them sends back the tests of the inputs
+ * 	which passed, while the inputs which failed are run again within the test process, so that their tests are complete. Either way every input
+ * 	ends up in the report, in the same order a single process would have produced. In a distributed run the inputs are not split: the whole
+ * 	::FUZZ_TESTCASE is claimed like a @testcase (see ::ct_fuzz_claim) and run by a single worker;
+ * \li **fuzz mode**, enabled by compiling the tests with ::CT_FUZZER defined: ::TESTS_START and ::TESTS_END generate \c LLVMFuzzerTestOneInput
+ * 	instead of \c main, so the test file can be linked with \c -fsanitize=fuzzer. The model is built by the first call, which registers the
+ * 	@testsuite; every call runs the ::FUZZ_TESTCASE sections (and only them) with the input provided by the fuzzer, then forgets the sections and
+ * 	the tests of that input (see ::ct_fuzz_end_input). The model is released when the fuzzer exits. A failed assertion aborts the process,
+ * 	which is what the fuzzer considers a crash.
+ *
+ * @author koldar
+ * @date Oct 19, 2026
+ */
+
+#ifndef FUZZ_H_
+#define FUZZ_H_
+
+#include <stdio.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+
+
+
+/**
+ * A single input of a ::FUZZ_TESTCASE
+ */
+struct ct_fuzz_input {
+	/**
+	 * The file containing the input. @null if the input doesn't come from a file
+	 */
+	char* path;
+	/**
+	 * The bytes of the input
+	 *
+	 * @notnull
+	 */
+	const uint8_t* data;
+	/**
+	 * The number of bytes inside struct ct_fuzz_input::data
+	 */
+	size_t size;
+	/**
+	 * @true if struct ct_fuzz_input::data has been memory-mapped from struct ct_fuzz_input::path
+	 */
+	bool mapped;
+};
+
+/**
+ * The inputs a running ::FUZZ_TESTCASE iterates over
+ */
+struct ct_fuzz_corpus {
+	/**
+	 * Every input of the corpus, sorted by path
+	 */
+	struct ct_fuzz_input* inputs;
+	/**
+	 * The number of cells inside struct ct_fuzz_corpus::inputs
+	 */
+	int inputs_number;
+	/**
+	 * The indexes of the inputs the current process needs to run
+	 */
+	int* selected;
+	/**
+	 * The number of cells inside struct ct_fuzz_corpus::selected
+	 */
+	int selected_number;
+	/**
+	 * The position, inside struct ct_fuzz_corpus::selected, of the input running right now
+	 */
+	int current;
+	/**
+	 * For each input, @true if the input failed in a worker process
+	 *
+	 * Shared among the test process and every worker process. @null if no worker process has been forked
+	 */
+	bool* failed;
+	/**
+	 * @true if the current process is a worker process forked by ::ct_fuzz_start
+	 */
+	bool worker;
+	/**
+	 * The number of test reports there were before the current input started
+	 */
+	int reports_before_input;
+	/**
+	 * In a worker process, the stream sending back to the test process the tests of the inputs which passed. @null otherwise
+	 */
+	FILE* channel;
+	/**
+	 * In the test process, for each input, the tests a worker process has sent back for it, or @null if it has sent nothing.
+	 * @null if no worker process has been forked
+	 */
+	ct_list_o** received;
+	/**
+	 * The first input whose tests in struct ct_fuzz_corpus::received haven't been added to struct ct_model::test_reports_list yet
+	 */
+	int next_received;
+	/**
+	 * In a distributed run, the section of the first input, the one claimed to the coordinator. @null until it has been claimed
+	 */
+	const struct ct_section* claimed_testcase;
+};
+
+/**
+ * Tells @crashc the tests are driven by a fuzzer which provides the given input
+ *
+ * Called by ::TESTS_START when ::CT_FUZZER is defined.
+ *
+ * @param[inout] model the model to handle
+ * @param[in] data the bytes of the input
+ * @param[in] size the number of bytes inside \c data
+ */
+void ct_set_fuzz_input(struct ct_model* model, const uint8_t* data, size_t size);
+
+/**
+ * Forgets the sections and the tests of the input provided by the fuzzer
+ *
+ * Called by ::TESTS_END when ::CT_FUZZER is defined, so that the model can be used with the next input. What has been configured
+ * while registering the @testsuite is kept (see ::ct_reset_tests).
+ *
+ * @param[inout] model the model to handle
+ */
+void ct_fuzz_end_input(struct ct_model* model);
+
+/**
+ * Releases from memory the model used by a fuzzer
+ *
+ * Registered with \c atexit by ::TESTS_END when ::CT_FUZZER is defined, since a fuzzer terminates the process instead of returning.
+ * The function set with ::ct_set_crashc_teardown is run first.
+ */
+void ct_fuzz_teardown();
+
+/**
+ * Checks if the tests are driven by a fuzzer
+ *
+ * @param[in] model the model to handle
+ * @return @true if @crashc is in fuzz mode, @false if it's in replay mode
+ */
+bool ct_is_fuzzing(const struct ct_model* model);
+
+/**
+ * Loads the inputs of a ::FUZZ_TESTCASE and returns the first one to run in this process
+ *
+ * If the inputs are split among worker processes, the function returns in the worker processes as well and waits for them in the test process.
+ * The tests the worker processes send back are added to the model by ::ct_fuzz_next, in the order of their inputs.
+ *
+ * @param[inout] model the model to handle
+ * @return the first input to run or @null if there is no input to run
+ */
+struct ct_fuzz_input* ct_fuzz_start(struct ct_model* model);
+
+/**
+ * Returns the next input of a ::FUZZ_TESTCASE to run in this process
+ *
+ * In a worker process, the tests of the input just run are sent back to the test process if they have all passed. When a worker process
+ * has no input left, the function terminates it.
+ *
+ * @param[inout] model the model to handle
+ * @return the next input to run or @null if every input has been run. In the latter case the inputs are released from memory
+ */
+struct ct_fuzz_input* ct_fuzz_next(struct ct_model* model);
+
+/**
+ * Claims the ::FUZZ_TESTCASE being run to the coordinator of a distributed run
+ *
+ * Only the section of the first input is claimed: the tests of every input are sent to the coordinator together, once the last input has been run.
+ * Nothing is claimed if the run is not distributed.
+ *
+ * \pre
+ * 	\li struct ct_model::current_section is the section of the ::FUZZ_TESTCASE, just fetched for the current input
+ * \post
+ * 	\li if another worker has claimed the ::FUZZ_TESTCASE, its section is skipped and no other input is run
+ *
+ * @param[inout] model the model to handle
+ * @return @true if the current input needs to be run, @false otherwise
+ */
+bool ct_fuzz_claim(struct ct_model* model);
+
+/**
+ * Stores in a test report the file containing the input the running ::FUZZ_TESTCASE is using
+ *
+ * Does nothing if no ::FUZZ_TESTCASE is running or if its input doesn't come from a file
+ *
+ * @param[in] model the model to handle
+ * @param[inout] report the report of the test which is starting
+ */
+void ct_fuzz_update_test_report(struct ct_model* model, struct ct_test_report* report);
+
+/**
+ * Releases from memory the inputs of a ::FUZZ_TESTCASE
+ *
+ * @param[inout] corpus the corpus to dispose of
+ */
+void ct_destroy_fuzz_corpus(struct ct_fuzz_corpus* corpus);
+
+#endif /* FUZZ_H_ */
+/**
+ * @file
+ *
+ * Module detecting flaky tests by comparing several repetitions of the same test
+ *
+ * When the \c --repeat command line option is greater than 1, every registered @testsuite is run that many times in a row. Each repetition
+ * produces its own struct ct_test_report. Once every repetition has run, the reports of the same test are linked together
+ * (see struct ct_test_report::next_repetition) and compared: a test is **flaky** if its outcome, the status of any of its snapshots or the outcome of any
+ * of its assertions changes between repetitions, or if the test has not been run in every repetition.
+ *
+ * Two reports belong to the same test if they have the same @testcase description and they have been generated by the same loop of such @testcase
+ * (e.g. the reports generated by the second loop of a @testcase with several @when are compared among each other).
+ *
+ * @author koldar
+ * @date Oct 19, 2026
+ */
+
+#ifndef FLAKY_H_
+#define FLAKY_H_
+
+#include <stdbool.h>
+
+
+
+/**
+ * How a test behaved across all its repetitions
+ */
+struct ct_flakiness {
+	/**
+	 * The number of repetitions where the test has been run
+	 */
+	int runs;
+	/**
+	 * The number of repetitions where the test has failed
+	 */
+	int failed_runs;
+	/**
+	 * @true if the snapshot tree of a repetition differs from the one of the first repetition
+	 */
+	bool snapshots_diverge;
+	/**
+	 * @true if the test is flaky
+	 */
+	bool flaky;
+	/**
+	 * The average time, in microseconds, the test has taken in a repetition
+	 */
+	double elapsed_time_mean;
+	/**
+	 * The variance, in squared microseconds, of the time the test has taken in a repetition
+	 */
+	double elapsed_time_variance;
+};
+
+/**
+ * Links together the reports of the same test and computes, for each test, how it behaved across the repetitions
+ *
+ * The struct ct_flakiness of each test is stored in the report of its first repetition, while struct ct_test_stats::flaky_tests is updated.
+ * Does nothing if struct ct_model::repetitions is not greater than 1.
+ *
+ * @param[inout] model the model to handle
+ */
+void ct_detect_flaky_tests(struct ct_model* model);
+
+/**
+ * Checks if 2 snapshot trees have different statuses or assertion outcomes
+ *
+ * @param[in] a the first snapshot tree
+ * @param[in] b the second snapshot tree
+ * @return @true if the trees have a different shape, if 2 corresponding snapshots have different statuses or if 2 corresponding assertions
+ * 	have different outcomes; @false otherwise
+ */
+bool ct_snapshot_trees_diverge(const struct ct_snapshot* a, const struct ct_snapshot* b);
+
+#endif /* FLAKY_H_ */
+/**
+ * @file
+ *
+ * Module writing and reading the binary event log of a test run
+ *
+ * The binary event log is a compact alternative to the textual report of ::ct_default_report: when the \c --binary_report command line option
+ * is given, the report producer writes the outcome of the tests in a file as a sequence of events, without formatting a single string.
+ * The standalone \c crashc-report tool can then render the log as text, JUnit XML, JSON or HTML.
+ *
+ * The log starts with the 4 bytes ::CT_BINARY_LOG_MAGIC followed by a byte containing ::CT_BINARY_LOG_VERSION. Then there are the events:
+ * each event is a byte containing its ::ct_binary_event_kind, followed by the length of its payload (4 bytes) and by the payload itself.
+ * Integers are stored in little endian; strings are stored as their length (4 bytes), their characters and a terminating \c '\0'.
+ *
+ * The events of a test are:
+ * \li a ::CT_BINARY_EVENT_TEST_START;
+ * \li a ::CT_BINARY_EVENT_SNAPSHOT_START for the @testcase snapshot, followed by a ::CT_BINARY_EVENT_ASSERTION for each of its assertions,
+ * 	by the events of its children snapshots and by a ::CT_BINARY_EVENT_SNAPSHOT_END;
+ * \li a ::CT_BINARY_EVENT_TEST_END.
+ *
+ * After all the tests there is a single ::CT_BINARY_EVENT_SUMMARY.
+ *
+ * @author koldar
+ * @date Oct 19, 2026
+ */
+
+#ifndef BINARY_REPORT_H_
+#define BINARY_REPORT_H_
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+
+
+/**
+ * The first bytes of every binary event log
+ */
+#define CT_BINARY_LOG_MAGIC "CTEV"
+
+/**
+ * The version of the binary event log format
+ *
+ * Increase it every time the payload of an event changes
+ */
+#define CT_BINARY_LOG_VERSION 1
+
+/**
+ * The bytes the binary writer accumulates before issuing a \c write
+ */
+#ifndef CT_BINARY_WRITER_BUFFER_SIZE
+#	define CT_BINARY_WRITER_BUFFER_SIZE 65536
+#endif
+
+/**
+ * The kinds of event inside a binary event log
+ */
+enum ct_binary_event_kind {
+	/**
+	 * A test starts. Payload: repetition (4 bytes), fuzz input (string, empty if the test has no fuzz input)
+	 */
+	CT_BINARY_EVENT_TEST_START = 1,
+	/**
+	 * A snapshot starts. Payload: ::ct_section_type (1 byte), ::ct_snapshot_status (1 byte), signal (4 bytes), signal code (4 bytes),
+	 * elapsed time in microseconds (8 bytes), allocations, allocated bytes, frees, leaked blocks, leaked bytes (8 bytes each), description (string)
+	 */
+	CT_BINARY_EVENT_SNAPSHOT_START = 2,
+	/**
+	 * An assertion of the current snapshot. Payload: passed (1 byte), line (4 bytes), asserted, expected, actual and file name (strings)
+	 */
+	CT_BINARY_EVENT_ASSERTION = 3,
+	/**
+	 * The current snapshot ends. No payload
+	 */
+	CT_BINARY_EVENT_SNAPSHOT_END = 4,
+	/**
+	 * A test ends. Payload: ::ct_test_outcome (1 byte)
+	 */
+	CT_BINARY_EVENT_TEST_END = 5,
+	/**
+	 * The run ends. Payload: total, successful, failed and flaky tests (4 bytes each)
+	 */
+	CT_BINARY_EVENT_SUMMARY = 6
+};
+
+/**
+ * A buffered writer of a binary event log
+ *
+ * Every event is built inside struct ct_binary_writer::buffer, which is written into the file only when it's full or when the writer is flushed.
+ */
+struct ct_binary_writer {
+	/**
+	 * The file descriptor where the log is written
+	 */
+	int fd;
+	/**
+	 * The bytes not yet written into struct ct_binary_writer::fd
+	 */
+	unsigned char* buffer;
+	/**
+	 * The number of bytes inside struct ct_binary_writer::buffer
+	 */
+	size_t size;
+	/**
+	 * The number of bytes struct ct_binary_writer::buffer can contain
+	 */
+	size_t capacity;
+	/**
+	 * The position, inside struct ct_binary_writer::buffer, of the event being built
+	 */
+	size_t event_start;
+	/**
+	 * @true if a \c write has failed
+	 */
+	bool failed;
+};
+
+/**
+ * An event read from a binary event log
+ */
+struct ct_binary_event {
+	/**
+	 * The kind of the event
+	 */
+	enum ct_binary_event_kind kind;
+	/**
+	 * The payload of the event
+	 */
+	const unsigned char* payload;
+	/**
+	 * The number of bytes inside struct ct_binary_event::payload
+	 */
+	size_t length;
+	/**
+	 * The position, inside struct ct_binary_event::payload, of the next field to read
+	 */
+	size_t offset;
+};
+
+/**
+ * Writes the whole outcome of the tests as a binary event log
+ *
+ * The log is written in the file at struct ct_model::binary_report_path. Used as struct ct_report_producer::report_producer
+ * when the \c --binary_report option is given.
+ *
+ * @param[inout] model the model to handle
+ */
+void ct_binary_report(struct ct_model* model);
+
+/**
+ * Creates a binary writer and writes the header of the log
+ *
+ * @param[in] fd the file descriptor where the log is written
+ * @return the writer just created
+ */
+struct ct_binary_writer* ct_init_binary_writer(int fd);
+
+/**
+ * Starts an event
+ *
+ * @param[inout] writer the writer to use
+ * @param[in] kind the kind of the event to start
+ */
+void ct_binary_writer_start_event(struct ct_binary_writer* writer, enum ct_binary_event_kind kind);
+
+/**
+ * Ends the event started by ::ct_binary_writer_start_event, computing the length of its payload
+ *
+ * @param[inout] writer the writer to use
+ */
+void ct_binary_writer_end_event(struct ct_binary_writer* writer);
+
+/**
+ * Appends a byte to the payload of the current event
+ *
+ * @param[inout] writer the writer to use
+ * @param[in] value the value to append
+ */
+void ct_binary_writer_u8(struct ct_binary_writer* writer, uint8_t value);
+
+/**
+ * Appends a 4 bytes integer to the payload of the current event
+ *
+ * @param[inout] writer the writer to use
+ * @param[in] value the value to append
+ */
+void ct_binary_writer_u32(struct ct_binary_writer* writer, uint32_t value);
+
+/**
+ * Appends a 8 bytes integer to the payload of the current event
+ *
+ * @param[inout] writer the writer to use
+ * @param[in] value the value to append
+ */
+void ct_binary_writer_u64(struct ct_binary_writer* writer, uint64_t value);
+
+/**
+ * Appends a string to the payload of the current event
+ *
+ * @param[inout] writer the writer to use
+ * @param[in] value the string to append. @null is written as an empty string
+ */
+void ct_binary_writer_string(struct ct_binary_writer* writer, const char* value);
+
+/**
+ * Writes into the file every byte the writer has accumulated
+ *
+ * @param[inout] writer the writer to flush
+ * @return @true if every byte has been written, @false if a \c write has failed
+ */
+bool ct_binary_writer_flush(struct ct_binary_writer* writer);
+
+/**
+ * Releases from memory a binary writer
+ *
+ * \attention
+ * The writer is not flushed and its file descriptor is not closed
+ *
+ * @param[inout] writer the writer to dispose of
+ */
+void ct_destroy_binary_writer(struct ct_binary_writer* writer);
+
+/**
+ * Checks if a buffer starts with the header of a binary event log this version of @crashc can read
+ *
+ * @param[in] data the buffer to check
+ * @param[in] size the number of bytes inside \c data
+ * @return the position of the first event inside \c data or 0 if \c data is not a binary event log
+ */
+size_t ct_binary_log_header_size(const unsigned char* data, size_t size);
+
+/**
+ * Reads an event from a binary event log
+ *
+ * @param[in] data the buffer containing the event
+ * @param[in] size the number of bytes inside \c data
+ * @param[out] event the event read
+ * @return the number of bytes the event occupies inside \c data or 0 if \c data doesn't contain a whole event
+ */
+size_t ct_read_binary_event(const unsigned char* data, size_t size, struct ct_binary_event* event);
+
+/**
+ * Reads a byte from the payload of an event
+ *
+ * @param[inout] event the event to read
+ * @return the value read, 0 if the payload has no bytes left
+ */
+uint8_t ct_binary_event_u8(struct ct_binary_event* event);
+
+/**
+ * Reads a 4 bytes integer from the payload of an event
+ *
+ * @param[inout] event the event to read
+ * @return the value read, 0 if the payload has no bytes left
+ */
+uint32_t ct_binary_event_u32(struct ct_binary_event* event);
+
+/**
+ * Reads a 8 bytes integer from the payload of an event
+ *
+ * @param[inout] event the event to read
+ * @return the value read, 0 if the payload has no bytes left
+ */
+uint64_t ct_binary_event_u64(struct ct_binary_event* event);
+
+/**
+ * Reads a string from the payload of an event
+ *
+ * @param[inout] event the event to read
+ * @return the string read, which points inside the payload; an empty string if the payload has no bytes left
+ */
+const char* ct_binary_event_string(struct ct_binary_event* event);
+
+#endif /* BINARY_REPORT_H_ */
+/**
+ * @file
+ *
+ * Module notifying listeners about what happens while the tests are running
+ *
+ * A report producer (see report_producer.h) sees the outcome of the tests only once every @testsuite has been run. A **listener** is
+ * notified as soon as something happens instead: when a @testsuite starts, when a section is entered, when an assertion fails,
+ * when a test ends and when the whole run ends.
+ *
+ * A listener subscribes with ::ct_subscribe_listener and may be interested only in some events: callbacks left to @null are never called.
+ * Every event has a bit inside struct ct_event_dispatcher::subscribed_events, set only if at least one listener is interested in it.
+ * @crashc tests such bit with ::CT_HAS_LISTENERS before dispatching an event, so an event nobody is interested in costs a single branch.
+ *
+ * @author koldar
+ * @date Oct 19, 2026
+ */
+
+#ifndef EVENTS_H_
+#define EVENTS_H_
+
+#include <stdbool.h>
+
+
+
+/**
+ * The maximum number of listeners which can subscribe to a model
+ */
+#ifndef CT_MAX_EVENT_LISTENERS
+#	define CT_MAX_EVENT_LISTENERS 8
+#endif
+
+/**
+ * The events a listener can be notified about
+ *
+ * Each value is a bit of struct ct_event_dispatcher::subscribed_events
+ */
+enum ct_event {
+	CT_EVENT_SUITE_START = 1 << 0,
+	CT_EVENT_SECTION_ENTER = 1 << 1,
+	CT_EVENT_ASSERT_FAIL = 1 << 2,
+	CT_EVENT_TEST_END = 1 << 3,
+	CT_EVENT_RUN_END = 1 << 4
+};
+
+/**
+ * The callbacks of a listener
+ *
+ * Every callback can be @null if the listener is not interested in the corresponding event
+ */
+struct ct_event_listener {
+	ct_suite_start_listener_c on_suite_start;
+	ct_section_enter_listener_c on_section_enter;
+	ct_assert_fail_listener_c on_assert_fail;
+	ct_test_end_listener_c on_test_end;
+	ct_run_end_listener_c on_run_end;
+	/**
+	 * Passed to every callback of the listener
+	 */
+	void* data;
+};
+
+/**
+ * The listeners subscribed to a model
+ */
+struct ct_event_dispatcher {
+	/**
+	 * A bitmask of ::ct_event. A bit is set if at least a listener is interested in the corresponding event
+	 */
+	unsigned int subscribed_events;
+	/**
+	 * The listeners subscribed so far, in subscription order
+	 */
+	struct ct_event_listener listeners[CT_MAX_EVENT_LISTENERS];
+	/**
+	 * The number of cells inside struct ct_event_dispatcher::listeners
+	 */
+	int listeners_number;
+};
+
+/**
+ * Checks if at least a listener is interested in an event
+ *
+ * Use it to avoid calling the dispatch function of an event nobody is interested in.
+ *
+ * @param[in] model the model to handle
+ * @param[in] event a ::ct_event
+ * @return @true if the event needs to be dispatched, @false otherwise
+ */
+#define CT_HAS_LISTENERS(model, event) ((model)->event_dispatcher->subscribed_events & (event))
+
+/**
+ * Creates a dispatcher with no listener
+ *
+ * @return the dispatcher just created
+ */
+struct ct_event_dispatcher* ct_init_event_dispatcher();
+
+/**
+ * Subscribes a listener to the events of a model
+ *
+ * The listener is copied. Listeners are notified in subscription order.
+ *
+ * @param[inout] model the model to handle
+ * @param[in] listener the listener to subscribe
+ * @return @true if the listener has been subscribed, @false if there are already ::CT_MAX_EVENT_LISTENERS listeners
+ */
+bool ct_subscribe_listener(struct ct_model* model, const struct ct_event_listener* listener);
+
+/**
+ * Notifies the listeners that a @testsuite starts
+ *
+ * @param[inout] model the model to handle
+ * @param[in] suite_name the id of the @testsuite
+ */
+void ct_dispatch_suite_start(struct ct_model* model, const char* suite_name);
+
+/**
+ * Notifies the listeners that a section has been entered
+ *
+ * @param[inout] model the model to handle
+ * @param[in] section the section just entered
+ */
+void ct_dispatch_section_enter(struct ct_model* model, struct ct_section* section);
+
+/**
+ * Notifies the listeners that an assertion has failed
+ *
+ * @param[inout] model the model to handle
+ * @param[in] report the report of the failed assertion
+ */
+void ct_dispatch_assert_fail(struct ct_model* model, struct ct_assert_report* report);
+
+/**
+ * Notifies the listeners that a test has ended
+ *
+ * @param[inout] model the model to handle
+ * @param[in] report the report of the test just ended
+ */
+void ct_dispatch_test_end(struct ct_model* model, struct ct_test_report* report);
+
+/**
+ * Notifies the listeners that every @testsuite has been run
+ *
+ * @param[inout] model the model to handle
+ */
+void ct_dispatch_run_end(struct ct_model* model);
+
+/**
+ * Releases from memory a dispatcher
+ *
+ * @param[inout] dispatcher the dispatcher to dispose of
+ */
+void ct_destroy_event_dispatcher(struct ct_event_dispatcher* dispatcher);
+
+#endif /* EVENTS_H_ */
+/**
+ * @file
+ *
+ * A listener (see events.h) showing the progress of a long run on a terminal
+ *
+ * While the tests run, a single line is kept updated on the terminal: how many tests have ended (out of how many are expected),
+ * how many of them failed, the running @testsuite and @testcase, the elapsed time and an estimate of the remaining time.
+ *
+ * The estimate comes from the timings of a previous run, stored in a **history file** given by the \c --history command line option.
+ * Each line of the file contains how many microseconds a test took, followed by a space and by the description of its @testcase.
+ * The file ends with a line per @testsuite: <tt>S time tests failed_tests id</tt>, with the microseconds its tests took,
+ * how many tests it ran and how many of them failed. They are used to choose the order of the @testsuite (see suite_order.h).
+ * The history file is rewritten at the end of every run. Without a history file the remaining time is unknown.
+ *
+ * @author koldar
+ * @date Oct 19, 2026
+ */
+
+#ifndef PROGRESS_H_
+#define PROGRESS_H_
+
+#include <stdio.h>
+#include <stdbool.h>
+#include <time.h>
+
+
+
+
+
+/**
+ * The minimum time, in microseconds, between 2 updates of the progress line
+ */
+#ifndef CT_PROGRESS_REFRESH_PERIOD
+#	define CT_PROGRESS_REFRESH_PERIOD 100000
+#endif
+
+/**
+ * How long the tests with the same @testcase description took in a previous run
+ */
+struct ct_test_timing {
+	/**
+	 * The description of the @testcase
+	 */
+	char* description;
+	/**
+	 * The sum of the durations, in microseconds, of the tests
+	 */
+	long total_time;
+	/**
+	 * The number of tests with this description
+	 */
+	int tests;
+	/**
+	 * The number of tests with this description which have ended in the current run
+	 */
+	int ended_tests;
+};
+
+/**
+ * How long the tests of a @testsuite took and how many of them failed
+ */
+struct ct_suite_timing {
+	/**
+	 * The id of the @testsuite
+	 */
+	char* name;
+	/**
+	 * The sum of the durations, in microseconds, of the tests
+	 */
+	long total_time;
+	/**
+	 * The number of tests of the @testsuite
+	 */
+	int tests;
+	/**
+	 * The number of failed tests of the @testsuite
+	 */
+	int failed_tests;
+};
+
+/**
+ * The state of the progress listener
+ */
+struct ct_progress {
+	/**
+	 * Where the progress line is drawn. @null if the progress is not shown, but the timings are still recorded
+	 */
+	FILE* output;
+	/**
+	 * The history file. @null if timings are neither read nor written
+	 */
+	const char* history_path;
+	/**
+	 * The timings of the previous run: each value is a struct ct_test_timing, indexed by the hash of its description
+	 */
+	ct_hashtable_o* history;
+	/**
+	 * The number of tests of the previous run
+	 */
+	int expected_tests;
+	/**
+	 * The duration, in microseconds, of the previous run
+	 */
+	long expected_time;
+	/**
+	 * The duration, in microseconds, the tests ended so far took in the previous run
+	 */
+	long expected_ended_time;
+	/**
+	 * The tests ended so far in the current run
+	 */
+	int ended_tests;
+	/**
+	 * The tests failed so far in the current run
+	 */
+	int failed_tests;
+	/**
+	 * The struct ct_test_timing of every test of the current run, in execution order, each one containing a single test
+	 */
+	ct_list_o* timings;
+	/**
+	 * The timings of the @testsuite in the previous run: each value is a struct ct_suite_timing, indexed by the hash of its id
+	 */
+	ct_hashtable_o* suite_history;
+	/**
+	 * The struct ct_suite_timing of every @testsuite of the current run, in execution order
+	 */
+	ct_list_o* suite_timings;
+	/**
+	 * The cell of struct ct_progress::suite_timings of the running @testsuite. @null before the first one
+	 */
+	struct ct_suite_timing* running_suite;
+	/**
+	 * The id of the running @testsuite
+	 */
+	const char* suite_name;
+	/**
+	 * The description of the running @testcase
+	 */
+	const char* testcase_description;
+	/**
+	 * When the run has started
+	 */
+	struct timespec start_time;
+	/**
+	 * When the last test has ended (or the run has started, if no test has ended yet)
+	 */
+	struct timespec last_test_end;
+	/**
+	 * When the progress line has been drawn the last time
+	 */
+	struct timespec last_draw;
+};
+
+/**
+ * Subscribes the progress listener to a model
+ *
+ * @param[inout] model the model to handle
+ * @param[in] output where the progress line is drawn. @null to only record the timings in the history file
+ * @param[in] history_path the history file. @null if there is no history file
+ * @return the state of the listener, released when the model is torn down
+ */
+struct ct_progress* ct_enable_progress(struct ct_model* model, FILE* output, const char* history_path);
+
+/**
+ * Computes how many microseconds the run is expected to last from now on
+ *
+ * The durations of the previous run are scaled by how much faster or slower the tests ended so far have been in this run.
+ *
+ * @param[in] progress the state of the listener
+ * @param[in] elapsed_time the microseconds elapsed since the run has started
+ * @return the expected remaining time in microseconds, or a negative number if it can't be estimated
+ */
+long ct_progress_estimate_remaining_time(const struct ct_progress* progress, long elapsed_time);
+
+/**
+ * Fetches the timings of a @testsuite in the previous run
+ *
+ * @param[in] progress the state of the listener
+ * @param[in] suite_name the id of the @testsuite
+ * @return the timings of the @testsuite, or @null if it's not in the history file
+ */
+const struct ct_suite_timing* ct_progress_get_suite_history(const struct ct_progress* progress, const char* suite_name);
+
+/**
+ * Releases from memory the state of the progress listener
+ *
+ * @param[inout] progress the state to dispose of
+ */
+void ct_destroy_progress(struct ct_progress* progress);
+
+#endif /* PROGRESS_H_ */
+/**
+ * @file
+ *
+ * Serializes the tests, so that they can be sent to another process running the same test executable
+ *
+ * A test is serialized with its whole snapshot tree. Strings are sent with their content, while the structures and the other fields
+ * (backtraces, stress and benchmark reports) are copied byte by byte, in the layout and the byte order of the sending machine.
+ * Hence the serialized tests can be read only by the same test executable running on the same architecture: a worker built
+ * differently, or running on a machine with another byte order, sends data the receiver can't make sense of.
+ *
+ * Data which is too short to hold what it declares is detected (see struct ct_serialized_buffer::corrupted), so that a receiver
+ * can drop what it has been sent instead of reading past it.
+ *
+ * The tag tables and the strings of the assertions of a deserialized test are not owned by the test, since in the
+ * sending process they belong to the sections and to the executable. They are kept by a ::ct_report_arena instead, which needs to outlive the tests.
+ *
+ * @author koldar
+ * @date Oct 19, 2026
+ */
+
+#ifndef REPORT_SERIALIZATION_H_
+#define REPORT_SERIALIZATION_H_
+
+#include <stdio.h>
+#include <stddef.h>
+#include <stdbool.h>
+
+
+
+
+/**
+ * Some serialized data being deserialized
+ */
+struct ct_serialized_buffer {
+	/**
+	 * The serialized data
+	 */
+	unsigned char* data;
+	/**
+	 * The number of bytes in struct ct_serialized_buffer::data
+	 */
+	size_t size;
+	/**
+	 * The number of bytes already deserialized
+	 */
+	size_t position;
+	/**
+	 * @true if the data has turned out to be shorter than what it declares. Once set, nothing more is read
+	 */
+	bool corrupted;
+};
+
+/**
+ * The memory of the deserialized tests which doesn't belong to any test
+ */
+struct ct_report_arena {
+	/**
+	 * The tag tables of the snapshots. The sites the tags come from may not be prepared in the receiving process, so they are rebuilt
+	 */
+	ct_list_o* tags;
+	/**
+	 * The strings of the assertions
+	 */
+	ct_list_o* strings;
+};
+
+/**
+ * Creates an empty arena
+ *
+ * @return the arena just created
+ */
+struct ct_report_arena* ct_init_report_arena();
+
+/**
+ * Releases from memory an arena
+ *
+ * \pre
+ * 	\li the tests deserialized with \c arena have already been released
+ *
+ * @param[inout] arena the arena to dispose of
+ */
+void ct_destroy_report_arena(struct ct_report_arena* arena);
+
+/**
+ * Serializes a test
+ *
+ * @param[inout] out the stream to write into
+ * @param[in] report the test to serialize
+ */
+void ct_serialize_test_report(FILE* out, const struct ct_test_report* report);
+
+/**
+ * Reads everything another process writes into a pipe, until it closes it
+ *
+ * @param[in] channel the read end of the pipe
+ * @param[out] buffer the data read, ready to be deserialized. struct ct_serialized_buffer::data needs to be released with \c free
+ */
+void ct_read_serialized_data(int channel, struct ct_serialized_buffer* buffer);
+
+/**
+ * Copies the next bytes of the serialized data
+ *
+ * The sender always serializes whole tests, so running out of data means it has sent something this process can't understand:
+ * in that case struct ct_serialized_buffer::corrupted is set and \c output is filled with zeros.
+ *
+ * @param[inout] buffer the serialized data
+ * @param[out] output where to copy the bytes
+ * @param[in] size the number of bytes to copy
+ * @return @true if the bytes have been copied, @false if the data is corrupted
+ */
+bool ct_deserialize_bytes(struct ct_serialized_buffer* buffer, void* output, size_t size);
+
+/**
+ * Deserializes a test written by ::ct_serialize_test_report
+ *
+ * If the data turns out to be corrupted, struct ct_serialized_buffer::corrupted is set: the returned test can still be
+ * released with ::ct_destroy_test_report, but its content is meaningless.
+ *
+ * @param[inout] buffer the serialized data
+ * @param[inout] arena the arena which will own the tags and the assertion strings of the test
+ * @return the test deserialized. It isn't linked to its repetitions yet
+ */
+struct ct_test_report* ct_deserialize_test_report(struct ct_serialized_buffer* buffer, struct ct_report_arena* arena);
+
+#endif /* REPORT_SERIALIZATION_H_ */
+/**
+ * @file
+ *
+ * Runs every @when in a forked process, so that the code preceding it is run only once
+ *
+ * Normally, the body of a @testcase is run from the beginning for every path of the section tree: the code preceding the first @when,
+ * and the code of every @when containing other ones, is run once per leaf.
+ *
+ * When this mode is enabled with the \c --fork_sections command line option, whenever a process is granted access to a @when it forks:
+ * \li the forked process enters the @when and runs until the @when has been fully visited. The tests it completes are then sent back to
+ * 	the process which forked it through a pipe and the forked process exits;
+ * \li the process which forked waits for the forked one, collects its tests and goes on to the next @when as if it had visited the @when itself.
+ * 	Since it hasn't entered any @when, the test it was running is discarded.
+ *
+ * In this way the code preceding a @when is run once per node of the section tree and not once per leaf. The outcomes are the same as without
+ * the mode only if the code outside the @when sections has no side effects visible outside the process (like writing a file), since such code is run
+ * both by the forked process and by the one which forked.
+ *
+ * A failed assertion or a signal in a forked process interrupts the @testcase in the process which forked as well, exactly like it happens without the mode.
+ * If a forked process terminates without sending its tests back (e.g. it calls \c exit), its tests are lost and the @when fails as if it had received a signal.
+ *
+ * The tests run by a forked process are notified to the listeners (see events.h) once collected, while the other events of a forked process
+ * are not notified at all.
+ *
+ * @author koldar
+ * @date Oct 19, 2026
+ */
+
+#ifndef SECTION_FORK_H_
+#define SECTION_FORK_H_
+
+#include <stdbool.h>
+
+
+
+
+/**
+ * The state of the mode running every @when in a forked process
+ */
+struct ct_section_fork {
+	/**
+	 * The write end of the pipe towards the process which forked this one. -1 in the test process
+	 */
+	int channel;
+	/**
+	 * The @when this process has been forked to visit. @null in the test process
+	 */
+	struct ct_section* root;
+	/**
+	 * The index, in struct ct_model::test_reports_list, of the first test this process needs to send back
+	 */
+	int first_report;
+	/**
+	 * @true if the running test has forked a process for at least a @when
+	 */
+	bool delegated;
+	/**
+	 * The tests collected from the forked processes while the running test is still going on.
+	 * They are added to struct ct_model::test_reports_list when the running test ends
+	 */
+	ct_list_o* collected_reports;
+	/**
+	 * The memory of the collected tests which doesn't belong to the tests themselves
+	 */
+	struct ct_report_arena* arena;
+};
+
+/**
+ * Creates the state of the mode for the test process
+ *
+ * @return the state just created
+ */
+struct ct_section_fork* ct_init_section_fork();
+
+/**
+ * Forks a process to visit a @when
+ *
+ * \pre
+ * 	\li the calling process has been granted access to \c section
+ *
+ * @param[inout] model the model to handle
+ * @param[inout] section the @when to visit
+ * @return
+ * 	\li @true in the forked process, which needs to enter \c section;
+ * 	\li @false in the process which forked, once the forked process has exited. \c section won't be entered anymore.
+ * 	If the forked process has been interrupted by a failed assertion or a signal, or has terminated without sending its tests back,
+ * 	the function doesn't return: it jumps back to the @testcase, like the failed assertion would have done in the process which forked
+ */
+bool ct_fork_section(struct ct_model* model, struct ct_section* section);
+
+/**
+ * Completes a test when every @when runs in a forked process
+ *
+ * The test is discarded if it has delegated some @when to a forked process. The tests collected so far are added to the model and notified to the listeners.
+ * If the calling process has been forked and its @when is fully visited, or the test has been interrupted, the tests are sent back and the process exits.
+ *
+ * @param[inout] model the model to handle
+ * @param[in] report the test which has just ended. It's the last one in struct ct_model::test_reports_list
+ * @param[in] interrupted @true if \c report has been interrupted by a failed assertion or a signal
+ * @return @true if \c report is still in the model and needs to be notified to the listeners, @false if it has been discarded
+ */
+bool ct_section_fork_end_test(struct ct_model* model, struct ct_test_report* report, bool interrupted);
+
+/**
+ * Sends back the tests and exits if the calling process has been forked to visit a @when
+ *
+ * Used when a forked process is about to run something outside its @testcase, which only the test process is entitled to run.
+ *
+ * @param[inout] model the model to handle
+ */
+void ct_section_fork_leave(struct ct_model* model);
+
+/**
+ * Releases from memory the state of the mode
+ *
+ * \pre
+ * 	\li the collected tests have already been released, since they refer to struct ct_section_fork::arena
+ *
+ * @param[inout] section_fork the state to dispose of
+ */
+void ct_destroy_section_fork(struct ct_section_fork* section_fork);
+
+#endif /* SECTION_FORK_H_ */
+/**
+ * @file
+ *
+ * Captures what the tests write on the standard output and on the standard error
+ *
+ * When the capture is enabled with the \c --capture_output command line option, the file descriptors 1 and 2 of every test are redirected
+ * into an in-memory file. When the test ends, the descriptors are restored: if the test has failed, what it has written
+ * is attached to its ::ct_test_report, otherwise it's thrown away. In this way the output of the tests doesn't interleave with the reports
+ * and a terminal doesn't slow down a test printing a lot.
+ *
+ * Only the last ::CT_CAPTURED_OUTPUT_SIZE bytes written by a failed test are kept. Whenever a section is entered, the bytes older than those
+ * are released if the in-memory file holds more than ::CT_CAPTURED_OUTPUT_LIMIT of them, so a test printing a lot doesn't fill the memory.
+ * The progress line is drawn on a duplicate of the original standard error (see ::ct_output_capture_get_original_stderr), which is never captured.
+ *
+ * @author koldar
+ * @date Oct 19, 2026
+ */
+
+#ifndef OUTPUT_CAPTURE_H_
+#define OUTPUT_CAPTURE_H_
+
+#include <stdbool.h>
+#include <stdio.h>
+
+
+
+/**
+ * The maximum number of bytes of output attached to a failed test. Older bytes are dropped
+ */
+#ifndef CT_CAPTURED_OUTPUT_SIZE
+#	define CT_CAPTURED_OUTPUT_SIZE 65536
+#endif
+
+/**
+ * The number of bytes the in-memory file can hold before the ones older than the last ::CT_CAPTURED_OUTPUT_SIZE are released
+ */
+#ifndef CT_CAPTURED_OUTPUT_LIMIT
+#	define CT_CAPTURED_OUTPUT_LIMIT (4 * CT_CAPTURED_OUTPUT_SIZE)
+#endif
+
+/**
+ * The state of the capture of the output
+ */
+struct ct_output_capture {
+	/**
+	 * The in-memory file receiving the output of the running test
+	 */
+	int file;
+	/**
+	 * A duplicate of the standard output of the process
+	 */
+	int saved_stdout;
+	/**
+	 * A duplicate of the standard error of the process
+	 */
+	int saved_stderr;
+	/**
+	 * A stream writing on the original standard error even while the capture is running. @null until it's requested
+	 */
+	FILE* original_stderr;
+	/**
+	 * The offset of struct ct_output_capture::file before which the bytes have been released
+	 */
+	long released_bytes;
+	/**
+	 * @true if the descriptors 1 and 2 are currently redirected into struct ct_output_capture::file
+	 */
+	bool active;
+};
+
+/**
+ * Creates the state of the capture
+ *
+ * @return the state just created
+ */
+struct ct_output_capture* ct_init_output_capture();
+
+/**
+ * Redirects the standard output and the standard error into an empty in-memory file
+ *
+ * @param[inout] capture the capture to start
+ */
+void ct_output_capture_start(struct ct_output_capture* capture);
+
+/**
+ * Restores the standard output and the standard error
+ *
+ * The function can be called after a \c siglongjmp out of the test: nothing is done if the capture is not running.
+ *
+ * @param[inout] capture the capture to stop
+ * @param[inout] report the test which has just ended. If it has failed, its struct ct_test_report::output is set to what the test has written
+ */
+void ct_output_capture_stop(struct ct_output_capture* capture, struct ct_test_report* report);
+
+/**
+ * Fetches how much the running test has written so far
+ *
+ * @param[in] capture the capture to check
+ * @return the size of the output of the running test. -1 if the capture is not running
+ */
+long ct_output_capture_mark(const struct ct_output_capture* capture);
+
+/**
+ * Throws away what the running test has written after a call of ::ct_output_capture_mark
+ *
+ * Used when a @when has been run by a forked process sharing the same in-memory file: the output of the forked process belongs to its tests only.
+ *
+ * @param[inout] capture the capture to handle
+ * @param[in] mark the value returned by ::ct_output_capture_mark
+ */
+void ct_output_capture_rewind(struct ct_output_capture* capture, long mark);
+
+/**
+ * Releases the bytes written by the running test which would not be attached to its report anyway
+ *
+ * Nothing is done unless the in-memory file holds more than ::CT_CAPTURED_OUTPUT_LIMIT bytes. The size of the file doesn't change,
+ * so the values returned by ::ct_output_capture_mark stay valid.
+ *
+ * @param[inout] capture the capture to handle
+ */
+void ct_output_capture_trim(struct ct_output_capture* capture);
+
+/**
+ * Fetches a stream writing on the standard error the process had before any capture
+ *
+ * @param[inout] capture the capture to handle
+ * @return a stream which is never captured, released together with \c capture. @null if it can't be opened
+ */
+FILE* ct_output_capture_get_original_stderr(struct ct_output_capture* capture);
+
+/**
+ * Releases from memory the state of the capture
+ *
+ * @param[inout] capture the state to dispose of
+ */
+void ct_destroy_output_capture(struct ct_output_capture* capture);
+
+#endif /* OUTPUT_CAPTURE_H_ */
+/**
+ * @file
+ *
+ * A journal of the tests, written while they run, which survives the death of the test process
+ *
+ * The report of a run is produced only when every test has ended: if the process is killed before (e.g. by the OOM killer or by a timeout of
+ * the continuous integration), nothing is left. When a journal is given with the \c --journal command line option, every test is appended to it as soon as it ends.
+ * The journal is opened with \c O_APPEND and every record is written with a single \c write, so a killed process leaves at most its last record truncated.
+ * The journal is flushed to the disk with \c fdatasync at most once every ::CT_JOURNAL_SYNC_PERIOD microseconds.
+ *
+ * The journal is a text file, one record per line:
+ * \li <tt>R</tt>: an invocation of the test program starts;
+ * \li <tt>T key occurrence outcome repetition time path</tt>: a test has ended. \c key and \c occurrence identify its @testcase (see below),
+ * 	\c outcome is either \c S (passed) or \c F (failed), \c time is in microseconds and \c path contains the descriptions of the @testcase and of the @when
+ * 	sections the test entered, separated by ::CT_SECTION_PATH_SEPARATOR;
+ * \li <tt>D key occurrence</tt>: every test of a @testcase has ended.
+ *
+ * A @testcase is identified by the hexadecimal struct ct_section::path_hash of its section and by how many @testcase with the same path have been met before
+ * in the same invocation (see ::ct_get_testcase_key).
+ *
+ * When the test program is invoked again with \c --resume, the @testcase completed in the journal are skipped and the new tests are appended to the same journal.
+ * A @testcase is skipped only if all its tests have ended: the tests of a @testcase interrupted by the death of the process are run again.
+ * Since a skipped @testcase doesn't appear in the report of the resumed invocation, the summary of the whole run is rebuilt from the journal with
+ * <tt>crashc-report --journal</tt>. Resuming is meaningful only if the tests and the command line options selecting them haven't changed.
+ *
+ * @author koldar
+ * @date Oct 19, 2026
+ */
+
+#ifndef JOURNAL_H_
+#define JOURNAL_H_
+
+#include <stdbool.h>
+#include <time.h>
+
+
+
+
+
+/**
+ * The maximum time, in microseconds, a record can stay in the journal without being flushed to the disk
+ */
+#ifndef CT_JOURNAL_SYNC_PERIOD
+#	define CT_JOURNAL_SYNC_PERIOD 1000000
+#endif
+
+/**
+ * The maximum size of a record of the journal. Longer paths are truncated
+ */
+#ifndef CT_JOURNAL_RECORD_SIZE
+#	define CT_JOURNAL_RECORD_SIZE 1024
+#endif
+
+/**
+ * The state of the journal
+ */
+struct ct_journal {
+	/**
+	 * The file descriptor of the journal, opened in append mode
+	 */
+	int file;
+	/**
+	 * The @testcase completed by the previous invocations, indexed by ::ct_testcase_key_hash. Each value is a struct ct_testcase_key
+	 */
+	ct_hashtable_o* completed_testcases;
+	/**
+	 * The @testcase running right now. @null before the first one
+	 */
+	const struct ct_section* testcase;
+	/**
+	 * @true if struct ct_journal::testcase has been completed by a previous invocation
+	 */
+	bool completed;
+	/**
+	 * The number of @testcase skipped because completed by the previous invocations
+	 */
+	int skipped_testcases;
+	/**
+	 * When the journal has been flushed to the disk for the last time
+	 */
+	struct timespec last_sync;
+	/**
+	 * @true if some records have been written after struct ct_journal::last_sync
+	 */
+	bool dirty;
+};
+
+/**
+ * Opens a journal and subscribes the listener writing the tests into it
+ *
+ * \post
+ * 	\li struct ct_model::journal is set to the journal
+ *
+ * @param[inout] model the model to handle
+ * @param[in] path the file of the journal
+ * @param[in] resume @true to keep the content of the journal and skip the @testcase it has completed, @false to empty it
+ * @return the state of the journal
+ */
+struct ct_journal* ct_enable_journal(struct ct_model* model, const char* path, bool resume);
+
+/**
+ * Checks whether a @testcase has been completed by a previous invocation
+ *
+ * The function needs to be called every time access to a @testcase is requested: the first call for a @testcase makes it the running one.
+ *
+ * @param[inout] model the model whose struct ct_model::journal needs to be handled
+ * @param[in] testcase the section of the @testcase
+ * @return @true if \c testcase needs to be skipped, @false otherwise
+ */
+bool ct_journal_testcase_completed(struct ct_model* model, const struct ct_section* testcase);
+
+/**
+ * Records that every test of a @testcase has ended
+ *
+ * @param[inout] model the model whose struct ct_model::journal needs to be handled
+ * @param[in] testcase the section of the @testcase. Nothing is done if it's not the running one, as it happens with a ::FUZZ_TESTCASE
+ */
+void ct_journal_end_testcase(struct ct_model* model, const struct ct_section* testcase);
+
+/**
+ * Checks whether a previous invocation has completed the @testcase with a given key
+ *
+ * @param[in] journal the journal to handle
+ * @param[in] key the key of the @testcase
+ * @return @true if the @testcase has been completed, @false otherwise
+ */
+bool ct_journal_key_completed(const struct ct_journal* journal, const struct ct_testcase_key* key);
+
+/**
+ * Records that every test of the @testcase with a given key has ended
+ *
+ * @param[inout] journal the journal to handle
+ * @param[in] key the key of the @testcase
+ */
+void ct_journal_complete_key(struct ct_journal* journal, const struct ct_testcase_key* key);
+
+/**
+ * Flushes the journal to the disk and releases it from memory
+ *
+ * @param[inout] journal the journal to dispose of
+ */
+void ct_destroy_journal(struct ct_journal* journal);
+
+#endif /* JOURNAL_H_ */
+/**
+ * @file
+ *
+ * Distributes the @testcase among worker processes, possibly running on other hosts
+ *
+ * When the \c --coordinator command line option is given, the test process becomes a coordinator: it listens on the given address,
+ * forks ::ct_get_workers_number local workers and waits for the tests. Other workers, even on other hosts, may join the run by invoking
+ * the same test executable, with the same options, with <tt>--worker</tt> and the address of the coordinator.
+ *
+ * Every worker runs the @testsuite in the order the coordinator has chosen (see suite_order.h), but before entering a @testcase (or a ::FUZZ_TESTCASE) it claims it to the coordinator:
+ * the first worker claiming a @testcase runs it, the other ones skip it. So the workers pull the @testcase as soon as they are free,
+ * and a slow @testcase doesn't hold back the others. When a worker has run every test of a @testcase, it sends the serialized tests
+ * (see report_serialization.h) to the coordinator and drops them.
+ *
+ * The coordinator notifies the tests it receives to the listeners (see events.h), while the listeners of the workers are not notified at all.
+ * The journal (see journal.h) is kept by the coordinator as well: with \c --resume, the @testcase it has completed are never granted to a worker.
+ * When every worker has left, the tests are put in the order the @testcase have been claimed in, namely the order a single process would have run them in,
+ * and the coordinator produces the report as if it had run them itself.
+ *
+ * If a worker dies while running a @testcase, the tests of that @testcase are lost: the coordinator warns about it on the standard error.
+ * The same happens if a worker sends a message the coordinator can't understand (an unexpected type, a message larger than
+ * ::CT_DISTRIBUTION_MAX_MESSAGE_SIZE or tests which can't be deserialized): the coordinator closes the connection of that worker and goes on.
+ *
+ * The messages carry the structures of @crashc as they are laid out in memory (see report_serialization.h): every worker needs to run
+ * the very same test executable as the coordinator, on the same architecture.
+ *
+ * The addresses are either <tt>unix:PATH</tt>, for a UNIX domain socket, or <tt>tcp:HOST:PORT</tt> (the \c tcp: prefix can be omitted).
+ * A coordinator listening on TCP with an empty \c HOST accepts workers from any interface.
+ * Nothing is authenticated: a TCP coordinator needs to be reachable only from trusted hosts.
+ *
+ * @author koldar
+ * @date Oct 19, 2026
+ */
+
+#ifndef DISTRIBUTION_H_
+#define DISTRIBUTION_H_
+
+#include <stdbool.h>
+
+
+
+
+/**
+ * The number of pending connections the coordinator accepts
+ */
+#ifndef CT_DISTRIBUTION_BACKLOG
+#	define CT_DISTRIBUTION_BACKLOG 64
+#endif
+
+/**
+ * The largest message, in bytes, the coordinator accepts from a worker
+ */
+#ifndef CT_DISTRIBUTION_MAX_MESSAGE_SIZE
+#	define CT_DISTRIBUTION_MAX_MESSAGE_SIZE (256 * 1024 * 1024)
+#endif
+
+/**
+ * The state of a process taking part in a distributed run
+ */
+struct ct_distribution {
+	/**
+	 * In a worker, the connection to the coordinator. In the coordinator, the listening socket
+	 */
+	int channel;
+	/**
+	 * @true in the coordinator, @false in a worker
+	 */
+	bool coordinator;
+	/**
+	 * In a worker, the last @testcase claimed. @null before the first claim
+	 */
+	const struct ct_section* testcase;
+	/**
+	 * In a worker, @true if struct ct_distribution::testcase has been granted to this worker
+	 */
+	bool granted;
+	/**
+	 * In the coordinator, the memory of the tests received from the workers
+	 */
+	struct ct_report_arena* arena;
+	/**
+	 * In the coordinator, the number of @testcase whose worker has died before sending their tests
+	 */
+	int lost_testcases;
+};
+
+/**
+ * Takes part in a distributed run, if the command line options asked for it
+ *
+ * If struct ct_model::coordinator_address is set, the function serves the @testcase to the workers until every worker has left and
+ * moves the tests received into struct ct_model::test_reports_list. The local workers return from the function as well.
+ * If struct ct_model::worker_address is set, the function connects to the coordinator.
+ *
+ * \pre
+ * 	\li every @testsuite has been registered and ordered
+ * \post
+ * 	\li struct ct_model::distribution is set if the run is distributed
+ *
+ * @param[inout] model the model to handle
+ * @return @true if the calling process needs to run the @testsuite, @false if it's the coordinator and the tests are already in the model
+ */
+bool ct_distribute(struct ct_model* model);
+
+/**
+ * Claims a @testcase to the coordinator
+ *
+ * The function needs to be called every time access to a @testcase is requested: the first call for a @testcase claims it.
+ *
+ * \pre
+ * 	\li the calling process is a worker
+ *
+ * @param[inout] model the model to handle
+ * @param[in] testcase the section of the @testcase
+ * @return @true if the calling worker needs to run \c testcase, @false if another worker has claimed it before
+ */
+bool ct_distribution_claim(struct ct_model* model, const struct ct_section* testcase);
+
+/**
+ * Sends the tests of a @testcase to the coordinator and removes them from struct ct_model::test_reports_list
+ *
+ * Nothing is done if the calling process is not a worker or \c testcase is not the one it has claimed last.
+ *
+ * @param[inout] model the model to handle
+ * @param[in] testcase the section of the @testcase whose tests have all ended
+ */
+void ct_distribution_end_testcase(struct ct_model* model, const struct ct_section* testcase);
+
+/**
+ * Leaves the distributed run and exits if the calling process is a worker
+ *
+ * @param[inout] model the model to handle
+ */
+void ct_distribution_leave(struct ct_model* model);
+
+/**
+ * Releases from memory the state of the distribution
+ *
+ * \pre
+ * 	\li the tests received from the workers have already been released
+ *
+ * @param[inout] distribution the state to dispose of
+ */
+void ct_destroy_distribution(struct ct_distribution* distribution);
+
+#endif /* DISTRIBUTION_H_ */
+/**
+ * @file
+ *
+ * Runs only the @testcase affected by a change, looking at the source files each @testcase covered in a previous run
+ *
+ * The selection needs a coverage index, built by a run with the \c --collect_coverage command line option. Such a run needs the test executable,
+ * and CrashC itself, built with gcov instrumentation (<tt>--coverage</tt>) and with \c CT_COVERAGE defined (e.g. <tt>cmake -DU_COVERAGE=true</tt>).
+ * Before every @testcase the gcov counters are reset; when every test of the @testcase has ended the counters are dumped with \c __gcov_dump
+ * into a temporary directory (set with \c GCOV_PREFIX) and every \c .gcda file with a counter not zero is added to the files the @testcase covers.
+ *
+ * The index is a text file, one record per line:
+ * \li <tt>F name</tt>: an instrumented file, namely the path of its \c .gcda file without the extension. The files are numbered from 0 in the order they appear;
+ * \li <tt>T key occurrence number files...</tt>: a @testcase, identified like in the journal (see ::ct_get_testcase_key), with the number of files it covers
+ * 	followed by their numbers.
+ *
+ * When the \c --changed_files command line option gives the list of the changed files (e.g. the output of <tt>git diff --name-only</tt>), a @testcase is run only if:
+ * \li it's missing from the index, for instance because it has been written after the index;
+ * \li or it covers a file with the same name of a changed one (\c .gcda files are named either after the source file, like \c list.c.gcda, or after the object file, like \c list.gcda).
+ * If a changed file doesn't match any file of the index, as it happens with a header, every @testcase is run: the selection never skips a @testcase the change may break,
+ * but it may run more @testcase than needed.
+ *
+ * The index is meaningful only for the same tests run with the same command line options selecting them.
+ * The code run by forked processes is not covered: while collecting, \c --fork_sections and \c --coordinator are ignored,
+ * and the processes exploring STRESS interleavings or replaying fuzzing inputs are not looked at. A ::FUZZ_TESTCASE is always run.
+ *
+ * @author koldar
+ * @date Oct 19, 2026
+ */
+
+#ifndef COVERAGE_H_
+#define COVERAGE_H_
+
+#include <stdbool.h>
+
+
+
+
+
+
+/**
+ * A file instrumented by gcov
+ */
+struct ct_covered_file {
+	/**
+	 * The path of the \c .gcda file of the file, without the extension
+	 */
+	char* name;
+	/**
+	 * The number of the file in the index
+	 */
+	int id;
+};
+
+/**
+ * The files covered by a @testcase
+ */
+struct ct_covered_testcase {
+	struct ct_testcase_key key;
+	/**
+	 * The number of items in struct ct_covered_testcase::files
+	 */
+	int files_number;
+	/**
+	 * The struct ct_covered_file::id of the covered files
+	 */
+	int* files;
+};
+
+/**
+ * The state of the coverage collection or of the selection of the @testcase
+ */
+struct ct_coverage {
+	/**
+	 * @true if the coverage is being collected, @false if the @testcase are being selected
+	 */
+	bool collecting;
+	/**
+	 * The file the index is written into once collected. @null while selecting
+	 */
+	char* index_path;
+	/**
+	 * While collecting, the temporary directory gcov dumps the counters into
+	 */
+	char directory[CT_BUFFER_SIZE];
+	/**
+	 * While collecting, the value \c GCOV_PREFIX had before. @null if it wasn't set
+	 */
+	char* previous_prefix;
+	/**
+	 * The instrumented files, ordered by struct ct_covered_file::id. Each value is a struct ct_covered_file
+	 */
+	ct_list_o* files;
+	/**
+	 * struct ct_coverage::files indexed by a hash of their name
+	 */
+	ct_hashtable_o* files_index;
+	/**
+	 * The @testcase in the index, in the order they have been run. Each value is a struct ct_covered_testcase
+	 */
+	ct_list_o* testcases;
+	/**
+	 * struct ct_coverage::testcases indexed by ::ct_testcase_key_hash
+	 */
+	ct_hashtable_o* testcases_index;
+	/**
+	 * While selecting, @true for the struct ct_covered_file::id of the changed files
+	 */
+	bool* changed;
+	/**
+	 * While selecting, @true if a changed file is not in the index, so every @testcase needs to be run
+	 */
+	bool run_everything;
+	/**
+	 * The @testcase running right now. @null before the first one
+	 */
+	const struct ct_section* testcase;
+	/**
+	 * @true if struct ct_coverage::testcase needs to be run
+	 */
+	bool selected;
+	/**
+	 * The number of @testcase skipped because not affected by the changed files
+	 */
+	int skipped_testcases;
+};
+
+/**
+ * Starts collecting the coverage of the @testcase, or selecting them with the coverage collected before
+ *
+ * While collecting, \c --fork_sections and \c --coordinator are disabled, since the coverage of forked processes is not collected.
+ * The process exits if the coverage can't be collected or the index can't be read.
+ *
+ * \post
+ * 	\li struct ct_model::coverage is set
+ *
+ * @param[inout] model the model to handle
+ * @param[in] index_path the coverage index
+ * @param[in] collect @true to collect the coverage and write it into \c index_path, @false to select the @testcase
+ * @param[in] changed_files_path while selecting, the file listing the changed files, one per line. \c "-" to read them from the standard input
+ * @return the state of the coverage
+ */
+struct ct_coverage* ct_enable_coverage(struct ct_model* model, const char* index_path, bool collect, const char* changed_files_path);
+
+/**
+ * Checks whether a @testcase needs to be run and, while collecting, starts collecting its coverage
+ *
+ * The function needs to be called every time access to a @testcase is requested: the first call for a @testcase makes it the running one.
+ *
+ * @param[inout] model the model whose struct ct_model::coverage needs to be handled
+ * @param[in] testcase the section of the @testcase
+ * @return @true if \c testcase needs to be run, @false if it needs to be skipped
+ */
+bool ct_coverage_enter_testcase(struct ct_model* model, const struct ct_section* testcase);
+
+/**
+ * Records the files covered by a @testcase whose tests have all ended
+ *
+ * Nothing is done while selecting, or if \c testcase is not the running one.
+ *
+ * @param[inout] model the model whose struct ct_model::coverage needs to be handled
+ * @param[in] testcase the section of the @testcase
+ */
+void ct_coverage_end_testcase(struct ct_model* model, const struct ct_section* testcase);
+
+/**
+ * Writes the index if the coverage has been collected and releases the state from memory
+ *
+ * @param[inout] coverage the state to dispose of
+ */
+void ct_destroy_coverage(struct ct_coverage* coverage);
+
+#endif /* COVERAGE_H_ */
+/**
+ * @file
+ *
+ * Chooses the order the @testsuite are run in
+ *
+ * By default the @testsuite are run in the order they have been registered. With the \c --order command line option they are sorted
+ * by what the history file (see progress.h) says about the previous run:
+ * \li \c durations runs first the @testsuite which took longer (the longest processing time first rule), so that the work left at the end,
+ * 	when the processes sharing the run have nothing else to do, is as short as possible;
+ * \li \c failures runs first the @testsuite with the highest ratio of failed tests, so that a broken change is noticed as soon as possible.
+ * In both cases the @testsuite missing from the history file, which have never been timed, are run first, in registration order.
+ *
+ * The \c durations order pays off when several processes share the run: within a single process the total time doesn't change.
+ * In a distributed run (see distribution.h) the order is computed by the coordinator, from its own history file, and sent to every worker,
+ * so that the workers claim the @testcase in the priority the coordinator has chosen. The coordinator keeps the history file up to date
+ * with the tests it receives.
+ *
+ * The @testcase inside a @testsuite are statements of its body, so they are always run in the order they are written.
+ *
+ * The order doesn't change the report: when every test has ended, the tests are sorted back into the order they would have had without the option.
+ *
+ * @author koldar
+ * @date Oct 19, 2026
+ */
+
+#ifndef SUITE_ORDER_H_
+#define SUITE_ORDER_H_
+
+#include <stdbool.h>
+
+
+
+/**
+ * The criteria the @testsuite can be sorted with
+ */
+enum ct_suite_order {
+	/**
+	 * The @testsuite are run in registration order
+	 */
+	CT_ORDER_DECLARATION,
+	/**
+	 * The @testsuite which took longer in the previous run are run first
+	 */
+	CT_ORDER_DURATION,
+	/**
+	 * The @testsuite with the highest ratio of failed tests in the previous run are run first
+	 */
+	CT_ORDER_FAILURES
+};
+
+/**
+ * Parses the name of an order, as given to the \c --order command line option
+ *
+ * @param[in] name either \c "declaration", \c "durations" or \c "failures"
+ * @param[out] order the order named by \c name
+ * @return @true if \c name is valid, @false otherwise
+ */
+bool ct_parse_suite_order(const char* name, enum ct_suite_order* order);
+
+/**
+ * Sorts struct ct_model::suites_order with struct ct_model::suite_order
+ *
+ * Nothing is done in a worker of a distributed run, which receives the order from its coordinator.
+ *
+ * \pre
+ * 	\li every @testsuite has been registered
+ *
+ * @param[inout] model the model to handle
+ */
+void ct_order_suites(struct ct_model* model);
+
+/**
+ * Sorts the tests in struct ct_model::test_reports_list as if the @testsuite had been run in registration order
+ *
+ * @param[inout] model the model to handle
+ */
+void ct_restore_declaration_order(struct ct_model* model);
+
+#endif /* SUITE_ORDER_H_ */
+/**
+ * @file
+ *
+ * Contains all the global variables inside the project
+ *
+ * @date Oct 11, 2017
+ * @author koldar
+ */
+
+#ifndef MAIN_MODEL_H_
+#define MAIN_MODEL_H_
+
+
+
+//TODO rename the file in global_variables.h
+
+/**
+ * @defgroup globalVariables Global Variables
+ * @brief a collection of all the global variables used in the project
+ * @{
+ */
+
+/**
+ * A structure containing the whole model of application
+ *
+ * This global variable represents the struct ct_model the framework use to store all its data.
+ *
+ */
+extern struct ct_model* ct_model;
+
+///@}
+
+#endif /* MAIN_MODEL_H_ */
+/**
+ * @file
+ *
+ * Represents the model of @crashc.
+ *
+ * All the data needed by a **single instance of the framework** should be defined in the model.
+ * With this design, one can potentially run several, different, instances of @crashc within the same process,
+ * since they would use different struct ct_model instances.
+ *
+ * @author koldar
+ * @date Oct 11, 2017
+ */
+
+#ifndef MODEL_H_
+#define MODEL_H_
+
+#include <signal.h>
+#include <setjmp.h>
+#include <stdbool.h>
+#include <pthread.h>
+
+
+
+
+
+
+
+
+
+
+/**
+ * The maximum number of registrable suites
+ *
+ * This macro is used to set the initial size of the internal array used to contain the tests functions pointers
+ */
+#ifndef MAX_TESTS
+#   define MAX_TESTS 256
+#endif
+
+/**
+ * The number of fatal signals @crashc intercepts while running tests
+ *
+ * @see ct_register_signal_handlers
+ */
+#define CT_HANDLED_SIGNALS_NUMBER 5
+
+/**
+ * The maximum number of stack frames captured when a test raises a fatal signal
+ *
+ * Set it to 0 to disable backtrace capturing altogether
+ */
+#ifndef CT_BACKTRACE_SIZE
+#	define CT_BACKTRACE_SIZE 64
+#endif
+
+/**
+ * The number of innermost frames which belong to the signal delivery itself rather than to the code under test
+ *
+ * These are the @crashc signal handler and the kernel signal trampoline
+ */
+#define CT_BACKTRACE_SKIPPED_FRAMES 2
+
+/**
+ * A collection of required variables used by a run of @crashc to soundly operate
+ *
+ * @definition @crashc model
+ * It's a collection of all the needed variables a single thread of @crashc needs
+ */
+struct ct_model {
+	/**
+	 * Array containing the pointers to the testsuites functions
+	 */
+	ct_test_c tests_array[MAX_TESTS];
+	/**
+	 * For each cell of struct ct_model::tests_array, the id of the @testsuite
+	 */
+	const char* suites_names[MAX_TESTS];
+	/**
+	 * The indexes of the cells of struct ct_model::tests_array, in the order the @testsuite are run. See suite_order.h
+	 */
+	int suites_order[MAX_TESTS];
+	/**
+	 * The index, in struct ct_model::tests_array, of the running @testsuite
+	 */
+	int current_suite;
+	/**
+	 * How struct ct_model::suites_order is sorted
+	 */
+	enum ct_suite_order suite_order;
+	/**
+	 * The pointer to the global teardown function
+	 *
+	 * This is @null by default, and gets populated with a function pointer whenever the user uses the AFTER_TESTS macro.
+	 *
+	 * @definition
+	 * The global teardown function is the last piece of code to execute before the struct ct_model model used by the framework is tore down.
+	 * It's basically the last place where you can put custom code
+	 */
+	ct_teardown_c ct_teardown;
+	/**
+	 * Variablee used to keep track of the @testsuite registered
+	 *
+	 * Whilst registering @testsuite, the field represents the number of @testsuite you've registered so far.
+	 * After registered all the @testsuite, the field represents the numbr of @testsuite registered in the run:
+	 * you can use the values to understand where the field ct_model::tests_array ends to have meanings
+	 *
+	 * @see REG_SUITE
+	 */
+	int suites_array_index;
+	/**
+	 * The list of the test reports generated by this instance of crash c test
+	 *
+	 * The payloads within the list are of type ::ct_test_report.
+	 * Each of them represent the outcome of the test of a run within a @testcase loop.
+	 */
+	ct_list_o* test_reports_list;
+	/**
+	 * field representing the root of the section tree
+	 *
+	 * @ref section_tree
+	 */
+	struct ct_section* root_section;
+	/**
+	 * The site of struct ct_model::root_section, which doesn't come from any @containablesection
+	 */
+	struct ct_section_site root_site;
+	/**
+	 * The head of the list of the sites prepared so far. See ::ct_section_site_prepare
+	 */
+	struct ct_section_site* prepared_sites;
+	/**
+	 * Represents the @containablesection we're analyzing right now in a given time when we're running test code.
+	 *
+	 * Suppose you have the following code:
+	 *
+	 * @include exampleOfTestCase.dox
+	 *
+	 * which translate to the following section tree:
+	 *
+	 * @dotfile exampleOfTestCase.dot
+	 *
+	 * Suppose the program is inside "when 2": you need something that allows you to synchronize:
+	 * \li where @crashc thinks the code is running;
+	 * \li where the code is actually running;
+	 *
+	 * This means you need something that points which @containablesection you're actually in. This variable is that pointer.
+	 *
+	 * When you're in "when 2" this variable is set to the node in the tree representing "when 2". When you enter inside the code of "then1",
+	 * this variable is reset to point "then 1" ::ct_section. Then, when you return to "when 2" to execute the code between "then 1" and "then 2", this variable
+	 * is set again in a way to point "when2".
+	 */
+	struct ct_section* current_section;
+	/**
+	 * Pointer to the current section snapshot of ct_model_ct::current_section
+	 *
+	 * This is used by test reports to store the flow of execution followed by the tests
+	 */
+	struct ct_snapshot* current_snapshot;
+	/**
+	 * The ::TESTCASE @crashc is handling right now
+	 *
+	 * @crashc can handle at most 1 test case per time
+	 */
+	struct ct_section* jump_source_testcase;
+	/**
+	 * Represents the tags the user has specified as the only ones that should be consider
+	 *
+	 * A test is run only if it declares at least one tag inside this container.
+	 * If the test is in conflict with ct_model::excludeTags , ct_model::excludeTags has the precedence.
+	 *
+	 * If this hashtable is empty, then we consider as if the check does't need to happen
+	 *
+	 * @see struct ct_model::excludeTags
+	 */
+	ct_tag_hashtable_o* run_only_if_tags;
+	/**
+	 * Represents the tags the user has specified as the ones that excludes tests
+	 *
+	 * A test is skipped if it declares at least one tag inside this container.
+	 * If the test is in conflict with ct_model::run_only_if_tags, ct_model::excludeTags has the precedence
+	 *
+	 * If this hashtable is empty, then we consider as if the check does't need to happen
+	 *
+	 * @see struct ct_model::run_only_if_tags
+	 */
+	ct_tag_hashtable_o* exclude_tags;
+	/**
+	 * Used to store the execution state to be restored thanks to setjmp and longjmp when needed during faulty test execution.
+	 *
+	 * By faulty test we mean tests which generate the following scenarios:
+	 * \li some signal is detected (i.e. SIGSEGV or SIGFPE);
+	 * \li an assertion failed;
+	 *
+	 * Only ct_model::main_thread can jump here: worker threads jump to their own struct ct_thread_context::jump_point.
+	 */
+	jmp_buf jump_point;
+	/**
+	 * The thread running the tests
+	 *
+	 * It's the only thread which can read or write ct_model::current_section, ct_model::current_snapshot and ct_model::jump_point.
+	 * See thread_context.h
+	 */
+	pthread_t main_thread;
+	/**
+	 * Lock-free stack containing the assertions performed by worker threads which have not been merged into a snapshot yet
+	 *
+	 * @see ct_merge_thread_reports
+	 */
+	struct ct_thread_assert_report* thread_assert_reports;
+	/**
+	 * The first fatal signal raised on a worker thread which has not been merged into a snapshot yet
+	 *
+	 * 0 if no signal has been raised, -1 while a worker thread is recording the signal
+	 */
+	int thread_signal_detected;
+	/**
+	 * The \c si_code of ct_model::thread_signal_detected
+	 */
+	int thread_signal_code;
+	/**
+	 * The faulting address of ct_model::thread_signal_detected
+	 */
+	void* thread_signal_address;
+	/**
+	 * Represents the sigaction flag required for intercepting signals
+	 *
+	 * @see struct ct_model::jump_point
+	 */
+	struct sigaction _crashc_sigaction;
+	/**
+	 * The alternate stack the signal handler of @crashc runs on
+	 *
+	 * A stack overflow inside the code under test leaves no room on the regular stack to run any handler at all.
+	 * Running ::ct_register_signal_handlers handler on its own preallocated stack allows @crashc to detect
+	 * even such faults.
+	 *
+	 * The field \c ss_sp is @null if no alternate stack has been installed yet.
+	 */
+	stack_t signal_stack;
+	/**
+	 * The actions which were associated to each fatal signal before @crashc registered its own handlers.
+	 *
+	 * The i-th cell is meaningful only if the i-th cell of ct_model::signal_handler_installed is @true.
+	 * These are restored by ::ct_unregister_signal_handlers
+	 */
+	struct sigaction previous_sigactions[CT_HANDLED_SIGNALS_NUMBER];
+	/**
+	 * Tells, for each fatal signal, if @crashc has registered its own handler
+	 *
+	 * @crashc won't register a handler for a signal if the program under test has already installed one for it.
+	 */
+	bool signal_handler_installed[CT_HANDLED_SIGNALS_NUMBER];
+	/**
+	 * Buffer where the signal handler stores the backtrace of the code which raised a fatal signal
+	 *
+	 * The signal handler can't safely allocate memory, hence the backtrace is first captured here and then
+	 * copied into the snapshot after we have jumped back to ct_model::jump_point.
+	 * Only the first ct_model::backtrace_buffer_size cells are meaningful. The first ::CT_BACKTRACE_SKIPPED_FRAMES
+	 * cells are never attached to the snapshot
+	 */
+	void* backtrace_buffer[CT_BACKTRACE_SIZE + CT_BACKTRACE_SKIPPED_FRAMES];
+	/**
+	 * The number of frames inside ct_model::backtrace_buffer
+	 */
+	int backtrace_buffer_size;
+	/**
+	 * The snapshot which was running when the last fatal signal has been detected
+	 *
+	 * @null if the backtrace inside ct_model::backtrace_buffer has already been attached to its snapshot
+	 */
+	struct ct_snapshot* signaled_snapshot;
+	/**
+	 * contains severla  statistical informations about the tests.
+	 *
+	 * Example may be:
+	 * 	\li the number of total tests;
+	 * 	\li the number of failed tests;
+	 * 	\li and so on...;
+	 */
+	struct ct_test_stats* statistics;
+	/**
+	 * The implementation of the report producer used by the model.
+	 *
+	 * This contains the functions used to create test reports for the user to overview
+	 */
+	struct ct_report_producer* report_producer_implementation;
+	/**
+	 * The file where to write the report on
+	 */
+	FILE* output_file;
+	/**
+	 * Counts the memory allocated by the code under test
+	 *
+	 * @notnull
+	 */
+	struct ct_allocation_tracker* allocation_tracker;
+
+	/**
+	 * @true if every snapshot measures the operating system resources consumed by its section, @false otherwise
+	 *
+	 * Off by default: the resources are sampled twice per snapshot and printed for each of them
+	 */
+	bool measure_resources;
+
+	/**
+	 * The hardware performance counters measuring every snapshot
+	 *
+	 * @null unless the counters have been requested with \c --hardware_counters: only the elapsed time of the snapshots is measured then.
+	 * The group may not be available either: in that case the counters of the snapshots are marked as unavailable
+	 */
+	struct ct_hardware_counters_group* hardware_counters;
+
+	/**
+	 * The number of seeds to explore for every ::STRESS section
+	 *
+	 * If 0, the threads of a stress test run in parallel without any scheduler. See schedule.h
+	 */
+	long schedule_seeds;
+	/**
+	 * A seed to replay for every ::STRESS section. -1 if no seed has to be replayed
+	 *
+	 * If set, ct_model::schedule_seeds is ignored
+	 */
+	long schedule_replay_seed;
+	/**
+	 * The maximum number of processes @crashc can fork to run something in parallel. If not positive, the number of online CPUs is used
+	 *
+	 * See ::ct_get_workers_number
+	 */
+	int workers;
+
+	/**
+	 * The directory containing the inputs of every ::FUZZ_TESTCASE in replay mode. @null if no corpus has been given
+	 */
+	const char* corpus_path;
+	/**
+	 * The input provided by the fuzzer in fuzz mode. @null in replay mode
+	 *
+	 * See fuzz.h
+	 */
+	struct ct_fuzz_input* fuzzer_input;
+	/**
+	 * The inputs of the ::FUZZ_TESTCASE running right now. @null if no ::FUZZ_TESTCASE is running
+	 */
+	struct ct_fuzz_corpus* fuzz_corpus;
+	/**
+	 * The memory of the tests the fuzzing worker processes have sent back which doesn't belong to the tests themselves.
+	 * @null until a ::FUZZ_TESTCASE splits its inputs among worker processes
+	 */
+	struct ct_report_arena* fuzz_arena;
+
+	/**
+	 * The number of times every @testsuite is run. Greater than 1 to detect flaky tests (see flaky.h)
+	 */
+	int repetitions;
+	/**
+	 * The repetition running right now, starting from 0
+	 */
+	int repetition;
+
+	/**
+	 * The file where the binary event log of the run is written (see binary_report.h). @null to produce the textual report
+	 */
+	char* binary_report_path;
+
+	/**
+	 * The listeners notified while the tests are running (see events.h)
+	 */
+	struct ct_event_dispatcher* event_dispatcher;
+	/**
+	 * @true if the progress of the run needs to be shown on the terminal
+	 */
+	bool show_progress;
+	/**
+	 * The file containing the timings of the previous run (see progress.h). @null if there is no such file
+	 */
+	char* history_path;
+	/**
+	 * The state of the progress listener. @null if the listener is not subscribed
+	 */
+	struct ct_progress* progress;
+
+	/**
+	 * Every section created so far, indexed by struct ct_section::path_hash. If several sections have the same path, only the first one is indexed
+	 */
+	ct_hashtable_o* section_index;
+	/**
+	 * How many @testcase with a given path have been met so far, indexed by struct ct_section::path_hash. Each value is a struct ct_testcase_key
+	 */
+	ct_hashtable_o* testcase_occurrences;
+	/**
+	 * The last @testcase passed to ::ct_get_testcase_key. @null before the first call
+	 */
+	const struct ct_section* keyed_testcase;
+	/**
+	 * The key of struct ct_model::keyed_testcase
+	 */
+	struct ct_testcase_key testcase_key;
+	/**
+	 * The path of the section selected with ::ct_select_section_path. @null if every section is run
+	 */
+	const char* selected_section_path;
+	/**
+	 * The hashes of the paths of the selected section and of its ancestors. Each value is the level of the section with such path
+	 */
+	ct_hashtable_o* selected_path_prefixes;
+	/**
+	 * The level of the selected section in the section tree
+	 */
+	int selected_path_level;
+
+	/**
+	 * The state of the mode running every @when in a forked process (see section_fork.h). @null if the mode is disabled
+	 */
+	struct ct_section_fork* section_fork;
+	/**
+	 * The state of the capture of the output of the tests (see output_capture.h). @null if the output is not captured
+	 */
+	struct ct_output_capture* output_capture;
+
+	/**
+	 * The file where the tests are appended as soon as they end (see journal.h). @null if there is no journal
+	 */
+	char* journal_path;
+	/**
+	 * @true if the @testcase completed in struct ct_model::journal_path by a previous invocation need to be skipped
+	 */
+	bool resume;
+	/**
+	 * The state of the journal. @null if there is no journal
+	 */
+	struct ct_journal* journal;
+
+	/**
+	 * The address the coordinator serves the @testcase on (see distribution.h). @null if this process is not a coordinator
+	 */
+	char* coordinator_address;
+	/**
+	 * The address of the coordinator this process runs the @testcase for. @null if this process is not a remote worker
+	 */
+	char* worker_address;
+	/**
+	 * The state of the distribution of the @testcase. @null until ::ct_distribute sets it up, or if the @testcase are not distributed
+	 */
+	struct ct_distribution* distribution;
+
+	/**
+	 * The index of the files covered by the @testcase (see coverage.h). @null if the coverage is not used
+	 */
+	char* coverage_index_path;
+	/**
+	 * @true if the coverage of the @testcase needs to be collected into struct ct_model::coverage_index_path
+	 */
+	bool collect_coverage;
+	/**
+	 * The file listing the changed files, used to select the @testcase with struct ct_model::coverage_index_path. @null to run every @testcase
+	 */
+	char* changed_files_path;
+	/**
+	 * The state of the coverage. @null if the coverage is not used
+	 */
+	struct ct_coverage* coverage;
+
+	/**
+	 * The directory where the curves of the benchmarks are written (see benchmark.h). @null if the curves are not written
+	 */
+	char* benchmark_output;
+	/**
+	 * The state of the benchmark running right now. @null if no benchmark is running
+	 */
+	struct ct_benchmark* benchmark;
+	/**
+	 * The CPU the benchmarks are pinned to. -1 if they are not pinned
+	 */
+	int benchmark_cpu;
+	/**
+	 * @true if the benchmarks are measured with a cold cache, @false if with a warm one
+	 */
+	bool benchmark_cold_cache;
+};
+
+/**
+ * Create a model correctly initialized
+ *
+ * @return a setupped model
+ */
+struct ct_model* ct_setup_default_model();
+
+/**
+ * Computes how many processes @crashc can fork to run something in parallel
+ *
+ * @param[in] model the model to handle
+ * @return struct ct_model::workers if positive, the number of online CPUs otherwise. Always at least 1
+ */
+int ct_get_workers_number(const struct ct_model* model);
+
+/**
+ * Computes the key identifying a @testcase in every process running the same tests
+ *
+ * The @testcase need to be passed in the order they are run: the first call for a @testcase counts it among the ones with the same path.
+ *
+ * @param[inout] model the model to handle
+ * @param[in] testcase the section of the @testcase
+ * @return the key of \c testcase, valid until the function is called for another @testcase
+ */
+const struct ct_testcase_key* ct_get_testcase_key(struct ct_model* model, const struct ct_section* testcase);
+
+/**
+ * Runs only a section, its ancestors and its descendants
+ *
+ * Every other section is skipped before any code inside it is run, just like a section excluded by its tags.
+ *
+ * @param[inout] model the model to handle
+ * @param[in] path the descriptions of the section and of its ancestors, starting from the @testcase, separated by ::CT_SECTION_PATH_SEPARATOR.
+ * 	For example <tt>"list/adding on tail/size increments"</tt>
+ */
+void ct_select_section_path(struct ct_model* model, const char* path);
+
+/**
+ * Adds a section just created to struct ct_model::section_index and decides whether it's on the path of the selected section
+ *
+ * \pre
+ * 	\li the parent of \c section has already been indexed
+ *
+ * @param[inout] model the model to handle
+ * @param[inout] section the section to index
+ */
+void ct_index_section(struct ct_model* model, struct ct_section* section);
+
+/**
+ * Fetches a section from its path
+ *
+ * The lookup usually takes constant time: the section tree is walked only if a section with another path but the same hash has been
+ * indexed first. Only sections already created can be found.
+ *
+ * @param[in] model the model to handle
+ * @param[in] path the path of the section. See ::ct_select_section_path
+ * @return the first section created with such path, or @null if there is none
+ */
+struct ct_section* ct_find_section(const struct ct_model* model, const char* path);
+
+/**
+ * Forgets the tests run so far: their reports are destroyed and the section tree is rebuilt from an empty root
+ *
+ * Without it every @testcase run adds a child to the root, so the sections run later take longer to be fetched.
+ * What has been configured in the model, like the registered @testsuite and the tags, is kept.
+ *
+ * \pre
+ * 	\li no section is being run
+ *
+ * @param[inout] model the model to handle
+ */
+void ct_reset_tests(struct ct_model* model);
+
+/**
+ * Destroy every memory allocated by the model
+ *
+ * @param[in] ccm the model to destroy
+ */
+void ct_teardown_default_model(struct ct_model* ccm);
+
+#endif /* MODEL_H_ */
+/**
+ * @file
+ *
+ * Module for handling command line arguments
+ *
+ *
+ * @author koldar
+ * @date Oct 9, 2017
+ */
+
+#ifndef COMMAND_LINE_H_
+#define COMMAND_LINE_H_
+
+#include <stdio.h>
+
+
+
+
+/**
+ * Analyze the command line arguments and populates all the variables involved
+ *
+ * @param[in] argc \c argc from main
+ * @param[in] args \c args from main
+ * @param[in] tag_separator the character used to separate tags in the command line parsing (eg. -I or -E). See \ref tags for further information
+ * @param[inout] model the crashc model. Its tag hashtables must be already initialized: they will be populated at the end of the function
+ */
+void ct_parse_args(const int argc, char* const* args, char tag_separator, struct ct_model* model);
+
+/**
+ * Print the help of the command line
+ *
+ * @param[inout] fout the file where to write the help on
+ */
+void ct_print_help(FILE* fout);
+
+#endif /* COMMAND_LINE_H_ */
+/**
+ * @file
+ *
+ * Module containing functions related to signal handling
+ *
+ * @author noodles
+ * @date Jul 17, 2017
+ */
+
+#ifndef SIG_HANDLING_H_
+#define SIG_HANDLING_H_
+
+#include <signal.h>
+#include <setjmp.h>
+
+
+
+
+/**
+ * Used by longjmp, no special meaning at the moment
+ */
+#ifdef CT_SIGNAL_JUMP_CODE
+#	error "CrashC - CT_SIGNAL_JUMP_CODE macro already defined!"
+#endif
+#define CT_SIGNAL_JUMP_CODE 1
+
+/**
+ * Used by struct ct_model::_crashc_sigaction to indicate an empty bitmask
+ */
+#ifdef CT_NO_FLAGS
+#	error "CrashC - CT_NO_FLAGS macro already defined!"
+#endif
+#define CT_NO_FLAGS 0
+
+/**
+ * The size, in bytes, of the alternate stack used to handle fatal signals
+ *
+ * The stack needs to be big enough to run the signal handler of @crashc. Enlarge it if you happen to
+ * customize what happens when a signal is detected.
+ */
+#ifndef CT_SIGNAL_STACK_SIZE
+#	define CT_SIGNAL_STACK_SIZE 65536
+#endif
+
+/**
+ * Registers all the signal @crashc test framework wants to handle
+ *
+ * The handled signals are \c SIGSEGV, \c SIGBUS, \c SIGILL, \c SIGABRT and \c SIGFPE. The handler runs on an alternate signal stack
+ * (see struct ct_model::signal_stack), hence even a stack overflow within the code under test is detected.
+ *
+ * \note
+ * If the program under test has already installed a handler for one of such signals, @crashc won't override it.
+ *
+ * \post
+ * 	\li struct ct_model::_crashc_sigaction manages all signals the program under test doesn't handle by itself
+ */
+void ct_register_signal_handlers();
+
+/**
+ * Restores the signal actions which were present before calling ::ct_register_signal_handlers
+ *
+ * \post
+ * 	\li the alternate signal stack is not used anymore
+ */
+void ct_unregister_signal_handlers();
+
+#endif
+/**
+ * @file
+ *
+ * Contains the definitions used by @crashc to handle the test reports
+ *
+ * @author koldar
+ * @date Feb 16, 2017
+ *
+ */
+
+#ifndef TEST_REPORT_H_
+#define TEST_REPORT_H_
+
+#include <string.h>
+#include <stdlib.h>
+
+
+
+
+
+
+
+/**
+ * Represents the possible outcomes of a single test:
+ */
+enum ct_test_outcome {
+	/**
+	 * A test passed
+	 *
+	 * @definition Passed Test
+	 * It's a **test** containing no failed assertions
+	 */
+	CT_TEST_SUCCESS,
+	/**
+	 * A test didn't pass
+	 *
+	 * @definition Failed Test
+	 * It's a **test** which is not a **passed test**.
+	 */
+	CT_TEST_FAILURE,
+};
+
+/**
+ * Represents the actual test report.
+ *
+ * It contains all the informations regarding the status of an executed test.
+ * Note that @crashc considers a test to be a single flow of execution of a ::CT_LOOPER (i.e. A single iteration of a @testcase)
+ * E.g:
+ * Let's suppose we have this @testcase:
+ *
+ * @code
+ * TESTCASE("...", "...") {
+ *     WHEN("outer when", "") {
+ *         WHEN("inner when 1", "") {
+ *             ...some code...
+ *         }
+ *         WHEN("inner when 2", "") {
+ *             ...other code...
+ *         }
+ *     THEN("then", "") {
+ *         ...then code...
+ *     }
+ * }
+ * @endcode
+ *
+ * The flow of execution of this @testcase would be:
+ * -# inner when 1 -> then
+ * -# inner when 2 -> then
+ *
+ * These are what @crashc considers to be tests.
+ * This implies that the informations stored in the ct_test_report struct are related to the flow of execution, not to a given section.
+ * This is the reason why the ct_test_report struct needs an auxiliary struct, ::ct_snapshot, to hold the information on the status of
+ * the sections involved in the test at the moment they were executed.
+ */
+struct ct_test_report {
+	/**
+	 * The name of the file that contained this test
+	 *
+	 * @notnull
+	 */
+	char* filename;
+	/**
+	 * The snapshot of the testcase that contained this test.
+	 * This is actually the root of a tree which contains the section path followed by the test
+	 *
+	 *
+	 * @notnull
+	 */
+	 struct ct_snapshot* testcase_snapshot;
+	 /**
+	  * The outcome of the test.
+	  */
+	 enum ct_test_outcome outcome;
+	/**
+	 * The time, in microseconds, that it took to complete the test, even if it has been interrupted
+	 *
+	 * Note that execution times might be higher than expected due to the necessary
+	 * overhead introduced by the internal code created by @crashc to properly
+	 * guide the tests' execution flow
+	 */
+	long execution_time;
+	/**
+	 * The file containing the input of the ::FUZZ_TESTCASE this test belongs to
+	 *
+	 * @null if the test doesn't belong to a ::FUZZ_TESTCASE or its input doesn't come from a file
+	 */
+	char* fuzz_input;
+	/**
+	 * The repetition which generated this test, starting from 0. See flaky.h
+	 */
+	int repetition;
+	/**
+	 * The index, in struct ct_model::tests_array, of the @testsuite which generated this test. See suite_order.h
+	 */
+	int suite;
+	/**
+	 * The report of the same test generated by the next repetition. @null if this is the last repetition of the test
+	 */
+	struct ct_test_report* next_repetition;
+	/**
+	 * How the test behaved across all its repetitions
+	 *
+	 * Available only in the report of the first repetition of a test, and only if the tests have been repeated; @null otherwise
+	 */
+	struct ct_flakiness* flakiness;
+	/**
+	 * What the test has written on the standard output and on the standard error (see output_capture.h)
+	 *
+	 * Available only if the test has failed and the output has been captured; @null otherwise
+	 */
+	char* output;
+};
+
+/**
+ * create in memory a new test report
+ *
+ * \note
+ * the test report created is assumed to have state ::CT_TEST_SUCCESS
+ *
+ * @param[in] tc_snapshot the snapshot tree associated to the test report
+ * @return the test report desired;
+ */
+struct ct_test_report* ct_init_test_report(struct ct_snapshot* tc_snapshot);
+/**
+ * release from the memory a struct ct_test_report
+ *
+ * @param[inout] report the report to dispose of. @notnull
+ */
+void ct_destroy_test_report(struct ct_test_report* report);
+
+//TODO why the init section snapshot is defined here while the struct is defined in section.h?
+/**
+ * Initialize in the heap a new section snapshot
+ *
+ * @param[in] section the section represented by the ::ct_snapshot you want to build
+ * @return the requested ::ct_snapshot
+ */
+struct ct_snapshot* ct_init_section_snapshot(struct ct_section* section);
+/**
+ * Release from memory a section snapshot
+ *
+ * @param[inout] snapshot the snapshot to remove from the memory
+ */
+void ct_destroy_snapshot_tree(struct ct_snapshot* snapshot);
+
+/**
+ * Adds the given section to the section tree
+ *
+ * \note
+ * It also automatically reorganize the tree's children
+ *
+ * @param[in] to_add snapshot to add
+ * @param[inout] tree root of the snapshot tree to rearrange
+ * @return \c to_add value
+ */
+struct ct_snapshot* ct_add_snapshot_to_tree(struct ct_snapshot* to_add, struct ct_snapshot* tree);
+
+/**
+ * Attaches to a snapshot the backtrace captured when a fatal signal has been detected
+ *
+ * \note
+ * The frames are copied, hence \c frames can be safely reused after the call
+ *
+ * @param[inout] snapshot the snapshot where the signal has been raised
+ * @param[in] frames the return addresses of the stack frames
+ * @param[in] frames_number the number of cells in \c frames
+ */
+void ct_snapshot_set_backtrace(struct ct_snapshot* snapshot, void* const* frames, int frames_number);
+
+/**
+ * Checks the status of the section associated to a given snapshot in order to change coherently the status of the snapshot.
+ *
+ * This is needed due to the fact
+ * that every snapshot is created when entering at the beginning of the section and by default
+ * is set as ::CT_SNAPSHOT_OK, so it discovers if any error occourred only at the end, by checking the section status.
+ *
+ * @param[in] section to status to check
+ * @param[inout] snapshot whose status we need to alter
+ */
+void ct_update_snapshot_status(struct ct_section* section, struct ct_snapshot* snapshot);
+
+/**
+ * Checks the status of the last executed snapshot in the test tree and sets the status of the test as needed
+ *
+ * @param[inout] report the report to update
+ * @param[in] last_snapshot the snapshot whose result we need to integrate to \c report
+ */
+void ct_update_test_outcome(struct ct_test_report* report, struct ct_snapshot* last_snapshot);
+
+#endif /* TEST_REPORT_H_ */
+/**
+ * @file
+ *
+ * Represents a entity which produces a report summarizing the test outcomes for the user
+ *
+ * An example of a report producer is the entity which prints the outcomes of the tests in a file
+ *
+ * @date Oct 27, 2017
+ * @author Lorenzo Nodari <lorenzo.nodari.it@ieee.org>
+ */
+
+#ifndef REPORT_PRODUCER_H_
+#define REPORT_PRODUCER_H_
+
+#include <stdio.h>
+
+
+
+
+
+
+
+/**
+ * Struct used to contain the statistics used by @crashc to give the user additional info on the run tests
+ */
+struct ct_test_stats {
+	/**
+	 * The number of total tests @crashc have detected
+	 *
+	 * @definition Test
+	 * It's is a single loop of a @testcase
+	 */
+	unsigned int total_tests;
+	/**
+	 * The number of passed tests
+	 *
+	 */
+	unsigned int successful_tests;
+	/**
+	 * The number of  failed tests
+	 *
+	 */
+	unsigned int failed_tests;
+	/**
+	 * The number of flaky tests. Computed only when the tests are repeated: see flaky.h
+	 */
+	unsigned int flaky_tests;
+};
+
+/**
+ * Contains function pointers to the implementations of the function used to produce the report of the particular parts of the tests.
+ *
+ * @definition Report Producer
+ * It's an entity which, given a in-memory representation of the outcome of the tests just performed by @crashc,
+ * generates an output (e.g. json, xml, sql db) which nicely summarizes the outcomes of the tests.
+ *
+ * This allows for easy customization and high code maintainability. Use this struct to generate your custom test reporter.
+ * For example, one may want to create a test reporter which save its data ina mysqlite database.
+ *
+ * The reporters of the optional parts of a snapshot (backtrace, resource usage, performance, stress, flakiness and benchmark) can be @null:
+ * such parts are simply not reported.
+ */
+struct ct_report_producer {
+
+	ct_test_reporter_c test_reporter;
+
+	ct_snapshot_tree_reporter_c snapshot_tree_reporter;
+
+	ct_summary_reporter_c summary_producer;
+
+	ct_assert_reporter_c assert_reporter;
+
+	ct_backtrace_reporter_c backtrace_reporter;
+
+	ct_resource_usage_reporter_c resource_usage_reporter;
+
+	ct_performance_reporter_c performance_reporter;
+
+	ct_stress_reporter_c stress_reporter;
+
+	ct_benchmark_reporter_c benchmark_reporter;
+
+	ct_flakiness_reporter_c flakiness_reporter;
+
+	ct_reporter_c report_producer;
+
+};
+
+/**
+ * Prints the string representation of a ::ct_snapshot_status
+ *
+ * @param[in] status the status to compute the string representation of
+ * @return a string representation of \c status
+ */
+char* ct_snapshot_status_to_string(enum ct_snapshot_status status);
+
+/**
+ * Prints the string representation of a ::ct_section_type
+ *
+ * @param[in] type the type to compute the string representation of
+ * @return a string representation of \c type
+ */
+char* ct_section_type_to_string(enum ct_section_type type);
+
+//TODO in my opinion these functiosn should be placed in another header called like "default_report_producer.h"
+
+/**
+ * @addtogroup defaultReportProducer Default Report Producer
+ * @brief a struct ct_report_producer which print the summary of @crashc test outcomes in a file by writing the test correctly indented
+ * @{
+ */
+
+/**
+ * Prints the report of the executed tests in a default format
+ *
+ * \note
+ * The report will be printed in the file specified by struct ct_model::output_file
+ *
+ * @param[inout] model the model to handle
+ */
+void ct_default_report(struct ct_model* model);
+/**
+ * Prints the tests summary in a default format
+ *
+ * \note
+ * The report will be printed in the file specified by struct ct_model::output_file
+ *
+ * @param[inout] model the model to handle
+ */
+void ct_default_report_summary(struct ct_model* model);
+
+/**
+ * Prints a the report of a single test with a default format
+ *
+ * \note
+ * The report will be printed in the file specified by struct ct_model::output_file
+ *
+ * @param[inout] model the model to handle
+ * @param[inout] report the test report to put in the file
+ */
+void ct_default_test_report(struct ct_model* model, struct ct_test_report* report);
+
+/**
+ * Prints a representation of a snapshot tree in a default format
+ *
+ * \note
+ * The report will be printed in the file specified by struct ct_model::output_file
+ *
+ * @param[inout] model the model to manage
+ * @param[inout] snapshot the snapshot to write into the file
+ * @param[in] level the depth level \c snapshot is in the snapshot tree
+ */
+void ct_default_snapshot_tree_report(struct ct_model* model, struct ct_snapshot* snapshot, int level);
+
+/**
+ * Prints a default report for the assertions related to a specific snapshot
+ *
+ * \note
+ * The report will be printed in the file specified by struct ct_model::output_file
+ *
+ * @param[inout] model the model to manage
+ * @param[inout] snapshot the snapshot to write into the file
+ * @param[in] level the depth level \c snapshot is in the snapshot tree
+ *
+ */
+void ct_default_assertions_report(struct ct_model* model, struct ct_snapshot* snapshot, int level);
+
+/**
+ * Prints the backtrace captured when a snapshot raised a signal, one frame per line
+ *
+ * Frames are resolved into symbols only here, when the report is produced. Link the test executable with \c -rdynamic
+ * to get the names of the functions instead of just their offsets.
+ *
+ * \note
+ * The report will be printed in the file specified by struct ct_model::output_file
+ *
+ * @param[inout] model the model to manage
+ * @param[inout] snapshot the snapshot whose backtrace we need to write into the file
+ * @param[in] level the depth level \c snapshot is in the snapshot tree
+ */
+void ct_default_backtrace_report(struct ct_model* model, struct ct_snapshot* snapshot, int level);
+
+/**
+ * Prints the operating system resources a snapshot has consumed in a single line
+ *
+ * Nothing is printed if the resources of the snapshot have not been measured, either because struct ct_model::measure_resources is @false
+ * or because the test has been interrupted by a signal.
+ *
+ * \note
+ * The report will be printed in the file specified by struct ct_model::output_file
+ *
+ * @param[inout] model the model to manage
+ * @param[inout] snapshot the snapshot whose resource usage we need to write into the file
+ * @param[in] level the depth level \c snapshot is in the snapshot tree
+ */
+void ct_default_resource_usage_report(struct ct_model* model, struct ct_snapshot* snapshot, int level);
+
+/**
+ * Prints the elapsed time of a snapshot, followed by the hardware events which happened in it, in a single line
+ *
+ * Counters which were not available are omitted. Nothing is printed if the hardware counters have not been requested (see struct ct_model::hardware_counters)
+ * or if the snapshot has not been measured.
+ *
+ * \note
+ * The report will be printed in the file specified by struct ct_model::output_file
+ *
+ * @param[inout] model the model to manage
+ * @param[inout] snapshot the snapshot whose measurements we need to write into the file
+ * @param[in] level the depth level \c snapshot is in the snapshot tree
+ */
+void ct_default_performance_report(struct ct_model* model, struct ct_snapshot* snapshot, int level);
+
+/**
+ * Prints the measurements of the stress test a snapshot has run
+ *
+ * The first line shows the tail latency of an iteration; then there is a line for each thread, showing its throughput.
+ * Nothing is printed if the snapshot has not run a stress test.
+ *
+ * \note
+ * The report will be printed in the file specified by struct ct_model::output_file
+ *
+ * @param[inout] model the model to manage
+ * @param[inout] snapshot the snapshot whose stress test we need to write into the file
+ * @param[in] level the depth level \c snapshot is in the snapshot tree
+ */
+void ct_default_stress_report(struct ct_model* model, struct ct_snapshot* snapshot, int level);
+
+/**
+ * Prints the measurements of the benchmark a snapshot has run
+ *
+ * The first line shows the complexity class fitting the times best and how the environment has been controlled; then there is a line
+ * for each value of the parameter, showing its time with the confidence interval.
+ * Nothing is printed if the snapshot has not run a benchmark.
+ *
+ * \note
+ * The report will be printed in the file specified by struct ct_model::output_file
+ *
+ * @param[inout] model the model to manage
+ * @param[inout] snapshot the snapshot whose benchmark we need to write into the file
+ * @param[in] level the depth level \c snapshot is in the snapshot tree
+ */
+void ct_default_benchmark_report(struct ct_model* model, struct ct_snapshot* snapshot, int level);
+
+/**
+ * Prints, in a single line, which repetition generated a test and, for the first repetition, how the test behaved across all of them
+ *
+ * Nothing is printed if the tests have not been repeated.
+ *
+ * \note
+ * The report will be printed in the file specified by struct ct_model::output_file
+ *
+ * @param[inout] model the model to manage
+ * @param[inout] report the report of a repetition of the test
+ */
+void ct_default_flakiness_report(struct ct_model* model, struct ct_test_report* report);
+
+///@}
+
+/**
+ * Counts the successful and the failed tests inside struct ct_model::test_reports_list
+ *
+ * The counts are stored inside struct ct_model::statistics. Every report producer should call it before producing the summary.
+ *
+ * @param[inout] model the model to handle
+ */
+void ct_update_test_stats(struct ct_model* model);
+
+/**
+ * Creates a new initialized structure in the heap
+ *
+ * @return a structure containing the statistics data related to the tests
+ */
+struct ct_test_stats* ct_init_stats();
+
+/**
+ * Creates and initializes in memory a new default report producer structure
+ *
+ * @return a structure representing a naive report producer
+ */
+struct ct_report_producer* ct_init_default_report_producer();
+
+/**
+ * Frees the memory occupied by a struct ct_test_stats
+ *
+ * @param[inout] stats the structure to dispose from the memory
+ */
+void ct_destroy_stats(struct ct_test_stats* stats);
+
+/**
+ * Frees the memory allocated for the default report producer
+ *
+ * @param[inout] producer the structure to dispose from the mermory
+ */
+void ct_destroy_default_report_producer(struct ct_report_producer* producer);
+
+#endif /* REPORT_PRODUCER_H_ */
+/**
+ * @file
+ *
+ * The module where @crashc assertions API are defined
+ *
+ * Asserts are the base foundation of every unit testing
+ *
+ * @author noodles
+ * @date Nov 15, 2017
+ */
+
+#ifndef CT_ASSERT_H_
+#define CT_ASSERT_H_
+
+#include <stdbool.h>
+#include <stdlib.h>
+
+
+
+
+//TODO create an enum for these codes. It's better to centralized similar magic numbers into enums imho
+/**
+ * Magic number to pass to \c siglongjmp code when jumping back to the start of a testcase due to a failed assertion
+ *
+ * This macro represents the integer code passed to the siglongjmp code when jumping back to the start of
+ * a testcase due to a failed assertion. This lets us distinguish when we do this due to a signal or due to
+ * an assertion ad thus let us handle the two cases differently.
+ */
+#ifdef CT_ASSERT_JUMP_CODE
+#	error "CrashC - CT_ASSERT_JUMP_CODE already defined!"
+#endif
+#define CT_ASSERT_JUMP_CODE 2
+
+/**
+ * This struct contains the informations related to a specific assertion
+ */
+struct ct_assert_report{
+
+	/**
+	 *  The outcome of the assertion. True if succeded
+	 */
+	bool passed;
+
+	/**
+	 * Whenever this assertion is mandatory or not
+	 *
+	 * Mandatory assertions will cause a test abortion on failure, non-mandatory assertions
+	 * will simply register the failure and continue the test
+	 */
+	bool is_mandatory;
+
+	/**
+	 * String containing the text of the assertion, useful for reporting
+	 */
+	char* asserted;
+
+	/**
+	 * Pointer to the value expected to have from the assertion.
+	 *
+	 * This is a void* in order to be able to handle any type of data, even custom ones
+	 */
+	void* expected_value;
+
+	/**
+	 * A string containing the textual representation of the expected_value.
+	 */
+	char* expected_str;
+
+	/**
+	 * Pointer to the value obtained from the function to test.
+	 *
+	 * This is a void* in order to be able to handle any type of data, even custom ones
+	 */
+	void* actual_value;
+
+	/**
+	 * String representation of the actual_value assumed by the assertion
+	 */
+	char* actual_str;
+
+	/**
+	 * Pointer to a string containing the file name in which the assertion was
+	 */
+	char* file_name;
+
+	/**
+	 * The line number on which the assertion was located in the source code
+	 */
+	unsigned int line_number;
+
+};
+
+/**
+ * function prototype for function comparing elements
+ *
+ * This type represents a comparator function, used by sophisticated versions of assertions to compare arbitraty types, like user defined structures
+ *
+ * @param[in] elem1 the first element to compare
+ * @param[in] elem2 the second element to compare
+ * @return
+ * 	\li -1 when \c elem1 is "lesser" than \c elem2
+ *  \li 0 when \c elem1 is equal to \c elem2
+ *  \li +1 when \c elem1 is "greater" to \c elem2
+ *
+ * UNUSED AT THE MOMENT
+ */
+//typedef int (*ct_comparator_c)(void* elem1, void* elem2);
+
+/**
+ * function prototype for functions computing string representation of elements
+ *
+ * This type represents a stringer function, used by sophisticated versions of assertions to create strings representing the type of data on which the assertion
+ * is being made, for example user-defined structures.
+ * Note that the strings returned by the function are expected to be malloc'd, as he test report destructor will try to free them
+ * It is possible that in future versions of the framework, the destructor will be parametrized
+ *
+ * @param[in] elem the elements which we want to obtain a string representation of
+ *
+ * UNUSED AT THE MOMENT
+ */
+//TODO I think the best prototype for this function pointer would be int(void* element, int buffer size, char* buffer) where the return value is the number of byte you used in the buffer.
+//typedef void (*ct_stringer_c)(void* elem);
+
+/**
+ * Represents the function pointers used as callbacks to handle the behaviour of an assertion implementation.
+ * The 3 parameters are:
+ * @param[in] model the @crashc model being used
+ */
+/*
+ * - type_size: the size, in bytes, of the type on which the assertion is being made. This is needed as once the original pointer is cast to void *, its real type cannot be
+ * 				recovered anymore, so we need this to do some boundaries check
+ * - asserted: pointer to the asserted variable/value
+ * - stringer: the stringer to be used to convert raw bytes into a string
+ */
+typedef void (*ct_assert_c)(struct ct_model* model);
+
+
+/**
+ * The general CrashC assertion macro
+ *
+ * This macro is not used directly, but it is masked by other macros which actually implement
+ * a specific assertion type.
+ *
+ * The assertion can be used by any thread: see thread_context.h for the behaviour on worker threads.
+ *
+ * @param[in] model a pointer to struct ct_model used
+ * @param[in] is_mandatory @true if the assertion needs to be surpassed; @false if the assertion is actually optional
+ * @param[in] asserted C code representing the whole content of the assertion. This is likely to be something like <tt>someStuff == someOtherStuff</tt>.
+ * 	The code is **required** to be a boolean expression.
+ * @param[in] passed_callback function of type ct_assert_c called if the assertion passes;
+ * @param[in] failed_callback function of type ct_assert_c called if the assertion doesn't pass;
+ */
+#ifdef CT_ASSERTION
+#	error "CrashC - CT_ASSERTION already defined!"
+#endif
+#define CT_ASSERTION(model, is_mandatory, asserted, passed_callback, failed_callback)														\
+	ct_register_assert_report((model), is_mandatory, #asserted, __FILE__, __LINE__);															\
+	if ((asserted) != true) {																												\
+		failed_callback((model));																											\
+	}																																		\
+	else {																																	\
+		passed_callback((model));																											\
+	}																																		\
+	ct_complete_assert_report((model))
+
+//TODO complete the documentation here
+/**
+ * This macro is the basic form of a CrashC assertion.
+ *
+ * @param[in] assertion a C code reprsenting the assertion to express. The code is **required** to be a boolean expression.
+ */
+#ifdef ASSERT
+#	error "CrashC - ASSERT macro already defined!"
+#endif
+#define ASSERT(assertion) CT_ASSERTION(ct_model, true, assertion, ct_assert_do_nothing, ct_general_assert_failed)
+
+/**
+ * Initializes an assertion report and returns a pointer to it.
+ *
+ * \note
+ * \c expected_value, \c actual_value, \c expected_stringed and \c actual_stringed all default to @null: their initialization is demanded to the caller in a later moment
+ *
+ * @param[in] is_mandatory @true if the assertion needs to be surpassed; @false if the assertion is actually optional
+ * @param[in] asserted_text a string representing the actual C code of assertion
+ * @param[in] file a string representing the file where the assertion is positioned
+ * @param[in] line the line number where the assertion is located in the file \c file
+ * @return a structure representing the performance of a given assertion
+ */
+struct ct_assert_report* ct_init_assert_report(bool is_mandatory, char* asserted_text, char* file, unsigned int line);
+
+/**
+ * Creates a new assertion report and makes it the current assertion report of the calling thread
+ *
+ * On the main thread the report is immediately appended to the ones of struct ct_model::current_snapshot; on worker threads
+ * the report is published only when it's complete (see ::ct_complete_assert_report).
+ *
+ * \note
+ * The memory allocated here belongs to @crashc, hence it is never accounted to the code under test
+ *
+ * @param[inout] model the model to handle
+ * @param[in] is_mandatory @true if the assertion needs to be surpassed; @false if the assertion is actually optional
+ * @param[in] asserted_text a string representing the actual C code of assertion
+ * @param[in] file a string representing the file where the assertion is positioned
+ * @param[in] line the line number where the assertion is located in the file \c file
+ */
+void ct_register_assert_report(struct ct_model* model, bool is_mandatory, char* asserted_text, char* file, unsigned int line);
+
+/**
+ * Tells @crashc the current assertion report of the calling thread won't be changed anymore
+ *
+ * On worker threads, the report is published to the main thread. See thread_context.h
+ *
+ * @param[inout] model the model to handle
+ */
+void ct_complete_assert_report(struct ct_model* model);
+
+/**
+ * Frees the memory allocated for a particular assertion report
+ *
+ * @param[in] report the report to release from the memory
+ */
+void ct_destroy_assert_report(struct ct_assert_report* report);
+
+/**
+ * @defgroup assertCallbacks Assert Outcome Callbacks
+ * @brief represents a group of callbacks designed to be passed to ::CT_ASSERTION macro
+ * @{
+ */
+
+/**
+ * Function used as a callback when an assertion doesn't need to do anything
+ *
+ * @param[in] model the model to handle
+ */
+void ct_assert_do_nothing(struct ct_model* model);
+
+/**
+ * Function used by the general ASSERT macro to handle its failure
+ *
+ * On the main thread the function jumps back to the start of the running @testcase; on a worker thread it terminates the calling thread.
+ *
+ * @param[in] model the model to handle
+ */
+void ct_general_assert_failed(struct ct_model* model);
+
+///@}
+
+#endif /* CT_ASSERT_H_ */
+/**
+ * @file
+ *
+ * Represents the main file of the framework
+ *
+ * The file contains all the main macro definition used to provide crashC features to the developer
+ *
+ * TEST CASE
+ * ---------
+ *
+ * Test cases are particularly important sections: they serve as entry points for all our tests. They need:
+ * 	\li a cycle: if there multiple WHEN clauses, we need to rerun their body until all the when clauses are run. This requires a cycle;
+ * 	\li a function definition: test cases are not defined inside the main, so the only alternative is that they are functions. Why they can't be inside the main?
+ * 		Because otherwise we would need to have "}" at the end of all the test cases. But with macro programming you can't simply do that (we may tell the user
+ * 		to write the "}" by himself, but that would add boilerplate code to the test case, code that we do not want to add.
+ *
+ * Ok, how can we add a function definition that compiles? Remember: you can't add anything after you put the "{ ... }" of the test case.
+ * The idea is simple: the test is a function and the "{ ... }" is its body. However in this way we can't have the cycle, cycle that we need to deal
+ * with the when clauses. The solution is to have for every test, <b>2 functions</b>: "{...}" is  the body of the second function whilst the first function
+ * is defined before the second one, like this:
+ *
+ * @code
+ *
+ * TESTCASE ("tc1", "important") {
+ * 	//our beatiful tests
+ * }
+ *
+ * //this becomes
+ *
+ * void test_1a() {
+ * 	CT_LOOPER(...) {
+ * 		test_1b();
+ * 	}
+ * }
+ *
+ * void test_1b() {
+ * 	//our beatiful tests
+ * }
+ *
+ * @endcode
+ */
+
+#ifndef CRASHC_H_
+#define CRASHC_H_
+
+#include <stdbool.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdio.h>
+#include <stdint.h>
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+/**
+ * Callback type of a function representing a general condition that determine if we can access to a particular @containablesection source code
+ *
+ * @param[inout] model the global struct ct_model crashC model you manage
+ * @param[in] section the section representing the @containablesection you want to access
+ * @return
+ * 	\li @true whenever the testing framework decided that the code can enter in the @containablesection source code;
+ * 	\li @false otherwise.
+ */
+typedef bool (*ct_access_c)(struct ct_model* model, struct ct_section*);
+
+/**
+ * Callback signature representing a callback to execute as soon as you **exit** from the @containablesection source code
+ *
+ * For example, suppose the following. Suppose you have exited from \c WHEN. The struct ct_model::current_section variable needs to be
+ * reset from \c WHEN to its parent, namely \c TESTCASE. The function prototype allows you to code that
+ *
+ * @code
+ * 	TESTCASE("","") {
+ * 		WHEN("","") {
+ * 		}
+ * 	}
+ * @endcode
+ *
+ * @param[inout] model the global struct ct_model crashC model you manage
+ * @param[inout] parent_position a pointer **you** need to set to the parent of the section representing the @containablesection
+ * @param[in] child the section representing the @containablesection you'have just exit from.
+ */
+typedef void (*ct_exit_c)(struct ct_model* model, struct ct_section** parent_position, struct ct_section* child);
+
+/**
+ * Callback prototype for any function executing addtional code before entering in a @containablesection
+ *
+ * For example, asume you are in \c TESTCASE and assume the framework gave you access to \c WHEN @containablesection.
+ * Before actually enter in the section, you might want to perform additional code. The prototype has been specified for this very reason
+ * @code
+ * 	TESTCASE("","") {
+ * 		WHEN("","") {
+ * 		}
+ * 	}
+ * @endcode
+ *
+ * @param[inout] model the global struct ct_model crashC model you manage
+ * @param[in] section the section representing the @containablesection you're going to access (hence the child).
+ */
+typedef void (*ct_enter_c)(struct ct_model* model, struct ct_section* section);
+
+/**
+ * Register a new @testsuite in the @crashc ecosystem
+ *
+ * C language doesn't have anything allowing you to fetch all defined functions within a file or a group of file (something like
+ * Java's annotation or Python introspection). So, in order to detect all the suite the tests defined, one need to manually
+ * register them in a data structure (like an array).
+ *
+ * This function goal is precisely this: it allows you to register a @testsuite within @crashc framework.
+ *
+ * TODO: Add control on duplicates testsuites
+ *
+ * \post
+ * 	\li \c func added in the register
+ *
+ * @param[inout] model the model where we operate on
+ * @param[in] func the function to register
+ * @param[in] name the id of the @testsuite, as passed to ::REG_SUITE
+ */
+void ct_update_test_array(struct ct_model* model, ct_test_c func, const char* name);
+
+/**
+ * Function to concretely perform the **access cycle**
+ *
+ * @param[inout] model the model containing all the data representing the automatic testing
+ * @param[in] section the section we want to access in
+ * @param[in] cs the condition we need to satisfy in order to access the section
+ * @param[in] callback the code to execute if the system grant us access to the section. Note that in this way the code is called \b before entering in the section
+ * @param[in] run_tags an hash table containing all the tags allowed. If a section does not have a tag inside this set, it won't be run
+ * @param[in] exclude_tags an hash table containing all the tags prohibited. If a section has at least one tag inside this set, it won't be run
+ * @return
+ * 	\li @true if the section has to be visited;
+ * 	\li @false otherwise;
+ */
+static inline bool ct_run_once_check_access(struct ct_model* model, struct ct_section* section, ct_access_c cs, ct_enter_c callback, const ct_tag_hashtable_o* restrict run_tags, const ct_tag_hashtable_o* restrict exclude_tags) {
+	if (!section->loop2) {
+		return false;
+	}
+
+	//a section out of the path of the selected section is skipped without looking at its tags
+	if (!section->on_target_path) {
+		section->tag_access_granted = false;
+		section->access_granted = false;
+		ct_section_set_skipped(section);
+		return false;
+	}
+
+	//check if the section we're dealing with is compliant with the context tags
+	if (!ct_ht_is_empty(exclude_tags)) {
+		if (ct_have_tag_set_intersection(section->tags, exclude_tags)) {
+			section->tag_access_granted = false;
+			section->access_granted = false;
+			ct_section_set_skipped(section);
+			return false;
+		}
+	}
+
+	if (!ct_ht_is_empty(run_tags)) {
+		if (!ct_have_tag_set_intersection(section->tags, run_tags)) {
+			section->tag_access_granted = false;
+			section->access_granted = false;
+			ct_section_set_skipped(section);
+			return false;
+		}
+	}
+	section->tag_access_granted = true;
+
+	//cs and callback are constant in every containable section macro, so once this function is inlined they are inlined as well
+	section->access_granted = cs(model, section);
+	if (section->access_granted) {
+		callback(model, section);
+		if (CT_HAS_LISTENERS(model, CT_EVENT_SECTION_ENTER)) {
+			ct_dispatch_section_enter(model, section);
+		}
+	}
+	return section->access_granted;
+}
+/**
+ * Function supposed to run in the **parent switcher** cycle
+ *
+ * @param[inout] model the model containing all the data representing the automatic testing
+ * @param[in] section the section we want to fetch the associated parent from
+ * @param[in] pointer_to_set_as_parent a pointer that we has to set to <tt>section->parent</tt> in this call. <b>This has to be done by exactly one of the callbacks</b>
+ * @param[in] callback function **always called after we have check the access** to the section: if we have access, this function is called **after** we entered inside the section source code
+ * @param[in] access_granted_callback function called \b afrer \c callback if the software has entered in the section source code
+ * @param[in] access_denied_callback function called \b afrer \c callback if the software hasn't entered in the section source code
+ * @return
+ *	\li @true if this is the first iteration of the **parent switcher** cycle.
+ *	\li @false if this si the second iteration of the  **parent switcher cycle.
+ */
+bool ct_run_once_final_work(struct ct_model* model, struct ct_section* section, struct ct_section** pointer_to_set_as_parent, ct_exit_c callback, ct_exit_c access_granted_callback, ct_exit_c access_denied_callback);
+
+/**
+ * Fetches the section representing a particular @containablesection. If not present, it creates it.
+ *
+ * @code
+ * 	TESTCASE("","") {
+ * 		WHEN("a","") {
+ * 		}
+ * 		WHEN("b","") {
+ * 		}
+ * 	}
+ * @endcode
+ * For example, this function creates the section representing the @containablesection @when "a" if there is no section inside the section tree
+ * of @testcase representing it; otherwise, it just fetches such struct ct_section.
+ *
+ * \post
+ * 	\li a ::ct_section representing the given @containablesection now exists within the section tree.
+ *
+ * @param[in] parent the section containing the one we're creating. For example if we're in the test code of @testcase and we see a @when clause
+ * 				this attribute is set to the metadata representing @testcase.
+ * @param[in] type the kind of section to fetch
+ * @param[in] description a brief string explaining what this section is and does
+ * @param[inout] site the site of the @containablesection. It's prepared the first time a section is created out of it
+ * @param[in] tags a list of tags. See \ref tags for further information. Only read when \c site is prepared, so it has to be the same every time the @containablesection is reached
+ * @return
+ * 	\li a newly created section if we're still computing the children of \c parent
+ * 	\li the struct ct_section::current_child -th child of \c parent otherwise
+ */
+struct ct_section* ct_fetch_section(struct ct_section* parent, enum ct_section_type type, const char* description, struct ct_section_site* site, const char* tags);
+
+/**
+ * Reset the struct ct_model::current_section global variable to the given one after we have detected a signal
+ *
+ * Sometimes it happens that we need to abruptly break the flow of struct ct_model::current_section.
+ * For example when we detect an unhandled signal in one of the sections, we don't need to return to the parent of the section involved,
+ * but we need to immediately go to the @testcase.
+ *
+ * This function allows you to set all the metadata to ensure that such "unorthodox" flow is valid.
+ *
+ * \post
+ * 	\li struct ct_model::current_section is valid and refers to \c testcase_section
+ *
+ * @param[inout] model the model containing all the data representing the automatic testing
+ * @param[in] jump_source_section the section where a signal has been raised
+ * @param[in] testcase_section the section representing a test case we need to reset the struct ct_model:current_section to
+ */
+void ct_reset_section_after_jump(struct ct_model* model, struct ct_section* const jump_source_section, struct ct_section* const testcase_section);
+
+///@defgroup accessConditions Access Condition Functions
+///@brief Functions that can be used as ::ct_access_c concrete values.
+///Use these functions to develop new @containablesection. These group of functions defines the pool of ::ct_access_c you can use
+///to create new @containablesection s.
+///@{
+
+
+/**
+ * We give access to a @when only if it's the first @when we're giving access to in the current level of the section tree
+ *
+ * We use this function to check whether or not we need to enter in the given WHEN section.
+ * You gain the access to a @when if:
+ *
+ * \li the @when has not been fully visited;
+ * \li given the parent @containablesection, it's the first @when you can access to;
+ *
+ * To clarify, consider the following situation:
+ *
+ * @dotfile accessWhen
+ *
+ * -# At first you enter in @when 1, then you enter in @when 1,1. After that you avoid both @when 1,2 and @when 1,3 because in the current
+ * @testcase cycle, you've already accessed to a @when within the @containablesection called @when 1. The same can be said for @when 2:
+ * in the current @testcase cycle, you've already accessed to a @when within the @containablesection called @testcase.
+ * -# In the second @testcase cycle, you still enter in @when 1 but, since @when 1,1 has already been visited, you gain the access to @when 1,2.
+ * Again, you avoid entering in @when 1,3 since you've already gained access to a @when in the same level (namely @when 1,2). @when 2 follows the
+ * same principle, since you've entered in @when 1.
+ * -# In the third loop, you gain access, as per usual, to @when 1 (since it's not fully visited yet). Within it, you access to @when 1,3. After it, @when 1
+ * is finally fully visited. Again, you don't access to @when 2 since you've visited @when 1 in this @testcase cycle loop.
+ * -# Finally you avoid entering in @when 1 since it's fully visited but you access to @when 2.
+ *
+ * When the @when sections run in forked processes (see section_fork.h), only the forked process gains the access.
+ *
+ * @param[in] model the model involved
+ * @param[in] section the section we're trying to access
+ * @return
+ * 	\li \true if we can access to section \c section;
+ * 	\li \false otherwise
+ */
+static inline bool ct_get_access_when(struct ct_model* model, struct ct_section* section) {
+	//we don't enter in this WHEN if we have already entered in another WHEN of the parent
+	if (section->parent->already_found_when) {
+		return false;
+	}
+
+	//we don't access this WHEN if we have already completed it or if it generated a SECTION_SIGNAL
+	if (section->status == CT_SECTION_FULLY_VISITED || section->status == CT_SECTION_SIGNAL_DETECTED) {
+		return false;
+	}
+
+	if (model->section_fork != NULL) {
+		return ct_fork_section(model, section);
+	}
+	return true;
+}
+
+/**
+ * Grants always access
+ *
+ * This condition allows you to **always** gain the access to the @containablesection
+ *
+ * @param[in] model the model involved
+ * @param[in] section the section we're trying to access
+ * @return
+ * 	\li true if we can access to section \c section;
+ * 	\li false otherwise
+ */
+static inline bool ct_always_enter(struct ct_model* model, struct ct_section* section) {
+	return true;
+}
+
+/**
+ * Grants access to a @testcase
+ *
+ * A plain @testcase is always accessible, unless the tests are driven by a fuzzer: in that case only ::FUZZ_TESTCASE sections are run.
+ *
+ * @param[in] model the model involved
+ * @param[in] section the section we're trying to access
+ * @return
+ * 	\li true if we can access to section \c section;
+ * 	\li false otherwise
+ */
+bool ct_get_access_testcase(struct ct_model* model, struct ct_section* section);
+
+
+///@}
+
+///@defgroup beforeEntering Before Entering Containable struct ct_section Functions
+///@brief Functions that can be used as ::ct_enter_c concrete values.
+///Use these functions to develop new @containablesection. These group of functions defines the pool of ::ct_enter_c you can use
+///to create new @containablesection s.
+///@{
+
+/**
+ * Perform setup operations before entering in a @when
+ *
+ * This callback should be executed when we get access granted to a WHEN section, before executing its code.
+ * It sets ::ct_section::already_found_when of struct ct_model::current_section and takes a snapshot of the WHEN section for the test report
+ * and adds it to the test report snapshots tree.
+ *
+ * @param[inout] model the global struct ct_model crashC model you manage
+ * @param[in] section the section representing the @containablesection you're going to access.
+ */
+void ct_callback_entering_when(struct ct_model* model, struct ct_section* section);
+
+/**
+ * Perform setup operations before entering in a @then
+ *
+ * This callback should be executed when we get access granted to a THEN section, before executing its code.
+ * It takes a snapshot of the section and adds it to the current_section's test report snapshots tree.
+ *
+ * @param[inout] model the global struct ct_model crashC model you manage
+ * @param[in] section the section representing the @containablesection you're going to access.
+ */
+void ct_callback_entering_then(struct ct_model* model, struct ct_section* section);
+
+///@}
+
+/**
+ * Updates the current_snapshot, creating a new one if we started a new test
+ * or adding a snapshot to the current test snapshots tree
+ *
+ * @param[inout] model the global struct ct_model crashC model you manage
+ * @param[in] section the section representing the @containablesection you're going to access.
+ */
+void ct_update_current_snapshot(struct ct_model* model, struct ct_section* section);
+
+/**
+ * Starts measuring the time of a snapshot, plus the operating system resources and the hardware events if they have been requested
+ *
+ * @param[inout] model the global struct ct_model crashC model you manage
+ * @param[inout] snapshot the snapshot of the @containablesection which is starting
+ */
+void ct_start_snapshot_measurements(struct ct_model* model, struct ct_snapshot* snapshot);
+
+/**
+ * Stops measuring the time of a snapshot, plus the operating system resources and the hardware events if they have been requested
+ *
+ * After this call struct ct_snapshot::measurements_taken is @true
+ *
+ * @param[inout] model the global struct ct_model crashC model you manage
+ * @param[inout] snapshot the snapshot of the @containablesection which has just ended
+ */
+void ct_stop_snapshot_measurements(struct ct_model* model, struct ct_snapshot* snapshot);
+
+///@defgroup afterEntering After Entering Containable struct ct_section Functions
+///@brief Callbacks that can be used in ::ct_run_once_final_work as callbacks. Set of candidate callbacks to be called after a struct ct_section **access cycle**, **regardless** of its outcome.
+///These callbacks have the main task to repair struct ct_model::current_section in order to ensure that the @containablesection
+///we're actually in when the code is executing is the same pointed by the section tree.
+///Furthermore, these callbacks fetches new data useful for other @crashc task (i.e. test reports).
+///@{
+
+/**
+ * updates struct ct_model::current_section and increases the children of the parent by 1
+ *
+ * @param[inout] model the global struct ct_model crashC model you manage
+ * @param[inout] pointer_to_set_as_parent a pointer **you** need to set to the parent of the section representing the @containablesection
+ * @param[in] child the section representing the @containablesection you have just exit from (hence it's the child section).
+ */
+void ct_exit_callback_next_sibling(struct ct_model* model, struct ct_section** pointer_to_set_as_parent, struct ct_section* child);
+/**
+ * Update section tree metadata whenever you have successfully entered in a child @containablesection
+ *
+ * If you have just exited from a @containablesection, this means you know the number of **direct** children it contains.
+ * This function then performs the following operations:
+ *  \li Mark the \c section as "now we know the exact number of children you have";
+ *  \li Updates struct ct_model::current_snapshot;
+ *
+ * @param[inout] model the global struct ct_model crashC model you manage
+ * @param[inout] pointer_to_set_as_parent a pointer **you** need to set to the parent of the section representing the @containablesection
+ * @param[in] child the section representing the @containablesection you have just exit from (hence it's the child section).
+ */
+void ct_exit_callback_children_number_computed(struct ct_model* model, struct ct_section** pointer_to_set_as_parent, struct ct_section* child);
+
+//TODO find a new name. It's quite similar to ct_exit_callback_children_number_computed, so maybe we should have 2 similar names?
+/**
+ * like ::ct_exit_callback_children_number_computed but it doesn't update the struct ct_model::current_snapshot
+ *
+ * @param[inout] model the global struct ct_model crashC model you manage
+ * @param[inout] pointer_to_set_as_parent a pointer **you** need to set to the parent of the section representing the @containablesection
+ * @param[in] child the section representing the @containablesection you have just exit from (hence it's the child section).
+ */
+void ct_exit_callback_reset_container(struct ct_model* model, struct ct_section** pointer_to_set_as_parent, struct ct_section* child);
+
+/**
+ * Do nothing
+ *
+ * @param[inout] model the global struct ct_model crashC model you manage
+ * @param[inout] pointer_to_set_as_parent a pointer **you** need to set to the parent of the section representing the @containablesection
+ * @param[in] child the section representing the @containablesection you have just exit from (hence it's the child section).
+ */
+void ct_exit_callback_do_nothing(struct ct_model* model, struct ct_section** pointer_to_set_as_parent, struct ct_section* child);
+
+/**
+ * Finalize operations when a @testcase is finished.
+ *
+ * it simply updates the test report outcome depending on the status of the last snapshot of the test tree
+ * and resets the struct ct_model::current_snapshot pointer back to NULL to indicate that the current test is over
+ *
+ * @param[inout] model the global struct ct_model crashC model you manage
+ * @param[inout] pointer_to_set_as_parent a pointer **you** need to set to the parent of the section representing the @containablesection
+ * @param[in] section the section representing the @containablesection you'have just exit from.
+ */
+void ct_exit_callback_access_granted_testcase(struct ct_model* model, struct ct_section** pointer_to_set_as_parent, struct ct_section* section);
+
+///@}
+
+///\defgroup accessGrantedCallBack Access Granted Callbacks
+///@brief Callbacks that can be used in ::ct_run_once_check_access as \c access_granted_callBack. These callbacks are useful to
+///create new @containablesection implementations
+///@{
+
+/**
+ * Does nothing
+ *
+ * @param[inout] model the global struct ct_model crashC model you manage
+ * @param[in] section the section representing the @containablesection you're going to access (hence the child).
+ */
+void ct_callback_do_nothing(struct ct_model* model, struct ct_section* section);
+
+/**
+ * Setup function for @testcase sections
+ *
+ * It initializes the test report associated to the particular looper iteration,
+ * adds it to the test reports list and takes the snapshot of the testcase.
+ *
+ * @param[inout] model the global struct ct_model crashC model you manage
+ * @param[in] section the section representing the @containablesection you're going to access (hence the child).
+ */
+void ct_callback_entering_testcase(struct ct_model* model, struct ct_section* section);
+
+///@}
+
+/**
+ * The parent switcher and the access cycle of a ::CT_CONTAINABLE_SECTION
+ *
+ * Use it only when struct ct_model::current_section has already been set to the section of the @containablesection. See ::CT_CONTAINABLE_SECTION
+ * for the meaning of the parameters.
+ */
+#ifdef CT_CONTAINABLE_SECTION_CYCLES
+#	error "CrashC - CT_CONTAINABLE_SECTION_CYCLES macro already defined!"
+#endif
+#define CT_CONTAINABLE_SECTION_CYCLES(model, condition, access_granted_callback, back_to_parent_callback, exit_access_granted_callback, exit_access_denied_callback)	\
+		for (																																							\
+				(model)->current_section->loop1 = true																													\
+				;																																						\
+				ct_run_once_final_work((model), (model)->current_section, &((model)->current_section), 																	\
+						back_to_parent_callback, exit_access_granted_callback, exit_access_denied_callback																\
+				)																																						\
+				;																																						\
+				/**
+				 *  This code is execute when we have already executed the code
+				 *  inside the container. We assume every post condition of
+				 *  CT_CONTAINABLE_SECTION is satisfied for its children
+				 *  CT_CONTAINABLE_SECTION. Here current_section has not been repaired yet!
+				 */																																						\
+				 (model)->current_section->loop1 = false																												\
+		)																																								\
+		for (																																							\
+				(model)->current_section->loop2 = true																													\
+				;																																						\
+				ct_run_once_check_access((model), (model)->current_section, condition, access_granted_callback, (model)->run_only_if_tags, (model)->exclude_tags)		\
+				;																																						\
+				(model)->current_section->loop2 = false,																												\
+				ct_section_set_executed((model)->current_section)																											\
+		)
+
+/**
+ * Main macro of CrashC
+ *
+ * @definition
+ * A containable section is defined as a piece of developer code you might want to test. To delimit it, containable section
+ * are often wrap in curly brackets. Containable sections may be hierarchical organized: that is, one containable section X may contain
+ * multiple "children" containable sections, which have one and only parent containable section, namely X.
+ * Access to containable section may be granted depending on **specific conditions**.
+ * The main goal of containable sections is to forcefully change the flow of the developer code,
+ * regardless on how the code may appear from the outside. For example, code in \c WHEN sections seems to be executable just after the code
+ * shown before it. Actually code in \c WHEN section is executed depending on a much more complex condition.
+ * Concretely a @containablesection is 2 nested for...loop cycle that, at the end, are just 2 masked \c if conditions.
+ *
+ *
+ * @definition
+ * ::CT_CONTAINABLE_SECTION is 2 nested for...loop cycles. The outermost is the **parent switcher**, allowing you to keep synchronized the
+ * @containablesection the code is actually in with the metadata representing @containablesection, namely the tree formed by ::ct_section.
+ * This syncronization is a two-pass system: first it change the struct ct_model::current_section from the parent @containablesection to the child one,
+ * **regardless** if you have the access to the child. After fully execute the **access cycle**, it repairs struct ct_model::current_section by updating
+ * it from the child to the parent. Code-wise, just like ::ct_run_once_check_access, we model the if with a for loop. Since the for loop condition is run twice, we need to ensure the
+ * cycle condition is in the first call @true whilst in the second one @false (this ensure the "if" behaviour"). Moreover we want to perform additional
+ * code. Such operation is done by ::ct_run_once_final_work.
+ *
+ *
+ * @definition
+ * ::CT_CONTAINABLE_SECTION is composed by 2 loops: the most inner one is the **access cycle** that checks if we can **actually enter** in the @containablesection
+ * represented by a  struct ct_section data structure. If the condition is not surpassed, the access cycle immediately release the control to the **parent switcher**. Otherwise
+ * the @containablesection source code is executed. The for is implementing an \c if condition with the added feature to execute call code at the end. This function has to be called inside
+ * the condition check of the for loop and ensures the loop behaves like an \c if: this is necessary because for loops condition has to be checked twice: one
+ * to check if we can access to the section and one (if we have entered inside the loop) to exit from the loop itself
+ *
+ * @param[inout] model variable of type pointer of struct ct_model containing all the data to manage
+ * @param[in] parent the ::ct_section this @containablesection is contained
+ * @param[in] section_type (whose type is ::ct_section_type) the type of the ::ct_section representing this @containablesection
+ * @param[in] description (whose type is <tt>char*</tt>) a brief description of this @containablesection
+ * @param[in] tags a value (whose type is <tt>char*</tt> representing all the tags within the section. See \ref tags for further information.
+ * @param[in] condition the condition (whose type is ::ct_access_c)you need to clear in order to gain access to the internal test code of the @containablesection
+ * @param[in] access_granted_callback a callback (whose type is ::ct_enter_c) representing a set of instructions to execute if you gain access to the internal test code. This function will be execute before executing the actual test code
+ * @param[in] back_to_parent_callback a callback (whose type is ::ct_exit_c) executed when you're surpassing this @containablesection. Note that this function will be called regardless if you actually enter inside the code or not.
+ * @param[in] exit_access_granted_callback a callback (whose type is ::ct_exit_c)to execute if you entered inside the test code of the @containablesection. Called after \c back_to_parent_callback;
+ * @param[in] exit_access_denied_callback a callback (whose type is ::ct_exit_c)to execute if you didnt' enter inside the test code of the @containablesection. Called after \c back_to_parent_callback;
+ * @param[in] setup_code a piece of C code to paste in the source code before starting all the reasoning for the @containablesection. struct ct_model::current_section for this @containablesection is already populated though.
+ */
+#ifdef CT_CONTAINABLE_SECTION
+#	error "CrashC - CT_CONTAINABLE_SECTION macro already defined!"
+#endif
+#define CT_CONTAINABLE_SECTION(model, parent, section_type, description, tags, condition, access_granted_callback, back_to_parent_callback, exit_access_granted_callback, exit_access_denied_callback, setup_code)	\
+		/**
+		 * Every time we enter inside a section (WHEN, THEN, TESTCASE) we
+		 * create a new metadata data representing such section (if not created yet)
+		 * and then we enter in such section. At the end of the execution,
+		 * we return to the parent section
+		 */																																								\
+		static struct ct_section_site CT_UV(site) = CT_SECTION_SITE_INITIALIZER;																						\
+		(model)->current_section = ct_fetch_section(parent, section_type, description, &CT_UV(site), tags);															\
+		(model)->current_section->times_encountered += 1;																															\
+		setup_code																																						\
+		CT_CONTAINABLE_SECTION_CYCLES((model), condition, access_granted_callback, back_to_parent_callback, exit_access_granted_callback, exit_access_denied_callback)
+
+/**
+ * Convenience macro for a NOOP
+ */
+#ifdef CT_NO_CODE
+#	error "CrashC - CT_NO_CODE macro already defined!"
+#endif
+#define CT_NO_CODE
+
+/**
+ * A @containablesection which embeds a loop.
+ *
+ * The loop keeps going until the @containablesection is fully visited. This means a ::CT_LOOPER does not
+ * stop until every single @containablesection within it has been correctly scanned.
+ *
+ * @param[inout] model a variable of type ::ct_model containing all the data needed by crashc
+ * @param[in] parent a variable of type ::ct_section representing the parent section of this @containablesection
+ * @param[in] section_type a value of type ::ct_section_type representing the type of this @containablesection
+ * @param[in] description a value of type <tt>char*</tt> representing a brief description of the section
+ * @param[in] tags a value of type <tt>char*</tt> representing all the tags within the section. See \ref tags for further information.
+ * @param[in] condition the condition (whose type is ::ct_access_c) you need to clear in order to gain access to the @containablesection
+ */
+#ifdef CT_LOOPER
+#	error "CrashC - CT_LOOPER macro already defined!"
+#endif
+#define CT_LOOPER(model, parent, section_type, description, tags, condition)																						\
+		CT_CONTAINABLE_SECTION(																																		\
+				(model),																																			\
+				parent, section_type, description, tags,																											\
+				condition, ct_callback_entering_testcase, 																											\
+				ct_exit_callback_reset_container, ct_exit_callback_access_granted_testcase,  ct_exit_callback_do_nothing, 											\
+																																									\
+				(model)->jump_source_testcase = (model)->current_section;																							\
+				bool CT_UV(jump_occurred) = false;																													\
+				if (sigsetjmp((model)->jump_point, 1)) {                                                                          					        		\
+					/* We have caught a SIGNAL or an ASSERTION HAS FAILED: here current_section is the section where the signal was raised							\
+					 * If the code enters in this if remember that current_section still refer to the containablesection where the signal has happended				\
+					 * or the assertion have failed. If this is the case, you need to reset current_section to the containable section of the test case.			\
+					 * */																																			\
+					CT_UV(jump_occurred) = true; 																													\
+					/*we reset the current_section to the test case*/																								\
+					ct_reset_section_after_jump((model), (model)->current_section, (model)->jump_source_testcase);													\
+				}																																					\
+				for (    																																			\
+						;																																			\
+						!CT_UV(jump_occurred) && ct_section_still_needs_execution((model)->current_section)                                                   		\
+						;																																			\
+				)																																					\
+		)
+
+
+//TODO the parent of the test case is not the root section, but the "suite section". We need to include them in the section tree as well!
+/**
+ * Represents a @containablesection which keeps being executed until every direct and undirect @containablesection within it has been executed
+ *
+ * @param[in] description a value of type <tt>char*</tt> representing a brief description of the section
+ * @param[in] tags a value of type <tt>char*</tt> representing all the tags within the section. See \ref tags for further information.
+ */
+#ifdef TESTCASE
+#	error "CrashC - TESTCASE macro already defined!"
+#endif
+#define TESTCASE(description, tags) CT_LOOPER(ct_model, ((ct_model)->root_section), CT_TESTCASE_SECTION, description, tags, ct_get_access_testcase)
+/**
+ * like ::TESTCASE but with the default \c tags value of ""
+ *
+ * @param[in] description a value of type <tt>char*</tt> representing a brief description of the section
+ */
+#ifdef EZ_TESTCASE
+#	error "CrashC - EZ_TESTCASE macro already defined!"
+#endif
+#define EZ_TESTCASE(description) TESTCASE(description, "")
+
+/**
+ * A @testcase run once for every input of a fuzzer
+ *
+ * Inside the section, \c data (of type <tt>const uint8_t*</tt>) and \c size (of type \c size_t) are the bytes of the input.
+ * Each input generates its own tests, just like a separate @testcase. See fuzz.h for how the inputs are chosen.
+ *
+ * @code
+ * FUZZ_TESTCASE("parser never crashes", data, size) {
+ * 	struct parsed* p = parse(data, size);
+ * 	ASSERT(p != NULL);
+ * }
+ * @endcode
+ *
+ * @param[in] description a value of type <tt>char*</tt> representing a brief description of the section
+ * @param[in] data the name of the variable containing the bytes of the input
+ * @param[in] size the name of the variable containing the number of bytes of the input
+ */
+#ifdef FUZZ_TESTCASE
+#	error "CrashC - FUZZ_TESTCASE macro already defined!"
+#endif
+#define FUZZ_TESTCASE(description, data, size)																														\
+		for (struct ct_fuzz_input* CT_UV(fuzz_input) = ct_fuzz_start(ct_model); CT_UV(fuzz_input) != NULL; CT_UV(fuzz_input) = ct_fuzz_next(ct_model))			\
+			for (size_t size = CT_UV(fuzz_input)->size, CT_UV(fuzz_once) = 1; CT_UV(fuzz_once) == 1; CT_UV(fuzz_once) = 0)										\
+				for (const uint8_t* data = CT_UV(fuzz_input)->data; CT_UV(fuzz_once) == 1; CT_UV(fuzz_once) = 0)													\
+					/* like CT_LOOPER, but made of a single statement so that it can be repeated for every input:											\
+					 * the first phase fetches and claims the section and sets the jump point, the second one runs the section. A jump ends the second phase */			\
+					for (volatile int CT_UV(fuzz_phase) = 0; CT_UV(fuzz_phase) < 2; CT_UV(fuzz_phase)++)														\
+						if (CT_UV(fuzz_phase) == 0) {																												\
+							static struct ct_section_site CT_UV(site) = CT_SECTION_SITE_INITIALIZER;																\
+							(ct_model)->current_section = ct_fetch_section((ct_model)->root_section, CT_TESTCASE_SECTION, description, &CT_UV(site), "");			\
+							(ct_model)->current_section->times_encountered += 1;																					\
+							if (!ct_fuzz_claim(ct_model)) {																											\
+								break;																																\
+							}																																		\
+							(ct_model)->jump_source_testcase = (ct_model)->current_section;																			\
+							if (sigsetjmp((ct_model)->jump_point, 1)) {																								\
+								ct_reset_section_after_jump((ct_model), (ct_model)->current_section, (ct_model)->jump_source_testcase);								\
+							}																																		\
+						} else																																		\
+							for (																																	\
+									;																																\
+									ct_section_still_needs_execution((ct_model)->current_section)																	\
+									;																																\
+							)																																		\
+							CT_CONTAINABLE_SECTION_CYCLES(																											\
+									(ct_model), ct_always_enter, ct_callback_entering_testcase,																		\
+									ct_exit_callback_reset_container, ct_exit_callback_access_granted_testcase, ct_exit_callback_do_nothing							\
+							)
+
+/**
+ * A @containablesection where you always gain access to
+ *
+ * @param[inout] model variable of type pointer of struct ct_model containing all the data to manage
+ * @param[in] section_type (whose type is ::ct_section_type) the type of the ::ct_section representing this @containablesection
+ * @param[in] description a value of type <tt>char*</tt> representing a brief description of the section
+ * @param[in] tags a value of type <tt>char*</tt> representing all the tags within the section. See \ref tags for further information.
+ */
+#ifdef CT_ALWAYS_ENTER
+#	error "CrashC - CT_ALWAYS_ENTER macro already defined!"
+#endif
+#define CT_ALWAYS_ENTER(model, section_type, description, tags) CT_CONTAINABLE_SECTION(															\
+		(model), 																														\
+		(model)->current_section, section_type, description, tags,																		\
+		ct_always_enter, ct_callback_entering_then,																						\
+		ct_exit_callback_next_sibling,	ct_exit_callback_children_number_computed, ct_exit_callback_do_nothing,							\
+		CT_NO_CODE																															\
+)
+
+/**
+ * A @containablesection where you gain access to only if has
+ * not been fully visited and you didn't access to a similar section yet in the same parent.
+ *
+ * @param[inout] model variable of type pointer of struct ct_model containing all the data to manage
+ * @param[in] section_type (whose type is ::ct_section_type) the type of the ::ct_section representing this @containablesection
+ * @param[in] description a value of type <tt>char*</tt> representing a brief description of the section
+ * @param[in] tags a value of type <tt>char*</tt> representing all the tags within the section. See \ref tags for further information.
+ */
+#ifdef CT_ENTER_ONCE_PER_LOOP
+#	error "CrashC - CT_ENTER_ONCE_PER_LOOP macro already defined!"
+#endif
+#define CT_ENTER_ONCE_PER_LOOP(model, section_type, description, tags) CT_CONTAINABLE_SECTION(													\
+		(model), 																														\
+		(model)->current_section, section_type, description, tags,																		\
+		ct_get_access_when, ct_callback_entering_when, 																					\
+		ct_exit_callback_next_sibling, ct_exit_callback_children_number_computed, ct_exit_callback_do_nothing,								\
+		CT_NO_CODE 																															\
+)
+
+/**
+ * Represents a @containablesection with 2 access conditions:
+ *
+ * \li it has not been fully visited yet;
+ * \li you still have not accessed to a @when in the same container
+ *
+ * @param[in] description a value of type <tt>char*</tt> representing a brief description of the section
+ * @param[in] tags a value of type <tt>char*</tt> representing all the tags within the section. See \ref tags for further information.
+ */
+#ifdef WHEN
+#	error "CrashC - WHEN macro already defined!"
+#endif
+#define WHEN(description, tags) CT_ENTER_ONCE_PER_LOOP((ct_model), CT_WHEN_SECTION, description, tags)
+
+/**
+ * like ::WHEN but with the default \c tags value of ""
+ */
+#ifdef EZ_WHEN
+#	error "CrashC - EZ_WHEN macro already defined!"
+#endif
+#define EZ_WHEN(description) WHEN(description, "")
+
+/**
+ * Represents a @containablesection you need always to access to
+ *
+ * @param[in] description a value of type <tt>char*</tt> representing a brief description of the section
+ * @param[in] tags a value of type <tt>char*</tt> representing all the tags within the section. See \ref tags for further information.
+ */
+#ifdef THEN
+#	error "CrashC - THEN macro already defined!"
+#endif
+#define THEN(description, tags) CT_ALWAYS_ENTER((ct_model), CT_THEN_SECTION, description, tags)
+
+/**
+ * like ::THEN but with the default \c tags value of ""
+ */
+#ifdef EZ_THEN
+#	error "CrashC - EZ_THEN macro already defined!"
+#endif
+#define EZ_THEN(description) THEN(description, "")
+
+/**
+ * Represents a @containablesection running a function on several threads at the same time
+ *
+ * Every thread calls \c function \c iterations times. The threads are released together by a barrier, so they compete against each
+ * other right from the start. Assertions failing inside \c function terminate the thread where they failed and make the test fail.
+ * The throughput of every thread and the tail latency of the iterations are added to the report. You always gain access to the section.
+ *
+ * Since C has no way to run a block of code on another thread, the code to stress is a function rather than the body of the section:
+ * put a \c ; right after the macro.
+ *
+ * @code
+ * STRESS("concurrent push", "queue", 8, 10000, push_one_element);
+ * @endcode
+ *
+ * @param[in] description a value of type <tt>char*</tt> representing a brief description of the section
+ * @param[in] tags a value of type <tt>char*</tt> representing all the tags within the section. See \ref tags for further information.
+ * @param[in] threads the number of threads to run at the same time
+ * @param[in] iterations the number of times every thread calls \c function
+ * @param[in] function a function of type ::ct_stress_c containing the code to stress
+ * @see stress.h
+ */
+#ifdef STRESS
+#	error "CrashC - STRESS macro already defined!"
+#endif
+#define STRESS(description, tags, threads, iterations, function) 											\
+		CT_ALWAYS_ENTER((ct_model), CT_STRESS_SECTION, description, tags) {									\
+			ct_run_stress((ct_model), (function), (threads), (iterations));									\
+		}
+
+/**
+ * like ::STRESS but with the default \c tags value of ""
+ */
+#ifdef EZ_STRESS
+#	error "CrashC - EZ_STRESS macro already defined!"
+#endif
+#define EZ_STRESS(description, threads, iterations, function) STRESS(description, "", threads, iterations, function)
+
+/**
+ * Represents a @containablesection measuring how the time of its body scales with a parameter
+ *
+ * The body is run for every value of the parameter, from \c from to \c to doubling it every time, with the variable \c n
+ * (of type \c long) holding the current value. The parameter can be the size of the input the body handles, or the number of threads it spawns.
+ * Every value is run several times, so the body shouldn't leave behind any state. The time of every value, the complexity class fitting them
+ * best and its coefficient are added to the report. You always gain access to the section. See benchmark.h for how the times are measured.
+ *
+ * @code
+ * BENCHMARK_RANGE("sort", "list", n, 1<<10, 1<<24) {
+ * 	fill_randomly(array, n);
+ * 	sort(array, n);
+ * }
+ * @endcode
+ *
+ * A failed assertion in the body interrupts the benchmark. The body can't contain other @containablesection, nor \c break out of the section.
+ * If \c from is smaller than 1 or \c to is smaller than \c from, the section fails without running the body.
+ *
+ * If the allocation tracker is enabled, the blocks allocated by a run of the body are reported as well; tag the section with
+ * \c max_allocs:N to make it fail when a run allocates more than \c N blocks. See ::CT_MAX_ALLOCATIONS_TAG.
+ *
+ * @param[in] description a value of type <tt>char*</tt> representing a brief description of the section
+ * @param[in] tags a value of type <tt>char*</tt> representing all the tags within the section. See \ref tags for further information.
+ * @param[in] n the name of the variable holding the parameter inside the body
+ * @param[in] from the first value of the parameter, at least 1
+ * @param[in] to the last value of the parameter, at least \c from
+ * @see benchmark.h
+ */
+#ifdef BENCHMARK_RANGE
+#	error "CrashC - BENCHMARK_RANGE macro already defined!"
+#endif
+#define BENCHMARK_RANGE(description, tags, n, from, to) 																	\
+		CT_ALWAYS_ENTER((ct_model), CT_BENCHMARK_SECTION, description, tags)												\
+			for (long n = ct_start_benchmark((ct_model), #n, (from), (to)); ct_benchmark_next((ct_model), &n); )
+
+/**
+ * like ::BENCHMARK_RANGE but with the default \c tags value of ""
+ */
+#ifdef EZ_BENCHMARK_RANGE
+#	error "CrashC - EZ_BENCHMARK_RANGE macro already defined!"
+#endif
+#define EZ_BENCHMARK_RANGE(description, n, from, to) BENCHMARK_RANGE(description, "", n, from, to)
+
+//TODO all those functions should be included in the only one global models
+/**
+ * Represents the default entry point for @crashc main executable
+ *
+ * The macro is used to contain all test declarations and to generate the main function for the
+ * execution of the various tests.
+ *
+ * The macro is actually masking a \c main function. If \c CT_FUZZER is defined, it masks \c LLVMFuzzerTestOneInput instead:
+ * in that case only ::FUZZ_TESTCASE sections are run, once for every input the fuzzer generates (see fuzz.h), while the code between
+ * ::TESTS_START and ::TESTS_END is run only with the first input, since the model is kept until the fuzzer exits.
+ *
+ */
+#ifdef TESTS_START
+#	error "CrashC - TESTS_START macro already defined!"
+#endif
+#ifndef CT_FUZZER
+#	define TESTS_START int main(const int argc, char* const args[]) { 																\
+		ct_model = ct_setup_default_model();																					\
+		ct_parse_args(argc, args, CT_TAGS_SEPARATOR, ct_model); 														\
+		ct_register_signal_handlers();
+#else
+#	define TESTS_START int LLVMFuzzerTestOneInput(const uint8_t* ct_fuzz_data, size_t ct_fuzz_size) {										\
+		if (ct_model == NULL) {																									\
+			ct_model = ct_setup_default_model();																				\
+			/* the model is used by every input: the suites are registered once */
+#endif
+
+///@defgroup hooks CrashC developer hooks
+///@brief Represents a list of utility APIs you can use to fully customize @crashc testing execution
+///@{
+
+/**
+ * Used to register a teardown function
+ *
+ * Use this function to perform additional operations **just before** struct ct_model model is fully disposed.
+ * Usually you can use this function to release from memory any additional resources you've created.
+ *
+ * @param[in] f a function of type <tt>void (*f)(void)</tt> to be executed before tearing down the whole model
+ * @see struct ct_model::ct_teardown
+ */
+void ct_set_crashc_teardown(ct_teardown_c f);
+
+///@}
+
+/**
+ * Complete the \c main function created with ::TESTS_START
+ *
+ * Furthermore, it also start the execution of the registered testsuites
+ */
+#ifdef TESTS_END
+#	error "CrashC - TESTS_END macro already defined!"
+#endif
+#ifndef CT_FUZZER
+#	define TESTS_END 																	\
+	ct_order_suites(ct_model);														\
+	if (ct_distribute(ct_model)) {													\
+		for ((ct_model)->repetition = 0; (ct_model)->repetition < (ct_model)->repetitions; (ct_model)->repetition++) {	\
+			for (int i = 0; i < (ct_model)->suites_array_index; i++) { 				\
+				(ct_model)->current_suite = (ct_model)->suites_order[i];			\
+				if (CT_HAS_LISTENERS((ct_model), CT_EVENT_SUITE_START)) {			\
+					ct_dispatch_suite_start((ct_model), (ct_model)->suites_names[(ct_model)->current_suite]);	\
+				}																	\
+				(ct_model)->tests_array[(ct_model)->current_suite](); 				\
+				ct_section_fork_leave(ct_model);									\
+			} 																		\
+		}																			\
+		ct_distribution_leave(ct_model);											\
+	}																				\
+	ct_unregister_signal_handlers();												\
+	ct_restore_declaration_order(ct_model);											\
+	ct_detect_flaky_tests(ct_model);												\
+	if (CT_HAS_LISTENERS((ct_model), CT_EVENT_RUN_END)) {							\
+		ct_dispatch_run_end(ct_model);												\
+	}																				\
+	(ct_model)->report_producer_implementation->report_producer(ct_model);			\
+	if ((ct_model)->ct_teardown != NULL) {											\
+		(ct_model)->ct_teardown();													\
+	}																				\
+	ct_teardown_default_model(ct_model);											\
+	ct_model = NULL;																\
+} //main function closing bracket
+#else
+#	define TESTS_END 																\
+		atexit(ct_fuzz_teardown);													\
+	}																				\
+	ct_set_fuzz_input(ct_model, ct_fuzz_data, ct_fuzz_size);						\
+    for (int i = 0; i < (ct_model)->suites_array_index; i++) { 						\
+    	(ct_model)->tests_array[i](); 												\
+    } 																				\
+	ct_fuzz_end_input(ct_model);													\
+	return 0;																		\
+} //LLVMFuzzerTestOneInput function closing bracket
+#endif
+
+/**
+ * Specifies a function prototype representing a test suite.
+ *
+ * @testsuite can contain an arbitrary number
+ * of testcases. Every ::TESTSUITE must be given a unique ID, namely either a valid C identifier
+ * or a non negative integer number. Such ID uniquely represents a @testsuite.
+ * Progressive numerical IDs are strongly recomended as the framework provides a few
+ * really useful macros to easily register their testsuites.
+ * Note that ID coherency is left as a user responsability.
+ *
+ * @param[in] id a sequence of id, either a valid C identifier or a non negative integer number or a valid C identifier prefixed with a non negative integer number
+ */
+#ifdef TESTSUITE
+#	error "CrashC - TESTSUITE macro already defined!"
+#endif
+#define TESTSUITE(id) void suite_ ## id()
+
+/**
+ * Macro registering a single test suite given its ID
+ *
+ * \pre
+ * 	\li test suite generated with ::TESTSUITE macro with the same \c id needs to have been declared
+ * \post
+ * 	\li the @testsuite with id set to \c id has been register in @crashc framework
+ *
+ * @param[in] id a sequence of id, either a valid C identifier or a non negative integer number or a valid C identifier prefixed with a non negative integer number
+ */
+#ifdef REG_SUITE
+#	error "CrashC - REG_SUITE macro already defined!"
+#endif
+#define REG_SUITE(id) 									\
+     void suite_ ## id(); 								\
+     ct_update_test_array((ct_model), suite_ ## id, #id)
+
+/**
+ * Register a batch of test suites all in one
+ *
+ * This macro accepts a variadic arguments. Each argument represents the \c id of a @testsuite to register.
+ *
+ * \pre
+ * 	\li every \c id within the variadic argument needs to have a corresponding ::TESTSUITE call with the same \c id
+ *
+ * Note that for a single use of the macro the maximum number of specified IDs is 64
+ * due to CPP limitations. This problem is easily solved by the use of two or more
+ * consequent macro uses.
+ *
+ * @param[in] ... a sequence of id, either a valid C identifier or a non negative integer number or a valid C identifier prefixed with a non negative integer number
+ */
+#ifdef REG_SUITES
+#	error "CrashC - REG_SUITES macro already defined!"
+#endif
+#define REG_SUITES(...) CT_VARIADIC_MACRO(REG_SUITE, ## __VA_ARGS__)
+
+
+#endif
+#ifdef CRASHC_IMPLEMENTATION
+/*
+ * allocation_tracker.c
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: koldar
+ */
+
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+
+
+
+
+
+
+
+/*
+ * The actual allocation functions. They are defined by the linker only when the executable is linked with --wrap:
+ * otherwise they are weak undefined symbols and their address is NULL
+ */
+extern void* __real_malloc(size_t size) __attribute__((weak));
+extern void* __real_calloc(size_t number, size_t size) __attribute__((weak));
+extern void* __real_realloc(void* pointer, size_t size) __attribute__((weak));
+extern void __real_free(void* pointer) __attribute__((weak));
+
+/**
+ * How many nested @crashc internal operations the calling thread is running right now
+ *
+ * Allocations performed while this counter is greater than 0 are performed by @crashc itself, hence they are not counted
+ */
+static _Thread_local int ct_internal_depth = 0;
+
+static struct ct_allocation_tracker* ct_current_tracker();
+static size_t ct_block_hash(const void* block, size_t capacity);
+static void ct_allocation_table_put(struct ct_allocation_tracker* tracker, void* block, size_t size);
+static bool ct_allocation_table_remove(struct ct_allocation_tracker* tracker, void* block);
+static void ct_allocation_table_clear(struct ct_allocation_tracker* tracker);
+static void ct_allocation_table_grow(struct ct_allocation_tracker* tracker);
+static void ct_account_allocation(struct ct_allocation_tracker* tracker, void* new_block, size_t size);
+static bool ct_sum_allocations(const struct ct_snapshot* snapshot, unsigned long* allocations);
+
+struct ct_allocation_tracker* ct_init_allocation_tracker() {
+	struct ct_allocation_tracker* ret_val = malloc(sizeof(struct ct_allocation_tracker));
+	if (ret_val == NULL) {
+		CT_MALLOC_ERROR_CALLBACK();
+	}
+
+	ret_val->enabled = (__real_malloc != NULL) && (__real_calloc != NULL) && (__real_realloc != NULL) && (__real_free != NULL);
+	ret_val->active = false;
+	pthread_mutex_init(&ret_val->lock, NULL);
+	ret_val->blocks = NULL;
+	ret_val->block_sizes = NULL;
+	ret_val->capacity = 0;
+	ret_val->live_blocks = 0;
+	ret_val->live_bytes = 0;
+
+	if (ret_val->enabled) {
+		//the table is not allocated via the wrappers, hence it is never accounted to the code under test
+		ret_val->capacity = CT_ALLOCATION_TABLE_INITIAL_SIZE;
+		ret_val->blocks = __real_calloc(ret_val->capacity, sizeof(void*));
+		ret_val->block_sizes = __real_calloc(ret_val->capacity, sizeof(size_t));
+		if (ret_val->blocks == NULL || ret_val->block_sizes == NULL) {
+			CT_MALLOC_ERROR_CALLBACK();
+		}
+	}
+
+	return ret_val;
+}
+
+void ct_destroy_allocation_tracker(struct ct_allocation_tracker* tracker) {
+	if (tracker->enabled) {
+		__real_free(tracker->blocks);
+		__real_free(tracker->block_sizes);
+	}
+	pthread_mutex_destroy(&tracker->lock);
+	free(tracker);
+}
+
+void ct_allocation_tracker_start(struct ct_allocation_tracker* tracker) {
+	if (!tracker->enabled) {
+		return;
+	}
+	pthread_mutex_lock(&tracker->lock);
+	ct_allocation_table_clear(tracker);
+	tracker->active = true;
+	pthread_mutex_unlock(&tracker->lock);
+}
+
+void ct_allocation_tracker_stop(struct ct_allocation_tracker* tracker) {
+	pthread_mutex_lock(&tracker->lock);
+	tracker->active = false;
+	pthread_mutex_unlock(&tracker->lock);
+}
+
+void ct_allocation_tracker_pause() {
+	ct_internal_depth += 1;
+}
+
+void ct_allocation_tracker_resume() {
+	ct_internal_depth -= 1;
+}
+
+void ct_allocation_tracker_check_leaks(struct ct_allocation_tracker* tracker, struct ct_snapshot* snapshot) {
+	if (!tracker->enabled) {
+		return;
+	}
+
+	pthread_mutex_lock(&tracker->lock);
+	snapshot->leaked_blocks = tracker->live_blocks;
+	snapshot->leaked_bytes = tracker->live_bytes;
+	pthread_mutex_unlock(&tracker->lock);
+	if (snapshot->leaked_blocks > 0 && snapshot->status == CT_SNAPSHOT_OK) {
+		snapshot->status = CT_SNAPSHOT_LEAKED;
+	}
+}
+
+void ct_allocation_tracker_read(struct ct_allocation_tracker* tracker, const struct ct_snapshot* snapshot, unsigned long* allocations, size_t* allocated_bytes, unsigned long* frees) {
+	pthread_mutex_lock(&tracker->lock);
+	*allocations = snapshot->allocations;
+	*allocated_bytes = snapshot->allocated_bytes;
+	*frees = snapshot->frees;
+	pthread_mutex_unlock(&tracker->lock);
+}
+
+void ct_allocation_tracker_check_bound(struct ct_allocation_tracker* tracker, struct ct_snapshot* snapshot) {
+	if (!tracker->enabled || snapshot->status != CT_SNAPSHOT_OK) {
+		return;
+	}
+
+	unsigned long allocations = 0;
+	long bound;
+	bool over_allocated = ct_sum_allocations(snapshot, &allocations);
+	if (ct_tag_ht_get_number(snapshot->tags, CT_MAX_ALLOCATIONS_TAG, &bound) && ((long) allocations) > bound) {
+		over_allocated = true;
+	}
+	if (over_allocated) {
+		snapshot->status = CT_SNAPSHOT_OVER_ALLOCATED;
+	}
+}
+
+void* __wrap_malloc(size_t size) {
+	void* ret_val = __real_malloc(size);
+	struct ct_allocation_tracker* tracker = ct_current_tracker();
+
+	if (tracker != NULL) {
+		pthread_mutex_lock(&tracker->lock);
+		ct_account_allocation(tracker, ret_val, size);
+		pthread_mutex_unlock(&tracker->lock);
+	}
+	return ret_val;
+}
+
+void* __wrap_calloc(size_t number, size_t size) {
+	void* ret_val = __real_calloc(number, size);
+	struct ct_allocation_tracker* tracker = ct_current_tracker();
+
+	if (tracker != NULL) {
+		pthread_mutex_lock(&tracker->lock);
+		ct_account_allocation(tracker, ret_val, number * size);
+		pthread_mutex_unlock(&tracker->lock);
+	}
+	return ret_val;
+}
+
+void* __wrap_realloc(void* pointer, size_t size) {
+	struct ct_allocation_tracker* tracker = ct_current_tracker();
+	void* ret_val = __real_realloc(pointer, size);
+
+	if (tracker == NULL || (ret_val == NULL && size > 0)) {
+		return ret_val;
+	}
+
+	struct ct_snapshot* snapshot = ct_get_thread_snapshot(ct_model);
+	pthread_mutex_lock(&tracker->lock);
+	//a block allocated before the test started is not owned by the test, even if it is moved
+	bool owned = (pointer == NULL) || ct_allocation_table_remove(tracker, pointer);
+	if (ret_val == NULL) {
+		//realloc with size 0 has released the block
+		if (owned && snapshot != NULL) {
+			snapshot->frees += 1;
+		}
+	} else if (owned) {
+		ct_account_allocation(tracker, ret_val, size);
+	} else if (ct_internal_depth == 0 && snapshot != NULL) {
+		snapshot->allocations += 1;
+		snapshot->allocated_bytes += size;
+	}
+	pthread_mutex_unlock(&tracker->lock);
+	return ret_val;
+}
+
+void __wrap_free(void* pointer) {
+	struct ct_allocation_tracker* tracker = ct_current_tracker();
+
+	if (tracker != NULL && pointer != NULL) {
+		struct ct_snapshot* snapshot = ct_get_thread_snapshot(ct_model);
+		pthread_mutex_lock(&tracker->lock);
+		if (ct_allocation_table_remove(tracker, pointer) && snapshot != NULL) {
+			snapshot->frees += 1;
+		}
+		pthread_mutex_unlock(&tracker->lock);
+	}
+	__real_free(pointer);
+}
+
+/**
+ * Fetch the tracker which is counting allocations right now
+ *
+ * @return the tracker of the global model or @null if no test is running
+ */
+static struct ct_allocation_tracker* ct_current_tracker() {
+	if (ct_model == NULL || ct_model->allocation_tracker == NULL) {
+		return NULL;
+	}
+	if (!__atomic_load_n(&ct_model->allocation_tracker->active, __ATOMIC_RELAXED)) {
+		return NULL;
+	}
+	return ct_model->allocation_tracker;
+}
+
+/**
+ * Accounts a block allocated by the code under test
+ *
+ * The caller needs to hold struct ct_allocation_tracker::lock
+ *
+ * @param[inout] tracker the tracker to update. If @null nothing is done
+ * @param[in] new_block the block just allocated
+ * @param[in] size the size of \c new_block
+ */
+static void ct_account_allocation(struct ct_allocation_tracker* tracker, void* new_block, size_t size) {
+	if (tracker == NULL || new_block == NULL || ct_internal_depth > 0) {
+		return;
+	}
+
+	//a worker thread never looks at struct ct_model::current_snapshot, which the main thread changes without any lock
+	struct ct_snapshot* snapshot = ct_get_thread_snapshot(ct_model);
+	ct_allocation_table_put(tracker, new_block, size);
+	if (snapshot != NULL) {
+		snapshot->allocations += 1;
+		snapshot->allocated_bytes += size;
+	}
+}
+
+/**
+ * Sums the blocks allocated by a snapshot and by its descendants
+ *
+ * Benchmarks are skipped, since they run their body many times
+ *
+ * @param[in] snapshot the root of the tree to sum
+ * @param[inout] allocations the sum to update
+ * @return @true if a benchmark in the tree has exceeded its own bound, @false otherwise
+ */
+static bool ct_sum_allocations(const struct ct_snapshot* snapshot, unsigned long* allocations) {
+	if (snapshot->type == CT_BENCHMARK_SECTION) {
+		return snapshot->status == CT_SNAPSHOT_OVER_ALLOCATED;
+	}
+
+	bool ret_val = false;
+	*allocations += snapshot->allocations;
+	for (const struct ct_snapshot* child = snapshot->first_child; child != NULL; child = child->next_sibling) {
+		ret_val = ct_sum_allocations(child, allocations) || ret_val;
+	}
+	return ret_val;
+}
+
+static size_t ct_block_hash(const void* block, size_t capacity) {
+	//blocks are aligned, hence the lowest bits are always the same
+	uintptr_t h = ((uintptr_t) block) >> 4;
+	h *= (uintptr_t) 0x9E3779B97F4A7C15ULL;
+	return (size_t) (h ^ (h >> 29)) & (capacity - 1);
+}
+
+static void ct_allocation_table_put(struct ct_allocation_tracker* tracker, void* block, size_t size) {
+	if ((tracker->live_blocks + 1) * 2 > tracker->capacity) {
+		ct_allocation_table_grow(tracker);
+	}
+
+	size_t i = ct_block_hash(block, tracker->capacity);
+	while (tracker->blocks[i] != NULL) {
+		i = (i + 1) & (tracker->capacity - 1);
+	}
+	tracker->blocks[i] = block;
+	tracker->block_sizes[i] = size;
+	tracker->live_blocks += 1;
+	tracker->live_bytes += size;
+}
+
+/**
+ * Removes a block from the table of live blocks
+ *
+ * We use linear probing with backward shift deletion, so no tombstone is ever needed
+ *
+ * @param[inout] tracker the tracker containing the table
+ * @param[in] block the block to remove
+ * @return @true if \c block was a live block, @false otherwise
+ */
+static bool ct_allocation_table_remove(struct ct_allocation_tracker* tracker, void* block) {
+	size_t mask = tracker->capacity - 1;
+	size_t i = ct_block_hash(block, tracker->capacity);
+
+	while (tracker->blocks[i] != block) {
+		if (tracker->blocks[i] == NULL) {
+			return false;
+		}
+		i = (i + 1) & mask;
+	}
+
+	tracker->live_blocks -= 1;
+	tracker->live_bytes -= tracker->block_sizes[i];
+	tracker->blocks[i] = NULL;
+
+	size_t j = i;
+	while (true) {
+		j = (j + 1) & mask;
+		if (tracker->blocks[j] == NULL) {
+			return true;
+		}
+		size_t home = ct_block_hash(tracker->blocks[j], tracker->capacity);
+		//move the cell j in the hole if its home position is not in the cyclic range (i, j]
+		if ((i <= j) ? ((i < home) && (home <= j)) : ((i < home) || (home <= j))) {
+			continue;
+		}
+		tracker->blocks[i] = tracker->blocks[j];
+		tracker->block_sizes[i] = tracker->block_sizes[j];
+		tracker->blocks[j] = NULL;
+		i = j;
+	}
+}
+
+static void ct_allocation_table_clear(struct ct_allocation_tracker* tracker) {
+	if (tracker->live_blocks > 0) {
+		memset(tracker->blocks, 0, sizeof(void*) * tracker->capacity);
+	}
+	tracker->live_blocks = 0;
+	tracker->live_bytes = 0;
+}
+
+static void ct_allocation_table_grow(struct ct_allocation_tracker* tracker) {
+	void** old_blocks = tracker->blocks;
+	size_t* old_sizes = tracker->block_sizes;
+	size_t old_capacity = tracker->capacity;
+
+	tracker->capacity = old_capacity * 2;
+	tracker->blocks = __real_calloc(tracker->capacity, sizeof(void*));
+	tracker->block_sizes = __real_calloc(tracker->capacity, sizeof(size_t));
+	if (tracker->blocks == NULL || tracker->block_sizes == NULL) {
+		CT_MALLOC_ERROR_CALLBACK();
+	}
+	tracker->live_blocks = 0;
+	tracker->live_bytes = 0;
+
+	for (size_t i = 0; i < old_capacity; i++) {
+		if (old_blocks[i] != NULL) {
+			ct_allocation_table_put(tracker, old_blocks[i], old_sizes[i]);
+		}
+	}
+
+	__real_free(old_blocks);
+	__real_free(old_sizes);
+}
+/*
+ * ct_assert.c
+ *
+ *  Created on: Nov 15, 2017
+ *      Author: noodles
+ */
+
+#include <stdio.h>
+#include <string.h>
+#include <setjmp.h>
+#include <pthread.h>
+
+
+
+
+
+
+
+
+
+
+/**
+ * The assertion the calling thread is performing right now
+ */
+static _Thread_local struct ct_assert_report* ct_current_assert_report = NULL;
+/**
+ * On a worker thread, the cell which will publish ::ct_current_assert_report
+ */
+static _Thread_local struct ct_thread_assert_report* ct_current_thread_cell = NULL;
+
+struct ct_assert_report* ct_init_assert_report(bool is_mandatory, char* asserted_text, char* file, unsigned int line) {
+	struct ct_assert_report* ret_val = malloc(sizeof(struct ct_assert_report));
+
+	if (ret_val == NULL) {
+		CT_MALLOC_ERROR_CALLBACK();
+	}
+
+	ret_val->passed = true;
+	ret_val->is_mandatory = is_mandatory;
+	ret_val->asserted = asserted_text;
+	ret_val->expected_value = NULL;
+	ret_val->expected_str = NULL;
+	ret_val->actual_value = NULL;
+	ret_val->actual_str = NULL;
+	ret_val->file_name = file;
+	ret_val->line_number = line;
+
+	return ret_val;
+}
+
+void ct_register_assert_report(struct ct_model* model, bool is_mandatory, char* asserted_text, char* file, unsigned int line) {
+	ct_allocation_tracker_pause();
+	ct_current_assert_report = ct_init_assert_report(is_mandatory, asserted_text, file, line);
+	if (ct_is_main_thread(model)) {
+		ct_list_add_tail(model->current_snapshot->assertion_reports, ct_current_assert_report);
+	} else {
+		ct_current_thread_cell = ct_init_thread_assert_report(ct_current_assert_report);
+	}
+	ct_allocation_tracker_resume();
+}
+
+void ct_complete_assert_report(struct ct_model* model) {
+	if (ct_current_assert_report == NULL) {
+		return;
+	}
+	if (!ct_is_main_thread(model)) {
+		ct_publish_thread_assert_report(model, ct_current_thread_cell);
+		ct_current_thread_cell = NULL;
+	}
+	ct_current_assert_report = NULL;
+}
+
+//TODO: We might add a field to the assert_report struct to point at a specific destructor in order to be able to
+//		precisely control how to destroy a specific report, which might have been generated by a different type of assertion
+//		which, for example, needs to malloc the memory for its strings
+void ct_destroy_assert_report(struct ct_assert_report* report) {
+	free(report);
+}
+
+void ct_assert_do_nothing(struct ct_model* model) {
+
+}
+
+void ct_general_assert_failed(struct ct_model* model) {
+
+	struct ct_assert_report* report = ct_current_assert_report;
+
+	//Update the assertion report
+	report->passed = false;
+	report->expected_str = "true";
+	report->actual_str = "false";
+
+	if (ct_is_fuzzing(model)) {
+		//a fuzzer detects a failure only when the process crashes
+		fprintf(stderr, "CrashC - assertion \"%s\" failed in %s:%u\n", report->asserted, report->file_name, report->line_number);
+		abort();
+	}
+
+	if (!ct_is_main_thread(model)) {
+		//we can't jump into the stack of another thread: the failure will be propagated when the main thread merges the report
+		ct_complete_assert_report(model);
+		pthread_exit(NULL);
+	}
+	ct_current_assert_report = NULL;
+	if (CT_HAS_LISTENERS(model, CT_EVENT_ASSERT_FAIL)) {
+		ct_dispatch_assert_fail(model, report);
+	}
+
+	struct ct_snapshot* snapshot = model->current_snapshot;
+	struct ct_test_report* test_report = ct_list_tail(model->test_reports_list);
+
+	//Update the status of the snapshot which contained this assertion and of the test
+	snapshot->status = CT_SNAPSHOT_FAILED;
+	ct_update_test_outcome(test_report, snapshot);
+
+	//We then need to reset the current snapshot to start a new snapshot tree
+	model->current_snapshot = NULL;
+
+	//We jump out of this flow of execution to go back at the beginning of the test case and go on with the execution of the other tests
+	siglongjmp(model->jump_point, CT_ASSERT_JUMP_CODE);
+}
+
+
+/*
+ * benchmark.c
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: koldar
+ */
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <ctype.h>
+#include <math.h>
+#include <unistd.h>
+#include <sys/syscall.h>
+
+
+
+
+
+
+static void ct_end_benchmark(struct ct_model* model);
+static bool ct_pin_benchmark(struct ct_benchmark* benchmark, int cpu);
+static void ct_flush_cache(struct ct_benchmark* benchmark);
+static int ct_compare_times(const void* a, const void* b);
+static void ct_count_benchmark_allocations(struct ct_model* model, struct ct_benchmark_point* point);
+static FILE* ct_open_curve_file(const char* directory, const char* name, const char* extension);
+
+long ct_start_benchmark(struct ct_model* model, const char* parameter_name, long from, long to) {
+	if (from < 1 || to < from) {
+		fprintf(stderr, "CrashC - the parameter of a benchmark needs to go from a positive value to a greater or equal one, not from %ld to %ld\n", from, to);
+		model->current_snapshot->status = CT_SNAPSHOT_FAILED;
+		return from;
+	}
+
+	ct_allocation_tracker_pause();
+
+	struct ct_benchmark* benchmark = malloc(sizeof(struct ct_benchmark));
+	struct ct_benchmark_report* report = malloc(sizeof(struct ct_benchmark_report));
+	if (benchmark == NULL || report == NULL) {
+		CT_MALLOC_ERROR_CALLBACK();
+	}
+
+	report->parameter_name = parameter_name;
+	report->points_number = 1;
+	for (long value = from; value <= to / 2; value *= 2) {
+		report->points_number += 1;
+	}
+	report->points = malloc(sizeof(struct ct_benchmark_point) * report->points_number);
+	if (report->points == NULL) {
+		CT_MALLOC_ERROR_CALLBACK();
+	}
+	for (int i = 0; i < report->points_number; i++) {
+		report->points[i].parameter = from << i;
+		report->points[i].iterations = 1;
+		report->points[i].time = 0;
+		report->points[i].time_low = 0;
+		report->points[i].time_high = 0;
+		report->points[i].outliers = 0;
+		report->points[i].allocations = 0;
+		report->points[i].allocated_bytes = 0;
+		report->points[i].frees = 0;
+	}
+	report->complexity = CT_COMPLEXITY_CONSTANT;
+	report->coefficient = 0;
+	report->error = 0;
+	report->cpu = -1;
+	report->cold_cache = model->benchmark_cold_cache;
+	report->allocations_counted = model->allocation_tracker->enabled;
+
+	benchmark->report = report;
+	benchmark->description = model->current_section->description;
+	benchmark->point = 0;
+	benchmark->sample = report->cold_cache ? 0 : -1;
+	benchmark->iteration = -1;
+	benchmark->flush_buffer = NULL;
+	benchmark->flush_size = 0;
+	if (report->cold_cache) {
+		benchmark->flush_size = sysconf(_SC_LEVEL3_CACHE_SIZE);
+		if (benchmark->flush_size <= 0) {
+			benchmark->flush_size = CT_BENCHMARK_DEFAULT_CACHE_SIZE;
+		}
+		benchmark->flush_buffer = calloc(benchmark->flush_size, 1);
+		if (benchmark->flush_buffer == NULL) {
+			CT_MALLOC_ERROR_CALLBACK();
+		}
+	}
+	model->benchmark = benchmark;
+	ct_allocation_tracker_resume();
+
+	if (model->benchmark_cpu >= 0 && ct_pin_benchmark(benchmark, model->benchmark_cpu)) {
+		report->cpu = model->benchmark_cpu;
+	}
+	//with the CPU pinned, since a different CPU may run at a different frequency
+	report->warmup_time = ct_benchmark_warmup();
+
+	return from;
+}
+
+bool ct_benchmark_next(struct ct_model* model, long* parameter) {
+	//the clock is read first, so that the bookkeeping is not measured
+	struct timespec now = ct_get_time();
+	struct ct_benchmark* benchmark = model->benchmark;
+	if (benchmark == NULL) {
+		//the range of the parameter was not valid
+		return false;
+	}
+	struct ct_benchmark_point* point = &benchmark->report->points[benchmark->point];
+
+	if (benchmark->iteration >= 0 && benchmark->sample < 0) {
+		//the body has warmed up the cache
+		benchmark->sample = 0;
+	} else if (benchmark->iteration >= 0) {
+		benchmark->iteration += 1;
+		if (benchmark->iteration < point->iterations) {
+			return true;
+		}
+
+		long elapsed = ct_compute_time_gap(benchmark->sample_start, now, "n");
+		if (benchmark->sample == 0 && elapsed < CT_BENCHMARK_MIN_SAMPLE_TIME && benchmark->flush_buffer == NULL) {
+			//the sample is too short to be measured precisely: it's discarded and the next one runs the body twice as many times
+			point->iterations *= 2;
+		} else {
+			benchmark->samples[benchmark->sample] = ((double) elapsed) / point->iterations;
+			benchmark->sample += 1;
+			ct_count_benchmark_allocations(model, point);
+		}
+
+		if (benchmark->sample == CT_BENCHMARK_SAMPLES) {
+			ct_estimate_benchmark_time(benchmark->samples, CT_BENCHMARK_SAMPLES, point);
+			//the samples have accumulated the counts of all their runs
+			point->allocations /= CT_BENCHMARK_SAMPLES * point->iterations;
+			point->allocated_bytes /= CT_BENCHMARK_SAMPLES * point->iterations;
+			point->frees /= CT_BENCHMARK_SAMPLES * point->iterations;
+			benchmark->point += 1;
+			benchmark->sample = (benchmark->flush_buffer != NULL) ? 0 : -1;
+			if (benchmark->point == benchmark->report->points_number) {
+				ct_end_benchmark(model);
+				return false;
+			}
+			*parameter = benchmark->report->points[benchmark->point].parameter;
+		}
+	}
+
+	benchmark->iteration = 0;
+	if (benchmark->sample >= 0) {
+		if (benchmark->flush_buffer != NULL) {
+			ct_flush_cache(benchmark);
+		}
+		ct_allocation_tracker_read(model->allocation_tracker, model->current_snapshot,
+				&benchmark->sample_allocations, &benchmark->sample_allocated_bytes, &benchmark->sample_frees
+		);
+		benchmark->sample_start = ct_get_time();
+	}
+	return true;
+}
+
+void ct_estimate_benchmark_time(double* samples, int samples_number, struct ct_benchmark_point* point) {
+	qsort(samples, samples_number, sizeof(double), ct_compare_times);
+
+	//Tukey's fences: since the samples are sorted, the ones left form a range
+	double first_quartile = samples[samples_number / 4];
+	double third_quartile = samples[(3 * samples_number) / 4];
+	double fence = 1.5 * (third_quartile - first_quartile);
+	int first = 0;
+	int last = samples_number;
+	while (first < last && samples[first] < first_quartile - fence) {
+		first += 1;
+	}
+	while (last > first && samples[last - 1] > third_quartile + fence) {
+		last -= 1;
+	}
+	int kept = last - first;
+
+	double sum = 0;
+	for (int i = first; i < last; i++) {
+		sum += samples[i];
+	}
+	point->time = sum / kept;
+	point->outliers = samples_number - kept;
+
+	//the means of the samples drawn with replacement, generated by a fixed xorshift so that the interval is reproducible
+	double means[CT_BENCHMARK_BOOTSTRAP_RESAMPLES];
+	unsigned long state = 0x9E3779B97F4A7C15UL;
+	for (int r = 0; r < CT_BENCHMARK_BOOTSTRAP_RESAMPLES; r++) {
+		double resample_sum = 0;
+		for (int i = 0; i < kept; i++) {
+			state ^= state << 13;
+			state ^= state >> 7;
+			state ^= state << 17;
+			resample_sum += samples[first + (state % kept)];
+		}
+		means[r] = resample_sum / kept;
+	}
+	qsort(means, CT_BENCHMARK_BOOTSTRAP_RESAMPLES, sizeof(double), ct_compare_times);
+
+	int tail = (int) (CT_BENCHMARK_BOOTSTRAP_RESAMPLES * (1 - CT_BENCHMARK_CONFIDENCE) / 2);
+	point->time_low = means[tail];
+	point->time_high = means[CT_BENCHMARK_BOOTSTRAP_RESAMPLES - 1 - tail];
+}
+
+long ct_benchmark_warmup() {
+	struct timespec start = ct_get_time();
+	long previous_chunk = -1;
+	int stable_chunks = 0;
+	long elapsed = 0;
+
+	while (stable_chunks < CT_BENCHMARK_WARMUP_STABLE_CHUNKS && elapsed < CT_BENCHMARK_MAX_WARMUP_TIME) {
+		struct timespec chunk_start = ct_get_time();
+		volatile long counter = 0;
+		for (long i = 0; i < (1L << 16); i++) {
+			counter += i;
+		}
+		struct timespec chunk_end = ct_get_time();
+
+		long chunk = ct_compute_time_gap(chunk_start, chunk_end, "n");
+		if (previous_chunk >= 0 && labs(chunk - previous_chunk) <= previous_chunk * CT_BENCHMARK_WARMUP_TOLERANCE) {
+			stable_chunks += 1;
+		} else {
+			stable_chunks = 0;
+		}
+		previous_chunk = chunk;
+		elapsed = ct_compute_time_gap(start, chunk_end, "n");
+	}
+
+	return elapsed;
+}
+
+void ct_fit_complexity(struct ct_benchmark_report* report) {
+	double mean = 0;
+	for (int i = 0; i < report->points_number; i++) {
+		mean += report->points[i].time;
+	}
+	mean /= report->points_number;
+
+	bool fitted = false;
+	for (enum ct_complexity complexity = CT_COMPLEXITY_CONSTANT; complexity <= CT_COMPLEXITY_CUBIC; complexity++) {
+		//the least squares of time = coefficient * f(n)
+		double products = 0;
+		double squares = 0;
+		for (int i = 0; i < report->points_number; i++) {
+			double f = ct_complexity_function(complexity, report->points[i].parameter);
+			products += f * report->points[i].time;
+			squares += f * f;
+		}
+		if (squares == 0) {
+			continue;
+		}
+
+		double coefficient = products / squares;
+		double residuals = 0;
+		for (int i = 0; i < report->points_number; i++) {
+			double residual = report->points[i].time - coefficient * ct_complexity_function(complexity, report->points[i].parameter);
+			residuals += residual * residual;
+		}
+		double error = (mean > 0) ? sqrt(residuals / report->points_number) / mean : 0;
+
+		//with the same error, the simplest class wins
+		if (!fitted || error < report->error) {
+			fitted = true;
+			report->complexity = complexity;
+			report->coefficient = coefficient;
+			report->error = error;
+		}
+	}
+}
+
+double ct_complexity_function(enum ct_complexity complexity, long n) {
+	double x = n;
+
+	switch (complexity) {
+	case CT_COMPLEXITY_CONSTANT: return 1;
+	case CT_COMPLEXITY_LOGARITHMIC: return log2(x);
+	case CT_COMPLEXITY_LINEAR: return x;
+	case CT_COMPLEXITY_LINEARITHMIC: return x * log2(x);
+	case CT_COMPLEXITY_QUADRATIC: return x * x;
+	case CT_COMPLEXITY_CUBIC: return x * x * x;
+	default: return 0;
+	}
+}
+
+const char* ct_complexity_to_string(enum ct_complexity complexity) {
+	switch (complexity) {
+	case CT_COMPLEXITY_CONSTANT: return "O(1)";
+	case CT_COMPLEXITY_LOGARITHMIC: return "O(log n)";
+	case CT_COMPLEXITY_LINEAR: return "O(n)";
+	case CT_COMPLEXITY_LINEARITHMIC: return "O(n log n)";
+	case CT_COMPLEXITY_QUADRATIC: return "O(n^2)";
+	case CT_COMPLEXITY_CUBIC: return "O(n^3)";
+	default: return "UNKNOWN";
+	}
+}
+
+bool ct_write_benchmark_curve(const struct ct_benchmark_report* report, const char* directory, const char* description) {
+	char name[CT_BUFFER_SIZE];
+	int length = 0;
+
+	for (const char* c = description; *c != '\0' && length < CT_BUFFER_SIZE / 2; c++) {
+		name[length++] = isalnum((unsigned char) *c) ? *c : '_';
+	}
+	name[length] = '\0';
+
+	//the same layout of a CSV written by CUtils csvProducer
+	FILE* csv = ct_open_curve_file(directory, name, "csv");
+	FILE* dat = ct_open_curve_file(directory, name, "dat");
+	FILE* script = ct_open_curve_file(directory, name, "gp");
+	if (csv == NULL || dat == NULL || script == NULL) {
+		fprintf(stderr, "CrashC - cannot write the curve of the benchmark \"%s\" into \"%s\"\n", description, directory);
+		if (csv != NULL) {
+			fclose(csv);
+		}
+		if (dat != NULL) {
+			fclose(dat);
+		}
+		if (script != NULL) {
+			fclose(script);
+		}
+		return false;
+	}
+
+	fprintf(csv, "sep=,\n");
+	fprintf(csv, "%s,iterations,time_ns,time_low_ns,time_high_ns,outliers,fitted_time_ns,allocations,allocated_bytes,frees\n", report->parameter_name);
+	for (int i = 0; i < report->points_number; i++) {
+		const struct ct_benchmark_point* point = &report->points[i];
+		double fitted = report->coefficient * ct_complexity_function(report->complexity, point->parameter);
+
+		fprintf(csv, "%ld,%ld,%.3f,%.3f,%.3f,%d,%.3f,%.3f,%.3f,%.3f\n",
+				point->parameter, point->iterations, point->time, point->time_low, point->time_high, point->outliers, fitted,
+				point->allocations, point->allocated_bytes, point->frees
+		);
+		fprintf(dat, "%ld %.3f %.3f %.3f %.3f\n", point->parameter, point->time, fitted, point->time_low, point->time_high);
+	}
+
+	//the same script CUtils Plot2DHelper generates, with a logarithmic x axis since the parameter doubles at every point
+	fprintf(script, "reset\n");
+	fprintf(script, "set term png\n");
+	fprintf(script, "set output \"%s/%s.png\"\n", directory, name);
+	fprintf(script, "set title \"%s\\n(%s, %.3g ns)\"\n", name, ct_complexity_to_string(report->complexity), report->coefficient);
+	fprintf(script, "set xlabel \"%s\"\n", report->parameter_name);
+	fprintf(script, "set ylabel \"time (ns)\"\n");
+	fprintf(script, "set logscale x 2\n");
+	fprintf(script, "set xtic rotate\n");
+	fprintf(script, "unset logscale y\n");
+	fprintf(script, "set grid\n");
+	fprintf(script, "plot \"%s/%s.dat\" using 1:2:4:5 title \"measured\" with yerrorlines, ", directory, name);
+	fprintf(script, "\"%s/%s.dat\" using 1:3 title \"%s\" with lines\n", directory, name, ct_complexity_to_string(report->complexity));
+
+	fclose(csv);
+	fclose(dat);
+	fclose(script);
+	return true;
+}
+
+void ct_destroy_benchmark_report(struct ct_benchmark_report* report) {
+	free(report->points);
+	free(report);
+}
+
+void ct_destroy_benchmark(struct ct_benchmark* benchmark) {
+	if (benchmark->report != NULL && benchmark->report->cpu >= 0) {
+		syscall(SYS_sched_setaffinity, 0, sizeof(benchmark->previous_affinity), benchmark->previous_affinity);
+	}
+	if (benchmark->report != NULL) {
+		ct_destroy_benchmark_report(benchmark->report);
+	}
+	free((char*) benchmark->flush_buffer);
+	free(benchmark);
+}
+
+/**
+ * Fits the measurements of the benchmark running right now, stores them in struct ct_model::current_snapshot and disposes of the benchmark
+ *
+ * @param[inout] model the model to handle
+ */
+static void ct_end_benchmark(struct ct_model* model) {
+	struct ct_benchmark* benchmark = model->benchmark;
+
+	ct_allocation_tracker_pause();
+	if (benchmark->report->cpu >= 0) {
+		syscall(SYS_sched_setaffinity, 0, sizeof(benchmark->previous_affinity), benchmark->previous_affinity);
+	}
+	ct_fit_complexity(benchmark->report);
+	if (model->benchmark_output != NULL) {
+		ct_write_benchmark_curve(benchmark->report, model->benchmark_output, benchmark->description);
+	}
+	if (model->current_snapshot->benchmark != NULL) {
+		ct_destroy_benchmark_report(model->current_snapshot->benchmark);
+	}
+	model->current_snapshot->benchmark = benchmark->report;
+	long bound;
+	if (benchmark->report->allocations_counted && model->current_snapshot->status == CT_SNAPSHOT_OK
+			&& ct_tag_ht_get_number(model->current_snapshot->tags, CT_MAX_ALLOCATIONS_TAG, &bound)) {
+		for (int i = 0; i < benchmark->report->points_number; i++) {
+			if (benchmark->report->points[i].allocations > bound) {
+				model->current_snapshot->status = CT_SNAPSHOT_OVER_ALLOCATED;
+			}
+		}
+	}
+	benchmark->report = NULL;
+	ct_destroy_benchmark(benchmark);
+	model->benchmark = NULL;
+	ct_allocation_tracker_resume();
+}
+
+/**
+ * Opens for writing a file of the curve of a benchmark
+ *
+ * @param[in] directory the directory containing the file
+ * @param[in] name the name of the file, without extension
+ * @param[in] extension the extension of the file
+ * @return the file just opened or @null if it can't be opened
+ */
+static FILE* ct_open_curve_file(const char* directory, const char* name, const char* extension) {
+	size_t size = strlen(directory) + strlen(name) + strlen(extension) + 3;
+	char* path = malloc(size);
+	if (path == NULL) {
+		CT_MALLOC_ERROR_CALLBACK();
+	}
+
+	snprintf(path, size, "%s/%s.%s", directory, name, extension);
+	FILE* ret_val = fopen(path, "w");
+	free(path);
+	return ret_val;
+}
+
+/**
+ * Adds to a value of the parameter the blocks the body has allocated and released during the sample just ended
+ *
+ * @param[in] model the model whose struct ct_model::benchmark is running
+ * @param[inout] point the value the sample has been measured for
+ */
+static void ct_count_benchmark_allocations(struct ct_model* model, struct ct_benchmark_point* point) {
+	struct ct_benchmark* benchmark = model->benchmark;
+	unsigned long allocations;
+	size_t allocated_bytes;
+	unsigned long frees;
+
+	ct_allocation_tracker_read(model->allocation_tracker, model->current_snapshot, &allocations, &allocated_bytes, &frees);
+	point->allocations += allocations - benchmark->sample_allocations;
+	point->allocated_bytes += allocated_bytes - benchmark->sample_allocated_bytes;
+	point->frees += frees - benchmark->sample_frees;
+}
+
+/**
+ * Pins the thread running a benchmark to a CPU, saving the CPUs it could run on before
+ *
+ * The system call is used directly since \c sched_setaffinity and \c cpu_set_t are declared only with \c _GNU_SOURCE
+ *
+ * @param[inout] benchmark the benchmark to pin
+ * @param[in] cpu the CPU to pin the benchmark to
+ * @return @true if the benchmark has been pinned, @false otherwise
+ */
+static bool ct_pin_benchmark(struct ct_benchmark* benchmark, int cpu) {
+	unsigned long affinity[CT_BENCHMARK_AFFINITY_WORDS];
+	const int word_bits = 8 * sizeof(unsigned long);
+
+	if (cpu >= CT_BENCHMARK_AFFINITY_WORDS * word_bits) {
+		fprintf(stderr, "CrashC - cannot pin the benchmark \"%s\" to CPU %d: CrashC handles at most %d CPUs\n",
+				benchmark->description, cpu, CT_BENCHMARK_AFFINITY_WORDS * word_bits
+		);
+		return false;
+	}
+	memset(affinity, 0, sizeof(affinity));
+	affinity[cpu / word_bits] = 1UL << (cpu % word_bits);
+	memset(benchmark->previous_affinity, 0, sizeof(benchmark->previous_affinity));
+
+	if (syscall(SYS_sched_getaffinity, 0, sizeof(benchmark->previous_affinity), benchmark->previous_affinity) < 0
+			|| syscall(SYS_sched_setaffinity, 0, sizeof(affinity), affinity) != 0) {
+		fprintf(stderr, "CrashC - cannot pin the benchmark \"%s\" to CPU %d: ", benchmark->description, cpu);
+		perror(NULL);
+		return false;
+	}
+	return true;
+}
+
+/**
+ * Evicts from the cache the data used by the body of a benchmark, by writing a buffer as large as the cache
+ *
+ * @param[inout] benchmark the benchmark whose struct ct_benchmark::flush_buffer needs to be written
+ */
+static void ct_flush_cache(struct ct_benchmark* benchmark) {
+	for (long i = 0; i < benchmark->flush_size; i += 64) {
+		benchmark->flush_buffer[i] += 1;
+	}
+}
+
+static int ct_compare_times(const void* a, const void* b) {
+	double time_a = *((const double*) a);
+	double time_b = *((const double*) b);
+
+	return (time_a > time_b) - (time_a < time_b);
+}
+/*
+ * binary_report.c
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: koldar
+ */
+
+#include <stdlib.h>
+#include <string.h>
+#include <stdio.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <unistd.h>
+
+
+
+
+
+
+
+
+/**
+ * The bytes preceding the payload of an event: its kind and the length of the payload
+ */
+#define CT_BINARY_EVENT_HEADER_SIZE 5
+
+static void ct_binary_snapshot_tree_report(struct ct_binary_writer* writer, struct ct_snapshot* snapshot);
+
+void ct_binary_report(struct ct_model* model) {
+	int fd = open(model->binary_report_path, O_WRONLY | O_CREAT | O_TRUNC, 0644);
+	if (fd < 0) {
+		fprintf(stderr, "CrashC - cannot create the binary report \"%s\"\n", model->binary_report_path);
+		return;
+	}
+
+	struct ct_binary_writer* writer = ct_init_binary_writer(fd);
+	ct_update_test_stats(model);
+
+	CT_ITERATE_ON_LIST(model->test_reports_list, report_cell, report, struct ct_test_report*) {
+		ct_binary_writer_start_event(writer, CT_BINARY_EVENT_TEST_START);
+		ct_binary_writer_u32(writer, report->repetition);
+		ct_binary_writer_string(writer, report->fuzz_input);
+		ct_binary_writer_end_event(writer);
+
+		ct_binary_snapshot_tree_report(writer, report->testcase_snapshot);
+
+		ct_binary_writer_start_event(writer, CT_BINARY_EVENT_TEST_END);
+		ct_binary_writer_u8(writer, report->outcome);
+		ct_binary_writer_end_event(writer);
+	}
+
+	struct ct_test_stats* stats = model->statistics;
+	ct_binary_writer_start_event(writer, CT_BINARY_EVENT_SUMMARY);
+	ct_binary_writer_u32(writer, stats->total_tests);
+	ct_binary_writer_u32(writer, stats->successful_tests);
+	ct_binary_writer_u32(writer, stats->failed_tests);
+	ct_binary_writer_u32(writer, stats->flaky_tests);
+	ct_binary_writer_end_event(writer);
+
+	if (!ct_binary_writer_flush(writer)) {
+		fprintf(stderr, "CrashC - cannot write the binary report \"%s\"\n", model->binary_report_path);
+	}
+	ct_destroy_binary_writer(writer);
+	close(fd);
+}
+
+/**
+ * Writes the events of a snapshot and of all its descendants
+ *
+ * @param[inout] writer the writer to use
+ * @param[in] snapshot the root of the snapshot tree to write
+ */
+static void ct_binary_snapshot_tree_report(struct ct_binary_writer* writer, struct ct_snapshot* snapshot) {
+	ct_binary_writer_start_event(writer, CT_BINARY_EVENT_SNAPSHOT_START);
+	ct_binary_writer_u8(writer, snapshot->type);
+	ct_binary_writer_u8(writer, snapshot->status);
+	ct_binary_writer_u32(writer, snapshot->signal_detected);
+	ct_binary_writer_u32(writer, snapshot->signal_code);
+	ct_binary_writer_u64(writer, snapshot->elapsed_time);
+	ct_binary_writer_u64(writer, snapshot->allocations);
+	ct_binary_writer_u64(writer, snapshot->allocated_bytes);
+	ct_binary_writer_u64(writer, snapshot->frees);
+	ct_binary_writer_u64(writer, snapshot->leaked_blocks);
+	ct_binary_writer_u64(writer, snapshot->leaked_bytes);
+	ct_binary_writer_string(writer, snapshot->description);
+	ct_binary_writer_end_event(writer);
+
+	CT_ITERATE_ON_LIST(snapshot->assertion_reports, assertion_cell, assertion, struct ct_assert_report*) {
+		ct_binary_writer_start_event(writer, CT_BINARY_EVENT_ASSERTION);
+		ct_binary_writer_u8(writer, assertion->passed);
+		ct_binary_writer_u32(writer, assertion->line_number);
+		ct_binary_writer_string(writer, assertion->asserted);
+		ct_binary_writer_string(writer, assertion->expected_str);
+		ct_binary_writer_string(writer, assertion->actual_str);
+		ct_binary_writer_string(writer, assertion->file_name);
+		ct_binary_writer_end_event(writer);
+	}
+
+	for (struct ct_snapshot* child = snapshot->first_child; child != NULL; child = child->next_sibling) {
+		ct_binary_snapshot_tree_report(writer, child);
+	}
+
+	ct_binary_writer_start_event(writer, CT_BINARY_EVENT_SNAPSHOT_END);
+	ct_binary_writer_end_event(writer);
+}
+
+struct ct_binary_writer* ct_init_binary_writer(int fd) {
+	struct ct_binary_writer* ret_val = malloc(sizeof(struct ct_binary_writer));
+	if (ret_val == NULL) {
+		CT_MALLOC_ERROR_CALLBACK();
+	}
+
+	ret_val->fd = fd;
+	ret_val->capacity = CT_BINARY_WRITER_BUFFER_SIZE;
+	ret_val->buffer = malloc(ret_val->capacity);
+	if (ret_val->buffer == NULL) {
+		CT_MALLOC_ERROR_CALLBACK();
+	}
+	ret_val->size = 0;
+	ret_val->event_start = 0;
+	ret_val->failed = false;
+
+	memcpy(ret_val->buffer, CT_BINARY_LOG_MAGIC, strlen(CT_BINARY_LOG_MAGIC));
+	ret_val->size = strlen(CT_BINARY_LOG_MAGIC);
+	ret_val->buffer[ret_val->size] = CT_BINARY_LOG_VERSION;
+	ret_val->size += 1;
+
+	return ret_val;
+}
+
+/**
+ * Writes some bytes into a file descriptor, retrying on partial writes
+ *
+ * @param[in] fd the file descriptor to write into
+ * @param[in] data the bytes to write
+ * @param[in] size the number of bytes inside \c data
+ * @return @true if every byte has been written, @false otherwise
+ */
+static bool ct_write_fully(int fd, const unsigned char* data, size_t size) {
+	while (size > 0) {
+		ssize_t written = write(fd, data, size);
+		if (written < 0) {
+			if (errno == EINTR) {
+				continue;
+			}
+			return false;
+		}
+		data += written;
+		size -= written;
+	}
+	return true;
+}
+
+/**
+ * Ensures the buffer of a writer can contain some more bytes
+ *
+ * The completed events are written into the file first; the buffer grows only if the current event alone doesn't fit in it.
+ *
+ * @param[inout] writer the writer to handle
+ * @param[in] needed the number of bytes to append
+ */
+static void ct_binary_writer_reserve(struct ct_binary_writer* writer, size_t needed) {
+	if (writer->size + needed <= writer->capacity) {
+		return;
+	}
+
+	if (writer->event_start > 0) {
+		if (!ct_write_fully(writer->fd, writer->buffer, writer->event_start)) {
+			writer->failed = true;
+		}
+		memmove(writer->buffer, writer->buffer + writer->event_start, writer->size - writer->event_start);
+		writer->size -= writer->event_start;
+		writer->event_start = 0;
+	}
+	while (writer->size + needed > writer->capacity) {
+		writer->capacity *= 2;
+		writer->buffer = realloc(writer->buffer, writer->capacity);
+		if (writer->buffer == NULL) {
+			CT_MALLOC_ERROR_CALLBACK();
+		}
+	}
+}
+
+/**
+ * Appends some bytes to the buffer of a writer, which needs to be able to contain them
+ *
+ * @param[inout] writer the writer to handle
+ * @param[in] value the value to append
+ * @param[in] bytes the number of least significant bytes of \c value to append, in little endian
+ */
+static void ct_binary_writer_integer(struct ct_binary_writer* writer, uint64_t value, int bytes) {
+	for (int i = 0; i < bytes; i++) {
+		writer->buffer[writer->size + i] = (unsigned char) (value >> (8 * i));
+	}
+	writer->size += bytes;
+}
+
+void ct_binary_writer_start_event(struct ct_binary_writer* writer, enum ct_binary_event_kind kind) {
+	writer->event_start = writer->size;
+	ct_binary_writer_reserve(writer, CT_BINARY_EVENT_HEADER_SIZE);
+	ct_binary_writer_integer(writer, kind, 1);
+	//the length of the payload is known only at the end of the event
+	ct_binary_writer_integer(writer, 0, 4);
+}
+
+void ct_binary_writer_end_event(struct ct_binary_writer* writer) {
+	size_t payload_start = writer->event_start + CT_BINARY_EVENT_HEADER_SIZE;
+	uint32_t length = writer->size - payload_start;
+
+	for (int i = 0; i < 4; i++) {
+		writer->buffer[writer->event_start + 1 + i] = (unsigned char) (length >> (8 * i));
+	}
+	writer->event_start = writer->size;
+}
+
+void ct_binary_writer_u8(struct ct_binary_writer* writer, uint8_t value) {
+	ct_binary_writer_reserve(writer, 1);
+	ct_binary_writer_integer(writer, value, 1);
+}
+
+void ct_binary_writer_u32(struct ct_binary_writer* writer, uint32_t value) {
+	ct_binary_writer_reserve(writer, 4);
+	ct_binary_writer_integer(writer, value, 4);
+}
+
+void ct_binary_writer_u64(struct ct_binary_writer* writer, uint64_t value) {
+	ct_binary_writer_reserve(writer, 8);
+	ct_binary_writer_integer(writer, value, 8);
+}
+
+void ct_binary_writer_string(struct ct_binary_writer* writer, const char* value) {
+	size_t length = (value != NULL) ? strlen(value) : 0;
+
+	ct_binary_writer_reserve(writer, 4 + length + 1);
+	ct_binary_writer_integer(writer, length, 4);
+	if (length > 0) {
+		memcpy(writer->buffer + writer->size, value, length);
+	}
+	writer->buffer[writer->size + length] = '\0';
+	writer->size += length + 1;
+}
+
+bool ct_binary_writer_flush(struct ct_binary_writer* writer) {
+	if (!ct_write_fully(writer->fd, writer->buffer, writer->size)) {
+		writer->failed = true;
+	}
+	writer->size = 0;
+	writer->event_start = 0;
+	return !writer->failed;
+}
+
+void ct_destroy_binary_writer(struct ct_binary_writer* writer) {
+	free(writer->buffer);
+	free(writer);
+}
+
+size_t ct_binary_log_header_size(const unsigned char* data, size_t size) {
+	size_t magic_size = strlen(CT_BINARY_LOG_MAGIC);
+
+	if (size < magic_size + 1 || memcmp(data, CT_BINARY_LOG_MAGIC, magic_size) != 0 || data[magic_size] != CT_BINARY_LOG_VERSION) {
+		return 0;
+	}
+	return magic_size + 1;
+}
+
+size_t ct_read_binary_event(const unsigned char* data, size_t size, struct ct_binary_event* event) {
+	if (size < CT_BINARY_EVENT_HEADER_SIZE) {
+		return 0;
+	}
+
+	size_t length = 0;
+	for (int i = 0; i < 4; i++) {
+		length |= ((size_t) data[1 + i]) << (8 * i);
+	}
+	if (length > size - CT_BINARY_EVENT_HEADER_SIZE) {
+		return 0;
+	}
+
+	event->kind = data[0];
+	event->payload = data + CT_BINARY_EVENT_HEADER_SIZE;
+	event->length = length;
+	event->offset = 0;
+	return CT_BINARY_EVENT_HEADER_SIZE + length;
+}
+
+/**
+ * Reads a little endian integer from the payload of an event
+ *
+ * @param[inout] event the event to read
+ * @param[in] bytes the number of bytes of the integer
+ * @return the value read, 0 if the payload has not enough bytes left
+ */
+static uint64_t ct_binary_event_integer(struct ct_binary_event* event, int bytes) {
+	uint64_t ret_val = 0;
+
+	if (event->offset + bytes > event->length) {
+		event->offset = event->length;
+		return 0;
+	}
+	for (int i = 0; i < bytes; i++) {
+		ret_val |= ((uint64_t) event->payload[event->offset + i]) << (8 * i);
+	}
+	event->offset += bytes;
+	return ret_val;
+}
+
+uint8_t ct_binary_event_u8(struct ct_binary_event* event) {
+	return (uint8_t) ct_binary_event_integer(event, 1);
+}
+
+uint32_t ct_binary_event_u32(struct ct_binary_event* event) {
+	return (uint32_t) ct_binary_event_integer(event, 4);
+}
+
+uint64_t ct_binary_event_u64(struct ct_binary_event* event) {
+	return ct_binary_event_integer(event, 8);
+}
+
+const char* ct_binary_event_string(struct ct_binary_event* event) {
+	size_t length = ct_binary_event_u32(event);
+
+	if (event->offset + length + 1 > event->length || event->payload[event->offset + length] != '\0') {
+		event->offset = event->length;
+		return "";
+	}
+
+	const char* ret_val = (const char*) (event->payload + event->offset);
+	event->offset += length + 1;
+	return ret_val;
+}
+/**
+ * @file
+ *
+ * @author koldar
+ * @date Oct 9, 2017
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <getopt.h>
+#include <stdbool.h>
+#include <unistd.h>
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+static struct option long_options[] = {
+	{"include_tag",		required_argument,	0,	'i'},
+	{"include_tags",	required_argument,	0,	'I'},
+	{"exclude_tag",		required_argument,	0,	'e'},
+	{"exclude_tags",	required_argument,	0,	'E'},
+	{"schedule_seeds",	required_argument,	0,	's'},
+	{"schedule_seed",	required_argument,	0,	'S'},
+	{"workers",			required_argument,	0,	'w'},
+	{"corpus",			required_argument,	0,	'c'},
+	{"repeat",			required_argument,	0,	'r'},
+	{"binary_report",	required_argument,	0,	'b'},
+	{"progress",		no_argument,		0,	'p'},
+	{"history",			required_argument,	0,	'H'},
+	{"section",			required_argument,	0,	'P'},
+	{"fork_sections",	no_argument,		0,	'f'},
+	{"capture_output",	no_argument,		0,	'C'},
+	{"journal",			required_argument,	0,	'j'},
+	{"resume",			no_argument,		0,	'R'},
+	{"order",			required_argument,	0,	'O'},
+	{"coordinator",		required_argument,	0,	'D'},
+	{"worker",			required_argument,	0,	'W'},
+	{"coverage_index",	required_argument,	0,	'g'},
+	{"collect_coverage",	no_argument,		0,	'G'},
+	{"changed_files",	required_argument,	0,	'X'},
+	{"benchmark_output",	required_argument,	0,	'B'},
+	{"benchmark_cpu",	required_argument,	0,	'a'},
+	{"cold_cache",		no_argument,		0,	'F'},
+	{"resource_usage",	no_argument,		0,	'u'},
+	{"hardware_counters",	no_argument,		0,	'K'},
+	{"help",			no_argument,		0,	'h'},
+	{0,					0,					0,	0}
+};
+
+void ct_print_help(FILE* fout) {
+	int i = 0;
+	struct option o;
+
+	while (true) {
+		o = long_options[i];
+		if (o.name == NULL) {
+			return;
+		}
+
+		fprintf(fout, "-%c, --%s: ", o.val, o.name);
+
+		switch (o.val) {
+		case 'h': {
+			fprintf(fout, "Show this help");
+			break;
+		}
+		case 'i': {
+			fprintf(fout,
+					"Adds a tagname in the \"Run Only\" set. "
+					"A section is run only if it contains at least a tagname within such set. "
+					"Can be defined multiple times.  If a tag is inside both 'e' and 'i', 'e' has the precedence."
+			);
+			break;
+		}
+		case 'e': {
+			fprintf(fout,
+					"Adds a tagname in the \"Exclude Test\" set. "
+					"A section isn't run if it contains even one tagname within such set. "
+					"Can be defined multiple times. If a tag is inside both 'e' and 'i', this set has the precedence."
+			);
+			break;
+		}
+		case 'I': {
+			fprintf(fout,
+					"Like \"i\", but allows to specify multiple tags. Tags are separated via \"%c\". "
+					"Can be defined multiple times.",
+					CT_TAGS_SEPARATOR
+			);
+			break;
+		}
+		case 'E': {
+			fprintf(fout,
+					"Like \"e\", but allows to specify multiple tags. Tags are separated via \"%c\". "
+					"Can be defined multiple times.",
+					CT_TAGS_SEPARATOR
+			);
+			break;
+		}
+		case 's': {
+			fprintf(fout,
+					"Serializes the threads of every STRESS section and explores the given number of thread interleavings. "
+					"Each interleaving is generated by a seed and run in its own process."
+			);
+			break;
+		}
+		case 'S': {
+			fprintf(fout,
+					"Replays only the thread interleaving generated by the given seed in every STRESS section. "
+					"Overrides \"s\"."
+			);
+			break;
+		}
+		case 'c': {
+			fprintf(fout,
+					"The directory containing the inputs every FUZZ_TESTCASE is run with. "
+					"Without it, a FUZZ_TESTCASE is run only with the empty input."
+			);
+			break;
+		}
+		case 'r': {
+			fprintf(fout,
+					"Runs every test suite the given number of times and flags as flaky the tests whose outcome changes among the runs."
+			);
+			break;
+		}
+		case 'b': {
+			fprintf(fout,
+					"Writes the outcome of the tests in the given file as a binary event log instead of printing the textual report. "
+					"Render it with the crashc-report tool."
+			);
+			break;
+		}
+		case 'p': {
+			fprintf(fout,
+					"Shows on the terminal how many tests have ended and an estimate of the remaining time while the tests are running."
+			);
+			break;
+		}
+		case 'H': {
+			fprintf(fout,
+					"The file where the timings of the tests are stored at the end of the run. "
+					"The timings of the previous run are used to estimate the remaining time."
+			);
+			break;
+		}
+		case 'P': {
+			fprintf(fout,
+					"Runs only the section with the given path, namely the descriptions of the test case and of the nested sections separated by '/' "
+					"(e.g. \"list/adding on tail/size increments\"). Its ancestors are entered as well, every other section is skipped."
+			);
+			break;
+		}
+		case 'f': {
+			fprintf(fout,
+					"Runs every WHEN in a forked process, so that the code preceding a WHEN is run once and not once per nested section. "
+					"The outcomes don't change only if such code has no side effects outside the process, like writing files."
+			);
+			break;
+		}
+		case 'C': {
+			fprintf(fout,
+					"Captures what every test writes on the standard output and on the standard error. "
+					"The output is shown in the report of the failed tests and thrown away for the successful ones."
+			);
+			break;
+		}
+		case 'j': {
+			fprintf(fout,
+					"Appends every test to the given journal as soon as it ends, so that the outcomes survive a killed test process. "
+					"The summary of the journal is shown by \"crashc-report --journal\"."
+			);
+			break;
+		}
+		case 'O': {
+			fprintf(fout,
+					"The order the test suites are run in: \"declaration\" (the default), \"durations\" to run first the ones which took longer "
+					"or \"failures\" to run first the ones which failed more often. The two latter need the history file given with \"H\". "
+					"The report keeps the declaration order."
+			);
+			break;
+		}
+		case 'D': {
+			fprintf(fout,
+					"Serves the test cases on the given address, either \"unix:PATH\" or \"tcp:HOST:PORT\", to the local workers (see \"w\") "
+					"and to the workers joining with \"W\". Every test case is run by the first worker claiming it, and the report contains the tests of every worker."
+			);
+			break;
+		}
+		case 'W': {
+			fprintf(fout,
+					"Runs the test cases for the coordinator listening on the given address. "
+					"The worker needs to be the same test executable, run with the same options, as the coordinator."
+			);
+			break;
+		}
+		case 'g': {
+			fprintf(fout,
+					"The index of the source files covered by every test case, written by \"G\" and read by \"X\"."
+			);
+			break;
+		}
+		case 'G': {
+			fprintf(fout,
+					"Collects the source files covered by every test case into the index given with \"g\". "
+					"CrashC and the tests need to be built with --coverage and CT_COVERAGE (cmake -DU_COVERAGE=true)."
+			);
+			break;
+		}
+		case 'X': {
+			fprintf(fout,
+					"Runs only the test cases covering the files listed, one per line, in the given file (\"-\" for the standard input), "
+					"like the ones printed by \"git diff --name-only\". The coverage is read from the index given with \"g\": "
+					"the test cases missing from it are run, and a changed file missing from it runs every test case."
+			);
+			break;
+		}
+		case 'B': {
+			fprintf(fout,
+					"Writes into the given directory the curve of every benchmark, as a CSV file and as a gnuplot script drawing it."
+			);
+			break;
+		}
+		case 'a': {
+			fprintf(fout,
+					"Pins the benchmarks to the given CPU, ideally one isolated from the scheduler with the isolcpus kernel parameter."
+			);
+			break;
+		}
+		case 'F': {
+			fprintf(fout,
+					"Measures the benchmarks with a cold cache, by writing a buffer as large as the last level cache before every sample. "
+					"By default the cache is warmed up by running the body once before measuring it."
+			);
+			break;
+		}
+		case 'u': {
+			fprintf(fout,
+					"Measures the operating system resources (memory, page faults, context switches, CPU time) consumed by every section and reports them."
+			);
+			break;
+		}
+		case 'K': {
+			fprintf(fout,
+					"Reads the hardware performance counters (instructions, cycles, cache and branch misses) while every section runs "
+					"and reports them together with its elapsed time. The counters are opened only when this option is given."
+			);
+			break;
+		}
+		case 'R': {
+			fprintf(fout,
+					"Keeps the content of the journal given with \"j\" and skips the test cases it has already completed."
+			);
+			break;
+		}
+		case 'w': {
+			fprintf(fout,
+					"The maximum number of processes exploring thread interleavings or replaying fuzzing inputs at the same time, "
+					"and the number of local workers of a coordinator. "
+					"By default, the number of online CPUs."
+			);
+			break;
+		}
+		}
+
+		fprintf(fout, "\n");
+
+		i++;
+	}
+}
+
+void ct_parse_args(const int argc, char* const* args, char tag_separator, struct ct_model* model) {
+	ct_tag_hashtable_o* run_tags = model->run_only_if_tags;
+	ct_tag_hashtable_o* exclude_tags = model->exclude_tags;
+
+	while (true) {
+		/* getopt_long stores the option index here. */
+		int option_index = 0;
+
+		int optionId = getopt_long (argc, args, "i:I:e:E:s:S:w:c:r:b:pH:P:fCj:RO:D:W:g:GX:B:a:FuK", long_options, &option_index);
+
+		/* Detect the end of the options. */
+		if (optionId == -1)
+			break;
+
+		switch (optionId) {
+		case 0: {
+			//Only flags have the id set to 0.
+			break;
+		}
+		case 'h': {
+			ct_print_help(stdout);
+			//TODO create an exit macro like CORRECT_EXIT_MACRO
+			exit(0);
+			break;
+		}
+		case 'i': {
+			ct_tag_ht_put(run_tags, optarg);
+			break;
+		}
+		case 'e': {
+			ct_tag_ht_put(exclude_tags, optarg);
+			break;
+		}
+		case 'I': {
+			ct_tag_ht_populate(run_tags, optarg, tag_separator);
+			break;
+		}
+		case 'E': {
+			ct_tag_ht_populate(exclude_tags, optarg, tag_separator);
+			break;
+		}
+		case 's': {
+			model->schedule_seeds = strtol(optarg, NULL, 10);
+			break;
+		}
+		case 'S': {
+			model->schedule_replay_seed = strtol(optarg, NULL, 10);
+			break;
+		}
+		case 'w': {
+			model->workers = (int) strtol(optarg, NULL, 10);
+			break;
+		}
+		case 'r': {
+			model->repetitions = (int) strtol(optarg, NULL, 10);
+			break;
+		}
+		case 'c': {
+			model->corpus_path = optarg;
+			break;
+		}
+		case 'b': {
+			model->binary_report_path = optarg;
+			model->report_producer_implementation->report_producer = ct_binary_report;
+			break;
+		}
+		case 'p': {
+			model->show_progress = true;
+			break;
+		}
+		case 'H': {
+			model->history_path = optarg;
+			break;
+		}
+		case 'P': {
+			ct_select_section_path(model, optarg);
+			break;
+		}
+		case 'f': {
+			if (model->section_fork == NULL) {
+				model->section_fork = ct_init_section_fork();
+			}
+			break;
+		}
+		case 'j': {
+			model->journal_path = optarg;
+			break;
+		}
+		case 'R': {
+			model->resume = true;
+			break;
+		}
+		case 'D': {
+			model->coordinator_address = optarg;
+			break;
+		}
+		case 'W': {
+			model->worker_address = optarg;
+			break;
+		}
+		case 'g': {
+			model->coverage_index_path = optarg;
+			break;
+		}
+		case 'G': {
+			model->collect_coverage = true;
+			break;
+		}
+		case 'X': {
+			model->changed_files_path = optarg;
+			break;
+		}
+		case 'B': {
+			model->benchmark_output = optarg;
+			break;
+		}
+		case 'a': {
+			model->benchmark_cpu = (int) strtol(optarg, NULL, 10);
+			break;
+		}
+		case 'F': {
+			model->benchmark_cold_cache = true;
+			break;
+		}
+		case 'u': {
+			model->measure_resources = true;
+			break;
+		}
+		case 'K': {
+			if (model->hardware_counters == NULL) {
+				model->hardware_counters = ct_init_hardware_counters_group();
+			}
+			break;
+		}
+		case 'O': {
+			if (!ct_parse_suite_order(optarg, &model->suite_order)) {
+				fprintf(stderr, "CrashC - unknown order \"%s\": the test suites will be run in declaration order\n", optarg);
+			}
+			break;
+		}
+		case 'C': {
+			if (model->output_capture == NULL) {
+				model->output_capture = ct_init_output_capture();
+			}
+			break;
+		}
+		case '?': {
+			/* getopt_long already printed an error message. */
+			break;
+		}
+		default: {
+			abort();
+		}
+		}
+	}
+
+	//the progress line would only clutter a file or a pipe
+	if (model->show_progress || model->history_path != NULL) {
+		FILE* progress_output = (model->show_progress && isatty(fileno(stderr))) ? stderr : NULL;
+		//the standard error of the tests may be captured, but the progress line belongs to the terminal
+		if (progress_output != NULL && model->output_capture != NULL) {
+			progress_output = ct_output_capture_get_original_stderr(model->output_capture);
+		}
+		ct_enable_progress(model, progress_output, model->history_path);
+	}
+	if (model->journal_path != NULL) {
+		ct_enable_journal(model, model->journal_path, model->resume);
+	} else if (model->resume) {
+		fprintf(stderr, "CrashC - \"resume\" needs a journal to resume from: every test will be run\n");
+	}
+	if (model->coverage_index_path != NULL && model->collect_coverage) {
+		if (model->changed_files_path != NULL) {
+			fprintf(stderr, "CrashC - \"changed_files\" is ignored while collecting the coverage\n");
+		}
+		ct_enable_coverage(model, model->coverage_index_path, true, NULL);
+	} else if (model->coverage_index_path != NULL && model->changed_files_path != NULL) {
+		ct_enable_coverage(model, model->coverage_index_path, false, model->changed_files_path);
+	} else if (model->collect_coverage || model->changed_files_path != NULL) {
+		fprintf(stderr, "CrashC - the coverage needs an index given with \"coverage_index\": every test will be run\n");
+	}
+
+//  ACTIVATE IF YOU WANT TO SEE WHAT TAGS HAVE BEEN STORED
+//	CT_ITERATE_VALUES_ON_HT(runIfTags, t, struct ct_tag*) {
+//		printf("run if tag: %s\n", t->name);
+//	}
+//	CT_ITERATE_VALUES_ON_HT(excludeTags, t2, struct ct_tag*) {
+//		printf("exclude tag: %s\n", t2->name);
+//	}
+
+}
+/*
+ * coverage.c
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: koldar
+ */
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <stdint.h>
+#include <string.h>
+#include <dirent.h>
+#include <unistd.h>
+#include <sys/stat.h>
+#include <sys/types.h>
+
+
+
+
+
+
+
+
+
+
+#ifdef CT_COVERAGE
+//provided by libgcov, linked into the executables built with --coverage
+void __gcov_reset(void);
+void __gcov_dump(void);
+#endif
+
+/**
+ * The magic number starting a \c .gcda file
+ */
+#define CT_GCDA_MAGIC 0x67636461
+/**
+ * The tag of the record containing the counters of the arcs of a function
+ */
+#define CT_GCDA_ARCS_TAG 0x01a10000
+/**
+ * Since gcc 12 the header of a \c .gcda file has a checksum more and the length of the records is in bytes rather than in words.
+ * clang writes the format of the older gcc versions
+ */
+#if defined(__clang__) || !defined(__GNUC__) || __GNUC__ < 12
+#	define CT_GCDA_HEADER_WORDS 3
+#	define CT_GCDA_LENGTH_IN_BYTES false
+#else
+#	define CT_GCDA_HEADER_WORDS 4
+#	define CT_GCDA_LENGTH_IN_BYTES true
+#endif
+
+static struct ct_covered_file* ct_find_covered_file(const struct ct_coverage* coverage, const char* name) {
+	struct ct_covered_file* ret_val = ct_ht_get(coverage->files_index, (unsigned long) ct_string_hash(name));
+
+	if (ret_val == NULL || strcmp(ret_val->name, name) == 0) {
+		return ret_val;
+	}
+	//on a hash collision the files are looked for one by one
+	CT_ITERATE_ON_LIST(coverage->files, cell, file, struct ct_covered_file*) {
+		if (strcmp(file->name, name) == 0) {
+			return file;
+		}
+	}
+	return NULL;
+}
+
+static struct ct_covered_file* ct_add_covered_file(struct ct_coverage* coverage, const char* name) {
+	struct ct_covered_file* ret_val = malloc(sizeof(struct ct_covered_file));
+	if (ret_val == NULL) {
+		CT_MALLOC_ERROR_CALLBACK();
+	}
+	ret_val->name = strdup(name);
+	if (ret_val->name == NULL) {
+		CT_MALLOC_ERROR_CALLBACK();
+	}
+
+	ret_val->id = ct_list_size(coverage->files);
+	ct_list_add_tail(coverage->files, ret_val);
+	if (ct_ht_get(coverage->files_index, (unsigned long) ct_string_hash(name)) == NULL) {
+		ct_ht_put(coverage->files_index, (unsigned long) ct_string_hash(name), ret_val);
+	}
+
+	return ret_val;
+}
+
+static void ct_destroy_covered_file(struct ct_covered_file* file) {
+	free(file->name);
+	free(file);
+}
+
+static struct ct_covered_testcase* ct_add_covered_testcase(struct ct_coverage* coverage, const struct ct_testcase_key* key, int files_number, int* files) {
+	struct ct_covered_testcase* ret_val = malloc(sizeof(struct ct_covered_testcase));
+	if (ret_val == NULL) {
+		CT_MALLOC_ERROR_CALLBACK();
+	}
+
+	ret_val->key = *key;
+	ret_val->files_number = files_number;
+	ret_val->files = files;
+	ct_list_add_tail(coverage->testcases, ret_val);
+	if (ct_ht_get(coverage->testcases_index, ct_testcase_key_hash(key)) == NULL) {
+		ct_ht_put(coverage->testcases_index, ct_testcase_key_hash(key), ret_val);
+	}
+
+	return ret_val;
+}
+
+static void ct_destroy_covered_testcase(struct ct_covered_testcase* testcase) {
+	free(testcase->files);
+	free(testcase);
+}
+
+/**
+ * Checks whether a file of the index has the name of a changed file
+ *
+ * Only the names are compared, so that the paths printed by the version control system don't need to match the ones of the build directory.
+ *
+ * @param[in] file the file of the index
+ * @param[in] changed_file the path of the changed file
+ * @return @true if \c changed_file may be the source file of \c file
+ */
+static bool ct_covered_file_matches(const struct ct_covered_file* file, const char* changed_file) {
+	const char* file_name = strrchr(file->name, '/');
+	const char* changed_name = strrchr(changed_file, '/');
+	file_name = (file_name != NULL) ? file_name + 1 : file->name;
+	changed_name = (changed_name != NULL) ? changed_name + 1 : changed_file;
+
+	size_t length = strlen(file_name);
+	//the .gcda file of an object file doesn't have the extension of the source file
+	return strncmp(file_name, changed_name, length) == 0 && (changed_name[length] == '\0' || changed_name[length] == '.');
+}
+
+/**
+ * Reads a coverage index
+ *
+ * @param[inout] coverage the state to fill
+ * @param[in] path the index
+ */
+static void ct_load_coverage_index(struct ct_coverage* coverage, const char* path) {
+	FILE* file = fopen(path, "r");
+	if (file == NULL) {
+		perror("CrashC - cannot open the coverage index");
+		exit(EXIT_FAILURE);
+	}
+
+	char* line = NULL;
+	size_t line_size = 0;
+	ssize_t length;
+	while ((length = getline(&line, &line_size, file)) > 0) {
+		line[strcspn(line, "\n")] = '\0';
+		if (line[0] == 'F' && line[1] == ' ') {
+			ct_add_covered_file(coverage, &line[2]);
+			continue;
+		}
+
+		struct ct_testcase_key key;
+		int files_number;
+		int read;
+		if (sscanf(line, "T %lx %d %d%n", &key.path_hash, &key.occurrence, &files_number, &read) != 3 || files_number < 0) {
+			continue;
+		}
+		int* files = malloc(sizeof(int) * (files_number + 1));
+		if (files == NULL) {
+			CT_MALLOC_ERROR_CALLBACK();
+		}
+		char* next = &line[read];
+		for (int i = 0; i < files_number; i++) {
+			files[i] = (int) strtol(next, &next, 10);
+		}
+		ct_add_covered_testcase(coverage, &key, files_number, files);
+	}
+
+	free(line);
+	fclose(file);
+}
+
+/**
+ * Reads the changed files and marks the files of the index with their names
+ *
+ * @param[inout] coverage the state to handle
+ * @param[in] path the list of the changed files. \c "-" for the standard input
+ */
+static void ct_load_changed_files(struct ct_coverage* coverage, const char* path) {
+	FILE* file = (strcmp(path, "-") == 0) ? stdin : fopen(path, "r");
+	if (file == NULL) {
+		perror("CrashC - cannot open the list of the changed files");
+		exit(EXIT_FAILURE);
+	}
+
+	coverage->changed = calloc(ct_list_size(coverage->files) + 1, sizeof(bool));
+	if (coverage->changed == NULL) {
+		CT_MALLOC_ERROR_CALLBACK();
+	}
+
+	char* line = NULL;
+	size_t line_size = 0;
+	while (getline(&line, &line_size, file) > 0) {
+		line[strcspn(line, "\r\n")] = '\0';
+		if (line[0] == '\0') {
+			continue;
+		}
+		bool found = false;
+		CT_ITERATE_ON_LIST(coverage->files, cell, covered_file, struct ct_covered_file*) {
+			if (ct_covered_file_matches(covered_file, line)) {
+				coverage->changed[covered_file->id] = true;
+				found = true;
+			}
+		}
+		if (!found && !coverage->run_everything) {
+			fprintf(stderr, "CrashC - the changed file \"%s\" is not in the coverage index: every test case will be run\n", line);
+			coverage->run_everything = true;
+		}
+	}
+
+	free(line);
+	if (file != stdin) {
+		fclose(file);
+	}
+}
+
+/**
+ * Checks whether a \c .gcda file has a counter not zero
+ *
+ * @param[in] path the \c .gcda file
+ * @return @true if the code of the file has been run since the last reset of the counters
+ */
+static bool ct_gcda_file_covered(const char* path) {
+	FILE* file = fopen(path, "r");
+	if (file == NULL) {
+		return false;
+	}
+
+	bool ret_val = false;
+	uint32_t header[CT_GCDA_HEADER_WORDS];
+	if (fread(header, sizeof(uint32_t), CT_GCDA_HEADER_WORDS, file) != CT_GCDA_HEADER_WORDS || header[0] != CT_GCDA_MAGIC) {
+		fclose(file);
+		return false;
+	}
+
+	uint32_t record[2];
+	while (!ret_val && fread(record, sizeof(uint32_t), 2, file) == 2 && record[0] != 0) {
+		long length = CT_GCDA_LENGTH_IN_BYTES ? (long) (int32_t) record[1] : (long) record[1] * (long) sizeof(uint32_t);
+		//a negative length marks a record whose counters are all zero, written without them
+		if (length <= 0) {
+			continue;
+		}
+		if (record[0] != CT_GCDA_ARCS_TAG) {
+			fseek(file, length, SEEK_CUR);
+			continue;
+		}
+		for (long i = 0; i < length / (long) sizeof(uint64_t); i++) {
+			uint64_t counter;
+			if (fread(&counter, sizeof(counter), 1, file) != 1) {
+				break;
+			}
+			if (counter != 0) {
+				ret_val = true;
+				break;
+			}
+		}
+	}
+
+	fclose(file);
+	return ret_val;
+}
+
+/**
+ * Looks for the \c .gcda files dumped by gcov, collects the covered ones and removes them
+ *
+ * @param[inout] coverage the state to handle
+ * @param[in] directory the directory to look into
+ * @param[inout] files the struct ct_covered_file::id of the covered files
+ * @param[inout] files_number the number of items in \c files
+ * @param[inout] capacity the number of items \c files can contain
+ */
+static void ct_collect_gcda_files(struct ct_coverage* coverage, const char* directory, int** files, int* files_number, int* capacity) {
+	DIR* dir = opendir(directory);
+	if (dir == NULL) {
+		return;
+	}
+
+	struct dirent* entry;
+	struct stat file_stat;
+	char path[CT_BUFFER_SIZE * 4];
+	while ((entry = readdir(dir)) != NULL) {
+		if (strcmp(entry->d_name, ".") == 0 || strcmp(entry->d_name, "..") == 0) {
+			continue;
+		}
+		snprintf(path, sizeof(path), "%s/%s", directory, entry->d_name);
+		if (lstat(path, &file_stat) != 0) {
+			continue;
+		}
+		if (S_ISDIR(file_stat.st_mode)) {
+			ct_collect_gcda_files(coverage, path, files, files_number, capacity);
+			continue;
+		}
+
+		size_t length = strlen(path);
+		if (length <= 5 || strcmp(&path[length - 5], ".gcda") != 0) {
+			continue;
+		}
+		bool covered = ct_gcda_file_covered(path);
+		unlink(path);
+
+		//the name is the path the file would have had without GCOV_PREFIX
+		path[length - 5] = '\0';
+		const char* name = &path[strlen(coverage->directory)];
+		struct ct_covered_file* file = ct_find_covered_file(coverage, name);
+		if (file == NULL) {
+			file = ct_add_covered_file(coverage, name);
+		}
+		if (!covered) {
+			continue;
+		}
+		if (*files_number == *capacity) {
+			*capacity *= 2;
+			*files = realloc(*files, sizeof(int) * (*capacity));
+			if (*files == NULL) {
+				CT_MALLOC_ERROR_CALLBACK();
+			}
+		}
+		(*files)[*files_number] = file->id;
+		*files_number += 1;
+	}
+
+	closedir(dir);
+}
+
+static void ct_remove_directory(const char* directory) {
+	DIR* dir = opendir(directory);
+	if (dir == NULL) {
+		return;
+	}
+
+	struct dirent* entry;
+	struct stat file_stat;
+	char path[CT_BUFFER_SIZE * 4];
+	while ((entry = readdir(dir)) != NULL) {
+		if (strcmp(entry->d_name, ".") == 0 || strcmp(entry->d_name, "..") == 0) {
+			continue;
+		}
+		snprintf(path, sizeof(path), "%s/%s", directory, entry->d_name);
+		if (lstat(path, &file_stat) == 0 && S_ISDIR(file_stat.st_mode)) {
+			ct_remove_directory(path);
+		} else {
+			unlink(path);
+		}
+	}
+	closedir(dir);
+	rmdir(directory);
+}
+
+static void ct_write_coverage_index(const struct ct_coverage* coverage) {
+	FILE* file = fopen(coverage->index_path, "w");
+	if (file == NULL) {
+		perror("CrashC - cannot write the coverage index");
+		return;
+	}
+
+	CT_ITERATE_ON_LIST(coverage->files, cell, covered_file, struct ct_covered_file*) {
+		fprintf(file, "F %s\n", covered_file->name);
+	}
+	CT_ITERATE_ON_LIST(coverage->testcases, cell2, testcase, struct ct_covered_testcase*) {
+		fprintf(file, "T %lx %d %d", testcase->key.path_hash, testcase->key.occurrence, testcase->files_number);
+		for (int i = 0; i < testcase->files_number; i++) {
+			fprintf(file, " %d", testcase->files[i]);
+		}
+		fprintf(file, "\n");
+	}
+	fclose(file);
+}
+
+struct ct_coverage* ct_enable_coverage(struct ct_model* model, const char* index_path, bool collect, const char* changed_files_path) {
+	struct ct_coverage* ret_val = malloc(sizeof(struct ct_coverage));
+	if (ret_val == NULL) {
+		CT_MALLOC_ERROR_CALLBACK();
+	}
+
+	ret_val->collecting = collect;
+	ret_val->index_path = NULL;
+	ret_val->directory[0] = '\0';
+	ret_val->previous_prefix = NULL;
+	ret_val->files = ct_list_init();
+	ret_val->files_index = ct_ht_init();
+	ret_val->testcases = ct_list_init();
+	ret_val->testcases_index = ct_ht_init();
+	ret_val->changed = NULL;
+	ret_val->run_everything = false;
+	ret_val->testcase = NULL;
+	ret_val->selected = true;
+	ret_val->skipped_testcases = 0;
+
+	if (collect) {
+#ifndef CT_COVERAGE
+		fprintf(stderr, "CrashC - the coverage can be collected only if CrashC and the tests are built with --coverage and CT_COVERAGE\n");
+		exit(EXIT_FAILURE);
+#endif
+		ret_val->index_path = strdup(index_path);
+		if (ret_val->index_path == NULL) {
+			CT_MALLOC_ERROR_CALLBACK();
+		}
+		snprintf(ret_val->directory, sizeof(ret_val->directory), "/tmp/crashc-coverage-XXXXXX");
+		if (mkdtemp(ret_val->directory) == NULL) {
+			perror("CrashC - cannot create the directory of the coverage");
+			exit(EXIT_FAILURE);
+		}
+		const char* previous_prefix = getenv("GCOV_PREFIX");
+		if (previous_prefix != NULL) {
+			ret_val->previous_prefix = strdup(previous_prefix);
+		}
+		setenv("GCOV_PREFIX", ret_val->directory, 1);
+
+		if (model->section_fork != NULL) {
+			fprintf(stderr, "CrashC - \"fork_sections\" is ignored while collecting the coverage\n");
+			ct_destroy_section_fork(model->section_fork);
+			model->section_fork = NULL;
+		}
+		if (model->coordinator_address != NULL || model->worker_address != NULL) {
+			fprintf(stderr, "CrashC - the test cases are not distributed while collecting the coverage\n");
+			model->coordinator_address = NULL;
+			model->worker_address = NULL;
+		}
+	} else {
+		ct_load_coverage_index(ret_val, index_path);
+		ct_load_changed_files(ret_val, changed_files_path);
+	}
+
+	model->coverage = ret_val;
+	return ret_val;
+}
+
+bool ct_coverage_enter_testcase(struct ct_model* model, const struct ct_section* testcase) {
+	struct ct_coverage* coverage = model->coverage;
+
+	if (testcase == coverage->testcase) {
+		return coverage->selected;
+	}
+	coverage->testcase = testcase;
+	const struct ct_testcase_key* key = ct_get_testcase_key(model, testcase);
+
+	if (coverage->collecting) {
+#ifdef CT_COVERAGE
+		__gcov_reset();
+#endif
+		coverage->selected = true;
+		return true;
+	}
+
+	struct ct_covered_testcase* covered = ct_ht_get(coverage->testcases_index, ct_testcase_key_hash(key));
+	//on a hash collision the testcase is simply run
+	coverage->selected = coverage->run_everything || covered == NULL || covered->key.path_hash != key->path_hash || covered->key.occurrence != key->occurrence;
+	for (int i = 0; !coverage->selected && i < covered->files_number; i++) {
+		int id = covered->files[i];
+		coverage->selected = id >= 0 && id < ct_list_size(coverage->files) && coverage->changed[id];
+	}
+	if (!coverage->selected) {
+		coverage->skipped_testcases += 1;
+	}
+	return coverage->selected;
+}
+
+void ct_coverage_end_testcase(struct ct_model* model, const struct ct_section* testcase) {
+	struct ct_coverage* coverage = model->coverage;
+
+	if (!coverage->collecting || testcase != coverage->testcase) {
+		return;
+	}
+
+#ifdef CT_COVERAGE
+	__gcov_dump();
+#endif
+	ct_allocation_tracker_pause();
+	int capacity = 16;
+	int files_number = 0;
+	int* files = malloc(sizeof(int) * capacity);
+	if (files == NULL) {
+		CT_MALLOC_ERROR_CALLBACK();
+	}
+	ct_collect_gcda_files(coverage, coverage->directory, &files, &files_number, &capacity);
+	ct_add_covered_testcase(coverage, ct_get_testcase_key(model, testcase), files_number, files);
+	//the next calls refer to another testcase
+	coverage->testcase = NULL;
+	ct_allocation_tracker_resume();
+}
+
+void ct_destroy_coverage(struct ct_coverage* coverage) {
+	if (coverage->collecting) {
+		ct_write_coverage_index(coverage);
+		ct_remove_directory(coverage->directory);
+		if (coverage->previous_prefix != NULL) {
+			setenv("GCOV_PREFIX", coverage->previous_prefix, 1);
+		} else {
+			unsetenv("GCOV_PREFIX");
+		}
+	} else if (coverage->skipped_testcases > 0) {
+		fprintf(stderr, "CrashC - %d test cases not affected by the changed files have been skipped\n", coverage->skipped_testcases);
+	}
+
+	ct_list_destroy_with_elements(coverage->files, (ct_destroyer_c) ct_destroy_covered_file);
+	ct_ht_destroy(coverage->files_index);
+	ct_list_destroy_with_elements(coverage->testcases, (ct_destroyer_c) ct_destroy_covered_testcase);
+	ct_ht_destroy(coverage->testcases_index);
+	free(coverage->changed);
+	free(coverage->index_path);
+	free(coverage->previous_prefix);
+	free(coverage);
+}
+
+
+
+
+
+
+
+
+
+
+void ct_update_test_array(struct ct_model* model, ct_test_c func, const char* name) {
+	model->tests_array[model->suites_array_index] = func;
+	model->suites_names[model->suites_array_index] = name;
+	model->suites_order[model->suites_array_index] = model->suites_array_index;
+	model->suites_array_index++;
+}
+
+bool ct_run_once_final_work(struct ct_model* model, struct ct_section* section, struct ct_section** pointer_to_set_as_parent, ct_exit_c callback, ct_exit_c access_granted_callback, ct_exit_c access_denied_callback) {
+	if (section->loop1) {
+		return true;
+	}
+	//callback is always executed and it can (and often will) change pointerToSetAsParent and child pointers (since they point to the same structure).
+	//in order to use the previously pointed structure we copy the child pointer. As for pointerToSetAsParent, we can do nothing since it will be changed nonetheless
+	struct ct_section* _child = section;
+	callback(model, pointer_to_set_as_parent, section);
+	if (section->access_granted) {
+		//ct_section_set_executed(section);
+		//If we executed the section we check if this execution made the section
+		//fully visited and update its status consequently
+		if (ct_section_is_fully_visited(section)) {
+			ct_section_set_done(section);
+		}
+
+		//We reset the WHEN found tag
+		section->already_found_when = false;
+
+		access_granted_callback(model, pointer_to_set_as_parent, _child);
+	} else {
+		access_denied_callback(model, pointer_to_set_as_parent, _child);
+	}
+	return false;
+}
+
+/** If we are still computing the children of the given parent section the function
+ *  creates a new section with the given description, tags and adds it to its
+ *  parent section and returns a pointer to the new section.
+ *  Else, the function returns a pointer to the current_child of the given section.
+ *
+ *  @param[in] type the kind of section we're getting.
+ *  @see ::ct_section_type
+ */
+struct ct_section* ct_fetch_section(struct ct_section* parent, enum ct_section_type type, const char* description, struct ct_section_site* site, const char* tags) {
+	if (ct_section_still_discovering_children(parent)) {
+		parent->children_number += 1;
+		ct_allocation_tracker_pause();
+		ct_section_site_prepare(site, tags, &ct_model->prepared_sites);
+		struct ct_section* ret_val = ct_section_add_child(ct_section_init(type, description, site->tags), parent);
+		ct_index_section(ct_model, ret_val);
+		ct_allocation_tracker_resume();
+		return ret_val;
+	}
+	return ct_section_get_child(parent, parent->current_child);
+}
+
+void ct_reset_section_after_jump(struct ct_model* model, struct ct_section* const jump_source_section, struct ct_section* const testcase_section) {
+	model->current_section = testcase_section;
+	//the test has been interrupted: its memory can't be released anymore, so there is no point in looking for leaks
+	ct_allocation_tracker_stop(model->allocation_tracker);
+	if (model->hardware_counters != NULL) {
+		ct_hardware_counters_disable(model->hardware_counters);
+	}
+	//an interrupted benchmark would keep the following tests pinned to its CPU
+	if (model->benchmark != NULL) {
+		ct_destroy_benchmark(model->benchmark);
+		model->benchmark = NULL;
+	}
+	//assertions performed by worker threads of the interrupted test belong to it
+	struct ct_test_report* report = ct_list_tail(model->test_reports_list);
+	report->execution_time = ct_compute_time_gap(report->testcase_snapshot->start_time, ct_get_time(), "u");
+	ct_merge_thread_reports(model, report->testcase_snapshot);
+
+	//if a signal has been detected, now it's safe to attach its backtrace to the snapshot
+	if (model->signaled_snapshot != NULL) {
+		if (model->backtrace_buffer_size > CT_BACKTRACE_SKIPPED_FRAMES) {
+			ct_snapshot_set_backtrace(model->signaled_snapshot, &model->backtrace_buffer[CT_BACKTRACE_SKIPPED_FRAMES], model->backtrace_buffer_size - CT_BACKTRACE_SKIPPED_FRAMES);
+		}
+		model->signaled_snapshot = NULL;
+		model->backtrace_buffer_size = 0;
+	}
+	if (model->output_capture != NULL) {
+		ct_output_capture_stop(model->output_capture, report);
+	}
+
+	bool notify = model->section_fork == NULL || ct_section_fork_end_test(model, report, true);
+	if (notify && CT_HAS_LISTENERS(model, CT_EVENT_TEST_END)) {
+		ct_dispatch_test_end(model, report);
+	}
+	//an interrupted test is the last one of its testcase
+	if (model->journal != NULL) {
+		ct_journal_end_testcase(model, testcase_section);
+	}
+	if (model->coverage != NULL) {
+		ct_coverage_end_testcase(model, testcase_section);
+	}
+	ct_distribution_end_testcase(model, testcase_section);
+}
+
+bool ct_get_access_testcase(struct ct_model* model, struct ct_section* section) {
+	//a fuzzer is interested only in the FUZZ_TESTCASE sections
+	if (ct_is_fuzzing(model)) {
+		ct_section_set_skipped(section);
+		return false;
+	}
+	if (model->journal != NULL && ct_journal_testcase_completed(model, section)) {
+		ct_section_set_skipped(section);
+		return false;
+	}
+	if (model->coverage != NULL && !ct_coverage_enter_testcase(model, section)) {
+		ct_section_set_skipped(section);
+		return false;
+	}
+	if (model->distribution != NULL && !ct_distribution_claim(model, section)) {
+		ct_section_set_skipped(section);
+		return false;
+	}
+	return true;
+}
+
+void ct_exit_callback_next_sibling(struct ct_model* model, struct ct_section** pointer_to_set_as_parent, struct ct_section* section) {
+	//we finish a section. we return to the parent
+	*pointer_to_set_as_parent = section->parent;
+	//we go to the next sibling of child
+	(*pointer_to_set_as_parent)->current_child += 1;
+}
+
+void ct_exit_callback_children_number_computed(struct ct_model* model, struct ct_section** pointerToSetAsParent, struct ct_section* section) {
+	//we executed the section. Hence we can safely say we know the child number of such section
+	if (!section->children_number_known) {
+		section->children_number_known = true;
+	}
+	section->current_child = 0;
+
+	ct_stop_snapshot_measurements(model, model->current_snapshot);
+	ct_merge_thread_reports(model, model->current_snapshot);
+	ct_update_snapshot_status(model->current_section, model->current_snapshot);
+
+	model->current_snapshot = model->current_snapshot->parent;
+}
+
+void ct_exit_callback_reset_container(struct ct_model* model, struct ct_section** pointer_to_set_as_parent, struct ct_section* child) {
+	//we finished a section. Hence now we know the number of children that section have
+	child->children_number_known = true;
+	child->current_child = 0;
+}
+
+void ct_exit_callback_do_nothing(struct ct_model* model, struct ct_section** pointer_to_set_as_parent, struct ct_section* section) {
+
+}
+
+void ct_callback_do_nothing(struct ct_model* model, struct ct_section* section) {
+
+}
+
+void ct_callback_entering_testcase(struct ct_model* model, struct ct_section* section) {
+	ct_allocation_tracker_pause();
+	ct_update_current_snapshot(model, model->current_section);
+	struct ct_test_report* report = ct_init_test_report(model->current_snapshot);
+	ct_list_add_tail(model->test_reports_list, report);
+	ct_fuzz_update_test_report(model, report);
+	report->repetition = model->repetition;
+	report->suite = model->current_suite;
+	if (model->output_capture != NULL) {
+		ct_output_capture_start(model->output_capture);
+	}
+	ct_allocation_tracker_resume();
+
+	ct_allocation_tracker_start(model->allocation_tracker);
+	if (model->hardware_counters != NULL) {
+		ct_hardware_counters_enable(model->hardware_counters);
+	}
+	//the snapshot has been started before enabling the counters
+	ct_start_snapshot_measurements(model, model->current_snapshot);
+}
+
+void ct_callback_entering_then(struct ct_model* model, struct ct_section* section) {
+	ct_update_current_snapshot(model, section);
+}
+
+void ct_callback_entering_when(struct ct_model* model, struct ct_section* section) {
+	section->parent->already_found_when = true;
+
+	ct_update_current_snapshot(model, section);
+}
+
+void ct_exit_callback_access_granted_testcase(struct ct_model* model, struct ct_section** pointer_to_set_as_parent, struct ct_section* section) {
+	struct ct_test_report* report = ct_list_tail(model->test_reports_list);
+	struct ct_snapshot* last_snapshot = model->current_snapshot;
+
+	ct_stop_snapshot_measurements(model, last_snapshot);
+	if (model->hardware_counters != NULL) {
+		ct_hardware_counters_disable(model->hardware_counters);
+	}
+	ct_allocation_tracker_stop(model->allocation_tracker);
+	report->execution_time = last_snapshot->elapsed_time;
+	ct_merge_thread_reports(model, last_snapshot);
+	ct_update_snapshot_status(section, model->current_snapshot);
+	ct_allocation_tracker_check_leaks(model->allocation_tracker, last_snapshot);
+	ct_allocation_tracker_check_bound(model->allocation_tracker, last_snapshot);
+	ct_update_test_outcome(report, last_snapshot);
+	if (model->output_capture != NULL) {
+		ct_output_capture_stop(model->output_capture, report);
+	}
+
+	//Resets the current_snapshot pointer to NULL to indicate the end of the test
+	model->current_snapshot = NULL;
+
+	bool notify = model->section_fork == NULL || ct_section_fork_end_test(model, report, false);
+	if (notify && CT_HAS_LISTENERS(model, CT_EVENT_TEST_END)) {
+		ct_dispatch_test_end(model, report);
+	}
+	if (!ct_section_still_needs_execution(section)) {
+		if (model->journal != NULL) {
+			ct_journal_end_testcase(model, section);
+		}
+		if (model->coverage != NULL) {
+			ct_coverage_end_testcase(model, section);
+		}
+		ct_distribution_end_testcase(model, section);
+	}
+}
+
+/**
+ * This functions updates the current_snapshot. More precisely:
+ *  - if current_snapshot is NULL it means we just started a new test, so it simply takes a section snapshot and sets it
+ *  	as the current_snapshot
+ *  - if current_snapshot is not NULL it means we are not in a new test, so we take a snapshot and adds it to the test report tree
+ */
+
+void ct_update_current_snapshot(struct ct_model* model, struct ct_section* section) {
+	if (model->output_capture != NULL) {
+		ct_output_capture_trim(model->output_capture);
+	}
+	ct_allocation_tracker_pause();
+	struct ct_snapshot* snapshot = ct_init_section_snapshot(section);
+	ct_allocation_tracker_resume();
+
+	if (model->current_snapshot == NULL) {
+		model->current_snapshot = snapshot;
+	}
+	else {
+		model->current_snapshot = ct_add_snapshot_to_tree(snapshot, model->current_snapshot);
+	}
+
+	ct_start_snapshot_measurements(model, snapshot);
+}
+
+void ct_start_snapshot_measurements(struct ct_model* model, struct ct_snapshot* snapshot) {
+	if (model->measure_resources) {
+		ct_begin_resource_usage(&snapshot->resource_usage);
+	}
+	if (model->hardware_counters != NULL) {
+		ct_begin_hardware_counters(model->hardware_counters, &snapshot->hardware_counters);
+	}
+	//we sample the time last, so that it includes as little @crashc code as possible
+	snapshot->start_time = ct_get_time();
+}
+
+void ct_stop_snapshot_measurements(struct ct_model* model, struct ct_snapshot* snapshot) {
+	struct timespec end_time = ct_get_time();
+
+	if (model->hardware_counters != NULL) {
+		ct_end_hardware_counters(model->hardware_counters, &snapshot->hardware_counters);
+	}
+	if (model->measure_resources) {
+		ct_end_resource_usage(&snapshot->resource_usage);
+	}
+	snapshot->elapsed_time = ct_compute_time_gap(snapshot->start_time, end_time, "u");
+	snapshot->measurements_taken = true;
+}
+
+void ct_signal_callback_do_nothing(int signal, struct ct_section* signaled_section, struct ct_section* section, struct ct_section* target_section) {
+
+}
+
+void ct_set_crashc_teardown(ct_teardown_c f) {
+	ct_model->ct_teardown = f;
+}
+/*
+ * distribution.c
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: koldar
+ */
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <stdint.h>
+#include <string.h>
+#include <errno.h>
+#include <poll.h>
+#include <unistd.h>
+#include <fcntl.h>
+#include <netdb.h>
+#include <sys/types.h>
+#include <sys/wait.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+
+
+
+
+
+
+
+
+
+
+
+
+
+/**
+ * The message a worker sends to claim a @testcase: the key and the description of the @testcase follow
+ */
+#define CT_DISTRIBUTION_CLAIM 'C'
+/**
+ * The message a worker sends with the tests of a @testcase: the key of the @testcase and the serialized tests follow
+ */
+#define CT_DISTRIBUTION_TESTS 'T'
+/**
+ * The message a worker sends, right after connecting, to ask the order of the @testsuite: it carries no data.
+ * The coordinator answers with the number of @testsuite followed by struct ct_model::suites_order
+ */
+#define CT_DISTRIBUTION_ORDER 'O'
+/**
+ * The size of the part of a message preceding its variable data: the type, the key of the @testcase and the size of the data
+ */
+#define CT_DISTRIBUTION_HEADER_SIZE (1 + sizeof(struct ct_testcase_key) + sizeof(uint32_t))
+/**
+ * How often, in milliseconds, the coordinator checks whether its local workers have exited
+ */
+#define CT_DISTRIBUTION_POLL_PERIOD 100
+
+/**
+ * A @testcase claimed by a worker, as seen by the coordinator
+ */
+struct ct_claim {
+	struct ct_testcase_key key;
+	char* description;
+	/**
+	 * The connection of the worker running the @testcase. -1 if nobody is running it anymore
+	 */
+	int worker;
+	/**
+	 * The tests received for the @testcase
+	 */
+	ct_list_o* reports;
+};
+
+/**
+ * A connection with a worker, as seen by the coordinator
+ */
+struct ct_worker_connection {
+	int socket;
+	/**
+	 * The bytes received and not yet handled, since a message can be split among several reads
+	 */
+	unsigned char* data;
+	size_t size;
+	size_t capacity;
+};
+
+/**
+ * The state of the coordinator while it's serving the @testcase
+ */
+struct ct_coordinator {
+	/**
+	 * The @testcase claimed so far, in claim order. Each value is a struct ct_claim
+	 */
+	ct_list_o* claims;
+	/**
+	 * struct ct_coordinator::claims indexed by ::ct_testcase_key_hash
+	 */
+	ct_hashtable_o* claims_index;
+	/**
+	 * The connected workers. Each value is a struct ct_worker_connection
+	 */
+	ct_list_o* connections;
+};
+
+static struct ct_distribution* ct_init_distribution(int channel, bool coordinator) {
+	struct ct_distribution* ret_val = malloc(sizeof(struct ct_distribution));
+	if (ret_val == NULL) {
+		CT_MALLOC_ERROR_CALLBACK();
+	}
+
+	ret_val->channel = channel;
+	ret_val->coordinator = coordinator;
+	ret_val->testcase = NULL;
+	ret_val->granted = false;
+	ret_val->arena = coordinator ? ct_init_report_arena() : NULL;
+	ret_val->lost_testcases = 0;
+
+	return ret_val;
+}
+
+void ct_destroy_distribution(struct ct_distribution* distribution) {
+	if (distribution->channel >= 0) {
+		close(distribution->channel);
+	}
+	if (distribution->arena != NULL) {
+		ct_destroy_report_arena(distribution->arena);
+	}
+	free(distribution);
+}
+
+/**
+ * Opens the socket of a distributed run
+ *
+ * @param[in] address the address of the coordinator, either <tt>unix:PATH</tt> or <tt>[tcp:]HOST:PORT</tt>
+ * @param[in] coordinator @true to listen on \c address, @false to connect to it
+ * @return the socket. The process exits if the socket can't be opened
+ */
+static int ct_open_distribution_socket(const char* address, bool coordinator) {
+	int ret_val = -1;
+
+	if (strncmp(address, "unix:", 5) == 0) {
+		struct sockaddr_un unix_address;
+		const char* path = address + 5;
+		memset(&unix_address, 0, sizeof(unix_address));
+		unix_address.sun_family = AF_UNIX;
+		if (strlen(path) >= sizeof(unix_address.sun_path)) {
+			fprintf(stderr, "CrashC - the socket path \"%s\" is too long\n", path);
+			exit(EXIT_FAILURE);
+		}
+		strcpy(unix_address.sun_path, path);
+
+		ret_val = socket(AF_UNIX, SOCK_STREAM | SOCK_CLOEXEC, 0);
+		if (ret_val >= 0 && coordinator) {
+			//a socket file left by a previous coordinator would make bind fail
+			unlink(path);
+			if (bind(ret_val, (struct sockaddr*) &unix_address, sizeof(unix_address)) != 0 || listen(ret_val, CT_DISTRIBUTION_BACKLOG) != 0) {
+				close(ret_val);
+				ret_val = -1;
+			}
+		} else if (ret_val >= 0 && connect(ret_val, (struct sockaddr*) &unix_address, sizeof(unix_address)) != 0) {
+			close(ret_val);
+			ret_val = -1;
+		}
+	} else {
+		char host[CT_BUFFER_SIZE];
+		if (strncmp(address, "tcp:", 4) == 0) {
+			address += 4;
+		}
+		const char* port = strrchr(address, ':');
+		if (port == NULL || (size_t) (port - address) >= sizeof(host)) {
+			fprintf(stderr, "CrashC - invalid address \"%s\": it needs to be either unix:PATH or tcp:HOST:PORT\n", address);
+			exit(EXIT_FAILURE);
+		}
+		memcpy(host, address, port - address);
+		host[port - address] = '\0';
+		port += 1;
+
+		struct addrinfo hints;
+		struct addrinfo* addresses;
+		memset(&hints, 0, sizeof(hints));
+		hints.ai_family = AF_UNSPEC;
+		hints.ai_socktype = SOCK_STREAM;
+		hints.ai_flags = coordinator ? AI_PASSIVE : 0;
+		int error = getaddrinfo((host[0] != '\0') ? host : NULL, port, &hints, &addresses);
+		if (error != 0) {
+			fprintf(stderr, "CrashC - cannot resolve \"%s\": %s\n", address, gai_strerror(error));
+			exit(EXIT_FAILURE);
+		}
+		for (struct addrinfo* a = addresses; a != NULL && ret_val < 0; a = a->ai_next) {
+			ret_val = socket(a->ai_family, a->ai_socktype | SOCK_CLOEXEC, a->ai_protocol);
+			if (ret_val < 0) {
+				continue;
+			}
+			int enabled = 1;
+			bool opened;
+			if (coordinator) {
+				setsockopt(ret_val, SOL_SOCKET, SO_REUSEADDR, &enabled, sizeof(enabled));
+				opened = bind(ret_val, a->ai_addr, a->ai_addrlen) == 0 && listen(ret_val, CT_DISTRIBUTION_BACKLOG) == 0;
+			} else {
+				//a claim is a tiny message waiting for an answer: it can't wait for more data to be sent
+				setsockopt(ret_val, IPPROTO_TCP, TCP_NODELAY, &enabled, sizeof(enabled));
+				opened = connect(ret_val, a->ai_addr, a->ai_addrlen) == 0;
+			}
+			if (!opened) {
+				close(ret_val);
+				ret_val = -1;
+			}
+		}
+		freeaddrinfo(addresses);
+	}
+
+	if (ret_val < 0) {
+		fprintf(stderr, "CrashC - cannot %s \"%s\": %s\n", coordinator ? "listen on" : "connect to", address, strerror(errno));
+		exit(EXIT_FAILURE);
+	}
+	return ret_val;
+}
+
+static bool ct_send_all(int channel, const void* data, size_t size) {
+	const unsigned char* bytes = data;
+
+	while (size > 0) {
+		ssize_t sent = send(channel, bytes, size, MSG_NOSIGNAL);
+		if (sent < 0 && errno == EINTR) {
+			continue;
+		}
+		if (sent <= 0) {
+			return false;
+		}
+		bytes += sent;
+		size -= sent;
+	}
+	return true;
+}
+
+/**
+ * Sends a message to the coordinator
+ *
+ * A worker can't do anything without its coordinator, so it exits if the message can't be sent.
+ *
+ * @param[in] distribution the state of the worker
+ * @param[in] type the type of the message
+ * @param[in] key the @testcase the message is about
+ * @param[in] data the variable part of the message
+ * @param[in] size the number of bytes of \c data
+ */
+static void ct_send_message(const struct ct_distribution* distribution, char type, const struct ct_testcase_key* key, const void* data, uint32_t size) {
+	unsigned char header[CT_DISTRIBUTION_HEADER_SIZE];
+
+	header[0] = type;
+	memcpy(&header[1], key, sizeof(struct ct_testcase_key));
+	memcpy(&header[1 + sizeof(struct ct_testcase_key)], &size, sizeof(size));
+	if (!ct_send_all(distribution->channel, header, sizeof(header)) || !ct_send_all(distribution->channel, data, size)) {
+		fprintf(stderr, "CrashC - the connection to the coordinator has been lost\n");
+		_exit(EXIT_FAILURE);
+	}
+}
+
+/**
+ * Receives a reply of the coordinator
+ *
+ * A worker can't do anything without its coordinator, so it exits if the reply can't be received.
+ *
+ * @param[in] distribution the state of the worker
+ * @param[out] data where to store the reply
+ * @param[in] size the number of bytes of the reply
+ */
+static void ct_receive_reply(const struct ct_distribution* distribution, void* data, size_t size) {
+	unsigned char* bytes = data;
+
+	while (size > 0) {
+		ssize_t received = recv(distribution->channel, bytes, size, 0);
+		if (received < 0 && errno == EINTR) {
+			continue;
+		}
+		if (received <= 0) {
+			fprintf(stderr, "CrashC - the connection to the coordinator has been lost\n");
+			_exit(EXIT_FAILURE);
+		}
+		bytes += received;
+		size -= received;
+	}
+}
+
+/**
+ * Turns the calling process into a worker
+ *
+ * The worker runs the @testsuite in the order chosen by the coordinator, so that the @testcase are claimed in the priority
+ * the coordinator has computed from its history file, even if the worker has no history file. The worker exits if the order
+ * received is not a permutation of its own @testsuite.
+ *
+ * @param[inout] model the model to handle
+ * @param[in] channel the connection to the coordinator
+ */
+static void ct_become_worker(struct ct_model* model, int channel) {
+	struct ct_testcase_key no_key = { 0, 0 };
+	int suites_number;
+	int suites_order[MAX_TESTS];
+
+	model->distribution = ct_init_distribution(channel, false);
+	//the coordinator notifies the tests and keeps the journal
+	model->event_dispatcher->subscribed_events = 0;
+	if (model->journal != NULL) {
+		ct_destroy_journal(model->journal);
+		model->journal = NULL;
+	}
+
+	ct_send_message(model->distribution, CT_DISTRIBUTION_ORDER, &no_key, NULL, 0);
+	ct_receive_reply(model->distribution, &suites_number, sizeof(suites_number));
+	if (suites_number < 0 || suites_number > MAX_TESTS) {
+		fprintf(stderr, "CrashC - the coordinator has sent %d test suites: is it running the same test executable?\n", suites_number);
+		_exit(EXIT_FAILURE);
+	}
+	ct_receive_reply(model->distribution, suites_order, sizeof(int) * suites_number);
+	if (suites_number != model->suites_array_index) {
+		fprintf(stderr, "CrashC - the coordinator has %d test suites instead of %d: is it running the same test executable?\n", suites_number, model->suites_array_index);
+		_exit(EXIT_FAILURE);
+	}
+	//the order indexes struct ct_model::tests_array: it needs to contain every test suite exactly once
+	bool seen[MAX_TESTS] = { false };
+	for (int i = 0; i < suites_number; i++) {
+		if (suites_order[i] < 0 || suites_order[i] >= suites_number || seen[suites_order[i]]) {
+			fprintf(stderr, "CrashC - the coordinator has sent the test suite %d in position %d: is it running the same test executable?\n", suites_order[i], i);
+			_exit(EXIT_FAILURE);
+		}
+		seen[suites_order[i]] = true;
+	}
+	memcpy(model->suites_order, suites_order, sizeof(int) * suites_number);
+}
+
+static struct ct_claim* ct_find_claim(const struct ct_coordinator* coordinator, const struct ct_testcase_key* key) {
+	struct ct_claim* ret_val = ct_ht_get(coordinator->claims_index, ct_testcase_key_hash(key));
+
+	if (ret_val == NULL || (ret_val->key.path_hash == key->path_hash && ret_val->key.occurrence == key->occurrence)) {
+		return ret_val;
+	}
+	//on a hash collision the claims are looked for one by one
+	CT_ITERATE_ON_LIST(coordinator->claims, cell, claim, struct ct_claim*) {
+		if (claim->key.path_hash == key->path_hash && claim->key.occurrence == key->occurrence) {
+			return claim;
+		}
+	}
+	return NULL;
+}
+
+static struct ct_claim* ct_add_claim(struct ct_coordinator* coordinator, const struct ct_testcase_key* key, const char* description, uint32_t length, int worker) {
+	struct ct_claim* ret_val = malloc(sizeof(struct ct_claim));
+	if (ret_val == NULL) {
+		CT_MALLOC_ERROR_CALLBACK();
+	}
+	ret_val->description = malloc(length + 1);
+	if (ret_val->description == NULL) {
+		CT_MALLOC_ERROR_CALLBACK();
+	}
+
+	ret_val->key = *key;
+	memcpy(ret_val->description, description, length);
+	ret_val->description[length] = '\0';
+	ret_val->worker = worker;
+	ret_val->reports = ct_list_init();
+	ct_list_add_tail(coordinator->claims, ret_val);
+	if (ct_ht_get(coordinator->claims_index, ct_testcase_key_hash(key)) == NULL) {
+		ct_ht_put(coordinator->claims_index, ct_testcase_key_hash(key), ret_val);
+	}
+
+	return ret_val;
+}
+
+static void ct_destroy_claim(struct ct_claim* claim) {
+	ct_list_destroy_with_elements(claim->reports, (ct_destroyer_c) ct_destroy_test_report);
+	free(claim->description);
+	free(claim);
+}
+
+/**
+ * Handles a message received by the coordinator
+ *
+ * @param[inout] model the model of the coordinator
+ * @param[inout] coordinator the state of the coordinator
+ * @param[in] connection the worker which has sent the message
+ * @param[in] type the type of the message
+ * @param[in] key the @testcase the message is about
+ * @param[in] data the variable part of the message
+ * @param[in] size the number of bytes of \c data
+ * @return @true if the message has been handled, @false if the worker has sent something the coordinator can't understand
+ */
+static bool ct_handle_message(struct ct_model* model, struct ct_coordinator* coordinator, struct ct_worker_connection* connection, char type, const struct ct_testcase_key* key, unsigned char* data, uint32_t size) {
+	struct ct_distribution* distribution = model->distribution;
+
+	if (type == CT_DISTRIBUTION_ORDER) {
+		//every worker claims the testcases in the order the coordinator has chosen from its history
+		if (ct_send_all(connection->socket, &model->suites_array_index, sizeof(model->suites_array_index))) {
+			ct_send_all(connection->socket, model->suites_order, sizeof(int) * model->suites_array_index);
+		}
+		return true;
+	}
+
+	struct ct_claim* claim = ct_find_claim(coordinator, key);
+	if (type == CT_DISTRIBUTION_CLAIM) {
+		char granted = 0;
+		if (claim == NULL) {
+			if (model->journal != NULL && ct_journal_key_completed(model->journal, key)) {
+				//nobody is going to run it, but the other workers need to be denied the testcase as well
+				ct_add_claim(coordinator, key, (char*) data, size, -1);
+				model->journal->skipped_testcases += 1;
+			} else {
+				ct_add_claim(coordinator, key, (char*) data, size, connection->socket);
+				granted = 1;
+			}
+		}
+		//if the worker has died, its connection is going to be closed as well
+		ct_send_all(connection->socket, &granted, sizeof(granted));
+		return true;
+	}
+
+	if (type != CT_DISTRIBUTION_TESTS || claim == NULL || claim->worker != connection->socket) {
+		fprintf(stderr, "CrashC - a worker has sent an unexpected message: is it running the same test executable?\n");
+		return false;
+	}
+	struct ct_serialized_buffer buffer = { data, size, 0, false };
+	ct_list_o* reports = ct_list_init();
+	int reports_number;
+	ct_deserialize_bytes(&buffer, &reports_number, sizeof(reports_number));
+	for (int i = 0; i < reports_number && !buffer.corrupted; i++) {
+		ct_list_add_tail(reports, ct_deserialize_test_report(&buffer, distribution->arena));
+	}
+	if (buffer.corrupted) {
+		fprintf(stderr, "CrashC - a worker has sent corrupted tests for the test case \"%s\": is it running the same test executable?\n", claim->description);
+		ct_list_destroy_with_elements(reports, (ct_destroyer_c) ct_destroy_test_report);
+		return false;
+	}
+	ct_list_full_transfer(claim->reports, reports);
+	ct_list_destroy(reports);
+	claim->worker = -1;
+
+	//the listeners, like the journal, look at the key of the testcase whose tests are being notified
+	model->keyed_testcase = NULL;
+	model->testcase_key = claim->key;
+	if (CT_HAS_LISTENERS(model, CT_EVENT_TEST_END)) {
+		CT_ITERATE_ON_LIST(claim->reports, cell, report, struct ct_test_report*) {
+			ct_dispatch_test_end(model, report);
+		}
+	}
+	if (model->journal != NULL) {
+		ct_journal_complete_key(model->journal, &claim->key);
+	}
+	return true;
+}
+
+/**
+ * Reads what a worker has sent and handles the complete messages
+ *
+ * @param[inout] model the model of the coordinator
+ * @param[inout] coordinator the state of the coordinator
+ * @param[inout] connection the worker to read from
+ * @return @false if the worker has left or has sent something the coordinator can't understand, @true otherwise
+ */
+static bool ct_read_connection(struct ct_model* model, struct ct_coordinator* coordinator, struct ct_worker_connection* connection) {
+	if (connection->size == connection->capacity) {
+		connection->capacity *= 2;
+		connection->data = realloc(connection->data, connection->capacity);
+		if (connection->data == NULL) {
+			CT_MALLOC_ERROR_CALLBACK();
+		}
+	}
+	ssize_t bytes = recv(connection->socket, connection->data + connection->size, connection->capacity - connection->size, 0);
+	if (bytes < 0 && errno == EINTR) {
+		return true;
+	}
+	if (bytes <= 0) {
+		return false;
+	}
+	connection->size += bytes;
+
+	size_t position = 0;
+	while (connection->size - position >= CT_DISTRIBUTION_HEADER_SIZE) {
+		unsigned char* message = connection->data + position;
+		struct ct_testcase_key key;
+		uint32_t size;
+		memcpy(&key, &message[1], sizeof(key));
+		memcpy(&size, &message[1 + sizeof(key)], sizeof(size));
+		if (size > CT_DISTRIBUTION_MAX_MESSAGE_SIZE) {
+			fprintf(stderr, "CrashC - a worker has sent a message of %lu bytes: is it running the same test executable?\n", (unsigned long) size);
+			return false;
+		}
+		if (connection->size - position - CT_DISTRIBUTION_HEADER_SIZE < size) {
+			break;
+		}
+		if (!ct_handle_message(model, coordinator, connection, (char) message[0], &key, message + CT_DISTRIBUTION_HEADER_SIZE, size)) {
+			return false;
+		}
+		position += CT_DISTRIBUTION_HEADER_SIZE + size;
+	}
+	memmove(connection->data, connection->data + position, connection->size - position);
+	connection->size -= position;
+
+	return true;
+}
+
+static void ct_close_connection(struct ct_model* model, struct ct_coordinator* coordinator, struct ct_worker_connection* connection) {
+	CT_ITERATE_ON_LIST(coordinator->claims, cell, claim, struct ct_claim*) {
+		if (claim->worker == connection->socket) {
+			fprintf(stderr, "CrashC - a worker has left while running the test case \"%s\": its tests are lost\n", claim->description);
+			claim->worker = -1;
+			model->distribution->lost_testcases += 1;
+		}
+	}
+	close(connection->socket);
+	free(connection->data);
+	free(connection);
+}
+
+static bool ct_has_pending_connections(int channel) {
+	struct pollfd pending = { channel, POLLIN, 0 };
+
+	return poll(&pending, 1, 0) > 0;
+}
+
+/**
+ * Serves the @testcase to the workers until every worker has left
+ *
+ * @param[inout] model the model of the coordinator
+ * @param[inout] coordinator the state of the coordinator
+ * @param[inout] local_workers the local workers. The ones which have exited are set to 0
+ * @param[in] local_workers_number the number of items in \c local_workers
+ */
+static void ct_serve(struct ct_model* model, struct ct_coordinator* coordinator, pid_t* local_workers, int local_workers_number) {
+	int channel = model->distribution->channel;
+	int running_workers = local_workers_number;
+	struct pollfd* polled = NULL;
+
+	while (running_workers > 0 || !ct_list_is_empty(coordinator->connections) || ct_has_pending_connections(channel)) {
+		int polled_number = 1 + ct_list_size(coordinator->connections);
+		polled = realloc(polled, sizeof(struct pollfd) * polled_number);
+		if (polled == NULL) {
+			CT_MALLOC_ERROR_CALLBACK();
+		}
+		polled[0] = (struct pollfd) { channel, POLLIN, 0 };
+		int i = 1;
+		CT_ITERATE_ON_LIST(coordinator->connections, cell, connection, struct ct_worker_connection*) {
+			polled[i] = (struct pollfd) { connection->socket, POLLIN, 0 };
+			i += 1;
+		}
+
+		if (poll(polled, polled_number, CT_DISTRIBUTION_POLL_PERIOD) < 0 && errno != EINTR) {
+			perror("CrashC - the coordinator cannot wait for the workers");
+			exit(EXIT_FAILURE);
+		}
+
+		//the connections are handled before the new ones are added, so that they match the polled ones
+		i = 1;
+		ct_list_o* connections = ct_list_init();
+		CT_ITERATE_ON_LIST(coordinator->connections, cell2, connection2, struct ct_worker_connection*) {
+			if ((polled[i].revents & (POLLIN | POLLHUP | POLLERR)) != 0 && !ct_read_connection(model, coordinator, connection2)) {
+				ct_close_connection(model, coordinator, connection2);
+			} else {
+				ct_list_add_tail(connections, connection2);
+			}
+			i += 1;
+		}
+		ct_list_destroy(coordinator->connections);
+		coordinator->connections = connections;
+
+		if ((polled[0].revents & POLLIN) != 0) {
+			int socket = accept(channel, NULL, NULL);
+			if (socket >= 0) {
+				fcntl(socket, F_SETFD, FD_CLOEXEC);
+				struct ct_worker_connection* connection = malloc(sizeof(struct ct_worker_connection));
+				if (connection == NULL) {
+					CT_MALLOC_ERROR_CALLBACK();
+				}
+				connection->socket = socket;
+				connection->capacity = CT_BUFFER_SIZE;
+				connection->size = 0;
+				connection->data = malloc(connection->capacity);
+				if (connection->data == NULL) {
+					CT_MALLOC_ERROR_CALLBACK();
+				}
+				ct_list_add_tail(coordinator->connections, connection);
+			}
+		}
+
+		for (int w = 0; w < local_workers_number; w++) {
+			int status;
+			if (local_workers[w] != 0 && waitpid(local_workers[w], &status, WNOHANG) == local_workers[w]) {
+				local_workers[w] = 0;
+				running_workers -= 1;
+			}
+		}
+	}
+
+	free(polled);
+}
+
+bool ct_distribute(struct ct_model* model) {
+	if (model->worker_address != NULL) {
+		ct_become_worker(model, ct_open_distribution_socket(model->worker_address, false));
+		return true;
+	}
+	if (model->coordinator_address == NULL) {
+		return true;
+	}
+
+	model->distribution = ct_init_distribution(ct_open_distribution_socket(model->coordinator_address, true), true);
+
+	int local_workers_number = ct_get_workers_number(model);
+	pid_t* local_workers = malloc(sizeof(pid_t) * local_workers_number);
+	if (local_workers == NULL) {
+		CT_MALLOC_ERROR_CALLBACK();
+	}
+	//otherwise the buffered output would be written by every worker
+	fflush(NULL);
+	for (int w = 0; w < local_workers_number; w++) {
+		local_workers[w] = fork();
+		if (local_workers[w] < 0) {
+			perror("CrashC - cannot fork a local worker");
+			exit(EXIT_FAILURE);
+		}
+		if (local_workers[w] == 0) {
+			free(local_workers);
+			ct_destroy_distribution(model->distribution);
+			model->distribution = NULL;
+			ct_become_worker(model, ct_open_distribution_socket(model->coordinator_address, false));
+			return true;
+		}
+	}
+
+	struct ct_coordinator coordinator = { ct_list_init(), ct_ht_init(), ct_list_init() };
+	ct_serve(model, &coordinator, local_workers, local_workers_number);
+	free(local_workers);
+	close(model->distribution->channel);
+	model->distribution->channel = -1;
+	if (strncmp(model->coordinator_address, "unix:", 5) == 0) {
+		unlink(model->coordinator_address + 5);
+	}
+
+	//the testcases have been claimed in the order a single process would have run them
+	CT_ITERATE_ON_LIST(coordinator.claims, cell, claim, struct ct_claim*) {
+		ct_list_full_transfer(model->test_reports_list, claim->reports);
+	}
+	ct_list_destroy_with_elements(coordinator.claims, (ct_destroyer_c) ct_destroy_claim);
+	ct_ht_destroy(coordinator.claims_index);
+	ct_list_destroy(coordinator.connections);
+	if (model->distribution->lost_testcases > 0) {
+		fprintf(stderr, "CrashC - the tests of %d test cases have been lost\n", model->distribution->lost_testcases);
+	}
+
+	return false;
+}
+
+bool ct_distribution_claim(struct ct_model* model, const struct ct_section* testcase) {
+	struct ct_distribution* distribution = model->distribution;
+
+	if (testcase != distribution->testcase) {
+		distribution->testcase = testcase;
+		ct_send_message(distribution, CT_DISTRIBUTION_CLAIM, ct_get_testcase_key(model, testcase), testcase->description, strlen(testcase->description));
+
+		char granted;
+		ct_receive_reply(distribution, &granted, sizeof(granted));
+		distribution->granted = granted != 0;
+	}
+	return distribution->granted;
+}
+
+void ct_distribution_end_testcase(struct ct_model* model, const struct ct_section* testcase) {
+	struct ct_distribution* distribution = model->distribution;
+
+	if (distribution == NULL || distribution->coordinator || testcase != distribution->testcase || !distribution->granted) {
+		return;
+	}
+	//a FUZZ_TESTCASE ends when its last input has been run, not when an input is interrupted
+	if (model->fuzz_corpus != NULL) {
+		return;
+	}
+
+	ct_allocation_tracker_pause();
+	char* payload = NULL;
+	size_t size = 0;
+	FILE* out = open_memstream(&payload, &size);
+	if (out == NULL) {
+		CT_MALLOC_ERROR_CALLBACK();
+	}
+	int reports_number = ct_list_size(model->test_reports_list);
+	fwrite(&reports_number, sizeof(reports_number), 1, out);
+	CT_ITERATE_ON_LIST(model->test_reports_list, cell, report, struct ct_test_report*) {
+		ct_serialize_test_report(out, report);
+	}
+	fclose(out);
+
+	ct_send_message(distribution, CT_DISTRIBUTION_TESTS, ct_get_testcase_key(model, testcase), payload, (uint32_t) size);
+	free(payload);
+
+	//the tests now belong to the coordinator
+	CT_ITERATE_ON_LIST(model->test_reports_list, cell2, sent, struct ct_test_report*) {
+		ct_destroy_test_report(sent);
+	}
+	ct_list_clear(model->test_reports_list);
+	distribution->granted = false;
+	ct_allocation_tracker_resume();
+}
+
+void ct_distribution_leave(struct ct_model* model) {
+	if (model->distribution != NULL && !model->distribution->coordinator) {
+		close(model->distribution->channel);
+		fflush(NULL);
+		_exit(EXIT_SUCCESS);
+	}
+}
+/*
+ * events.c
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: koldar
+ */
+
+#include <stdlib.h>
+#include <stdbool.h>
+
+
+
+
+
+
+struct ct_event_dispatcher* ct_init_event_dispatcher() {
+	struct ct_event_dispatcher* ret_val = malloc(sizeof(struct ct_event_dispatcher));
+	if (ret_val == NULL) {
+		CT_MALLOC_ERROR_CALLBACK();
+	}
+
+	ret_val->subscribed_events = 0;
+	ret_val->listeners_number = 0;
+
+	return ret_val;
+}
+
+bool ct_subscribe_listener(struct ct_model* model, const struct ct_event_listener* listener) {
+	struct ct_event_dispatcher* dispatcher = model->event_dispatcher;
+
+	if (dispatcher->listeners_number >= CT_MAX_EVENT_LISTENERS) {
+		return false;
+	}
+
+	dispatcher->listeners[dispatcher->listeners_number] = *listener;
+	dispatcher->listeners_number += 1;
+
+	if (listener->on_suite_start != NULL) {
+		dispatcher->subscribed_events |= CT_EVENT_SUITE_START;
+	}
+	if (listener->on_section_enter != NULL) {
+		dispatcher->subscribed_events |= CT_EVENT_SECTION_ENTER;
+	}
+	if (listener->on_assert_fail != NULL) {
+		dispatcher->subscribed_events |= CT_EVENT_ASSERT_FAIL;
+	}
+	if (listener->on_test_end != NULL) {
+		dispatcher->subscribed_events |= CT_EVENT_TEST_END;
+	}
+	if (listener->on_run_end != NULL) {
+		dispatcher->subscribed_events |= CT_EVENT_RUN_END;
+	}
+	return true;
+}
+
+void ct_dispatch_suite_start(struct ct_model* model, const char* suite_name) {
+	struct ct_event_dispatcher* dispatcher = model->event_dispatcher;
+
+	//what listeners allocate doesn't belong to the tests
+	ct_allocation_tracker_pause();
+	for (int i = 0; i < dispatcher->listeners_number; i++) {
+		if (dispatcher->listeners[i].on_suite_start != NULL) {
+			dispatcher->listeners[i].on_suite_start(model, dispatcher->listeners[i].data, suite_name);
+		}
+	}
+	ct_allocation_tracker_resume();
+}
+
+void ct_dispatch_section_enter(struct ct_model* model, struct ct_section* section) {
+	struct ct_event_dispatcher* dispatcher = model->event_dispatcher;
+
+	ct_allocation_tracker_pause();
+	for (int i = 0; i < dispatcher->listeners_number; i++) {
+		if (dispatcher->listeners[i].on_section_enter != NULL) {
+			dispatcher->listeners[i].on_section_enter(model, dispatcher->listeners[i].data, section);
+		}
+	}
+	ct_allocation_tracker_resume();
+}
+
+void ct_dispatch_assert_fail(struct ct_model* model, struct ct_assert_report* report) {
+	struct ct_event_dispatcher* dispatcher = model->event_dispatcher;
+
+	ct_allocation_tracker_pause();
+	for (int i = 0; i < dispatcher->listeners_number; i++) {
+		if (dispatcher->listeners[i].on_assert_fail != NULL) {
+			dispatcher->listeners[i].on_assert_fail(model, dispatcher->listeners[i].data, report);
+		}
+	}
+	ct_allocation_tracker_resume();
+}
+
+void ct_dispatch_test_end(struct ct_model* model, struct ct_test_report* report) {
+	struct ct_event_dispatcher* dispatcher = model->event_dispatcher;
+
+	ct_allocation_tracker_pause();
+	for (int i = 0; i < dispatcher->listeners_number; i++) {
+		if (dispatcher->listeners[i].on_test_end != NULL) {
+			dispatcher->listeners[i].on_test_end(model, dispatcher->listeners[i].data, report);
+		}
+	}
+	ct_allocation_tracker_resume();
+}
+
+void ct_dispatch_run_end(struct ct_model* model) {
+	struct ct_event_dispatcher* dispatcher = model->event_dispatcher;
+
+	ct_allocation_tracker_pause();
+	for (int i = 0; i < dispatcher->listeners_number; i++) {
+		if (dispatcher->listeners[i].on_run_end != NULL) {
+			dispatcher->listeners[i].on_run_end(model, dispatcher->listeners[i].data);
+		}
+	}
+	ct_allocation_tracker_resume();
+}
+
+void ct_destroy_event_dispatcher(struct ct_event_dispatcher* dispatcher) {
+	free(dispatcher);
+}
+/*
+ * flaky.c
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: koldar
+ */
+
+#include <stdlib.h>
+#include <string.h>
+
+
+
+
+
+
+
+
+static void ct_compute_flakiness(struct ct_model* model, struct ct_test_report* first_repetition);
+
+void ct_detect_flaky_tests(struct ct_model* model) {
+	if (model->repetitions <= 1) {
+		return;
+	}
+
+	int reports_number = ct_list_size(model->test_reports_list);
+	struct ct_test_report** reports = malloc(sizeof(struct ct_test_report*) * (reports_number + 1));
+	//for each report, how many reports of the same testcase precede it in the same repetition
+	int* occurrences = malloc(sizeof(int) * (reports_number + 1));
+	bool* linked = calloc(reports_number + 1, sizeof(bool));
+	if (reports == NULL || occurrences == NULL || linked == NULL) {
+		CT_MALLOC_ERROR_CALLBACK();
+	}
+
+	int i = 0;
+	CT_ITERATE_ON_LIST(model->test_reports_list, report_cell, report, struct ct_test_report*) {
+		reports[i] = report;
+		occurrences[i] = 0;
+		for (int j = i - 1; j >= 0 && reports[j]->repetition == report->repetition; j--) {
+			if (strcmp(reports[j]->testcase_snapshot->description, report->testcase_snapshot->description) == 0) {
+				occurrences[i] += 1;
+			}
+		}
+		i += 1;
+	}
+
+	model->statistics->flaky_tests = 0;
+	for (i = 0; i < reports_number; i++) {
+		if (linked[i]) {
+			continue;
+		}
+		struct ct_test_report* last = reports[i];
+		for (int j = i + 1; j < reports_number; j++) {
+			if (linked[j] || reports[j]->repetition <= last->repetition || occurrences[j] != occurrences[i]) {
+				continue;
+			}
+			if (strcmp(reports[j]->testcase_snapshot->description, reports[i]->testcase_snapshot->description) != 0) {
+				continue;
+			}
+			last->next_repetition = reports[j];
+			last = reports[j];
+			linked[j] = true;
+		}
+
+		ct_compute_flakiness(model, reports[i]);
+		if (reports[i]->flakiness->flaky) {
+			model->statistics->flaky_tests += 1;
+		}
+	}
+
+	free(linked);
+	free(occurrences);
+	free(reports);
+}
+
+bool ct_snapshot_trees_diverge(const struct ct_snapshot* a, const struct ct_snapshot* b) {
+	if (a == NULL || b == NULL) {
+		return a != b;
+	}
+	if (a->status != b->status || strcmp(a->description, b->description) != 0) {
+		return true;
+	}
+	if (ct_list_size(a->assertion_reports) != ct_list_size(b->assertion_reports)) {
+		return true;
+	}
+
+	ct_list_entry_o* entry_b = _ct_list_head_entry(b->assertion_reports);
+	CT_ITERATE_ON_LIST(a->assertion_reports, entry_a, assertion_a, struct ct_assert_report*) {
+		struct ct_assert_report* assertion_b = _ct_list_get_entry_payload(entry_b);
+		if (assertion_a->passed != assertion_b->passed) {
+			return true;
+		}
+		entry_b = _ct_list_get_next_entry(entry_b);
+	}
+
+	return ct_snapshot_trees_diverge(a->first_child, b->first_child) || ct_snapshot_trees_diverge(a->next_sibling, b->next_sibling);
+}
+
+/**
+ * Computes how a test behaved across all its repetitions
+ *
+ * @param[in] model the model to handle
+ * @param[inout] first_repetition the report of the first repetition of the test. The computed struct ct_flakiness is stored here
+ */
+static void ct_compute_flakiness(struct ct_model* model, struct ct_test_report* first_repetition) {
+	struct ct_flakiness* flakiness = malloc(sizeof(struct ct_flakiness));
+	if (flakiness == NULL) {
+		CT_MALLOC_ERROR_CALLBACK();
+	}
+
+	flakiness->runs = 0;
+	flakiness->failed_runs = 0;
+	flakiness->snapshots_diverge = false;
+	flakiness->elapsed_time_mean = 0;
+	flakiness->elapsed_time_variance = 0;
+	for (struct ct_test_report* report = first_repetition; report != NULL; report = report->next_repetition) {
+		flakiness->runs += 1;
+		if (report->outcome != CT_TEST_SUCCESS) {
+			flakiness->failed_runs += 1;
+		}
+		if (ct_snapshot_trees_diverge(first_repetition->testcase_snapshot, report->testcase_snapshot)) {
+			flakiness->snapshots_diverge = true;
+		}
+		flakiness->elapsed_time_mean += report->testcase_snapshot->elapsed_time;
+	}
+	flakiness->elapsed_time_mean /= flakiness->runs;
+	for (struct ct_test_report* report = first_repetition; report != NULL; report = report->next_repetition) {
+		double deviation = report->testcase_snapshot->elapsed_time - flakiness->elapsed_time_mean;
+		flakiness->elapsed_time_variance += deviation * deviation;
+	}
+	flakiness->elapsed_time_variance /= flakiness->runs;
+
+	flakiness->flaky = flakiness->snapshots_diverge || flakiness->runs != model->repetitions
+			|| (flakiness->failed_runs > 0 && flakiness->failed_runs < flakiness->runs);
+	first_repetition->flakiness = flakiness;
+}
+/*
+ * fuzz.c
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: koldar
+ */
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <errno.h>
+#include <dirent.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <sys/types.h>
+#include <sys/wait.h>
+
+
+
+
+
+
+
+
+
+
+
+/**
+ * What an empty input points to, since mapping an empty file is not allowed
+ */
+static const uint8_t ct_empty_fuzz_data[1] = { 0 };
+
+static struct ct_fuzz_corpus* ct_init_fuzz_corpus(int inputs_number);
+static struct ct_fuzz_corpus* ct_load_fuzz_corpus(const char* directory);
+static void ct_map_fuzz_input(struct ct_fuzz_input* input);
+static int ct_compare_fuzz_inputs(const void* a, const void* b);
+static bool ct_fuzz_split_among_workers(struct ct_model* model, struct ct_fuzz_corpus* corpus);
+static struct ct_fuzz_input* ct_fuzz_current_input(struct ct_model* model);
+static void ct_fuzz_send_tests(struct ct_model* model, struct ct_fuzz_corpus* corpus, int input);
+static bool ct_fuzz_receive_tests(struct ct_model* model, struct ct_fuzz_corpus* corpus, struct ct_serialized_buffer* buffer, int worker, int workers_number);
+static void ct_fuzz_add_received_tests(struct ct_model* model, struct ct_fuzz_corpus* corpus, int input);
+
+void ct_set_fuzz_input(struct ct_model* model, const uint8_t* data, size_t size) {
+	struct ct_fuzz_input* input = model->fuzzer_input;
+	if (input == NULL) {
+		input = malloc(sizeof(struct ct_fuzz_input));
+		if (input == NULL) {
+			CT_MALLOC_ERROR_CALLBACK();
+		}
+	}
+
+	input->path = NULL;
+	input->data = (data != NULL) ? data : ct_empty_fuzz_data;
+	input->size = size;
+	input->mapped = false;
+	model->fuzzer_input = input;
+}
+
+void ct_fuzz_end_input(struct ct_model* model) {
+	ct_reset_tests(model);
+}
+
+void ct_fuzz_teardown() {
+	if (ct_model == NULL) {
+		return;
+	}
+	if (ct_model->ct_teardown != NULL) {
+		ct_model->ct_teardown();
+	}
+	ct_teardown_default_model(ct_model);
+	ct_model = NULL;
+}
+
+bool ct_is_fuzzing(const struct ct_model* model) {
+	return model->fuzzer_input != NULL;
+}
+
+struct ct_fuzz_input* ct_fuzz_start(struct ct_model* model) {
+	struct ct_fuzz_corpus* corpus;
+
+	ct_allocation_tracker_pause();
+	if (ct_is_fuzzing(model)) {
+		corpus = ct_init_fuzz_corpus(1);
+		corpus->inputs[0] = *model->fuzzer_input;
+	} else if (model->corpus_path != NULL) {
+		corpus = ct_load_fuzz_corpus(model->corpus_path);
+	} else {
+		//like a fuzzer, without a corpus we start from the empty input
+		corpus = ct_init_fuzz_corpus(1);
+		corpus->inputs[0] = (struct ct_fuzz_input) { NULL, ct_empty_fuzz_data, 0, false };
+	}
+
+	for (int i = 0; i < corpus->inputs_number; i++) {
+		corpus->selected[i] = i;
+	}
+	corpus->selected_number = corpus->inputs_number;
+	ct_allocation_tracker_resume();
+
+	//in a distributed run the processes are the workers of the coordinator: the inputs are not split any further
+	if (!ct_is_fuzzing(model) && model->distribution == NULL && corpus->inputs_number > 1 && ct_get_workers_number(model) > 1) {
+		if (ct_fuzz_split_among_workers(model, corpus)) {
+			//we are a worker process: only our share of the inputs is in corpus->selected
+		} else {
+			//we are the test process: only the inputs which failed in the workers are run again
+			corpus->selected_number = 0;
+			for (int i = 0; i < corpus->inputs_number; i++) {
+				if (corpus->failed[i]) {
+					corpus->selected[corpus->selected_number] = i;
+					corpus->selected_number += 1;
+				}
+			}
+		}
+	}
+
+	model->fuzz_corpus = corpus;
+	corpus->current = -1;
+	return ct_fuzz_next(model);
+}
+
+struct ct_fuzz_input* ct_fuzz_next(struct ct_model* model) {
+	struct ct_fuzz_corpus* corpus = model->fuzz_corpus;
+
+	if (corpus->worker && corpus->current >= 0) {
+		//tell the test process if the input we have just run failed, otherwise send it the tests
+		int input = corpus->selected[corpus->current];
+		for (int i = corpus->reports_before_input; i < ct_list_size(model->test_reports_list); i++) {
+			struct ct_test_report* report = ct_list_get(model->test_reports_list, i);
+			if (report->outcome == CT_TEST_FAILURE) {
+				corpus->failed[input] = true;
+			}
+		}
+		if (!corpus->failed[input]) {
+			ct_fuzz_send_tests(model, corpus, input);
+		}
+	}
+
+	corpus->current += 1;
+	if (corpus->current < corpus->selected_number) {
+		//the tests of the inputs before this one, run by the workers, come first
+		ct_fuzz_add_received_tests(model, corpus, corpus->selected[corpus->current]);
+		corpus->reports_before_input = ct_list_size(model->test_reports_list);
+		return &corpus->inputs[corpus->selected[corpus->current]];
+	}
+
+	if (corpus->worker) {
+		//the output buffered by the worker belongs to the tests run by the test process
+		ct_allocation_tracker_pause();
+		bool sent = !ferror(corpus->channel) && fclose(corpus->channel) == 0;
+		_exit(sent ? EXIT_SUCCESS : EXIT_FAILURE);
+	}
+	ct_fuzz_add_received_tests(model, corpus, corpus->inputs_number);
+	const struct ct_section* claimed_testcase = corpus->claimed_testcase;
+	model->fuzz_corpus = NULL;
+	ct_allocation_tracker_pause();
+	ct_destroy_fuzz_corpus(corpus);
+	ct_allocation_tracker_resume();
+	ct_distribution_end_testcase(model, claimed_testcase);
+	return NULL;
+}
+
+bool ct_fuzz_claim(struct ct_model* model) {
+	struct ct_fuzz_corpus* corpus = model->fuzz_corpus;
+
+	if (model->distribution == NULL || corpus->claimed_testcase != NULL) {
+		return true;
+	}
+	//every input has its own section: the coordinator knows only the first one
+	corpus->claimed_testcase = model->current_section;
+	if (ct_distribution_claim(model, model->current_section)) {
+		return true;
+	}
+	ct_section_set_skipped(model->current_section);
+	corpus->current = corpus->selected_number;
+	return false;
+}
+
+void ct_destroy_fuzz_corpus(struct ct_fuzz_corpus* corpus) {
+	for (int i = 0; i < corpus->inputs_number; i++) {
+		if (corpus->inputs[i].mapped) {
+			munmap((void*) corpus->inputs[i].data, corpus->inputs[i].size);
+		}
+		free(corpus->inputs[i].path);
+	}
+	if (corpus->failed != NULL) {
+		munmap(corpus->failed, sizeof(bool) * corpus->inputs_number);
+	}
+	if (corpus->received != NULL) {
+		for (int i = 0; i < corpus->inputs_number; i++) {
+			if (corpus->received[i] != NULL) {
+				ct_list_destroy_with_elements(corpus->received[i], (ct_destroyer_c) ct_destroy_test_report);
+			}
+		}
+		free(corpus->received);
+	}
+	free(corpus->selected);
+	free(corpus->inputs);
+	free(corpus);
+}
+
+void ct_fuzz_update_test_report(struct ct_model* model, struct ct_test_report* report) {
+	struct ct_fuzz_input* input = ct_fuzz_current_input(model);
+
+	if (input == NULL || input->path == NULL) {
+		return;
+	}
+	report->fuzz_input = strdup(input->path);
+	if (report->fuzz_input == NULL) {
+		CT_MALLOC_ERROR_CALLBACK();
+	}
+}
+
+/**
+ * Creates a corpus with uninitialized inputs
+ *
+ * @param[in] inputs_number the number of inputs of the corpus
+ * @return the corpus
+ */
+static struct ct_fuzz_corpus* ct_init_fuzz_corpus(int inputs_number) {
+	struct ct_fuzz_corpus* ret_val = malloc(sizeof(struct ct_fuzz_corpus));
+	if (ret_val == NULL) {
+		CT_MALLOC_ERROR_CALLBACK();
+	}
+	ret_val->inputs = malloc(sizeof(struct ct_fuzz_input) * (inputs_number > 0 ? inputs_number : 1));
+	ret_val->selected = malloc(sizeof(int) * (inputs_number > 0 ? inputs_number : 1));
+	if (ret_val->inputs == NULL || ret_val->selected == NULL) {
+		CT_MALLOC_ERROR_CALLBACK();
+	}
+
+	ret_val->inputs_number = inputs_number;
+	ret_val->selected_number = 0;
+	ret_val->current = -1;
+	ret_val->failed = NULL;
+	ret_val->worker = false;
+	ret_val->reports_before_input = 0;
+	ret_val->channel = NULL;
+	ret_val->received = NULL;
+	ret_val->next_received = 0;
+	ret_val->claimed_testcase = NULL;
+
+	return ret_val;
+}
+
+/**
+ * Memory-maps every regular file inside a directory
+ *
+ * @param[in] directory the directory containing the corpus
+ * @return the corpus, whose inputs are sorted by path
+ */
+static struct ct_fuzz_corpus* ct_load_fuzz_corpus(const char* directory) {
+	DIR* dir = opendir(directory);
+	if (dir == NULL) {
+		fprintf(stderr, "CrashC - cannot open the corpus directory \"%s\"\n", directory);
+		exit(1);
+	}
+
+	int capacity = 16;
+	int inputs_number = 0;
+	struct ct_fuzz_input* inputs = malloc(sizeof(struct ct_fuzz_input) * capacity);
+	if (inputs == NULL) {
+		CT_MALLOC_ERROR_CALLBACK();
+	}
+
+	struct dirent* entry;
+	struct stat file_stat;
+	while ((entry = readdir(dir)) != NULL) {
+		size_t path_length = strlen(directory) + strlen(entry->d_name) + 2;
+		char* path = malloc(path_length);
+		if (path == NULL) {
+			CT_MALLOC_ERROR_CALLBACK();
+		}
+		snprintf(path, path_length, "%s/%s", directory, entry->d_name);
+		if (stat(path, &file_stat) != 0 || !S_ISREG(file_stat.st_mode)) {
+			free(path);
+			continue;
+		}
+
+		if (inputs_number == capacity) {
+			capacity *= 2;
+			inputs = realloc(inputs, sizeof(struct ct_fuzz_input) * capacity);
+			if (inputs == NULL) {
+				CT_MALLOC_ERROR_CALLBACK();
+			}
+		}
+		inputs[inputs_number].path = path;
+		inputs_number += 1;
+	}
+	closedir(dir);
+
+	qsort(inputs, inputs_number, sizeof(struct ct_fuzz_input), ct_compare_fuzz_inputs);
+	for (int i = 0; i < inputs_number; i++) {
+		ct_map_fuzz_input(&inputs[i]);
+	}
+
+	struct ct_fuzz_corpus* ret_val = ct_init_fuzz_corpus(0);
+	free(ret_val->inputs);
+	free(ret_val->selected);
+	ret_val->inputs = inputs;
+	ret_val->inputs_number = inputs_number;
+	ret_val->selected = malloc(sizeof(int) * (inputs_number > 0 ? inputs_number : 1));
+	if (ret_val->selected == NULL) {
+		CT_MALLOC_ERROR_CALLBACK();
+	}
+
+	return ret_val;
+}
+
+/**
+ * Maps in memory the file of an input
+ *
+ * @param[inout] input the input whose struct ct_fuzz_input::path is already set
+ */
+static void ct_map_fuzz_input(struct ct_fuzz_input* input) {
+	struct stat file_stat;
+
+	input->data = ct_empty_fuzz_data;
+	input->size = 0;
+	input->mapped = false;
+
+	int fd = open(input->path, O_RDONLY);
+	if (fd < 0 || fstat(fd, &file_stat) != 0) {
+		fprintf(stderr, "CrashC - cannot read the corpus file \"%s\"\n", input->path);
+		exit(1);
+	}
+	if (file_stat.st_size > 0) {
+		void* data = mmap(NULL, file_stat.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+		if (data == MAP_FAILED) {
+			fprintf(stderr, "CrashC - cannot map the corpus file \"%s\"\n", input->path);
+			exit(1);
+		}
+		input->data = data;
+		input->size = file_stat.st_size;
+		input->mapped = true;
+	}
+	close(fd);
+}
+
+static int ct_compare_fuzz_inputs(const void* a, const void* b) {
+	return strcmp(((const struct ct_fuzz_input*) a)->path, ((const struct ct_fuzz_input*) b)->path);
+}
+
+/**
+ * Splits the inputs of a corpus among several forked worker processes
+ *
+ * Each worker runs every input whose index is congruent to its own id modulo the number of workers. It marks in struct ct_fuzz_corpus::failed
+ * the ones which failed and sends back through a pipe the tests of the other ones, which the test process keeps in struct ct_fuzz_corpus::received.
+ * The test process waits for every worker: if a worker dies or sends something it can't understand, all its inputs are marked as failed.
+ *
+ * @param[inout] model the model to handle
+ * @param[inout] corpus the corpus to split
+ * @return @true in the worker processes, @false in the test process once every worker has terminated
+ */
+static bool ct_fuzz_split_among_workers(struct ct_model* model, struct ct_fuzz_corpus* corpus) {
+	int workers_number = ct_get_workers_number(model);
+	if (workers_number > corpus->inputs_number) {
+		workers_number = corpus->inputs_number;
+	}
+
+	corpus->failed = mmap(NULL, sizeof(bool) * corpus->inputs_number, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_ANONYMOUS, -1, 0);
+	if (corpus->failed == MAP_FAILED) {
+		perror("CrashC - cannot share the fuzzing results among workers");
+		exit(1);
+	}
+	memset(corpus->failed, 0, sizeof(bool) * corpus->inputs_number);
+
+	ct_allocation_tracker_pause();
+	pid_t* workers = malloc(sizeof(pid_t) * workers_number);
+	int* channels = malloc(sizeof(int) * workers_number);
+	ct_allocation_tracker_resume();
+	if (workers == NULL || channels == NULL) {
+		CT_MALLOC_ERROR_CALLBACK();
+	}
+
+	//the buffered output would be printed by every worker as well
+	fflush(NULL);
+	for (int w = 0; w < workers_number; w++) {
+		int channel[2];
+		if (pipe(channel) != 0) {
+			perror("CrashC - cannot create a pipe towards a fuzzing worker");
+			exit(1);
+		}
+		pid_t pid = fork();
+		if (pid < 0) {
+			perror("CrashC - cannot fork a fuzzing worker");
+			exit(1);
+		}
+		if (pid == 0) {
+			//the read ends of the previous workers would keep their pipes open
+			for (int previous = 0; previous < w; previous++) {
+				close(channels[previous]);
+			}
+			close(channel[0]);
+			ct_allocation_tracker_pause();
+			corpus->channel = fdopen(channel[1], "w");
+			free(channels);
+			free(workers);
+			ct_allocation_tracker_resume();
+			if (corpus->channel == NULL) {
+				_exit(EXIT_FAILURE);
+			}
+			corpus->worker = true;
+			corpus->selected_number = 0;
+			for (int i = w; i < corpus->inputs_number; i += workers_number) {
+				corpus->selected[corpus->selected_number] = i;
+				corpus->selected_number += 1;
+			}
+			return true;
+		}
+		close(channel[1]);
+		channels[w] = channel[0];
+		workers[w] = pid;
+	}
+
+	ct_allocation_tracker_pause();
+	corpus->received = calloc(corpus->inputs_number, sizeof(ct_list_o*));
+	if (corpus->received == NULL) {
+		CT_MALLOC_ERROR_CALLBACK();
+	}
+	if (model->fuzz_arena == NULL) {
+		model->fuzz_arena = ct_init_report_arena();
+	}
+	for (int w = 0; w < workers_number; w++) {
+		//a worker can't terminate until what it sends has been read
+		struct ct_serialized_buffer buffer;
+		ct_read_serialized_data(channels[w], &buffer);
+		close(channels[w]);
+
+		int status;
+		while (waitpid(workers[w], &status, 0) < 0) {
+			if (errno != EINTR) {
+				perror("CrashC - cannot wait for a fuzzing worker");
+				exit(1);
+			}
+		}
+		bool received = WIFEXITED(status) && WEXITSTATUS(status) == EXIT_SUCCESS && ct_fuzz_receive_tests(model, corpus, &buffer, w, workers_number);
+		free(buffer.data);
+		if (!received) {
+			for (int i = w; i < corpus->inputs_number; i += workers_number) {
+				corpus->failed[i] = true;
+				if (corpus->received[i] != NULL) {
+					ct_list_destroy_with_elements(corpus->received[i], (ct_destroyer_c) ct_destroy_test_report);
+					corpus->received[i] = NULL;
+				}
+			}
+		}
+	}
+
+	free(channels);
+	free(workers);
+	ct_allocation_tracker_resume();
+	return false;
+}
+
+/**
+ * Sends the tests of an input which has passed to the test process
+ *
+ * For every input, the worker writes the index of the input, the number of its tests and the tests themselves.
+ *
+ * @param[in] model the model of the worker process
+ * @param[inout] corpus the corpus of the worker process
+ * @param[in] input the index of the input just run
+ */
+static void ct_fuzz_send_tests(struct ct_model* model, struct ct_fuzz_corpus* corpus, int input) {
+	int reports_number = ct_list_size(model->test_reports_list) - corpus->reports_before_input;
+
+	ct_allocation_tracker_pause();
+	fwrite(&input, sizeof(input), 1, corpus->channel);
+	fwrite(&reports_number, sizeof(reports_number), 1, corpus->channel);
+	int index = 0;
+	CT_ITERATE_ON_LIST(model->test_reports_list, cell, report, struct ct_test_report*) {
+		if (index >= corpus->reports_before_input) {
+			ct_serialize_test_report(corpus->channel, report);
+		}
+		index += 1;
+	}
+	ct_allocation_tracker_resume();
+}
+
+/**
+ * Deserializes the tests a worker process has sent back into struct ct_fuzz_corpus::received
+ *
+ * @param[inout] model the model of the test process
+ * @param[inout] corpus the corpus of the test process
+ * @param[inout] buffer what the worker has sent
+ * @param[in] worker the id of the worker
+ * @param[in] workers_number the number of workers the inputs have been split among
+ * @return @true if the worker has sent only whole tests of its own inputs, @false otherwise
+ */
+static bool ct_fuzz_receive_tests(struct ct_model* model, struct ct_fuzz_corpus* corpus, struct ct_serialized_buffer* buffer, int worker, int workers_number) {
+	while (buffer->position < buffer->size && !buffer->corrupted) {
+		int input;
+		int reports_number;
+		ct_deserialize_bytes(buffer, &input, sizeof(input));
+		ct_deserialize_bytes(buffer, &reports_number, sizeof(reports_number));
+		if (buffer->corrupted || input < 0 || input >= corpus->inputs_number || input % workers_number != worker || corpus->failed[input]) {
+			return false;
+		}
+
+		if (corpus->received[input] == NULL) {
+			corpus->received[input] = ct_list_init();
+		}
+		for (int i = 0; i < reports_number && !buffer->corrupted; i++) {
+			ct_list_add_tail(corpus->received[input], ct_deserialize_test_report(buffer, model->fuzz_arena));
+		}
+	}
+	return !buffer->corrupted;
+}
+
+/**
+ * Adds to the model the tests the worker processes have sent back for the inputs preceding a given one
+ *
+ * The listeners are notified of the tests, as if they had just ended.
+ *
+ * @param[inout] model the model of the test process
+ * @param[inout] corpus the corpus of the test process
+ * @param[in] input the index of the first input whose tests are not added
+ */
+static void ct_fuzz_add_received_tests(struct ct_model* model, struct ct_fuzz_corpus* corpus, int input) {
+	if (corpus->received == NULL) {
+		return;
+	}
+
+	for (; corpus->next_received < input; corpus->next_received++) {
+		ct_list_o* received = corpus->received[corpus->next_received];
+		if (received == NULL) {
+			continue;
+		}
+		if (CT_HAS_LISTENERS(model, CT_EVENT_TEST_END)) {
+			CT_ITERATE_ON_LIST(received, cell, report, struct ct_test_report*) {
+				ct_dispatch_test_end(model, report);
+			}
+		}
+		ct_allocation_tracker_pause();
+		ct_list_full_transfer(model->test_reports_list, received);
+		ct_list_destroy(received);
+		ct_allocation_tracker_resume();
+		corpus->received[corpus->next_received] = NULL;
+	}
+}
+
+/**
+ * Fetches the input the running ::FUZZ_TESTCASE is using
+ *
+ * @param[in] model the model to handle
+ * @return the input or @null if no ::FUZZ_TESTCASE is running
+ */
+static struct ct_fuzz_input* ct_fuzz_current_input(struct ct_model* model) {
+	struct ct_fuzz_corpus* corpus = model->fuzz_corpus;
+
+	if (corpus == NULL || corpus->current < 0 || corpus->current >= corpus->selected_number) {
+		return NULL;
+	}
+	return &corpus->inputs[corpus->selected[corpus->current]];
+}
+/*
+ * hardware_counters.c
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: koldar
+ */
+
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <unistd.h>
+
+#ifdef __linux__
+#	include <sys/ioctl.h>
+#	include <sys/syscall.h>
+#	include <linux/perf_event.h>
+#endif
+
+
+
+
+static long long* ct_hardware_counter_field(struct ct_hardware_counters* counters, enum ct_hardware_event event);
+static void ct_set_hardware_counters_unavailable(struct ct_hardware_counters* counters);
+#ifdef __linux__
+static int ct_open_hardware_counter(enum ct_hardware_event event, int group_fd);
+#endif
+
+struct ct_hardware_counters_group* ct_init_hardware_counters_group() {
+	struct ct_hardware_counters_group* ret_val = malloc(sizeof(struct ct_hardware_counters_group));
+	if (ret_val == NULL) {
+		CT_MALLOC_ERROR_CALLBACK();
+	}
+
+	ret_val->available = false;
+	ret_val->leader_fd = -1;
+	ret_val->size = 0;
+	for (int i = 0; i < CT_HW_EVENTS_NUMBER; i++) {
+		ret_val->fds[i] = -1;
+		ret_val->positions[i] = -1;
+	}
+
+#if defined(__linux__) && CT_HARDWARE_COUNTERS_ENABLED
+	for (int i = 0; i < CT_HW_EVENTS_NUMBER; i++) {
+		int fd = ct_open_hardware_counter(i, ret_val->leader_fd);
+		if (fd < 0) {
+			//the event is not supported or we can't access it: we just go without it
+			continue;
+		}
+		if (ret_val->leader_fd < 0) {
+			ret_val->leader_fd = fd;
+		}
+		ret_val->fds[i] = fd;
+		ret_val->positions[i] = ret_val->size;
+		ret_val->size += 1;
+	}
+	ret_val->available = ret_val->size > 0;
+#endif
+
+	return ret_val;
+}
+
+void ct_destroy_hardware_counters_group(struct ct_hardware_counters_group* group) {
+	for (int i = 0; i < CT_HW_EVENTS_NUMBER; i++) {
+		if (group->fds[i] >= 0) {
+			close(group->fds[i]);
+		}
+	}
+	free(group);
+}
+
+void ct_hardware_counters_enable(struct ct_hardware_counters_group* group) {
+#ifdef __linux__
+	if (group->available) {
+		ioctl(group->leader_fd, PERF_EVENT_IOC_ENABLE, PERF_IOC_FLAG_GROUP);
+	}
+#endif
+}
+
+void ct_hardware_counters_disable(struct ct_hardware_counters_group* group) {
+#ifdef __linux__
+	if (group->available) {
+		ioctl(group->leader_fd, PERF_EVENT_IOC_DISABLE, PERF_IOC_FLAG_GROUP);
+	}
+#endif
+}
+
+bool ct_read_hardware_counters(const struct ct_hardware_counters_group* group, struct ct_hardware_counters* counters) {
+	ct_set_hardware_counters_unavailable(counters);
+	if (!group->available) {
+		return false;
+	}
+
+	//with PERF_FORMAT_GROUP the kernel returns the number of counters followed by the value of each of them
+	uint64_t buffer[1 + CT_HW_EVENTS_NUMBER];
+	ssize_t bytes_read = read(group->leader_fd, buffer, sizeof(buffer));
+	if (bytes_read < (ssize_t) sizeof(uint64_t) || buffer[0] != (uint64_t) group->size) {
+		return false;
+	}
+
+	for (int i = 0; i < CT_HW_EVENTS_NUMBER; i++) {
+		if (group->positions[i] >= 0) {
+			*ct_hardware_counter_field(counters, i) = (long long) buffer[1 + group->positions[i]];
+		}
+	}
+	return true;
+}
+
+void ct_begin_hardware_counters(const struct ct_hardware_counters_group* group, struct ct_hardware_counters* counters) {
+	ct_read_hardware_counters(group, counters);
+}
+
+void ct_end_hardware_counters(const struct ct_hardware_counters_group* group, struct ct_hardware_counters* counters) {
+	struct ct_hardware_counters now;
+	ct_read_hardware_counters(group, &now);
+
+	for (int i = 0; i < CT_HW_EVENTS_NUMBER; i++) {
+		long long* start = ct_hardware_counter_field(counters, i);
+		long long end = *ct_hardware_counter_field(&now, i);
+		if (*start == CT_HARDWARE_COUNTER_UNAVAILABLE || end == CT_HARDWARE_COUNTER_UNAVAILABLE) {
+			*start = CT_HARDWARE_COUNTER_UNAVAILABLE;
+		} else {
+			*start = end - *start;
+		}
+	}
+}
+
+static long long* ct_hardware_counter_field(struct ct_hardware_counters* counters, enum ct_hardware_event event) {
+	switch (event) {
+	case CT_HW_INSTRUCTIONS: return &counters->instructions;
+	case CT_HW_CYCLES: return &counters->cycles;
+	case CT_HW_CACHE_MISSES: return &counters->cache_misses;
+	case CT_HW_BRANCH_MISSES: return &counters->branch_misses;
+	default: return NULL;
+	}
+}
+
+static void ct_set_hardware_counters_unavailable(struct ct_hardware_counters* counters) {
+	counters->instructions = CT_HARDWARE_COUNTER_UNAVAILABLE;
+	counters->cycles = CT_HARDWARE_COUNTER_UNAVAILABLE;
+	counters->cache_misses = CT_HARDWARE_COUNTER_UNAVAILABLE;
+	counters->branch_misses = CT_HARDWARE_COUNTER_UNAVAILABLE;
+}
+
+#ifdef __linux__
+/**
+ * Opens a single hardware counter of the calling process
+ *
+ * @param[in] event the event to count
+ * @param[in] group_fd the leader of the group the counter will belong to. -1 if the counter will be the leader itself
+ * @return the file descriptor of the counter or -1 if the counter could not be opened
+ */
+static int ct_open_hardware_counter(enum ct_hardware_event event, int group_fd) {
+	static const uint64_t configs[CT_HW_EVENTS_NUMBER] = {
+		[CT_HW_INSTRUCTIONS] = PERF_COUNT_HW_INSTRUCTIONS,
+		[CT_HW_CYCLES] = PERF_COUNT_HW_CPU_CYCLES,
+		[CT_HW_CACHE_MISSES] = PERF_COUNT_HW_CACHE_MISSES,
+		[CT_HW_BRANCH_MISSES] = PERF_COUNT_HW_BRANCH_MISSES,
+	};
+	struct perf_event_attr attr;
+
+	memset(&attr, 0, sizeof(struct perf_event_attr));
+	attr.size = sizeof(struct perf_event_attr);
+	attr.type = PERF_TYPE_HARDWARE;
+	attr.config = configs[event];
+	attr.read_format = PERF_FORMAT_GROUP;
+	//only the leader is disabled: the other counters are scheduled together with it
+	attr.disabled = (group_fd < 0) ? 1 : 0;
+	//counting only user space events keeps us working with perf_event_paranoid up to 2
+	attr.exclude_kernel = 1;
+	attr.exclude_hv = 1;
+
+	//the counters measure this process only: the programs it runs have no use for them
+	return (int) syscall(SYS_perf_event_open, &attr, 0, -1, group_fd, PERF_FLAG_FD_CLOEXEC);
+}
+#endif
+/*
+ * hashtable.c
+ *
+ *  Created on: Jan 24, 2017
+ *      Author: koldar
+ */
+
+
+
+
+// File-local functions declarations
+static ct_hashtable_entry_o* ht_init_entry(const void* data, unsigned long key);
+static void ht_destroy_entry(const ct_hashtable_entry_o* entry);
+
+struct ct_hashtable_entry {
+	/**
+	 * the key of a particular value
+	 */
+	unsigned long id;
+	/**
+	 * the value in the hashtable
+	 */
+	void* data;
+	/**
+	 * A field required by \c uthash project to correctly work
+	 */
+	UT_hash_handle hh;
+
+};
+
+struct ct_hashtable {
+	/**
+	 * **head** of the hashtable
+	 *
+	 * \c uthash hashtables are retrieved by a particular ::ct_hashtable_entry_o called **head**. This field is exactly that
+	 */
+	ct_hashtable_entry_o* head;
+};
+
+ct_hashtable_o* ct_ht_init() {
+	ct_hashtable_o* ret_val = malloc(sizeof(ct_hashtable_o));
+	if (ret_val == NULL) {
+		CT_MALLOC_ERROR_CALLBACK();
+	}
+
+	ret_val->head = NULL;
+
+	return ret_val;
+}
+
+int ct_ht_size(const ct_hashtable_o* ht) {
+	int ret_val;
+	ret_val = HASH_COUNT(ht->head);
+	return ret_val;
+}
+
+void* ct_ht_get(const ct_hashtable_o* ht, unsigned long key) {
+	ct_hashtable_entry_o* tmp;
+
+	HASH_FIND(hh, ht->head, &key, sizeof(unsigned long), tmp);
+	if (tmp == NULL) {
+		return NULL;
+	}
+	return tmp->data;
+}
+
+bool ct_ht_contains(const ct_hashtable_o* ht, unsigned long key) {
+	ct_hashtable_entry_o* tmp;
+	HASH_FIND(hh, ht->head, &key, sizeof(unsigned long), tmp);
+	return (tmp != NULL);
+}
+
+bool ct_ht_put_or_update(ct_hashtable_o* ht, unsigned long key, const void* data) {
+	ct_hashtable_entry_o* tmp;
+
+	HASH_FIND(hh, ht->head, &key, sizeof(unsigned long), tmp);
+	if (tmp == NULL) {
+		ct_ht_put(ht, key, data);
+		return true;
+	} else {
+		tmp->data = (void*) data;
+		return false;
+	}
+}
+
+bool ct_ht_update(ct_hashtable_o* ht, unsigned long key, const void* data) {
+	ct_hashtable_entry_o* tmp;
+
+	HASH_FIND(hh, ht->head, &key, sizeof(unsigned long), tmp);
+	if (tmp == NULL) {
+		return false;
+	}
+	tmp->data = (void*) data;
+	return true;
+}
+
+void ct_ht_put(ct_hashtable_o* ht, unsigned long key, const void* data) {
+	ct_hashtable_entry_o* add = ht_init_entry(data, key);
+	HASH_ADD(hh,ht->head,id, sizeof(unsigned long), add);
+}
+
+void ct_ht_destroy(ct_hashtable_o* ht) {
+	ct_hashtable_entry_o* s;
+	ct_hashtable_entry_o* tmp;
+
+	HASH_ITER(hh, ht->head, s, tmp) {
+		HASH_DEL(ht->head, s);
+		ht_destroy_entry(s);
+	}
+}
+
+void ct_ht_destroy_with_elements(ct_hashtable_o* ht, ct_destroyer_c d) {
+	ct_hashtable_entry_o* s;
+	ct_hashtable_entry_o* tmp;
+
+	HASH_ITER(hh, ht->head, s, tmp) {
+		HASH_DEL(ht->head, s);
+		d(s->data);
+		ht_destroy_entry(s);
+	}
+}
+
+bool ct_ht_remove(ct_hashtable_o* ht, unsigned long key) {
+	ct_hashtable_entry_o* tmp;
+
+	HASH_FIND(hh, ht->head, &key, sizeof(unsigned long), tmp);
+	if (tmp == NULL) {
+		return false;
+	}
+	HASH_DEL(ht->head, tmp);
+	ht_destroy_entry(tmp);
+	return true;
+}
+
+bool ct_ht_remove_and_destroy(ct_hashtable_o* ht, unsigned long key, ct_destroyer_c d) {
+	ct_hashtable_entry_o* tmp;
+
+	HASH_FIND(hh, ht->head, &key, sizeof(unsigned long), tmp);
+	if (tmp == NULL) {
+		return false;
+	}
+	HASH_DEL(ht->head, tmp);
+	d(tmp->data);
+	ht_destroy_entry(tmp);
+	return true;
+}
+
+bool ct_ht_is_empty(const ct_hashtable_o* ht) {
+	return ht->head == NULL;
+}
+
+void* ct_ht_get_first(const ct_hashtable_o* ht) {
+	CT_ITERATE_VALUES_ON_HT(ht, data, void*) {
+		return data;
+	}
+	return NULL;
+}
+
+bool ct_ht_swap(ct_hashtable_o* ht, unsigned long key1, unsigned long key2) {
+	ct_hashtable_entry_o* tmp1;
+	ct_hashtable_entry_o* tmp2;
+
+	HASH_FIND(hh, ht->head, &key1, sizeof(unsigned long), tmp1);
+	HASH_FIND(hh, ht->head, &key2, sizeof(unsigned long), tmp2);
+
+	if (tmp1 != NULL && tmp2 != NULL) {
+		//they are both inside the hashtable
+		void* p1 = tmp1->data;
+		void* p2 = tmp2->data;
+		HASH_DEL(ht->head, tmp1);
+		HASH_DEL(ht->head, tmp2);
+
+		ct_ht_put(ht, key1, p2);
+		ct_ht_put(ht, key2, p1);
+
+		return true;
+
+	} else if (tmp1 != NULL) {
+		//key2 is not inside the hashtable
+		ct_ht_put(ht, key2, tmp1->data);
+		HASH_DEL(ht->head, tmp1);
+
+		return true;
+
+	} else if (tmp2 != NULL) {
+		//key1 is not inside the hashtable
+		ct_ht_put(ht, key1, tmp2->data);
+		HASH_DEL(ht->head, tmp2);
+
+		return true;
+	}
+
+	return false;
+}
+
+void ct_ht_clear(ct_hashtable_o* ht) {
+	ct_hashtable_entry_o* s;
+		ct_hashtable_entry_o* tmp;
+
+	HASH_ITER(hh, ht->head, s, tmp) {
+		HASH_DEL(ht->head, s);
+		ht_destroy_entry(s);
+	}
+	ht->head = NULL;
+}
+
+void ct_ht_clear_and_destroy_elements(ct_hashtable_o* ht, ct_destroyer_c d) {
+	ct_hashtable_entry_o* s;
+	ct_hashtable_entry_o* tmp;
+
+	HASH_ITER(hh, ht->head, s, tmp) {
+		HASH_DEL(ht->head, s);
+		d(s->data);
+		ht_destroy_entry(s);
+	}
+	ht->head = NULL;
+}
+
+ct_hashtable_entry_o* _ct_ht_head_entry(ct_hashtable_o* ht) {
+	return ht->head;
+}
+
+void* _ct_ht_entry_next(ct_hashtable_entry_o* entry) {
+	return entry->hh.next;
+}
+
+void* _ct_ht_entry_payload(ct_hashtable_entry_o* entry) {
+	return entry->data;
+}
+
+/**
+ *
+ * \note
+ * The data is added in the cell <b>by reference</b>
+ *
+ * @param[in] data the data to put inside the cell
+ * @param[in] f a function with one parameter <tt>void*</tt> returning the hash of the value, aka an int
+ * @return a cell of an hash table. You still need to manually add it in the hash table though
+ */
+static ct_hashtable_entry_o* ht_init_entry(const void* data, unsigned long key) {
+	ct_hashtable_entry_o* ret_val = malloc(sizeof(ct_hashtable_entry_o));
+	if (ret_val == NULL) {
+		CT_MALLOC_ERROR_CALLBACK();
+	}
+
+	ret_val->id = key;
+	ret_val->data = (void*) data;
+
+	return ret_val;
+}
+
+/**
+ * Frees from the memory the structure \c ct_hashtable_entry_o
+ *
+ * \attention
+ * the function <b>won't free the pointer</b> ::ct_hashtable_entry_o::data
+ *
+ * @param[in] entry the cell to remove from the memory
+ */
+static void ht_destroy_entry(const ct_hashtable_entry_o* entry) {
+	free((void*) entry);
+}
+/*
+ * journal.c
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: koldar
+ */
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <unistd.h>
+#include <fcntl.h>
+
+
+
+
+
+
+
+
+
+
+static struct ct_testcase_key* ct_init_testcase_key(unsigned long path_hash, int occurrence) {
+	struct ct_testcase_key* ret_val = malloc(sizeof(struct ct_testcase_key));
+	if (ret_val == NULL) {
+		CT_MALLOC_ERROR_CALLBACK();
+	}
+
+	ret_val->path_hash = path_hash;
+	ret_val->occurrence = occurrence;
+
+	return ret_val;
+}
+
+/**
+ * Reads the @testcase completed by the previous invocations
+ *
+ * If the last invocation has been killed while writing a record, the truncated record is removed, so that the new records don't get appended to it.
+ *
+ * @param[inout] journal the journal to fill
+ * @param[in] path the file of the journal
+ */
+static void ct_load_journal(struct ct_journal* journal, const char* path) {
+	FILE* file = fopen(path, "r");
+	if (file == NULL) {
+		return;
+	}
+
+	char* line = NULL;
+	size_t line_size = 0;
+	ssize_t length;
+	off_t complete_size = 0;
+	bool truncated = false;
+	struct ct_testcase_key key;
+	while ((length = getline(&line, &line_size, file)) > 0) {
+		if (line[length - 1] != '\n') {
+			truncated = true;
+			break;
+		}
+		complete_size += length;
+		if (line[0] != 'D' || sscanf(line, "D %lx %d", &key.path_hash, &key.occurrence) != 2) {
+			continue;
+		}
+		unsigned long hash = ct_testcase_key_hash(&key);
+		if (ct_ht_get(journal->completed_testcases, hash) == NULL) {
+			ct_ht_put(journal->completed_testcases, hash, ct_init_testcase_key(key.path_hash, key.occurrence));
+		}
+	}
+
+	free(line);
+	fclose(file);
+	if (truncated && truncate(path, complete_size) != 0) {
+		perror("CrashC - cannot remove the truncated record of the journal");
+	}
+}
+
+/**
+ * Appends a record to the journal
+ *
+ * @param[inout] journal the journal to handle
+ * @param[in] record the record, ending with a newline
+ * @param[in] length the number of bytes of \c record
+ */
+static void ct_journal_write(struct ct_journal* journal, const char* record, size_t length) {
+	if (write(journal->file, record, length) != (ssize_t) length) {
+		return;
+	}
+	journal->dirty = true;
+
+	struct timespec now = ct_get_time();
+	if (ct_compute_time_gap(journal->last_sync, now, "u") >= CT_JOURNAL_SYNC_PERIOD) {
+		fdatasync(journal->file);
+		journal->last_sync = now;
+		journal->dirty = false;
+	}
+}
+
+/**
+ * Appends a string to a record, replacing the newlines
+ *
+ * @param[inout] record the record to extend
+ * @param[in] length the number of bytes already in \c record
+ * @param[in] string the string to append
+ * @return the number of bytes in \c record. At most ::CT_JOURNAL_RECORD_SIZE - 2, to leave room for the newline
+ */
+static size_t ct_journal_append(char* record, size_t length, const char* string) {
+	for (; *string != '\0' && length < CT_JOURNAL_RECORD_SIZE - 2; string++, length++) {
+		record[length] = (*string == '\n') ? ' ' : *string;
+	}
+	return length;
+}
+
+static void ct_journal_on_test_end(struct ct_model* model, void* data, struct ct_test_report* report) {
+	struct ct_journal* journal = data;
+	char record[CT_JOURNAL_RECORD_SIZE];
+	//a test of a FUZZ_TESTCASE is not part of any testcase the journal knows about
+	struct ct_testcase_key key = (journal->testcase == model->jump_source_testcase) ? model->testcase_key : (struct ct_testcase_key) { 0, -1 };
+
+	int header = snprintf(record, sizeof(record), "T %lx %d %c %d %ld ",
+			key.path_hash, key.occurrence, (report->outcome == CT_TEST_SUCCESS) ? 'S' : 'F', report->repetition, report->testcase_snapshot->elapsed_time);
+	size_t length = (header < CT_JOURNAL_RECORD_SIZE - 2) ? header : CT_JOURNAL_RECORD_SIZE - 2;
+
+	//the path of the test is the chain of the WHEN it entered
+	const struct ct_snapshot* snapshot = report->testcase_snapshot;
+	while (snapshot != NULL) {
+		if (snapshot != report->testcase_snapshot) {
+			length = ct_journal_append(record, length, (char[]) { CT_SECTION_PATH_SEPARATOR, '\0' });
+		}
+		length = ct_journal_append(record, length, snapshot->description);
+
+		const struct ct_snapshot* child = snapshot->first_child;
+		while (child != NULL && child->type != CT_WHEN_SECTION) {
+			child = child->next_sibling;
+		}
+		snapshot = child;
+	}
+	record[length] = '\n';
+
+	ct_journal_write(journal, record, length + 1);
+}
+
+struct ct_journal* ct_enable_journal(struct ct_model* model, const char* path, bool resume) {
+	struct ct_journal* ret_val = malloc(sizeof(struct ct_journal));
+	if (ret_val == NULL) {
+		CT_MALLOC_ERROR_CALLBACK();
+	}
+
+	ret_val->completed_testcases = ct_ht_init();
+	ret_val->testcase = NULL;
+	ret_val->completed = false;
+	ret_val->skipped_testcases = 0;
+	ret_val->last_sync = ct_get_time();
+	ret_val->dirty = false;
+
+	if (resume) {
+		ct_load_journal(ret_val, path);
+	}
+	ret_val->file = open(path, O_WRONLY | O_CREAT | O_APPEND | O_CLOEXEC | (resume ? 0 : O_TRUNC), 0644);
+	if (ret_val->file < 0) {
+		perror("CrashC - cannot open the journal");
+		exit(EXIT_FAILURE);
+	}
+	ct_journal_write(ret_val, "R\n", 2);
+
+	struct ct_event_listener listener = {
+		.on_suite_start = NULL,
+		.on_section_enter = NULL,
+		.on_assert_fail = NULL,
+		.on_test_end = ct_journal_on_test_end,
+		.on_run_end = NULL,
+		.data = ret_val
+	};
+	ct_subscribe_listener(model, &listener);
+	model->journal = ret_val;
+
+	return ret_val;
+}
+
+bool ct_journal_testcase_completed(struct ct_model* model, const struct ct_section* testcase) {
+	struct ct_journal* journal = model->journal;
+	if (testcase != journal->testcase) {
+		journal->testcase = testcase;
+		journal->completed = ct_journal_key_completed(journal, ct_get_testcase_key(model, testcase));
+		if (journal->completed) {
+			journal->skipped_testcases += 1;
+		}
+	}
+	return journal->completed;
+}
+
+void ct_journal_end_testcase(struct ct_model* model, const struct ct_section* testcase) {
+	struct ct_journal* journal = model->journal;
+	if (testcase != journal->testcase) {
+		return;
+	}
+
+	ct_journal_complete_key(journal, ct_get_testcase_key(model, testcase));
+}
+
+bool ct_journal_key_completed(const struct ct_journal* journal, const struct ct_testcase_key* key) {
+	struct ct_testcase_key* completed = ct_ht_get(journal->completed_testcases, ct_testcase_key_hash(key));
+	//on a hash collision the testcase is simply run again
+	return completed != NULL && completed->path_hash == key->path_hash && completed->occurrence == key->occurrence;
+}
+
+void ct_journal_complete_key(struct ct_journal* journal, const struct ct_testcase_key* key) {
+	char record[CT_BUFFER_SIZE];
+	int length = snprintf(record, sizeof(record), "D %lx %d\n", key->path_hash, key->occurrence);
+	ct_journal_write(journal, record, length);
+}
+
+void ct_destroy_journal(struct ct_journal* journal) {
+	if (journal->dirty) {
+		fdatasync(journal->file);
+	}
+	close(journal->file);
+	if (journal->skipped_testcases > 0) {
+		fprintf(stderr, "CrashC - %d testcases already completed in the journal have been skipped\n", journal->skipped_testcases);
+	}
+	ct_ht_destroy_with_elements(journal->completed_testcases, (ct_destroyer_c) free);
+	free(journal);
+}
+/*
+ * list.c
+ *
+ *  Created on: May 17, 2017
+ *      Author: koldar
+ */
+
+#include <stdio.h>
+#include <string.h>
+
+
+
+
+
+
+struct ct_list_entry {
+	///represents the payload inside this cell of the list
+	void* payload;
+	///a pointer to the next element of the list. Can be NULL
+	struct ct_list_entry* next;
+};
+
+struct ct_list {
+	///number of elements inside the list. Allows count operation to be O(1)
+	int size;
+	///pointer to the first element of the list. Can be NULL
+	ct_list_entry_o* head;
+	///pointer to the last element of the list. Can be NULL
+	ct_list_entry_o* tail;
+};
+
+ct_list_entry_o* _ct_list_get_next_entry(const ct_list_entry_o* entry) {
+	return entry->next;
+}
+
+void* _ct_list_get_entry_payload(const ct_list_entry_o* entry) {
+	return entry->payload;
+}
+
+ct_list_entry_o* _ct_list_head_entry(const ct_list_o* l) {
+	return l->head;
+}
+
+ct_list_o* ct_list_init() {
+	ct_list_o* ret_val = malloc(sizeof(ct_list_o));
+	if (ret_val == NULL) {
+		CT_MALLOC_ERROR_CALLBACK();
+	}
+
+	ret_val->head = NULL;
+	ret_val->size = 0;
+	ret_val->tail = NULL;
+
+	return ret_val;
+}
+
+void ct_list_destroy(const ct_list_o* lst) {
+	CT_ITERATE_ON_LIST(lst, entry, value, void*) {
+		free(entry);
+	}
+	free((void*) lst);
+}
+
+void ct_list_destroy_with_elements(const ct_list_o* lst, ct_destroyer_c d) {
+	CT_ITERATE_ON_LIST(lst, entry, value, void*) {
+		d(entry->payload);
+		free(entry);
+	}
+	free((void*) lst);
+}
+
+void ct_list_clear(ct_list_o* l) {
+	CT_ITERATE_ON_LIST(l, entry, value, void*) {
+		free(entry);
+	}
+	l->head = NULL;
+	l->size = 0;
+	l->tail = NULL;
+}
+
+void ct_list_add_head(ct_list_o* l, const void* el) {
+	ct_list_entry_o* new_entry = malloc(sizeof(ct_list_entry_o));
+	if (new_entry == NULL) {
+		CT_MALLOC_ERROR_CALLBACK();
+	}
+
+	new_entry->payload = (void*)el;
+	new_entry->next = l->head;
+
+	l->size++;
+	l->head = new_entry;
+	if (l->tail == NULL) {
+		l->tail = new_entry;
+	}
+}
+
+void ct_list_add_tail(ct_list_o* l, const void* el) {
+	ct_list_entry_o* new_entry = malloc(sizeof(ct_list_entry_o));
+	if (new_entry == NULL) {
+		CT_MALLOC_ERROR_CALLBACK();
+	}
+
+	new_entry->payload = (void*)el;
+	new_entry->next = NULL;
+	if (l->tail != NULL) {
+		l->tail->next = new_entry;
+	}
+
+	l->size++;
+	if (l->head == NULL) {
+		l->head = new_entry;
+	}
+	l->tail = new_entry;
+
+}
+
+int ct_list_size(const ct_list_o* l) {
+	return l->size;
+}
+
+void ct_list_full_transfer(ct_list_o* restrict dst, ct_list_o* restrict src) {
+	//an empty source would leave dst without its tail
+	if (ct_list_is_empty(src)) {
+		return;
+	}
+
+	//*********** DST **********
+	dst->size += ct_list_size(src);
+	if (dst->head == NULL) {
+		dst->head = src->head;
+	} else {
+		dst->tail->next = src->head;
+	}
+	dst->tail = src->tail;
+
+	//************ SRC **************
+	src->size = 0;
+	src->head = NULL;
+	src->tail = NULL;
+}
+
+bool ct_list_is_empty(const ct_list_o* l) {
+	return l->size == 0;
+}
+
+void* ct_list_pop(ct_list_o* l) {
+	if (ct_list_is_empty(l)) {
+		return NULL;
+	}
+
+	ct_list_entry_o* cell = l->head;
+	void* ret_val = cell->payload;
+	l->head = l->head->next;
+	l->size--;
+	if (ct_list_is_empty(l)) {
+		l->tail = NULL;
+	}
+
+	free(cell);
+	return ret_val;
+}
+
+void* ct_list_pop_tail(ct_list_o* l) {
+	if (ct_list_is_empty(l)) {
+		return NULL;
+	}
+
+	ct_list_entry_o* cell = l->tail;
+	void* ret_val = cell->payload;
+	if (l->head == cell) {
+		l->head = NULL;
+		l->tail = NULL;
+	} else {
+		ct_list_entry_o* previous = l->head;
+		while (previous->next != cell) {
+			previous = previous->next;
+		}
+		previous->next = NULL;
+		l->tail = previous;
+	}
+	l->size--;
+
+	free(cell);
+	return ret_val;
+}
+
+void* ct_list_replace_tail(ct_list_o* l, const void* el) {
+	void* ret_val = l->tail->payload;
+	l->tail->payload = (void*) el;
+	return ret_val;
+}
+
+void* ct_list_head(const ct_list_o* l) {
+	if (ct_list_is_empty(l)) {
+		return NULL;
+	}
+	return l->head->payload;
+}
+
+void* ct_list_tail(const ct_list_o* l) {
+	if (ct_list_is_empty(l)) {
+		return NULL;
+	}
+	return l->tail->payload;
+}
+
+void* ct_list_get(const ct_list_o* l, int index) {
+	CT_ITERATE_ON_LIST(l, entry, payload, void*) {
+		if (index == 0) {
+			return payload;
+		}
+		index--;
+	}
+	return NULL;
+}
+
+void ct_list_remove_entry_dynamic(ct_list_o* l, ct_list_entry_o** previous_entry, ct_list_entry_o* entry_to_remove) {
+	ct_list_o* lst = l;
+	ct_list_entry_o* previous = *previous_entry;
+
+	if (previous == NULL) {
+		//we're removing the head
+		ct_list_pop(l);
+	} else if (entry_to_remove->next == NULL){
+		//we're removing the tail
+		previous->next = NULL;
+		lst->size--;
+		lst->tail = previous;
+		free(entry_to_remove);
+	} else {
+		//we're removing an element inside the list
+		previous->next = entry_to_remove->next;
+		lst->size--;
+		free(entry_to_remove);
+	}
+
+	*previous_entry = NULL;
+}
+/*
+ * main_model.c
+ *
+ *  Created on: Oct 11, 2017
+ *      Author: koldar
+ */
+
+
+
+
+struct ct_model* ct_model;
+/*
+ * model.c
+ *
+ *  Created on: Oct 11, 2017
+ *      Author: koldar
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+#include <unistd.h>
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+struct ct_model* ct_setup_default_model() {
+	struct ct_model* ret_val = malloc(sizeof(struct ct_model));
+
+	if (ret_val == NULL) {
+		CT_MALLOC_ERROR_CALLBACK();
+	}
+
+	ret_val->current_section = NULL;
+	ret_val->current_snapshot = NULL;
+	ret_val->ct_teardown = NULL;
+	ret_val->test_reports_list = ct_list_init();
+	ret_val->jump_source_testcase = NULL;
+	ret_val->suites_array_index = 0;
+	ret_val->run_only_if_tags = ct_ht_init();
+	ret_val->exclude_tags = ct_ht_init();
+	ret_val->_crashc_sigaction = (struct sigaction) { 0 };
+	ret_val->signal_stack = (stack_t) { 0 };
+	for (int i = 0; i < CT_HANDLED_SIGNALS_NUMBER; i++) {
+		ret_val->previous_sigactions[i] = (struct sigaction) { 0 };
+		ret_val->signal_handler_installed[i] = false;
+	}
+	ret_val->backtrace_buffer_size = 0;
+	ret_val->signaled_snapshot = NULL;
+	ret_val->main_thread = pthread_self();
+	ret_val->thread_assert_reports = NULL;
+	ret_val->thread_signal_detected = 0;
+	ret_val->thread_signal_code = 0;
+	ret_val->thread_signal_address = NULL;
+	ret_val->prepared_sites = NULL;
+	ret_val->root_site = (struct ct_section_site) CT_SECTION_SITE_INITIALIZER;
+	ct_section_site_prepare(&ret_val->root_site, "", &ret_val->prepared_sites);
+	ret_val->root_section = ct_section_init(CT_ROOT_SECTION, "root", ret_val->root_site.tags);
+	ret_val->statistics = ct_init_stats();
+	ret_val->report_producer_implementation = ct_init_default_report_producer();
+	ret_val->output_file = stdout;
+	ret_val->allocation_tracker = ct_init_allocation_tracker();
+	ret_val->measure_resources = false;
+	ret_val->hardware_counters = NULL;
+	ret_val->schedule_seeds = 0;
+	ret_val->schedule_replay_seed = -1;
+	ret_val->workers = 0;
+	ret_val->corpus_path = NULL;
+	ret_val->fuzzer_input = NULL;
+	ret_val->fuzz_corpus = NULL;
+	ret_val->fuzz_arena = NULL;
+	ret_val->repetitions = 1;
+	ret_val->repetition = 0;
+	ret_val->binary_report_path = NULL;
+	ret_val->event_dispatcher = ct_init_event_dispatcher();
+	ret_val->show_progress = false;
+	ret_val->history_path = NULL;
+	ret_val->progress = NULL;
+	ret_val->section_index = ct_ht_init();
+	ret_val->testcase_occurrences = ct_ht_init();
+	ret_val->keyed_testcase = NULL;
+	ret_val->testcase_key = (struct ct_testcase_key) { 0, -1 };
+	ret_val->selected_section_path = NULL;
+	ret_val->selected_path_prefixes = ct_ht_init();
+	ret_val->selected_path_level = 0;
+	ret_val->section_fork = NULL;
+	ret_val->output_capture = NULL;
+	ret_val->journal_path = NULL;
+	ret_val->resume = false;
+	ret_val->journal = NULL;
+	ret_val->coordinator_address = NULL;
+	ret_val->worker_address = NULL;
+	ret_val->distribution = NULL;
+	ret_val->coverage_index_path = NULL;
+	ret_val->collect_coverage = false;
+	ret_val->changed_files_path = NULL;
+	ret_val->coverage = NULL;
+	ret_val->benchmark_output = NULL;
+	ret_val->benchmark = NULL;
+	ret_val->benchmark_cpu = -1;
+	ret_val->benchmark_cold_cache = false;
+	ret_val->current_suite = 0;
+	ret_val->suite_order = CT_ORDER_DECLARATION;
+
+	return ret_val;
+}
+
+void ct_teardown_default_model(struct ct_model* ccm) {
+	ct_merge_thread_reports(ccm, NULL);
+	if (ccm->fuzz_corpus != NULL) {
+		ct_destroy_fuzz_corpus(ccm->fuzz_corpus);
+	}
+	free(ccm->fuzzer_input);
+	if (ccm->progress != NULL) {
+		ct_destroy_progress(ccm->progress);
+	}
+	ct_destroy_event_dispatcher(ccm->event_dispatcher);
+	if (ccm->selected_section_path != NULL && ct_find_section(ccm, ccm->selected_section_path) == NULL) {
+		fprintf(stderr, "CrashC - no section has path \"%s\"\n", ccm->selected_section_path);
+	}
+	ct_ht_destroy(ccm->section_index);
+	ct_ht_destroy_with_elements(ccm->testcase_occurrences, (ct_destroyer_c) free);
+	ct_ht_destroy(ccm->selected_path_prefixes);
+	ct_section_destroy(ccm->root_section);
+	ct_ht_destroy_with_elements(ccm->exclude_tags, (ct_destroyer_c)ct_tag_destroy);
+	ct_ht_destroy_with_elements(ccm->run_only_if_tags, (ct_destroyer_c)ct_tag_destroy);
+	ct_list_destroy_with_elements(ccm->test_reports_list, (ct_destroyer_c)ct_destroy_test_report);
+	if (ccm->fuzz_arena != NULL) {
+		ct_destroy_report_arena(ccm->fuzz_arena);
+	}
+	if (ccm->section_fork != NULL) {
+		ct_destroy_section_fork(ccm->section_fork);
+	}
+	if (ccm->output_capture != NULL) {
+		ct_destroy_output_capture(ccm->output_capture);
+	}
+	if (ccm->journal != NULL) {
+		ct_destroy_journal(ccm->journal);
+	}
+	if (ccm->distribution != NULL) {
+		ct_destroy_distribution(ccm->distribution);
+	}
+	if (ccm->coverage != NULL) {
+		ct_destroy_coverage(ccm->coverage);
+	}
+	if (ccm->benchmark != NULL) {
+		ct_destroy_benchmark(ccm->benchmark);
+	}
+	//the tags of the sections are used by the test reports as well
+	ct_section_sites_release(&ccm->prepared_sites);
+	ct_destroy_stats(ccm->statistics);
+	ct_destroy_default_report_producer(ccm->report_producer_implementation);
+	free(ccm->signal_stack.ss_sp);
+	if (ccm->hardware_counters != NULL) {
+		ct_destroy_hardware_counters_group(ccm->hardware_counters);
+	}
+	ct_destroy_allocation_tracker(ccm->allocation_tracker);
+	//the allocation wrappers may still look at the model while we release it
+	ccm->allocation_tracker = NULL;
+	//the standard output isn't ours: the test program, and the fuzzer after ct_fuzz_teardown, keep writing to it
+	if (ccm->output_file != stdout) {
+		fclose(ccm->output_file);
+	}
+	free(ccm);
+}
+
+int ct_get_workers_number(const struct ct_model* model) {
+	int ret_val = model->workers;
+
+	if (ret_val <= 0) {
+		ret_val = (int) sysconf(_SC_NPROCESSORS_ONLN);
+	}
+	return (ret_val > 0) ? ret_val : 1;
+}
+
+/**
+ * Computes the hash of a section path
+ *
+ * @param[in] path the path to scan
+ * @param[inout] prefixes if not @null, the hash of every prefix of \c path is added to it, with the level of the section as value
+ * @param[out] level if not @null, the number of sections in \c path
+ * @return the hash of \c path
+ */
+static unsigned long ct_hash_section_path(const char* path, ct_hashtable_o* prefixes, int* level) {
+	unsigned long hash = CT_ROOT_PATH_HASH;
+	int sections = 0;
+	const char* description = path;
+
+	while (true) {
+		const char* end = strchr(description, CT_SECTION_PATH_SEPARATOR);
+		size_t length = (end != NULL) ? (size_t) (end - description) : strlen(description);
+
+		hash = ct_section_path_hash(hash, description, length);
+		sections += 1;
+		if (prefixes != NULL) {
+			ct_ht_put_or_update(prefixes, hash, (void*) (intptr_t) sections);
+		}
+		if (end == NULL) {
+			break;
+		}
+		description = end + 1;
+	}
+
+	if (level != NULL) {
+		*level = sections;
+	}
+	return hash;
+}
+
+/**
+ * Checks whether a section of a section path has a given description
+ *
+ * @param[in] path the path to check
+ * @param[in] level the level of the section to check in \c path, starting from 1
+ * @param[in] description the description the section should have
+ * @return @true if the section at \c level in \c path exists and has \c description, @false otherwise
+ */
+static bool ct_is_path_component(const char* path, int level, const char* description) {
+	const char* component = path;
+
+	for (int i = 1; i < level && component != NULL; i++) {
+		component = strchr(component, CT_SECTION_PATH_SEPARATOR);
+		component = (component != NULL) ? component + 1 : NULL;
+	}
+	if (component == NULL) {
+		return false;
+	}
+
+	const char* end = strchr(component, CT_SECTION_PATH_SEPARATOR);
+	size_t length = (end != NULL) ? (size_t) (end - component) : strlen(component);
+	return strlen(description) == length && strncmp(description, component, length) == 0;
+}
+
+/**
+ * Checks whether the descriptions of a section and of its ancestors are the ones in a section path
+ *
+ * @param[in] section the section to check
+ * @param[in] path the path \c section should have
+ * @param[in] path_level the number of sections in \c path
+ * @return @true if \c path is the path of \c section, @false otherwise
+ */
+static bool ct_section_has_path(const struct ct_section* section, const char* path, int path_level) {
+	int level = ct_section_get_level(section);
+
+	if (level != path_level) {
+		return false;
+	}
+	for (const struct ct_section* ancestor = section; ancestor->parent != NULL; ancestor = ancestor->parent, level--) {
+		if (!ct_is_path_component(path, level, ancestor->description)) {
+			return false;
+		}
+	}
+	return true;
+}
+
+/**
+ * Looks for a section by following the descriptions in a section path, depth first
+ *
+ * @param[in] section the section whose children need to be looked into
+ * @param[in] path the path of the section to look for
+ * @param[in] level the level of the children of \c section
+ * @param[in] path_level the number of sections in \c path
+ * @return the first section created with such path, or @null if there is none
+ */
+static struct ct_section* ct_walk_section_path(struct ct_section* section, const char* path, int level, int path_level) {
+	for (struct ct_section* child = section->first_child; child != NULL; child = child->next_sibling) {
+		if (!ct_is_path_component(path, level, child->description)) {
+			continue;
+		}
+		if (level == path_level) {
+			return child;
+		}
+		struct ct_section* ret_val = ct_walk_section_path(child, path, level + 1, path_level);
+		if (ret_val != NULL) {
+			return ret_val;
+		}
+	}
+	return NULL;
+}
+
+void ct_select_section_path(struct ct_model* model, const char* path) {
+	model->selected_section_path = path;
+	ct_ht_clear(model->selected_path_prefixes);
+	ct_hash_section_path(path, model->selected_path_prefixes, &model->selected_path_level);
+	//from now on, only the children of the root on the path are entered
+	model->root_section->inside_target = false;
+}
+
+void ct_index_section(struct ct_model* model, struct ct_section* section) {
+	const struct ct_section* parent = section->parent;
+
+	section->path_hash = ct_section_path_hash(parent->path_hash, section->description, strlen(section->description));
+	if (!ct_ht_contains(model->section_index, section->path_hash)) {
+		ct_ht_put(model->section_index, section->path_hash, section);
+	}
+
+	if (parent->inside_target) {
+		section->on_target_path = true;
+		section->inside_target = true;
+	} else {
+		int level = (int) (intptr_t) ct_ht_get(model->selected_path_prefixes, section->path_hash);
+		//the level protects from sections with the same hash at a different depth, the description from the ones at the same depth
+		section->on_target_path = parent->on_target_path && level == ct_section_get_level(section)
+				&& ct_is_path_component(model->selected_section_path, level, section->description);
+		section->inside_target = section->on_target_path && level == model->selected_path_level;
+	}
+}
+
+const struct ct_testcase_key* ct_get_testcase_key(struct ct_model* model, const struct ct_section* testcase) {
+	if (testcase == model->keyed_testcase) {
+		return &model->testcase_key;
+	}
+
+	struct ct_testcase_key* occurrences = ct_ht_get(model->testcase_occurrences, testcase->path_hash);
+	if (occurrences == NULL) {
+		occurrences = malloc(sizeof(struct ct_testcase_key));
+		if (occurrences == NULL) {
+			CT_MALLOC_ERROR_CALLBACK();
+		}
+		*occurrences = (struct ct_testcase_key) { testcase->path_hash, 0 };
+		ct_ht_put(model->testcase_occurrences, testcase->path_hash, occurrences);
+	}
+	model->keyed_testcase = testcase;
+	model->testcase_key = *occurrences;
+	occurrences->occurrence += 1;
+	return &model->testcase_key;
+}
+
+struct ct_section* ct_find_section(const struct ct_model* model, const char* path) {
+	int path_level;
+	struct ct_section* ret_val = ct_ht_get(model->section_index, ct_hash_section_path(path, NULL, &path_level));
+
+	if (ret_val == NULL || ct_section_has_path(ret_val, path, path_level)) {
+		return ret_val;
+	}
+	//a section with another path but the same hash has been indexed first
+	return ct_walk_section_path(model->root_section, path, 1, path_level);
+}
+
+void ct_reset_tests(struct ct_model* model) {
+	ct_list_destroy_with_elements(model->test_reports_list, (ct_destroyer_c) ct_destroy_test_report);
+	model->test_reports_list = ct_list_init();
+
+	bool inside_target = model->root_section->inside_target;
+	ct_ht_clear(model->section_index);
+	ct_ht_clear_and_destroy_elements(model->testcase_occurrences, (ct_destroyer_c) free);
+	//the root is never released by ct_section_destroy
+	if (model->root_section->first_child != NULL) {
+		ct_section_destroy(model->root_section->first_child);
+	}
+	free((void*) model->root_section->description);
+	free(model->root_section);
+	model->root_section = ct_section_init(CT_ROOT_SECTION, "root", model->root_site.tags);
+	model->root_section->inside_target = inside_target;
+	model->current_section = NULL;
+	model->current_snapshot = NULL;
+	model->jump_source_testcase = NULL;
+	model->keyed_testcase = NULL;
+}
+/*
+ * output_capture.c
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: koldar
+ */
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <unistd.h>
+#include <sys/syscall.h>
+#include <sys/types.h>
+#include <linux/memfd.h>
+#include <linux/falloc.h>
+
+
+
+
+
+struct ct_output_capture* ct_init_output_capture() {
+	struct ct_output_capture* ret_val = malloc(sizeof(struct ct_output_capture));
+	if (ret_val == NULL) {
+		CT_MALLOC_ERROR_CALLBACK();
+	}
+
+	//the wrapper of the C library is declared only with _GNU_SOURCE, which the single-header version can't define early enough
+	ret_val->file = (int) syscall(SYS_memfd_create, "crashc-output", MFD_CLOEXEC);
+	ret_val->saved_stdout = dup(STDOUT_FILENO);
+	ret_val->saved_stderr = dup(STDERR_FILENO);
+	if (ret_val->file < 0 || ret_val->saved_stdout < 0 || ret_val->saved_stderr < 0) {
+		perror("CrashC - cannot capture the output of the tests");
+		exit(EXIT_FAILURE);
+	}
+	ret_val->original_stderr = NULL;
+	ret_val->released_bytes = 0;
+	ret_val->active = false;
+
+	return ret_val;
+}
+
+void ct_output_capture_start(struct ct_output_capture* capture) {
+	//what has been buffered so far doesn't belong to the test
+	fflush(stdout);
+	fflush(stderr);
+
+	if (ftruncate(capture->file, 0) != 0 || lseek(capture->file, 0, SEEK_SET) < 0) {
+		return;
+	}
+	capture->released_bytes = 0;
+	dup2(capture->file, STDOUT_FILENO);
+	dup2(capture->file, STDERR_FILENO);
+	capture->active = true;
+}
+
+/**
+ * Reads the tail of what the test has written
+ *
+ * @param[in] capture the capture just stopped
+ * @return the last ::CT_CAPTURED_OUTPUT_SIZE bytes written, as a string. @null if the test hasn't written anything
+ */
+static char* ct_read_captured_output(const struct ct_output_capture* capture) {
+	off_t size = lseek(capture->file, 0, SEEK_END);
+	if (size <= 0) {
+		return NULL;
+	}
+
+	off_t start = (size > CT_CAPTURED_OUTPUT_SIZE) ? size - CT_CAPTURED_OUTPUT_SIZE : 0;
+	size_t length = size - start;
+	char* ret_val = malloc(length + 1);
+	if (ret_val == NULL) {
+		CT_MALLOC_ERROR_CALLBACK();
+	}
+
+	ssize_t bytes = pread(capture->file, ret_val, length, start);
+	ret_val[(bytes > 0) ? bytes : 0] = '\0';
+	return ret_val;
+}
+
+void ct_output_capture_stop(struct ct_output_capture* capture, struct ct_test_report* report) {
+	if (!capture->active) {
+		return;
+	}
+
+	fflush(stdout);
+	fflush(stderr);
+	dup2(capture->saved_stdout, STDOUT_FILENO);
+	dup2(capture->saved_stderr, STDERR_FILENO);
+	capture->active = false;
+
+	if (report->outcome != CT_TEST_SUCCESS) {
+		free(report->output);
+		report->output = ct_read_captured_output(capture);
+	}
+}
+
+long ct_output_capture_mark(const struct ct_output_capture* capture) {
+	if (!capture->active) {
+		return -1;
+	}
+	return (long) lseek(capture->file, 0, SEEK_END);
+}
+
+void ct_output_capture_rewind(struct ct_output_capture* capture, long mark) {
+	if (!capture->active || mark < 0) {
+		return;
+	}
+	if (ftruncate(capture->file, mark) == 0) {
+		lseek(capture->file, mark, SEEK_SET);
+		if (capture->released_bytes > mark) {
+			capture->released_bytes = mark;
+		}
+	}
+}
+
+void ct_output_capture_trim(struct ct_output_capture* capture) {
+	if (!capture->active) {
+		return;
+	}
+	off_t size = lseek(capture->file, 0, SEEK_END);
+	if (size - capture->released_bytes <= CT_CAPTURED_OUTPUT_LIMIT) {
+		return;
+	}
+
+	//punching a hole frees the memory without moving the offset, which the descriptors 1 and 2 (and forked processes) share
+	off_t end = size - CT_CAPTURED_OUTPUT_SIZE;
+	if (syscall(SYS_fallocate, capture->file, FALLOC_FL_PUNCH_HOLE | FALLOC_FL_KEEP_SIZE, (off_t) capture->released_bytes, end - capture->released_bytes) == 0) {
+		capture->released_bytes = end;
+	}
+}
+
+FILE* ct_output_capture_get_original_stderr(struct ct_output_capture* capture) {
+	if (capture->original_stderr == NULL) {
+		int fd = dup(capture->saved_stderr);
+		capture->original_stderr = (fd >= 0) ? fdopen(fd, "w") : NULL;
+		if (capture->original_stderr == NULL && fd >= 0) {
+			close(fd);
+		}
+	}
+	return capture->original_stderr;
+}
+
+void ct_destroy_output_capture(struct ct_output_capture* capture) {
+	if (capture->original_stderr != NULL) {
+		fclose(capture->original_stderr);
+	}
+	close(capture->file);
+	close(capture->saved_stdout);
+	close(capture->saved_stderr);
+	free(capture);
+}
+/*
+ * progress.c
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: koldar
+ */
+
+#include <stdlib.h>
+#include <string.h>
+
+
+
+
+
+
+
+
+
+
+static struct ct_test_timing* ct_init_test_timing(const char* description, long time) {
+	struct ct_test_timing* ret_val = malloc(sizeof(struct ct_test_timing));
+	if (ret_val == NULL) {
+		CT_MALLOC_ERROR_CALLBACK();
+	}
+
+	ret_val->description = strdup(description);
+	if (ret_val->description == NULL) {
+		CT_MALLOC_ERROR_CALLBACK();
+	}
+	ret_val->total_time = time;
+	ret_val->tests = 1;
+	ret_val->ended_tests = 0;
+
+	return ret_val;
+}
+
+static void ct_destroy_test_timing(struct ct_test_timing* timing) {
+	free(timing->description);
+	free(timing);
+}
+
+static struct ct_suite_timing* ct_init_suite_timing(const char* name, long time, int tests, int failed_tests) {
+	struct ct_suite_timing* ret_val = malloc(sizeof(struct ct_suite_timing));
+	if (ret_val == NULL) {
+		CT_MALLOC_ERROR_CALLBACK();
+	}
+
+	ret_val->name = strdup(name);
+	if (ret_val->name == NULL) {
+		CT_MALLOC_ERROR_CALLBACK();
+	}
+	ret_val->total_time = time;
+	ret_val->tests = tests;
+	ret_val->failed_tests = failed_tests;
+
+	return ret_val;
+}
+
+static void ct_destroy_suite_timing(struct ct_suite_timing* timing) {
+	free(timing->name);
+	free(timing);
+}
+
+/**
+ * Reads a line of the history file describing a @testsuite
+ *
+ * @param[inout] progress the state of the listener. The @testsuite is added to its suite history
+ * @param[in] line the line, without the newline
+ */
+static void ct_load_suite_history(struct ct_progress* progress, const char* line) {
+	long time;
+	int tests;
+	int failed_tests;
+	int name = 0;
+
+	if (sscanf(line, "S %ld %d %d %n", &time, &tests, &failed_tests, &name) != 3 || name == 0) {
+		return;
+	}
+	unsigned long key = (unsigned long) ct_string_hash(&line[name]);
+	if (ct_ht_get(progress->suite_history, key) == NULL) {
+		ct_ht_put(progress->suite_history, key, ct_init_suite_timing(&line[name], time, tests, failed_tests));
+	}
+}
+
+/**
+ * Reads the history file, if any
+ *
+ * @param[inout] progress the state of the listener. Its history is filled with the timings of the previous run
+ */
+static void ct_load_history(struct ct_progress* progress) {
+	if (progress->history_path == NULL) {
+		return;
+	}
+	FILE* file = fopen(progress->history_path, "r");
+	if (file == NULL) {
+		return;
+	}
+
+	char* line = NULL;
+	size_t line_size = 0;
+	ssize_t length;
+	while ((length = getline(&line, &line_size, file)) > 0) {
+		if (line[length - 1] == '\n') {
+			line[length - 1] = '\0';
+		}
+		if (line[0] == 'S') {
+			ct_load_suite_history(progress, line);
+			continue;
+		}
+
+		char* description;
+		long time = strtol(line, &description, 10);
+		if (description == line || *description != ' ') {
+			continue;
+		}
+		description += 1;
+
+		unsigned long key = (unsigned long) ct_string_hash(description);
+		struct ct_test_timing* timing = ct_ht_get(progress->history, key);
+		if (timing == NULL) {
+			ct_ht_put(progress->history, key, ct_init_test_timing(description, time));
+		} else if (strcmp(timing->description, description) == 0) {
+			timing->total_time += time;
+			timing->tests += 1;
+		} else {
+			//hash collision: the test will be treated as a new one
+			continue;
+		}
+		progress->expected_tests += 1;
+		progress->expected_time += time;
+	}
+
+	free(line);
+	fclose(file);
+}
+
+/**
+ * Writes the timings of the current run into the history file, if any
+ *
+ * @param[in] progress the state of the listener
+ */
+static void ct_save_history(const struct ct_progress* progress) {
+	if (progress->history_path == NULL) {
+		return;
+	}
+	FILE* file = fopen(progress->history_path, "w");
+	if (file == NULL) {
+		fprintf(stderr, "CrashC - cannot write the history file \"%s\"\n", progress->history_path);
+		return;
+	}
+
+	CT_ITERATE_ON_LIST(progress->timings, timing_cell, timing, struct ct_test_timing*) {
+		fprintf(file, "%ld %s\n", timing->total_time, timing->description);
+	}
+	CT_ITERATE_ON_LIST(progress->suite_timings, suite_cell, suite, struct ct_suite_timing*) {
+		fprintf(file, "S %ld %d %d %s\n", suite->total_time, suite->tests, suite->failed_tests, suite->name);
+	}
+	fclose(file);
+}
+
+long ct_progress_estimate_remaining_time(const struct ct_progress* progress, long elapsed_time) {
+	if (progress->expected_time <= 0) {
+		return -1;
+	}
+
+	long remaining_time = progress->expected_time - progress->expected_ended_time;
+	if (remaining_time < 0) {
+		return 0;
+	}
+	if (progress->expected_ended_time > 0) {
+		//the current run may be faster or slower than the previous one
+		return (long) (remaining_time * ((double) elapsed_time / progress->expected_ended_time));
+	}
+	return remaining_time;
+}
+
+/**
+ * Draws the progress line
+ *
+ * @param[inout] progress the state of the listener
+ * @param[in] force @true to draw the line even if it has been drawn less than ::CT_PROGRESS_REFRESH_PERIOD microseconds ago
+ */
+static void ct_draw_progress(struct ct_progress* progress, bool force) {
+	if (progress->output == NULL) {
+		return;
+	}
+
+	struct timespec now = ct_get_time();
+	if (!force && ct_compute_time_gap(progress->last_draw, now, "u") < CT_PROGRESS_REFRESH_PERIOD) {
+		return;
+	}
+	progress->last_draw = now;
+
+	long elapsed_time = ct_compute_time_gap(progress->start_time, now, "u");
+	long remaining_time = ct_progress_estimate_remaining_time(progress, elapsed_time);
+
+	//\r and "erase line" keep the progress on a single line of the terminal
+	fprintf(progress->output, "\r\033[K[%d", progress->ended_tests);
+	if (progress->expected_tests > 0) {
+		fprintf(progress->output, "/%d", progress->expected_tests);
+	}
+	fprintf(progress->output, "] %d failed | %02ld:%02ld", progress->failed_tests, elapsed_time / 60000000, (elapsed_time / 1000000) % 60);
+	if (remaining_time >= 0) {
+		fprintf(progress->output, " ETA %02ld:%02ld", remaining_time / 60000000, (remaining_time / 1000000) % 60);
+	} else {
+		fprintf(progress->output, " ETA --:--");
+	}
+	if (progress->suite_name != NULL) {
+		fprintf(progress->output, " | suite %s", progress->suite_name);
+	}
+	if (progress->testcase_description != NULL) {
+		fprintf(progress->output, " | %.40s", progress->testcase_description);
+	}
+	fflush(progress->output);
+}
+
+/**
+ * Fetches the timings of a @testsuite in the current run
+ *
+ * @param[inout] progress the state of the listener
+ * @param[in] suite_name the id of the @testsuite
+ * @return the timings of the @testsuite, created if the @testsuite has not been met yet
+ */
+static struct ct_suite_timing* ct_get_running_suite(struct ct_progress* progress, const char* suite_name) {
+	//with several repetitions the same testsuite starts several times
+	CT_ITERATE_ON_LIST(progress->suite_timings, suite_cell, suite, struct ct_suite_timing*) {
+		if (strcmp(suite->name, suite_name) == 0) {
+			return suite;
+		}
+	}
+	struct ct_suite_timing* ret_val = ct_init_suite_timing(suite_name, 0, 0, 0);
+	ct_list_add_tail(progress->suite_timings, ret_val);
+	return ret_val;
+}
+
+static void ct_progress_on_suite_start(struct ct_model* model, void* data, const char* suite_name) {
+	struct ct_progress* progress = data;
+
+	progress->suite_name = suite_name;
+	progress->running_suite = ct_get_running_suite(progress, suite_name);
+	ct_draw_progress(progress, false);
+}
+
+static void ct_progress_on_section_enter(struct ct_model* model, void* data, struct ct_section* section) {
+	struct ct_progress* progress = data;
+
+	if (section->type == CT_TESTCASE_SECTION) {
+		progress->testcase_description = section->description;
+		ct_draw_progress(progress, false);
+	}
+}
+
+static void ct_progress_on_test_end(struct ct_model* model, void* data, struct ct_test_report* report) {
+	struct ct_progress* progress = data;
+	struct timespec now = ct_get_time();
+	const char* description = report->testcase_snapshot->description;
+
+	progress->ended_tests += 1;
+	if (report->outcome != CT_TEST_SUCCESS) {
+		progress->failed_tests += 1;
+	}
+
+	struct ct_test_timing* timing = ct_ht_get(progress->history, (unsigned long) ct_string_hash(description));
+	if (timing != NULL && timing->ended_tests < timing->tests && strcmp(timing->description, description) == 0) {
+		progress->expected_ended_time += timing->total_time / timing->tests;
+		timing->ended_tests += 1;
+	}
+
+	long time = ct_compute_time_gap(progress->last_test_end, now, "u");
+	if (model->distribution != NULL) {
+		//the coordinator receives the tests in batches, long after they have ended: only the workers know how long they lasted
+		time = report->execution_time;
+		progress->running_suite = ct_get_running_suite(progress, model->suites_names[report->suite]);
+	}
+	ct_list_add_tail(progress->timings, ct_init_test_timing(description, time));
+	progress->last_test_end = now;
+	if (progress->running_suite != NULL) {
+		progress->running_suite->total_time += time;
+		progress->running_suite->tests += 1;
+		if (report->outcome != CT_TEST_SUCCESS) {
+			progress->running_suite->failed_tests += 1;
+		}
+	}
+
+	ct_draw_progress(progress, false);
+}
+
+static void ct_progress_on_run_end(struct ct_model* model, void* data) {
+	struct ct_progress* progress = data;
+
+	progress->testcase_description = NULL;
+	progress->suite_name = NULL;
+	ct_draw_progress(progress, true);
+	if (progress->output != NULL) {
+		fputc('\n', progress->output);
+	}
+	ct_save_history(progress);
+}
+
+struct ct_progress* ct_enable_progress(struct ct_model* model, FILE* output, const char* history_path) {
+	struct ct_progress* ret_val = malloc(sizeof(struct ct_progress));
+	if (ret_val == NULL) {
+		CT_MALLOC_ERROR_CALLBACK();
+	}
+
+	ret_val->output = output;
+	ret_val->history_path = history_path;
+	ret_val->history = ct_ht_init();
+	ret_val->expected_tests = 0;
+	ret_val->expected_time = 0;
+	ret_val->expected_ended_time = 0;
+	ret_val->ended_tests = 0;
+	ret_val->failed_tests = 0;
+	ret_val->timings = ct_list_init();
+	ret_val->suite_history = ct_ht_init();
+	ret_val->suite_timings = ct_list_init();
+	ret_val->running_suite = NULL;
+	ret_val->suite_name = NULL;
+	ret_val->testcase_description = NULL;
+	ret_val->start_time = ct_get_time();
+	ret_val->last_test_end = ret_val->start_time;
+	ret_val->last_draw = (struct timespec) { 0 };
+
+	ct_load_history(ret_val);
+
+	struct ct_event_listener listener = {
+		.on_suite_start = ct_progress_on_suite_start,
+		.on_section_enter = ct_progress_on_section_enter,
+		.on_assert_fail = NULL,
+		.on_test_end = ct_progress_on_test_end,
+		.on_run_end = ct_progress_on_run_end,
+		.data = ret_val
+	};
+	ct_subscribe_listener(model, &listener);
+	model->progress = ret_val;
+
+	return ret_val;
+}
+
+const struct ct_suite_timing* ct_progress_get_suite_history(const struct ct_progress* progress, const char* suite_name) {
+	const struct ct_suite_timing* ret_val = ct_ht_get(progress->suite_history, (unsigned long) ct_string_hash(suite_name));
+	if (ret_val == NULL || strcmp(ret_val->name, suite_name) != 0) {
+		return NULL;
+	}
+	return ret_val;
+}
+
+void ct_destroy_progress(struct ct_progress* progress) {
+	ct_ht_destroy_with_elements(progress->history, (ct_destroyer_c) ct_destroy_test_timing);
+	ct_list_destroy_with_elements(progress->timings, (ct_destroyer_c) ct_destroy_test_timing);
+	ct_ht_destroy_with_elements(progress->suite_history, (ct_destroyer_c) ct_destroy_suite_timing);
+	ct_list_destroy_with_elements(progress->suite_timings, (ct_destroyer_c) ct_destroy_suite_timing);
+	free(progress);
+}
+/*
+ * report_producer.c
+ *
+ *  Created on: Oct 27, 2017
+ *      Author: Lorenzo Nodari <lorenzo.nodari.it@ieee.org>
+ */
+
+#include <stdlib.h>
+#include <string.h>
+#include <execinfo.h>
+
+
+
+
+
+char* ct_snapshot_status_to_string(enum ct_snapshot_status s) {
+
+	switch (s) {
+		case CT_SNAPSHOT_OK: return "OK";
+		case CT_SNAPSHOT_SIGNALED: return "SIGNALED";
+		case CT_SNAPSHOT_FAILED: return "FAILED";
+		case CT_SNAPSHOT_LEAKED: return "LEAKED";
+		case CT_SNAPSHOT_OVER_ALLOCATED: return "OVER_ALLOCATED";
+		default: 	printf("\nERROR: Unrecognized snapshot status, exiting.\n");
+					exit(1); //TODO: Fix error exit
+	}
+
+}
+
+char* ct_section_type_to_string(enum ct_section_type t) {
+
+	switch (t) {
+		case CT_WHEN_SECTION: return "WHEN";
+		case CT_THEN_SECTION: return "THEN";
+		case CT_STRESS_SECTION: return "STRESS";
+		case CT_BENCHMARK_SECTION: return "BENCHMARK";
+		case CT_TESTCASE_SECTION: return "TESTCASE";
+		case CT_ROOT_SECTION: return "ROOT";
+		case CT_TESTSUITE_SECTION: return "SUITE";
+		default: 	printf("\nERROR: Unrecognized section type, exiting.\n");
+					exit(1); //TODO: Fix error exit
+	}
+
+}
+
+
+//TODO: Check for errors due to FILE null pointer etc...
+void ct_default_snapshot_tree_report(struct ct_model* model, struct ct_snapshot* snapshot, int level) {
+
+	FILE* file = model->output_file;
+
+	char* type_str = ct_section_type_to_string(snapshot->type);
+	char* status_str = ct_snapshot_status_to_string(snapshot->status);
+	if (snapshot->signal_detected != 0) {
+		fprintf(file, "%s : %s -> %s (%s, code %d, address %p)\n", type_str, snapshot->description, status_str, strsignal(snapshot->signal_detected), snapshot->signal_code, snapshot->signal_address);
+	}
+	else {
+		fprintf(file, "%s : %s -> %s\n", type_str, snapshot->description, status_str);
+	}
+	if (snapshot->allocations > 0 || snapshot->frees > 0 || snapshot->leaked_blocks > 0) {
+		for (int i = 0; i < level; i++) {
+			fputc('\t', file);
+		}
+		fprintf(file, "Allocations: %lu (%zu bytes), frees: %lu", snapshot->allocations, snapshot->allocated_bytes, snapshot->frees);
+		if (snapshot->leaked_blocks > 0) {
+			fprintf(file, ", leaked: %lu blocks (%zu bytes)", snapshot->leaked_blocks, snapshot->leaked_bytes);
+		}
+		fputc('\n', file);
+	}
+	struct ct_report_producer* producer = model->report_producer_implementation;
+	if (producer->performance_reporter != NULL) {
+		producer->performance_reporter(model, snapshot, level);
+	}
+	if (producer->resource_usage_reporter != NULL) {
+		producer->resource_usage_reporter(model, snapshot, level);
+	}
+	if (producer->stress_reporter != NULL) {
+		producer->stress_reporter(model, snapshot, level);
+	}
+	if (producer->benchmark_reporter != NULL) {
+		producer->benchmark_reporter(model, snapshot, level);
+	}
+	if (producer->backtrace_reporter != NULL) {
+		producer->backtrace_reporter(model, snapshot, level);
+	}
+	ct_default_assertions_report(model, snapshot, level);
+
+	struct ct_snapshot* child = snapshot->first_child;
+	while (child != NULL) {
+		for (int i = 0; i < level; i++) {
+			fputc('\t', file);
+		}
+		ct_default_snapshot_tree_report(model, child, level + 1);
+		child = child->next_sibling;
+	}
+
+}
+
+void ct_default_test_report(struct ct_model* model, struct ct_test_report* report) {
+
+	FILE* file = model->output_file;
+
+	fprintf(file, " ---------- TEST REPORT ----------\n\n");
+	//fprintf(file, "File: %s\n\n", report->filename);
+	if (report->fuzz_input != NULL) {
+		fprintf(file, "Input: %s\n\n", report->fuzz_input);
+	}
+	if (model->report_producer_implementation->flakiness_reporter != NULL) {
+		model->report_producer_implementation->flakiness_reporter(model, report);
+	}
+	ct_default_snapshot_tree_report(model, report->testcase_snapshot, 1);
+	fprintf(file, "\nOutcome: %s\n", (report->outcome == CT_TEST_SUCCESS) ? "SUCCESS" : "FAILURE");
+	if (report->output != NULL) {
+		size_t length = strlen(report->output);
+		fprintf(file, "\nCaptured output:\n%s%s", report->output, (length > 0 && report->output[length - 1] != '\n') ? "\n" : "");
+	}
+	fprintf(file, "\n --------------------------------\n");
+	fprintf(file, "\n\n");
+
+}
+
+void ct_default_report_summary(struct ct_model* model) {
+
+	FILE* file = model->output_file;
+	struct ct_test_stats * stats = model->statistics;
+
+	fprintf(file, "Total tests: %d\n", stats->total_tests);
+	fprintf(file, "Successful tests: %d\n", stats->successful_tests);
+	fprintf(file, "Failed tests: %d\n", stats->failed_tests);
+	fprintf(file, "Percentage of successful tests: %.2f%%\n", ((double) stats->successful_tests / stats->total_tests) * 100);
+	if (model->repetitions > 1) {
+		fprintf(file, "Flaky tests over %d repetitions: %d\n", model->repetitions, stats->flaky_tests);
+	}
+
+}
+
+void ct_default_assertions_report(struct ct_model* model, struct ct_snapshot* snapshot, int level) {
+
+	FILE* file = model->output_file;
+	ct_list_o* assertion_reports = snapshot->assertion_reports;
+
+	CT_ITERATE_ON_LIST(assertion_reports, report_cell, report, struct ct_assert_report*) {
+		for (int i = 0; i < level; i++) {
+			fputc('\t', file);
+		}
+
+		if (report->passed) {
+			fprintf(file, "Assertion \"%s\" - OK\n", report->asserted);
+		}
+		else {
+			fprintf(file, "Assertion \"%s\" - FAILED - Expected: %s, Actual: %s\n", report->asserted, report->expected_str, report->actual_str);
+		}
+	}
+
+}
+
+void ct_default_backtrace_report(struct ct_model* model, struct ct_snapshot* snapshot, int level) {
+
+	FILE* file = model->output_file;
+
+	if (snapshot->backtrace == NULL) {
+		return;
+	}
+
+	char** symbols = backtrace_symbols(snapshot->backtrace, snapshot->backtrace_size);
+	for (int i = 0; i < snapshot->backtrace_size; i++) {
+		for (int j = 0; j < level; j++) {
+			fputc('\t', file);
+		}
+
+		if (symbols != NULL) {
+			fprintf(file, "#%d %s\n", i, symbols[i]);
+		}
+		else {
+			fprintf(file, "#%d %p\n", i, snapshot->backtrace[i]);
+		}
+	}
+	free(symbols);
+
+}
+
+void ct_default_resource_usage_report(struct ct_model* model, struct ct_snapshot* snapshot, int level) {
+
+	FILE* file = model->output_file;
+	struct ct_resource_usage* usage = &snapshot->resource_usage;
+
+	if (!model->measure_resources || !snapshot->measurements_taken) {
+		return;
+	}
+
+	for (int i = 0; i < level; i++) {
+		fputc('\t', file);
+	}
+	fprintf(file, "Resources: max RSS %ld KB (+%ld KB), page faults %ld minor / %ld major, context switches %ld voluntary / %ld involuntary, CPU %.3f ms user / %.3f ms system\n",
+			usage->max_rss, usage->max_rss_growth,
+			usage->minor_faults, usage->major_faults,
+			usage->voluntary_context_switches, usage->involuntary_context_switches,
+			usage->user_time / 1000.0, usage->system_time / 1000.0
+	);
+
+}
+
+void ct_default_performance_report(struct ct_model* model, struct ct_snapshot* snapshot, int level) {
+
+	FILE* file = model->output_file;
+	struct ct_hardware_counters* counters = &snapshot->hardware_counters;
+
+	if (model->hardware_counters == NULL || !snapshot->measurements_taken) {
+		return;
+	}
+
+	for (int i = 0; i < level; i++) {
+		fputc('\t', file);
+	}
+	fprintf(file, "Time: %ld us", snapshot->elapsed_time);
+	if (counters->instructions != CT_HARDWARE_COUNTER_UNAVAILABLE) {
+		fprintf(file, ", instructions %lld", counters->instructions);
+	}
+	if (counters->cycles != CT_HARDWARE_COUNTER_UNAVAILABLE) {
+		fprintf(file, ", cycles %lld", counters->cycles);
+	}
+	if (counters->instructions != CT_HARDWARE_COUNTER_UNAVAILABLE && counters->cycles > 0) {
+		fprintf(file, " (IPC %.2f)", ((double) counters->instructions) / counters->cycles);
+	}
+	if (counters->cache_misses != CT_HARDWARE_COUNTER_UNAVAILABLE) {
+		fprintf(file, ", cache misses %lld", counters->cache_misses);
+	}
+	if (counters->branch_misses != CT_HARDWARE_COUNTER_UNAVAILABLE) {
+		fprintf(file, ", branch misses %lld", counters->branch_misses);
+	}
+	fputc('\n', file);
+
+}
+
+void ct_default_stress_report(struct ct_model* model, struct ct_snapshot* snapshot, int level) {
+
+	FILE* file = model->output_file;
+	struct ct_stress_report* stress = snapshot->stress;
+
+	if (stress == NULL) {
+		return;
+	}
+
+	for (int i = 0; i < level; i++) {
+		fputc('\t', file);
+	}
+	fprintf(file, "Stress: %d threads x %ld iterations, latency p50 %ld ns, p99 %ld ns, p99.9 %ld ns, max %ld ns\n",
+			stress->threads_number, stress->iterations,
+			stress->latency_p50, stress->latency_p99, stress->latency_p999, stress->max_latency
+	);
+	if (stress->schedule_seed >= 0) {
+		for (int i = 0; i < level + 1; i++) {
+			fputc('\t', file);
+		}
+		if (stress->explored_schedules > 0) {
+			fprintf(file, "Schedules: %ld explored, %ld failed, ", stress->explored_schedules, stress->failed_schedules);
+		} else {
+			fprintf(file, "Schedules: ");
+		}
+		fprintf(file, "replay with --schedule_seed %ld\n", stress->schedule_seed);
+	}
+	for (int t = 0; t < stress->threads_number; t++) {
+		for (int i = 0; i < level + 1; i++) {
+			fputc('\t', file);
+		}
+		fprintf(file, "Thread %d: %ld iterations, %.0f iterations/s, max latency %ld ns\n",
+				t, stress->threads[t].completed_iterations, stress->threads[t].throughput, stress->threads[t].max_latency
+		);
+	}
+
+}
+
+void ct_default_benchmark_report(struct ct_model* model, struct ct_snapshot* snapshot, int level) {
+
+	FILE* file = model->output_file;
+	struct ct_benchmark_report* benchmark = snapshot->benchmark;
+
+	if (benchmark == NULL) {
+		return;
+	}
+
+	for (int i = 0; i < level; i++) {
+		fputc('\t', file);
+	}
+	fprintf(file, "Benchmark: %s from %ld to %ld, best fit %s with coefficient %.3g ns (error %.1f%%), %s cache, warm-up %ld us",
+			benchmark->parameter_name, benchmark->points[0].parameter, benchmark->points[benchmark->points_number - 1].parameter,
+			ct_complexity_to_string(benchmark->complexity), benchmark->coefficient, benchmark->error * 100,
+			benchmark->cold_cache ? "cold" : "warm", benchmark->warmup_time / 1000
+	);
+	if (benchmark->cpu >= 0) {
+		fprintf(file, ", pinned to CPU %d", benchmark->cpu);
+	}
+	fputc('\n', file);
+	for (int p = 0; p < benchmark->points_number; p++) {
+		for (int i = 0; i < level + 1; i++) {
+			fputc('\t', file);
+		}
+		fprintf(file, "%s = %ld: %.1f ns, %.0f%% confidence interval [%.1f, %.1f] ns (%ld iterations per sample, %d outlier samples)",
+				benchmark->parameter_name, benchmark->points[p].parameter, benchmark->points[p].time,
+				CT_BENCHMARK_CONFIDENCE * 100, benchmark->points[p].time_low, benchmark->points[p].time_high,
+				benchmark->points[p].iterations, benchmark->points[p].outliers
+		);
+		if (benchmark->allocations_counted) {
+			fprintf(file, ", %.2f allocations (%.1f bytes) and %.2f frees per run",
+					benchmark->points[p].allocations, benchmark->points[p].allocated_bytes, benchmark->points[p].frees
+			);
+		}
+		fputc('\n', file);
+	}
+
+}
+
+void ct_default_flakiness_report(struct ct_model* model, struct ct_test_report* report) {
+
+	FILE* file = model->output_file;
+	struct ct_flakiness* flakiness = report->flakiness;
+
+	if (model->repetitions <= 1) {
+		return;
+	}
+
+	fprintf(file, "Repetition: %d", report->repetition + 1);
+	if (flakiness != NULL) {
+		fprintf(file, " - %s: failed %d times out of %d runs%s, time mean %.0f us, variance %.0f us^2",
+				flakiness->flaky ? "FLAKY" : "STABLE",
+				flakiness->failed_runs, flakiness->runs,
+				flakiness->snapshots_diverge ? ", snapshots diverge" : "",
+				flakiness->elapsed_time_mean, flakiness->elapsed_time_variance
+		);
+	}
+	fprintf(file, "\n\n");
+
+}
+
+void ct_default_report(struct ct_model* model) {
+
+	ct_list_o* report_list = model->test_reports_list;
+
+	ct_update_test_stats(model);
+	CT_ITERATE_ON_LIST(report_list, report_cell, report, struct ct_test_report*) {
+		ct_default_test_report(model, report);
+	}
+
+	ct_default_report_summary(model);
+
+}
+
+void ct_update_test_stats(struct ct_model* model) {
+
+	ct_list_o* report_list = model->test_reports_list;
+
+	model->statistics->successful_tests = 0;
+	model->statistics->failed_tests = 0;
+	CT_ITERATE_ON_LIST(report_list, report_cell, report, struct ct_test_report*) {
+		if (report->outcome == CT_TEST_SUCCESS) {
+			model->statistics->successful_tests++;
+		}
+		else {
+			model->statistics->failed_tests++;
+		}
+	}
+
+	model->statistics->total_tests = ct_list_size(report_list);
+
+}
+
+struct ct_test_stats* ct_init_stats() {
+
+	struct ct_test_stats* ret_val = malloc(sizeof(struct ct_test_stats));
+
+	if (ret_val == NULL) {
+		CT_MALLOC_ERROR_CALLBACK();
+	}
+
+	ret_val->total_tests = 0;
+	ret_val->successful_tests = 0;
+	ret_val->failed_tests = 0;
+	ret_val->flaky_tests = 0;
+
+	return ret_val;
+}
+
+struct ct_report_producer* ct_init_default_report_producer() {
+
+	struct ct_report_producer* ret_val = malloc(sizeof(struct ct_report_producer));
+
+	if (ret_val == NULL) {
+		CT_MALLOC_ERROR_CALLBACK();
+	}
+
+	ret_val->test_reporter = ct_default_test_report;
+	ret_val->snapshot_tree_reporter = ct_default_snapshot_tree_report;
+	ret_val->summary_producer = ct_default_report_summary;
+	ret_val->assert_reporter = ct_default_assertions_report;
+	ret_val->backtrace_reporter = ct_default_backtrace_report;
+	ret_val->resource_usage_reporter = ct_default_resource_usage_report;
+	ret_val->performance_reporter = ct_default_performance_report;
+	ret_val->stress_reporter = ct_default_stress_report;
+	ret_val->benchmark_reporter = ct_default_benchmark_report;
+	ret_val->flakiness_reporter = ct_default_flakiness_report;
+	ret_val->report_producer = ct_default_report;
+
+	return ret_val;
+
+}
+
+void ct_destroy_stats(struct ct_test_stats* stats) {
+
+	free(stats);
+
+}
+
+void ct_destroy_default_report_producer(struct ct_report_producer* producer) {
+
+	free(producer);
+
+}
+
+
+/*
+ * report_serialization.c
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: koldar
+ */
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <stdint.h>
+#include <string.h>
+#include <errno.h>
+#include <unistd.h>
+
+
+
+
+
+
+
+
+
+
+/**
+ * The length written in place of a @null string
+ */
+#define CT_SERIALIZED_NULL_STRING UINT32_MAX
+
+struct ct_report_arena* ct_init_report_arena() {
+	struct ct_report_arena* ret_val = malloc(sizeof(struct ct_report_arena));
+	if (ret_val == NULL) {
+		CT_MALLOC_ERROR_CALLBACK();
+	}
+
+	ret_val->tags = ct_list_init();
+	ret_val->strings = ct_list_init();
+
+	return ret_val;
+}
+
+void ct_destroy_report_arena(struct ct_report_arena* arena) {
+	CT_ITERATE_ON_LIST(arena->tags, cell, tags, ct_tag_hashtable_o*) {
+		ct_ht_destroy_with_elements(tags, (ct_destroyer_c) ct_tag_destroy);
+	}
+	ct_list_destroy(arena->tags);
+	ct_list_destroy_with_elements(arena->strings, (ct_destroyer_c) free);
+	free(arena);
+}
+
+static void ct_write_string(FILE* out, const char* value) {
+	uint32_t length = (value != NULL) ? (uint32_t) strlen(value) : CT_SERIALIZED_NULL_STRING;
+
+	fwrite(&length, sizeof(length), 1, out);
+	if (value != NULL) {
+		fwrite(value, 1, length, out);
+	}
+}
+
+/**
+ * Serializes a snapshot tree
+ *
+ * The structures are written as they are: the pointers they contain are fixed by the reader
+ *
+ * @param[inout] out the stream to write into
+ * @param[in] snapshot the root of the tree to send
+ */
+static void ct_write_snapshot(FILE* out, const struct ct_snapshot* snapshot) {
+	fwrite(snapshot, sizeof(struct ct_snapshot), 1, out);
+	ct_write_string(out, snapshot->description);
+
+	int tags_number = (snapshot->tags != NULL) ? ct_ht_size(snapshot->tags) : -1;
+	fwrite(&tags_number, sizeof(tags_number), 1, out);
+	if (snapshot->tags != NULL) {
+		CT_ITERATE_VALUES_ON_HT(snapshot->tags, tag, struct ct_tag*) {
+			ct_write_string(out, tag->name);
+		}
+	}
+
+	if (snapshot->backtrace_size > 0) {
+		fwrite(snapshot->backtrace, sizeof(void*), snapshot->backtrace_size, out);
+	}
+
+	if (snapshot->stress != NULL) {
+		fwrite(snapshot->stress, sizeof(struct ct_stress_report), 1, out);
+		fwrite(snapshot->stress->threads, sizeof(struct ct_stress_thread_report), snapshot->stress->threads_number, out);
+	}
+
+	if (snapshot->benchmark != NULL) {
+		fwrite(snapshot->benchmark, sizeof(struct ct_benchmark_report), 1, out);
+		ct_write_string(out, snapshot->benchmark->parameter_name);
+		fwrite(snapshot->benchmark->points, sizeof(struct ct_benchmark_point), snapshot->benchmark->points_number, out);
+	}
+
+	int assertions_number = ct_list_size(snapshot->assertion_reports);
+	fwrite(&assertions_number, sizeof(assertions_number), 1, out);
+	CT_ITERATE_ON_LIST(snapshot->assertion_reports, cell, assertion, struct ct_assert_report*) {
+		fwrite(assertion, sizeof(struct ct_assert_report), 1, out);
+		ct_write_string(out, assertion->asserted);
+		ct_write_string(out, assertion->expected_str);
+		ct_write_string(out, assertion->actual_str);
+		ct_write_string(out, assertion->file_name);
+	}
+
+	int children_number = 0;
+	for (const struct ct_snapshot* child = snapshot->first_child; child != NULL; child = child->next_sibling) {
+		children_number += 1;
+	}
+	fwrite(&children_number, sizeof(children_number), 1, out);
+	for (const struct ct_snapshot* child = snapshot->first_child; child != NULL; child = child->next_sibling) {
+		ct_write_snapshot(out, child);
+	}
+}
+
+void ct_serialize_test_report(FILE* out, const struct ct_test_report* report) {
+	fwrite(report, sizeof(struct ct_test_report), 1, out);
+	ct_write_string(out, report->filename);
+	ct_write_string(out, report->fuzz_input);
+	ct_write_string(out, report->output);
+	ct_write_snapshot(out, report->testcase_snapshot);
+}
+
+void ct_read_serialized_data(int channel, struct ct_serialized_buffer* buffer) {
+	size_t capacity = CT_BUFFER_SIZE;
+
+	buffer->data = malloc(capacity);
+	buffer->size = 0;
+	buffer->position = 0;
+	buffer->corrupted = false;
+	if (buffer->data == NULL) {
+		CT_MALLOC_ERROR_CALLBACK();
+	}
+
+	while (true) {
+		if (buffer->size == capacity) {
+			capacity *= 2;
+			buffer->data = realloc(buffer->data, capacity);
+			if (buffer->data == NULL) {
+				CT_MALLOC_ERROR_CALLBACK();
+			}
+		}
+		ssize_t bytes = read(channel, buffer->data + buffer->size, capacity - buffer->size);
+		if (bytes < 0 && errno == EINTR) {
+			continue;
+		}
+		if (bytes <= 0) {
+			break;
+		}
+		buffer->size += bytes;
+	}
+}
+
+bool ct_deserialize_bytes(struct ct_serialized_buffer* buffer, void* output, size_t size) {
+	if (buffer->corrupted || buffer->size - buffer->position < size) {
+		buffer->corrupted = true;
+		memset(output, 0, size);
+		return false;
+	}
+	memcpy(output, buffer->data + buffer->position, size);
+	buffer->position += size;
+	return true;
+}
+
+/**
+ * Checks whether the serialized data still holds an array it declares
+ *
+ * The check is performed before allocating the array, so that a corrupted count doesn't make us allocate a huge amount of memory.
+ *
+ * @param[inout] buffer the serialized data. It's marked as corrupted if the array doesn't fit in it
+ * @param[in] count the number of items of the array
+ * @param[in] size the number of bytes of every item
+ * @return @true if the whole array is within the data, @false otherwise
+ */
+static bool ct_serialized_buffer_holds(struct ct_serialized_buffer* buffer, long count, size_t size) {
+	if (buffer->corrupted || count < 0 || (size > 0 && (unsigned long) count > (buffer->size - buffer->position) / size)) {
+		buffer->corrupted = true;
+		return false;
+	}
+	return true;
+}
+
+static char* ct_read_string(struct ct_serialized_buffer* buffer) {
+	uint32_t length;
+
+	ct_deserialize_bytes(buffer, &length, sizeof(length));
+	if (length == CT_SERIALIZED_NULL_STRING || !ct_serialized_buffer_holds(buffer, length, 1)) {
+		return NULL;
+	}
+	char* ret_val = malloc(length + 1);
+	if (ret_val == NULL) {
+		CT_MALLOC_ERROR_CALLBACK();
+	}
+	ct_deserialize_bytes(buffer, ret_val, length);
+	ret_val[length] = '\0';
+	return ret_val;
+}
+
+/**
+ * Deserializes a string which is owned by an arena
+ *
+ * @param[inout] buffer the serialized data
+ * @param[inout] arena the arena which will own the string
+ * @return the string deserialized
+ */
+static char* ct_read_arena_string(struct ct_serialized_buffer* buffer, struct ct_report_arena* arena) {
+	char* ret_val = ct_read_string(buffer);
+	if (ret_val != NULL) {
+		ct_list_add_tail(arena->strings, ret_val);
+	}
+	return ret_val;
+}
+
+static struct ct_snapshot* ct_read_snapshot(struct ct_serialized_buffer* buffer, struct ct_report_arena* arena) {
+	struct ct_snapshot* ret_val = malloc(sizeof(struct ct_snapshot));
+	if (ret_val == NULL) {
+		CT_MALLOC_ERROR_CALLBACK();
+	}
+
+	ct_deserialize_bytes(buffer, ret_val, sizeof(struct ct_snapshot));
+	ret_val->description = ct_read_string(buffer);
+	ret_val->parent = NULL;
+	ret_val->first_child = NULL;
+	ret_val->next_sibling = NULL;
+
+	int tags_number;
+	ct_deserialize_bytes(buffer, &tags_number, sizeof(tags_number));
+	ret_val->tags = NULL;
+	if (tags_number >= 0) {
+		ret_val->tags = ct_ht_init();
+		ct_list_add_tail(arena->tags, ret_val->tags);
+		for (int i = 0; i < tags_number && !buffer->corrupted; i++) {
+			char* name = ct_read_string(buffer);
+			if (name != NULL) {
+				ct_tag_ht_put(ret_val->tags, name);
+			}
+			free(name);
+		}
+	}
+
+	ret_val->backtrace = NULL;
+	if (ret_val->backtrace_size > 0 && !ct_serialized_buffer_holds(buffer, ret_val->backtrace_size, sizeof(void*))) {
+		ret_val->backtrace_size = 0;
+	}
+	if (ret_val->backtrace_size > 0) {
+		ret_val->backtrace = malloc(sizeof(void*) * ret_val->backtrace_size);
+		if (ret_val->backtrace == NULL) {
+			CT_MALLOC_ERROR_CALLBACK();
+		}
+		ct_deserialize_bytes(buffer, ret_val->backtrace, sizeof(void*) * ret_val->backtrace_size);
+	}
+
+	if (ret_val->stress != NULL) {
+		ret_val->stress = malloc(sizeof(struct ct_stress_report));
+		if (ret_val->stress == NULL) {
+			CT_MALLOC_ERROR_CALLBACK();
+		}
+		ct_deserialize_bytes(buffer, ret_val->stress, sizeof(struct ct_stress_report));
+		if (!ct_serialized_buffer_holds(buffer, ret_val->stress->threads_number, sizeof(struct ct_stress_thread_report))) {
+			ret_val->stress->threads_number = 0;
+		}
+		ret_val->stress->threads = malloc(sizeof(struct ct_stress_thread_report) * ret_val->stress->threads_number);
+		if (ret_val->stress->threads == NULL && ret_val->stress->threads_number > 0) {
+			CT_MALLOC_ERROR_CALLBACK();
+		}
+		ct_deserialize_bytes(buffer, ret_val->stress->threads, sizeof(struct ct_stress_thread_report) * ret_val->stress->threads_number);
+	}
+
+	if (ret_val->benchmark != NULL) {
+		ret_val->benchmark = malloc(sizeof(struct ct_benchmark_report));
+		if (ret_val->benchmark == NULL) {
+			CT_MALLOC_ERROR_CALLBACK();
+		}
+		ct_deserialize_bytes(buffer, ret_val->benchmark, sizeof(struct ct_benchmark_report));
+		ret_val->benchmark->parameter_name = ct_read_arena_string(buffer, arena);
+		if (!ct_serialized_buffer_holds(buffer, ret_val->benchmark->points_number, sizeof(struct ct_benchmark_point))) {
+			ret_val->benchmark->points_number = 0;
+		}
+		ret_val->benchmark->points = malloc(sizeof(struct ct_benchmark_point) * ret_val->benchmark->points_number);
+		if (ret_val->benchmark->points == NULL && ret_val->benchmark->points_number > 0) {
+			CT_MALLOC_ERROR_CALLBACK();
+		}
+		ct_deserialize_bytes(buffer, ret_val->benchmark->points, sizeof(struct ct_benchmark_point) * ret_val->benchmark->points_number);
+	}
+
+	int assertions_number;
+	ct_deserialize_bytes(buffer, &assertions_number, sizeof(assertions_number));
+	ret_val->assertion_reports = ct_list_init();
+	for (int i = 0; i < assertions_number && !buffer->corrupted; i++) {
+		struct ct_assert_report* assertion = malloc(sizeof(struct ct_assert_report));
+		if (assertion == NULL) {
+			CT_MALLOC_ERROR_CALLBACK();
+		}
+		ct_deserialize_bytes(buffer, assertion, sizeof(struct ct_assert_report));
+		assertion->asserted = ct_read_arena_string(buffer, arena);
+		assertion->expected_value = NULL;
+		assertion->expected_str = ct_read_arena_string(buffer, arena);
+		assertion->actual_value = NULL;
+		assertion->actual_str = ct_read_arena_string(buffer, arena);
+		assertion->file_name = ct_read_arena_string(buffer, arena);
+		ct_list_add_tail(ret_val->assertion_reports, assertion);
+	}
+
+	int children_number;
+	ct_deserialize_bytes(buffer, &children_number, sizeof(children_number));
+	for (int i = 0; i < children_number && !buffer->corrupted; i++) {
+		ct_add_snapshot_to_tree(ct_read_snapshot(buffer, arena), ret_val);
+	}
+
+	return ret_val;
+}
+
+struct ct_test_report* ct_deserialize_test_report(struct ct_serialized_buffer* buffer, struct ct_report_arena* arena) {
+	struct ct_test_report* ret_val = malloc(sizeof(struct ct_test_report));
+	if (ret_val == NULL) {
+		CT_MALLOC_ERROR_CALLBACK();
+	}
+
+	ct_deserialize_bytes(buffer, ret_val, sizeof(struct ct_test_report));
+	ret_val->filename = ct_read_string(buffer);
+	ret_val->fuzz_input = ct_read_string(buffer);
+	ret_val->output = ct_read_string(buffer);
+	ret_val->testcase_snapshot = ct_read_snapshot(buffer, arena);
+	//repetitions are linked once every test has been run
+	ret_val->next_repetition = NULL;
+	ret_val->flakiness = NULL;
+
+	return ret_val;
+}
+
+/*
+ * resource_usage.c
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: koldar
+ */
+
+#include <string.h>
+#include <sys/time.h>
+#include <sys/resource.h>
+
+
+
+static long ct_timeval_to_microseconds(struct timeval t);
+
+void ct_sample_resource_usage(struct ct_resource_usage* usage) {
+	struct rusage r;
+
+	if (getrusage(RUSAGE_SELF, &r) != 0) {
+		memset(usage, 0, sizeof(struct ct_resource_usage));
+		return;
+	}
+
+	usage->max_rss = r.ru_maxrss;
+	usage->max_rss_growth = 0;
+	usage->minor_faults = r.ru_minflt;
+	usage->major_faults = r.ru_majflt;
+	usage->voluntary_context_switches = r.ru_nvcsw;
+	usage->involuntary_context_switches = r.ru_nivcsw;
+	usage->user_time = ct_timeval_to_microseconds(r.ru_utime);
+	usage->system_time = ct_timeval_to_microseconds(r.ru_stime);
+}
+
+void ct_begin_resource_usage(struct ct_resource_usage* usage) {
+	ct_sample_resource_usage(usage);
+}
+
+void ct_end_resource_usage(struct ct_resource_usage* usage) {
+	struct ct_resource_usage now;
+	ct_sample_resource_usage(&now);
+
+	usage->max_rss_growth = now.max_rss - usage->max_rss;
+	usage->max_rss = now.max_rss;
+	usage->minor_faults = now.minor_faults - usage->minor_faults;
+	usage->major_faults = now.major_faults - usage->major_faults;
+	usage->voluntary_context_switches = now.voluntary_context_switches - usage->voluntary_context_switches;
+	usage->involuntary_context_switches = now.involuntary_context_switches - usage->involuntary_context_switches;
+	usage->user_time = now.user_time - usage->user_time;
+	usage->system_time = now.system_time - usage->system_time;
+}
+
+static long ct_timeval_to_microseconds(struct timeval t) {
+	return t.tv_sec * 1000000L + t.tv_usec;
+}
+/*
+ * schedule.c
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: koldar
+ */
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <errno.h>
+#include <unistd.h>
+#include <sys/types.h>
+#include <sys/wait.h>
+
+
+
+
+
+
+
+/**
+ * The id the scheduler knows the calling thread with. -1 if the calling thread is not serialized
+ */
+static _Thread_local int ct_scheduled_thread_id = -1;
+
+/**
+ * The scheduler serializing the calling thread. @null if the calling thread is not serialized
+ */
+static _Thread_local struct ct_scheduler* ct_thread_scheduler = NULL;
+
+static int ct_scheduler_pick_next(struct ct_scheduler* scheduler);
+static void ct_scheduler_switch(struct ct_scheduler* scheduler);
+static void ct_wait_schedule(pid_t* workers, long* seeds, int* workers_number, long* failed_schedules, long* smallest_failed_seed);
+
+struct ct_scheduler* ct_init_scheduler(int threads_number, long seed) {
+	struct ct_scheduler* ret_val = malloc(sizeof(struct ct_scheduler));
+	if (ret_val == NULL) {
+		CT_MALLOC_ERROR_CALLBACK();
+	}
+	ret_val->terminated = calloc(threads_number, sizeof(bool));
+	if (ret_val->terminated == NULL) {
+		CT_MALLOC_ERROR_CALLBACK();
+	}
+
+	pthread_mutex_init(&ret_val->lock, NULL);
+	pthread_cond_init(&ret_val->changed, NULL);
+	ret_val->threads_number = threads_number;
+	ret_val->registered_threads = 0;
+	ret_val->running = -1;
+	ret_val->alive_threads = threads_number;
+	//the state of the generator can't be 0
+	ret_val->random_state = ((unsigned long long) seed) * 0x9E3779B97F4A7C15ULL + 1;
+
+	return ret_val;
+}
+
+void ct_destroy_scheduler(struct ct_scheduler* scheduler) {
+	pthread_cond_destroy(&scheduler->changed);
+	pthread_mutex_destroy(&scheduler->lock);
+	free(scheduler->terminated);
+	free(scheduler);
+}
+
+void ct_scheduler_start(struct ct_scheduler* scheduler) {
+	pthread_mutex_lock(&scheduler->lock);
+	while (scheduler->registered_threads < scheduler->threads_number) {
+		pthread_cond_wait(&scheduler->changed, &scheduler->lock);
+	}
+	scheduler->running = ct_scheduler_pick_next(scheduler);
+	pthread_cond_broadcast(&scheduler->changed);
+	pthread_mutex_unlock(&scheduler->lock);
+}
+
+void ct_scheduler_thread_start(struct ct_scheduler* scheduler, int thread_id) {
+	ct_thread_scheduler = scheduler;
+	ct_scheduled_thread_id = thread_id;
+
+	pthread_mutex_lock(&scheduler->lock);
+	scheduler->registered_threads += 1;
+	pthread_cond_broadcast(&scheduler->changed);
+	while (scheduler->running != thread_id) {
+		pthread_cond_wait(&scheduler->changed, &scheduler->lock);
+	}
+	pthread_mutex_unlock(&scheduler->lock);
+}
+
+void ct_scheduler_thread_end(struct ct_scheduler* scheduler) {
+	pthread_mutex_lock(&scheduler->lock);
+	scheduler->terminated[ct_scheduled_thread_id] = true;
+	scheduler->alive_threads -= 1;
+	scheduler->running = (scheduler->alive_threads > 0) ? ct_scheduler_pick_next(scheduler) : -1;
+	pthread_cond_broadcast(&scheduler->changed);
+	pthread_mutex_unlock(&scheduler->lock);
+
+	ct_thread_scheduler = NULL;
+	ct_scheduled_thread_id = -1;
+}
+
+void ct_yield() {
+	if (ct_thread_scheduler == NULL) {
+		return;
+	}
+	ct_scheduler_switch(ct_thread_scheduler);
+}
+
+int ct_mutex_lock(pthread_mutex_t* mutex) {
+	if (ct_thread_scheduler == NULL) {
+		return pthread_mutex_lock(mutex);
+	}
+
+	ct_yield();
+	//the owner of the mutex can run only if we let it
+	int ret_val;
+	while ((ret_val = pthread_mutex_trylock(mutex)) == EBUSY) {
+		ct_yield();
+	}
+	return ret_val;
+}
+
+int ct_mutex_unlock(pthread_mutex_t* mutex) {
+	int ret_val = pthread_mutex_unlock(mutex);
+	ct_yield();
+	return ret_val;
+}
+
+long ct_explore_schedules(struct ct_model* model, ct_stress_c function, int threads_number, long iterations, long* failed_schedules) {
+	int max_workers = ct_get_workers_number(model);
+
+	ct_allocation_tracker_pause();
+	pid_t* workers = malloc(sizeof(pid_t) * max_workers);
+	long* seeds = malloc(sizeof(long) * max_workers);
+	ct_allocation_tracker_resume();
+	if (workers == NULL || seeds == NULL) {
+		CT_MALLOC_ERROR_CALLBACK();
+	}
+	int workers_number = 0;
+	long smallest_failed_seed = -1;
+	*failed_schedules = 0;
+
+	//the buffered output would be printed by every worker as well
+	fflush(NULL);
+	for (long seed = 0; seed < model->schedule_seeds; seed++) {
+		if (workers_number == max_workers) {
+			ct_wait_schedule(workers, seeds, &workers_number, failed_schedules, &smallest_failed_seed);
+		}
+
+		pid_t pid = fork();
+		if (pid < 0) {
+			perror("CrashC - cannot fork a schedule worker");
+			exit(1);
+		}
+		if (pid == 0) {
+			//the worker process: the result is the exit status
+			_exit(ct_run_stress_schedule(model, function, threads_number, iterations, seed) ? 0 : 1);
+		}
+		workers[workers_number] = pid;
+		seeds[workers_number] = seed;
+		workers_number += 1;
+	}
+	while (workers_number > 0) {
+		ct_wait_schedule(workers, seeds, &workers_number, failed_schedules, &smallest_failed_seed);
+	}
+
+	ct_allocation_tracker_pause();
+	free(seeds);
+	free(workers);
+	ct_allocation_tracker_resume();
+	return smallest_failed_seed;
+}
+
+/**
+ * Chooses the next thread to run among the ones which have not terminated yet
+ *
+ * The caller needs to hold struct ct_scheduler::lock
+ *
+ * @param[inout] scheduler the scheduler to handle
+ * @return the id of the next thread to run
+ */
+static int ct_scheduler_pick_next(struct ct_scheduler* scheduler) {
+	//xorshift64*
+	scheduler->random_state ^= scheduler->random_state >> 12;
+	scheduler->random_state ^= scheduler->random_state << 25;
+	scheduler->random_state ^= scheduler->random_state >> 27;
+	unsigned long long random = scheduler->random_state * 0x2545F4914F6CDD1DULL;
+
+	int chosen = (int) ((random >> 32) % (unsigned long long) scheduler->alive_threads);
+	for (int i = 0; i < scheduler->threads_number; i++) {
+		if (scheduler->terminated[i]) {
+			continue;
+		}
+		if (chosen == 0) {
+			return i;
+		}
+		chosen -= 1;
+	}
+	return -1;
+}
+
+/**
+ * Lets the scheduler choose the next thread to run and waits until the calling thread is chosen again
+ *
+ * @param[inout] scheduler the scheduler to handle
+ */
+static void ct_scheduler_switch(struct ct_scheduler* scheduler) {
+	pthread_mutex_lock(&scheduler->lock);
+	scheduler->running = ct_scheduler_pick_next(scheduler);
+	pthread_cond_broadcast(&scheduler->changed);
+	while (scheduler->running != ct_scheduled_thread_id) {
+		pthread_cond_wait(&scheduler->changed, &scheduler->lock);
+	}
+	pthread_mutex_unlock(&scheduler->lock);
+}
+
+/**
+ * Waits until a schedule worker terminates and collects its result
+ *
+ * @param[inout] workers the processes running right now
+ * @param[inout] seeds the seed each process in \c workers is running
+ * @param[inout] workers_number the number of processes inside \c workers
+ * @param[inout] failed_schedules the number of seeds which have failed so far
+ * @param[inout] smallest_failed_seed the smallest seed which has failed so far, -1 if none has failed yet
+ */
+static void ct_wait_schedule(pid_t* workers, long* seeds, int* workers_number, long* failed_schedules, long* smallest_failed_seed) {
+	int status;
+	pid_t pid = 0;
+
+	//only the workers are waited for, since the code under test may have spawned children of its own
+	for (int i = 0; i < *workers_number && pid == 0; i++) {
+		pid = waitpid(workers[i], &status, WNOHANG);
+	}
+	if (pid == 0) {
+		//no worker has terminated yet, so the first one is waited for
+		while ((pid = waitpid(workers[0], &status, 0)) < 0 && errno == EINTR);
+	}
+	if (pid < 0) {
+		perror("CrashC - cannot wait for a schedule worker");
+		exit(1);
+	}
+
+	for (int i = 0; i < *workers_number; i++) {
+		if (workers[i] != pid) {
+			continue;
+		}
+		if (!WIFEXITED(status) || WEXITSTATUS(status) != 0) {
+			*failed_schedules += 1;
+			if (*smallest_failed_seed < 0 || seeds[i] < *smallest_failed_seed) {
+				*smallest_failed_seed = seeds[i];
+			}
+		}
+		workers[i] = workers[*workers_number - 1];
+		seeds[i] = seeds[*workers_number - 1];
+		*workers_number -= 1;
+		return;
+	}
+}
+/*
+ * section.c
+ *
+ *  Created on: Feb 16, 2017
+ *      Author: koldar
+ */
+
+#include <unistd.h>
+#include <stdio.h>
+#include <stdarg.h>
+
+
+
+
+/**
+ * The id the next section created with ::ct_section_init will have.
+ *
+ * It starts from 1 and not from 0 because 0 is **manually** set to the root section, created **statically**.
+ * See ::rootSection
+ */
+static int next_section_id = 1;
+
+static int populate_section_status_buffer_string(const int ss, int space_left, char* buffer);
+static void compute_section_tree_dot_file(FILE* fout, const struct ct_section* section);
+static void update_section_tree_dot_file_with_section_info(FILE* fout, const struct ct_section* section);
+static void update_section_tree_dot_file_with_section_edges(FILE* fout, const struct ct_section* section);
+
+struct ct_section* ct_section_add_child(struct ct_section* restrict to_add, struct ct_section* restrict parent) {
+	struct ct_section* list = NULL;
+
+	to_add->parent = parent;
+
+	list = parent->first_child;
+	if (list == NULL) {
+		parent->first_child = to_add;
+		return to_add;
+	}
+	while (true) {
+		if (list->next_sibling != NULL) {
+			list = list->next_sibling;
+		} else {
+			list->next_sibling = to_add;
+			return to_add;
+		}
+	}
+}
+
+struct ct_section* ct_section_get_child(const struct ct_section* parent, int n) {
+	struct ct_section* list = parent->first_child;
+	while(true) {
+		if ((n == 0) || (list == NULL)) {
+			return list;
+		} else {
+			list = list->next_sibling;
+			n--;
+		}
+	}
+}
+
+struct ct_section* ct_section_init(enum ct_section_type type, const char* description, ct_tag_hashtable_o* tags) {
+	struct ct_section* ret_val = malloc(sizeof(struct ct_section));
+	if (ret_val == NULL) {
+		CT_MALLOC_ERROR_CALLBACK();
+	}
+
+	ret_val->id = next_section_id;
+	next_section_id += 1;
+	ret_val->access_granted = false;
+	ret_val->already_found_when = false;
+	ret_val->children_number = 0;
+	ret_val->children_number_known = false;
+	ret_val->status = CT_SECTION_UNVISITED;
+	ret_val->current_child = 0;
+	ret_val->description = strdup(description);
+	ret_val->first_child = NULL;
+	ret_val->type = type;
+	ret_val->times_encountered = 0;
+	ret_val->loop1 = false;
+	ret_val->loop2 = false;
+	ret_val->next_sibling = NULL;
+	ret_val->parent = NULL;
+	ret_val->tags = tags;
+	ret_val->path_hash = CT_ROOT_PATH_HASH;
+	ret_val->on_target_path = true;
+	ret_val->inside_target = true;
+
+	return ret_val;
+}
+
+void ct_section_destroy(struct ct_section* section) {
+	if (section->first_child != NULL) {
+		ct_section_destroy(section->first_child);
+	}
+	if (section->next_sibling != NULL) {
+		ct_section_destroy(section->next_sibling);
+	}
+	if (section->parent == NULL) {
+		//root section shouldn't be removed at all
+		return;
+	}
+
+	free((void*) section->description);
+	free((void*) section);
+}
+
+unsigned long ct_testcase_key_hash(const struct ct_testcase_key* key) {
+	return key->path_hash * 31 + (unsigned long) key->occurrence;
+}
+
+unsigned long ct_section_path_hash(unsigned long parent_hash, const char* description, size_t length) {
+	//djb2, like ct_string_hash, so the hash of a path is the hash of the whole string
+	unsigned long hash = ((parent_hash << 5) + parent_hash) + CT_SECTION_PATH_SEPARATOR;
+
+	for (size_t i = 0; i < length; i++) {
+		hash = ((hash << 5) + hash) + (unsigned char) description[i];
+	}
+	return hash;
+}
+
+void ct_section_site_prepare(struct ct_section_site* site, const char* tags, struct ct_section_site** prepared_sites) {
+	if (site->prepared) {
+		return;
+	}
+
+	site->tags = ct_ht_init();
+	if (!ct_tag_ht_populate(site->tags, tags, CT_TAGS_SEPARATOR)) {
+		fprintf(stderr, "CrashC - %s:%d: malformed tags \"%s\": tags can't be empty\n", site->file, site->line, tags);
+	}
+	site->prepared = true;
+	site->next = *prepared_sites;
+	*prepared_sites = site;
+}
+
+void ct_section_sites_release(struct ct_section_site** prepared_sites) {
+	struct ct_section_site* site = *prepared_sites;
+
+	while (site != NULL) {
+		struct ct_section_site* next = site->next;
+		ct_ht_destroy_with_elements(site->tags, (ct_destroyer_c)(ct_tag_destroy));
+		site->tags = NULL;
+		site->prepared = false;
+		site->next = NULL;
+		site = next;
+	}
+	*prepared_sites = NULL;
+}
+
+int ct_section_get_level(const struct ct_section* section) {
+	int level = 0;
+	const struct ct_section* tmp = section;
+
+	while (tmp->parent != NULL) {
+		level++;
+		tmp = tmp->parent;
+	}
+
+	return level;
+}
+
+bool ct_section_is_fully_visited(struct ct_section* section) {
+	if (section->children_number == 0) {
+		return true;
+	}
+	else {
+		struct ct_section* next_child = section->first_child;
+
+		while (next_child != NULL) {
+			if (ct_section_still_needs_execution(next_child)) {
+				return false;
+			}
+			next_child = next_child->next_sibling;
+		}
+		return true;
+	}
+}
+
+void ct_section_draw_tree(const struct ct_section* section, const char* format, ...) {
+	//create image name
+	va_list ap;
+	char image_template[CT_BUFFER_SIZE];
+	va_start(ap, format);
+	vsnprintf(image_template, CT_BUFFER_SIZE, format, ap);
+	va_end(ap);
+
+	char dot_filename[CT_BUFFER_SIZE];
+	strncpy(dot_filename, image_template, CT_BUFFER_SIZE);
+	//TODO here we need to make sure ".dot" can be put within the buffer
+	strcat(dot_filename, ".dot");
+
+	FILE* dot_file = fopen(dot_filename, "w");
+	if (dot_file == NULL) {
+		fprintf(stderr, "Can't create dot_file %s! Exiting...", dot_filename);
+		//TODO create a new error like FILE_ERROR_CALLBACK
+		exit(1);
+	}
+	compute_section_tree_dot_file(dot_file, section);
+	fclose(dot_file);
+
+	char png_filename[CT_BUFFER_SIZE];
+	strncpy(png_filename, image_template, CT_BUFFER_SIZE);
+	//TODO here we need to make sure ".dot" can be put within the buffer
+	strcat(png_filename, ".png");
+
+	char command[CT_BUFFER_SIZE];
+	snprintf(command, CT_BUFFER_SIZE, "dot -Tpng -o%s %s", png_filename, dot_filename);
+	system(command);
+	unlink(dot_filename);
+}
+
+static int populate_section_status_buffer_string(const int ss, int space_left, char* buffer) {
+	int i = 0;
+	//TODO renamed DONE, EXECUTED and UNEXECUTED to fit section status renaming
+	switch (ss) {
+	case CT_SECTION_FULLY_VISITED: { i += snprintf(&buffer[i], space_left - i, "DONE"); break; }
+	case CT_SECTION_PARTIALLY_VISITED: { i += snprintf(&buffer[i], space_left - i, "EXECUTED"); break; }
+	case CT_SECTION_UNVISITED: { i += snprintf(&buffer[i], space_left - i, "UNEXECUTED"); break; }
+	case CT_SECTION_SIGNAL_DETECTED: { i += snprintf(&buffer[i], space_left - i, "SIGNAL DETECTED"); break; }
+	default: {
+		//TODO create a new error type, like SWITCH_DEFAULT_ERROR_CALLBACK
+		fprintf(stderr, "invalid section status %d\n", ss);
+		exit(1);
+	}
+	}
+
+	return i;
+}
+
+static void compute_section_tree_dot_file(FILE* fout, const struct ct_section* section) {
+	fprintf(fout, "digraph {\n");
+
+	// ******************* define nodes **********************
+	update_section_tree_dot_file_with_section_info(fout, section);
+	// ******************* create edges **********************
+	update_section_tree_dot_file_with_section_edges(fout, section);
+
+	fprintf(fout, "}\n");
+}
+
+/**
+ * Adds inside a *.dot file the lists of all the nodes inside the section tree starting from a given one
+ *
+ * \pre
+ * 	\li \c fout open in "w" mode;
+ * \post
+ * 	\li \c fout contains node whose names patterns are "SECTION%5d" ("%05d" refers to a given section id)
+ *
+ * @param[inout] fout the file to write on
+ * @param[in] section the section where we start writing information from
+ */
+static void update_section_tree_dot_file_with_section_info(FILE* fout, const struct ct_section* section) {
+	char buffer[CT_BUFFER_SIZE];
+	populate_section_status_buffer_string(section->status, CT_BUFFER_SIZE, buffer);
+	fprintf(fout, "\tSECTION%05d [label=\"%s\\nlevel=%d;\\nstatus=%s\", shape=\"box\"];\n", section->id, section->description, ct_section_get_level(section), buffer);
+
+	if (section->first_child == NULL) {
+		return;
+	}
+
+	update_section_tree_dot_file_with_section_info(fout, section->first_child);
+
+	struct ct_section* tmp = section->first_child->next_sibling;
+	while (tmp != NULL) {
+		update_section_tree_dot_file_with_section_info(fout, tmp);
+		tmp = tmp->next_sibling;
+	}
+
+}
+
+/**
+ * Adds inside a "*.dot" file all the edges between the nodes
+ *
+ * \pre
+ * 	\li \c fout open in "w" mode;
+ * 	\li ::update_section_tree_dot_file_with_section_info called;
+ * \post
+ * 	\li \c fout contains all the edges;
+ *
+ * @param[inout] fout the file to write on
+ * @param[in] section the section where we need to start adding edges from
+ */
+static void update_section_tree_dot_file_with_section_edges(FILE* fout, const struct ct_section* section) {
+	if (section->first_child == NULL) {
+		return;
+	}
+
+	update_section_tree_dot_file_with_section_edges(fout, section->first_child);
+
+	fprintf(fout, "\tSECTION%05d -> SECTION%05d;\n", section->id, section->first_child->id);
+	struct ct_section* tmp = section->first_child->next_sibling;
+	while (tmp != NULL) {
+		fprintf(fout, "SECTION%05d -> SECTION%05d;\n", section->id, tmp->id);
+		tmp = tmp->next_sibling;
+	}
+
+}
+/*
+ * section_fork.c
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: koldar
+ */
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <errno.h>
+#include <setjmp.h>
+#include <unistd.h>
+#include <sys/types.h>
+#include <sys/wait.h>
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+struct ct_section_fork* ct_init_section_fork() {
+	struct ct_section_fork* ret_val = malloc(sizeof(struct ct_section_fork));
+	if (ret_val == NULL) {
+		CT_MALLOC_ERROR_CALLBACK();
+	}
+
+	ret_val->channel = -1;
+	ret_val->root = NULL;
+	ret_val->first_report = 0;
+	ret_val->delegated = false;
+	ret_val->collected_reports = ct_list_init();
+	ret_val->arena = ct_init_report_arena();
+
+	return ret_val;
+}
+
+void ct_destroy_section_fork(struct ct_section_fork* section_fork) {
+	ct_list_destroy_with_elements(section_fork->collected_reports, (ct_destroyer_c) ct_destroy_test_report);
+	ct_destroy_report_arena(section_fork->arena);
+	free(section_fork);
+}
+
+/**
+ * Sends the tests this process has completed to the process which forked it and exits
+ *
+ * @param[inout] model the model of the forked process
+ * @param[in] interrupted @true if the last test has been interrupted by a failed assertion or a signal
+ */
+static void ct_send_tests_and_exit(struct ct_model* model, bool interrupted) {
+	struct ct_section_fork* section_fork = model->section_fork;
+
+	ct_allocation_tracker_pause();
+	FILE* out = fdopen(section_fork->channel, "w");
+	if (out == NULL) {
+		_exit(EXIT_FAILURE);
+	}
+
+	int status = section_fork->root->status;
+	fwrite(&status, sizeof(status), 1, out);
+	fwrite(&interrupted, sizeof(interrupted), 1, out);
+	int reports_number = ct_list_size(model->test_reports_list) - section_fork->first_report;
+	fwrite(&reports_number, sizeof(reports_number), 1, out);
+	int index = 0;
+	CT_ITERATE_ON_LIST(model->test_reports_list, cell, report, struct ct_test_report*) {
+		if (index >= section_fork->first_report) {
+			ct_serialize_test_report(out, report);
+		}
+		index += 1;
+	}
+
+	//the output of the tests needs to reach the terminal before the process which forked goes on
+	bool sent = !ferror(out) && fclose(out) == 0;
+	fflush(NULL);
+	_exit(sent ? EXIT_SUCCESS : EXIT_FAILURE);
+}
+
+static bool ct_is_ancestor_of(const struct ct_section* section, const struct ct_section* descendant) {
+	for (const struct ct_section* s = descendant->parent; s != NULL; s = s->parent) {
+		if (s == section) {
+			return true;
+		}
+	}
+	return false;
+}
+
+static void ct_confine_subtree(struct ct_section* section, const struct ct_section* root, bool parent_inside) {
+	section->inside_target = parent_inside || section == root;
+	section->on_target_path = section->inside_target || ct_is_ancestor_of(section, root);
+	for (struct ct_section* child = section->first_child; child != NULL; child = child->next_sibling) {
+		ct_confine_subtree(child, root, section->inside_target);
+	}
+}
+
+/**
+ * Restricts the sections a forked process can enter to the @when it has been forked for, its ancestors and its descendants
+ *
+ * It's the same mechanism used by ::ct_select_section_path. If another section has been selected, the forked process is already confined
+ * unless its @when is inside the selected section.
+ *
+ * @param[inout] model the model of the forked process
+ * @param[in] section the @when the process has been forked for
+ */
+static void ct_confine_to_section(struct ct_model* model, struct ct_section* section) {
+	if (!section->inside_target) {
+		return;
+	}
+	//the sections found from now on are inside the @when only if their parent is
+	ct_ht_clear(model->selected_path_prefixes);
+	model->selected_path_level = ct_section_get_level(section);
+	ct_confine_subtree(model->root_section, section, false);
+}
+
+/**
+ * Reports a @when whose forked process has terminated without sending its tests back
+ *
+ * The tests of the forked process are lost: the running test is kept in their place and fails as if the @when had received a signal.
+ * Like a signal, this interrupts the @testcase.
+ *
+ * @param[inout] model the model of the process which forked
+ * @param[inout] section the @when the process has been forked for
+ * @param[in] exit_status the status of the forked process, as returned by \c waitpid
+ */
+static void ct_section_lost(struct ct_model* model, struct ct_section* section, int exit_status) {
+	struct ct_section_fork* section_fork = model->section_fork;
+	struct ct_test_report* report = ct_list_tail(model->test_reports_list);
+
+	fprintf(stderr, "CrashC - the process running the section \"%s\" has terminated without sending its tests back\n", section->description);
+	struct ct_snapshot* snapshot = ct_add_snapshot_to_tree(ct_init_section_snapshot(section), model->current_snapshot);
+	ct_section_set_signaled(section);
+	snapshot->status = CT_SNAPSHOT_SIGNALED;
+	if (WIFSIGNALED(exit_status)) {
+		section->signal_detected = WTERMSIG(exit_status);
+		snapshot->signal_detected = WTERMSIG(exit_status);
+	}
+	ct_update_test_outcome(report, snapshot);
+	section_fork->delegated = false;
+	ct_allocation_tracker_resume();
+
+	model->current_snapshot = NULL;
+	siglongjmp(model->jump_point, CT_SIGNAL_JUMP_CODE);
+}
+
+bool ct_fork_section(struct ct_model* model, struct ct_section* section) {
+	struct ct_section_fork* section_fork = model->section_fork;
+
+	//a fuzzer runs a single input per process
+	if (ct_is_fuzzing(model)) {
+		return true;
+	}
+
+	int channel[2];
+	if (pipe(channel) != 0) {
+		perror("CrashC - cannot create the pipe of a forked section");
+		exit(EXIT_FAILURE);
+	}
+	//otherwise the buffered output would be written by both processes
+	fflush(NULL);
+	long output_mark = (model->output_capture != NULL) ? ct_output_capture_mark(model->output_capture) : -1;
+	pid_t pid = fork();
+	if (pid < 0) {
+		perror("CrashC - cannot fork a section");
+		exit(EXIT_FAILURE);
+	}
+
+	ct_allocation_tracker_pause();
+	if (pid == 0) {
+		close(channel[0]);
+		if (section_fork->channel >= 0) {
+			close(section_fork->channel);
+		}
+		section_fork->channel = channel[1];
+		section_fork->root = section;
+		//the running test is the first one to send back
+		section_fork->first_report = ct_list_size(model->test_reports_list) - 1;
+		section_fork->delegated = false;
+		//the tests collected so far belong to the process which forked
+		ct_list_destroy_with_elements(section_fork->collected_reports, (ct_destroyer_c) ct_destroy_test_report);
+		section_fork->collected_reports = ct_list_init();
+		//the listeners are notified by the process which collects the tests
+		model->event_dispatcher->subscribed_events = 0;
+		ct_confine_to_section(model, section);
+		ct_allocation_tracker_resume();
+		return true;
+	}
+
+	close(channel[1]);
+	struct ct_serialized_buffer buffer;
+	ct_read_serialized_data(channel[0], &buffer);
+	close(channel[0]);
+
+	int exit_status;
+	while (waitpid(pid, &exit_status, 0) < 0 && errno == EINTR);
+
+	if (!WIFEXITED(exit_status) || WEXITSTATUS(exit_status) != EXIT_SUCCESS) {
+		free(buffer.data);
+		ct_section_lost(model, section, exit_status);
+	}
+	//the forked process has written into the same captured output, but what it has written belongs to its own tests
+	if (model->output_capture != NULL) {
+		ct_output_capture_rewind(model->output_capture, output_mark);
+	}
+
+	int status;
+	bool interrupted;
+	int reports_number;
+	ct_deserialize_bytes(&buffer, &status, sizeof(status));
+	ct_deserialize_bytes(&buffer, &interrupted, sizeof(interrupted));
+	ct_deserialize_bytes(&buffer, &reports_number, sizeof(reports_number));
+	for (int i = 0; i < reports_number && !buffer.corrupted; i++) {
+		ct_list_add_tail(section_fork->collected_reports, ct_deserialize_test_report(&buffer, section_fork->arena));
+	}
+	if (buffer.corrupted) {
+		//the forked process is a copy of this one: it can't have sent anything else than whole tests
+		fprintf(stderr, "CrashC - corrupted tests have been received\n");
+		exit(EXIT_FAILURE);
+	}
+	free(buffer.data);
+	section->status = status;
+	section_fork->delegated = true;
+	ct_allocation_tracker_resume();
+
+	if (interrupted) {
+		//the test process would have stopped running the @testcase as well
+		model->current_snapshot = NULL;
+		siglongjmp(model->jump_point, CT_ASSERT_JUMP_CODE);
+	}
+	return false;
+}
+
+bool ct_section_fork_end_test(struct ct_model* model, struct ct_test_report* report, bool interrupted) {
+	struct ct_section_fork* section_fork = model->section_fork;
+	//if the test has delegated its @when sections, the forked processes have run the actual tests
+	bool ret_val = !section_fork->delegated;
+
+	if (CT_HAS_LISTENERS(model, CT_EVENT_TEST_END)) {
+		CT_ITERATE_ON_LIST(section_fork->collected_reports, cell, collected, struct ct_test_report*) {
+			ct_dispatch_test_end(model, collected);
+		}
+	}
+
+	ct_allocation_tracker_pause();
+	if (!ct_list_is_empty(section_fork->collected_reports)) {
+		//the collected tests take the place of the running one, which goes after them if it's kept
+		ct_list_replace_tail(model->test_reports_list, ct_list_pop(section_fork->collected_reports));
+		if (ret_val) {
+			ct_list_add_tail(section_fork->collected_reports, report);
+		} else {
+			ct_destroy_test_report(report);
+		}
+		if (!ct_list_is_empty(section_fork->collected_reports)) {
+			ct_list_full_transfer(model->test_reports_list, section_fork->collected_reports);
+		}
+	} else if (!ret_val) {
+		ct_list_pop_tail(model->test_reports_list);
+		ct_destroy_test_report(report);
+	}
+	section_fork->delegated = false;
+	ct_allocation_tracker_resume();
+
+	//an interrupted test ends the @testcase
+	if (section_fork->root != NULL && (interrupted || !ct_section_still_needs_execution(section_fork->root))) {
+		ct_send_tests_and_exit(model, interrupted);
+	}
+	return ret_val;
+}
+
+void ct_section_fork_leave(struct ct_model* model) {
+	if (model->section_fork != NULL && model->section_fork->root != NULL) {
+		ct_send_tests_and_exit(model, false);
+	}
+}
+/**
+ * Signals handler functions.
+ * These functions are used by CrashC to control its behaviour when certain signals
+ * are delivered. For example, if a tested function tries to access invalid memory,
+ * and it receives a SIGSEGV signal, CrashC terminates the function, proceeds with
+ * the next one and reports about the error in the final test report.
+ *
+ * Note that CrashC behaviour is designed to let the programmer use his own signal
+ * handling routines, in order not to limitate the possible tests types supported by
+ * the library. CrashC in fact assumes that if the programmer did not specify any
+ * custom signal handler, any possible "bad" signal is to be considered an error
+ * that the user wants to be noticed about.
+ *
+ * \author Lorenzo Nodari <lorenzo.nodari.it@ieee.org>
+ *
+ *
+ */
+
+#include <stdlib.h>
+#include <execinfo.h>
+#include <stdbool.h>
+
+
+
+
+/**
+ * The signals @crashc considers as a failure of the running test
+ *
+ * The array has exactly ::CT_HANDLED_SIGNALS_NUMBER cells
+ */
+static const int handled_signals[CT_HANDLED_SIGNALS_NUMBER] = {SIGSEGV, SIGBUS, SIGILL, SIGABRT, SIGFPE};
+
+static void ct_failsig_handler(int signum, siginfo_t* info, void* context);
+static int ct_handled_signal_index(int signum);
+
+void ct_register_signal_handlers() {
+	struct sigaction current_action;
+
+	//the handler needs its own stack: otherwise a stack overflow can't be detected at all
+	if ((ct_model)->signal_stack.ss_sp == NULL) {
+		(ct_model)->signal_stack.ss_sp = malloc(CT_SIGNAL_STACK_SIZE);
+		if ((ct_model)->signal_stack.ss_sp == NULL) {
+			CT_MALLOC_ERROR_CALLBACK();
+		}
+		(ct_model)->signal_stack.ss_size = CT_SIGNAL_STACK_SIZE;
+		(ct_model)->signal_stack.ss_flags = 0;
+	}
+	if (sigaltstack(&((ct_model)->signal_stack), NULL) == -1) {
+		perror("Error: cannot install alternate signal stack"); //should not happen
+	}
+
+	//backtrace loads the unwinder lazily the first time it's called: we do it now since that is not async-signal-safe
+	if (CT_BACKTRACE_SIZE > 0) {
+		(ct_model)->backtrace_buffer_size = backtrace((ct_model)->backtrace_buffer, CT_BACKTRACE_SIZE + CT_BACKTRACE_SKIPPED_FRAMES);
+		(ct_model)->backtrace_buffer_size = 0;
+	}
+
+	(ct_model)->_crashc_sigaction.sa_sigaction = ct_failsig_handler;
+	(ct_model)->_crashc_sigaction.sa_flags = SA_SIGINFO | SA_ONSTACK;
+	sigemptyset(&((ct_model)->_crashc_sigaction.sa_mask));
+
+	for (int i = 0; i < CT_HANDLED_SIGNALS_NUMBER; i++) {
+		if (sigaction(handled_signals[i], NULL, &current_action) == -1) {
+			perror("Error: cannot query signal action"); //should not happen
+			continue;
+		}
+		//the program under test handles (or ignores) the signal by itself: we don't clobber its handler
+		if ((current_action.sa_flags & SA_SIGINFO) || current_action.sa_handler != SIG_DFL) {
+			continue;
+		}
+		if (sigaction(handled_signals[i], &((ct_model)->_crashc_sigaction), &((ct_model)->previous_sigactions[i])) == -1) {
+			perror("Error: cannot handle signal"); //should not happen
+			continue;
+		}
+		(ct_model)->signal_handler_installed[i] = true;
+	}
+}
+
+void ct_unregister_signal_handlers() {
+	for (int i = 0; i < CT_HANDLED_SIGNALS_NUMBER; i++) {
+		if (!(ct_model)->signal_handler_installed[i]) {
+			continue;
+		}
+		sigaction(handled_signals[i], &((ct_model)->previous_sigactions[i]), NULL);
+		(ct_model)->signal_handler_installed[i] = false;
+	}
+
+	if ((ct_model)->signal_stack.ss_sp != NULL) {
+		stack_t disabled_stack = { .ss_sp = NULL, .ss_size = 0, .ss_flags = SS_DISABLE };
+		sigaltstack(&disabled_stack, NULL);
+	}
+}
+
+/**
+ * Fetch the position of a signal inside ::handled_signals
+ *
+ * @param[in] signum the signal to look for
+ * @return the index of \c signum inside ::handled_signals or -1 if @crashc doesn't handle \c signum
+ */
+static int ct_handled_signal_index(int signum) {
+	for (int i = 0; i < CT_HANDLED_SIGNALS_NUMBER; i++) {
+		if (handled_signals[i] == signum) {
+			return i;
+		}
+	}
+	return -1;
+}
+
+/**
+ * Code to be run when a signal was not handled by the program under test itself
+ *
+ * This handler is used for every signal whose delivery is considered by CrashC to
+ * imply a failure in the running test. This handler is used only if the programmer
+ * does not register any other signal handler for the particular signal being considered.
+ * What we need to do is mark the current running test as failed and update its status
+ * in order that it is not run again on the next CT_LOOPER iteration.
+ *
+ * If the signal is raised on a worker thread, the signal is recorded and the worker thread jumps back to where it has been started
+ * (see thread_context.h), terminating. Terminating the thread from here, via \c pthread_exit, is not allowed.
+ *
+ * If the signal is raised outside any test, or on a worker thread without a jump point, there is nowhere to jump back to: in this case
+ * the previous signal action is restored and the signal is delivered again.
+ *
+ * @param signum an ID representing the signal detected
+ * @param info additional information about the signal, like the faulting address
+ * @param context the user context at the moment of the signal. Unused
+ *
+ */
+static void ct_failsig_handler(int signum, siginfo_t* info, void* context) {
+
+	bool main_thread = ct_is_main_thread(ct_model);
+	if (!main_thread) {
+		//we can't jump into the stack of another thread: the signal will be propagated when the main thread merges it
+		ct_record_thread_signal(ct_model, signum, info);
+		ct_thread_jump_back(CT_SIGNAL_JUMP_CODE);
+	}
+
+	if (!main_thread || (ct_model)->current_snapshot == NULL) {
+		int index = ct_handled_signal_index(signum);
+		if (index >= 0) {
+			sigaction(signum, &((ct_model)->previous_sigactions[index]), NULL);
+			(ct_model)->signal_handler_installed[index] = false;
+		}
+		raise(signum);
+		return;
+	}
+
+	//printf("marking section \"%s\" as signal detected!\n", (ct_model)->current_section->description);
+    //Mark test as failed code
+	ct_section_set_signaled((ct_model)->current_section);
+	(ct_model)->current_section->signal_detected = signum;
+
+	(ct_model)->current_snapshot->status = CT_SNAPSHOT_SIGNALED;
+	(ct_model)->current_snapshot->signal_detected = signum;
+	(ct_model)->current_snapshot->signal_code = info->si_code;
+	(ct_model)->current_snapshot->signal_address = info->si_addr;
+	//we can't allocate memory here: the backtrace will be attached to the snapshot after the jump
+	if (CT_BACKTRACE_SIZE > 0) {
+		(ct_model)->backtrace_buffer_size = backtrace((ct_model)->backtrace_buffer, CT_BACKTRACE_SIZE + CT_BACKTRACE_SKIPPED_FRAMES);
+		(ct_model)->signaled_snapshot = (ct_model)->current_snapshot;
+	}
+	struct ct_test_report* report = ct_list_tail((ct_model)->test_reports_list);
+	ct_update_test_outcome(report, (ct_model)->current_snapshot);
+	(ct_model)->current_snapshot = NULL;
+
+	//after handling the signal we return to sigsetjmp function (we will enter in the "if" where sigsetjmp is located)
+    siglongjmp((ct_model)->jump_point, CT_SIGNAL_JUMP_CODE);
+}
+/*
+ * stress.c
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: koldar
+ */
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <pthread.h>
+#include <time.h>
+
+
+
+
+
+
+
+/**
+ * What every thread of a stress test needs to know
+ */
+struct ct_stress_thread {
+	ct_stress_c function;
+	int thread_id;
+	long iterations;
+	pthread_barrier_t* barrier;
+	/**
+	 * The scheduler serializing the thread. @null if the thread runs in parallel with the others
+	 */
+	struct ct_scheduler* scheduler;
+	/**
+	 * A uniform sample of the latencies of the iterations the thread has completed, of at most ::CT_STRESS_LATENCY_SAMPLES cells
+	 */
+	long* latencies;
+	/**
+	 * The state of the generator choosing which latencies stay in struct ct_stress_thread::latencies
+	 */
+	unsigned long long random_state;
+	long max_latency;
+	long completed_iterations;
+	struct timespec start_time;
+	struct timespec end_time;
+};
+
+/**
+ * A latency kept by a thread of a stress test, standing for the iterations of the thread which have not been kept as well
+ */
+struct ct_weighted_latency {
+	long latency;
+	/**
+	 * The number of iterations the latency represents
+	 */
+	double weight;
+};
+
+static struct ct_stress_report* ct_run_stress_threads(struct ct_model* model, ct_stress_c function, int threads_number, long iterations, struct ct_scheduler* scheduler);
+static void ct_set_stress_report(struct ct_model* model, struct ct_stress_report* report);
+static void* ct_stress_thread_main(void* arg);
+static void ct_stress_thread_end(void* arg);
+static void ct_keep_latency(struct ct_stress_thread* thread, long iteration, long latency);
+static int ct_compare_latencies(const void* a, const void* b);
+static long ct_latency_percentile(const struct ct_weighted_latency* sorted_latencies, long size, double total_weight, double percentile);
+
+void ct_run_stress(struct ct_model* model, ct_stress_c function, int threads_number, long iterations) {
+	struct ct_stress_report* report;
+
+	if (threads_number <= 0 || iterations <= 0) {
+		fprintf(stderr, "CrashC - a stress test needs a positive number of threads and of iterations, not %d and %ld\n", threads_number, iterations);
+		model->current_snapshot->status = CT_SNAPSHOT_FAILED;
+		return;
+	}
+	if (model->schedule_replay_seed >= 0) {
+		ct_run_stress_schedule(model, function, threads_number, iterations, model->schedule_replay_seed);
+		return;
+	}
+	if (model->schedule_seeds <= 0) {
+		report = ct_run_stress_threads(model, function, threads_number, iterations, NULL);
+		ct_set_stress_report(model, report);
+		return;
+	}
+
+	long failed_schedules;
+	long failed_seed = ct_explore_schedules(model, function, threads_number, iterations, &failed_schedules);
+	//the replay puts in the report the assertions of the failing interleaving
+	ct_run_stress_schedule(model, function, threads_number, iterations, (failed_seed >= 0) ? failed_seed : 0);
+	model->current_snapshot->stress->explored_schedules = model->schedule_seeds;
+	model->current_snapshot->stress->failed_schedules = failed_schedules;
+}
+
+bool ct_run_stress_schedule(struct ct_model* model, ct_stress_c function, int threads_number, long iterations, long seed) {
+	struct ct_scheduler* scheduler;
+
+	ct_allocation_tracker_pause();
+	scheduler = ct_init_scheduler(threads_number, seed);
+	ct_allocation_tracker_resume();
+
+	struct ct_stress_report* report = ct_run_stress_threads(model, function, threads_number, iterations, scheduler);
+	report->schedule_seed = seed;
+	ct_set_stress_report(model, report);
+
+	ct_allocation_tracker_pause();
+	ct_destroy_scheduler(scheduler);
+	ct_allocation_tracker_resume();
+
+	return !ct_thread_reports_have_failed(model);
+}
+
+void ct_destroy_stress_report(struct ct_stress_report* report) {
+	free(report->threads);
+	free(report);
+}
+
+/**
+ * Spawns the threads of a stress test, waits for them and computes the measurements
+ *
+ * @param[inout] model the model to handle
+ * @param[in] function the function every thread runs at every iteration
+ * @param[in] threads_number the number of threads to spawn
+ * @param[in] iterations the number of times each thread calls \c function
+ * @param[inout] scheduler the scheduler serializing the threads. @null to run them in parallel
+ * @return the measurements of the stress test
+ */
+static struct ct_stress_report* ct_run_stress_threads(struct ct_model* model, ct_stress_c function, int threads_number, long iterations, struct ct_scheduler* scheduler) {
+	pthread_barrier_t barrier;
+	long kept_latencies = (iterations < CT_STRESS_LATENCY_SAMPLES) ? iterations : CT_STRESS_LATENCY_SAMPLES;
+
+	ct_allocation_tracker_pause();
+	struct ct_stress_thread* threads = malloc(sizeof(struct ct_stress_thread) * threads_number);
+	pthread_t* thread_ids = malloc(sizeof(pthread_t) * threads_number);
+	long* latencies = malloc(sizeof(long) * threads_number * kept_latencies);
+	struct ct_weighted_latency* distribution = malloc(sizeof(struct ct_weighted_latency) * threads_number * kept_latencies);
+	struct ct_stress_report* report = malloc(sizeof(struct ct_stress_report));
+	if (report != NULL) {
+		report->threads = malloc(sizeof(struct ct_stress_thread_report) * threads_number);
+	}
+	ct_allocation_tracker_resume();
+	if (threads == NULL || thread_ids == NULL || latencies == NULL || distribution == NULL || report == NULL || report->threads == NULL) {
+		CT_MALLOC_ERROR_CALLBACK();
+	}
+
+	pthread_barrier_init(&barrier, NULL, threads_number);
+	for (int i = 0; i < threads_number; i++) {
+		threads[i].function = function;
+		threads[i].thread_id = i;
+		threads[i].iterations = iterations;
+		threads[i].barrier = &barrier;
+		threads[i].scheduler = scheduler;
+		threads[i].latencies = &latencies[i * kept_latencies];
+		threads[i].random_state = ((unsigned long long) i + 1) * 0x9E3779B97F4A7C15ULL;
+		threads[i].max_latency = 0;
+		threads[i].completed_iterations = 0;
+	}
+	for (int i = 0; i < threads_number; i++) {
+		if (pthread_create(&thread_ids[i], NULL, ct_stress_thread_main, &threads[i]) != 0) {
+			fprintf(stderr, "CrashC - cannot create the thread %d of a stress test\n", i);
+			exit(1);
+		}
+	}
+	if (scheduler != NULL) {
+		ct_scheduler_start(scheduler);
+	}
+	for (int i = 0; i < threads_number; i++) {
+		pthread_join(thread_ids[i], NULL);
+	}
+	pthread_barrier_destroy(&barrier);
+
+	//gather the latencies of every thread in a single distribution, where each kept latency stands for the iterations of its thread
+	long total_latencies = 0;
+	double total_weight = 0;
+	report->threads_number = threads_number;
+	report->iterations = iterations;
+	report->max_latency = 0;
+	report->schedule_seed = -1;
+	report->explored_schedules = 0;
+	report->failed_schedules = 0;
+	for (int i = 0; i < threads_number; i++) {
+		struct ct_stress_thread_report* thread_report = &report->threads[i];
+		long kept = (threads[i].completed_iterations < kept_latencies) ? threads[i].completed_iterations : kept_latencies;
+
+		thread_report->completed_iterations = threads[i].completed_iterations;
+		thread_report->elapsed_time = ct_compute_time_gap(threads[i].start_time, threads[i].end_time, "n");
+		thread_report->throughput = (thread_report->elapsed_time > 0) ? (thread_report->completed_iterations * 1e9) / thread_report->elapsed_time : 0;
+		thread_report->max_latency = threads[i].max_latency;
+		for (long j = 0; j < kept; j++) {
+			distribution[total_latencies].latency = threads[i].latencies[j];
+			distribution[total_latencies].weight = ((double) threads[i].completed_iterations) / kept;
+			total_latencies += 1;
+		}
+		total_weight += threads[i].completed_iterations;
+		if (thread_report->max_latency > report->max_latency) {
+			report->max_latency = thread_report->max_latency;
+		}
+	}
+	qsort(distribution, total_latencies, sizeof(struct ct_weighted_latency), ct_compare_latencies);
+	report->latency_p50 = ct_latency_percentile(distribution, total_latencies, total_weight, 0.5);
+	report->latency_p99 = ct_latency_percentile(distribution, total_latencies, total_weight, 0.99);
+	report->latency_p999 = ct_latency_percentile(distribution, total_latencies, total_weight, 0.999);
+
+	ct_allocation_tracker_pause();
+	free(distribution);
+	free(latencies);
+	free(thread_ids);
+	free(threads);
+	ct_allocation_tracker_resume();
+
+	return report;
+}
+
+/**
+ * Stores the measurements of a stress test in struct ct_model::current_snapshot, replacing the previous ones
+ *
+ * @param[inout] model the model to handle
+ * @param[in] report the measurements to store
+ */
+static void ct_set_stress_report(struct ct_model* model, struct ct_stress_report* report) {
+	ct_allocation_tracker_pause();
+	if (model->current_snapshot->stress != NULL) {
+		ct_destroy_stress_report(model->current_snapshot->stress);
+	}
+	model->current_snapshot->stress = report;
+	ct_allocation_tracker_resume();
+}
+
+static void* ct_stress_thread_main(void* arg) {
+	struct ct_stress_thread* thread = arg;
+	struct ct_thread_context* context = ct_get_thread_context();
+	struct timespec iteration_start;
+	struct timespec iteration_end;
+
+	if (thread->scheduler != NULL) {
+		ct_scheduler_thread_start(thread->scheduler, thread->thread_id);
+	} else {
+		pthread_barrier_wait(thread->barrier);
+	}
+
+	//if an assertion fails, the thread is terminated: the cleanup handler still records when the thread stopped
+	pthread_cleanup_push(ct_stress_thread_end, thread);
+	thread->start_time = ct_get_time();
+	//a fatal signal jumps back here instead of where the thread has been started, so that the cleanup handler is run as well
+	bool signaled = false;
+	if (context != NULL) {
+		if (sigsetjmp(context->jump_point, 1)) {
+			signaled = true;
+		}
+	}
+	for (long i = 0; !signaled && i < thread->iterations; i++) {
+		iteration_start = ct_get_time();
+		thread->function(thread->thread_id, i);
+		iteration_end = ct_get_time();
+		ct_keep_latency(thread, i, ct_compute_time_gap(iteration_start, iteration_end, "n"));
+		thread->completed_iterations = i + 1;
+		ct_yield();
+	}
+	pthread_cleanup_pop(1);
+
+	return NULL;
+}
+
+static void ct_stress_thread_end(void* arg) {
+	struct ct_stress_thread* thread = arg;
+	thread->end_time = ct_get_time();
+	if (thread->scheduler != NULL) {
+		ct_scheduler_thread_end(thread->scheduler);
+	}
+}
+
+/**
+ * Records the latency of an iteration of a thread, keeping a uniform sample of at most ::CT_STRESS_LATENCY_SAMPLES latencies
+ *
+ * @param[inout] thread the thread which has completed the iteration
+ * @param[in] iteration the index of the iteration, starting from 0
+ * @param[in] latency the latency, in nanoseconds, of the iteration
+ */
+static void ct_keep_latency(struct ct_stress_thread* thread, long iteration, long latency) {
+	if (latency > thread->max_latency) {
+		thread->max_latency = latency;
+	}
+	if (iteration < CT_STRESS_LATENCY_SAMPLES) {
+		thread->latencies[iteration] = latency;
+		return;
+	}
+
+	//the iteration replaces a kept latency with probability CT_STRESS_LATENCY_SAMPLES / (iteration + 1)
+	thread->random_state ^= thread->random_state >> 12;
+	thread->random_state ^= thread->random_state << 25;
+	thread->random_state ^= thread->random_state >> 27;
+	unsigned long long random = thread->random_state * 0x2545F4914F6CDD1DULL;
+	unsigned long long replaced = (random >> 11) % ((unsigned long long) iteration + 1);
+	if (replaced < CT_STRESS_LATENCY_SAMPLES) {
+		thread->latencies[replaced] = latency;
+	}
+}
+
+static int ct_compare_latencies(const void* a, const void* b) {
+	long latency_a = ((const struct ct_weighted_latency*) a)->latency;
+	long latency_b = ((const struct ct_weighted_latency*) b)->latency;
+	return (latency_a > latency_b) - (latency_a < latency_b);
+}
+
+/**
+ * Computes a percentile of a weighted distribution with the nearest rank method
+ *
+ * @param[in] sorted_latencies the distribution, sorted in ascending order of latency
+ * @param[in] size the number of values within \c sorted_latencies
+ * @param[in] total_weight the sum of the weights of \c sorted_latencies
+ * @param[in] percentile the percentile to compute, between 0 and 1
+ * @return the requested percentile or 0 if the distribution is empty
+ */
+static long ct_latency_percentile(const struct ct_weighted_latency* sorted_latencies, long size, double total_weight, double percentile) {
+	if (size == 0) {
+		return 0;
+	}
+	double rank = percentile * total_weight;
+	double cumulative_weight = 0;
+	for (long i = 0; i < size; i++) {
+		cumulative_weight += sorted_latencies[i].weight;
+		//the tolerance absorbs the rounding of weights which are not integer
+		if (cumulative_weight >= rank - 1e-9) {
+			return sorted_latencies[i].latency;
+		}
+	}
+	return sorted_latencies[size - 1].latency;
+}
+/*
+ * suite_order.c
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: koldar
+ */
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+
+
+
+
+
+
+
+
+bool ct_parse_suite_order(const char* name, enum ct_suite_order* order) {
+	if (strcmp(name, "declaration") == 0) {
+		*order = CT_ORDER_DECLARATION;
+	} else if (strcmp(name, "durations") == 0) {
+		*order = CT_ORDER_DURATION;
+	} else if (strcmp(name, "failures") == 0) {
+		*order = CT_ORDER_FAILURES;
+	} else {
+		return false;
+	}
+	return true;
+}
+
+/**
+ * Computes how early a @testsuite needs to be run
+ *
+ * @param[in] model the model to handle
+ * @param[in] suite the index of the @testsuite in struct ct_model::tests_array
+ * @return the priority of the @testsuite: the higher, the earlier. Negative if the @testsuite is not in the history file
+ */
+static double ct_get_suite_priority(const struct ct_model* model, int suite) {
+	const struct ct_suite_timing* timing = ct_progress_get_suite_history(model->progress, model->suites_names[suite]);
+
+	if (timing == NULL) {
+		return -1;
+	}
+	if (model->suite_order == CT_ORDER_DURATION) {
+		return timing->total_time;
+	}
+	return (timing->tests > 0) ? (double) timing->failed_tests / timing->tests : 0;
+}
+
+void ct_order_suites(struct ct_model* model) {
+	//a worker receives the order from its coordinator (see distribution.h)
+	if (model->suite_order == CT_ORDER_DECLARATION || model->worker_address != NULL) {
+		return;
+	}
+	if (model->progress == NULL) {
+		fprintf(stderr, "CrashC - the order of the test suites needs a history file: they will be run in registration order\n");
+		return;
+	}
+
+	double priorities[MAX_TESTS];
+	for (int i = 0; i < model->suites_array_index; i++) {
+		priorities[i] = ct_get_suite_priority(model, i);
+	}
+
+	//an insertion sort keeps the registration order among equal priorities; the test suites are few
+	for (int i = 1; i < model->suites_array_index; i++) {
+		int suite = model->suites_order[i];
+		double priority = priorities[suite];
+		bool unknown = priority < 0;
+		int j = i - 1;
+		while (j >= 0) {
+			double other = priorities[model->suites_order[j]];
+			bool precedes = unknown ? other >= 0 : other >= 0 && other < priority;
+			if (!precedes) {
+				break;
+			}
+			model->suites_order[j + 1] = model->suites_order[j];
+			j -= 1;
+		}
+		model->suites_order[j + 1] = suite;
+	}
+}
+
+/**
+ * A test and its position in the execution order
+ */
+struct ct_ordered_report {
+	struct ct_test_report* report;
+	int position;
+};
+
+static int ct_compare_ordered_reports(const void* a, const void* b) {
+	const struct ct_ordered_report* first = a;
+	const struct ct_ordered_report* second = b;
+
+	if (first->report->repetition != second->report->repetition) {
+		return first->report->repetition - second->report->repetition;
+	}
+	if (first->report->suite != second->report->suite) {
+		return first->report->suite - second->report->suite;
+	}
+	return first->position - second->position;
+}
+
+void ct_restore_declaration_order(struct ct_model* model) {
+	int reports_number = ct_list_size(model->test_reports_list);
+	if (model->suite_order == CT_ORDER_DECLARATION || reports_number < 2) {
+		return;
+	}
+
+	struct ct_ordered_report* reports = malloc(sizeof(struct ct_ordered_report) * reports_number);
+	if (reports == NULL) {
+		CT_MALLOC_ERROR_CALLBACK();
+	}
+	for (int i = 0; i < reports_number; i++) {
+		reports[i] = (struct ct_ordered_report) { ct_list_pop(model->test_reports_list), i };
+	}
+	qsort(reports, reports_number, sizeof(struct ct_ordered_report), ct_compare_ordered_reports);
+	for (int i = 0; i < reports_number; i++) {
+		ct_list_add_tail(model->test_reports_list, reports[i].report);
+	}
+	free(reports);
+}
+/*
+ * tag.c
+ *
+ *  Created on: Feb 16, 2017
+ *      Author: koldar
+ */
+
+#include <stdlib.h>
+#include <string.h>
+
+
+
+
+
+struct ct_tag* ct_tag_init(const char* name) {
+	struct ct_tag* ret_val = malloc(sizeof(struct ct_tag));
+	if (ret_val == NULL) {
+		CT_MALLOC_ERROR_CALLBACK();
+	}
+
+	ret_val->name = strdup(name);
+
+	return ret_val;
+}
+
+void ct_tag_destroy(struct ct_tag* tag) {
+	free(tag->name);
+	free(tag);
+}
+
+int ct_tag_compare(const struct ct_tag* tag1, const struct ct_tag* tag2) {
+	if (tag1 == tag2) {
+		return 0;
+	}
+	//TODO perform comparation(if the user wants it) with case insensitive as well!
+	return strcmp(tag1->name, tag2->name);
+}
+
+bool ct_have_tag_set_intersection(const ct_tag_hashtable_o* tag_set1, const ct_tag_hashtable_o* tag_set2) {
+	//TODO optimization: pick up the set with the least number of elements first. In this way the outer loop will be executed less
+
+	CT_ITERATE_VALUES_ON_HT(tag_set1, tag1, struct ct_tag*) {
+		CT_ITERATE_VALUES_ON_HT(tag_set2, tag2, struct ct_tag*) {
+			if (ct_tag_compare(tag1, tag2) == 0) {
+				return true;
+			}
+		}
+	}
+
+	return false;
+}
+
+void ct_tag_ht_put(ct_tag_hashtable_o* tag_hashtable, const char* name) {
+	//TODO to improve performances you don't need to create a tag every time you see a name, There should be a tag pool containing
+	//all the tags in the project. In this way, tag with the same name are created only once
+	ct_ht_put(tag_hashtable, ct_string_hash(name), ct_tag_init(name));
+}
+
+int ct_string_hash(const char* str) {
+	unsigned int hash = 5381;
+	int c;
+
+	while ((c = *str++))
+		hash = ((hash << 5) + hash) + c; /* hash * 33 + c */
+	return hash;
+}
+
+const char* ct_next_tag_in_string(const char* const str, char separator, char* characters_to_ignore, char* output) {
+	char* output_index = output;
+	const char* input = str;
+
+	//I don't use strtok because I don't want to use something with side effects
+	while (*input != separator && *input != '\0') {
+		//ignored characters are not copied in output
+		if (strchr(characters_to_ignore, *input) == NULL) {
+			*output_index = *input;
+			output_index += 1;
+		}
+		input += 1;
+	}
+	*output_index = '\0';
+
+	if (*input != '\0') {
+		input++;
+	}
+	return input;
+}
+
+bool ct_tag_ht_populate(ct_tag_hashtable_o* output, const char* const tags, char separator) {
+	bool ret_val = true;
+	//a token can't be longer than the whole string
+	char* token = malloc(strlen(tags) + 1);
+	if (token == NULL) {
+		CT_MALLOC_ERROR_CALLBACK();
+	}
+
+	const char* token_string = tags;
+	while (*token_string != '\0') {
+		const char* next_token_string = ct_next_tag_in_string(token_string, separator, "", token);
+
+		if (strlen(token) == 0) {
+			//2 consecutive separators or a separator at the beginning or at the end of the string
+			ret_val = false;
+		} else {
+			//add the fetched tag inside the section
+			int token_id = ct_string_hash(token);
+			struct ct_tag* tag_with_token_id = ct_ht_get(output, token_id);
+			if (tag_with_token_id == NULL) {
+				tag_with_token_id = ct_tag_init(token);
+				ct_ht_put(output, token_id, tag_with_token_id);
+			}
+		}
+
+		//a separator at the end of the string generates an empty tag as well
+		if (*next_token_string == '\0' && next_token_string[-1] == separator) {
+			ret_val = false;
+		}
+		token_string = next_token_string;
+	}
+
+	free(token);
+	return ret_val;
+}
+
+bool ct_tag_ht_get_number(const ct_tag_hashtable_o* tags, const char* key, long* value) {
+	size_t key_length = strlen(key);
+
+	CT_ITERATE_VALUES_ON_HT(tags, tag, struct ct_tag*) {
+		const char* name = (tag->name[0] == '[') ? tag->name + 1 : tag->name;
+		if (strncmp(name, key, key_length) != 0 || name[key_length] != ':') {
+			continue;
+		}
+
+		const char* number = name + key_length + 1;
+		char* end = NULL;
+		long parsed = strtol(number, &end, 10);
+		bool closed = (name == tag->name) ? (*end == '\0') : (end[0] == ']' && end[1] == '\0');
+		if (end != number && closed) {
+			*value = parsed;
+			return true;
+		}
+	}
+
+	return false;
+}
+/**
+ * This file contains the function used by CrashC to generate and handle the test reports
+ * TODO: Fix strdup unsafe call, add dimension limit to avoid overflows
+ *
+ * Author: Lorenzo Nodari
+ *
+ */
+
+#include <string.h>
+
+
+
+
+
+struct ct_test_report* ct_init_test_report(struct ct_snapshot* tc_snapshot) {
+	struct ct_test_report* ret_val = malloc(sizeof(struct ct_test_report));
+	if (ret_val == NULL) {
+		CT_MALLOC_ERROR_CALLBACK();
+	}
+
+	ret_val->filename = NULL;
+	ret_val->execution_time = 0;
+	ret_val->outcome = CT_TEST_SUCCESS;
+	ret_val->testcase_snapshot = tc_snapshot;
+	ret_val->fuzz_input = NULL;
+	ret_val->repetition = 0;
+	ret_val->suite = 0;
+	ret_val->next_repetition = NULL;
+	ret_val->flakiness = NULL;
+	ret_val->output = NULL;
+
+	return ret_val;
+}
+
+void ct_destroy_test_report(struct ct_test_report* report) {
+	free(report->filename);
+	free(report->fuzz_input);
+	free(report->flakiness);
+	free(report->output);
+	ct_destroy_snapshot_tree(report->testcase_snapshot);
+	free(report);
+
+}
+
+struct ct_snapshot* ct_init_section_snapshot(struct ct_section* section) {
+	struct ct_snapshot* ret_val = malloc(sizeof(struct ct_snapshot));
+	if (ret_val == NULL) {
+		CT_MALLOC_ERROR_CALLBACK();
+	}
+
+	ret_val->description   = strdup(section->description);
+	ret_val->tags          = section->tags;
+	ret_val->type          = section->type;
+	ret_val->status        = CT_SNAPSHOT_OK;
+	ret_val->elapsed_time  = 0;
+	ret_val->signal_detected = 0;
+	ret_val->signal_code = 0;
+	ret_val->signal_address = NULL;
+	ret_val->backtrace = NULL;
+	ret_val->backtrace_size = 0;
+	ret_val->allocations = 0;
+	ret_val->allocated_bytes = 0;
+	ret_val->frees = 0;
+	ret_val->leaked_blocks = 0;
+	ret_val->leaked_bytes = 0;
+	memset(&ret_val->start_time, 0, sizeof(struct timespec));
+	memset(&ret_val->resource_usage, 0, sizeof(struct ct_resource_usage));
+	ret_val->measurements_taken = false;
+	ret_val->hardware_counters.instructions = CT_HARDWARE_COUNTER_UNAVAILABLE;
+	ret_val->hardware_counters.cycles = CT_HARDWARE_COUNTER_UNAVAILABLE;
+	ret_val->hardware_counters.cache_misses = CT_HARDWARE_COUNTER_UNAVAILABLE;
+	ret_val->hardware_counters.branch_misses = CT_HARDWARE_COUNTER_UNAVAILABLE;
+	ret_val->stress = NULL;
+	ret_val->benchmark = NULL;
+	ret_val->assertion_reports = ct_list_init();
+	ret_val->parent = NULL;
+	ret_val->next_sibling = NULL;
+	ret_val->first_child = NULL;
+
+	return ret_val;
+}
+
+void ct_destroy_snapshot_tree(struct ct_snapshot* snapshot) {
+	free(snapshot->description);
+	free(snapshot->backtrace);
+	if (snapshot->stress != NULL) {
+		ct_destroy_stress_report(snapshot->stress);
+	}
+	if (snapshot->benchmark != NULL) {
+		ct_destroy_benchmark_report(snapshot->benchmark);
+	}
+	ct_list_destroy_with_elements(snapshot->assertion_reports, (ct_destroyer_c) ct_destroy_assert_report);
+
+	struct ct_snapshot* next_child = snapshot->first_child;
+	while (next_child != NULL) {
+		struct ct_snapshot* tmp = next_child->next_sibling;
+		ct_destroy_snapshot_tree(next_child);
+		next_child = tmp;
+	}
+
+	free(snapshot);
+}
+
+struct ct_snapshot* ct_add_snapshot_to_tree(struct ct_snapshot* to_add, struct ct_snapshot* tree) {
+	to_add->parent = tree;
+
+	struct ct_snapshot* tmp = tree->first_child;
+	if (tmp == NULL) {
+			tree->first_child = to_add;
+			return to_add;
+	}
+	while (true) {
+		if (tmp->next_sibling != NULL) {
+			tmp = tmp->next_sibling;
+		}
+		else {
+			tmp->next_sibling = to_add;
+			return to_add;
+		}
+	}
+}
+
+void ct_snapshot_set_backtrace(struct ct_snapshot* snapshot, void* const* frames, int frames_number) {
+	free(snapshot->backtrace);
+	snapshot->backtrace = NULL;
+	snapshot->backtrace_size = 0;
+
+	if (frames_number <= 0) {
+		return;
+	}
+
+	snapshot->backtrace = malloc(sizeof(void*) * frames_number);
+	if (snapshot->backtrace == NULL) {
+		CT_MALLOC_ERROR_CALLBACK();
+	}
+	memcpy(snapshot->backtrace, frames, sizeof(void*) * frames_number);
+	snapshot->backtrace_size = frames_number;
+}
+
+void ct_update_snapshot_status(struct ct_section* section, struct ct_snapshot* snapshot) {
+	if (section->status == CT_SECTION_SIGNAL_DETECTED) {
+		snapshot->status = CT_SNAPSHOT_SIGNALED;
+	}
+}
+
+void ct_update_test_outcome(struct ct_test_report* report, struct ct_snapshot* last_snapshot) {
+	if (last_snapshot->status != CT_SNAPSHOT_OK) {
+		report->testcase_snapshot->status = last_snapshot->status;
+		report->outcome = CT_TEST_FAILURE;
+	}
+}
+
+
+/*
+ * thread_context.c
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: koldar
+ */
+
+#include <stdlib.h>
+#include <pthread.h>
+
+
+
+
+
+
+
+
+
+
+/*
+ * The actual pthread_create. It's defined by the linker only when the executable is linked with --wrap=pthread_create:
+ * otherwise it's a weak undefined symbol and its address is NULL
+ */
+extern int __real_pthread_create(pthread_t* thread, const pthread_attr_t* attr, void* (*start)(void*), void* arg) __attribute__((weak));
+
+/**
+ * The context of the calling thread. @null on the main thread and on the threads not spawned via ::__wrap_pthread_create
+ */
+static _Thread_local struct ct_thread_context* ct_thread_context = NULL;
+
+static void* ct_thread_main(void* arg);
+static void ct_release_thread_context(void* arg);
+
+bool ct_is_main_thread(const struct ct_model* model) {
+	return pthread_equal(pthread_self(), model->main_thread);
+}
+
+struct ct_thread_context* ct_get_thread_context() {
+	return ct_thread_context;
+}
+
+struct ct_snapshot* ct_get_thread_snapshot(const struct ct_model* model) {
+	if (ct_thread_context != NULL) {
+		return ct_thread_context->snapshot;
+	}
+	return ct_is_main_thread(model) ? model->current_snapshot : NULL;
+}
+
+int __wrap_pthread_create(pthread_t* thread, const pthread_attr_t* attr, void* (*start)(void*), void* arg) {
+	if (ct_model == NULL) {
+		return __real_pthread_create(thread, attr, start, arg);
+	}
+
+	//the context and its stack are allocated by the spawning thread, so that the new thread has them before running anything
+	ct_allocation_tracker_pause();
+	struct ct_thread_context* context = malloc(sizeof(struct ct_thread_context));
+	void* signal_stack = malloc(CT_SIGNAL_STACK_SIZE);
+	ct_allocation_tracker_resume();
+	if (context == NULL || signal_stack == NULL) {
+		CT_MALLOC_ERROR_CALLBACK();
+	}
+
+	context->start = start;
+	context->arg = arg;
+	context->snapshot = ct_get_thread_snapshot(ct_model);
+	context->signal_stack = (stack_t) { .ss_sp = signal_stack, .ss_size = CT_SIGNAL_STACK_SIZE, .ss_flags = 0 };
+
+	int ret_val = __real_pthread_create(thread, attr, ct_thread_main, context);
+	if (ret_val != 0) {
+		ct_release_thread_context(context);
+	}
+	return ret_val;
+}
+
+void ct_thread_jump_back(int code) {
+	if (ct_thread_context != NULL) {
+		siglongjmp(ct_thread_context->jump_point, code);
+	}
+}
+
+struct ct_thread_assert_report* ct_init_thread_assert_report(struct ct_assert_report* report) {
+	struct ct_thread_assert_report* ret_val = malloc(sizeof(struct ct_thread_assert_report));
+	if (ret_val == NULL) {
+		CT_MALLOC_ERROR_CALLBACK();
+	}
+
+	ret_val->report = report;
+	ret_val->next = NULL;
+
+	return ret_val;
+}
+
+void ct_publish_thread_assert_report(struct ct_model* model, struct ct_thread_assert_report* cell) {
+	cell->next = __atomic_load_n(&model->thread_assert_reports, __ATOMIC_RELAXED);
+	while (!__atomic_compare_exchange_n(&model->thread_assert_reports, &cell->next, cell, true, __ATOMIC_RELEASE, __ATOMIC_RELAXED)) {
+		//cell->next has been updated with the new top of the stack: just try again
+	}
+}
+
+void ct_record_thread_signal(struct ct_model* model, int signum, const siginfo_t* info) {
+	int no_signal = 0;
+
+	//-1 tells other threads the signal information is being written
+	if (!__atomic_compare_exchange_n(&model->thread_signal_detected, &no_signal, -1, false, __ATOMIC_ACQUIRE, __ATOMIC_RELAXED)) {
+		return;
+	}
+	model->thread_signal_code = info->si_code;
+	model->thread_signal_address = info->si_addr;
+	__atomic_store_n(&model->thread_signal_detected, signum, __ATOMIC_RELEASE);
+}
+
+bool ct_thread_reports_have_failed(const struct ct_model* model) {
+	if (__atomic_load_n(&model->thread_signal_detected, __ATOMIC_ACQUIRE) != 0) {
+		return true;
+	}
+
+	struct ct_thread_assert_report* cell = __atomic_load_n(&model->thread_assert_reports, __ATOMIC_ACQUIRE);
+	while (cell != NULL) {
+		if (cell->report->is_mandatory && !cell->report->passed) {
+			return true;
+		}
+		cell = cell->next;
+	}
+	return false;
+}
+
+void ct_merge_thread_reports(struct ct_model* model, struct ct_snapshot* snapshot) {
+	struct ct_thread_assert_report* cell = __atomic_exchange_n(&model->thread_assert_reports, NULL, __ATOMIC_ACQUIRE);
+	struct ct_thread_assert_report* chronological = NULL;
+	bool failed = false;
+
+	//the stack has the most recent assertion on top: we reverse it to keep the order in which assertions have been published
+	while (cell != NULL) {
+		struct ct_thread_assert_report* next = cell->next;
+		cell->next = chronological;
+		chronological = cell;
+		cell = next;
+	}
+
+	ct_allocation_tracker_pause();
+	while (chronological != NULL) {
+		struct ct_thread_assert_report* next = chronological->next;
+		if (snapshot != NULL) {
+			failed = failed || (chronological->report->is_mandatory && !chronological->report->passed);
+			ct_list_add_tail(snapshot->assertion_reports, chronological->report);
+			if (!chronological->report->passed && CT_HAS_LISTENERS(model, CT_EVENT_ASSERT_FAIL)) {
+				ct_dispatch_assert_fail(model, chronological->report);
+			}
+		} else {
+			ct_destroy_assert_report(chronological->report);
+		}
+		free(chronological);
+		chronological = next;
+	}
+	ct_allocation_tracker_resume();
+
+	int signum = __atomic_load_n(&model->thread_signal_detected, __ATOMIC_ACQUIRE);
+	if (signum > 0) {
+		if (snapshot != NULL) {
+			snapshot->status = CT_SNAPSHOT_SIGNALED;
+			snapshot->signal_detected = signum;
+			snapshot->signal_code = model->thread_signal_code;
+			snapshot->signal_address = model->thread_signal_address;
+		}
+		__atomic_store_n(&model->thread_signal_detected, 0, __ATOMIC_RELEASE);
+	}
+
+	if (snapshot == NULL) {
+		return;
+	}
+	if (failed && snapshot->status == CT_SNAPSHOT_OK) {
+		snapshot->status = CT_SNAPSHOT_FAILED;
+	}
+	if (snapshot->status != CT_SNAPSHOT_OK) {
+		ct_update_test_outcome(ct_list_tail(model->test_reports_list), snapshot);
+	}
+}
+
+/**
+ * Runs a worker thread spawned via ::__wrap_pthread_create
+ *
+ * @param[in] arg the struct ct_thread_context of the thread
+ * @return what struct ct_thread_context::start returns, or @null if the thread has raised a fatal signal
+ */
+static void* ct_thread_main(void* arg) {
+	struct ct_thread_context* context = arg;
+	void* ret_val = NULL;
+
+	ct_thread_context = context;
+	//every thread needs its own alternate stack: otherwise a stack overflow on this thread can't be handled
+	sigaltstack(&context->signal_stack, NULL);
+	//the context is released even if the thread calls pthread_exit, like a failed assertion does
+	pthread_cleanup_push(ct_release_thread_context, context);
+	if (sigsetjmp(context->jump_point, 1) == 0) {
+		ret_val = context->start(context->arg);
+	}
+	pthread_cleanup_pop(1);
+
+	return ret_val;
+}
+
+/**
+ * Releases from memory the context of a worker thread
+ *
+ * If the context belongs to the calling thread, the thread stops using its alternate signal stack as well.
+ *
+ * @param[inout] arg the struct ct_thread_context to dispose of
+ */
+static void ct_release_thread_context(void* arg) {
+	struct ct_thread_context* context = arg;
+
+	if (ct_thread_context == context) {
+		stack_t disabled_stack = { .ss_sp = NULL, .ss_size = 0, .ss_flags = SS_DISABLE };
+		sigaltstack(&disabled_stack, NULL);
+		ct_thread_context = NULL;
+	}
+	ct_allocation_tracker_pause();
+	free(context->signal_stack.ss_sp);
+	free(context);
+	ct_allocation_tracker_resume();
+}
+/*
+ * ct_utils.c
+ *
+ *  Created on: Oct 31, 2017
+ *      Author: noodles
+ */
+
+
+
+enum time_format {
+	TF_NANO    = 0,
+	TF_MICRO   = 1,
+	TF_MILLI   = 2,
+	TF_SECONDS = 3
+};
+
+static enum time_format parse_time_format(const char* str);
+
+char* const ct_file_basename(char* const filename) {
+	int i = 0;
+	int last_slash_index = 0;
+	char c = filename[0];
+
+	while (c != '\0') {
+		if (c == '/') {
+			last_slash_index = i;
+		}
+
+		i++;
+		c = filename[i];
+	}
+
+	return filename + (last_slash_index + 1);
+}
+
+struct timespec ct_get_time() {
+	struct timespec ret_val;
+	clock_gettime(CLOCK_MONOTONIC, &ret_val);
+	return ret_val;
+}
+
+static enum time_format parse_time_format(const char* str) {
+	switch (*str) {
+	case 's': return TF_SECONDS;
+	case 'm': return TF_MILLI;
+	case 'u': return TF_MICRO;
+	case 'n': return TF_NANO;
+	}
+}
+
+long ct_compute_time_gap(struct timespec start, struct timespec end, const char* format_str)  {
+	long sec, nano_sec, ret_val;
+	enum time_format format = parse_time_format(format_str);
+
+	sec = end.tv_sec - start.tv_sec;
+	nano_sec = end.tv_nsec - start.tv_nsec;
+
+	ret_val = sec * 1000000000L + nano_sec;
+	for (int i = 0; i < format; i++) {
+		ret_val /= 1000;
+	}
+
+	return ret_val;
+}
+
+#endif /* CRASHC_IMPLEMENTATION */
+#endif /* CRASHC_ALL_IN_ONE_H_ */
@@ -0,0 +1,103 @@
+#!/bin/bash
+
+# Builds a single-header version of CrashC.
+#
+# The headers are always visible, while the sources are compiled only where CRASHC_IMPLEMENTATION is defined.
+# Hence exactly one translation unit of a test program (usually the one with TESTS_START) needs to do:
+#
+#	#define CRASHC_IMPLEMENTATION
+#	#include "crashC.all.in.one.h"
+#
+# while every other translation unit just includes the header.
+
+OUTPUT_FOLDER=$1
+OUTPUT_NAME=$2
+C_FOLDER=$3
+H_FOLDER=$4
+
+echo "output name is ${OUTPUT_NAME}"
+echo "output folder is ${OUTPUT_FOLDER}"
+echo "c source files are in ${C_FOLDER}"
+echo "h header files are in ${H_FOLDER}"
+
+# ***************** SETUP **********************
+
+mkdir -pv ${OUTPUT_FOLDER}
+rm -fv "${OUTPUT_FOLDER}/${OUTPUT_NAME}"
+
+
+# *************** CREATE TMP.C FILE ****************
+
+echo "#ifndef CRASHC_ALL_IN_ONE_H_" >> "${OUTPUT_FOLDER}/${OUTPUT_NAME}"
+echo "#define CRASHC_ALL_IN_ONE_H_" >> "${OUTPUT_FOLDER}/${OUTPUT_NAME}"
+
+#the order is relevant
+cat "${H_FOLDER}/typedefs.h" >> "${OUTPUT_FOLDER}/${OUTPUT_NAME}"
+cat "${H_FOLDER}/uthash.h" >> "${OUTPUT_FOLDER}/${OUTPUT_NAME}"
+cat "${H_FOLDER}/hashtable.h" >> "${OUTPUT_FOLDER}/${OUTPUT_NAME}"
+cat "${H_FOLDER}/list.h" >> "${OUTPUT_FOLDER}/${OUTPUT_NAME}"
+cat "${H_FOLDER}/tag.h" >> "${OUTPUT_FOLDER}/${OUTPUT_NAME}"
+cat "${H_FOLDER}/utils.h" >> "${OUTPUT_FOLDER}/${OUTPUT_NAME}"
+cat "${H_FOLDER}/resource_usage.h" >> "${OUTPUT_FOLDER}/${OUTPUT_NAME}"
+cat "${H_FOLDER}/hardware_counters.h" >> "${OUTPUT_FOLDER}/${OUTPUT_NAME}"
+cat "${H_FOLDER}/stress.h" >> "${OUTPUT_FOLDER}/${OUTPUT_NAME}"
+cat "${H_FOLDER}/benchmark.h" >> "${OUTPUT_FOLDER}/${OUTPUT_NAME}"
+cat "${H_FOLDER}/section.h" >> "${OUTPUT_FOLDER}/${OUTPUT_NAME}"
+cat "${H_FOLDER}/macros.h" >> "${OUTPUT_FOLDER}/${OUTPUT_NAME}"
+cat "${H_FOLDER}/errors.h" >> "${OUTPUT_FOLDER}/${OUTPUT_NAME}"
+cat "${H_FOLDER}/allocation_tracker.h" >> "${OUTPUT_FOLDER}/${OUTPUT_NAME}"
+cat "${H_FOLDER}/thread_context.h" >> "${OUTPUT_FOLDER}/${OUTPUT_NAME}"
+cat "${H_FOLDER}/schedule.h" >> "${OUTPUT_FOLDER}/${OUTPUT_NAME}"
+cat "${H_FOLDER}/fuzz.h" >> "${OUTPUT_FOLDER}/${OUTPUT_NAME}"
+cat "${H_FOLDER}/flaky.h" >> "${OUTPUT_FOLDER}/${OUTPUT_NAME}"
+cat "${H_FOLDER}/binary_report.h" >> "${OUTPUT_FOLDER}/${OUTPUT_NAME}"
+cat "${H_FOLDER}/events.h" >> "${OUTPUT_FOLDER}/${OUTPUT_NAME}"
+cat "${H_FOLDER}/progress.h" >> "${OUTPUT_FOLDER}/${OUTPUT_NAME}"
+cat "${H_FOLDER}/report_serialization.h" >> "${OUTPUT_FOLDER}/${OUTPUT_NAME}"
+cat "${H_FOLDER}/section_fork.h" >> "${OUTPUT_FOLDER}/${OUTPUT_NAME}"
+cat "${H_FOLDER}/output_capture.h" >> "${OUTPUT_FOLDER}/${OUTPUT_NAME}"
+cat "${H_FOLDER}/journal.h" >> "${OUTPUT_FOLDER}/${OUTPUT_NAME}"
+cat "${H_FOLDER}/distribution.h" >> "${OUTPUT_FOLDER}/${OUTPUT_NAME}"
+cat "${H_FOLDER}/coverage.h" >> "${OUTPUT_FOLDER}/${OUTPUT_NAME}"
+cat "${H_FOLDER}/suite_order.h" >> "${OUTPUT_FOLDER}/${OUTPUT_NAME}"
+cat "${H_FOLDER}/main_model.h" >> "${OUTPUT_FOLDER}/${OUTPUT_NAME}"
+cat "${H_FOLDER}/model.h" >> "${OUTPUT_FOLDER}/${OUTPUT_NAME}"
+cat "${H_FOLDER}/command_line.h" >> "${OUTPUT_FOLDER}/${OUTPUT_NAME}"
+cat "${H_FOLDER}/sig_handling.h" >> "${OUTPUT_FOLDER}/${OUTPUT_NAME}"
+cat "${H_FOLDER}/test_report.h" >> "${OUTPUT_FOLDER}/${OUTPUT_NAME}"
+cat "${H_FOLDER}/report_producer.h" >> "${OUTPUT_FOLDER}/${OUTPUT_NAME}"
+cat "${H_FOLDER}/assertions.h" >> "${OUTPUT_FOLDER}/${OUTPUT_NAME}"
+#the inline functions of crashc.h need every structure of the model
+cat "${H_FOLDER}/crashc.h" >> "${OUTPUT_FOLDER}/${OUTPUT_NAME}"
+
+#the order is irrelevant
+
+echo "#ifdef CRASHC_IMPLEMENTATION" >> "${OUTPUT_FOLDER}/${OUTPUT_NAME}"
+
+echo "*****************"
+echo $(ls ${C_FOLDER} | grep "\.c$")
+echo "*****************"
+for f in `ls ${C_FOLDER} | grep "\.c$"`
+do
+	echo "outputting ${f}..."
+	cat "${C_FOLDER}/${f}" >> "${OUTPUT_FOLDER}/${OUTPUT_NAME}"
+done
+
+#cat "${C_FOLDER}/hashtable.c" >> "${OUTPUT_FOLDER}/${OUTPUT_NAME}"
+#cat "${C_FOLDER}/list.c" >> "${OUTPUT_FOLDER}/${OUTPUT_NAME}"
+#cat "${C_FOLDER}/section.c" >> "${OUTPUT_FOLDER}/${OUTPUT_NAME}"
+#cat "${C_FOLDER}/tag.c" >> "${OUTPUT_FOLDER}/${OUTPUT_NAME}"
+#cat "${C_FOLDER}/crashC.c" >> "${OUTPUT_FOLDER}/${OUTPUT_NAME}"
+#cat "${C_FOLDER}/main_model.c" >> "${OUTPUT_FOLDER}/${OUTPUT_NAME}"
+#cat "${C_FOLDER}/model.c" >> "${OUTPUT_FOLDER}/${OUTPUT_NAME}"
+#cat "${C_FOLDER}/command_line.c" >> "${OUTPUT_FOLDER}/${OUTPUT_NAME}"
+#cat "${C_FOLDER}/sigHandling.c" >> "${OUTPUT_FOLDER}/${OUTPUT_NAME}"
+#cat "${C_FOLDER}/testReport.c" >> "${OUTPUT_FOLDER}/${OUTPUT_NAME}"
+
+echo "#endif /* CRASHC_IMPLEMENTATION */" >> "${OUTPUT_FOLDER}/${OUTPUT_NAME}"
+echo "#endif /* CRASHC_ALL_IN_ONE_H_ */" >> "${OUTPUT_FOLDER}/${OUTPUT_NAME}"
+
+#remove all the includes of crashc
+sed -i -e 's/^\s*#include\s*".*"$//g' "${OUTPUT_FOLDER}/${OUTPUT_NAME}"
+
+
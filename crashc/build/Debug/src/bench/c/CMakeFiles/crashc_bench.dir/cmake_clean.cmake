@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../crashc_bench"
+  "../../../crashc_bench.pdb"
+  "CMakeFiles/crashc_bench.dir/crashc_bench.c.o"
+  "CMakeFiles/crashc_bench.dir/crashc_bench.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/crashc_bench.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
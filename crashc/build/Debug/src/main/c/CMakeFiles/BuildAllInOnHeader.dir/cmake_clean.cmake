@@ -0,0 +1,10 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/BuildAllInOnHeader"
+  "allInOneHeader"
+  "copy_resources"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/BuildAllInOnHeader.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,50 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/crashc/src/main/c/allocation_tracker.c" "src/main/c/CMakeFiles/CrashC.dir/allocation_tracker.c.o" "gcc" "src/main/c/CMakeFiles/CrashC.dir/allocation_tracker.c.o.d"
+  "/root/repo/crashc/src/main/c/assertions.c" "src/main/c/CMakeFiles/CrashC.dir/assertions.c.o" "gcc" "src/main/c/CMakeFiles/CrashC.dir/assertions.c.o.d"
+  "/root/repo/crashc/src/main/c/benchmark.c" "src/main/c/CMakeFiles/CrashC.dir/benchmark.c.o" "gcc" "src/main/c/CMakeFiles/CrashC.dir/benchmark.c.o.d"
+  "/root/repo/crashc/src/main/c/binary_report.c" "src/main/c/CMakeFiles/CrashC.dir/binary_report.c.o" "gcc" "src/main/c/CMakeFiles/CrashC.dir/binary_report.c.o.d"
+  "/root/repo/crashc/src/main/c/command_line.c" "src/main/c/CMakeFiles/CrashC.dir/command_line.c.o" "gcc" "src/main/c/CMakeFiles/CrashC.dir/command_line.c.o.d"
+  "/root/repo/crashc/src/main/c/coverage.c" "src/main/c/CMakeFiles/CrashC.dir/coverage.c.o" "gcc" "src/main/c/CMakeFiles/CrashC.dir/coverage.c.o.d"
+  "/root/repo/crashc/src/main/c/crashc.c" "src/main/c/CMakeFiles/CrashC.dir/crashc.c.o" "gcc" "src/main/c/CMakeFiles/CrashC.dir/crashc.c.o.d"
+  "/root/repo/crashc/src/main/c/distribution.c" "src/main/c/CMakeFiles/CrashC.dir/distribution.c.o" "gcc" "src/main/c/CMakeFiles/CrashC.dir/distribution.c.o.d"
+  "/root/repo/crashc/src/main/c/events.c" "src/main/c/CMakeFiles/CrashC.dir/events.c.o" "gcc" "src/main/c/CMakeFiles/CrashC.dir/events.c.o.d"
+  "/root/repo/crashc/src/main/c/flaky.c" "src/main/c/CMakeFiles/CrashC.dir/flaky.c.o" "gcc" "src/main/c/CMakeFiles/CrashC.dir/flaky.c.o.d"
+  "/root/repo/crashc/src/main/c/fuzz.c" "src/main/c/CMakeFiles/CrashC.dir/fuzz.c.o" "gcc" "src/main/c/CMakeFiles/CrashC.dir/fuzz.c.o.d"
+  "/root/repo/crashc/src/main/c/hardware_counters.c" "src/main/c/CMakeFiles/CrashC.dir/hardware_counters.c.o" "gcc" "src/main/c/CMakeFiles/CrashC.dir/hardware_counters.c.o.d"
+  "/root/repo/crashc/src/main/c/hashtable.c" "src/main/c/CMakeFiles/CrashC.dir/hashtable.c.o" "gcc" "src/main/c/CMakeFiles/CrashC.dir/hashtable.c.o.d"
+  "/root/repo/crashc/src/main/c/journal.c" "src/main/c/CMakeFiles/CrashC.dir/journal.c.o" "gcc" "src/main/c/CMakeFiles/CrashC.dir/journal.c.o.d"
+  "/root/repo/crashc/src/main/c/list.c" "src/main/c/CMakeFiles/CrashC.dir/list.c.o" "gcc" "src/main/c/CMakeFiles/CrashC.dir/list.c.o.d"
+  "/root/repo/crashc/src/main/c/main_model.c" "src/main/c/CMakeFiles/CrashC.dir/main_model.c.o" "gcc" "src/main/c/CMakeFiles/CrashC.dir/main_model.c.o.d"
+  "/root/repo/crashc/src/main/c/model.c" "src/main/c/CMakeFiles/CrashC.dir/model.c.o" "gcc" "src/main/c/CMakeFiles/CrashC.dir/model.c.o.d"
+  "/root/repo/crashc/src/main/c/output_capture.c" "src/main/c/CMakeFiles/CrashC.dir/output_capture.c.o" "gcc" "src/main/c/CMakeFiles/CrashC.dir/output_capture.c.o.d"
+  "/root/repo/crashc/src/main/c/progress.c" "src/main/c/CMakeFiles/CrashC.dir/progress.c.o" "gcc" "src/main/c/CMakeFiles/CrashC.dir/progress.c.o.d"
+  "/root/repo/crashc/src/main/c/report_producer.c" "src/main/c/CMakeFiles/CrashC.dir/report_producer.c.o" "gcc" "src/main/c/CMakeFiles/CrashC.dir/report_producer.c.o.d"
+  "/root/repo/crashc/src/main/c/report_serialization.c" "src/main/c/CMakeFiles/CrashC.dir/report_serialization.c.o" "gcc" "src/main/c/CMakeFiles/CrashC.dir/report_serialization.c.o.d"
+  "/root/repo/crashc/src/main/c/resource_usage.c" "src/main/c/CMakeFiles/CrashC.dir/resource_usage.c.o" "gcc" "src/main/c/CMakeFiles/CrashC.dir/resource_usage.c.o.d"
+  "/root/repo/crashc/src/main/c/schedule.c" "src/main/c/CMakeFiles/CrashC.dir/schedule.c.o" "gcc" "src/main/c/CMakeFiles/CrashC.dir/schedule.c.o.d"
+  "/root/repo/crashc/src/main/c/section.c" "src/main/c/CMakeFiles/CrashC.dir/section.c.o" "gcc" "src/main/c/CMakeFiles/CrashC.dir/section.c.o.d"
+  "/root/repo/crashc/src/main/c/section_fork.c" "src/main/c/CMakeFiles/CrashC.dir/section_fork.c.o" "gcc" "src/main/c/CMakeFiles/CrashC.dir/section_fork.c.o.d"
+  "/root/repo/crashc/src/main/c/sig_handling.c" "src/main/c/CMakeFiles/CrashC.dir/sig_handling.c.o" "gcc" "src/main/c/CMakeFiles/CrashC.dir/sig_handling.c.o.d"
+  "/root/repo/crashc/src/main/c/stress.c" "src/main/c/CMakeFiles/CrashC.dir/stress.c.o" "gcc" "src/main/c/CMakeFiles/CrashC.dir/stress.c.o.d"
+  "/root/repo/crashc/src/main/c/suite_order.c" "src/main/c/CMakeFiles/CrashC.dir/suite_order.c.o" "gcc" "src/main/c/CMakeFiles/CrashC.dir/suite_order.c.o.d"
+  "/root/repo/crashc/src/main/c/tag.c" "src/main/c/CMakeFiles/CrashC.dir/tag.c.o" "gcc" "src/main/c/CMakeFiles/CrashC.dir/tag.c.o.d"
+  "/root/repo/crashc/src/main/c/test_report.c" "src/main/c/CMakeFiles/CrashC.dir/test_report.c.o" "gcc" "src/main/c/CMakeFiles/CrashC.dir/test_report.c.o.d"
+  "/root/repo/crashc/src/main/c/thread_context.c" "src/main/c/CMakeFiles/CrashC.dir/thread_context.c.o" "gcc" "src/main/c/CMakeFiles/CrashC.dir/thread_context.c.o.d"
+  "/root/repo/crashc/src/main/c/utils.c" "src/main/c/CMakeFiles/CrashC.dir/utils.c.o" "gcc" "src/main/c/CMakeFiles/CrashC.dir/utils.c.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,73 @@
+file(REMOVE_RECURSE
+  "../../../libCrashC.a"
+  "../../../libCrashC.pdb"
+  "CMakeFiles/CrashC.dir/allocation_tracker.c.o"
+  "CMakeFiles/CrashC.dir/allocation_tracker.c.o.d"
+  "CMakeFiles/CrashC.dir/assertions.c.o"
+  "CMakeFiles/CrashC.dir/assertions.c.o.d"
+  "CMakeFiles/CrashC.dir/benchmark.c.o"
+  "CMakeFiles/CrashC.dir/benchmark.c.o.d"
+  "CMakeFiles/CrashC.dir/binary_report.c.o"
+  "CMakeFiles/CrashC.dir/binary_report.c.o.d"
+  "CMakeFiles/CrashC.dir/command_line.c.o"
+  "CMakeFiles/CrashC.dir/command_line.c.o.d"
+  "CMakeFiles/CrashC.dir/coverage.c.o"
+  "CMakeFiles/CrashC.dir/coverage.c.o.d"
+  "CMakeFiles/CrashC.dir/crashc.c.o"
+  "CMakeFiles/CrashC.dir/crashc.c.o.d"
+  "CMakeFiles/CrashC.dir/distribution.c.o"
+  "CMakeFiles/CrashC.dir/distribution.c.o.d"
+  "CMakeFiles/CrashC.dir/events.c.o"
+  "CMakeFiles/CrashC.dir/events.c.o.d"
+  "CMakeFiles/CrashC.dir/flaky.c.o"
+  "CMakeFiles/CrashC.dir/flaky.c.o.d"
+  "CMakeFiles/CrashC.dir/fuzz.c.o"
+  "CMakeFiles/CrashC.dir/fuzz.c.o.d"
+  "CMakeFiles/CrashC.dir/hardware_counters.c.o"
+  "CMakeFiles/CrashC.dir/hardware_counters.c.o.d"
+  "CMakeFiles/CrashC.dir/hashtable.c.o"
+  "CMakeFiles/CrashC.dir/hashtable.c.o.d"
+  "CMakeFiles/CrashC.dir/journal.c.o"
+  "CMakeFiles/CrashC.dir/journal.c.o.d"
+  "CMakeFiles/CrashC.dir/list.c.o"
+  "CMakeFiles/CrashC.dir/list.c.o.d"
+  "CMakeFiles/CrashC.dir/main_model.c.o"
+  "CMakeFiles/CrashC.dir/main_model.c.o.d"
+  "CMakeFiles/CrashC.dir/model.c.o"
+  "CMakeFiles/CrashC.dir/model.c.o.d"
+  "CMakeFiles/CrashC.dir/output_capture.c.o"
+  "CMakeFiles/CrashC.dir/output_capture.c.o.d"
+  "CMakeFiles/CrashC.dir/progress.c.o"
+  "CMakeFiles/CrashC.dir/progress.c.o.d"
+  "CMakeFiles/CrashC.dir/report_producer.c.o"
+  "CMakeFiles/CrashC.dir/report_producer.c.o.d"
+  "CMakeFiles/CrashC.dir/report_serialization.c.o"
+  "CMakeFiles/CrashC.dir/report_serialization.c.o.d"
+  "CMakeFiles/CrashC.dir/resource_usage.c.o"
+  "CMakeFiles/CrashC.dir/resource_usage.c.o.d"
+  "CMakeFiles/CrashC.dir/schedule.c.o"
+  "CMakeFiles/CrashC.dir/schedule.c.o.d"
+  "CMakeFiles/CrashC.dir/section.c.o"
+  "CMakeFiles/CrashC.dir/section.c.o.d"
+  "CMakeFiles/CrashC.dir/section_fork.c.o"
+  "CMakeFiles/CrashC.dir/section_fork.c.o.d"
+  "CMakeFiles/CrashC.dir/sig_handling.c.o"
+  "CMakeFiles/CrashC.dir/sig_handling.c.o.d"
+  "CMakeFiles/CrashC.dir/stress.c.o"
+  "CMakeFiles/CrashC.dir/stress.c.o.d"
+  "CMakeFiles/CrashC.dir/suite_order.c.o"
+  "CMakeFiles/CrashC.dir/suite_order.c.o.d"
+  "CMakeFiles/CrashC.dir/tag.c.o"
+  "CMakeFiles/CrashC.dir/tag.c.o.d"
+  "CMakeFiles/CrashC.dir/test_report.c.o"
+  "CMakeFiles/CrashC.dir/test_report.c.o.d"
+  "CMakeFiles/CrashC.dir/thread_context.c.o"
+  "CMakeFiles/CrashC.dir/thread_context.c.o.d"
+  "CMakeFiles/CrashC.dir/utils.c.o"
+  "CMakeFiles/CrashC.dir/utils.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/CrashC.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,105 @@
+# Install script for directory: /root/repo/crashc/src/main/c
+
+# Set the install prefix
+if(NOT DEFINED CMAKE_INSTALL_PREFIX)
+  set(CMAKE_INSTALL_PREFIX "/usr/local")
+endif()
+string(REGEX REPLACE "/$" "" CMAKE_INSTALL_PREFIX "${CMAKE_INSTALL_PREFIX}")
+
+# Set the install configuration name.
+if(NOT DEFINED CMAKE_INSTALL_CONFIG_NAME)
+  if(BUILD_TYPE)
+    string(REGEX REPLACE "^[^A-Za-z0-9_]+" ""
+           CMAKE_INSTALL_CONFIG_NAME "${BUILD_TYPE}")
+  else()
+    set(CMAKE_INSTALL_CONFIG_NAME "Debug")
+  endif()
+  message(STATUS "Install configuration: \"${CMAKE_INSTALL_CONFIG_NAME}\"")
+endif()
+
+# Set the component getting installed.
+if(NOT CMAKE_INSTALL_COMPONENT)
+  if(COMPONENT)
+    message(STATUS "Install component: \"${COMPONENT}\"")
+    set(CMAKE_INSTALL_COMPONENT "${COMPONENT}")
+  else()
+    set(CMAKE_INSTALL_COMPONENT)
+  endif()
+endif()
+
+# Install shared libraries without execute permission?
+if(NOT DEFINED CMAKE_INSTALL_SO_NO_EXE)
+  set(CMAKE_INSTALL_SO_NO_EXE "1")
+endif()
+
+# Is this installation the result of a crosscompile?
+if(NOT DEFINED CMAKE_CROSSCOMPILING)
+  set(CMAKE_CROSSCOMPILING "FALSE")
+endif()
+
+# Set default install directory permissions.
+if(NOT DEFINED CMAKE_OBJDUMP)
+  set(CMAKE_OBJDUMP "/usr/bin/objdump")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  list(APPEND CMAKE_ABSOLUTE_DESTINATION_FILES
+   "/usr/local/lib/libCrashC.a")
+  if(CMAKE_WARN_ON_ABSOLUTE_INSTALL_DESTINATION)
+    message(WARNING "ABSOLUTE path INSTALL DESTINATION : ${CMAKE_ABSOLUTE_DESTINATION_FILES}")
+  endif()
+  if(CMAKE_ERROR_ON_ABSOLUTE_INSTALL_DESTINATION)
+    message(FATAL_ERROR "ABSOLUTE path INSTALL DESTINATION forbidden (by caller): ${CMAKE_ABSOLUTE_DESTINATION_FILES}")
+  endif()
+  file(INSTALL DESTINATION "/usr/local/lib" TYPE STATIC_LIBRARY FILES "/root/repo/crashc/build/Debug/libCrashC.a")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  list(APPEND CMAKE_ABSOLUTE_DESTINATION_FILES
+   "/usr/local/include/CrashC/allocation_tracker.h;/usr/local/include/CrashC/assertions.h;/usr/local/include/CrashC/benchmark.h;/usr/local/include/CrashC/binary_report.h;/usr/local/include/CrashC/command_line.h;/usr/local/include/CrashC/coverage.h;/usr/local/include/CrashC/crashc.h;/usr/local/include/CrashC/distribution.h;/usr/local/include/CrashC/errors.h;/usr/local/include/CrashC/events.h;/usr/local/include/CrashC/flaky.h;/usr/local/include/CrashC/fuzz.h;/usr/local/include/CrashC/hardware_counters.h;/usr/local/include/CrashC/hashtable.h;/usr/local/include/CrashC/journal.h;/usr/local/include/CrashC/list.h;/usr/local/include/CrashC/macros.h;/usr/local/include/CrashC/main_model.h;/usr/local/include/CrashC/model.h;/usr/local/include/CrashC/output_capture.h;/usr/local/include/CrashC/progress.h;/usr/local/include/CrashC/report_producer.h;/usr/local/include/CrashC/report_serialization.h;/usr/local/include/CrashC/resource_usage.h;/usr/local/include/CrashC/schedule.h;/usr/local/include/CrashC/section.h;/usr/local/include/CrashC/section_fork.h;/usr/local/include/CrashC/sig_handling.h;/usr/local/include/CrashC/stress.h;/usr/local/include/CrashC/suite_order.h;/usr/local/include/CrashC/tag.h;/usr/local/include/CrashC/test_report.h;/usr/local/include/CrashC/thread_context.h;/usr/local/include/CrashC/typedefs.h;/usr/local/include/CrashC/uthash.h;/usr/local/include/CrashC/utils.h")
+  if(CMAKE_WARN_ON_ABSOLUTE_INSTALL_DESTINATION)
+    message(WARNING "ABSOLUTE path INSTALL DESTINATION : ${CMAKE_ABSOLUTE_DESTINATION_FILES}")
+  endif()
+  if(CMAKE_ERROR_ON_ABSOLUTE_INSTALL_DESTINATION)
+    message(FATAL_ERROR "ABSOLUTE path INSTALL DESTINATION forbidden (by caller): ${CMAKE_ABSOLUTE_DESTINATION_FILES}")
+  endif()
+  file(INSTALL DESTINATION "/usr/local/include/CrashC" TYPE FILE FILES
+    "/root/repo/crashc/src/main/c/../include/allocation_tracker.h"
+    "/root/repo/crashc/src/main/c/../include/assertions.h"
+    "/root/repo/crashc/src/main/c/../include/benchmark.h"
+    "/root/repo/crashc/src/main/c/../include/binary_report.h"
+    "/root/repo/crashc/src/main/c/../include/command_line.h"
+    "/root/repo/crashc/src/main/c/../include/coverage.h"
+    "/root/repo/crashc/src/main/c/../include/crashc.h"
+    "/root/repo/crashc/src/main/c/../include/distribution.h"
+    "/root/repo/crashc/src/main/c/../include/errors.h"
+    "/root/repo/crashc/src/main/c/../include/events.h"
+    "/root/repo/crashc/src/main/c/../include/flaky.h"
+    "/root/repo/crashc/src/main/c/../include/fuzz.h"
+    "/root/repo/crashc/src/main/c/../include/hardware_counters.h"
+    "/root/repo/crashc/src/main/c/../include/hashtable.h"
+    "/root/repo/crashc/src/main/c/../include/journal.h"
+    "/root/repo/crashc/src/main/c/../include/list.h"
+    "/root/repo/crashc/src/main/c/../include/macros.h"
+    "/root/repo/crashc/src/main/c/../include/main_model.h"
+    "/root/repo/crashc/src/main/c/../include/model.h"
+    "/root/repo/crashc/src/main/c/../include/output_capture.h"
+    "/root/repo/crashc/src/main/c/../include/progress.h"
+    "/root/repo/crashc/src/main/c/../include/report_producer.h"
+    "/root/repo/crashc/src/main/c/../include/report_serialization.h"
+    "/root/repo/crashc/src/main/c/../include/resource_usage.h"
+    "/root/repo/crashc/src/main/c/../include/schedule.h"
+    "/root/repo/crashc/src/main/c/../include/section.h"
+    "/root/repo/crashc/src/main/c/../include/section_fork.h"
+    "/root/repo/crashc/src/main/c/../include/sig_handling.h"
+    "/root/repo/crashc/src/main/c/../include/stress.h"
+    "/root/repo/crashc/src/main/c/../include/suite_order.h"
+    "/root/repo/crashc/src/main/c/../include/tag.h"
+    "/root/repo/crashc/src/main/c/../include/test_report.h"
+    "/root/repo/crashc/src/main/c/../include/thread_context.h"
+    "/root/repo/crashc/src/main/c/../include/typedefs.h"
+    "/root/repo/crashc/src/main/c/../include/uthash.h"
+    "/root/repo/crashc/src/main/c/../include/utils.h"
+    )
+endif()
+
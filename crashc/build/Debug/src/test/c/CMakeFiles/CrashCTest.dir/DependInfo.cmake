@@ -0,0 +1,58 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/crashc/src/test/c/test_checker.c" "src/test/c/CMakeFiles/CrashCTest.dir/test_checker.c.o" "gcc" "src/test/c/CMakeFiles/CrashCTest.dir/test_checker.c.o.d"
+  "/root/repo/crashc/src/test/c/test_issue0001.c" "src/test/c/CMakeFiles/CrashCTest.dir/test_issue0001.c.o" "gcc" "src/test/c/CMakeFiles/CrashCTest.dir/test_issue0001.c.o.d"
+  "/root/repo/crashc/src/test/c/test_issue0001_b.c" "src/test/c/CMakeFiles/CrashCTest.dir/test_issue0001_b.c.o" "gcc" "src/test/c/CMakeFiles/CrashCTest.dir/test_issue0001_b.c.o.d"
+  "/root/repo/crashc/src/test/c/test_issue0002.c" "src/test/c/CMakeFiles/CrashCTest.dir/test_issue0002.c.o" "gcc" "src/test/c/CMakeFiles/CrashCTest.dir/test_issue0002.c.o.d"
+  "/root/repo/crashc/src/test/c/test_issue0004.c" "src/test/c/CMakeFiles/CrashCTest.dir/test_issue0004.c.o" "gcc" "src/test/c/CMakeFiles/CrashCTest.dir/test_issue0004.c.o.d"
+  "/root/repo/crashc/src/test/c/test_issue0006.c" "src/test/c/CMakeFiles/CrashCTest.dir/test_issue0006.c.o" "gcc" "src/test/c/CMakeFiles/CrashCTest.dir/test_issue0006.c.o.d"
+  "/root/repo/crashc/src/test/c/test_issue0014.c" "src/test/c/CMakeFiles/CrashCTest.dir/test_issue0014.c.o" "gcc" "src/test/c/CMakeFiles/CrashCTest.dir/test_issue0014.c.o.d"
+  "/root/repo/crashc/src/test/c/test_issue0015.c" "src/test/c/CMakeFiles/CrashCTest.dir/test_issue0015.c.o" "gcc" "src/test/c/CMakeFiles/CrashCTest.dir/test_issue0015.c.o.d"
+  "/root/repo/crashc/src/test/c/test_issue0026.c" "src/test/c/CMakeFiles/CrashCTest.dir/test_issue0026.c.o" "gcc" "src/test/c/CMakeFiles/CrashCTest.dir/test_issue0026.c.o.d"
+  "/root/repo/crashc/src/test/c/test_issue0028.c" "src/test/c/CMakeFiles/CrashCTest.dir/test_issue0028.c.o" "gcc" "src/test/c/CMakeFiles/CrashCTest.dir/test_issue0028.c.o.d"
+  "/root/repo/crashc/src/test/c/test_issue0069.c" "src/test/c/CMakeFiles/CrashCTest.dir/test_issue0069.c.o" "gcc" "src/test/c/CMakeFiles/CrashCTest.dir/test_issue0069.c.o.d"
+  "/root/repo/crashc/src/test/c/test_issue0071.c" "src/test/c/CMakeFiles/CrashCTest.dir/test_issue0071.c.o" "gcc" "src/test/c/CMakeFiles/CrashCTest.dir/test_issue0071.c.o.d"
+  "/root/repo/crashc/src/test/c/test_issue0072.c" "src/test/c/CMakeFiles/CrashCTest.dir/test_issue0072.c.o" "gcc" "src/test/c/CMakeFiles/CrashCTest.dir/test_issue0072.c.o.d"
+  "/root/repo/crashc/src/test/c/test_issue0073.c" "src/test/c/CMakeFiles/CrashCTest.dir/test_issue0073.c.o" "gcc" "src/test/c/CMakeFiles/CrashCTest.dir/test_issue0073.c.o.d"
+  "/root/repo/crashc/src/test/c/test_issue0074.c" "src/test/c/CMakeFiles/CrashCTest.dir/test_issue0074.c.o" "gcc" "src/test/c/CMakeFiles/CrashCTest.dir/test_issue0074.c.o.d"
+  "/root/repo/crashc/src/test/c/test_issue0075.c" "src/test/c/CMakeFiles/CrashCTest.dir/test_issue0075.c.o" "gcc" "src/test/c/CMakeFiles/CrashCTest.dir/test_issue0075.c.o.d"
+  "/root/repo/crashc/src/test/c/test_issue0076.c" "src/test/c/CMakeFiles/CrashCTest.dir/test_issue0076.c.o" "gcc" "src/test/c/CMakeFiles/CrashCTest.dir/test_issue0076.c.o.d"
+  "/root/repo/crashc/src/test/c/test_issue0077.c" "src/test/c/CMakeFiles/CrashCTest.dir/test_issue0077.c.o" "gcc" "src/test/c/CMakeFiles/CrashCTest.dir/test_issue0077.c.o.d"
+  "/root/repo/crashc/src/test/c/test_issue0078.c" "src/test/c/CMakeFiles/CrashCTest.dir/test_issue0078.c.o" "gcc" "src/test/c/CMakeFiles/CrashCTest.dir/test_issue0078.c.o.d"
+  "/root/repo/crashc/src/test/c/test_issue0079.c" "src/test/c/CMakeFiles/CrashCTest.dir/test_issue0079.c.o" "gcc" "src/test/c/CMakeFiles/CrashCTest.dir/test_issue0079.c.o.d"
+  "/root/repo/crashc/src/test/c/test_issue0080.c" "src/test/c/CMakeFiles/CrashCTest.dir/test_issue0080.c.o" "gcc" "src/test/c/CMakeFiles/CrashCTest.dir/test_issue0080.c.o.d"
+  "/root/repo/crashc/src/test/c/test_issue0081.c" "src/test/c/CMakeFiles/CrashCTest.dir/test_issue0081.c.o" "gcc" "src/test/c/CMakeFiles/CrashCTest.dir/test_issue0081.c.o.d"
+  "/root/repo/crashc/src/test/c/test_issue0082.c" "src/test/c/CMakeFiles/CrashCTest.dir/test_issue0082.c.o" "gcc" "src/test/c/CMakeFiles/CrashCTest.dir/test_issue0082.c.o.d"
+  "/root/repo/crashc/src/test/c/test_issue0083.c" "src/test/c/CMakeFiles/CrashCTest.dir/test_issue0083.c.o" "gcc" "src/test/c/CMakeFiles/CrashCTest.dir/test_issue0083.c.o.d"
+  "/root/repo/crashc/src/test/c/test_issue0084.c" "src/test/c/CMakeFiles/CrashCTest.dir/test_issue0084.c.o" "gcc" "src/test/c/CMakeFiles/CrashCTest.dir/test_issue0084.c.o.d"
+  "/root/repo/crashc/src/test/c/test_issue0085.c" "src/test/c/CMakeFiles/CrashCTest.dir/test_issue0085.c.o" "gcc" "src/test/c/CMakeFiles/CrashCTest.dir/test_issue0085.c.o.d"
+  "/root/repo/crashc/src/test/c/test_issue0086.c" "src/test/c/CMakeFiles/CrashCTest.dir/test_issue0086.c.o" "gcc" "src/test/c/CMakeFiles/CrashCTest.dir/test_issue0086.c.o.d"
+  "/root/repo/crashc/src/test/c/test_issue0087.c" "src/test/c/CMakeFiles/CrashCTest.dir/test_issue0087.c.o" "gcc" "src/test/c/CMakeFiles/CrashCTest.dir/test_issue0087.c.o.d"
+  "/root/repo/crashc/src/test/c/test_issue0088.c" "src/test/c/CMakeFiles/CrashCTest.dir/test_issue0088.c.o" "gcc" "src/test/c/CMakeFiles/CrashCTest.dir/test_issue0088.c.o.d"
+  "/root/repo/crashc/src/test/c/test_issue0089.c" "src/test/c/CMakeFiles/CrashCTest.dir/test_issue0089.c.o" "gcc" "src/test/c/CMakeFiles/CrashCTest.dir/test_issue0089.c.o.d"
+  "/root/repo/crashc/src/test/c/test_issue0090.c" "src/test/c/CMakeFiles/CrashCTest.dir/test_issue0090.c.o" "gcc" "src/test/c/CMakeFiles/CrashCTest.dir/test_issue0090.c.o.d"
+  "/root/repo/crashc/src/test/c/test_issue0091.c" "src/test/c/CMakeFiles/CrashCTest.dir/test_issue0091.c.o" "gcc" "src/test/c/CMakeFiles/CrashCTest.dir/test_issue0091.c.o.d"
+  "/root/repo/crashc/src/test/c/test_issue0092.c" "src/test/c/CMakeFiles/CrashCTest.dir/test_issue0092.c.o" "gcc" "src/test/c/CMakeFiles/CrashCTest.dir/test_issue0092.c.o.d"
+  "/root/repo/crashc/src/test/c/test_issue0093.c" "src/test/c/CMakeFiles/CrashCTest.dir/test_issue0093.c.o" "gcc" "src/test/c/CMakeFiles/CrashCTest.dir/test_issue0093.c.o.d"
+  "/root/repo/crashc/src/test/c/test_issue0094.c" "src/test/c/CMakeFiles/CrashCTest.dir/test_issue0094.c.o" "gcc" "src/test/c/CMakeFiles/CrashCTest.dir/test_issue0094.c.o.d"
+  "/root/repo/crashc/src/test/c/test_issue0095.c" "src/test/c/CMakeFiles/CrashCTest.dir/test_issue0095.c.o" "gcc" "src/test/c/CMakeFiles/CrashCTest.dir/test_issue0095.c.o.d"
+  "/root/repo/crashc/src/test/c/test_issue0096.c" "src/test/c/CMakeFiles/CrashCTest.dir/test_issue0096.c.o" "gcc" "src/test/c/CMakeFiles/CrashCTest.dir/test_issue0096.c.o.d"
+  "/root/repo/crashc/src/test/c/test_issue0097.c" "src/test/c/CMakeFiles/CrashCTest.dir/test_issue0097.c.o" "gcc" "src/test/c/CMakeFiles/CrashCTest.dir/test_issue0097.c.o.d"
+  "/root/repo/crashc/src/test/c/test_issue0098.c" "src/test/c/CMakeFiles/CrashCTest.dir/test_issue0098.c.o" "gcc" "src/test/c/CMakeFiles/CrashCTest.dir/test_issue0098.c.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/crashc/build/Debug/src/main/c/CMakeFiles/CrashC.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
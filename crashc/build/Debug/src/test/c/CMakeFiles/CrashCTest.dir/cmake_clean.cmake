@@ -0,0 +1,87 @@
+file(REMOVE_RECURSE
+  "../../../CrashCTest"
+  "../../../CrashCTest.pdb"
+  "CMakeFiles/CrashCTest.dir/test_checker.c.o"
+  "CMakeFiles/CrashCTest.dir/test_checker.c.o.d"
+  "CMakeFiles/CrashCTest.dir/test_issue0001.c.o"
+  "CMakeFiles/CrashCTest.dir/test_issue0001.c.o.d"
+  "CMakeFiles/CrashCTest.dir/test_issue0001_b.c.o"
+  "CMakeFiles/CrashCTest.dir/test_issue0001_b.c.o.d"
+  "CMakeFiles/CrashCTest.dir/test_issue0002.c.o"
+  "CMakeFiles/CrashCTest.dir/test_issue0002.c.o.d"
+  "CMakeFiles/CrashCTest.dir/test_issue0004.c.o"
+  "CMakeFiles/CrashCTest.dir/test_issue0004.c.o.d"
+  "CMakeFiles/CrashCTest.dir/test_issue0006.c.o"
+  "CMakeFiles/CrashCTest.dir/test_issue0006.c.o.d"
+  "CMakeFiles/CrashCTest.dir/test_issue0014.c.o"
+  "CMakeFiles/CrashCTest.dir/test_issue0014.c.o.d"
+  "CMakeFiles/CrashCTest.dir/test_issue0015.c.o"
+  "CMakeFiles/CrashCTest.dir/test_issue0015.c.o.d"
+  "CMakeFiles/CrashCTest.dir/test_issue0026.c.o"
+  "CMakeFiles/CrashCTest.dir/test_issue0026.c.o.d"
+  "CMakeFiles/CrashCTest.dir/test_issue0028.c.o"
+  "CMakeFiles/CrashCTest.dir/test_issue0028.c.o.d"
+  "CMakeFiles/CrashCTest.dir/test_issue0069.c.o"
+  "CMakeFiles/CrashCTest.dir/test_issue0069.c.o.d"
+  "CMakeFiles/CrashCTest.dir/test_issue0071.c.o"
+  "CMakeFiles/CrashCTest.dir/test_issue0071.c.o.d"
+  "CMakeFiles/CrashCTest.dir/test_issue0072.c.o"
+  "CMakeFiles/CrashCTest.dir/test_issue0072.c.o.d"
+  "CMakeFiles/CrashCTest.dir/test_issue0073.c.o"
+  "CMakeFiles/CrashCTest.dir/test_issue0073.c.o.d"
+  "CMakeFiles/CrashCTest.dir/test_issue0074.c.o"
+  "CMakeFiles/CrashCTest.dir/test_issue0074.c.o.d"
+  "CMakeFiles/CrashCTest.dir/test_issue0075.c.o"
+  "CMakeFiles/CrashCTest.dir/test_issue0075.c.o.d"
+  "CMakeFiles/CrashCTest.dir/test_issue0076.c.o"
+  "CMakeFiles/CrashCTest.dir/test_issue0076.c.o.d"
+  "CMakeFiles/CrashCTest.dir/test_issue0077.c.o"
+  "CMakeFiles/CrashCTest.dir/test_issue0077.c.o.d"
+  "CMakeFiles/CrashCTest.dir/test_issue0078.c.o"
+  "CMakeFiles/CrashCTest.dir/test_issue0078.c.o.d"
+  "CMakeFiles/CrashCTest.dir/test_issue0079.c.o"
+  "CMakeFiles/CrashCTest.dir/test_issue0079.c.o.d"
+  "CMakeFiles/CrashCTest.dir/test_issue0080.c.o"
+  "CMakeFiles/CrashCTest.dir/test_issue0080.c.o.d"
+  "CMakeFiles/CrashCTest.dir/test_issue0081.c.o"
+  "CMakeFiles/CrashCTest.dir/test_issue0081.c.o.d"
+  "CMakeFiles/CrashCTest.dir/test_issue0082.c.o"
+  "CMakeFiles/CrashCTest.dir/test_issue0082.c.o.d"
+  "CMakeFiles/CrashCTest.dir/test_issue0083.c.o"
+  "CMakeFiles/CrashCTest.dir/test_issue0083.c.o.d"
+  "CMakeFiles/CrashCTest.dir/test_issue0084.c.o"
+  "CMakeFiles/CrashCTest.dir/test_issue0084.c.o.d"
+  "CMakeFiles/CrashCTest.dir/test_issue0085.c.o"
+  "CMakeFiles/CrashCTest.dir/test_issue0085.c.o.d"
+  "CMakeFiles/CrashCTest.dir/test_issue0086.c.o"
+  "CMakeFiles/CrashCTest.dir/test_issue0086.c.o.d"
+  "CMakeFiles/CrashCTest.dir/test_issue0087.c.o"
+  "CMakeFiles/CrashCTest.dir/test_issue0087.c.o.d"
+  "CMakeFiles/CrashCTest.dir/test_issue0088.c.o"
+  "CMakeFiles/CrashCTest.dir/test_issue0088.c.o.d"
+  "CMakeFiles/CrashCTest.dir/test_issue0089.c.o"
+  "CMakeFiles/CrashCTest.dir/test_issue0089.c.o.d"
+  "CMakeFiles/CrashCTest.dir/test_issue0090.c.o"
+  "CMakeFiles/CrashCTest.dir/test_issue0090.c.o.d"
+  "CMakeFiles/CrashCTest.dir/test_issue0091.c.o"
+  "CMakeFiles/CrashCTest.dir/test_issue0091.c.o.d"
+  "CMakeFiles/CrashCTest.dir/test_issue0092.c.o"
+  "CMakeFiles/CrashCTest.dir/test_issue0092.c.o.d"
+  "CMakeFiles/CrashCTest.dir/test_issue0093.c.o"
+  "CMakeFiles/CrashCTest.dir/test_issue0093.c.o.d"
+  "CMakeFiles/CrashCTest.dir/test_issue0094.c.o"
+  "CMakeFiles/CrashCTest.dir/test_issue0094.c.o.d"
+  "CMakeFiles/CrashCTest.dir/test_issue0095.c.o"
+  "CMakeFiles/CrashCTest.dir/test_issue0095.c.o.d"
+  "CMakeFiles/CrashCTest.dir/test_issue0096.c.o"
+  "CMakeFiles/CrashCTest.dir/test_issue0096.c.o.d"
+  "CMakeFiles/CrashCTest.dir/test_issue0097.c.o"
+  "CMakeFiles/CrashCTest.dir/test_issue0097.c.o.d"
+  "CMakeFiles/CrashCTest.dir/test_issue0098.c.o"
+  "CMakeFiles/CrashCTest.dir/test_issue0098.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/CrashCTest.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../crashc-report"
+  "../../../crashc-report.pdb"
+  "CMakeFiles/crashc-report.dir/crashc_report.c.o"
+  "CMakeFiles/crashc-report.dir/crashc_report.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/crashc-report.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
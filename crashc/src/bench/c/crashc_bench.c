@@ -0,0 +1,320 @@
+/*
+ * crashc_bench.c
+ *
+ * Measures the overhead @crashc adds to the tests: the time and the allocations of a @testcase, of a @when, of a @then,
+ * of an assertion and of the tag filters, on synthetic suites doing nothing else.
+ *
+ * The benchmark is configured with environment variables, since the command line belongs to @crashc:
+ * \li \c CRASHC_BENCH_SCALE multiplies the rounds of every suite (default 1);
+ * \li \c CRASHC_BENCH_LABEL identifies the run, usually the commit being measured (default "unlabeled");
+ * \li \c CRASHC_BENCH_RESULTS is the CSV file the results are appended to (default "crashc_bench.csv").
+ * The results are compared with the last ones in the file having a different label and the same number of operations, i.e. the same scale.
+ *
+ * A suite is run in rounds of the same size, each one starting from an empty section tree: a section is fetched by walking its siblings,
+ * so a bigger tree would make the time per operation grow with the scale and with the suites run before.
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: koldar
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdbool.h>
+
+#include "crashc.h"
+#include "utils.h"
+
+/**
+ * The maximum number of benchmarks
+ */
+#define CT_BENCH_MAX_RESULTS 16
+
+extern void* __libc_malloc(size_t size);
+extern void* __libc_calloc(size_t number, size_t size);
+extern void* __libc_realloc(void* pointer, size_t size);
+extern void __libc_free(void* pointer);
+
+/**
+ * The measurements of a benchmark
+ */
+struct ct_bench_result {
+	/**
+	 * The name of the benchmark, i.e. the shape of its section tree
+	 */
+	const char* name;
+	/**
+	 * What a single operation is
+	 */
+	const char* operation;
+	/**
+	 * The number of operations performed
+	 */
+	long operations;
+	/**
+	 * The time needed to perform all the operations, in nanoseconds
+	 */
+	long elapsed_time;
+	/**
+	 * The allocations performed by @crashc during the benchmark
+	 */
+	unsigned long allocations;
+};
+
+static struct ct_bench_result results[CT_BENCH_MAX_RESULTS];
+static int results_number = 0;
+static long scale = 1;
+static unsigned long allocations = 0;
+static struct timespec start_time;
+static unsigned long start_allocations;
+static long elapsed_time = 0;
+static unsigned long round_allocations = 0;
+
+/*
+ * Every allocation of the process, including the ones of the C library on behalf of @crashc, passes through here.
+ * The tests of the benchmarks don't allocate anything, so every allocation belongs to @crashc.
+ */
+void* malloc(size_t size) {
+	__atomic_add_fetch(&allocations, 1, __ATOMIC_RELAXED);
+	return __libc_malloc(size);
+}
+
+void* calloc(size_t number, size_t size) {
+	__atomic_add_fetch(&allocations, 1, __ATOMIC_RELAXED);
+	return __libc_calloc(number, size);
+}
+
+void* realloc(void* pointer, size_t size) {
+	__atomic_add_fetch(&allocations, 1, __ATOMIC_RELAXED);
+	return __libc_realloc(pointer, size);
+}
+
+void free(void* pointer) {
+	__libc_free(pointer);
+}
+
+/*
+ * The tests of the previous rounds are forgotten before the clock starts, so releasing them isn't measured
+ */
+static void ct_bench_start_round() {
+	ct_reset_tests(ct_model);
+	start_allocations = allocations;
+	start_time = ct_get_time();
+}
+
+static void ct_bench_end_round() {
+	struct timespec end_time = ct_get_time();
+
+	elapsed_time += ct_compute_time_gap(start_time, end_time, "n");
+	round_allocations += allocations - start_allocations;
+}
+
+static void ct_bench_stop(const char* name, const char* operation, long operations) {
+	if (results_number < CT_BENCH_MAX_RESULTS) {
+		results[results_number] = (struct ct_bench_result) {
+			.name = name,
+			.operation = operation,
+			.operations = operations,
+			.elapsed_time = elapsed_time,
+			.allocations = round_allocations
+		};
+		results_number += 1;
+	}
+	elapsed_time = 0;
+	round_allocations = 0;
+}
+
+static const char* ct_bench_getenv(const char* name, const char* default_value) {
+	const char* ret_val = getenv(name);
+	return (ret_val != NULL && ret_val[0] != '\0') ? ret_val : default_value;
+}
+
+/**
+ * Looks for the last result of a benchmark with a label different from the current one and the same number of operations
+ *
+ * @param[in] path the CSV file with the previous results
+ * @param[in] label the label of the current run
+ * @param[in] name the benchmark to look for
+ * @param[in] operations the number of operations of the current run
+ * @param[out] previous_label the label of the result found
+ * @param[out] ns_per_operation the time per operation of the result found
+ * @return @true if a result has been found, @false otherwise
+ */
+static bool ct_bench_find_previous(const char* path, const char* label, const char* name, long operations, char* previous_label, double* ns_per_operation) {
+	FILE* file = fopen(path, "r");
+	if (file == NULL) {
+		return false;
+	}
+
+	bool ret_val = false;
+	char line[CT_BUFFER_SIZE];
+	char line_label[CT_BUFFER_SIZE];
+	char line_name[CT_BUFFER_SIZE];
+	long line_operations;
+	double line_ns;
+	while (fgets(line, sizeof(line), file) != NULL) {
+		if (sscanf(line, "%299[^,],%299[^,],%*[^,],%ld,%lf", line_label, line_name, &line_operations, &line_ns) != 4) {
+			continue;
+		}
+		if (strcmp(line_name, name) == 0 && strcmp(line_label, label) != 0 && line_operations == operations) {
+			strcpy(previous_label, line_label);
+			*ns_per_operation = line_ns;
+			ret_val = true;
+		}
+	}
+	fclose(file);
+	return ret_val;
+}
+
+static void ct_bench_report(struct ct_model* model) {
+	const char* path = ct_bench_getenv("CRASHC_BENCH_RESULTS", "crashc_bench.csv");
+	const char* label = ct_bench_getenv("CRASHC_BENCH_LABEL", "unlabeled");
+
+	printf("scale %ld\n", scale);
+	printf("%-12s %-10s %12s %12s %12s  %s\n", "benchmark", "operation", "operations", "ns/op", "allocs/op", "previous");
+	for (int i = 0; i < results_number; i++) {
+		const struct ct_bench_result* result = &results[i];
+		double ns_per_operation = (double) result->elapsed_time / result->operations;
+		double allocations_per_operation = (double) result->allocations / result->operations;
+		char previous_label[CT_BUFFER_SIZE];
+		double previous_ns;
+
+		printf("%-12s %-10s %12ld %12.1f %12.2f", result->name, result->operation, result->operations, ns_per_operation, allocations_per_operation);
+		if (ct_bench_find_previous(path, label, result->name, result->operations, previous_label, &previous_ns)) {
+			printf("  %+.1f%% vs %s", 100 * (ns_per_operation - previous_ns) / previous_ns, previous_label);
+		}
+		printf("\n");
+	}
+
+	FILE* file = fopen(path, "a");
+	if (file == NULL) {
+		fprintf(stderr, "CrashC - cannot write the benchmark results into \"%s\"\n", path);
+		return;
+	}
+	for (int i = 0; i < results_number; i++) {
+		const struct ct_bench_result* result = &results[i];
+		fprintf(file, "%s,%s,%s,%ld,%.3f,%.3f\n", label, result->name, result->operation, result->operations,
+				(double) result->elapsed_time / result->operations, (double) result->allocations / result->operations);
+	}
+	fclose(file);
+}
+
+TESTS_START
+scale = strtol(ct_bench_getenv("CRASHC_BENCH_SCALE", "1"), NULL, 10);
+if (scale <= 0) {
+	scale = 1;
+}
+ct_model->report_producer_implementation->report_producer = ct_bench_report;
+REG_SUITES(testcases, wide, deep, thens, asserts, tags);
+TESTS_END
+
+TESTSUITE(testcases) {
+	long rounds = 20 * scale;
+	long testcases = 1000;
+
+	for (long round = 0; round < rounds; round++) {
+		ct_bench_start_round();
+		for (long i = 0; i < testcases; i++) {
+			TESTCASE("empty", "") {
+			}
+		}
+		ct_bench_end_round();
+	}
+	ct_bench_stop("testcases", "TESTCASE", rounds * testcases);
+}
+
+/*
+ * Every WHEN is run in a different iteration of the TESTCASE, which goes through all the siblings every time
+ */
+TESTSUITE(wide) {
+	long whens = 500;
+
+	for (long round = 0; round < scale; round++) {
+		ct_bench_start_round();
+		TESTCASE("wide", "") {
+			for (long i = 0; i < whens; i++) {
+				WHEN("sibling", "") {
+				}
+			}
+		}
+		ct_bench_end_round();
+	}
+	ct_bench_stop("wide", "WHEN", scale * whens);
+}
+
+#define CT_BENCH_LEVEL_1 WHEN("level", "") { }
+#define CT_BENCH_LEVEL_2 WHEN("level", "") { CT_BENCH_LEVEL_1 }
+#define CT_BENCH_LEVEL_4 WHEN("level", "") { WHEN("level", "") { CT_BENCH_LEVEL_2 } }
+#define CT_BENCH_LEVEL_8 WHEN("level", "") { WHEN("level", "") { WHEN("level", "") { WHEN("level", "") { CT_BENCH_LEVEL_4 } } } }
+#define CT_BENCH_LEVEL_16 WHEN("level", "") { WHEN("level", "") { WHEN("level", "") { WHEN("level", "") { \
+	WHEN("level", "") { WHEN("level", "") { WHEN("level", "") { WHEN("level", "") { CT_BENCH_LEVEL_8 } } } } } } } }
+
+TESTSUITE(deep) {
+	long rounds = 10 * scale;
+	long testcases = 100;
+
+	for (long round = 0; round < rounds; round++) {
+		ct_bench_start_round();
+		for (long i = 0; i < testcases; i++) {
+			TESTCASE("deep", "") {
+				CT_BENCH_LEVEL_16
+			}
+		}
+		ct_bench_end_round();
+	}
+	ct_bench_stop("deep", "WHEN", 16 * rounds * testcases);
+}
+
+TESTSUITE(thens) {
+	long rounds = 2 * scale;
+	long testcases = 100;
+
+	for (long round = 0; round < rounds; round++) {
+		ct_bench_start_round();
+		for (long i = 0; i < testcases; i++) {
+			TESTCASE("thens", "") {
+				for (int j = 0; j < 100; j++) {
+					THEN("then", "") {
+					}
+				}
+			}
+		}
+		ct_bench_end_round();
+	}
+	ct_bench_stop("thens", "THEN", 100 * rounds * testcases);
+}
+
+TESTSUITE(asserts) {
+	long asserts = 1000000;
+
+	for (long round = 0; round < scale; round++) {
+		ct_bench_start_round();
+		TESTCASE("asserts", "") {
+			for (long i = 0; i < asserts; i++) {
+				ASSERT(i >= 0);
+			}
+		}
+		ct_bench_end_round();
+	}
+	ct_bench_stop("asserts", "ASSERT", scale * asserts);
+}
+
+/*
+ * Every TESTCASE is checked against the excluded tags, without matching them
+ */
+TESTSUITE(tags) {
+	long rounds = 20 * scale;
+	long testcases = 1000;
+
+	ct_tag_ht_populate(ct_model->exclude_tags, "slow flaky network", CT_TAGS_SEPARATOR);
+	for (long round = 0; round < rounds; round++) {
+		ct_bench_start_round();
+		for (long i = 0; i < testcases; i++) {
+			TESTCASE("tagged", "unit fast core list map set queue stack tree graph heap sort search hash string parse") {
+			}
+		}
+		ct_bench_end_round();
+	}
+	ct_bench_stop("tags", "TESTCASE", rounds * testcases);
+	ct_ht_clear_and_destroy_elements(ct_model->exclude_tags, (ct_destroyer_c) ct_tag_destroy);
+}
@@ -0,0 +1,361 @@
+/*
+ * allocation_tracker.c
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: koldar
+ */
+
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "allocation_tracker.h"
+#include "main_model.h"
+#include "section.h"
+#include "tag.h"
+#include "errors.h"
+
+/*
+ * The actual allocation functions. They are defined by the linker only when the executable is linked with --wrap:
+ * otherwise they are weak undefined symbols and their address is NULL
+ */
+extern void* __real_malloc(size_t size) __attribute__((weak));
+extern void* __real_calloc(size_t number, size_t size) __attribute__((weak));
+extern void* __real_realloc(void* pointer, size_t size) __attribute__((weak));
+extern void __real_free(void* pointer) __attribute__((weak));
+
+/**
+ * How many nested @crashc internal operations the calling thread is running right now
+ *
+ * Allocations performed while this counter is greater than 0 are performed by @crashc itself, hence they are not counted
+ */
+static _Thread_local int ct_internal_depth = 0;
+
+static struct ct_allocation_tracker* ct_current_tracker();
+static size_t ct_block_hash(const void* block, size_t capacity);
+static void ct_allocation_table_put(struct ct_allocation_tracker* tracker, void* block, size_t size);
+static bool ct_allocation_table_remove(struct ct_allocation_tracker* tracker, void* block);
+static void ct_allocation_table_clear(struct ct_allocation_tracker* tracker);
+static void ct_allocation_table_grow(struct ct_allocation_tracker* tracker);
+static void ct_account_allocation(struct ct_allocation_tracker* tracker, void* new_block, size_t size);
+static bool ct_sum_allocations(const struct ct_snapshot* snapshot, unsigned long* allocations);
+
+struct ct_allocation_tracker* ct_init_allocation_tracker() {
+	struct ct_allocation_tracker* ret_val = malloc(sizeof(struct ct_allocation_tracker));
+	if (ret_val == NULL) {
+		CT_MALLOC_ERROR_CALLBACK();
+	}
+
+	ret_val->enabled = (__real_malloc != NULL) && (__real_calloc != NULL) && (__real_realloc != NULL) && (__real_free != NULL);
+	ret_val->active = false;
+	pthread_mutex_init(&ret_val->lock, NULL);
+	ret_val->blocks = NULL;
+	ret_val->block_sizes = NULL;
+	ret_val->capacity = 0;
+	ret_val->live_blocks = 0;
+	ret_val->live_bytes = 0;
+
+	if (ret_val->enabled) {
+		//the table is not allocated via the wrappers, hence it is never accounted to the code under test
+		ret_val->capacity = CT_ALLOCATION_TABLE_INITIAL_SIZE;
+		ret_val->blocks = __real_calloc(ret_val->capacity, sizeof(void*));
+		ret_val->block_sizes = __real_calloc(ret_val->capacity, sizeof(size_t));
+		if (ret_val->blocks == NULL || ret_val->block_sizes == NULL) {
+			CT_MALLOC_ERROR_CALLBACK();
+		}
+	}
+
+	return ret_val;
+}
+
+void ct_destroy_allocation_tracker(struct ct_allocation_tracker* tracker) {
+	if (tracker->enabled) {
+		__real_free(tracker->blocks);
+		__real_free(tracker->block_sizes);
+	}
+	pthread_mutex_destroy(&tracker->lock);
+	free(tracker);
+}
+
+void ct_allocation_tracker_start(struct ct_allocation_tracker* tracker) {
+	if (!tracker->enabled) {
+		return;
+	}
+	pthread_mutex_lock(&tracker->lock);
+	ct_allocation_table_clear(tracker);
+	tracker->active = true;
+	pthread_mutex_unlock(&tracker->lock);
+}
+
+void ct_allocation_tracker_stop(struct ct_allocation_tracker* tracker) {
+	pthread_mutex_lock(&tracker->lock);
+	tracker->active = false;
+	pthread_mutex_unlock(&tracker->lock);
+}
+
+void ct_allocation_tracker_pause() {
+	ct_internal_depth += 1;
+}
+
+void ct_allocation_tracker_resume() {
+	ct_internal_depth -= 1;
+}
+
+void ct_allocation_tracker_check_leaks(struct ct_allocation_tracker* tracker, struct ct_snapshot* snapshot) {
+	if (!tracker->enabled) {
+		return;
+	}
+
+	pthread_mutex_lock(&tracker->lock);
+	snapshot->leaked_blocks = tracker->live_blocks;
+	snapshot->leaked_bytes = tracker->live_bytes;
+	pthread_mutex_unlock(&tracker->lock);
+	if (snapshot->leaked_blocks > 0 && snapshot->status == CT_SNAPSHOT_OK) {
+		snapshot->status = CT_SNAPSHOT_LEAKED;
+	}
+}
+
+void ct_allocation_tracker_read(struct ct_allocation_tracker* tracker, const struct ct_snapshot* snapshot, unsigned long* allocations, size_t* allocated_bytes, unsigned long* frees) {
+	pthread_mutex_lock(&tracker->lock);
+	*allocations = snapshot->allocations;
+	*allocated_bytes = snapshot->allocated_bytes;
+	*frees = snapshot->frees;
+	pthread_mutex_unlock(&tracker->lock);
+}
+
+void ct_allocation_tracker_check_bound(struct ct_allocation_tracker* tracker, struct ct_snapshot* snapshot) {
+	if (!tracker->enabled || snapshot->status != CT_SNAPSHOT_OK) {
+		return;
+	}
+
+	unsigned long allocations = 0;
+	long bound;
+	bool over_allocated = ct_sum_allocations(snapshot, &allocations);
+	if (ct_tag_ht_get_number(snapshot->tags, CT_MAX_ALLOCATIONS_TAG, &bound) && ((long) allocations) > bound) {
+		over_allocated = true;
+	}
+	if (over_allocated) {
+		snapshot->status = CT_SNAPSHOT_OVER_ALLOCATED;
+	}
+}
+
+void* __wrap_malloc(size_t size) {
+	void* ret_val = __real_malloc(size);
+	struct ct_allocation_tracker* tracker = ct_current_tracker();
+
+	if (tracker != NULL) {
+		pthread_mutex_lock(&tracker->lock);
+		ct_account_allocation(tracker, ret_val, size);
+		pthread_mutex_unlock(&tracker->lock);
+	}
+	return ret_val;
+}
+
+void* __wrap_calloc(size_t number, size_t size) {
+	void* ret_val = __real_calloc(number, size);
+	struct ct_allocation_tracker* tracker = ct_current_tracker();
+
+	if (tracker != NULL) {
+		pthread_mutex_lock(&tracker->lock);
+		ct_account_allocation(tracker, ret_val, number * size);
+		pthread_mutex_unlock(&tracker->lock);
+	}
+	return ret_val;
+}
+
+void* __wrap_realloc(void* pointer, size_t size) {
+	struct ct_allocation_tracker* tracker = ct_current_tracker();
+	void* ret_val = __real_realloc(pointer, size);
+
+	if (tracker == NULL || (ret_val == NULL && size > 0)) {
+		return ret_val;
+	}
+
+	struct ct_snapshot* snapshot = ct_get_thread_snapshot(ct_model);
+	pthread_mutex_lock(&tracker->lock);
+	//a block allocated before the test started is not owned by the test, even if it is moved
+	bool owned = (pointer == NULL) || ct_allocation_table_remove(tracker, pointer);
+	if (ret_val == NULL) {
+		//realloc with size 0 has released the block
+		if (owned && snapshot != NULL) {
+			snapshot->frees += 1;
+		}
+	} else if (owned) {
+		ct_account_allocation(tracker, ret_val, size);
+	} else if (ct_internal_depth == 0 && snapshot != NULL) {
+		snapshot->allocations += 1;
+		snapshot->allocated_bytes += size;
+	}
+	pthread_mutex_unlock(&tracker->lock);
+	return ret_val;
+}
+
+void __wrap_free(void* pointer) {
+	struct ct_allocation_tracker* tracker = ct_current_tracker();
+
+	if (tracker != NULL && pointer != NULL) {
+		struct ct_snapshot* snapshot = ct_get_thread_snapshot(ct_model);
+		pthread_mutex_lock(&tracker->lock);
+		if (ct_allocation_table_remove(tracker, pointer) && snapshot != NULL) {
+			snapshot->frees += 1;
+		}
+		pthread_mutex_unlock(&tracker->lock);
+	}
+	__real_free(pointer);
+}
+
+/**
+ * Fetch the tracker which is counting allocations right now
+ *
+ * @return the tracker of the global model or @null if no test is running
+ */
+static struct ct_allocation_tracker* ct_current_tracker() {
+	if (ct_model == NULL || ct_model->allocation_tracker == NULL) {
+		return NULL;
+	}
+	if (!__atomic_load_n(&ct_model->allocation_tracker->active, __ATOMIC_RELAXED)) {
+		return NULL;
+	}
+	return ct_model->allocation_tracker;
+}
+
+/**
+ * Accounts a block allocated by the code under test
+ *
+ * The caller needs to hold struct ct_allocation_tracker::lock
+ *
+ * @param[inout] tracker the tracker to update. If @null nothing is done
+ * @param[in] new_block the block just allocated
+ * @param[in] size the size of \c new_block
+ */
+static void ct_account_allocation(struct ct_allocation_tracker* tracker, void* new_block, size_t size) {
+	if (tracker == NULL || new_block == NULL || ct_internal_depth > 0) {
+		return;
+	}
+
+	//a worker thread never looks at struct ct_model::current_snapshot, which the main thread changes without any lock
+	struct ct_snapshot* snapshot = ct_get_thread_snapshot(ct_model);
+	ct_allocation_table_put(tracker, new_block, size);
+	if (snapshot != NULL) {
+		snapshot->allocations += 1;
+		snapshot->allocated_bytes += size;
+	}
+}
+
+/**
+ * Sums the blocks allocated by a snapshot and by its descendants
+ *
+ * Benchmarks are skipped, since they run their body many times
+ *
+ * @param[in] snapshot the root of the tree to sum
+ * @param[inout] allocations the sum to update
+ * @return @true if a benchmark in the tree has exceeded its own bound, @false otherwise
+ */
+static bool ct_sum_allocations(const struct ct_snapshot* snapshot, unsigned long* allocations) {
+	if (snapshot->type == CT_BENCHMARK_SECTION) {
+		return snapshot->status == CT_SNAPSHOT_OVER_ALLOCATED;
+	}
+
+	bool ret_val = false;
+	*allocations += snapshot->allocations;
+	for (const struct ct_snapshot* child = snapshot->first_child; child != NULL; child = child->next_sibling) {
+		ret_val = ct_sum_allocations(child, allocations) || ret_val;
+	}
+	return ret_val;
+}
+
+static size_t ct_block_hash(const void* block, size_t capacity) {
+	//blocks are aligned, hence the lowest bits are always the same
+	uintptr_t h = ((uintptr_t) block) >> 4;
+	h *= (uintptr_t) 0x9E3779B97F4A7C15ULL;
+	return (size_t) (h ^ (h >> 29)) & (capacity - 1);
+}
+
+static void ct_allocation_table_put(struct ct_allocation_tracker* tracker, void* block, size_t size) {
+	if ((tracker->live_blocks + 1) * 2 > tracker->capacity) {
+		ct_allocation_table_grow(tracker);
+	}
+
+	size_t i = ct_block_hash(block, tracker->capacity);
+	while (tracker->blocks[i] != NULL) {
+		i = (i + 1) & (tracker->capacity - 1);
+	}
+	tracker->blocks[i] = block;
+	tracker->block_sizes[i] = size;
+	tracker->live_blocks += 1;
+	tracker->live_bytes += size;
+}
+
+/**
+ * Removes a block from the table of live blocks
+ *
+ * We use linear probing with backward shift deletion, so no tombstone is ever needed
+ *
+ * @param[inout] tracker the tracker containing the table
+ * @param[in] block the block to remove
+ * @return @true if \c block was a live block, @false otherwise
+ */
+static bool ct_allocation_table_remove(struct ct_allocation_tracker* tracker, void* block) {
+	size_t mask = tracker->capacity - 1;
+	size_t i = ct_block_hash(block, tracker->capacity);
+
+	while (tracker->blocks[i] != block) {
+		if (tracker->blocks[i] == NULL) {
+			return false;
+		}
+		i = (i + 1) & mask;
+	}
+
+	tracker->live_blocks -= 1;
+	tracker->live_bytes -= tracker->block_sizes[i];
+	tracker->blocks[i] = NULL;
+
+	size_t j = i;
+	while (true) {
+		j = (j + 1) & mask;
+		if (tracker->blocks[j] == NULL) {
+			return true;
+		}
+		size_t home = ct_block_hash(tracker->blocks[j], tracker->capacity);
+		//move the cell j in the hole if its home position is not in the cyclic range (i, j]
+		if ((i <= j) ? ((i < home) && (home <= j)) : ((i < home) || (home <= j))) {
+			continue;
+		}
+		tracker->blocks[i] = tracker->blocks[j];
+		tracker->block_sizes[i] = tracker->block_sizes[j];
+		tracker->blocks[j] = NULL;
+		i = j;
+	}
+}
+
+static void ct_allocation_table_clear(struct ct_allocation_tracker* tracker) {
+	if (tracker->live_blocks > 0) {
+		memset(tracker->blocks, 0, sizeof(void*) * tracker->capacity);
+	}
+	tracker->live_blocks = 0;
+	tracker->live_bytes = 0;
+}
+
+static void ct_allocation_table_grow(struct ct_allocation_tracker* tracker) {
+	void** old_blocks = tracker->blocks;
+	size_t* old_sizes = tracker->block_sizes;
+	size_t old_capacity = tracker->capacity;
+
+	tracker->capacity = old_capacity * 2;
+	tracker->blocks = __real_calloc(tracker->capacity, sizeof(void*));
+	tracker->block_sizes = __real_calloc(tracker->capacity, sizeof(size_t));
+	if (tracker->blocks == NULL || tracker->block_sizes == NULL) {
+		CT_MALLOC_ERROR_CALLBACK();
+	}
+	tracker->live_blocks = 0;
+	tracker->live_bytes = 0;
+
+	for (size_t i = 0; i < old_capacity; i++) {
+		if (old_blocks[i] != NULL) {
+			ct_allocation_table_put(tracker, old_blocks[i], old_sizes[i]);
+		}
+	}
+
+	__real_free(old_blocks);
+	__real_free(old_sizes);
+}
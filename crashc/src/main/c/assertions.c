@@ -5,13 +5,28 @@
  *      Author: noodles
  */
 
+#include <stdio.h>
 #include <string.h>
 #include <setjmp.h>
+#include <pthread.h>
 
 #include "test_report.h"
 #include "assertions.h"
 #include "errors.h"
 #include "section.h"
+#include "allocation_tracker.h"
+#include "thread_context.h"
+#include "fuzz.h"
+#include "events.h"
+
+/**
+ * The assertion the calling thread is performing right now
+ */
+static _Thread_local struct ct_assert_report* ct_current_assert_report = NULL;
+/**
+ * On a worker thread, the cell which will publish ::ct_current_assert_report
+ */
+static _Thread_local struct ct_thread_assert_report* ct_current_thread_cell = NULL;
 
 struct ct_assert_report* ct_init_assert_report(bool is_mandatory, char* asserted_text, char* file, unsigned int line) {
 	struct ct_assert_report* ret_val = malloc(sizeof(struct ct_assert_report));
@@ -33,6 +48,28 @@ struct ct_assert_report* ct_init_assert_report(bool is_mandatory, char* asserted
 	return ret_val;
 }
 
+void ct_register_assert_report(struct ct_model* model, bool is_mandatory, char* asserted_text, char* file, unsigned int line) {
+	ct_allocation_tracker_pause();
+	ct_current_assert_report = ct_init_assert_report(is_mandatory, asserted_text, file, line);
+	if (ct_is_main_thread(model)) {
+		ct_list_add_tail(model->current_snapshot->assertion_reports, ct_current_assert_report);
+	} else {
+		ct_current_thread_cell = ct_init_thread_assert_report(ct_current_assert_report);
+	}
+	ct_allocation_tracker_resume();
+}
+
+void ct_complete_assert_report(struct ct_model* model) {
+	if (ct_current_assert_report == NULL) {
+		return;
+	}
+	if (!ct_is_main_thread(model)) {
+		ct_publish_thread_assert_report(model, ct_current_thread_cell);
+		ct_current_thread_cell = NULL;
+	}
+	ct_current_assert_report = NULL;
+}
+
 //TODO: We might add a field to the assert_report struct to point at a specific destructor in order to be able to
 //		precisely control how to destroy a specific report, which might have been generated by a different type of assertion
 //		which, for example, needs to malloc the memory for its strings
@@ -46,15 +83,32 @@ void ct_assert_do_nothing(struct ct_model* model) {
 
 void ct_general_assert_failed(struct ct_model* model) {
 
-	struct ct_snapshot* snapshot = model->current_snapshot;
-	struct ct_assert_report* report = ct_list_tail(snapshot->assertion_reports);
-	struct ct_test_report* test_report = ct_list_tail(model->test_reports_list);
+	struct ct_assert_report* report = ct_current_assert_report;
 
 	//Update the assertion report
 	report->passed = false;
 	report->expected_str = "true";
 	report->actual_str = "false";
 
+	if (ct_is_fuzzing(model)) {
+		//a fuzzer detects a failure only when the process crashes
+		fprintf(stderr, "CrashC - assertion \"%s\" failed in %s:%u\n", report->asserted, report->file_name, report->line_number);
+		abort();
+	}
+
+	if (!ct_is_main_thread(model)) {
+		//we can't jump into the stack of another thread: the failure will be propagated when the main thread merges the report
+		ct_complete_assert_report(model);
+		pthread_exit(NULL);
+	}
+	ct_current_assert_report = NULL;
+	if (CT_HAS_LISTENERS(model, CT_EVENT_ASSERT_FAIL)) {
+		ct_dispatch_assert_fail(model, report);
+	}
+
+	struct ct_snapshot* snapshot = model->current_snapshot;
+	struct ct_test_report* test_report = ct_list_tail(model->test_reports_list);
+
 	//Update the status of the snapshot which contained this assertion and of the test
 	snapshot->status = CT_SNAPSHOT_FAILED;
 	ct_update_test_outcome(test_report, snapshot);
@@ -0,0 +1,491 @@
+/*
+ * benchmark.c
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: koldar
+ */
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <ctype.h>
+#include <math.h>
+#include <unistd.h>
+#include <sys/syscall.h>
+
+#include "benchmark.h"
+#include "model.h"
+#include "utils.h"
+#include "errors.h"
+
+static void ct_end_benchmark(struct ct_model* model);
+static bool ct_pin_benchmark(struct ct_benchmark* benchmark, int cpu);
+static void ct_flush_cache(struct ct_benchmark* benchmark);
+static int ct_compare_times(const void* a, const void* b);
+static void ct_count_benchmark_allocations(struct ct_model* model, struct ct_benchmark_point* point);
+static FILE* ct_open_curve_file(const char* directory, const char* name, const char* extension);
+
+long ct_start_benchmark(struct ct_model* model, const char* parameter_name, long from, long to) {
+	if (from < 1 || to < from) {
+		fprintf(stderr, "CrashC - the parameter of a benchmark needs to go from a positive value to a greater or equal one, not from %ld to %ld\n", from, to);
+		model->current_snapshot->status = CT_SNAPSHOT_FAILED;
+		return from;
+	}
+
+	ct_allocation_tracker_pause();
+
+	struct ct_benchmark* benchmark = malloc(sizeof(struct ct_benchmark));
+	struct ct_benchmark_report* report = malloc(sizeof(struct ct_benchmark_report));
+	if (benchmark == NULL || report == NULL) {
+		CT_MALLOC_ERROR_CALLBACK();
+	}
+
+	report->parameter_name = parameter_name;
+	report->points_number = 1;
+	for (long value = from; value <= to / 2; value *= 2) {
+		report->points_number += 1;
+	}
+	report->points = malloc(sizeof(struct ct_benchmark_point) * report->points_number);
+	if (report->points == NULL) {
+		CT_MALLOC_ERROR_CALLBACK();
+	}
+	for (int i = 0; i < report->points_number; i++) {
+		report->points[i].parameter = from << i;
+		report->points[i].iterations = 1;
+		report->points[i].time = 0;
+		report->points[i].time_low = 0;
+		report->points[i].time_high = 0;
+		report->points[i].outliers = 0;
+		report->points[i].allocations = 0;
+		report->points[i].allocated_bytes = 0;
+		report->points[i].frees = 0;
+	}
+	report->complexity = CT_COMPLEXITY_CONSTANT;
+	report->coefficient = 0;
+	report->error = 0;
+	report->cpu = -1;
+	report->cold_cache = model->benchmark_cold_cache;
+	report->allocations_counted = model->allocation_tracker->enabled;
+
+	benchmark->report = report;
+	benchmark->description = model->current_section->description;
+	benchmark->point = 0;
+	benchmark->sample = report->cold_cache ? 0 : -1;
+	benchmark->iteration = -1;
+	benchmark->flush_buffer = NULL;
+	benchmark->flush_size = 0;
+	if (report->cold_cache) {
+		benchmark->flush_size = sysconf(_SC_LEVEL3_CACHE_SIZE);
+		if (benchmark->flush_size <= 0) {
+			benchmark->flush_size = CT_BENCHMARK_DEFAULT_CACHE_SIZE;
+		}
+		benchmark->flush_buffer = calloc(benchmark->flush_size, 1);
+		if (benchmark->flush_buffer == NULL) {
+			CT_MALLOC_ERROR_CALLBACK();
+		}
+	}
+	model->benchmark = benchmark;
+	ct_allocation_tracker_resume();
+
+	if (model->benchmark_cpu >= 0 && ct_pin_benchmark(benchmark, model->benchmark_cpu)) {
+		report->cpu = model->benchmark_cpu;
+	}
+	//with the CPU pinned, since a different CPU may run at a different frequency
+	report->warmup_time = ct_benchmark_warmup();
+
+	return from;
+}
+
+bool ct_benchmark_next(struct ct_model* model, long* parameter) {
+	//the clock is read first, so that the bookkeeping is not measured
+	struct timespec now = ct_get_time();
+	struct ct_benchmark* benchmark = model->benchmark;
+	if (benchmark == NULL) {
+		//the range of the parameter was not valid
+		return false;
+	}
+	struct ct_benchmark_point* point = &benchmark->report->points[benchmark->point];
+
+	if (benchmark->iteration >= 0 && benchmark->sample < 0) {
+		//the body has warmed up the cache
+		benchmark->sample = 0;
+	} else if (benchmark->iteration >= 0) {
+		benchmark->iteration += 1;
+		if (benchmark->iteration < point->iterations) {
+			return true;
+		}
+
+		long elapsed = ct_compute_time_gap(benchmark->sample_start, now, "n");
+		if (benchmark->sample == 0 && elapsed < CT_BENCHMARK_MIN_SAMPLE_TIME && benchmark->flush_buffer == NULL) {
+			//the sample is too short to be measured precisely: it's discarded and the next one runs the body twice as many times
+			point->iterations *= 2;
+		} else {
+			benchmark->samples[benchmark->sample] = ((double) elapsed) / point->iterations;
+			benchmark->sample += 1;
+			ct_count_benchmark_allocations(model, point);
+		}
+
+		if (benchmark->sample == CT_BENCHMARK_SAMPLES) {
+			ct_estimate_benchmark_time(benchmark->samples, CT_BENCHMARK_SAMPLES, point);
+			//the samples have accumulated the counts of all their runs
+			point->allocations /= CT_BENCHMARK_SAMPLES * point->iterations;
+			point->allocated_bytes /= CT_BENCHMARK_SAMPLES * point->iterations;
+			point->frees /= CT_BENCHMARK_SAMPLES * point->iterations;
+			benchmark->point += 1;
+			benchmark->sample = (benchmark->flush_buffer != NULL) ? 0 : -1;
+			if (benchmark->point == benchmark->report->points_number) {
+				ct_end_benchmark(model);
+				return false;
+			}
+			*parameter = benchmark->report->points[benchmark->point].parameter;
+		}
+	}
+
+	benchmark->iteration = 0;
+	if (benchmark->sample >= 0) {
+		if (benchmark->flush_buffer != NULL) {
+			ct_flush_cache(benchmark);
+		}
+		ct_allocation_tracker_read(model->allocation_tracker, model->current_snapshot,
+				&benchmark->sample_allocations, &benchmark->sample_allocated_bytes, &benchmark->sample_frees
+		);
+		benchmark->sample_start = ct_get_time();
+	}
+	return true;
+}
+
+void ct_estimate_benchmark_time(double* samples, int samples_number, struct ct_benchmark_point* point) {
+	qsort(samples, samples_number, sizeof(double), ct_compare_times);
+
+	//Tukey's fences: since the samples are sorted, the ones left form a range
+	double first_quartile = samples[samples_number / 4];
+	double third_quartile = samples[(3 * samples_number) / 4];
+	double fence = 1.5 * (third_quartile - first_quartile);
+	int first = 0;
+	int last = samples_number;
+	while (first < last && samples[first] < first_quartile - fence) {
+		first += 1;
+	}
+	while (last > first && samples[last - 1] > third_quartile + fence) {
+		last -= 1;
+	}
+	int kept = last - first;
+
+	double sum = 0;
+	for (int i = first; i < last; i++) {
+		sum += samples[i];
+	}
+	point->time = sum / kept;
+	point->outliers = samples_number - kept;
+
+	//the means of the samples drawn with replacement, generated by a fixed xorshift so that the interval is reproducible
+	double means[CT_BENCHMARK_BOOTSTRAP_RESAMPLES];
+	unsigned long state = 0x9E3779B97F4A7C15UL;
+	for (int r = 0; r < CT_BENCHMARK_BOOTSTRAP_RESAMPLES; r++) {
+		double resample_sum = 0;
+		for (int i = 0; i < kept; i++) {
+			state ^= state << 13;
+			state ^= state >> 7;
+			state ^= state << 17;
+			resample_sum += samples[first + (state % kept)];
+		}
+		means[r] = resample_sum / kept;
+	}
+	qsort(means, CT_BENCHMARK_BOOTSTRAP_RESAMPLES, sizeof(double), ct_compare_times);
+
+	int tail = (int) (CT_BENCHMARK_BOOTSTRAP_RESAMPLES * (1 - CT_BENCHMARK_CONFIDENCE) / 2);
+	point->time_low = means[tail];
+	point->time_high = means[CT_BENCHMARK_BOOTSTRAP_RESAMPLES - 1 - tail];
+}
+
+long ct_benchmark_warmup() {
+	struct timespec start = ct_get_time();
+	long previous_chunk = -1;
+	int stable_chunks = 0;
+	long elapsed = 0;
+
+	while (stable_chunks < CT_BENCHMARK_WARMUP_STABLE_CHUNKS && elapsed < CT_BENCHMARK_MAX_WARMUP_TIME) {
+		struct timespec chunk_start = ct_get_time();
+		volatile long counter = 0;
+		for (long i = 0; i < (1L << 16); i++) {
+			counter += i;
+		}
+		struct timespec chunk_end = ct_get_time();
+
+		long chunk = ct_compute_time_gap(chunk_start, chunk_end, "n");
+		if (previous_chunk >= 0 && labs(chunk - previous_chunk) <= previous_chunk * CT_BENCHMARK_WARMUP_TOLERANCE) {
+			stable_chunks += 1;
+		} else {
+			stable_chunks = 0;
+		}
+		previous_chunk = chunk;
+		elapsed = ct_compute_time_gap(start, chunk_end, "n");
+	}
+
+	return elapsed;
+}
+
+void ct_fit_complexity(struct ct_benchmark_report* report) {
+	double mean = 0;
+	for (int i = 0; i < report->points_number; i++) {
+		mean += report->points[i].time;
+	}
+	mean /= report->points_number;
+
+	bool fitted = false;
+	for (enum ct_complexity complexity = CT_COMPLEXITY_CONSTANT; complexity <= CT_COMPLEXITY_CUBIC; complexity++) {
+		//the least squares of time = coefficient * f(n)
+		double products = 0;
+		double squares = 0;
+		for (int i = 0; i < report->points_number; i++) {
+			double f = ct_complexity_function(complexity, report->points[i].parameter);
+			products += f * report->points[i].time;
+			squares += f * f;
+		}
+		if (squares == 0) {
+			continue;
+		}
+
+		double coefficient = products / squares;
+		double residuals = 0;
+		for (int i = 0; i < report->points_number; i++) {
+			double residual = report->points[i].time - coefficient * ct_complexity_function(complexity, report->points[i].parameter);
+			residuals += residual * residual;
+		}
+		double error = (mean > 0) ? sqrt(residuals / report->points_number) / mean : 0;
+
+		//with the same error, the simplest class wins
+		if (!fitted || error < report->error) {
+			fitted = true;
+			report->complexity = complexity;
+			report->coefficient = coefficient;
+			report->error = error;
+		}
+	}
+}
+
+double ct_complexity_function(enum ct_complexity complexity, long n) {
+	double x = n;
+
+	switch (complexity) {
+	case CT_COMPLEXITY_CONSTANT: return 1;
+	case CT_COMPLEXITY_LOGARITHMIC: return log2(x);
+	case CT_COMPLEXITY_LINEAR: return x;
+	case CT_COMPLEXITY_LINEARITHMIC: return x * log2(x);
+	case CT_COMPLEXITY_QUADRATIC: return x * x;
+	case CT_COMPLEXITY_CUBIC: return x * x * x;
+	default: return 0;
+	}
+}
+
+const char* ct_complexity_to_string(enum ct_complexity complexity) {
+	switch (complexity) {
+	case CT_COMPLEXITY_CONSTANT: return "O(1)";
+	case CT_COMPLEXITY_LOGARITHMIC: return "O(log n)";
+	case CT_COMPLEXITY_LINEAR: return "O(n)";
+	case CT_COMPLEXITY_LINEARITHMIC: return "O(n log n)";
+	case CT_COMPLEXITY_QUADRATIC: return "O(n^2)";
+	case CT_COMPLEXITY_CUBIC: return "O(n^3)";
+	default: return "UNKNOWN";
+	}
+}
+
+bool ct_write_benchmark_curve(const struct ct_benchmark_report* report, const char* directory, const char* description) {
+	char name[CT_BUFFER_SIZE];
+	int length = 0;
+
+	for (const char* c = description; *c != '\0' && length < CT_BUFFER_SIZE / 2; c++) {
+		name[length++] = isalnum((unsigned char) *c) ? *c : '_';
+	}
+	name[length] = '\0';
+
+	//the same layout of a CSV written by CUtils csvProducer
+	FILE* csv = ct_open_curve_file(directory, name, "csv");
+	FILE* dat = ct_open_curve_file(directory, name, "dat");
+	FILE* script = ct_open_curve_file(directory, name, "gp");
+	if (csv == NULL || dat == NULL || script == NULL) {
+		fprintf(stderr, "CrashC - cannot write the curve of the benchmark \"%s\" into \"%s\"\n", description, directory);
+		if (csv != NULL) {
+			fclose(csv);
+		}
+		if (dat != NULL) {
+			fclose(dat);
+		}
+		if (script != NULL) {
+			fclose(script);
+		}
+		return false;
+	}
+
+	fprintf(csv, "sep=,\n");
+	fprintf(csv, "%s,iterations,time_ns,time_low_ns,time_high_ns,outliers,fitted_time_ns,allocations,allocated_bytes,frees\n", report->parameter_name);
+	for (int i = 0; i < report->points_number; i++) {
+		const struct ct_benchmark_point* point = &report->points[i];
+		double fitted = report->coefficient * ct_complexity_function(report->complexity, point->parameter);
+
+		fprintf(csv, "%ld,%ld,%.3f,%.3f,%.3f,%d,%.3f,%.3f,%.3f,%.3f\n",
+				point->parameter, point->iterations, point->time, point->time_low, point->time_high, point->outliers, fitted,
+				point->allocations, point->allocated_bytes, point->frees
+		);
+		fprintf(dat, "%ld %.3f %.3f %.3f %.3f\n", point->parameter, point->time, fitted, point->time_low, point->time_high);
+	}
+
+	//the same script CUtils Plot2DHelper generates, with a logarithmic x axis since the parameter doubles at every point
+	fprintf(script, "reset\n");
+	fprintf(script, "set term png\n");
+	fprintf(script, "set output \"%s/%s.png\"\n", directory, name);
+	fprintf(script, "set title \"%s\\n(%s, %.3g ns)\"\n", name, ct_complexity_to_string(report->complexity), report->coefficient);
+	fprintf(script, "set xlabel \"%s\"\n", report->parameter_name);
+	fprintf(script, "set ylabel \"time (ns)\"\n");
+	fprintf(script, "set logscale x 2\n");
+	fprintf(script, "set xtic rotate\n");
+	fprintf(script, "unset logscale y\n");
+	fprintf(script, "set grid\n");
+	fprintf(script, "plot \"%s/%s.dat\" using 1:2:4:5 title \"measured\" with yerrorlines, ", directory, name);
+	fprintf(script, "\"%s/%s.dat\" using 1:3 title \"%s\" with lines\n", directory, name, ct_complexity_to_string(report->complexity));
+
+	fclose(csv);
+	fclose(dat);
+	fclose(script);
+	return true;
+}
+
+void ct_destroy_benchmark_report(struct ct_benchmark_report* report) {
+	free(report->points);
+	free(report);
+}
+
+void ct_destroy_benchmark(struct ct_benchmark* benchmark) {
+	if (benchmark->report != NULL && benchmark->report->cpu >= 0) {
+		syscall(SYS_sched_setaffinity, 0, sizeof(benchmark->previous_affinity), benchmark->previous_affinity);
+	}
+	if (benchmark->report != NULL) {
+		ct_destroy_benchmark_report(benchmark->report);
+	}
+	free((char*) benchmark->flush_buffer);
+	free(benchmark);
+}
+
+/**
+ * Fits the measurements of the benchmark running right now, stores them in struct ct_model::current_snapshot and disposes of the benchmark
+ *
+ * @param[inout] model the model to handle
+ */
+static void ct_end_benchmark(struct ct_model* model) {
+	struct ct_benchmark* benchmark = model->benchmark;
+
+	ct_allocation_tracker_pause();
+	if (benchmark->report->cpu >= 0) {
+		syscall(SYS_sched_setaffinity, 0, sizeof(benchmark->previous_affinity), benchmark->previous_affinity);
+	}
+	ct_fit_complexity(benchmark->report);
+	if (model->benchmark_output != NULL) {
+		ct_write_benchmark_curve(benchmark->report, model->benchmark_output, benchmark->description);
+	}
+	if (model->current_snapshot->benchmark != NULL) {
+		ct_destroy_benchmark_report(model->current_snapshot->benchmark);
+	}
+	model->current_snapshot->benchmark = benchmark->report;
+	long bound;
+	if (benchmark->report->allocations_counted && model->current_snapshot->status == CT_SNAPSHOT_OK
+			&& ct_tag_ht_get_number(model->current_snapshot->tags, CT_MAX_ALLOCATIONS_TAG, &bound)) {
+		for (int i = 0; i < benchmark->report->points_number; i++) {
+			if (benchmark->report->points[i].allocations > bound) {
+				model->current_snapshot->status = CT_SNAPSHOT_OVER_ALLOCATED;
+			}
+		}
+	}
+	benchmark->report = NULL;
+	ct_destroy_benchmark(benchmark);
+	model->benchmark = NULL;
+	ct_allocation_tracker_resume();
+}
+
+/**
+ * Opens for writing a file of the curve of a benchmark
+ *
+ * @param[in] directory the directory containing the file
+ * @param[in] name the name of the file, without extension
+ * @param[in] extension the extension of the file
+ * @return the file just opened or @null if it can't be opened
+ */
+static FILE* ct_open_curve_file(const char* directory, const char* name, const char* extension) {
+	size_t size = strlen(directory) + strlen(name) + strlen(extension) + 3;
+	char* path = malloc(size);
+	if (path == NULL) {
+		CT_MALLOC_ERROR_CALLBACK();
+	}
+
+	snprintf(path, size, "%s/%s.%s", directory, name, extension);
+	FILE* ret_val = fopen(path, "w");
+	free(path);
+	return ret_val;
+}
+
+/**
+ * Adds to a value of the parameter the blocks the body has allocated and released during the sample just ended
+ *
+ * @param[in] model the model whose struct ct_model::benchmark is running
+ * @param[inout] point the value the sample has been measured for
+ */
+static void ct_count_benchmark_allocations(struct ct_model* model, struct ct_benchmark_point* point) {
+	struct ct_benchmark* benchmark = model->benchmark;
+	unsigned long allocations;
+	size_t allocated_bytes;
+	unsigned long frees;
+
+	ct_allocation_tracker_read(model->allocation_tracker, model->current_snapshot, &allocations, &allocated_bytes, &frees);
+	point->allocations += allocations - benchmark->sample_allocations;
+	point->allocated_bytes += allocated_bytes - benchmark->sample_allocated_bytes;
+	point->frees += frees - benchmark->sample_frees;
+}
+
+/**
+ * Pins the thread running a benchmark to a CPU, saving the CPUs it could run on before
+ *
+ * The system call is used directly since \c sched_setaffinity and \c cpu_set_t are declared only with \c _GNU_SOURCE
+ *
+ * @param[inout] benchmark the benchmark to pin
+ * @param[in] cpu the CPU to pin the benchmark to
+ * @return @true if the benchmark has been pinned, @false otherwise
+ */
+static bool ct_pin_benchmark(struct ct_benchmark* benchmark, int cpu) {
+	unsigned long affinity[CT_BENCHMARK_AFFINITY_WORDS];
+	const int word_bits = 8 * sizeof(unsigned long);
+
+	if (cpu >= CT_BENCHMARK_AFFINITY_WORDS * word_bits) {
+		fprintf(stderr, "CrashC - cannot pin the benchmark \"%s\" to CPU %d: CrashC handles at most %d CPUs\n",
+				benchmark->description, cpu, CT_BENCHMARK_AFFINITY_WORDS * word_bits
+		);
+		return false;
+	}
+	memset(affinity, 0, sizeof(affinity));
+	affinity[cpu / word_bits] = 1UL << (cpu % word_bits);
+	memset(benchmark->previous_affinity, 0, sizeof(benchmark->previous_affinity));
+
+	if (syscall(SYS_sched_getaffinity, 0, sizeof(benchmark->previous_affinity), benchmark->previous_affinity) < 0
+			|| syscall(SYS_sched_setaffinity, 0, sizeof(affinity), affinity) != 0) {
+		fprintf(stderr, "CrashC - cannot pin the benchmark \"%s\" to CPU %d: ", benchmark->description, cpu);
+		perror(NULL);
+		return false;
+	}
+	return true;
+}
+
+/**
+ * Evicts from the cache the data used by the body of a benchmark, by writing a buffer as large as the cache
+ *
+ * @param[inout] benchmark the benchmark whose struct ct_benchmark::flush_buffer needs to be written
+ */
+static void ct_flush_cache(struct ct_benchmark* benchmark) {
+	for (long i = 0; i < benchmark->flush_size; i += 64) {
+		benchmark->flush_buffer[i] += 1;
+	}
+}
+
+static int ct_compare_times(const void* a, const void* b) {
+	double time_a = *((const double*) a);
+	double time_b = *((const double*) b);
+
+	return (time_a > time_b) - (time_a < time_b);
+}
@@ -0,0 +1,330 @@
+/*
+ * binary_report.c
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: koldar
+ */
+
+#include <stdlib.h>
+#include <string.h>
+#include <stdio.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <unistd.h>
+
+#include "binary_report.h"
+#include "model.h"
+#include "test_report.h"
+#include "report_producer.h"
+#include "assertions.h"
+#include "errors.h"
+
+/**
+ * The bytes preceding the payload of an event: its kind and the length of the payload
+ */
+#define CT_BINARY_EVENT_HEADER_SIZE 5
+
+static void ct_binary_snapshot_tree_report(struct ct_binary_writer* writer, struct ct_snapshot* snapshot);
+
+void ct_binary_report(struct ct_model* model) {
+	int fd = open(model->binary_report_path, O_WRONLY | O_CREAT | O_TRUNC, 0644);
+	if (fd < 0) {
+		fprintf(stderr, "CrashC - cannot create the binary report \"%s\"\n", model->binary_report_path);
+		return;
+	}
+
+	struct ct_binary_writer* writer = ct_init_binary_writer(fd);
+	ct_update_test_stats(model);
+
+	CT_ITERATE_ON_LIST(model->test_reports_list, report_cell, report, struct ct_test_report*) {
+		ct_binary_writer_start_event(writer, CT_BINARY_EVENT_TEST_START);
+		ct_binary_writer_u32(writer, report->repetition);
+		ct_binary_writer_string(writer, report->fuzz_input);
+		ct_binary_writer_end_event(writer);
+
+		ct_binary_snapshot_tree_report(writer, report->testcase_snapshot);
+
+		ct_binary_writer_start_event(writer, CT_BINARY_EVENT_TEST_END);
+		ct_binary_writer_u8(writer, report->outcome);
+		ct_binary_writer_end_event(writer);
+	}
+
+	struct ct_test_stats* stats = model->statistics;
+	ct_binary_writer_start_event(writer, CT_BINARY_EVENT_SUMMARY);
+	ct_binary_writer_u32(writer, stats->total_tests);
+	ct_binary_writer_u32(writer, stats->successful_tests);
+	ct_binary_writer_u32(writer, stats->failed_tests);
+	ct_binary_writer_u32(writer, stats->flaky_tests);
+	ct_binary_writer_end_event(writer);
+
+	if (!ct_binary_writer_flush(writer)) {
+		fprintf(stderr, "CrashC - cannot write the binary report \"%s\"\n", model->binary_report_path);
+	}
+	ct_destroy_binary_writer(writer);
+	close(fd);
+}
+
+/**
+ * Writes the events of a snapshot and of all its descendants
+ *
+ * @param[inout] writer the writer to use
+ * @param[in] snapshot the root of the snapshot tree to write
+ */
+static void ct_binary_snapshot_tree_report(struct ct_binary_writer* writer, struct ct_snapshot* snapshot) {
+	ct_binary_writer_start_event(writer, CT_BINARY_EVENT_SNAPSHOT_START);
+	ct_binary_writer_u8(writer, snapshot->type);
+	ct_binary_writer_u8(writer, snapshot->status);
+	ct_binary_writer_u32(writer, snapshot->signal_detected);
+	ct_binary_writer_u32(writer, snapshot->signal_code);
+	ct_binary_writer_u64(writer, snapshot->elapsed_time);
+	ct_binary_writer_u64(writer, snapshot->allocations);
+	ct_binary_writer_u64(writer, snapshot->allocated_bytes);
+	ct_binary_writer_u64(writer, snapshot->frees);
+	ct_binary_writer_u64(writer, snapshot->leaked_blocks);
+	ct_binary_writer_u64(writer, snapshot->leaked_bytes);
+	ct_binary_writer_string(writer, snapshot->description);
+	ct_binary_writer_end_event(writer);
+
+	CT_ITERATE_ON_LIST(snapshot->assertion_reports, assertion_cell, assertion, struct ct_assert_report*) {
+		ct_binary_writer_start_event(writer, CT_BINARY_EVENT_ASSERTION);
+		ct_binary_writer_u8(writer, assertion->passed);
+		ct_binary_writer_u32(writer, assertion->line_number);
+		ct_binary_writer_string(writer, assertion->asserted);
+		ct_binary_writer_string(writer, assertion->expected_str);
+		ct_binary_writer_string(writer, assertion->actual_str);
+		ct_binary_writer_string(writer, assertion->file_name);
+		ct_binary_writer_end_event(writer);
+	}
+
+	for (struct ct_snapshot* child = snapshot->first_child; child != NULL; child = child->next_sibling) {
+		ct_binary_snapshot_tree_report(writer, child);
+	}
+
+	ct_binary_writer_start_event(writer, CT_BINARY_EVENT_SNAPSHOT_END);
+	ct_binary_writer_end_event(writer);
+}
+
+struct ct_binary_writer* ct_init_binary_writer(int fd) {
+	struct ct_binary_writer* ret_val = malloc(sizeof(struct ct_binary_writer));
+	if (ret_val == NULL) {
+		CT_MALLOC_ERROR_CALLBACK();
+	}
+
+	ret_val->fd = fd;
+	ret_val->capacity = CT_BINARY_WRITER_BUFFER_SIZE;
+	ret_val->buffer = malloc(ret_val->capacity);
+	if (ret_val->buffer == NULL) {
+		CT_MALLOC_ERROR_CALLBACK();
+	}
+	ret_val->size = 0;
+	ret_val->event_start = 0;
+	ret_val->failed = false;
+
+	memcpy(ret_val->buffer, CT_BINARY_LOG_MAGIC, strlen(CT_BINARY_LOG_MAGIC));
+	ret_val->size = strlen(CT_BINARY_LOG_MAGIC);
+	ret_val->buffer[ret_val->size] = CT_BINARY_LOG_VERSION;
+	ret_val->size += 1;
+
+	return ret_val;
+}
+
+/**
+ * Writes some bytes into a file descriptor, retrying on partial writes
+ *
+ * @param[in] fd the file descriptor to write into
+ * @param[in] data the bytes to write
+ * @param[in] size the number of bytes inside \c data
+ * @return @true if every byte has been written, @false otherwise
+ */
+static bool ct_write_fully(int fd, const unsigned char* data, size_t size) {
+	while (size > 0) {
+		ssize_t written = write(fd, data, size);
+		if (written < 0) {
+			if (errno == EINTR) {
+				continue;
+			}
+			return false;
+		}
+		data += written;
+		size -= written;
+	}
+	return true;
+}
+
+/**
+ * Ensures the buffer of a writer can contain some more bytes
+ *
+ * The completed events are written into the file first; the buffer grows only if the current event alone doesn't fit in it.
+ *
+ * @param[inout] writer the writer to handle
+ * @param[in] needed the number of bytes to append
+ */
+static void ct_binary_writer_reserve(struct ct_binary_writer* writer, size_t needed) {
+	if (writer->size + needed <= writer->capacity) {
+		return;
+	}
+
+	if (writer->event_start > 0) {
+		if (!ct_write_fully(writer->fd, writer->buffer, writer->event_start)) {
+			writer->failed = true;
+		}
+		memmove(writer->buffer, writer->buffer + writer->event_start, writer->size - writer->event_start);
+		writer->size -= writer->event_start;
+		writer->event_start = 0;
+	}
+	while (writer->size + needed > writer->capacity) {
+		writer->capacity *= 2;
+		writer->buffer = realloc(writer->buffer, writer->capacity);
+		if (writer->buffer == NULL) {
+			CT_MALLOC_ERROR_CALLBACK();
+		}
+	}
+}
+
+/**
+ * Appends some bytes to the buffer of a writer, which needs to be able to contain them
+ *
+ * @param[inout] writer the writer to handle
+ * @param[in] value the value to append
+ * @param[in] bytes the number of least significant bytes of \c value to append, in little endian
+ */
+static void ct_binary_writer_integer(struct ct_binary_writer* writer, uint64_t value, int bytes) {
+	for (int i = 0; i < bytes; i++) {
+		writer->buffer[writer->size + i] = (unsigned char) (value >> (8 * i));
+	}
+	writer->size += bytes;
+}
+
+void ct_binary_writer_start_event(struct ct_binary_writer* writer, enum ct_binary_event_kind kind) {
+	writer->event_start = writer->size;
+	ct_binary_writer_reserve(writer, CT_BINARY_EVENT_HEADER_SIZE);
+	ct_binary_writer_integer(writer, kind, 1);
+	//the length of the payload is known only at the end of the event
+	ct_binary_writer_integer(writer, 0, 4);
+}
+
+void ct_binary_writer_end_event(struct ct_binary_writer* writer) {
+	size_t payload_start = writer->event_start + CT_BINARY_EVENT_HEADER_SIZE;
+	uint32_t length = writer->size - payload_start;
+
+	for (int i = 0; i < 4; i++) {
+		writer->buffer[writer->event_start + 1 + i] = (unsigned char) (length >> (8 * i));
+	}
+	writer->event_start = writer->size;
+}
+
+void ct_binary_writer_u8(struct ct_binary_writer* writer, uint8_t value) {
+	ct_binary_writer_reserve(writer, 1);
+	ct_binary_writer_integer(writer, value, 1);
+}
+
+void ct_binary_writer_u32(struct ct_binary_writer* writer, uint32_t value) {
+	ct_binary_writer_reserve(writer, 4);
+	ct_binary_writer_integer(writer, value, 4);
+}
+
+void ct_binary_writer_u64(struct ct_binary_writer* writer, uint64_t value) {
+	ct_binary_writer_reserve(writer, 8);
+	ct_binary_writer_integer(writer, value, 8);
+}
+
+void ct_binary_writer_string(struct ct_binary_writer* writer, const char* value) {
+	size_t length = (value != NULL) ? strlen(value) : 0;
+
+	ct_binary_writer_reserve(writer, 4 + length + 1);
+	ct_binary_writer_integer(writer, length, 4);
+	if (length > 0) {
+		memcpy(writer->buffer + writer->size, value, length);
+	}
+	writer->buffer[writer->size + length] = '\0';
+	writer->size += length + 1;
+}
+
+bool ct_binary_writer_flush(struct ct_binary_writer* writer) {
+	if (!ct_write_fully(writer->fd, writer->buffer, writer->size)) {
+		writer->failed = true;
+	}
+	writer->size = 0;
+	writer->event_start = 0;
+	return !writer->failed;
+}
+
+void ct_destroy_binary_writer(struct ct_binary_writer* writer) {
+	free(writer->buffer);
+	free(writer);
+}
+
+size_t ct_binary_log_header_size(const unsigned char* data, size_t size) {
+	size_t magic_size = strlen(CT_BINARY_LOG_MAGIC);
+
+	if (size < magic_size + 1 || memcmp(data, CT_BINARY_LOG_MAGIC, magic_size) != 0 || data[magic_size] != CT_BINARY_LOG_VERSION) {
+		return 0;
+	}
+	return magic_size + 1;
+}
+
+size_t ct_read_binary_event(const unsigned char* data, size_t size, struct ct_binary_event* event) {
+	if (size < CT_BINARY_EVENT_HEADER_SIZE) {
+		return 0;
+	}
+
+	size_t length = 0;
+	for (int i = 0; i < 4; i++) {
+		length |= ((size_t) data[1 + i]) << (8 * i);
+	}
+	if (length > size - CT_BINARY_EVENT_HEADER_SIZE) {
+		return 0;
+	}
+
+	event->kind = data[0];
+	event->payload = data + CT_BINARY_EVENT_HEADER_SIZE;
+	event->length = length;
+	event->offset = 0;
+	return CT_BINARY_EVENT_HEADER_SIZE + length;
+}
+
+/**
+ * Reads a little endian integer from the payload of an event
+ *
+ * @param[inout] event the event to read
+ * @param[in] bytes the number of bytes of the integer
+ * @return the value read, 0 if the payload has not enough bytes left
+ */
+static uint64_t ct_binary_event_integer(struct ct_binary_event* event, int bytes) {
+	uint64_t ret_val = 0;
+
+	if (event->offset + bytes > event->length) {
+		event->offset = event->length;
+		return 0;
+	}
+	for (int i = 0; i < bytes; i++) {
+		ret_val |= ((uint64_t) event->payload[event->offset + i]) << (8 * i);
+	}
+	event->offset += bytes;
+	return ret_val;
+}
+
+uint8_t ct_binary_event_u8(struct ct_binary_event* event) {
+	return (uint8_t) ct_binary_event_integer(event, 1);
+}
+
+uint32_t ct_binary_event_u32(struct ct_binary_event* event) {
+	return (uint32_t) ct_binary_event_integer(event, 4);
+}
+
+uint64_t ct_binary_event_u64(struct ct_binary_event* event) {
+	return ct_binary_event_integer(event, 8);
+}
+
+const char* ct_binary_event_string(struct ct_binary_event* event) {
+	size_t length = ct_binary_event_u32(event);
+
+	if (event->offset + length + 1 > event->length || event->payload[event->offset + length] != '\0') {
+		event->offset = event->length;
+		return "";
+	}
+
+	const char* ret_val = (const char*) (event->payload + event->offset);
+	event->offset += length + 1;
+	return ret_val;
+}
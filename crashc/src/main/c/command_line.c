@@ -9,16 +9,51 @@
 #include <stdlib.h>
 #include <getopt.h>
 #include <stdbool.h>
+#include <unistd.h>
 
 #include "command_line.h"
 #include "tag.h"
 #include "macros.h"
+#include "model.h"
+#include "report_producer.h"
+#include "binary_report.h"
+#include "progress.h"
+#include "section_fork.h"
+#include "output_capture.h"
+#include "journal.h"
+#include "suite_order.h"
+#include "coverage.h"
+#include "hardware_counters.h"
 
 static struct option long_options[] = {
 	{"include_tag",		required_argument,	0,	'i'},
 	{"include_tags",	required_argument,	0,	'I'},
 	{"exclude_tag",		required_argument,	0,	'e'},
 	{"exclude_tags",	required_argument,	0,	'E'},
+	{"schedule_seeds",	required_argument,	0,	's'},
+	{"schedule_seed",	required_argument,	0,	'S'},
+	{"workers",			required_argument,	0,	'w'},
+	{"corpus",			required_argument,	0,	'c'},
+	{"repeat",			required_argument,	0,	'r'},
+	{"binary_report",	required_argument,	0,	'b'},
+	{"progress",		no_argument,		0,	'p'},
+	{"history",			required_argument,	0,	'H'},
+	{"section",			required_argument,	0,	'P'},
+	{"fork_sections",	no_argument,		0,	'f'},
+	{"capture_output",	no_argument,		0,	'C'},
+	{"journal",			required_argument,	0,	'j'},
+	{"resume",			no_argument,		0,	'R'},
+	{"order",			required_argument,	0,	'O'},
+	{"coordinator",		required_argument,	0,	'D'},
+	{"worker",			required_argument,	0,	'W'},
+	{"coverage_index",	required_argument,	0,	'g'},
+	{"collect_coverage",	no_argument,		0,	'G'},
+	{"changed_files",	required_argument,	0,	'X'},
+	{"benchmark_output",	required_argument,	0,	'B'},
+	{"benchmark_cpu",	required_argument,	0,	'a'},
+	{"cold_cache",		no_argument,		0,	'F'},
+	{"resource_usage",	no_argument,		0,	'u'},
+	{"hardware_counters",	no_argument,		0,	'K'},
 	{"help",			no_argument,		0,	'h'},
 	{0,					0,					0,	0}
 };
@@ -72,6 +107,170 @@ void ct_print_help(FILE* fout) {
 			);
 			break;
 		}
+		case 's': {
+			fprintf(fout,
+					"Serializes the threads of every STRESS section and explores the given number of thread interleavings. "
+					"Each interleaving is generated by a seed and run in its own process."
+			);
+			break;
+		}
+		case 'S': {
+			fprintf(fout,
+					"Replays only the thread interleaving generated by the given seed in every STRESS section. "
+					"Overrides \"s\"."
+			);
+			break;
+		}
+		case 'c': {
+			fprintf(fout,
+					"The directory containing the inputs every FUZZ_TESTCASE is run with. "
+					"Without it, a FUZZ_TESTCASE is run only with the empty input."
+			);
+			break;
+		}
+		case 'r': {
+			fprintf(fout,
+					"Runs every test suite the given number of times and flags as flaky the tests whose outcome changes among the runs."
+			);
+			break;
+		}
+		case 'b': {
+			fprintf(fout,
+					"Writes the outcome of the tests in the given file as a binary event log instead of printing the textual report. "
+					"Render it with the crashc-report tool."
+			);
+			break;
+		}
+		case 'p': {
+			fprintf(fout,
+					"Shows on the terminal how many tests have ended and an estimate of the remaining time while the tests are running."
+			);
+			break;
+		}
+		case 'H': {
+			fprintf(fout,
+					"The file where the timings of the tests are stored at the end of the run. "
+					"The timings of the previous run are used to estimate the remaining time."
+			);
+			break;
+		}
+		case 'P': {
+			fprintf(fout,
+					"Runs only the section with the given path, namely the descriptions of the test case and of the nested sections separated by '/' "
+					"(e.g. \"list/adding on tail/size increments\"). Its ancestors are entered as well, every other section is skipped."
+			);
+			break;
+		}
+		case 'f': {
+			fprintf(fout,
+					"Runs every WHEN in a forked process, so that the code preceding a WHEN is run once and not once per nested section. "
+					"The outcomes don't change only if such code has no side effects outside the process, like writing files."
+			);
+			break;
+		}
+		case 'C': {
+			fprintf(fout,
+					"Captures what every test writes on the standard output and on the standard error. "
+					"The output is shown in the report of the failed tests and thrown away for the successful ones."
+			);
+			break;
+		}
+		case 'j': {
+			fprintf(fout,
+					"Appends every test to the given journal as soon as it ends, so that the outcomes survive a killed test process. "
+					"The summary of the journal is shown by \"crashc-report --journal\"."
+			);
+			break;
+		}
+		case 'O': {
+			fprintf(fout,
+					"The order the test suites are run in: \"declaration\" (the default), \"durations\" to run first the ones which took longer "
+					"or \"failures\" to run first the ones which failed more often. The two latter need the history file given with \"H\". "
+					"The report keeps the declaration order."
+			);
+			break;
+		}
+		case 'D': {
+			fprintf(fout,
+					"Serves the test cases on the given address, either \"unix:PATH\" or \"tcp:HOST:PORT\", to the local workers (see \"w\") "
+					"and to the workers joining with \"W\". Every test case is run by the first worker claiming it, and the report contains the tests of every worker."
+			);
+			break;
+		}
+		case 'W': {
+			fprintf(fout,
+					"Runs the test cases for the coordinator listening on the given address. "
+					"The worker needs to be the same test executable, run with the same options, as the coordinator."
+			);
+			break;
+		}
+		case 'g': {
+			fprintf(fout,
+					"The index of the source files covered by every test case, written by \"G\" and read by \"X\"."
+			);
+			break;
+		}
+		case 'G': {
+			fprintf(fout,
+					"Collects the source files covered by every test case into the index given with \"g\". "
+					"CrashC and the tests need to be built with --coverage and CT_COVERAGE (cmake -DU_COVERAGE=true)."
+			);
+			break;
+		}
+		case 'X': {
+			fprintf(fout,
+					"Runs only the test cases covering the files listed, one per line, in the given file (\"-\" for the standard input), "
+					"like the ones printed by \"git diff --name-only\". The coverage is read from the index given with \"g\": "
+					"the test cases missing from it are run, and a changed file missing from it runs every test case."
+			);
+			break;
+		}
+		case 'B': {
+			fprintf(fout,
+					"Writes into the given directory the curve of every benchmark, as a CSV file and as a gnuplot script drawing it."
+			);
+			break;
+		}
+		case 'a': {
+			fprintf(fout,
+					"Pins the benchmarks to the given CPU, ideally one isolated from the scheduler with the isolcpus kernel parameter."
+			);
+			break;
+		}
+		case 'F': {
+			fprintf(fout,
+					"Measures the benchmarks with a cold cache, by writing a buffer as large as the last level cache before every sample. "
+					"By default the cache is warmed up by running the body once before measuring it."
+			);
+			break;
+		}
+		case 'u': {
+			fprintf(fout,
+					"Measures the operating system resources (memory, page faults, context switches, CPU time) consumed by every section and reports them."
+			);
+			break;
+		}
+		case 'K': {
+			fprintf(fout,
+					"Reads the hardware performance counters (instructions, cycles, cache and branch misses) while every section runs "
+					"and reports them together with its elapsed time. The counters are opened only when this option is given."
+			);
+			break;
+		}
+		case 'R': {
+			fprintf(fout,
+					"Keeps the content of the journal given with \"j\" and skips the test cases it has already completed."
+			);
+			break;
+		}
+		case 'w': {
+			fprintf(fout,
+					"The maximum number of processes exploring thread interleavings or replaying fuzzing inputs at the same time, "
+					"and the number of local workers of a coordinator. "
+					"By default, the number of online CPUs."
+			);
+			break;
+		}
 		}
 
 		fprintf(fout, "\n");
@@ -80,13 +279,15 @@ void ct_print_help(FILE* fout) {
 	}
 }
 
-void ct_parse_args(const int argc, char* const* args, char tag_separator, ct_tag_hashtable_o* run_tags, ct_tag_hashtable_o* exclude_tags) {
+void ct_parse_args(const int argc, char* const* args, char tag_separator, struct ct_model* model) {
+	ct_tag_hashtable_o* run_tags = model->run_only_if_tags;
+	ct_tag_hashtable_o* exclude_tags = model->exclude_tags;
 
 	while (true) {
 		/* getopt_long stores the option index here. */
 		int option_index = 0;
 
-		int optionId = getopt_long (argc, args, "i:I:e:E:", long_options, &option_index);
+		int optionId = getopt_long (argc, args, "i:I:e:E:s:S:w:c:r:b:pH:P:fCj:RO:D:W:g:GX:B:a:FuK", long_options, &option_index);
 
 		/* Detect the end of the options. */
 		if (optionId == -1)
@@ -119,6 +320,111 @@ void ct_parse_args(const int argc, char* const* args, char tag_separator, ct_tag
 			ct_tag_ht_populate(exclude_tags, optarg, tag_separator);
 			break;
 		}
+		case 's': {
+			model->schedule_seeds = strtol(optarg, NULL, 10);
+			break;
+		}
+		case 'S': {
+			model->schedule_replay_seed = strtol(optarg, NULL, 10);
+			break;
+		}
+		case 'w': {
+			model->workers = (int) strtol(optarg, NULL, 10);
+			break;
+		}
+		case 'r': {
+			model->repetitions = (int) strtol(optarg, NULL, 10);
+			break;
+		}
+		case 'c': {
+			model->corpus_path = optarg;
+			break;
+		}
+		case 'b': {
+			model->binary_report_path = optarg;
+			model->report_producer_implementation->report_producer = ct_binary_report;
+			break;
+		}
+		case 'p': {
+			model->show_progress = true;
+			break;
+		}
+		case 'H': {
+			model->history_path = optarg;
+			break;
+		}
+		case 'P': {
+			ct_select_section_path(model, optarg);
+			break;
+		}
+		case 'f': {
+			if (model->section_fork == NULL) {
+				model->section_fork = ct_init_section_fork();
+			}
+			break;
+		}
+		case 'j': {
+			model->journal_path = optarg;
+			break;
+		}
+		case 'R': {
+			model->resume = true;
+			break;
+		}
+		case 'D': {
+			model->coordinator_address = optarg;
+			break;
+		}
+		case 'W': {
+			model->worker_address = optarg;
+			break;
+		}
+		case 'g': {
+			model->coverage_index_path = optarg;
+			break;
+		}
+		case 'G': {
+			model->collect_coverage = true;
+			break;
+		}
+		case 'X': {
+			model->changed_files_path = optarg;
+			break;
+		}
+		case 'B': {
+			model->benchmark_output = optarg;
+			break;
+		}
+		case 'a': {
+			model->benchmark_cpu = (int) strtol(optarg, NULL, 10);
+			break;
+		}
+		case 'F': {
+			model->benchmark_cold_cache = true;
+			break;
+		}
+		case 'u': {
+			model->measure_resources = true;
+			break;
+		}
+		case 'K': {
+			if (model->hardware_counters == NULL) {
+				model->hardware_counters = ct_init_hardware_counters_group();
+			}
+			break;
+		}
+		case 'O': {
+			if (!ct_parse_suite_order(optarg, &model->suite_order)) {
+				fprintf(stderr, "CrashC - unknown order \"%s\": the test suites will be run in declaration order\n", optarg);
+			}
+			break;
+		}
+		case 'C': {
+			if (model->output_capture == NULL) {
+				model->output_capture = ct_init_output_capture();
+			}
+			break;
+		}
 		case '?': {
 			/* getopt_long already printed an error message. */
 			break;
@@ -129,6 +435,31 @@ void ct_parse_args(const int argc, char* const* args, char tag_separator, ct_tag
 		}
 	}
 
+	//the progress line would only clutter a file or a pipe
+	if (model->show_progress || model->history_path != NULL) {
+		FILE* progress_output = (model->show_progress && isatty(fileno(stderr))) ? stderr : NULL;
+		//the standard error of the tests may be captured, but the progress line belongs to the terminal
+		if (progress_output != NULL && model->output_capture != NULL) {
+			progress_output = ct_output_capture_get_original_stderr(model->output_capture);
+		}
+		ct_enable_progress(model, progress_output, model->history_path);
+	}
+	if (model->journal_path != NULL) {
+		ct_enable_journal(model, model->journal_path, model->resume);
+	} else if (model->resume) {
+		fprintf(stderr, "CrashC - \"resume\" needs a journal to resume from: every test will be run\n");
+	}
+	if (model->coverage_index_path != NULL && model->collect_coverage) {
+		if (model->changed_files_path != NULL) {
+			fprintf(stderr, "CrashC - \"changed_files\" is ignored while collecting the coverage\n");
+		}
+		ct_enable_coverage(model, model->coverage_index_path, true, NULL);
+	} else if (model->coverage_index_path != NULL && model->changed_files_path != NULL) {
+		ct_enable_coverage(model, model->coverage_index_path, false, model->changed_files_path);
+	} else if (model->collect_coverage || model->changed_files_path != NULL) {
+		fprintf(stderr, "CrashC - the coverage needs an index given with \"coverage_index\": every test will be run\n");
+	}
+
 //  ACTIVATE IF YOU WANT TO SEE WHAT TAGS HAVE BEEN STORED
 //	CT_ITERATE_VALUES_ON_HT(runIfTags, t, struct ct_tag*) {
 //		printf("run if tag: %s\n", t->name);
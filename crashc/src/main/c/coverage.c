@@ -0,0 +1,507 @@
+/*
+ * coverage.c
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: koldar
+ */
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <stdint.h>
+#include <string.h>
+#include <dirent.h>
+#include <unistd.h>
+#include <sys/stat.h>
+#include <sys/types.h>
+
+#include "coverage.h"
+#include "model.h"
+#include "section.h"
+#include "section_fork.h"
+#include "tag.h"
+#include "allocation_tracker.h"
+#include "macros.h"
+#include "errors.h"
+
+#ifdef CT_COVERAGE
+//provided by libgcov, linked into the executables built with --coverage
+void __gcov_reset(void);
+void __gcov_dump(void);
+#endif
+
+/**
+ * The magic number starting a \c .gcda file
+ */
+#define CT_GCDA_MAGIC 0x67636461
+/**
+ * The tag of the record containing the counters of the arcs of a function
+ */
+#define CT_GCDA_ARCS_TAG 0x01a10000
+/**
+ * Since gcc 12 the header of a \c .gcda file has a checksum more and the length of the records is in bytes rather than in words.
+ * clang writes the format of the older gcc versions
+ */
+#if defined(__clang__) || !defined(__GNUC__) || __GNUC__ < 12
+#	define CT_GCDA_HEADER_WORDS 3
+#	define CT_GCDA_LENGTH_IN_BYTES false
+#else
+#	define CT_GCDA_HEADER_WORDS 4
+#	define CT_GCDA_LENGTH_IN_BYTES true
+#endif
+
+static struct ct_covered_file* ct_find_covered_file(const struct ct_coverage* coverage, const char* name) {
+	struct ct_covered_file* ret_val = ct_ht_get(coverage->files_index, (unsigned long) ct_string_hash(name));
+
+	if (ret_val == NULL || strcmp(ret_val->name, name) == 0) {
+		return ret_val;
+	}
+	//on a hash collision the files are looked for one by one
+	CT_ITERATE_ON_LIST(coverage->files, cell, file, struct ct_covered_file*) {
+		if (strcmp(file->name, name) == 0) {
+			return file;
+		}
+	}
+	return NULL;
+}
+
+static struct ct_covered_file* ct_add_covered_file(struct ct_coverage* coverage, const char* name) {
+	struct ct_covered_file* ret_val = malloc(sizeof(struct ct_covered_file));
+	if (ret_val == NULL) {
+		CT_MALLOC_ERROR_CALLBACK();
+	}
+	ret_val->name = strdup(name);
+	if (ret_val->name == NULL) {
+		CT_MALLOC_ERROR_CALLBACK();
+	}
+
+	ret_val->id = ct_list_size(coverage->files);
+	ct_list_add_tail(coverage->files, ret_val);
+	if (ct_ht_get(coverage->files_index, (unsigned long) ct_string_hash(name)) == NULL) {
+		ct_ht_put(coverage->files_index, (unsigned long) ct_string_hash(name), ret_val);
+	}
+
+	return ret_val;
+}
+
+static void ct_destroy_covered_file(struct ct_covered_file* file) {
+	free(file->name);
+	free(file);
+}
+
+static struct ct_covered_testcase* ct_add_covered_testcase(struct ct_coverage* coverage, const struct ct_testcase_key* key, int files_number, int* files) {
+	struct ct_covered_testcase* ret_val = malloc(sizeof(struct ct_covered_testcase));
+	if (ret_val == NULL) {
+		CT_MALLOC_ERROR_CALLBACK();
+	}
+
+	ret_val->key = *key;
+	ret_val->files_number = files_number;
+	ret_val->files = files;
+	ct_list_add_tail(coverage->testcases, ret_val);
+	if (ct_ht_get(coverage->testcases_index, ct_testcase_key_hash(key)) == NULL) {
+		ct_ht_put(coverage->testcases_index, ct_testcase_key_hash(key), ret_val);
+	}
+
+	return ret_val;
+}
+
+static void ct_destroy_covered_testcase(struct ct_covered_testcase* testcase) {
+	free(testcase->files);
+	free(testcase);
+}
+
+/**
+ * Checks whether a file of the index has the name of a changed file
+ *
+ * Only the names are compared, so that the paths printed by the version control system don't need to match the ones of the build directory.
+ *
+ * @param[in] file the file of the index
+ * @param[in] changed_file the path of the changed file
+ * @return @true if \c changed_file may be the source file of \c file
+ */
+static bool ct_covered_file_matches(const struct ct_covered_file* file, const char* changed_file) {
+	const char* file_name = strrchr(file->name, '/');
+	const char* changed_name = strrchr(changed_file, '/');
+	file_name = (file_name != NULL) ? file_name + 1 : file->name;
+	changed_name = (changed_name != NULL) ? changed_name + 1 : changed_file;
+
+	size_t length = strlen(file_name);
+	//the .gcda file of an object file doesn't have the extension of the source file
+	return strncmp(file_name, changed_name, length) == 0 && (changed_name[length] == '\0' || changed_name[length] == '.');
+}
+
+/**
+ * Reads a coverage index
+ *
+ * @param[inout] coverage the state to fill
+ * @param[in] path the index
+ */
+static void ct_load_coverage_index(struct ct_coverage* coverage, const char* path) {
+	FILE* file = fopen(path, "r");
+	if (file == NULL) {
+		perror("CrashC - cannot open the coverage index");
+		exit(EXIT_FAILURE);
+	}
+
+	char* line = NULL;
+	size_t line_size = 0;
+	ssize_t length;
+	while ((length = getline(&line, &line_size, file)) > 0) {
+		line[strcspn(line, "\n")] = '\0';
+		if (line[0] == 'F' && line[1] == ' ') {
+			ct_add_covered_file(coverage, &line[2]);
+			continue;
+		}
+
+		struct ct_testcase_key key;
+		int files_number;
+		int read;
+		if (sscanf(line, "T %lx %d %d%n", &key.path_hash, &key.occurrence, &files_number, &read) != 3 || files_number < 0) {
+			continue;
+		}
+		int* files = malloc(sizeof(int) * (files_number + 1));
+		if (files == NULL) {
+			CT_MALLOC_ERROR_CALLBACK();
+		}
+		char* next = &line[read];
+		for (int i = 0; i < files_number; i++) {
+			files[i] = (int) strtol(next, &next, 10);
+		}
+		ct_add_covered_testcase(coverage, &key, files_number, files);
+	}
+
+	free(line);
+	fclose(file);
+}
+
+/**
+ * Reads the changed files and marks the files of the index with their names
+ *
+ * @param[inout] coverage the state to handle
+ * @param[in] path the list of the changed files. \c "-" for the standard input
+ */
+static void ct_load_changed_files(struct ct_coverage* coverage, const char* path) {
+	FILE* file = (strcmp(path, "-") == 0) ? stdin : fopen(path, "r");
+	if (file == NULL) {
+		perror("CrashC - cannot open the list of the changed files");
+		exit(EXIT_FAILURE);
+	}
+
+	coverage->changed = calloc(ct_list_size(coverage->files) + 1, sizeof(bool));
+	if (coverage->changed == NULL) {
+		CT_MALLOC_ERROR_CALLBACK();
+	}
+
+	char* line = NULL;
+	size_t line_size = 0;
+	while (getline(&line, &line_size, file) > 0) {
+		line[strcspn(line, "\r\n")] = '\0';
+		if (line[0] == '\0') {
+			continue;
+		}
+		bool found = false;
+		CT_ITERATE_ON_LIST(coverage->files, cell, covered_file, struct ct_covered_file*) {
+			if (ct_covered_file_matches(covered_file, line)) {
+				coverage->changed[covered_file->id] = true;
+				found = true;
+			}
+		}
+		if (!found && !coverage->run_everything) {
+			fprintf(stderr, "CrashC - the changed file \"%s\" is not in the coverage index: every test case will be run\n", line);
+			coverage->run_everything = true;
+		}
+	}
+
+	free(line);
+	if (file != stdin) {
+		fclose(file);
+	}
+}
+
+/**
+ * Checks whether a \c .gcda file has a counter not zero
+ *
+ * @param[in] path the \c .gcda file
+ * @return @true if the code of the file has been run since the last reset of the counters
+ */
+static bool ct_gcda_file_covered(const char* path) {
+	FILE* file = fopen(path, "r");
+	if (file == NULL) {
+		return false;
+	}
+
+	bool ret_val = false;
+	uint32_t header[CT_GCDA_HEADER_WORDS];
+	if (fread(header, sizeof(uint32_t), CT_GCDA_HEADER_WORDS, file) != CT_GCDA_HEADER_WORDS || header[0] != CT_GCDA_MAGIC) {
+		fclose(file);
+		return false;
+	}
+
+	uint32_t record[2];
+	while (!ret_val && fread(record, sizeof(uint32_t), 2, file) == 2 && record[0] != 0) {
+		long length = CT_GCDA_LENGTH_IN_BYTES ? (long) (int32_t) record[1] : (long) record[1] * (long) sizeof(uint32_t);
+		//a negative length marks a record whose counters are all zero, written without them
+		if (length <= 0) {
+			continue;
+		}
+		if (record[0] != CT_GCDA_ARCS_TAG) {
+			fseek(file, length, SEEK_CUR);
+			continue;
+		}
+		for (long i = 0; i < length / (long) sizeof(uint64_t); i++) {
+			uint64_t counter;
+			if (fread(&counter, sizeof(counter), 1, file) != 1) {
+				break;
+			}
+			if (counter != 0) {
+				ret_val = true;
+				break;
+			}
+		}
+	}
+
+	fclose(file);
+	return ret_val;
+}
+
+/**
+ * Looks for the \c .gcda files dumped by gcov, collects the covered ones and removes them
+ *
+ * @param[inout] coverage the state to handle
+ * @param[in] directory the directory to look into
+ * @param[inout] files the struct ct_covered_file::id of the covered files
+ * @param[inout] files_number the number of items in \c files
+ * @param[inout] capacity the number of items \c files can contain
+ */
+static void ct_collect_gcda_files(struct ct_coverage* coverage, const char* directory, int** files, int* files_number, int* capacity) {
+	DIR* dir = opendir(directory);
+	if (dir == NULL) {
+		return;
+	}
+
+	struct dirent* entry;
+	struct stat file_stat;
+	char path[CT_BUFFER_SIZE * 4];
+	while ((entry = readdir(dir)) != NULL) {
+		if (strcmp(entry->d_name, ".") == 0 || strcmp(entry->d_name, "..") == 0) {
+			continue;
+		}
+		snprintf(path, sizeof(path), "%s/%s", directory, entry->d_name);
+		if (lstat(path, &file_stat) != 0) {
+			continue;
+		}
+		if (S_ISDIR(file_stat.st_mode)) {
+			ct_collect_gcda_files(coverage, path, files, files_number, capacity);
+			continue;
+		}
+
+		size_t length = strlen(path);
+		if (length <= 5 || strcmp(&path[length - 5], ".gcda") != 0) {
+			continue;
+		}
+		bool covered = ct_gcda_file_covered(path);
+		unlink(path);
+
+		//the name is the path the file would have had without GCOV_PREFIX
+		path[length - 5] = '\0';
+		const char* name = &path[strlen(coverage->directory)];
+		struct ct_covered_file* file = ct_find_covered_file(coverage, name);
+		if (file == NULL) {
+			file = ct_add_covered_file(coverage, name);
+		}
+		if (!covered) {
+			continue;
+		}
+		if (*files_number == *capacity) {
+			*capacity *= 2;
+			*files = realloc(*files, sizeof(int) * (*capacity));
+			if (*files == NULL) {
+				CT_MALLOC_ERROR_CALLBACK();
+			}
+		}
+		(*files)[*files_number] = file->id;
+		*files_number += 1;
+	}
+
+	closedir(dir);
+}
+
+static void ct_remove_directory(const char* directory) {
+	DIR* dir = opendir(directory);
+	if (dir == NULL) {
+		return;
+	}
+
+	struct dirent* entry;
+	struct stat file_stat;
+	char path[CT_BUFFER_SIZE * 4];
+	while ((entry = readdir(dir)) != NULL) {
+		if (strcmp(entry->d_name, ".") == 0 || strcmp(entry->d_name, "..") == 0) {
+			continue;
+		}
+		snprintf(path, sizeof(path), "%s/%s", directory, entry->d_name);
+		if (lstat(path, &file_stat) == 0 && S_ISDIR(file_stat.st_mode)) {
+			ct_remove_directory(path);
+		} else {
+			unlink(path);
+		}
+	}
+	closedir(dir);
+	rmdir(directory);
+}
+
+static void ct_write_coverage_index(const struct ct_coverage* coverage) {
+	FILE* file = fopen(coverage->index_path, "w");
+	if (file == NULL) {
+		perror("CrashC - cannot write the coverage index");
+		return;
+	}
+
+	CT_ITERATE_ON_LIST(coverage->files, cell, covered_file, struct ct_covered_file*) {
+		fprintf(file, "F %s\n", covered_file->name);
+	}
+	CT_ITERATE_ON_LIST(coverage->testcases, cell2, testcase, struct ct_covered_testcase*) {
+		fprintf(file, "T %lx %d %d", testcase->key.path_hash, testcase->key.occurrence, testcase->files_number);
+		for (int i = 0; i < testcase->files_number; i++) {
+			fprintf(file, " %d", testcase->files[i]);
+		}
+		fprintf(file, "\n");
+	}
+	fclose(file);
+}
+
+struct ct_coverage* ct_enable_coverage(struct ct_model* model, const char* index_path, bool collect, const char* changed_files_path) {
+	struct ct_coverage* ret_val = malloc(sizeof(struct ct_coverage));
+	if (ret_val == NULL) {
+		CT_MALLOC_ERROR_CALLBACK();
+	}
+
+	ret_val->collecting = collect;
+	ret_val->index_path = NULL;
+	ret_val->directory[0] = '\0';
+	ret_val->previous_prefix = NULL;
+	ret_val->files = ct_list_init();
+	ret_val->files_index = ct_ht_init();
+	ret_val->testcases = ct_list_init();
+	ret_val->testcases_index = ct_ht_init();
+	ret_val->changed = NULL;
+	ret_val->run_everything = false;
+	ret_val->testcase = NULL;
+	ret_val->selected = true;
+	ret_val->skipped_testcases = 0;
+
+	if (collect) {
+#ifndef CT_COVERAGE
+		fprintf(stderr, "CrashC - the coverage can be collected only if CrashC and the tests are built with --coverage and CT_COVERAGE\n");
+		exit(EXIT_FAILURE);
+#endif
+		ret_val->index_path = strdup(index_path);
+		if (ret_val->index_path == NULL) {
+			CT_MALLOC_ERROR_CALLBACK();
+		}
+		snprintf(ret_val->directory, sizeof(ret_val->directory), "/tmp/crashc-coverage-XXXXXX");
+		if (mkdtemp(ret_val->directory) == NULL) {
+			perror("CrashC - cannot create the directory of the coverage");
+			exit(EXIT_FAILURE);
+		}
+		const char* previous_prefix = getenv("GCOV_PREFIX");
+		if (previous_prefix != NULL) {
+			ret_val->previous_prefix = strdup(previous_prefix);
+		}
+		setenv("GCOV_PREFIX", ret_val->directory, 1);
+
+		if (model->section_fork != NULL) {
+			fprintf(stderr, "CrashC - \"fork_sections\" is ignored while collecting the coverage\n");
+			ct_destroy_section_fork(model->section_fork);
+			model->section_fork = NULL;
+		}
+		if (model->coordinator_address != NULL || model->worker_address != NULL) {
+			fprintf(stderr, "CrashC - the test cases are not distributed while collecting the coverage\n");
+			model->coordinator_address = NULL;
+			model->worker_address = NULL;
+		}
+	} else {
+		ct_load_coverage_index(ret_val, index_path);
+		ct_load_changed_files(ret_val, changed_files_path);
+	}
+
+	model->coverage = ret_val;
+	return ret_val;
+}
+
+bool ct_coverage_enter_testcase(struct ct_model* model, const struct ct_section* testcase) {
+	struct ct_coverage* coverage = model->coverage;
+
+	if (testcase == coverage->testcase) {
+		return coverage->selected;
+	}
+	coverage->testcase = testcase;
+	const struct ct_testcase_key* key = ct_get_testcase_key(model, testcase);
+
+	if (coverage->collecting) {
+#ifdef CT_COVERAGE
+		__gcov_reset();
+#endif
+		coverage->selected = true;
+		return true;
+	}
+
+	struct ct_covered_testcase* covered = ct_ht_get(coverage->testcases_index, ct_testcase_key_hash(key));
+	//on a hash collision the testcase is simply run
+	coverage->selected = coverage->run_everything || covered == NULL || covered->key.path_hash != key->path_hash || covered->key.occurrence != key->occurrence;
+	for (int i = 0; !coverage->selected && i < covered->files_number; i++) {
+		int id = covered->files[i];
+		coverage->selected = id >= 0 && id < ct_list_size(coverage->files) && coverage->changed[id];
+	}
+	if (!coverage->selected) {
+		coverage->skipped_testcases += 1;
+	}
+	return coverage->selected;
+}
+
+void ct_coverage_end_testcase(struct ct_model* model, const struct ct_section* testcase) {
+	struct ct_coverage* coverage = model->coverage;
+
+	if (!coverage->collecting || testcase != coverage->testcase) {
+		return;
+	}
+
+#ifdef CT_COVERAGE
+	__gcov_dump();
+#endif
+	ct_allocation_tracker_pause();
+	int capacity = 16;
+	int files_number = 0;
+	int* files = malloc(sizeof(int) * capacity);
+	if (files == NULL) {
+		CT_MALLOC_ERROR_CALLBACK();
+	}
+	ct_collect_gcda_files(coverage, coverage->directory, &files, &files_number, &capacity);
+	ct_add_covered_testcase(coverage, ct_get_testcase_key(model, testcase), files_number, files);
+	//the next calls refer to another testcase
+	coverage->testcase = NULL;
+	ct_allocation_tracker_resume();
+}
+
+void ct_destroy_coverage(struct ct_coverage* coverage) {
+	if (coverage->collecting) {
+		ct_write_coverage_index(coverage);
+		ct_remove_directory(coverage->directory);
+		if (coverage->previous_prefix != NULL) {
+			setenv("GCOV_PREFIX", coverage->previous_prefix, 1);
+		} else {
+			unsetenv("GCOV_PREFIX");
+		}
+	} else if (coverage->skipped_testcases > 0) {
+		fprintf(stderr, "CrashC - %d test cases not affected by the changed files have been skipped\n", coverage->skipped_testcases);
+	}
+
+	ct_list_destroy_with_elements(coverage->files, (ct_destroyer_c) ct_destroy_covered_file);
+	ct_ht_destroy(coverage->files_index);
+	ct_list_destroy_with_elements(coverage->testcases, (ct_destroyer_c) ct_destroy_covered_testcase);
+	ct_ht_destroy(coverage->testcases_index);
+	free(coverage->changed);
+	free(coverage->index_path);
+	free(coverage->previous_prefix);
+	free(coverage);
+}
@@ -2,45 +2,19 @@
 #include "crashc.h"
 #include "main_model.h"
 #include "list.h"
+#include "output_capture.h"
+#include "journal.h"
+#include "distribution.h"
+#include "coverage.h"
+#include "suite_order.h"
 
-void ct_update_test_array(struct ct_model* model, ct_test_c func) {
+void ct_update_test_array(struct ct_model* model, ct_test_c func, const char* name) {
 	model->tests_array[model->suites_array_index] = func;
+	model->suites_names[model->suites_array_index] = name;
+	model->suites_order[model->suites_array_index] = model->suites_array_index;
 	model->suites_array_index++;
 }
 
-bool ct_run_once_check_access(struct ct_model* model, struct ct_section* section, ct_access_c cs, ct_enter_c callback, const ct_tag_hashtable_o* restrict run_tags, const ct_tag_hashtable_o* restrict exclude_tags) {
-	if (!section->loop2) {
-		return false;
-	}
-
-	//TODO here we need  to replace the parameter runOnlyWithTags and excludeIfTags with a pointer of the global model
-	//check if the section we're dealing with is compliant with the context tags
-	if (!ct_ht_is_empty(exclude_tags)) {
-		if (ct_have_tag_set_intersection(section->tags, exclude_tags)) {
-			section->tag_access_granted = false;
-			section->access_granted = false;
-			ct_section_set_skipped(section);
-			return false;
-		}
-	}
-
-	if (!ct_ht_is_empty(run_tags)) {
-		if (!ct_have_tag_set_intersection(section->tags, run_tags)) {
-			section->tag_access_granted = false;
-			section->access_granted = false;
-			ct_section_set_skipped(section);
-			return false;
-		}
-	}
-	section->tag_access_granted = true;
-
-	section->access_granted = cs(model, section);
-	if (section->access_granted) {
-		callback(model, section);
-	}
-	return section->access_granted;
-}
-
 bool ct_run_once_final_work(struct ct_model* model, struct ct_section* section, struct ct_section** pointer_to_set_as_parent, ct_exit_c callback, ct_exit_c access_granted_callback, ct_exit_c access_denied_callback) {
 	if (section->loop1) {
 		return true;
@@ -75,19 +49,80 @@ bool ct_run_once_final_work(struct ct_model* model, struct ct_section* section,
  *  @param[in] type the kind of section we're getting.
  *  @see ::ct_section_type
  */
-struct ct_section* ct_fetch_section(struct ct_section* parent, enum ct_section_type type, const char* description, const char* tags) {
+struct ct_section* ct_fetch_section(struct ct_section* parent, enum ct_section_type type, const char* description, struct ct_section_site* site, const char* tags) {
 	if (ct_section_still_discovering_children(parent)) {
 		parent->children_number += 1;
-		return ct_section_add_child(ct_section_init(type, description, tags), parent);
+		ct_allocation_tracker_pause();
+		ct_section_site_prepare(site, tags, &ct_model->prepared_sites);
+		struct ct_section* ret_val = ct_section_add_child(ct_section_init(type, description, site->tags), parent);
+		ct_index_section(ct_model, ret_val);
+		ct_allocation_tracker_resume();
+		return ret_val;
 	}
 	return ct_section_get_child(parent, parent->current_child);
 }
 
 void ct_reset_section_after_jump(struct ct_model* model, struct ct_section* const jump_source_section, struct ct_section* const testcase_section) {
 	model->current_section = testcase_section;
+	//the test has been interrupted: its memory can't be released anymore, so there is no point in looking for leaks
+	ct_allocation_tracker_stop(model->allocation_tracker);
+	if (model->hardware_counters != NULL) {
+		ct_hardware_counters_disable(model->hardware_counters);
+	}
+	//an interrupted benchmark would keep the following tests pinned to its CPU
+	if (model->benchmark != NULL) {
+		ct_destroy_benchmark(model->benchmark);
+		model->benchmark = NULL;
+	}
+	//assertions performed by worker threads of the interrupted test belong to it
+	struct ct_test_report* report = ct_list_tail(model->test_reports_list);
+	report->execution_time = ct_compute_time_gap(report->testcase_snapshot->start_time, ct_get_time(), "u");
+	ct_merge_thread_reports(model, report->testcase_snapshot);
+
+	//if a signal has been detected, now it's safe to attach its backtrace to the snapshot
+	if (model->signaled_snapshot != NULL) {
+		if (model->backtrace_buffer_size > CT_BACKTRACE_SKIPPED_FRAMES) {
+			ct_snapshot_set_backtrace(model->signaled_snapshot, &model->backtrace_buffer[CT_BACKTRACE_SKIPPED_FRAMES], model->backtrace_buffer_size - CT_BACKTRACE_SKIPPED_FRAMES);
+		}
+		model->signaled_snapshot = NULL;
+		model->backtrace_buffer_size = 0;
+	}
+	if (model->output_capture != NULL) {
+		ct_output_capture_stop(model->output_capture, report);
+	}
+
+	bool notify = model->section_fork == NULL || ct_section_fork_end_test(model, report, true);
+	if (notify && CT_HAS_LISTENERS(model, CT_EVENT_TEST_END)) {
+		ct_dispatch_test_end(model, report);
+	}
+	//an interrupted test is the last one of its testcase
+	if (model->journal != NULL) {
+		ct_journal_end_testcase(model, testcase_section);
+	}
+	if (model->coverage != NULL) {
+		ct_coverage_end_testcase(model, testcase_section);
+	}
+	ct_distribution_end_testcase(model, testcase_section);
 }
 
-bool ct_always_enter(struct ct_model* model, struct ct_section* section) {
+bool ct_get_access_testcase(struct ct_model* model, struct ct_section* section) {
+	//a fuzzer is interested only in the FUZZ_TESTCASE sections
+	if (ct_is_fuzzing(model)) {
+		ct_section_set_skipped(section);
+		return false;
+	}
+	if (model->journal != NULL && ct_journal_testcase_completed(model, section)) {
+		ct_section_set_skipped(section);
+		return false;
+	}
+	if (model->coverage != NULL && !ct_coverage_enter_testcase(model, section)) {
+		ct_section_set_skipped(section);
+		return false;
+	}
+	if (model->distribution != NULL && !ct_distribution_claim(model, section)) {
+		ct_section_set_skipped(section);
+		return false;
+	}
 	return true;
 }
 
@@ -105,6 +140,8 @@ void ct_exit_callback_children_number_computed(struct ct_model* model, struct ct
 	}
 	section->current_child = 0;
 
+	ct_stop_snapshot_measurements(model, model->current_snapshot);
+	ct_merge_thread_reports(model, model->current_snapshot);
 	ct_update_snapshot_status(model->current_section, model->current_snapshot);
 
 	model->current_snapshot = model->current_snapshot->parent;
@@ -120,30 +157,29 @@ void ct_exit_callback_do_nothing(struct ct_model* model, struct ct_section** poi
 
 }
 
-bool ct_get_access_when(struct ct_model* model, struct ct_section* section) {
-	//section is the WHEN we're considering right now
-
-	//we don't enter in this WHEN if we have already entered in another WHEN of the parent
-	if (section->parent->already_found_when) {
-		return false;
-	}
-
-	//we don't access this WHEN if we have already completed it or if it generated a SECTION_SIGNAL
-	if (section->status == CT_SECTION_FULLY_VISITED || section->status == CT_SECTION_SIGNAL_DETECTED) {
-		return false;
-	}
-
-	return true;
-}
-
 void ct_callback_do_nothing(struct ct_model* model, struct ct_section* section) {
 
 }
 
 void ct_callback_entering_testcase(struct ct_model* model, struct ct_section* section) {
+	ct_allocation_tracker_pause();
 	ct_update_current_snapshot(model, model->current_section);
 	struct ct_test_report* report = ct_init_test_report(model->current_snapshot);
 	ct_list_add_tail(model->test_reports_list, report);
+	ct_fuzz_update_test_report(model, report);
+	report->repetition = model->repetition;
+	report->suite = model->current_suite;
+	if (model->output_capture != NULL) {
+		ct_output_capture_start(model->output_capture);
+	}
+	ct_allocation_tracker_resume();
+
+	ct_allocation_tracker_start(model->allocation_tracker);
+	if (model->hardware_counters != NULL) {
+		ct_hardware_counters_enable(model->hardware_counters);
+	}
+	//the snapshot has been started before enabling the counters
+	ct_start_snapshot_measurements(model, model->current_snapshot);
 }
 
 void ct_callback_entering_then(struct ct_model* model, struct ct_section* section) {
@@ -160,11 +196,37 @@ void ct_exit_callback_access_granted_testcase(struct ct_model* model, struct ct_
 	struct ct_test_report* report = ct_list_tail(model->test_reports_list);
 	struct ct_snapshot* last_snapshot = model->current_snapshot;
 
+	ct_stop_snapshot_measurements(model, last_snapshot);
+	if (model->hardware_counters != NULL) {
+		ct_hardware_counters_disable(model->hardware_counters);
+	}
+	ct_allocation_tracker_stop(model->allocation_tracker);
+	report->execution_time = last_snapshot->elapsed_time;
+	ct_merge_thread_reports(model, last_snapshot);
 	ct_update_snapshot_status(section, model->current_snapshot);
+	ct_allocation_tracker_check_leaks(model->allocation_tracker, last_snapshot);
+	ct_allocation_tracker_check_bound(model->allocation_tracker, last_snapshot);
 	ct_update_test_outcome(report, last_snapshot);
+	if (model->output_capture != NULL) {
+		ct_output_capture_stop(model->output_capture, report);
+	}
 
 	//Resets the current_snapshot pointer to NULL to indicate the end of the test
 	model->current_snapshot = NULL;
+
+	bool notify = model->section_fork == NULL || ct_section_fork_end_test(model, report, false);
+	if (notify && CT_HAS_LISTENERS(model, CT_EVENT_TEST_END)) {
+		ct_dispatch_test_end(model, report);
+	}
+	if (!ct_section_still_needs_execution(section)) {
+		if (model->journal != NULL) {
+			ct_journal_end_testcase(model, section);
+		}
+		if (model->coverage != NULL) {
+			ct_coverage_end_testcase(model, section);
+		}
+		ct_distribution_end_testcase(model, section);
+	}
 }
 
 /**
@@ -175,7 +237,12 @@ void ct_exit_callback_access_granted_testcase(struct ct_model* model, struct ct_
  */
 
 void ct_update_current_snapshot(struct ct_model* model, struct ct_section* section) {
+	if (model->output_capture != NULL) {
+		ct_output_capture_trim(model->output_capture);
+	}
+	ct_allocation_tracker_pause();
 	struct ct_snapshot* snapshot = ct_init_section_snapshot(section);
+	ct_allocation_tracker_resume();
 
 	if (model->current_snapshot == NULL) {
 		model->current_snapshot = snapshot;
@@ -184,6 +251,31 @@ void ct_update_current_snapshot(struct ct_model* model, struct ct_section* secti
 		model->current_snapshot = ct_add_snapshot_to_tree(snapshot, model->current_snapshot);
 	}
 
+	ct_start_snapshot_measurements(model, snapshot);
+}
+
+void ct_start_snapshot_measurements(struct ct_model* model, struct ct_snapshot* snapshot) {
+	if (model->measure_resources) {
+		ct_begin_resource_usage(&snapshot->resource_usage);
+	}
+	if (model->hardware_counters != NULL) {
+		ct_begin_hardware_counters(model->hardware_counters, &snapshot->hardware_counters);
+	}
+	//we sample the time last, so that it includes as little @crashc code as possible
+	snapshot->start_time = ct_get_time();
+}
+
+void ct_stop_snapshot_measurements(struct ct_model* model, struct ct_snapshot* snapshot) {
+	struct timespec end_time = ct_get_time();
+
+	if (model->hardware_counters != NULL) {
+		ct_end_hardware_counters(model->hardware_counters, &snapshot->hardware_counters);
+	}
+	if (model->measure_resources) {
+		ct_end_resource_usage(&snapshot->resource_usage);
+	}
+	snapshot->elapsed_time = ct_compute_time_gap(snapshot->start_time, end_time, "u");
+	snapshot->measurements_taken = true;
 }
 
 void ct_signal_callback_do_nothing(int signal, struct ct_section* signaled_section, struct ct_section* section, struct ct_section* target_section) {
@@ -0,0 +1,708 @@
+/*
+ * distribution.c
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: koldar
+ */
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <stdint.h>
+#include <string.h>
+#include <errno.h>
+#include <poll.h>
+#include <unistd.h>
+#include <fcntl.h>
+#include <netdb.h>
+#include <sys/types.h>
+#include <sys/wait.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+
+#include "distribution.h"
+#include "report_serialization.h"
+#include "model.h"
+#include "section.h"
+#include "test_report.h"
+#include "events.h"
+#include "journal.h"
+#include "fuzz.h"
+#include "allocation_tracker.h"
+#include "macros.h"
+#include "errors.h"
+
+/**
+ * The message a worker sends to claim a @testcase: the key and the description of the @testcase follow
+ */
+#define CT_DISTRIBUTION_CLAIM 'C'
+/**
+ * The message a worker sends with the tests of a @testcase: the key of the @testcase and the serialized tests follow
+ */
+#define CT_DISTRIBUTION_TESTS 'T'
+/**
+ * The message a worker sends, right after connecting, to ask the order of the @testsuite: it carries no data.
+ * The coordinator answers with the number of @testsuite followed by struct ct_model::suites_order
+ */
+#define CT_DISTRIBUTION_ORDER 'O'
+/**
+ * The size of the part of a message preceding its variable data: the type, the key of the @testcase and the size of the data
+ */
+#define CT_DISTRIBUTION_HEADER_SIZE (1 + sizeof(struct ct_testcase_key) + sizeof(uint32_t))
+/**
+ * How often, in milliseconds, the coordinator checks whether its local workers have exited
+ */
+#define CT_DISTRIBUTION_POLL_PERIOD 100
+
+/**
+ * A @testcase claimed by a worker, as seen by the coordinator
+ */
+struct ct_claim {
+	struct ct_testcase_key key;
+	char* description;
+	/**
+	 * The connection of the worker running the @testcase. -1 if nobody is running it anymore
+	 */
+	int worker;
+	/**
+	 * The tests received for the @testcase
+	 */
+	ct_list_o* reports;
+};
+
+/**
+ * A connection with a worker, as seen by the coordinator
+ */
+struct ct_worker_connection {
+	int socket;
+	/**
+	 * The bytes received and not yet handled, since a message can be split among several reads
+	 */
+	unsigned char* data;
+	size_t size;
+	size_t capacity;
+};
+
+/**
+ * The state of the coordinator while it's serving the @testcase
+ */
+struct ct_coordinator {
+	/**
+	 * The @testcase claimed so far, in claim order. Each value is a struct ct_claim
+	 */
+	ct_list_o* claims;
+	/**
+	 * struct ct_coordinator::claims indexed by ::ct_testcase_key_hash
+	 */
+	ct_hashtable_o* claims_index;
+	/**
+	 * The connected workers. Each value is a struct ct_worker_connection
+	 */
+	ct_list_o* connections;
+};
+
+static struct ct_distribution* ct_init_distribution(int channel, bool coordinator) {
+	struct ct_distribution* ret_val = malloc(sizeof(struct ct_distribution));
+	if (ret_val == NULL) {
+		CT_MALLOC_ERROR_CALLBACK();
+	}
+
+	ret_val->channel = channel;
+	ret_val->coordinator = coordinator;
+	ret_val->testcase = NULL;
+	ret_val->granted = false;
+	ret_val->arena = coordinator ? ct_init_report_arena() : NULL;
+	ret_val->lost_testcases = 0;
+
+	return ret_val;
+}
+
+void ct_destroy_distribution(struct ct_distribution* distribution) {
+	if (distribution->channel >= 0) {
+		close(distribution->channel);
+	}
+	if (distribution->arena != NULL) {
+		ct_destroy_report_arena(distribution->arena);
+	}
+	free(distribution);
+}
+
+/**
+ * Opens the socket of a distributed run
+ *
+ * @param[in] address the address of the coordinator, either <tt>unix:PATH</tt> or <tt>[tcp:]HOST:PORT</tt>
+ * @param[in] coordinator @true to listen on \c address, @false to connect to it
+ * @return the socket. The process exits if the socket can't be opened
+ */
+static int ct_open_distribution_socket(const char* address, bool coordinator) {
+	int ret_val = -1;
+
+	if (strncmp(address, "unix:", 5) == 0) {
+		struct sockaddr_un unix_address;
+		const char* path = address + 5;
+		memset(&unix_address, 0, sizeof(unix_address));
+		unix_address.sun_family = AF_UNIX;
+		if (strlen(path) >= sizeof(unix_address.sun_path)) {
+			fprintf(stderr, "CrashC - the socket path \"%s\" is too long\n", path);
+			exit(EXIT_FAILURE);
+		}
+		strcpy(unix_address.sun_path, path);
+
+		ret_val = socket(AF_UNIX, SOCK_STREAM | SOCK_CLOEXEC, 0);
+		if (ret_val >= 0 && coordinator) {
+			//a socket file left by a previous coordinator would make bind fail
+			unlink(path);
+			if (bind(ret_val, (struct sockaddr*) &unix_address, sizeof(unix_address)) != 0 || listen(ret_val, CT_DISTRIBUTION_BACKLOG) != 0) {
+				close(ret_val);
+				ret_val = -1;
+			}
+		} else if (ret_val >= 0 && connect(ret_val, (struct sockaddr*) &unix_address, sizeof(unix_address)) != 0) {
+			close(ret_val);
+			ret_val = -1;
+		}
+	} else {
+		char host[CT_BUFFER_SIZE];
+		if (strncmp(address, "tcp:", 4) == 0) {
+			address += 4;
+		}
+		const char* port = strrchr(address, ':');
+		if (port == NULL || (size_t) (port - address) >= sizeof(host)) {
+			fprintf(stderr, "CrashC - invalid address \"%s\": it needs to be either unix:PATH or tcp:HOST:PORT\n", address);
+			exit(EXIT_FAILURE);
+		}
+		memcpy(host, address, port - address);
+		host[port - address] = '\0';
+		port += 1;
+
+		struct addrinfo hints;
+		struct addrinfo* addresses;
+		memset(&hints, 0, sizeof(hints));
+		hints.ai_family = AF_UNSPEC;
+		hints.ai_socktype = SOCK_STREAM;
+		hints.ai_flags = coordinator ? AI_PASSIVE : 0;
+		int error = getaddrinfo((host[0] != '\0') ? host : NULL, port, &hints, &addresses);
+		if (error != 0) {
+			fprintf(stderr, "CrashC - cannot resolve \"%s\": %s\n", address, gai_strerror(error));
+			exit(EXIT_FAILURE);
+		}
+		for (struct addrinfo* a = addresses; a != NULL && ret_val < 0; a = a->ai_next) {
+			ret_val = socket(a->ai_family, a->ai_socktype | SOCK_CLOEXEC, a->ai_protocol);
+			if (ret_val < 0) {
+				continue;
+			}
+			int enabled = 1;
+			bool opened;
+			if (coordinator) {
+				setsockopt(ret_val, SOL_SOCKET, SO_REUSEADDR, &enabled, sizeof(enabled));
+				opened = bind(ret_val, a->ai_addr, a->ai_addrlen) == 0 && listen(ret_val, CT_DISTRIBUTION_BACKLOG) == 0;
+			} else {
+				//a claim is a tiny message waiting for an answer: it can't wait for more data to be sent
+				setsockopt(ret_val, IPPROTO_TCP, TCP_NODELAY, &enabled, sizeof(enabled));
+				opened = connect(ret_val, a->ai_addr, a->ai_addrlen) == 0;
+			}
+			if (!opened) {
+				close(ret_val);
+				ret_val = -1;
+			}
+		}
+		freeaddrinfo(addresses);
+	}
+
+	if (ret_val < 0) {
+		fprintf(stderr, "CrashC - cannot %s \"%s\": %s\n", coordinator ? "listen on" : "connect to", address, strerror(errno));
+		exit(EXIT_FAILURE);
+	}
+	return ret_val;
+}
+
+static bool ct_send_all(int channel, const void* data, size_t size) {
+	const unsigned char* bytes = data;
+
+	while (size > 0) {
+		ssize_t sent = send(channel, bytes, size, MSG_NOSIGNAL);
+		if (sent < 0 && errno == EINTR) {
+			continue;
+		}
+		if (sent <= 0) {
+			return false;
+		}
+		bytes += sent;
+		size -= sent;
+	}
+	return true;
+}
+
+/**
+ * Sends a message to the coordinator
+ *
+ * A worker can't do anything without its coordinator, so it exits if the message can't be sent.
+ *
+ * @param[in] distribution the state of the worker
+ * @param[in] type the type of the message
+ * @param[in] key the @testcase the message is about
+ * @param[in] data the variable part of the message
+ * @param[in] size the number of bytes of \c data
+ */
+static void ct_send_message(const struct ct_distribution* distribution, char type, const struct ct_testcase_key* key, const void* data, uint32_t size) {
+	unsigned char header[CT_DISTRIBUTION_HEADER_SIZE];
+
+	header[0] = type;
+	memcpy(&header[1], key, sizeof(struct ct_testcase_key));
+	memcpy(&header[1 + sizeof(struct ct_testcase_key)], &size, sizeof(size));
+	if (!ct_send_all(distribution->channel, header, sizeof(header)) || !ct_send_all(distribution->channel, data, size)) {
+		fprintf(stderr, "CrashC - the connection to the coordinator has been lost\n");
+		_exit(EXIT_FAILURE);
+	}
+}
+
+/**
+ * Receives a reply of the coordinator
+ *
+ * A worker can't do anything without its coordinator, so it exits if the reply can't be received.
+ *
+ * @param[in] distribution the state of the worker
+ * @param[out] data where to store the reply
+ * @param[in] size the number of bytes of the reply
+ */
+static void ct_receive_reply(const struct ct_distribution* distribution, void* data, size_t size) {
+	unsigned char* bytes = data;
+
+	while (size > 0) {
+		ssize_t received = recv(distribution->channel, bytes, size, 0);
+		if (received < 0 && errno == EINTR) {
+			continue;
+		}
+		if (received <= 0) {
+			fprintf(stderr, "CrashC - the connection to the coordinator has been lost\n");
+			_exit(EXIT_FAILURE);
+		}
+		bytes += received;
+		size -= received;
+	}
+}
+
+/**
+ * Turns the calling process into a worker
+ *
+ * The worker runs the @testsuite in the order chosen by the coordinator, so that the @testcase are claimed in the priority
+ * the coordinator has computed from its history file, even if the worker has no history file. The worker exits if the order
+ * received is not a permutation of its own @testsuite.
+ *
+ * @param[inout] model the model to handle
+ * @param[in] channel the connection to the coordinator
+ */
+static void ct_become_worker(struct ct_model* model, int channel) {
+	struct ct_testcase_key no_key = { 0, 0 };
+	int suites_number;
+	int suites_order[MAX_TESTS];
+
+	model->distribution = ct_init_distribution(channel, false);
+	//the coordinator notifies the tests and keeps the journal
+	model->event_dispatcher->subscribed_events = 0;
+	if (model->journal != NULL) {
+		ct_destroy_journal(model->journal);
+		model->journal = NULL;
+	}
+
+	ct_send_message(model->distribution, CT_DISTRIBUTION_ORDER, &no_key, NULL, 0);
+	ct_receive_reply(model->distribution, &suites_number, sizeof(suites_number));
+	if (suites_number < 0 || suites_number > MAX_TESTS) {
+		fprintf(stderr, "CrashC - the coordinator has sent %d test suites: is it running the same test executable?\n", suites_number);
+		_exit(EXIT_FAILURE);
+	}
+	ct_receive_reply(model->distribution, suites_order, sizeof(int) * suites_number);
+	if (suites_number != model->suites_array_index) {
+		fprintf(stderr, "CrashC - the coordinator has %d test suites instead of %d: is it running the same test executable?\n", suites_number, model->suites_array_index);
+		_exit(EXIT_FAILURE);
+	}
+	//the order indexes struct ct_model::tests_array: it needs to contain every test suite exactly once
+	bool seen[MAX_TESTS] = { false };
+	for (int i = 0; i < suites_number; i++) {
+		if (suites_order[i] < 0 || suites_order[i] >= suites_number || seen[suites_order[i]]) {
+			fprintf(stderr, "CrashC - the coordinator has sent the test suite %d in position %d: is it running the same test executable?\n", suites_order[i], i);
+			_exit(EXIT_FAILURE);
+		}
+		seen[suites_order[i]] = true;
+	}
+	memcpy(model->suites_order, suites_order, sizeof(int) * suites_number);
+}
+
+static struct ct_claim* ct_find_claim(const struct ct_coordinator* coordinator, const struct ct_testcase_key* key) {
+	struct ct_claim* ret_val = ct_ht_get(coordinator->claims_index, ct_testcase_key_hash(key));
+
+	if (ret_val == NULL || (ret_val->key.path_hash == key->path_hash && ret_val->key.occurrence == key->occurrence)) {
+		return ret_val;
+	}
+	//on a hash collision the claims are looked for one by one
+	CT_ITERATE_ON_LIST(coordinator->claims, cell, claim, struct ct_claim*) {
+		if (claim->key.path_hash == key->path_hash && claim->key.occurrence == key->occurrence) {
+			return claim;
+		}
+	}
+	return NULL;
+}
+
+static struct ct_claim* ct_add_claim(struct ct_coordinator* coordinator, const struct ct_testcase_key* key, const char* description, uint32_t length, int worker) {
+	struct ct_claim* ret_val = malloc(sizeof(struct ct_claim));
+	if (ret_val == NULL) {
+		CT_MALLOC_ERROR_CALLBACK();
+	}
+	ret_val->description = malloc(length + 1);
+	if (ret_val->description == NULL) {
+		CT_MALLOC_ERROR_CALLBACK();
+	}
+
+	ret_val->key = *key;
+	memcpy(ret_val->description, description, length);
+	ret_val->description[length] = '\0';
+	ret_val->worker = worker;
+	ret_val->reports = ct_list_init();
+	ct_list_add_tail(coordinator->claims, ret_val);
+	if (ct_ht_get(coordinator->claims_index, ct_testcase_key_hash(key)) == NULL) {
+		ct_ht_put(coordinator->claims_index, ct_testcase_key_hash(key), ret_val);
+	}
+
+	return ret_val;
+}
+
+static void ct_destroy_claim(struct ct_claim* claim) {
+	ct_list_destroy_with_elements(claim->reports, (ct_destroyer_c) ct_destroy_test_report);
+	free(claim->description);
+	free(claim);
+}
+
+/**
+ * Handles a message received by the coordinator
+ *
+ * @param[inout] model the model of the coordinator
+ * @param[inout] coordinator the state of the coordinator
+ * @param[in] connection the worker which has sent the message
+ * @param[in] type the type of the message
+ * @param[in] key the @testcase the message is about
+ * @param[in] data the variable part of the message
+ * @param[in] size the number of bytes of \c data
+ * @return @true if the message has been handled, @false if the worker has sent something the coordinator can't understand
+ */
+static bool ct_handle_message(struct ct_model* model, struct ct_coordinator* coordinator, struct ct_worker_connection* connection, char type, const struct ct_testcase_key* key, unsigned char* data, uint32_t size) {
+	struct ct_distribution* distribution = model->distribution;
+
+	if (type == CT_DISTRIBUTION_ORDER) {
+		//every worker claims the testcases in the order the coordinator has chosen from its history
+		if (ct_send_all(connection->socket, &model->suites_array_index, sizeof(model->suites_array_index))) {
+			ct_send_all(connection->socket, model->suites_order, sizeof(int) * model->suites_array_index);
+		}
+		return true;
+	}
+
+	struct ct_claim* claim = ct_find_claim(coordinator, key);
+	if (type == CT_DISTRIBUTION_CLAIM) {
+		char granted = 0;
+		if (claim == NULL) {
+			if (model->journal != NULL && ct_journal_key_completed(model->journal, key)) {
+				//nobody is going to run it, but the other workers need to be denied the testcase as well
+				ct_add_claim(coordinator, key, (char*) data, size, -1);
+				model->journal->skipped_testcases += 1;
+			} else {
+				ct_add_claim(coordinator, key, (char*) data, size, connection->socket);
+				granted = 1;
+			}
+		}
+		//if the worker has died, its connection is going to be closed as well
+		ct_send_all(connection->socket, &granted, sizeof(granted));
+		return true;
+	}
+
+	if (type != CT_DISTRIBUTION_TESTS || claim == NULL || claim->worker != connection->socket) {
+		fprintf(stderr, "CrashC - a worker has sent an unexpected message: is it running the same test executable?\n");
+		return false;
+	}
+	struct ct_serialized_buffer buffer = { data, size, 0, false };
+	ct_list_o* reports = ct_list_init();
+	int reports_number;
+	ct_deserialize_bytes(&buffer, &reports_number, sizeof(reports_number));
+	for (int i = 0; i < reports_number && !buffer.corrupted; i++) {
+		ct_list_add_tail(reports, ct_deserialize_test_report(&buffer, distribution->arena));
+	}
+	if (buffer.corrupted) {
+		fprintf(stderr, "CrashC - a worker has sent corrupted tests for the test case \"%s\": is it running the same test executable?\n", claim->description);
+		ct_list_destroy_with_elements(reports, (ct_destroyer_c) ct_destroy_test_report);
+		return false;
+	}
+	ct_list_full_transfer(claim->reports, reports);
+	ct_list_destroy(reports);
+	claim->worker = -1;
+
+	//the listeners, like the journal, look at the key of the testcase whose tests are being notified
+	model->keyed_testcase = NULL;
+	model->testcase_key = claim->key;
+	if (CT_HAS_LISTENERS(model, CT_EVENT_TEST_END)) {
+		CT_ITERATE_ON_LIST(claim->reports, cell, report, struct ct_test_report*) {
+			ct_dispatch_test_end(model, report);
+		}
+	}
+	if (model->journal != NULL) {
+		ct_journal_complete_key(model->journal, &claim->key);
+	}
+	return true;
+}
+
+/**
+ * Reads what a worker has sent and handles the complete messages
+ *
+ * @param[inout] model the model of the coordinator
+ * @param[inout] coordinator the state of the coordinator
+ * @param[inout] connection the worker to read from
+ * @return @false if the worker has left or has sent something the coordinator can't understand, @true otherwise
+ */
+static bool ct_read_connection(struct ct_model* model, struct ct_coordinator* coordinator, struct ct_worker_connection* connection) {
+	if (connection->size == connection->capacity) {
+		connection->capacity *= 2;
+		connection->data = realloc(connection->data, connection->capacity);
+		if (connection->data == NULL) {
+			CT_MALLOC_ERROR_CALLBACK();
+		}
+	}
+	ssize_t bytes = recv(connection->socket, connection->data + connection->size, connection->capacity - connection->size, 0);
+	if (bytes < 0 && errno == EINTR) {
+		return true;
+	}
+	if (bytes <= 0) {
+		return false;
+	}
+	connection->size += bytes;
+
+	size_t position = 0;
+	while (connection->size - position >= CT_DISTRIBUTION_HEADER_SIZE) {
+		unsigned char* message = connection->data + position;
+		struct ct_testcase_key key;
+		uint32_t size;
+		memcpy(&key, &message[1], sizeof(key));
+		memcpy(&size, &message[1 + sizeof(key)], sizeof(size));
+		if (size > CT_DISTRIBUTION_MAX_MESSAGE_SIZE) {
+			fprintf(stderr, "CrashC - a worker has sent a message of %lu bytes: is it running the same test executable?\n", (unsigned long) size);
+			return false;
+		}
+		if (connection->size - position - CT_DISTRIBUTION_HEADER_SIZE < size) {
+			break;
+		}
+		if (!ct_handle_message(model, coordinator, connection, (char) message[0], &key, message + CT_DISTRIBUTION_HEADER_SIZE, size)) {
+			return false;
+		}
+		position += CT_DISTRIBUTION_HEADER_SIZE + size;
+	}
+	memmove(connection->data, connection->data + position, connection->size - position);
+	connection->size -= position;
+
+	return true;
+}
+
+static void ct_close_connection(struct ct_model* model, struct ct_coordinator* coordinator, struct ct_worker_connection* connection) {
+	CT_ITERATE_ON_LIST(coordinator->claims, cell, claim, struct ct_claim*) {
+		if (claim->worker == connection->socket) {
+			fprintf(stderr, "CrashC - a worker has left while running the test case \"%s\": its tests are lost\n", claim->description);
+			claim->worker = -1;
+			model->distribution->lost_testcases += 1;
+		}
+	}
+	close(connection->socket);
+	free(connection->data);
+	free(connection);
+}
+
+static bool ct_has_pending_connections(int channel) {
+	struct pollfd pending = { channel, POLLIN, 0 };
+
+	return poll(&pending, 1, 0) > 0;
+}
+
+/**
+ * Serves the @testcase to the workers until every worker has left
+ *
+ * @param[inout] model the model of the coordinator
+ * @param[inout] coordinator the state of the coordinator
+ * @param[inout] local_workers the local workers. The ones which have exited are set to 0
+ * @param[in] local_workers_number the number of items in \c local_workers
+ */
+static void ct_serve(struct ct_model* model, struct ct_coordinator* coordinator, pid_t* local_workers, int local_workers_number) {
+	int channel = model->distribution->channel;
+	int running_workers = local_workers_number;
+	struct pollfd* polled = NULL;
+
+	while (running_workers > 0 || !ct_list_is_empty(coordinator->connections) || ct_has_pending_connections(channel)) {
+		int polled_number = 1 + ct_list_size(coordinator->connections);
+		polled = realloc(polled, sizeof(struct pollfd) * polled_number);
+		if (polled == NULL) {
+			CT_MALLOC_ERROR_CALLBACK();
+		}
+		polled[0] = (struct pollfd) { channel, POLLIN, 0 };
+		int i = 1;
+		CT_ITERATE_ON_LIST(coordinator->connections, cell, connection, struct ct_worker_connection*) {
+			polled[i] = (struct pollfd) { connection->socket, POLLIN, 0 };
+			i += 1;
+		}
+
+		if (poll(polled, polled_number, CT_DISTRIBUTION_POLL_PERIOD) < 0 && errno != EINTR) {
+			perror("CrashC - the coordinator cannot wait for the workers");
+			exit(EXIT_FAILURE);
+		}
+
+		//the connections are handled before the new ones are added, so that they match the polled ones
+		i = 1;
+		ct_list_o* connections = ct_list_init();
+		CT_ITERATE_ON_LIST(coordinator->connections, cell2, connection2, struct ct_worker_connection*) {
+			if ((polled[i].revents & (POLLIN | POLLHUP | POLLERR)) != 0 && !ct_read_connection(model, coordinator, connection2)) {
+				ct_close_connection(model, coordinator, connection2);
+			} else {
+				ct_list_add_tail(connections, connection2);
+			}
+			i += 1;
+		}
+		ct_list_destroy(coordinator->connections);
+		coordinator->connections = connections;
+
+		if ((polled[0].revents & POLLIN) != 0) {
+			int socket = accept(channel, NULL, NULL);
+			if (socket >= 0) {
+				fcntl(socket, F_SETFD, FD_CLOEXEC);
+				struct ct_worker_connection* connection = malloc(sizeof(struct ct_worker_connection));
+				if (connection == NULL) {
+					CT_MALLOC_ERROR_CALLBACK();
+				}
+				connection->socket = socket;
+				connection->capacity = CT_BUFFER_SIZE;
+				connection->size = 0;
+				connection->data = malloc(connection->capacity);
+				if (connection->data == NULL) {
+					CT_MALLOC_ERROR_CALLBACK();
+				}
+				ct_list_add_tail(coordinator->connections, connection);
+			}
+		}
+
+		for (int w = 0; w < local_workers_number; w++) {
+			int status;
+			if (local_workers[w] != 0 && waitpid(local_workers[w], &status, WNOHANG) == local_workers[w]) {
+				local_workers[w] = 0;
+				running_workers -= 1;
+			}
+		}
+	}
+
+	free(polled);
+}
+
+bool ct_distribute(struct ct_model* model) {
+	if (model->worker_address != NULL) {
+		ct_become_worker(model, ct_open_distribution_socket(model->worker_address, false));
+		return true;
+	}
+	if (model->coordinator_address == NULL) {
+		return true;
+	}
+
+	model->distribution = ct_init_distribution(ct_open_distribution_socket(model->coordinator_address, true), true);
+
+	int local_workers_number = ct_get_workers_number(model);
+	pid_t* local_workers = malloc(sizeof(pid_t) * local_workers_number);
+	if (local_workers == NULL) {
+		CT_MALLOC_ERROR_CALLBACK();
+	}
+	//otherwise the buffered output would be written by every worker
+	fflush(NULL);
+	for (int w = 0; w < local_workers_number; w++) {
+		local_workers[w] = fork();
+		if (local_workers[w] < 0) {
+			perror("CrashC - cannot fork a local worker");
+			exit(EXIT_FAILURE);
+		}
+		if (local_workers[w] == 0) {
+			free(local_workers);
+			ct_destroy_distribution(model->distribution);
+			model->distribution = NULL;
+			ct_become_worker(model, ct_open_distribution_socket(model->coordinator_address, false));
+			return true;
+		}
+	}
+
+	struct ct_coordinator coordinator = { ct_list_init(), ct_ht_init(), ct_list_init() };
+	ct_serve(model, &coordinator, local_workers, local_workers_number);
+	free(local_workers);
+	close(model->distribution->channel);
+	model->distribution->channel = -1;
+	if (strncmp(model->coordinator_address, "unix:", 5) == 0) {
+		unlink(model->coordinator_address + 5);
+	}
+
+	//the testcases have been claimed in the order a single process would have run them
+	CT_ITERATE_ON_LIST(coordinator.claims, cell, claim, struct ct_claim*) {
+		ct_list_full_transfer(model->test_reports_list, claim->reports);
+	}
+	ct_list_destroy_with_elements(coordinator.claims, (ct_destroyer_c) ct_destroy_claim);
+	ct_ht_destroy(coordinator.claims_index);
+	ct_list_destroy(coordinator.connections);
+	if (model->distribution->lost_testcases > 0) {
+		fprintf(stderr, "CrashC - the tests of %d test cases have been lost\n", model->distribution->lost_testcases);
+	}
+
+	return false;
+}
+
+bool ct_distribution_claim(struct ct_model* model, const struct ct_section* testcase) {
+	struct ct_distribution* distribution = model->distribution;
+
+	if (testcase != distribution->testcase) {
+		distribution->testcase = testcase;
+		ct_send_message(distribution, CT_DISTRIBUTION_CLAIM, ct_get_testcase_key(model, testcase), testcase->description, strlen(testcase->description));
+
+		char granted;
+		ct_receive_reply(distribution, &granted, sizeof(granted));
+		distribution->granted = granted != 0;
+	}
+	return distribution->granted;
+}
+
+void ct_distribution_end_testcase(struct ct_model* model, const struct ct_section* testcase) {
+	struct ct_distribution* distribution = model->distribution;
+
+	if (distribution == NULL || distribution->coordinator || testcase != distribution->testcase || !distribution->granted) {
+		return;
+	}
+	//a FUZZ_TESTCASE ends when its last input has been run, not when an input is interrupted
+	if (model->fuzz_corpus != NULL) {
+		return;
+	}
+
+	ct_allocation_tracker_pause();
+	char* payload = NULL;
+	size_t size = 0;
+	FILE* out = open_memstream(&payload, &size);
+	if (out == NULL) {
+		CT_MALLOC_ERROR_CALLBACK();
+	}
+	int reports_number = ct_list_size(model->test_reports_list);
+	fwrite(&reports_number, sizeof(reports_number), 1, out);
+	CT_ITERATE_ON_LIST(model->test_reports_list, cell, report, struct ct_test_report*) {
+		ct_serialize_test_report(out, report);
+	}
+	fclose(out);
+
+	ct_send_message(distribution, CT_DISTRIBUTION_TESTS, ct_get_testcase_key(model, testcase), payload, (uint32_t) size);
+	free(payload);
+
+	//the tests now belong to the coordinator
+	CT_ITERATE_ON_LIST(model->test_reports_list, cell2, sent, struct ct_test_report*) {
+		ct_destroy_test_report(sent);
+	}
+	ct_list_clear(model->test_reports_list);
+	distribution->granted = false;
+	ct_allocation_tracker_resume();
+}
+
+void ct_distribution_leave(struct ct_model* model) {
+	if (model->distribution != NULL && !model->distribution->coordinator) {
+		close(model->distribution->channel);
+		fflush(NULL);
+		_exit(EXIT_SUCCESS);
+	}
+}
@@ -0,0 +1,119 @@
+/*
+ * events.c
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: koldar
+ */
+
+#include <stdlib.h>
+#include <stdbool.h>
+
+#include "events.h"
+#include "model.h"
+#include "allocation_tracker.h"
+#include "errors.h"
+
+struct ct_event_dispatcher* ct_init_event_dispatcher() {
+	struct ct_event_dispatcher* ret_val = malloc(sizeof(struct ct_event_dispatcher));
+	if (ret_val == NULL) {
+		CT_MALLOC_ERROR_CALLBACK();
+	}
+
+	ret_val->subscribed_events = 0;
+	ret_val->listeners_number = 0;
+
+	return ret_val;
+}
+
+bool ct_subscribe_listener(struct ct_model* model, const struct ct_event_listener* listener) {
+	struct ct_event_dispatcher* dispatcher = model->event_dispatcher;
+
+	if (dispatcher->listeners_number >= CT_MAX_EVENT_LISTENERS) {
+		return false;
+	}
+
+	dispatcher->listeners[dispatcher->listeners_number] = *listener;
+	dispatcher->listeners_number += 1;
+
+	if (listener->on_suite_start != NULL) {
+		dispatcher->subscribed_events |= CT_EVENT_SUITE_START;
+	}
+	if (listener->on_section_enter != NULL) {
+		dispatcher->subscribed_events |= CT_EVENT_SECTION_ENTER;
+	}
+	if (listener->on_assert_fail != NULL) {
+		dispatcher->subscribed_events |= CT_EVENT_ASSERT_FAIL;
+	}
+	if (listener->on_test_end != NULL) {
+		dispatcher->subscribed_events |= CT_EVENT_TEST_END;
+	}
+	if (listener->on_run_end != NULL) {
+		dispatcher->subscribed_events |= CT_EVENT_RUN_END;
+	}
+	return true;
+}
+
+void ct_dispatch_suite_start(struct ct_model* model, const char* suite_name) {
+	struct ct_event_dispatcher* dispatcher = model->event_dispatcher;
+
+	//what listeners allocate doesn't belong to the tests
+	ct_allocation_tracker_pause();
+	for (int i = 0; i < dispatcher->listeners_number; i++) {
+		if (dispatcher->listeners[i].on_suite_start != NULL) {
+			dispatcher->listeners[i].on_suite_start(model, dispatcher->listeners[i].data, suite_name);
+		}
+	}
+	ct_allocation_tracker_resume();
+}
+
+void ct_dispatch_section_enter(struct ct_model* model, struct ct_section* section) {
+	struct ct_event_dispatcher* dispatcher = model->event_dispatcher;
+
+	ct_allocation_tracker_pause();
+	for (int i = 0; i < dispatcher->listeners_number; i++) {
+		if (dispatcher->listeners[i].on_section_enter != NULL) {
+			dispatcher->listeners[i].on_section_enter(model, dispatcher->listeners[i].data, section);
+		}
+	}
+	ct_allocation_tracker_resume();
+}
+
+void ct_dispatch_assert_fail(struct ct_model* model, struct ct_assert_report* report) {
+	struct ct_event_dispatcher* dispatcher = model->event_dispatcher;
+
+	ct_allocation_tracker_pause();
+	for (int i = 0; i < dispatcher->listeners_number; i++) {
+		if (dispatcher->listeners[i].on_assert_fail != NULL) {
+			dispatcher->listeners[i].on_assert_fail(model, dispatcher->listeners[i].data, report);
+		}
+	}
+	ct_allocation_tracker_resume();
+}
+
+void ct_dispatch_test_end(struct ct_model* model, struct ct_test_report* report) {
+	struct ct_event_dispatcher* dispatcher = model->event_dispatcher;
+
+	ct_allocation_tracker_pause();
+	for (int i = 0; i < dispatcher->listeners_number; i++) {
+		if (dispatcher->listeners[i].on_test_end != NULL) {
+			dispatcher->listeners[i].on_test_end(model, dispatcher->listeners[i].data, report);
+		}
+	}
+	ct_allocation_tracker_resume();
+}
+
+void ct_dispatch_run_end(struct ct_model* model) {
+	struct ct_event_dispatcher* dispatcher = model->event_dispatcher;
+
+	ct_allocation_tracker_pause();
+	for (int i = 0; i < dispatcher->listeners_number; i++) {
+		if (dispatcher->listeners[i].on_run_end != NULL) {
+			dispatcher->listeners[i].on_run_end(model, dispatcher->listeners[i].data);
+		}
+	}
+	ct_allocation_tracker_resume();
+}
+
+void ct_destroy_event_dispatcher(struct ct_event_dispatcher* dispatcher) {
+	free(dispatcher);
+}
@@ -0,0 +1,135 @@
+/*
+ * flaky.c
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: koldar
+ */
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "flaky.h"
+#include "model.h"
+#include "test_report.h"
+#include "assertions.h"
+#include "report_producer.h"
+#include "errors.h"
+
+static void ct_compute_flakiness(struct ct_model* model, struct ct_test_report* first_repetition);
+
+void ct_detect_flaky_tests(struct ct_model* model) {
+	if (model->repetitions <= 1) {
+		return;
+	}
+
+	int reports_number = ct_list_size(model->test_reports_list);
+	struct ct_test_report** reports = malloc(sizeof(struct ct_test_report*) * (reports_number + 1));
+	//for each report, how many reports of the same testcase precede it in the same repetition
+	int* occurrences = malloc(sizeof(int) * (reports_number + 1));
+	bool* linked = calloc(reports_number + 1, sizeof(bool));
+	if (reports == NULL || occurrences == NULL || linked == NULL) {
+		CT_MALLOC_ERROR_CALLBACK();
+	}
+
+	int i = 0;
+	CT_ITERATE_ON_LIST(model->test_reports_list, report_cell, report, struct ct_test_report*) {
+		reports[i] = report;
+		occurrences[i] = 0;
+		for (int j = i - 1; j >= 0 && reports[j]->repetition == report->repetition; j--) {
+			if (strcmp(reports[j]->testcase_snapshot->description, report->testcase_snapshot->description) == 0) {
+				occurrences[i] += 1;
+			}
+		}
+		i += 1;
+	}
+
+	model->statistics->flaky_tests = 0;
+	for (i = 0; i < reports_number; i++) {
+		if (linked[i]) {
+			continue;
+		}
+		struct ct_test_report* last = reports[i];
+		for (int j = i + 1; j < reports_number; j++) {
+			if (linked[j] || reports[j]->repetition <= last->repetition || occurrences[j] != occurrences[i]) {
+				continue;
+			}
+			if (strcmp(reports[j]->testcase_snapshot->description, reports[i]->testcase_snapshot->description) != 0) {
+				continue;
+			}
+			last->next_repetition = reports[j];
+			last = reports[j];
+			linked[j] = true;
+		}
+
+		ct_compute_flakiness(model, reports[i]);
+		if (reports[i]->flakiness->flaky) {
+			model->statistics->flaky_tests += 1;
+		}
+	}
+
+	free(linked);
+	free(occurrences);
+	free(reports);
+}
+
+bool ct_snapshot_trees_diverge(const struct ct_snapshot* a, const struct ct_snapshot* b) {
+	if (a == NULL || b == NULL) {
+		return a != b;
+	}
+	if (a->status != b->status || strcmp(a->description, b->description) != 0) {
+		return true;
+	}
+	if (ct_list_size(a->assertion_reports) != ct_list_size(b->assertion_reports)) {
+		return true;
+	}
+
+	ct_list_entry_o* entry_b = _ct_list_head_entry(b->assertion_reports);
+	CT_ITERATE_ON_LIST(a->assertion_reports, entry_a, assertion_a, struct ct_assert_report*) {
+		struct ct_assert_report* assertion_b = _ct_list_get_entry_payload(entry_b);
+		if (assertion_a->passed != assertion_b->passed) {
+			return true;
+		}
+		entry_b = _ct_list_get_next_entry(entry_b);
+	}
+
+	return ct_snapshot_trees_diverge(a->first_child, b->first_child) || ct_snapshot_trees_diverge(a->next_sibling, b->next_sibling);
+}
+
+/**
+ * Computes how a test behaved across all its repetitions
+ *
+ * @param[in] model the model to handle
+ * @param[inout] first_repetition the report of the first repetition of the test. The computed struct ct_flakiness is stored here
+ */
+static void ct_compute_flakiness(struct ct_model* model, struct ct_test_report* first_repetition) {
+	struct ct_flakiness* flakiness = malloc(sizeof(struct ct_flakiness));
+	if (flakiness == NULL) {
+		CT_MALLOC_ERROR_CALLBACK();
+	}
+
+	flakiness->runs = 0;
+	flakiness->failed_runs = 0;
+	flakiness->snapshots_diverge = false;
+	flakiness->elapsed_time_mean = 0;
+	flakiness->elapsed_time_variance = 0;
+	for (struct ct_test_report* report = first_repetition; report != NULL; report = report->next_repetition) {
+		flakiness->runs += 1;
+		if (report->outcome != CT_TEST_SUCCESS) {
+			flakiness->failed_runs += 1;
+		}
+		if (ct_snapshot_trees_diverge(first_repetition->testcase_snapshot, report->testcase_snapshot)) {
+			flakiness->snapshots_diverge = true;
+		}
+		flakiness->elapsed_time_mean += report->testcase_snapshot->elapsed_time;
+	}
+	flakiness->elapsed_time_mean /= flakiness->runs;
+	for (struct ct_test_report* report = first_repetition; report != NULL; report = report->next_repetition) {
+		double deviation = report->testcase_snapshot->elapsed_time - flakiness->elapsed_time_mean;
+		flakiness->elapsed_time_variance += deviation * deviation;
+	}
+	flakiness->elapsed_time_variance /= flakiness->runs;
+
+	flakiness->flaky = flakiness->snapshots_diverge || flakiness->runs != model->repetitions
+			|| (flakiness->failed_runs > 0 && flakiness->failed_runs < flakiness->runs);
+	first_repetition->flakiness = flakiness;
+}
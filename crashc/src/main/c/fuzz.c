@@ -0,0 +1,555 @@
+/*
+ * fuzz.c
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: koldar
+ */
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <errno.h>
+#include <dirent.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <sys/types.h>
+#include <sys/wait.h>
+
+#include "fuzz.h"
+#include "model.h"
+#include "section.h"
+#include "distribution.h"
+#include "test_report.h"
+#include "events.h"
+#include "report_serialization.h"
+#include "main_model.h"
+#include "errors.h"
+
+/**
+ * What an empty input points to, since mapping an empty file is not allowed
+ */
+static const uint8_t ct_empty_fuzz_data[1] = { 0 };
+
+static struct ct_fuzz_corpus* ct_init_fuzz_corpus(int inputs_number);
+static struct ct_fuzz_corpus* ct_load_fuzz_corpus(const char* directory);
+static void ct_map_fuzz_input(struct ct_fuzz_input* input);
+static int ct_compare_fuzz_inputs(const void* a, const void* b);
+static bool ct_fuzz_split_among_workers(struct ct_model* model, struct ct_fuzz_corpus* corpus);
+static struct ct_fuzz_input* ct_fuzz_current_input(struct ct_model* model);
+static void ct_fuzz_send_tests(struct ct_model* model, struct ct_fuzz_corpus* corpus, int input);
+static bool ct_fuzz_receive_tests(struct ct_model* model, struct ct_fuzz_corpus* corpus, struct ct_serialized_buffer* buffer, int worker, int workers_number);
+static void ct_fuzz_add_received_tests(struct ct_model* model, struct ct_fuzz_corpus* corpus, int input);
+
+void ct_set_fuzz_input(struct ct_model* model, const uint8_t* data, size_t size) {
+	struct ct_fuzz_input* input = model->fuzzer_input;
+	if (input == NULL) {
+		input = malloc(sizeof(struct ct_fuzz_input));
+		if (input == NULL) {
+			CT_MALLOC_ERROR_CALLBACK();
+		}
+	}
+
+	input->path = NULL;
+	input->data = (data != NULL) ? data : ct_empty_fuzz_data;
+	input->size = size;
+	input->mapped = false;
+	model->fuzzer_input = input;
+}
+
+void ct_fuzz_end_input(struct ct_model* model) {
+	ct_reset_tests(model);
+}
+
+void ct_fuzz_teardown() {
+	if (ct_model == NULL) {
+		return;
+	}
+	if (ct_model->ct_teardown != NULL) {
+		ct_model->ct_teardown();
+	}
+	ct_teardown_default_model(ct_model);
+	ct_model = NULL;
+}
+
+bool ct_is_fuzzing(const struct ct_model* model) {
+	return model->fuzzer_input != NULL;
+}
+
+struct ct_fuzz_input* ct_fuzz_start(struct ct_model* model) {
+	struct ct_fuzz_corpus* corpus;
+
+	ct_allocation_tracker_pause();
+	if (ct_is_fuzzing(model)) {
+		corpus = ct_init_fuzz_corpus(1);
+		corpus->inputs[0] = *model->fuzzer_input;
+	} else if (model->corpus_path != NULL) {
+		corpus = ct_load_fuzz_corpus(model->corpus_path);
+	} else {
+		//like a fuzzer, without a corpus we start from the empty input
+		corpus = ct_init_fuzz_corpus(1);
+		corpus->inputs[0] = (struct ct_fuzz_input) { NULL, ct_empty_fuzz_data, 0, false };
+	}
+
+	for (int i = 0; i < corpus->inputs_number; i++) {
+		corpus->selected[i] = i;
+	}
+	corpus->selected_number = corpus->inputs_number;
+	ct_allocation_tracker_resume();
+
+	//in a distributed run the processes are the workers of the coordinator: the inputs are not split any further
+	if (!ct_is_fuzzing(model) && model->distribution == NULL && corpus->inputs_number > 1 && ct_get_workers_number(model) > 1) {
+		if (ct_fuzz_split_among_workers(model, corpus)) {
+			//we are a worker process: only our share of the inputs is in corpus->selected
+		} else {
+			//we are the test process: only the inputs which failed in the workers are run again
+			corpus->selected_number = 0;
+			for (int i = 0; i < corpus->inputs_number; i++) {
+				if (corpus->failed[i]) {
+					corpus->selected[corpus->selected_number] = i;
+					corpus->selected_number += 1;
+				}
+			}
+		}
+	}
+
+	model->fuzz_corpus = corpus;
+	corpus->current = -1;
+	return ct_fuzz_next(model);
+}
+
+struct ct_fuzz_input* ct_fuzz_next(struct ct_model* model) {
+	struct ct_fuzz_corpus* corpus = model->fuzz_corpus;
+
+	if (corpus->worker && corpus->current >= 0) {
+		//tell the test process if the input we have just run failed, otherwise send it the tests
+		int input = corpus->selected[corpus->current];
+		for (int i = corpus->reports_before_input; i < ct_list_size(model->test_reports_list); i++) {
+			struct ct_test_report* report = ct_list_get(model->test_reports_list, i);
+			if (report->outcome == CT_TEST_FAILURE) {
+				corpus->failed[input] = true;
+			}
+		}
+		if (!corpus->failed[input]) {
+			ct_fuzz_send_tests(model, corpus, input);
+		}
+	}
+
+	corpus->current += 1;
+	if (corpus->current < corpus->selected_number) {
+		//the tests of the inputs before this one, run by the workers, come first
+		ct_fuzz_add_received_tests(model, corpus, corpus->selected[corpus->current]);
+		corpus->reports_before_input = ct_list_size(model->test_reports_list);
+		return &corpus->inputs[corpus->selected[corpus->current]];
+	}
+
+	if (corpus->worker) {
+		//the output buffered by the worker belongs to the tests run by the test process
+		ct_allocation_tracker_pause();
+		bool sent = !ferror(corpus->channel) && fclose(corpus->channel) == 0;
+		_exit(sent ? EXIT_SUCCESS : EXIT_FAILURE);
+	}
+	ct_fuzz_add_received_tests(model, corpus, corpus->inputs_number);
+	const struct ct_section* claimed_testcase = corpus->claimed_testcase;
+	model->fuzz_corpus = NULL;
+	ct_allocation_tracker_pause();
+	ct_destroy_fuzz_corpus(corpus);
+	ct_allocation_tracker_resume();
+	ct_distribution_end_testcase(model, claimed_testcase);
+	return NULL;
+}
+
+bool ct_fuzz_claim(struct ct_model* model) {
+	struct ct_fuzz_corpus* corpus = model->fuzz_corpus;
+
+	if (model->distribution == NULL || corpus->claimed_testcase != NULL) {
+		return true;
+	}
+	//every input has its own section: the coordinator knows only the first one
+	corpus->claimed_testcase = model->current_section;
+	if (ct_distribution_claim(model, model->current_section)) {
+		return true;
+	}
+	ct_section_set_skipped(model->current_section);
+	corpus->current = corpus->selected_number;
+	return false;
+}
+
+void ct_destroy_fuzz_corpus(struct ct_fuzz_corpus* corpus) {
+	for (int i = 0; i < corpus->inputs_number; i++) {
+		if (corpus->inputs[i].mapped) {
+			munmap((void*) corpus->inputs[i].data, corpus->inputs[i].size);
+		}
+		free(corpus->inputs[i].path);
+	}
+	if (corpus->failed != NULL) {
+		munmap(corpus->failed, sizeof(bool) * corpus->inputs_number);
+	}
+	if (corpus->received != NULL) {
+		for (int i = 0; i < corpus->inputs_number; i++) {
+			if (corpus->received[i] != NULL) {
+				ct_list_destroy_with_elements(corpus->received[i], (ct_destroyer_c) ct_destroy_test_report);
+			}
+		}
+		free(corpus->received);
+	}
+	free(corpus->selected);
+	free(corpus->inputs);
+	free(corpus);
+}
+
+void ct_fuzz_update_test_report(struct ct_model* model, struct ct_test_report* report) {
+	struct ct_fuzz_input* input = ct_fuzz_current_input(model);
+
+	if (input == NULL || input->path == NULL) {
+		return;
+	}
+	report->fuzz_input = strdup(input->path);
+	if (report->fuzz_input == NULL) {
+		CT_MALLOC_ERROR_CALLBACK();
+	}
+}
+
+/**
+ * Creates a corpus with uninitialized inputs
+ *
+ * @param[in] inputs_number the number of inputs of the corpus
+ * @return the corpus
+ */
+static struct ct_fuzz_corpus* ct_init_fuzz_corpus(int inputs_number) {
+	struct ct_fuzz_corpus* ret_val = malloc(sizeof(struct ct_fuzz_corpus));
+	if (ret_val == NULL) {
+		CT_MALLOC_ERROR_CALLBACK();
+	}
+	ret_val->inputs = malloc(sizeof(struct ct_fuzz_input) * (inputs_number > 0 ? inputs_number : 1));
+	ret_val->selected = malloc(sizeof(int) * (inputs_number > 0 ? inputs_number : 1));
+	if (ret_val->inputs == NULL || ret_val->selected == NULL) {
+		CT_MALLOC_ERROR_CALLBACK();
+	}
+
+	ret_val->inputs_number = inputs_number;
+	ret_val->selected_number = 0;
+	ret_val->current = -1;
+	ret_val->failed = NULL;
+	ret_val->worker = false;
+	ret_val->reports_before_input = 0;
+	ret_val->channel = NULL;
+	ret_val->received = NULL;
+	ret_val->next_received = 0;
+	ret_val->claimed_testcase = NULL;
+
+	return ret_val;
+}
+
+/**
+ * Memory-maps every regular file inside a directory
+ *
+ * @param[in] directory the directory containing the corpus
+ * @return the corpus, whose inputs are sorted by path
+ */
+static struct ct_fuzz_corpus* ct_load_fuzz_corpus(const char* directory) {
+	DIR* dir = opendir(directory);
+	if (dir == NULL) {
+		fprintf(stderr, "CrashC - cannot open the corpus directory \"%s\"\n", directory);
+		exit(1);
+	}
+
+	int capacity = 16;
+	int inputs_number = 0;
+	struct ct_fuzz_input* inputs = malloc(sizeof(struct ct_fuzz_input) * capacity);
+	if (inputs == NULL) {
+		CT_MALLOC_ERROR_CALLBACK();
+	}
+
+	struct dirent* entry;
+	struct stat file_stat;
+	while ((entry = readdir(dir)) != NULL) {
+		size_t path_length = strlen(directory) + strlen(entry->d_name) + 2;
+		char* path = malloc(path_length);
+		if (path == NULL) {
+			CT_MALLOC_ERROR_CALLBACK();
+		}
+		snprintf(path, path_length, "%s/%s", directory, entry->d_name);
+		if (stat(path, &file_stat) != 0 || !S_ISREG(file_stat.st_mode)) {
+			free(path);
+			continue;
+		}
+
+		if (inputs_number == capacity) {
+			capacity *= 2;
+			inputs = realloc(inputs, sizeof(struct ct_fuzz_input) * capacity);
+			if (inputs == NULL) {
+				CT_MALLOC_ERROR_CALLBACK();
+			}
+		}
+		inputs[inputs_number].path = path;
+		inputs_number += 1;
+	}
+	closedir(dir);
+
+	qsort(inputs, inputs_number, sizeof(struct ct_fuzz_input), ct_compare_fuzz_inputs);
+	for (int i = 0; i < inputs_number; i++) {
+		ct_map_fuzz_input(&inputs[i]);
+	}
+
+	struct ct_fuzz_corpus* ret_val = ct_init_fuzz_corpus(0);
+	free(ret_val->inputs);
+	free(ret_val->selected);
+	ret_val->inputs = inputs;
+	ret_val->inputs_number = inputs_number;
+	ret_val->selected = malloc(sizeof(int) * (inputs_number > 0 ? inputs_number : 1));
+	if (ret_val->selected == NULL) {
+		CT_MALLOC_ERROR_CALLBACK();
+	}
+
+	return ret_val;
+}
+
+/**
+ * Maps in memory the file of an input
+ *
+ * @param[inout] input the input whose struct ct_fuzz_input::path is already set
+ */
+static void ct_map_fuzz_input(struct ct_fuzz_input* input) {
+	struct stat file_stat;
+
+	input->data = ct_empty_fuzz_data;
+	input->size = 0;
+	input->mapped = false;
+
+	int fd = open(input->path, O_RDONLY);
+	if (fd < 0 || fstat(fd, &file_stat) != 0) {
+		fprintf(stderr, "CrashC - cannot read the corpus file \"%s\"\n", input->path);
+		exit(1);
+	}
+	if (file_stat.st_size > 0) {
+		void* data = mmap(NULL, file_stat.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+		if (data == MAP_FAILED) {
+			fprintf(stderr, "CrashC - cannot map the corpus file \"%s\"\n", input->path);
+			exit(1);
+		}
+		input->data = data;
+		input->size = file_stat.st_size;
+		input->mapped = true;
+	}
+	close(fd);
+}
+
+static int ct_compare_fuzz_inputs(const void* a, const void* b) {
+	return strcmp(((const struct ct_fuzz_input*) a)->path, ((const struct ct_fuzz_input*) b)->path);
+}
+
+/**
+ * Splits the inputs of a corpus among several forked worker processes
+ *
+ * Each worker runs every input whose index is congruent to its own id modulo the number of workers. It marks in struct ct_fuzz_corpus::failed
+ * the ones which failed and sends back through a pipe the tests of the other ones, which the test process keeps in struct ct_fuzz_corpus::received.
+ * The test process waits for every worker: if a worker dies or sends something it can't understand, all its inputs are marked as failed.
+ *
+ * @param[inout] model the model to handle
+ * @param[inout] corpus the corpus to split
+ * @return @true in the worker processes, @false in the test process once every worker has terminated
+ */
+static bool ct_fuzz_split_among_workers(struct ct_model* model, struct ct_fuzz_corpus* corpus) {
+	int workers_number = ct_get_workers_number(model);
+	if (workers_number > corpus->inputs_number) {
+		workers_number = corpus->inputs_number;
+	}
+
+	corpus->failed = mmap(NULL, sizeof(bool) * corpus->inputs_number, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_ANONYMOUS, -1, 0);
+	if (corpus->failed == MAP_FAILED) {
+		perror("CrashC - cannot share the fuzzing results among workers");
+		exit(1);
+	}
+	memset(corpus->failed, 0, sizeof(bool) * corpus->inputs_number);
+
+	ct_allocation_tracker_pause();
+	pid_t* workers = malloc(sizeof(pid_t) * workers_number);
+	int* channels = malloc(sizeof(int) * workers_number);
+	ct_allocation_tracker_resume();
+	if (workers == NULL || channels == NULL) {
+		CT_MALLOC_ERROR_CALLBACK();
+	}
+
+	//the buffered output would be printed by every worker as well
+	fflush(NULL);
+	for (int w = 0; w < workers_number; w++) {
+		int channel[2];
+		if (pipe(channel) != 0) {
+			perror("CrashC - cannot create a pipe towards a fuzzing worker");
+			exit(1);
+		}
+		pid_t pid = fork();
+		if (pid < 0) {
+			perror("CrashC - cannot fork a fuzzing worker");
+			exit(1);
+		}
+		if (pid == 0) {
+			//the read ends of the previous workers would keep their pipes open
+			for (int previous = 0; previous < w; previous++) {
+				close(channels[previous]);
+			}
+			close(channel[0]);
+			ct_allocation_tracker_pause();
+			corpus->channel = fdopen(channel[1], "w");
+			free(channels);
+			free(workers);
+			ct_allocation_tracker_resume();
+			if (corpus->channel == NULL) {
+				_exit(EXIT_FAILURE);
+			}
+			corpus->worker = true;
+			corpus->selected_number = 0;
+			for (int i = w; i < corpus->inputs_number; i += workers_number) {
+				corpus->selected[corpus->selected_number] = i;
+				corpus->selected_number += 1;
+			}
+			return true;
+		}
+		close(channel[1]);
+		channels[w] = channel[0];
+		workers[w] = pid;
+	}
+
+	ct_allocation_tracker_pause();
+	corpus->received = calloc(corpus->inputs_number, sizeof(ct_list_o*));
+	if (corpus->received == NULL) {
+		CT_MALLOC_ERROR_CALLBACK();
+	}
+	if (model->fuzz_arena == NULL) {
+		model->fuzz_arena = ct_init_report_arena();
+	}
+	for (int w = 0; w < workers_number; w++) {
+		//a worker can't terminate until what it sends has been read
+		struct ct_serialized_buffer buffer;
+		ct_read_serialized_data(channels[w], &buffer);
+		close(channels[w]);
+
+		int status;
+		while (waitpid(workers[w], &status, 0) < 0) {
+			if (errno != EINTR) {
+				perror("CrashC - cannot wait for a fuzzing worker");
+				exit(1);
+			}
+		}
+		bool received = WIFEXITED(status) && WEXITSTATUS(status) == EXIT_SUCCESS && ct_fuzz_receive_tests(model, corpus, &buffer, w, workers_number);
+		free(buffer.data);
+		if (!received) {
+			for (int i = w; i < corpus->inputs_number; i += workers_number) {
+				corpus->failed[i] = true;
+				if (corpus->received[i] != NULL) {
+					ct_list_destroy_with_elements(corpus->received[i], (ct_destroyer_c) ct_destroy_test_report);
+					corpus->received[i] = NULL;
+				}
+			}
+		}
+	}
+
+	free(channels);
+	free(workers);
+	ct_allocation_tracker_resume();
+	return false;
+}
+
+/**
+ * Sends the tests of an input which has passed to the test process
+ *
+ * For every input, the worker writes the index of the input, the number of its tests and the tests themselves.
+ *
+ * @param[in] model the model of the worker process
+ * @param[inout] corpus the corpus of the worker process
+ * @param[in] input the index of the input just run
+ */
+static void ct_fuzz_send_tests(struct ct_model* model, struct ct_fuzz_corpus* corpus, int input) {
+	int reports_number = ct_list_size(model->test_reports_list) - corpus->reports_before_input;
+
+	ct_allocation_tracker_pause();
+	fwrite(&input, sizeof(input), 1, corpus->channel);
+	fwrite(&reports_number, sizeof(reports_number), 1, corpus->channel);
+	int index = 0;
+	CT_ITERATE_ON_LIST(model->test_reports_list, cell, report, struct ct_test_report*) {
+		if (index >= corpus->reports_before_input) {
+			ct_serialize_test_report(corpus->channel, report);
+		}
+		index += 1;
+	}
+	ct_allocation_tracker_resume();
+}
+
+/**
+ * Deserializes the tests a worker process has sent back into struct ct_fuzz_corpus::received
+ *
+ * @param[inout] model the model of the test process
+ * @param[inout] corpus the corpus of the test process
+ * @param[inout] buffer what the worker has sent
+ * @param[in] worker the id of the worker
+ * @param[in] workers_number the number of workers the inputs have been split among
+ * @return @true if the worker has sent only whole tests of its own inputs, @false otherwise
+ */
+static bool ct_fuzz_receive_tests(struct ct_model* model, struct ct_fuzz_corpus* corpus, struct ct_serialized_buffer* buffer, int worker, int workers_number) {
+	while (buffer->position < buffer->size && !buffer->corrupted) {
+		int input;
+		int reports_number;
+		ct_deserialize_bytes(buffer, &input, sizeof(input));
+		ct_deserialize_bytes(buffer, &reports_number, sizeof(reports_number));
+		if (buffer->corrupted || input < 0 || input >= corpus->inputs_number || input % workers_number != worker || corpus->failed[input]) {
+			return false;
+		}
+
+		if (corpus->received[input] == NULL) {
+			corpus->received[input] = ct_list_init();
+		}
+		for (int i = 0; i < reports_number && !buffer->corrupted; i++) {
+			ct_list_add_tail(corpus->received[input], ct_deserialize_test_report(buffer, model->fuzz_arena));
+		}
+	}
+	return !buffer->corrupted;
+}
+
+/**
+ * Adds to the model the tests the worker processes have sent back for the inputs preceding a given one
+ *
+ * The listeners are notified of the tests, as if they had just ended.
+ *
+ * @param[inout] model the model of the test process
+ * @param[inout] corpus the corpus of the test process
+ * @param[in] input the index of the first input whose tests are not added
+ */
+static void ct_fuzz_add_received_tests(struct ct_model* model, struct ct_fuzz_corpus* corpus, int input) {
+	if (corpus->received == NULL) {
+		return;
+	}
+
+	for (; corpus->next_received < input; corpus->next_received++) {
+		ct_list_o* received = corpus->received[corpus->next_received];
+		if (received == NULL) {
+			continue;
+		}
+		if (CT_HAS_LISTENERS(model, CT_EVENT_TEST_END)) {
+			CT_ITERATE_ON_LIST(received, cell, report, struct ct_test_report*) {
+				ct_dispatch_test_end(model, report);
+			}
+		}
+		ct_allocation_tracker_pause();
+		ct_list_full_transfer(model->test_reports_list, received);
+		ct_list_destroy(received);
+		ct_allocation_tracker_resume();
+		corpus->received[corpus->next_received] = NULL;
+	}
+}
+
+/**
+ * Fetches the input the running ::FUZZ_TESTCASE is using
+ *
+ * @param[in] model the model to handle
+ * @return the input or @null if no ::FUZZ_TESTCASE is running
+ */
+static struct ct_fuzz_input* ct_fuzz_current_input(struct ct_model* model) {
+	struct ct_fuzz_corpus* corpus = model->fuzz_corpus;
+
+	if (corpus == NULL || corpus->current < 0 || corpus->current >= corpus->selected_number) {
+		return NULL;
+	}
+	return &corpus->inputs[corpus->selected[corpus->current]];
+}
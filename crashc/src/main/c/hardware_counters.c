@@ -0,0 +1,175 @@
+/*
+ * hardware_counters.c
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: koldar
+ */
+
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <unistd.h>
+
+#ifdef __linux__
+#	include <sys/ioctl.h>
+#	include <sys/syscall.h>
+#	include <linux/perf_event.h>
+#endif
+
+#include "hardware_counters.h"
+#include "errors.h"
+
+static long long* ct_hardware_counter_field(struct ct_hardware_counters* counters, enum ct_hardware_event event);
+static void ct_set_hardware_counters_unavailable(struct ct_hardware_counters* counters);
+#ifdef __linux__
+static int ct_open_hardware_counter(enum ct_hardware_event event, int group_fd);
+#endif
+
+struct ct_hardware_counters_group* ct_init_hardware_counters_group() {
+	struct ct_hardware_counters_group* ret_val = malloc(sizeof(struct ct_hardware_counters_group));
+	if (ret_val == NULL) {
+		CT_MALLOC_ERROR_CALLBACK();
+	}
+
+	ret_val->available = false;
+	ret_val->leader_fd = -1;
+	ret_val->size = 0;
+	for (int i = 0; i < CT_HW_EVENTS_NUMBER; i++) {
+		ret_val->fds[i] = -1;
+		ret_val->positions[i] = -1;
+	}
+
+#if defined(__linux__) && CT_HARDWARE_COUNTERS_ENABLED
+	for (int i = 0; i < CT_HW_EVENTS_NUMBER; i++) {
+		int fd = ct_open_hardware_counter(i, ret_val->leader_fd);
+		if (fd < 0) {
+			//the event is not supported or we can't access it: we just go without it
+			continue;
+		}
+		if (ret_val->leader_fd < 0) {
+			ret_val->leader_fd = fd;
+		}
+		ret_val->fds[i] = fd;
+		ret_val->positions[i] = ret_val->size;
+		ret_val->size += 1;
+	}
+	ret_val->available = ret_val->size > 0;
+#endif
+
+	return ret_val;
+}
+
+void ct_destroy_hardware_counters_group(struct ct_hardware_counters_group* group) {
+	for (int i = 0; i < CT_HW_EVENTS_NUMBER; i++) {
+		if (group->fds[i] >= 0) {
+			close(group->fds[i]);
+		}
+	}
+	free(group);
+}
+
+void ct_hardware_counters_enable(struct ct_hardware_counters_group* group) {
+#ifdef __linux__
+	if (group->available) {
+		ioctl(group->leader_fd, PERF_EVENT_IOC_ENABLE, PERF_IOC_FLAG_GROUP);
+	}
+#endif
+}
+
+void ct_hardware_counters_disable(struct ct_hardware_counters_group* group) {
+#ifdef __linux__
+	if (group->available) {
+		ioctl(group->leader_fd, PERF_EVENT_IOC_DISABLE, PERF_IOC_FLAG_GROUP);
+	}
+#endif
+}
+
+bool ct_read_hardware_counters(const struct ct_hardware_counters_group* group, struct ct_hardware_counters* counters) {
+	ct_set_hardware_counters_unavailable(counters);
+	if (!group->available) {
+		return false;
+	}
+
+	//with PERF_FORMAT_GROUP the kernel returns the number of counters followed by the value of each of them
+	uint64_t buffer[1 + CT_HW_EVENTS_NUMBER];
+	ssize_t bytes_read = read(group->leader_fd, buffer, sizeof(buffer));
+	if (bytes_read < (ssize_t) sizeof(uint64_t) || buffer[0] != (uint64_t) group->size) {
+		return false;
+	}
+
+	for (int i = 0; i < CT_HW_EVENTS_NUMBER; i++) {
+		if (group->positions[i] >= 0) {
+			*ct_hardware_counter_field(counters, i) = (long long) buffer[1 + group->positions[i]];
+		}
+	}
+	return true;
+}
+
+void ct_begin_hardware_counters(const struct ct_hardware_counters_group* group, struct ct_hardware_counters* counters) {
+	ct_read_hardware_counters(group, counters);
+}
+
+void ct_end_hardware_counters(const struct ct_hardware_counters_group* group, struct ct_hardware_counters* counters) {
+	struct ct_hardware_counters now;
+	ct_read_hardware_counters(group, &now);
+
+	for (int i = 0; i < CT_HW_EVENTS_NUMBER; i++) {
+		long long* start = ct_hardware_counter_field(counters, i);
+		long long end = *ct_hardware_counter_field(&now, i);
+		if (*start == CT_HARDWARE_COUNTER_UNAVAILABLE || end == CT_HARDWARE_COUNTER_UNAVAILABLE) {
+			*start = CT_HARDWARE_COUNTER_UNAVAILABLE;
+		} else {
+			*start = end - *start;
+		}
+	}
+}
+
+static long long* ct_hardware_counter_field(struct ct_hardware_counters* counters, enum ct_hardware_event event) {
+	switch (event) {
+	case CT_HW_INSTRUCTIONS: return &counters->instructions;
+	case CT_HW_CYCLES: return &counters->cycles;
+	case CT_HW_CACHE_MISSES: return &counters->cache_misses;
+	case CT_HW_BRANCH_MISSES: return &counters->branch_misses;
+	default: return NULL;
+	}
+}
+
+static void ct_set_hardware_counters_unavailable(struct ct_hardware_counters* counters) {
+	counters->instructions = CT_HARDWARE_COUNTER_UNAVAILABLE;
+	counters->cycles = CT_HARDWARE_COUNTER_UNAVAILABLE;
+	counters->cache_misses = CT_HARDWARE_COUNTER_UNAVAILABLE;
+	counters->branch_misses = CT_HARDWARE_COUNTER_UNAVAILABLE;
+}
+
+#ifdef __linux__
+/**
+ * Opens a single hardware counter of the calling process
+ *
+ * @param[in] event the event to count
+ * @param[in] group_fd the leader of the group the counter will belong to. -1 if the counter will be the leader itself
+ * @return the file descriptor of the counter or -1 if the counter could not be opened
+ */
+static int ct_open_hardware_counter(enum ct_hardware_event event, int group_fd) {
+	static const uint64_t configs[CT_HW_EVENTS_NUMBER] = {
+		[CT_HW_INSTRUCTIONS] = PERF_COUNT_HW_INSTRUCTIONS,
+		[CT_HW_CYCLES] = PERF_COUNT_HW_CPU_CYCLES,
+		[CT_HW_CACHE_MISSES] = PERF_COUNT_HW_CACHE_MISSES,
+		[CT_HW_BRANCH_MISSES] = PERF_COUNT_HW_BRANCH_MISSES,
+	};
+	struct perf_event_attr attr;
+
+	memset(&attr, 0, sizeof(struct perf_event_attr));
+	attr.size = sizeof(struct perf_event_attr);
+	attr.type = PERF_TYPE_HARDWARE;
+	attr.config = configs[event];
+	attr.read_format = PERF_FORMAT_GROUP;
+	//only the leader is disabled: the other counters are scheduled together with it
+	attr.disabled = (group_fd < 0) ? 1 : 0;
+	//counting only user space events keeps us working with perf_event_paranoid up to 2
+	attr.exclude_kernel = 1;
+	attr.exclude_hv = 1;
+
+	//the counters measure this process only: the programs it runs have no use for them
+	return (int) syscall(SYS_perf_event_open, &attr, 0, -1, group_fd, PERF_FLAG_FD_CLOEXEC);
+}
+#endif
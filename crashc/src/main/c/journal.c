@@ -0,0 +1,222 @@
+/*
+ * journal.c
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: koldar
+ */
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <unistd.h>
+#include <fcntl.h>
+
+#include "journal.h"
+#include "events.h"
+#include "model.h"
+#include "section.h"
+#include "test_report.h"
+#include "utils.h"
+#include "macros.h"
+#include "errors.h"
+
+static struct ct_testcase_key* ct_init_testcase_key(unsigned long path_hash, int occurrence) {
+	struct ct_testcase_key* ret_val = malloc(sizeof(struct ct_testcase_key));
+	if (ret_val == NULL) {
+		CT_MALLOC_ERROR_CALLBACK();
+	}
+
+	ret_val->path_hash = path_hash;
+	ret_val->occurrence = occurrence;
+
+	return ret_val;
+}
+
+/**
+ * Reads the @testcase completed by the previous invocations
+ *
+ * If the last invocation has been killed while writing a record, the truncated record is removed, so that the new records don't get appended to it.
+ *
+ * @param[inout] journal the journal to fill
+ * @param[in] path the file of the journal
+ */
+static void ct_load_journal(struct ct_journal* journal, const char* path) {
+	FILE* file = fopen(path, "r");
+	if (file == NULL) {
+		return;
+	}
+
+	char* line = NULL;
+	size_t line_size = 0;
+	ssize_t length;
+	off_t complete_size = 0;
+	bool truncated = false;
+	struct ct_testcase_key key;
+	while ((length = getline(&line, &line_size, file)) > 0) {
+		if (line[length - 1] != '\n') {
+			truncated = true;
+			break;
+		}
+		complete_size += length;
+		if (line[0] != 'D' || sscanf(line, "D %lx %d", &key.path_hash, &key.occurrence) != 2) {
+			continue;
+		}
+		unsigned long hash = ct_testcase_key_hash(&key);
+		if (ct_ht_get(journal->completed_testcases, hash) == NULL) {
+			ct_ht_put(journal->completed_testcases, hash, ct_init_testcase_key(key.path_hash, key.occurrence));
+		}
+	}
+
+	free(line);
+	fclose(file);
+	if (truncated && truncate(path, complete_size) != 0) {
+		perror("CrashC - cannot remove the truncated record of the journal");
+	}
+}
+
+/**
+ * Appends a record to the journal
+ *
+ * @param[inout] journal the journal to handle
+ * @param[in] record the record, ending with a newline
+ * @param[in] length the number of bytes of \c record
+ */
+static void ct_journal_write(struct ct_journal* journal, const char* record, size_t length) {
+	if (write(journal->file, record, length) != (ssize_t) length) {
+		return;
+	}
+	journal->dirty = true;
+
+	struct timespec now = ct_get_time();
+	if (ct_compute_time_gap(journal->last_sync, now, "u") >= CT_JOURNAL_SYNC_PERIOD) {
+		fdatasync(journal->file);
+		journal->last_sync = now;
+		journal->dirty = false;
+	}
+}
+
+/**
+ * Appends a string to a record, replacing the newlines
+ *
+ * @param[inout] record the record to extend
+ * @param[in] length the number of bytes already in \c record
+ * @param[in] string the string to append
+ * @return the number of bytes in \c record. At most ::CT_JOURNAL_RECORD_SIZE - 2, to leave room for the newline
+ */
+static size_t ct_journal_append(char* record, size_t length, const char* string) {
+	for (; *string != '\0' && length < CT_JOURNAL_RECORD_SIZE - 2; string++, length++) {
+		record[length] = (*string == '\n') ? ' ' : *string;
+	}
+	return length;
+}
+
+static void ct_journal_on_test_end(struct ct_model* model, void* data, struct ct_test_report* report) {
+	struct ct_journal* journal = data;
+	char record[CT_JOURNAL_RECORD_SIZE];
+	//a test of a FUZZ_TESTCASE is not part of any testcase the journal knows about
+	struct ct_testcase_key key = (journal->testcase == model->jump_source_testcase) ? model->testcase_key : (struct ct_testcase_key) { 0, -1 };
+
+	int header = snprintf(record, sizeof(record), "T %lx %d %c %d %ld ",
+			key.path_hash, key.occurrence, (report->outcome == CT_TEST_SUCCESS) ? 'S' : 'F', report->repetition, report->testcase_snapshot->elapsed_time);
+	size_t length = (header < CT_JOURNAL_RECORD_SIZE - 2) ? header : CT_JOURNAL_RECORD_SIZE - 2;
+
+	//the path of the test is the chain of the WHEN it entered
+	const struct ct_snapshot* snapshot = report->testcase_snapshot;
+	while (snapshot != NULL) {
+		if (snapshot != report->testcase_snapshot) {
+			length = ct_journal_append(record, length, (char[]) { CT_SECTION_PATH_SEPARATOR, '\0' });
+		}
+		length = ct_journal_append(record, length, snapshot->description);
+
+		const struct ct_snapshot* child = snapshot->first_child;
+		while (child != NULL && child->type != CT_WHEN_SECTION) {
+			child = child->next_sibling;
+		}
+		snapshot = child;
+	}
+	record[length] = '\n';
+
+	ct_journal_write(journal, record, length + 1);
+}
+
+struct ct_journal* ct_enable_journal(struct ct_model* model, const char* path, bool resume) {
+	struct ct_journal* ret_val = malloc(sizeof(struct ct_journal));
+	if (ret_val == NULL) {
+		CT_MALLOC_ERROR_CALLBACK();
+	}
+
+	ret_val->completed_testcases = ct_ht_init();
+	ret_val->testcase = NULL;
+	ret_val->completed = false;
+	ret_val->skipped_testcases = 0;
+	ret_val->last_sync = ct_get_time();
+	ret_val->dirty = false;
+
+	if (resume) {
+		ct_load_journal(ret_val, path);
+	}
+	ret_val->file = open(path, O_WRONLY | O_CREAT | O_APPEND | O_CLOEXEC | (resume ? 0 : O_TRUNC), 0644);
+	if (ret_val->file < 0) {
+		perror("CrashC - cannot open the journal");
+		exit(EXIT_FAILURE);
+	}
+	ct_journal_write(ret_val, "R\n", 2);
+
+	struct ct_event_listener listener = {
+		.on_suite_start = NULL,
+		.on_section_enter = NULL,
+		.on_assert_fail = NULL,
+		.on_test_end = ct_journal_on_test_end,
+		.on_run_end = NULL,
+		.data = ret_val
+	};
+	ct_subscribe_listener(model, &listener);
+	model->journal = ret_val;
+
+	return ret_val;
+}
+
+bool ct_journal_testcase_completed(struct ct_model* model, const struct ct_section* testcase) {
+	struct ct_journal* journal = model->journal;
+	if (testcase != journal->testcase) {
+		journal->testcase = testcase;
+		journal->completed = ct_journal_key_completed(journal, ct_get_testcase_key(model, testcase));
+		if (journal->completed) {
+			journal->skipped_testcases += 1;
+		}
+	}
+	return journal->completed;
+}
+
+void ct_journal_end_testcase(struct ct_model* model, const struct ct_section* testcase) {
+	struct ct_journal* journal = model->journal;
+	if (testcase != journal->testcase) {
+		return;
+	}
+
+	ct_journal_complete_key(journal, ct_get_testcase_key(model, testcase));
+}
+
+bool ct_journal_key_completed(const struct ct_journal* journal, const struct ct_testcase_key* key) {
+	struct ct_testcase_key* completed = ct_ht_get(journal->completed_testcases, ct_testcase_key_hash(key));
+	//on a hash collision the testcase is simply run again
+	return completed != NULL && completed->path_hash == key->path_hash && completed->occurrence == key->occurrence;
+}
+
+void ct_journal_complete_key(struct ct_journal* journal, const struct ct_testcase_key* key) {
+	char record[CT_BUFFER_SIZE];
+	int length = snprintf(record, sizeof(record), "D %lx %d\n", key->path_hash, key->occurrence);
+	ct_journal_write(journal, record, length);
+}
+
+void ct_destroy_journal(struct ct_journal* journal) {
+	if (journal->dirty) {
+		fdatasync(journal->file);
+	}
+	close(journal->file);
+	if (journal->skipped_testcases > 0) {
+		fprintf(stderr, "CrashC - %d testcases already completed in the journal have been skipped\n", journal->skipped_testcases);
+	}
+	ct_ht_destroy_with_elements(journal->completed_testcases, (ct_destroyer_c) free);
+	free(journal);
+}
@@ -119,6 +119,11 @@ int ct_list_size(const ct_list_o* l) {
 }
 
 void ct_list_full_transfer(ct_list_o* restrict dst, ct_list_o* restrict src) {
+	//an empty source would leave dst without its tail
+	if (ct_list_is_empty(src)) {
+		return;
+	}
+
 	//*********** DST **********
 	dst->size += ct_list_size(src);
 	if (dst->head == NULL) {
@@ -155,6 +160,36 @@ void* ct_list_pop(ct_list_o* l) {
 	return ret_val;
 }
 
+void* ct_list_pop_tail(ct_list_o* l) {
+	if (ct_list_is_empty(l)) {
+		return NULL;
+	}
+
+	ct_list_entry_o* cell = l->tail;
+	void* ret_val = cell->payload;
+	if (l->head == cell) {
+		l->head = NULL;
+		l->tail = NULL;
+	} else {
+		ct_list_entry_o* previous = l->head;
+		while (previous->next != cell) {
+			previous = previous->next;
+		}
+		previous->next = NULL;
+		l->tail = previous;
+	}
+	l->size--;
+
+	free(cell);
+	return ret_val;
+}
+
+void* ct_list_replace_tail(ct_list_o* l, const void* el) {
+	void* ret_val = l->tail->payload;
+	l->tail->payload = (void*) el;
+	return ret_val;
+}
+
 void* ct_list_head(const ct_list_o* l) {
 	if (ct_list_is_empty(l)) {
 		return NULL;
@@ -5,12 +5,26 @@
  *      Author: koldar
  */
 
+#include <stdio.h>
 #include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+#include <unistd.h>
 
 #include "test_report.h"
 #include "report_producer.h"
 #include "errors.h"
 #include "model.h"
+#include "events.h"
+#include "progress.h"
+#include "section_fork.h"
+#include "output_capture.h"
+#include "journal.h"
+#include "distribution.h"
+#include "coverage.h"
+#include "benchmark.h"
+#include "suite_order.h"
+#include "report_serialization.h"
 
 struct ct_model* ct_setup_default_model() {
 	struct ct_model* ret_val = malloc(sizeof(struct ct_model));
@@ -28,21 +42,320 @@ struct ct_model* ct_setup_default_model() {
 	ret_val->run_only_if_tags = ct_ht_init();
 	ret_val->exclude_tags = ct_ht_init();
 	ret_val->_crashc_sigaction = (struct sigaction) { 0 };
-	ret_val->root_section = ct_section_init(CT_ROOT_SECTION, "root", "");
+	ret_val->signal_stack = (stack_t) { 0 };
+	for (int i = 0; i < CT_HANDLED_SIGNALS_NUMBER; i++) {
+		ret_val->previous_sigactions[i] = (struct sigaction) { 0 };
+		ret_val->signal_handler_installed[i] = false;
+	}
+	ret_val->backtrace_buffer_size = 0;
+	ret_val->signaled_snapshot = NULL;
+	ret_val->main_thread = pthread_self();
+	ret_val->thread_assert_reports = NULL;
+	ret_val->thread_signal_detected = 0;
+	ret_val->thread_signal_code = 0;
+	ret_val->thread_signal_address = NULL;
+	ret_val->prepared_sites = NULL;
+	ret_val->root_site = (struct ct_section_site) CT_SECTION_SITE_INITIALIZER;
+	ct_section_site_prepare(&ret_val->root_site, "", &ret_val->prepared_sites);
+	ret_val->root_section = ct_section_init(CT_ROOT_SECTION, "root", ret_val->root_site.tags);
 	ret_val->statistics = ct_init_stats();
 	ret_val->report_producer_implementation = ct_init_default_report_producer();
 	ret_val->output_file = stdout;
+	ret_val->allocation_tracker = ct_init_allocation_tracker();
+	ret_val->measure_resources = false;
+	ret_val->hardware_counters = NULL;
+	ret_val->schedule_seeds = 0;
+	ret_val->schedule_replay_seed = -1;
+	ret_val->workers = 0;
+	ret_val->corpus_path = NULL;
+	ret_val->fuzzer_input = NULL;
+	ret_val->fuzz_corpus = NULL;
+	ret_val->fuzz_arena = NULL;
+	ret_val->repetitions = 1;
+	ret_val->repetition = 0;
+	ret_val->binary_report_path = NULL;
+	ret_val->event_dispatcher = ct_init_event_dispatcher();
+	ret_val->show_progress = false;
+	ret_val->history_path = NULL;
+	ret_val->progress = NULL;
+	ret_val->section_index = ct_ht_init();
+	ret_val->testcase_occurrences = ct_ht_init();
+	ret_val->keyed_testcase = NULL;
+	ret_val->testcase_key = (struct ct_testcase_key) { 0, -1 };
+	ret_val->selected_section_path = NULL;
+	ret_val->selected_path_prefixes = ct_ht_init();
+	ret_val->selected_path_level = 0;
+	ret_val->section_fork = NULL;
+	ret_val->output_capture = NULL;
+	ret_val->journal_path = NULL;
+	ret_val->resume = false;
+	ret_val->journal = NULL;
+	ret_val->coordinator_address = NULL;
+	ret_val->worker_address = NULL;
+	ret_val->distribution = NULL;
+	ret_val->coverage_index_path = NULL;
+	ret_val->collect_coverage = false;
+	ret_val->changed_files_path = NULL;
+	ret_val->coverage = NULL;
+	ret_val->benchmark_output = NULL;
+	ret_val->benchmark = NULL;
+	ret_val->benchmark_cpu = -1;
+	ret_val->benchmark_cold_cache = false;
+	ret_val->current_suite = 0;
+	ret_val->suite_order = CT_ORDER_DECLARATION;
 
 	return ret_val;
 }
 
 void ct_teardown_default_model(struct ct_model* ccm) {
+	ct_merge_thread_reports(ccm, NULL);
+	if (ccm->fuzz_corpus != NULL) {
+		ct_destroy_fuzz_corpus(ccm->fuzz_corpus);
+	}
+	free(ccm->fuzzer_input);
+	if (ccm->progress != NULL) {
+		ct_destroy_progress(ccm->progress);
+	}
+	ct_destroy_event_dispatcher(ccm->event_dispatcher);
+	if (ccm->selected_section_path != NULL && ct_find_section(ccm, ccm->selected_section_path) == NULL) {
+		fprintf(stderr, "CrashC - no section has path \"%s\"\n", ccm->selected_section_path);
+	}
+	ct_ht_destroy(ccm->section_index);
+	ct_ht_destroy_with_elements(ccm->testcase_occurrences, (ct_destroyer_c) free);
+	ct_ht_destroy(ccm->selected_path_prefixes);
 	ct_section_destroy(ccm->root_section);
 	ct_ht_destroy_with_elements(ccm->exclude_tags, (ct_destroyer_c)ct_tag_destroy);
 	ct_ht_destroy_with_elements(ccm->run_only_if_tags, (ct_destroyer_c)ct_tag_destroy);
 	ct_list_destroy_with_elements(ccm->test_reports_list, (ct_destroyer_c)ct_destroy_test_report);
+	if (ccm->fuzz_arena != NULL) {
+		ct_destroy_report_arena(ccm->fuzz_arena);
+	}
+	if (ccm->section_fork != NULL) {
+		ct_destroy_section_fork(ccm->section_fork);
+	}
+	if (ccm->output_capture != NULL) {
+		ct_destroy_output_capture(ccm->output_capture);
+	}
+	if (ccm->journal != NULL) {
+		ct_destroy_journal(ccm->journal);
+	}
+	if (ccm->distribution != NULL) {
+		ct_destroy_distribution(ccm->distribution);
+	}
+	if (ccm->coverage != NULL) {
+		ct_destroy_coverage(ccm->coverage);
+	}
+	if (ccm->benchmark != NULL) {
+		ct_destroy_benchmark(ccm->benchmark);
+	}
+	//the tags of the sections are used by the test reports as well
+	ct_section_sites_release(&ccm->prepared_sites);
 	ct_destroy_stats(ccm->statistics);
 	ct_destroy_default_report_producer(ccm->report_producer_implementation);
-	fclose(ccm->output_file);
+	free(ccm->signal_stack.ss_sp);
+	if (ccm->hardware_counters != NULL) {
+		ct_destroy_hardware_counters_group(ccm->hardware_counters);
+	}
+	ct_destroy_allocation_tracker(ccm->allocation_tracker);
+	//the allocation wrappers may still look at the model while we release it
+	ccm->allocation_tracker = NULL;
+	//the standard output isn't ours: the test program, and the fuzzer after ct_fuzz_teardown, keep writing to it
+	if (ccm->output_file != stdout) {
+		fclose(ccm->output_file);
+	}
 	free(ccm);
 }
+
+int ct_get_workers_number(const struct ct_model* model) {
+	int ret_val = model->workers;
+
+	if (ret_val <= 0) {
+		ret_val = (int) sysconf(_SC_NPROCESSORS_ONLN);
+	}
+	return (ret_val > 0) ? ret_val : 1;
+}
+
+/**
+ * Computes the hash of a section path
+ *
+ * @param[in] path the path to scan
+ * @param[inout] prefixes if not @null, the hash of every prefix of \c path is added to it, with the level of the section as value
+ * @param[out] level if not @null, the number of sections in \c path
+ * @return the hash of \c path
+ */
+static unsigned long ct_hash_section_path(const char* path, ct_hashtable_o* prefixes, int* level) {
+	unsigned long hash = CT_ROOT_PATH_HASH;
+	int sections = 0;
+	const char* description = path;
+
+	while (true) {
+		const char* end = strchr(description, CT_SECTION_PATH_SEPARATOR);
+		size_t length = (end != NULL) ? (size_t) (end - description) : strlen(description);
+
+		hash = ct_section_path_hash(hash, description, length);
+		sections += 1;
+		if (prefixes != NULL) {
+			ct_ht_put_or_update(prefixes, hash, (void*) (intptr_t) sections);
+		}
+		if (end == NULL) {
+			break;
+		}
+		description = end + 1;
+	}
+
+	if (level != NULL) {
+		*level = sections;
+	}
+	return hash;
+}
+
+/**
+ * Checks whether a section of a section path has a given description
+ *
+ * @param[in] path the path to check
+ * @param[in] level the level of the section to check in \c path, starting from 1
+ * @param[in] description the description the section should have
+ * @return @true if the section at \c level in \c path exists and has \c description, @false otherwise
+ */
+static bool ct_is_path_component(const char* path, int level, const char* description) {
+	const char* component = path;
+
+	for (int i = 1; i < level && component != NULL; i++) {
+		component = strchr(component, CT_SECTION_PATH_SEPARATOR);
+		component = (component != NULL) ? component + 1 : NULL;
+	}
+	if (component == NULL) {
+		return false;
+	}
+
+	const char* end = strchr(component, CT_SECTION_PATH_SEPARATOR);
+	size_t length = (end != NULL) ? (size_t) (end - component) : strlen(component);
+	return strlen(description) == length && strncmp(description, component, length) == 0;
+}
+
+/**
+ * Checks whether the descriptions of a section and of its ancestors are the ones in a section path
+ *
+ * @param[in] section the section to check
+ * @param[in] path the path \c section should have
+ * @param[in] path_level the number of sections in \c path
+ * @return @true if \c path is the path of \c section, @false otherwise
+ */
+static bool ct_section_has_path(const struct ct_section* section, const char* path, int path_level) {
+	int level = ct_section_get_level(section);
+
+	if (level != path_level) {
+		return false;
+	}
+	for (const struct ct_section* ancestor = section; ancestor->parent != NULL; ancestor = ancestor->parent, level--) {
+		if (!ct_is_path_component(path, level, ancestor->description)) {
+			return false;
+		}
+	}
+	return true;
+}
+
+/**
+ * Looks for a section by following the descriptions in a section path, depth first
+ *
+ * @param[in] section the section whose children need to be looked into
+ * @param[in] path the path of the section to look for
+ * @param[in] level the level of the children of \c section
+ * @param[in] path_level the number of sections in \c path
+ * @return the first section created with such path, or @null if there is none
+ */
+static struct ct_section* ct_walk_section_path(struct ct_section* section, const char* path, int level, int path_level) {
+	for (struct ct_section* child = section->first_child; child != NULL; child = child->next_sibling) {
+		if (!ct_is_path_component(path, level, child->description)) {
+			continue;
+		}
+		if (level == path_level) {
+			return child;
+		}
+		struct ct_section* ret_val = ct_walk_section_path(child, path, level + 1, path_level);
+		if (ret_val != NULL) {
+			return ret_val;
+		}
+	}
+	return NULL;
+}
+
+void ct_select_section_path(struct ct_model* model, const char* path) {
+	model->selected_section_path = path;
+	ct_ht_clear(model->selected_path_prefixes);
+	ct_hash_section_path(path, model->selected_path_prefixes, &model->selected_path_level);
+	//from now on, only the children of the root on the path are entered
+	model->root_section->inside_target = false;
+}
+
+void ct_index_section(struct ct_model* model, struct ct_section* section) {
+	const struct ct_section* parent = section->parent;
+
+	section->path_hash = ct_section_path_hash(parent->path_hash, section->description, strlen(section->description));
+	if (!ct_ht_contains(model->section_index, section->path_hash)) {
+		ct_ht_put(model->section_index, section->path_hash, section);
+	}
+
+	if (parent->inside_target) {
+		section->on_target_path = true;
+		section->inside_target = true;
+	} else {
+		int level = (int) (intptr_t) ct_ht_get(model->selected_path_prefixes, section->path_hash);
+		//the level protects from sections with the same hash at a different depth, the description from the ones at the same depth
+		section->on_target_path = parent->on_target_path && level == ct_section_get_level(section)
+				&& ct_is_path_component(model->selected_section_path, level, section->description);
+		section->inside_target = section->on_target_path && level == model->selected_path_level;
+	}
+}
+
+const struct ct_testcase_key* ct_get_testcase_key(struct ct_model* model, const struct ct_section* testcase) {
+	if (testcase == model->keyed_testcase) {
+		return &model->testcase_key;
+	}
+
+	struct ct_testcase_key* occurrences = ct_ht_get(model->testcase_occurrences, testcase->path_hash);
+	if (occurrences == NULL) {
+		occurrences = malloc(sizeof(struct ct_testcase_key));
+		if (occurrences == NULL) {
+			CT_MALLOC_ERROR_CALLBACK();
+		}
+		*occurrences = (struct ct_testcase_key) { testcase->path_hash, 0 };
+		ct_ht_put(model->testcase_occurrences, testcase->path_hash, occurrences);
+	}
+	model->keyed_testcase = testcase;
+	model->testcase_key = *occurrences;
+	occurrences->occurrence += 1;
+	return &model->testcase_key;
+}
+
+struct ct_section* ct_find_section(const struct ct_model* model, const char* path) {
+	int path_level;
+	struct ct_section* ret_val = ct_ht_get(model->section_index, ct_hash_section_path(path, NULL, &path_level));
+
+	if (ret_val == NULL || ct_section_has_path(ret_val, path, path_level)) {
+		return ret_val;
+	}
+	//a section with another path but the same hash has been indexed first
+	return ct_walk_section_path(model->root_section, path, 1, path_level);
+}
+
+void ct_reset_tests(struct ct_model* model) {
+	ct_list_destroy_with_elements(model->test_reports_list, (ct_destroyer_c) ct_destroy_test_report);
+	model->test_reports_list = ct_list_init();
+
+	bool inside_target = model->root_section->inside_target;
+	ct_ht_clear(model->section_index);
+	ct_ht_clear_and_destroy_elements(model->testcase_occurrences, (ct_destroyer_c) free);
+	//the root is never released by ct_section_destroy
+	if (model->root_section->first_child != NULL) {
+		ct_section_destroy(model->root_section->first_child);
+	}
+	free((void*) model->root_section->description);
+	free(model->root_section);
+	model->root_section = ct_section_init(CT_ROOT_SECTION, "root", model->root_site.tags);
+	model->root_section->inside_target = inside_target;
+	model->current_section = NULL;
+	model->current_snapshot = NULL;
+	model->jump_source_testcase = NULL;
+	model->keyed_testcase = NULL;
+}
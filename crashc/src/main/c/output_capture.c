@@ -0,0 +1,150 @@
+/*
+ * output_capture.c
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: koldar
+ */
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <unistd.h>
+#include <sys/syscall.h>
+#include <sys/types.h>
+#include <linux/memfd.h>
+#include <linux/falloc.h>
+
+#include "output_capture.h"
+#include "test_report.h"
+#include "errors.h"
+
+struct ct_output_capture* ct_init_output_capture() {
+	struct ct_output_capture* ret_val = malloc(sizeof(struct ct_output_capture));
+	if (ret_val == NULL) {
+		CT_MALLOC_ERROR_CALLBACK();
+	}
+
+	//the wrapper of the C library is declared only with _GNU_SOURCE, which the single-header version can't define early enough
+	ret_val->file = (int) syscall(SYS_memfd_create, "crashc-output", MFD_CLOEXEC);
+	ret_val->saved_stdout = dup(STDOUT_FILENO);
+	ret_val->saved_stderr = dup(STDERR_FILENO);
+	if (ret_val->file < 0 || ret_val->saved_stdout < 0 || ret_val->saved_stderr < 0) {
+		perror("CrashC - cannot capture the output of the tests");
+		exit(EXIT_FAILURE);
+	}
+	ret_val->original_stderr = NULL;
+	ret_val->released_bytes = 0;
+	ret_val->active = false;
+
+	return ret_val;
+}
+
+void ct_output_capture_start(struct ct_output_capture* capture) {
+	//what has been buffered so far doesn't belong to the test
+	fflush(stdout);
+	fflush(stderr);
+
+	if (ftruncate(capture->file, 0) != 0 || lseek(capture->file, 0, SEEK_SET) < 0) {
+		return;
+	}
+	capture->released_bytes = 0;
+	dup2(capture->file, STDOUT_FILENO);
+	dup2(capture->file, STDERR_FILENO);
+	capture->active = true;
+}
+
+/**
+ * Reads the tail of what the test has written
+ *
+ * @param[in] capture the capture just stopped
+ * @return the last ::CT_CAPTURED_OUTPUT_SIZE bytes written, as a string. @null if the test hasn't written anything
+ */
+static char* ct_read_captured_output(const struct ct_output_capture* capture) {
+	off_t size = lseek(capture->file, 0, SEEK_END);
+	if (size <= 0) {
+		return NULL;
+	}
+
+	off_t start = (size > CT_CAPTURED_OUTPUT_SIZE) ? size - CT_CAPTURED_OUTPUT_SIZE : 0;
+	size_t length = size - start;
+	char* ret_val = malloc(length + 1);
+	if (ret_val == NULL) {
+		CT_MALLOC_ERROR_CALLBACK();
+	}
+
+	ssize_t bytes = pread(capture->file, ret_val, length, start);
+	ret_val[(bytes > 0) ? bytes : 0] = '\0';
+	return ret_val;
+}
+
+void ct_output_capture_stop(struct ct_output_capture* capture, struct ct_test_report* report) {
+	if (!capture->active) {
+		return;
+	}
+
+	fflush(stdout);
+	fflush(stderr);
+	dup2(capture->saved_stdout, STDOUT_FILENO);
+	dup2(capture->saved_stderr, STDERR_FILENO);
+	capture->active = false;
+
+	if (report->outcome != CT_TEST_SUCCESS) {
+		free(report->output);
+		report->output = ct_read_captured_output(capture);
+	}
+}
+
+long ct_output_capture_mark(const struct ct_output_capture* capture) {
+	if (!capture->active) {
+		return -1;
+	}
+	return (long) lseek(capture->file, 0, SEEK_END);
+}
+
+void ct_output_capture_rewind(struct ct_output_capture* capture, long mark) {
+	if (!capture->active || mark < 0) {
+		return;
+	}
+	if (ftruncate(capture->file, mark) == 0) {
+		lseek(capture->file, mark, SEEK_SET);
+		if (capture->released_bytes > mark) {
+			capture->released_bytes = mark;
+		}
+	}
+}
+
+void ct_output_capture_trim(struct ct_output_capture* capture) {
+	if (!capture->active) {
+		return;
+	}
+	off_t size = lseek(capture->file, 0, SEEK_END);
+	if (size - capture->released_bytes <= CT_CAPTURED_OUTPUT_LIMIT) {
+		return;
+	}
+
+	//punching a hole frees the memory without moving the offset, which the descriptors 1 and 2 (and forked processes) share
+	off_t end = size - CT_CAPTURED_OUTPUT_SIZE;
+	if (syscall(SYS_fallocate, capture->file, FALLOC_FL_PUNCH_HOLE | FALLOC_FL_KEEP_SIZE, (off_t) capture->released_bytes, end - capture->released_bytes) == 0) {
+		capture->released_bytes = end;
+	}
+}
+
+FILE* ct_output_capture_get_original_stderr(struct ct_output_capture* capture) {
+	if (capture->original_stderr == NULL) {
+		int fd = dup(capture->saved_stderr);
+		capture->original_stderr = (fd >= 0) ? fdopen(fd, "w") : NULL;
+		if (capture->original_stderr == NULL && fd >= 0) {
+			close(fd);
+		}
+	}
+	return capture->original_stderr;
+}
+
+void ct_destroy_output_capture(struct ct_output_capture* capture) {
+	if (capture->original_stderr != NULL) {
+		fclose(capture->original_stderr);
+	}
+	close(capture->file);
+	close(capture->saved_stdout);
+	close(capture->saved_stderr);
+	free(capture);
+}
@@ -0,0 +1,354 @@
+/*
+ * progress.c
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: koldar
+ */
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "progress.h"
+#include "events.h"
+#include "model.h"
+#include "section.h"
+#include "test_report.h"
+#include "tag.h"
+#include "utils.h"
+#include "errors.h"
+
+static struct ct_test_timing* ct_init_test_timing(const char* description, long time) {
+	struct ct_test_timing* ret_val = malloc(sizeof(struct ct_test_timing));
+	if (ret_val == NULL) {
+		CT_MALLOC_ERROR_CALLBACK();
+	}
+
+	ret_val->description = strdup(description);
+	if (ret_val->description == NULL) {
+		CT_MALLOC_ERROR_CALLBACK();
+	}
+	ret_val->total_time = time;
+	ret_val->tests = 1;
+	ret_val->ended_tests = 0;
+
+	return ret_val;
+}
+
+static void ct_destroy_test_timing(struct ct_test_timing* timing) {
+	free(timing->description);
+	free(timing);
+}
+
+static struct ct_suite_timing* ct_init_suite_timing(const char* name, long time, int tests, int failed_tests) {
+	struct ct_suite_timing* ret_val = malloc(sizeof(struct ct_suite_timing));
+	if (ret_val == NULL) {
+		CT_MALLOC_ERROR_CALLBACK();
+	}
+
+	ret_val->name = strdup(name);
+	if (ret_val->name == NULL) {
+		CT_MALLOC_ERROR_CALLBACK();
+	}
+	ret_val->total_time = time;
+	ret_val->tests = tests;
+	ret_val->failed_tests = failed_tests;
+
+	return ret_val;
+}
+
+static void ct_destroy_suite_timing(struct ct_suite_timing* timing) {
+	free(timing->name);
+	free(timing);
+}
+
+/**
+ * Reads a line of the history file describing a @testsuite
+ *
+ * @param[inout] progress the state of the listener. The @testsuite is added to its suite history
+ * @param[in] line the line, without the newline
+ */
+static void ct_load_suite_history(struct ct_progress* progress, const char* line) {
+	long time;
+	int tests;
+	int failed_tests;
+	int name = 0;
+
+	if (sscanf(line, "S %ld %d %d %n", &time, &tests, &failed_tests, &name) != 3 || name == 0) {
+		return;
+	}
+	unsigned long key = (unsigned long) ct_string_hash(&line[name]);
+	if (ct_ht_get(progress->suite_history, key) == NULL) {
+		ct_ht_put(progress->suite_history, key, ct_init_suite_timing(&line[name], time, tests, failed_tests));
+	}
+}
+
+/**
+ * Reads the history file, if any
+ *
+ * @param[inout] progress the state of the listener. Its history is filled with the timings of the previous run
+ */
+static void ct_load_history(struct ct_progress* progress) {
+	if (progress->history_path == NULL) {
+		return;
+	}
+	FILE* file = fopen(progress->history_path, "r");
+	if (file == NULL) {
+		return;
+	}
+
+	char* line = NULL;
+	size_t line_size = 0;
+	ssize_t length;
+	while ((length = getline(&line, &line_size, file)) > 0) {
+		if (line[length - 1] == '\n') {
+			line[length - 1] = '\0';
+		}
+		if (line[0] == 'S') {
+			ct_load_suite_history(progress, line);
+			continue;
+		}
+
+		char* description;
+		long time = strtol(line, &description, 10);
+		if (description == line || *description != ' ') {
+			continue;
+		}
+		description += 1;
+
+		unsigned long key = (unsigned long) ct_string_hash(description);
+		struct ct_test_timing* timing = ct_ht_get(progress->history, key);
+		if (timing == NULL) {
+			ct_ht_put(progress->history, key, ct_init_test_timing(description, time));
+		} else if (strcmp(timing->description, description) == 0) {
+			timing->total_time += time;
+			timing->tests += 1;
+		} else {
+			//hash collision: the test will be treated as a new one
+			continue;
+		}
+		progress->expected_tests += 1;
+		progress->expected_time += time;
+	}
+
+	free(line);
+	fclose(file);
+}
+
+/**
+ * Writes the timings of the current run into the history file, if any
+ *
+ * @param[in] progress the state of the listener
+ */
+static void ct_save_history(const struct ct_progress* progress) {
+	if (progress->history_path == NULL) {
+		return;
+	}
+	FILE* file = fopen(progress->history_path, "w");
+	if (file == NULL) {
+		fprintf(stderr, "CrashC - cannot write the history file \"%s\"\n", progress->history_path);
+		return;
+	}
+
+	CT_ITERATE_ON_LIST(progress->timings, timing_cell, timing, struct ct_test_timing*) {
+		fprintf(file, "%ld %s\n", timing->total_time, timing->description);
+	}
+	CT_ITERATE_ON_LIST(progress->suite_timings, suite_cell, suite, struct ct_suite_timing*) {
+		fprintf(file, "S %ld %d %d %s\n", suite->total_time, suite->tests, suite->failed_tests, suite->name);
+	}
+	fclose(file);
+}
+
+long ct_progress_estimate_remaining_time(const struct ct_progress* progress, long elapsed_time) {
+	if (progress->expected_time <= 0) {
+		return -1;
+	}
+
+	long remaining_time = progress->expected_time - progress->expected_ended_time;
+	if (remaining_time < 0) {
+		return 0;
+	}
+	if (progress->expected_ended_time > 0) {
+		//the current run may be faster or slower than the previous one
+		return (long) (remaining_time * ((double) elapsed_time / progress->expected_ended_time));
+	}
+	return remaining_time;
+}
+
+/**
+ * Draws the progress line
+ *
+ * @param[inout] progress the state of the listener
+ * @param[in] force @true to draw the line even if it has been drawn less than ::CT_PROGRESS_REFRESH_PERIOD microseconds ago
+ */
+static void ct_draw_progress(struct ct_progress* progress, bool force) {
+	if (progress->output == NULL) {
+		return;
+	}
+
+	struct timespec now = ct_get_time();
+	if (!force && ct_compute_time_gap(progress->last_draw, now, "u") < CT_PROGRESS_REFRESH_PERIOD) {
+		return;
+	}
+	progress->last_draw = now;
+
+	long elapsed_time = ct_compute_time_gap(progress->start_time, now, "u");
+	long remaining_time = ct_progress_estimate_remaining_time(progress, elapsed_time);
+
+	//\r and "erase line" keep the progress on a single line of the terminal
+	fprintf(progress->output, "\r\033[K[%d", progress->ended_tests);
+	if (progress->expected_tests > 0) {
+		fprintf(progress->output, "/%d", progress->expected_tests);
+	}
+	fprintf(progress->output, "] %d failed | %02ld:%02ld", progress->failed_tests, elapsed_time / 60000000, (elapsed_time / 1000000) % 60);
+	if (remaining_time >= 0) {
+		fprintf(progress->output, " ETA %02ld:%02ld", remaining_time / 60000000, (remaining_time / 1000000) % 60);
+	} else {
+		fprintf(progress->output, " ETA --:--");
+	}
+	if (progress->suite_name != NULL) {
+		fprintf(progress->output, " | suite %s", progress->suite_name);
+	}
+	if (progress->testcase_description != NULL) {
+		fprintf(progress->output, " | %.40s", progress->testcase_description);
+	}
+	fflush(progress->output);
+}
+
+/**
+ * Fetches the timings of a @testsuite in the current run
+ *
+ * @param[inout] progress the state of the listener
+ * @param[in] suite_name the id of the @testsuite
+ * @return the timings of the @testsuite, created if the @testsuite has not been met yet
+ */
+static struct ct_suite_timing* ct_get_running_suite(struct ct_progress* progress, const char* suite_name) {
+	//with several repetitions the same testsuite starts several times
+	CT_ITERATE_ON_LIST(progress->suite_timings, suite_cell, suite, struct ct_suite_timing*) {
+		if (strcmp(suite->name, suite_name) == 0) {
+			return suite;
+		}
+	}
+	struct ct_suite_timing* ret_val = ct_init_suite_timing(suite_name, 0, 0, 0);
+	ct_list_add_tail(progress->suite_timings, ret_val);
+	return ret_val;
+}
+
+static void ct_progress_on_suite_start(struct ct_model* model, void* data, const char* suite_name) {
+	struct ct_progress* progress = data;
+
+	progress->suite_name = suite_name;
+	progress->running_suite = ct_get_running_suite(progress, suite_name);
+	ct_draw_progress(progress, false);
+}
+
+static void ct_progress_on_section_enter(struct ct_model* model, void* data, struct ct_section* section) {
+	struct ct_progress* progress = data;
+
+	if (section->type == CT_TESTCASE_SECTION) {
+		progress->testcase_description = section->description;
+		ct_draw_progress(progress, false);
+	}
+}
+
+static void ct_progress_on_test_end(struct ct_model* model, void* data, struct ct_test_report* report) {
+	struct ct_progress* progress = data;
+	struct timespec now = ct_get_time();
+	const char* description = report->testcase_snapshot->description;
+
+	progress->ended_tests += 1;
+	if (report->outcome != CT_TEST_SUCCESS) {
+		progress->failed_tests += 1;
+	}
+
+	struct ct_test_timing* timing = ct_ht_get(progress->history, (unsigned long) ct_string_hash(description));
+	if (timing != NULL && timing->ended_tests < timing->tests && strcmp(timing->description, description) == 0) {
+		progress->expected_ended_time += timing->total_time / timing->tests;
+		timing->ended_tests += 1;
+	}
+
+	long time = ct_compute_time_gap(progress->last_test_end, now, "u");
+	if (model->distribution != NULL) {
+		//the coordinator receives the tests in batches, long after they have ended: only the workers know how long they lasted
+		time = report->execution_time;
+		progress->running_suite = ct_get_running_suite(progress, model->suites_names[report->suite]);
+	}
+	ct_list_add_tail(progress->timings, ct_init_test_timing(description, time));
+	progress->last_test_end = now;
+	if (progress->running_suite != NULL) {
+		progress->running_suite->total_time += time;
+		progress->running_suite->tests += 1;
+		if (report->outcome != CT_TEST_SUCCESS) {
+			progress->running_suite->failed_tests += 1;
+		}
+	}
+
+	ct_draw_progress(progress, false);
+}
+
+static void ct_progress_on_run_end(struct ct_model* model, void* data) {
+	struct ct_progress* progress = data;
+
+	progress->testcase_description = NULL;
+	progress->suite_name = NULL;
+	ct_draw_progress(progress, true);
+	if (progress->output != NULL) {
+		fputc('\n', progress->output);
+	}
+	ct_save_history(progress);
+}
+
+struct ct_progress* ct_enable_progress(struct ct_model* model, FILE* output, const char* history_path) {
+	struct ct_progress* ret_val = malloc(sizeof(struct ct_progress));
+	if (ret_val == NULL) {
+		CT_MALLOC_ERROR_CALLBACK();
+	}
+
+	ret_val->output = output;
+	ret_val->history_path = history_path;
+	ret_val->history = ct_ht_init();
+	ret_val->expected_tests = 0;
+	ret_val->expected_time = 0;
+	ret_val->expected_ended_time = 0;
+	ret_val->ended_tests = 0;
+	ret_val->failed_tests = 0;
+	ret_val->timings = ct_list_init();
+	ret_val->suite_history = ct_ht_init();
+	ret_val->suite_timings = ct_list_init();
+	ret_val->running_suite = NULL;
+	ret_val->suite_name = NULL;
+	ret_val->testcase_description = NULL;
+	ret_val->start_time = ct_get_time();
+	ret_val->last_test_end = ret_val->start_time;
+	ret_val->last_draw = (struct timespec) { 0 };
+
+	ct_load_history(ret_val);
+
+	struct ct_event_listener listener = {
+		.on_suite_start = ct_progress_on_suite_start,
+		.on_section_enter = ct_progress_on_section_enter,
+		.on_assert_fail = NULL,
+		.on_test_end = ct_progress_on_test_end,
+		.on_run_end = ct_progress_on_run_end,
+		.data = ret_val
+	};
+	ct_subscribe_listener(model, &listener);
+	model->progress = ret_val;
+
+	return ret_val;
+}
+
+const struct ct_suite_timing* ct_progress_get_suite_history(const struct ct_progress* progress, const char* suite_name) {
+	const struct ct_suite_timing* ret_val = ct_ht_get(progress->suite_history, (unsigned long) ct_string_hash(suite_name));
+	if (ret_val == NULL || strcmp(ret_val->name, suite_name) != 0) {
+		return NULL;
+	}
+	return ret_val;
+}
+
+void ct_destroy_progress(struct ct_progress* progress) {
+	ct_ht_destroy_with_elements(progress->history, (ct_destroyer_c) ct_destroy_test_timing);
+	ct_list_destroy_with_elements(progress->timings, (ct_destroyer_c) ct_destroy_test_timing);
+	ct_ht_destroy_with_elements(progress->suite_history, (ct_destroyer_c) ct_destroy_suite_timing);
+	ct_list_destroy_with_elements(progress->suite_timings, (ct_destroyer_c) ct_destroy_suite_timing);
+	free(progress);
+}
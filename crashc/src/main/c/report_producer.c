@@ -6,6 +6,8 @@
  */
 
 #include <stdlib.h>
+#include <string.h>
+#include <execinfo.h>
 
 #include "report_producer.h"
 #include "assertions.h"
@@ -17,6 +19,8 @@ char* ct_snapshot_status_to_string(enum ct_snapshot_status s) {
 		case CT_SNAPSHOT_OK: return "OK";
 		case CT_SNAPSHOT_SIGNALED: return "SIGNALED";
 		case CT_SNAPSHOT_FAILED: return "FAILED";
+		case CT_SNAPSHOT_LEAKED: return "LEAKED";
+		case CT_SNAPSHOT_OVER_ALLOCATED: return "OVER_ALLOCATED";
 		default: 	printf("\nERROR: Unrecognized snapshot status, exiting.\n");
 					exit(1); //TODO: Fix error exit
 	}
@@ -28,6 +32,8 @@ char* ct_section_type_to_string(enum ct_section_type t) {
 	switch (t) {
 		case CT_WHEN_SECTION: return "WHEN";
 		case CT_THEN_SECTION: return "THEN";
+		case CT_STRESS_SECTION: return "STRESS";
+		case CT_BENCHMARK_SECTION: return "BENCHMARK";
 		case CT_TESTCASE_SECTION: return "TESTCASE";
 		case CT_ROOT_SECTION: return "ROOT";
 		case CT_TESTSUITE_SECTION: return "SUITE";
@@ -45,13 +51,44 @@ void ct_default_snapshot_tree_report(struct ct_model* model, struct ct_snapshot*
 
 	char* type_str = ct_section_type_to_string(snapshot->type);
 	char* status_str = ct_snapshot_status_to_string(snapshot->status);
-	fprintf(file, "%s : %s -> %s\n", type_str, snapshot->description, status_str);
+	if (snapshot->signal_detected != 0) {
+		fprintf(file, "%s : %s -> %s (%s, code %d, address %p)\n", type_str, snapshot->description, status_str, strsignal(snapshot->signal_detected), snapshot->signal_code, snapshot->signal_address);
+	}
+	else {
+		fprintf(file, "%s : %s -> %s\n", type_str, snapshot->description, status_str);
+	}
+	if (snapshot->allocations > 0 || snapshot->frees > 0 || snapshot->leaked_blocks > 0) {
+		for (int i = 0; i < level; i++) {
+			fputc('\t', file);
+		}
+		fprintf(file, "Allocations: %lu (%zu bytes), frees: %lu", snapshot->allocations, snapshot->allocated_bytes, snapshot->frees);
+		if (snapshot->leaked_blocks > 0) {
+			fprintf(file, ", leaked: %lu blocks (%zu bytes)", snapshot->leaked_blocks, snapshot->leaked_bytes);
+		}
+		fputc('\n', file);
+	}
+	struct ct_report_producer* producer = model->report_producer_implementation;
+	if (producer->performance_reporter != NULL) {
+		producer->performance_reporter(model, snapshot, level);
+	}
+	if (producer->resource_usage_reporter != NULL) {
+		producer->resource_usage_reporter(model, snapshot, level);
+	}
+	if (producer->stress_reporter != NULL) {
+		producer->stress_reporter(model, snapshot, level);
+	}
+	if (producer->benchmark_reporter != NULL) {
+		producer->benchmark_reporter(model, snapshot, level);
+	}
+	if (producer->backtrace_reporter != NULL) {
+		producer->backtrace_reporter(model, snapshot, level);
+	}
 	ct_default_assertions_report(model, snapshot, level);
 
 	struct ct_snapshot* child = snapshot->first_child;
 	while (child != NULL) {
 		for (int i = 0; i < level; i++) {
-			putchar('\t');
+			fputc('\t', file);
 		}
 		ct_default_snapshot_tree_report(model, child, level + 1);
 		child = child->next_sibling;
@@ -65,8 +102,18 @@ void ct_default_test_report(struct ct_model* model, struct ct_test_report* repor
 
 	fprintf(file, " ---------- TEST REPORT ----------\n\n");
 	//fprintf(file, "File: %s\n\n", report->filename);
+	if (report->fuzz_input != NULL) {
+		fprintf(file, "Input: %s\n\n", report->fuzz_input);
+	}
+	if (model->report_producer_implementation->flakiness_reporter != NULL) {
+		model->report_producer_implementation->flakiness_reporter(model, report);
+	}
 	ct_default_snapshot_tree_report(model, report->testcase_snapshot, 1);
 	fprintf(file, "\nOutcome: %s\n", (report->outcome == CT_TEST_SUCCESS) ? "SUCCESS" : "FAILURE");
+	if (report->output != NULL) {
+		size_t length = strlen(report->output);
+		fprintf(file, "\nCaptured output:\n%s%s", report->output, (length > 0 && report->output[length - 1] != '\n') ? "\n" : "");
+	}
 	fprintf(file, "\n --------------------------------\n");
 	fprintf(file, "\n\n");
 
@@ -81,6 +128,9 @@ void ct_default_report_summary(struct ct_model* model) {
 	fprintf(file, "Successful tests: %d\n", stats->successful_tests);
 	fprintf(file, "Failed tests: %d\n", stats->failed_tests);
 	fprintf(file, "Percentage of successful tests: %.2f%%\n", ((double) stats->successful_tests / stats->total_tests) * 100);
+	if (model->repetitions > 1) {
+		fprintf(file, "Flaky tests over %d repetitions: %d\n", model->repetitions, stats->flaky_tests);
+	}
 
 }
 
@@ -91,7 +141,7 @@ void ct_default_assertions_report(struct ct_model* model, struct ct_snapshot* sn
 
 	CT_ITERATE_ON_LIST(assertion_reports, report_cell, report, struct ct_assert_report*) {
 		for (int i = 0; i < level; i++) {
-			putchar('\t');
+			fputc('\t', file);
 		}
 
 		if (report->passed) {
@@ -104,11 +154,203 @@ void ct_default_assertions_report(struct ct_model* model, struct ct_snapshot* sn
 
 }
 
+void ct_default_backtrace_report(struct ct_model* model, struct ct_snapshot* snapshot, int level) {
+
+	FILE* file = model->output_file;
+
+	if (snapshot->backtrace == NULL) {
+		return;
+	}
+
+	char** symbols = backtrace_symbols(snapshot->backtrace, snapshot->backtrace_size);
+	for (int i = 0; i < snapshot->backtrace_size; i++) {
+		for (int j = 0; j < level; j++) {
+			fputc('\t', file);
+		}
+
+		if (symbols != NULL) {
+			fprintf(file, "#%d %s\n", i, symbols[i]);
+		}
+		else {
+			fprintf(file, "#%d %p\n", i, snapshot->backtrace[i]);
+		}
+	}
+	free(symbols);
+
+}
+
+void ct_default_resource_usage_report(struct ct_model* model, struct ct_snapshot* snapshot, int level) {
+
+	FILE* file = model->output_file;
+	struct ct_resource_usage* usage = &snapshot->resource_usage;
+
+	if (!model->measure_resources || !snapshot->measurements_taken) {
+		return;
+	}
+
+	for (int i = 0; i < level; i++) {
+		fputc('\t', file);
+	}
+	fprintf(file, "Resources: max RSS %ld KB (+%ld KB), page faults %ld minor / %ld major, context switches %ld voluntary / %ld involuntary, CPU %.3f ms user / %.3f ms system\n",
+			usage->max_rss, usage->max_rss_growth,
+			usage->minor_faults, usage->major_faults,
+			usage->voluntary_context_switches, usage->involuntary_context_switches,
+			usage->user_time / 1000.0, usage->system_time / 1000.0
+	);
+
+}
+
+void ct_default_performance_report(struct ct_model* model, struct ct_snapshot* snapshot, int level) {
+
+	FILE* file = model->output_file;
+	struct ct_hardware_counters* counters = &snapshot->hardware_counters;
+
+	if (model->hardware_counters == NULL || !snapshot->measurements_taken) {
+		return;
+	}
+
+	for (int i = 0; i < level; i++) {
+		fputc('\t', file);
+	}
+	fprintf(file, "Time: %ld us", snapshot->elapsed_time);
+	if (counters->instructions != CT_HARDWARE_COUNTER_UNAVAILABLE) {
+		fprintf(file, ", instructions %lld", counters->instructions);
+	}
+	if (counters->cycles != CT_HARDWARE_COUNTER_UNAVAILABLE) {
+		fprintf(file, ", cycles %lld", counters->cycles);
+	}
+	if (counters->instructions != CT_HARDWARE_COUNTER_UNAVAILABLE && counters->cycles > 0) {
+		fprintf(file, " (IPC %.2f)", ((double) counters->instructions) / counters->cycles);
+	}
+	if (counters->cache_misses != CT_HARDWARE_COUNTER_UNAVAILABLE) {
+		fprintf(file, ", cache misses %lld", counters->cache_misses);
+	}
+	if (counters->branch_misses != CT_HARDWARE_COUNTER_UNAVAILABLE) {
+		fprintf(file, ", branch misses %lld", counters->branch_misses);
+	}
+	fputc('\n', file);
+
+}
+
+void ct_default_stress_report(struct ct_model* model, struct ct_snapshot* snapshot, int level) {
+
+	FILE* file = model->output_file;
+	struct ct_stress_report* stress = snapshot->stress;
+
+	if (stress == NULL) {
+		return;
+	}
+
+	for (int i = 0; i < level; i++) {
+		fputc('\t', file);
+	}
+	fprintf(file, "Stress: %d threads x %ld iterations, latency p50 %ld ns, p99 %ld ns, p99.9 %ld ns, max %ld ns\n",
+			stress->threads_number, stress->iterations,
+			stress->latency_p50, stress->latency_p99, stress->latency_p999, stress->max_latency
+	);
+	if (stress->schedule_seed >= 0) {
+		for (int i = 0; i < level + 1; i++) {
+			fputc('\t', file);
+		}
+		if (stress->explored_schedules > 0) {
+			fprintf(file, "Schedules: %ld explored, %ld failed, ", stress->explored_schedules, stress->failed_schedules);
+		} else {
+			fprintf(file, "Schedules: ");
+		}
+		fprintf(file, "replay with --schedule_seed %ld\n", stress->schedule_seed);
+	}
+	for (int t = 0; t < stress->threads_number; t++) {
+		for (int i = 0; i < level + 1; i++) {
+			fputc('\t', file);
+		}
+		fprintf(file, "Thread %d: %ld iterations, %.0f iterations/s, max latency %ld ns\n",
+				t, stress->threads[t].completed_iterations, stress->threads[t].throughput, stress->threads[t].max_latency
+		);
+	}
+
+}
+
+void ct_default_benchmark_report(struct ct_model* model, struct ct_snapshot* snapshot, int level) {
+
+	FILE* file = model->output_file;
+	struct ct_benchmark_report* benchmark = snapshot->benchmark;
+
+	if (benchmark == NULL) {
+		return;
+	}
+
+	for (int i = 0; i < level; i++) {
+		fputc('\t', file);
+	}
+	fprintf(file, "Benchmark: %s from %ld to %ld, best fit %s with coefficient %.3g ns (error %.1f%%), %s cache, warm-up %ld us",
+			benchmark->parameter_name, benchmark->points[0].parameter, benchmark->points[benchmark->points_number - 1].parameter,
+			ct_complexity_to_string(benchmark->complexity), benchmark->coefficient, benchmark->error * 100,
+			benchmark->cold_cache ? "cold" : "warm", benchmark->warmup_time / 1000
+	);
+	if (benchmark->cpu >= 0) {
+		fprintf(file, ", pinned to CPU %d", benchmark->cpu);
+	}
+	fputc('\n', file);
+	for (int p = 0; p < benchmark->points_number; p++) {
+		for (int i = 0; i < level + 1; i++) {
+			fputc('\t', file);
+		}
+		fprintf(file, "%s = %ld: %.1f ns, %.0f%% confidence interval [%.1f, %.1f] ns (%ld iterations per sample, %d outlier samples)",
+				benchmark->parameter_name, benchmark->points[p].parameter, benchmark->points[p].time,
+				CT_BENCHMARK_CONFIDENCE * 100, benchmark->points[p].time_low, benchmark->points[p].time_high,
+				benchmark->points[p].iterations, benchmark->points[p].outliers
+		);
+		if (benchmark->allocations_counted) {
+			fprintf(file, ", %.2f allocations (%.1f bytes) and %.2f frees per run",
+					benchmark->points[p].allocations, benchmark->points[p].allocated_bytes, benchmark->points[p].frees
+			);
+		}
+		fputc('\n', file);
+	}
+
+}
+
+void ct_default_flakiness_report(struct ct_model* model, struct ct_test_report* report) {
+
+	FILE* file = model->output_file;
+	struct ct_flakiness* flakiness = report->flakiness;
+
+	if (model->repetitions <= 1) {
+		return;
+	}
+
+	fprintf(file, "Repetition: %d", report->repetition + 1);
+	if (flakiness != NULL) {
+		fprintf(file, " - %s: failed %d times out of %d runs%s, time mean %.0f us, variance %.0f us^2",
+				flakiness->flaky ? "FLAKY" : "STABLE",
+				flakiness->failed_runs, flakiness->runs,
+				flakiness->snapshots_diverge ? ", snapshots diverge" : "",
+				flakiness->elapsed_time_mean, flakiness->elapsed_time_variance
+		);
+	}
+	fprintf(file, "\n\n");
+
+}
+
 void ct_default_report(struct ct_model* model) {
 
 	ct_list_o* report_list = model->test_reports_list;
 
-	//TODO: Move the stats-acquiring code away from the report producer
+	ct_update_test_stats(model);
+	CT_ITERATE_ON_LIST(report_list, report_cell, report, struct ct_test_report*) {
+		ct_default_test_report(model, report);
+	}
+
+	ct_default_report_summary(model);
+
+}
+
+void ct_update_test_stats(struct ct_model* model) {
+
+	ct_list_o* report_list = model->test_reports_list;
+
+	model->statistics->successful_tests = 0;
+	model->statistics->failed_tests = 0;
 	CT_ITERATE_ON_LIST(report_list, report_cell, report, struct ct_test_report*) {
 		if (report->outcome == CT_TEST_SUCCESS) {
 			model->statistics->successful_tests++;
@@ -116,11 +358,9 @@ void ct_default_report(struct ct_model* model) {
 		else {
 			model->statistics->failed_tests++;
 		}
-		ct_default_test_report(model, report);
 	}
 
 	model->statistics->total_tests = ct_list_size(report_list);
-	ct_default_report_summary(model);
 
 }
 
@@ -135,6 +375,7 @@ struct ct_test_stats* ct_init_stats() {
 	ret_val->total_tests = 0;
 	ret_val->successful_tests = 0;
 	ret_val->failed_tests = 0;
+	ret_val->flaky_tests = 0;
 
 	return ret_val;
 }
@@ -151,6 +392,12 @@ struct ct_report_producer* ct_init_default_report_producer() {
 	ret_val->snapshot_tree_reporter = ct_default_snapshot_tree_report;
 	ret_val->summary_producer = ct_default_report_summary;
 	ret_val->assert_reporter = ct_default_assertions_report;
+	ret_val->backtrace_reporter = ct_default_backtrace_report;
+	ret_val->resource_usage_reporter = ct_default_resource_usage_report;
+	ret_val->performance_reporter = ct_default_performance_report;
+	ret_val->stress_reporter = ct_default_stress_report;
+	ret_val->benchmark_reporter = ct_default_benchmark_report;
+	ret_val->flakiness_reporter = ct_default_flakiness_report;
 	ret_val->report_producer = ct_default_report;
 
 	return ret_val;
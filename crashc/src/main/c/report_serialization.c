@@ -0,0 +1,328 @@
+/*
+ * report_serialization.c
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: koldar
+ */
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <stdint.h>
+#include <string.h>
+#include <errno.h>
+#include <unistd.h>
+
+#include "report_serialization.h"
+#include "section.h"
+#include "test_report.h"
+#include "assertions.h"
+#include "stress.h"
+#include "tag.h"
+#include "macros.h"
+#include "errors.h"
+
+/**
+ * The length written in place of a @null string
+ */
+#define CT_SERIALIZED_NULL_STRING UINT32_MAX
+
+struct ct_report_arena* ct_init_report_arena() {
+	struct ct_report_arena* ret_val = malloc(sizeof(struct ct_report_arena));
+	if (ret_val == NULL) {
+		CT_MALLOC_ERROR_CALLBACK();
+	}
+
+	ret_val->tags = ct_list_init();
+	ret_val->strings = ct_list_init();
+
+	return ret_val;
+}
+
+void ct_destroy_report_arena(struct ct_report_arena* arena) {
+	CT_ITERATE_ON_LIST(arena->tags, cell, tags, ct_tag_hashtable_o*) {
+		ct_ht_destroy_with_elements(tags, (ct_destroyer_c) ct_tag_destroy);
+	}
+	ct_list_destroy(arena->tags);
+	ct_list_destroy_with_elements(arena->strings, (ct_destroyer_c) free);
+	free(arena);
+}
+
+static void ct_write_string(FILE* out, const char* value) {
+	uint32_t length = (value != NULL) ? (uint32_t) strlen(value) : CT_SERIALIZED_NULL_STRING;
+
+	fwrite(&length, sizeof(length), 1, out);
+	if (value != NULL) {
+		fwrite(value, 1, length, out);
+	}
+}
+
+/**
+ * Serializes a snapshot tree
+ *
+ * The structures are written as they are: the pointers they contain are fixed by the reader
+ *
+ * @param[inout] out the stream to write into
+ * @param[in] snapshot the root of the tree to send
+ */
+static void ct_write_snapshot(FILE* out, const struct ct_snapshot* snapshot) {
+	fwrite(snapshot, sizeof(struct ct_snapshot), 1, out);
+	ct_write_string(out, snapshot->description);
+
+	int tags_number = (snapshot->tags != NULL) ? ct_ht_size(snapshot->tags) : -1;
+	fwrite(&tags_number, sizeof(tags_number), 1, out);
+	if (snapshot->tags != NULL) {
+		CT_ITERATE_VALUES_ON_HT(snapshot->tags, tag, struct ct_tag*) {
+			ct_write_string(out, tag->name);
+		}
+	}
+
+	if (snapshot->backtrace_size > 0) {
+		fwrite(snapshot->backtrace, sizeof(void*), snapshot->backtrace_size, out);
+	}
+
+	if (snapshot->stress != NULL) {
+		fwrite(snapshot->stress, sizeof(struct ct_stress_report), 1, out);
+		fwrite(snapshot->stress->threads, sizeof(struct ct_stress_thread_report), snapshot->stress->threads_number, out);
+	}
+
+	if (snapshot->benchmark != NULL) {
+		fwrite(snapshot->benchmark, sizeof(struct ct_benchmark_report), 1, out);
+		ct_write_string(out, snapshot->benchmark->parameter_name);
+		fwrite(snapshot->benchmark->points, sizeof(struct ct_benchmark_point), snapshot->benchmark->points_number, out);
+	}
+
+	int assertions_number = ct_list_size(snapshot->assertion_reports);
+	fwrite(&assertions_number, sizeof(assertions_number), 1, out);
+	CT_ITERATE_ON_LIST(snapshot->assertion_reports, cell, assertion, struct ct_assert_report*) {
+		fwrite(assertion, sizeof(struct ct_assert_report), 1, out);
+		ct_write_string(out, assertion->asserted);
+		ct_write_string(out, assertion->expected_str);
+		ct_write_string(out, assertion->actual_str);
+		ct_write_string(out, assertion->file_name);
+	}
+
+	int children_number = 0;
+	for (const struct ct_snapshot* child = snapshot->first_child; child != NULL; child = child->next_sibling) {
+		children_number += 1;
+	}
+	fwrite(&children_number, sizeof(children_number), 1, out);
+	for (const struct ct_snapshot* child = snapshot->first_child; child != NULL; child = child->next_sibling) {
+		ct_write_snapshot(out, child);
+	}
+}
+
+void ct_serialize_test_report(FILE* out, const struct ct_test_report* report) {
+	fwrite(report, sizeof(struct ct_test_report), 1, out);
+	ct_write_string(out, report->filename);
+	ct_write_string(out, report->fuzz_input);
+	ct_write_string(out, report->output);
+	ct_write_snapshot(out, report->testcase_snapshot);
+}
+
+void ct_read_serialized_data(int channel, struct ct_serialized_buffer* buffer) {
+	size_t capacity = CT_BUFFER_SIZE;
+
+	buffer->data = malloc(capacity);
+	buffer->size = 0;
+	buffer->position = 0;
+	buffer->corrupted = false;
+	if (buffer->data == NULL) {
+		CT_MALLOC_ERROR_CALLBACK();
+	}
+
+	while (true) {
+		if (buffer->size == capacity) {
+			capacity *= 2;
+			buffer->data = realloc(buffer->data, capacity);
+			if (buffer->data == NULL) {
+				CT_MALLOC_ERROR_CALLBACK();
+			}
+		}
+		ssize_t bytes = read(channel, buffer->data + buffer->size, capacity - buffer->size);
+		if (bytes < 0 && errno == EINTR) {
+			continue;
+		}
+		if (bytes <= 0) {
+			break;
+		}
+		buffer->size += bytes;
+	}
+}
+
+bool ct_deserialize_bytes(struct ct_serialized_buffer* buffer, void* output, size_t size) {
+	if (buffer->corrupted || buffer->size - buffer->position < size) {
+		buffer->corrupted = true;
+		memset(output, 0, size);
+		return false;
+	}
+	memcpy(output, buffer->data + buffer->position, size);
+	buffer->position += size;
+	return true;
+}
+
+/**
+ * Checks whether the serialized data still holds an array it declares
+ *
+ * The check is performed before allocating the array, so that a corrupted count doesn't make us allocate a huge amount of memory.
+ *
+ * @param[inout] buffer the serialized data. It's marked as corrupted if the array doesn't fit in it
+ * @param[in] count the number of items of the array
+ * @param[in] size the number of bytes of every item
+ * @return @true if the whole array is within the data, @false otherwise
+ */
+static bool ct_serialized_buffer_holds(struct ct_serialized_buffer* buffer, long count, size_t size) {
+	if (buffer->corrupted || count < 0 || (size > 0 && (unsigned long) count > (buffer->size - buffer->position) / size)) {
+		buffer->corrupted = true;
+		return false;
+	}
+	return true;
+}
+
+static char* ct_read_string(struct ct_serialized_buffer* buffer) {
+	uint32_t length;
+
+	ct_deserialize_bytes(buffer, &length, sizeof(length));
+	if (length == CT_SERIALIZED_NULL_STRING || !ct_serialized_buffer_holds(buffer, length, 1)) {
+		return NULL;
+	}
+	char* ret_val = malloc(length + 1);
+	if (ret_val == NULL) {
+		CT_MALLOC_ERROR_CALLBACK();
+	}
+	ct_deserialize_bytes(buffer, ret_val, length);
+	ret_val[length] = '\0';
+	return ret_val;
+}
+
+/**
+ * Deserializes a string which is owned by an arena
+ *
+ * @param[inout] buffer the serialized data
+ * @param[inout] arena the arena which will own the string
+ * @return the string deserialized
+ */
+static char* ct_read_arena_string(struct ct_serialized_buffer* buffer, struct ct_report_arena* arena) {
+	char* ret_val = ct_read_string(buffer);
+	if (ret_val != NULL) {
+		ct_list_add_tail(arena->strings, ret_val);
+	}
+	return ret_val;
+}
+
+static struct ct_snapshot* ct_read_snapshot(struct ct_serialized_buffer* buffer, struct ct_report_arena* arena) {
+	struct ct_snapshot* ret_val = malloc(sizeof(struct ct_snapshot));
+	if (ret_val == NULL) {
+		CT_MALLOC_ERROR_CALLBACK();
+	}
+
+	ct_deserialize_bytes(buffer, ret_val, sizeof(struct ct_snapshot));
+	ret_val->description = ct_read_string(buffer);
+	ret_val->parent = NULL;
+	ret_val->first_child = NULL;
+	ret_val->next_sibling = NULL;
+
+	int tags_number;
+	ct_deserialize_bytes(buffer, &tags_number, sizeof(tags_number));
+	ret_val->tags = NULL;
+	if (tags_number >= 0) {
+		ret_val->tags = ct_ht_init();
+		ct_list_add_tail(arena->tags, ret_val->tags);
+		for (int i = 0; i < tags_number && !buffer->corrupted; i++) {
+			char* name = ct_read_string(buffer);
+			if (name != NULL) {
+				ct_tag_ht_put(ret_val->tags, name);
+			}
+			free(name);
+		}
+	}
+
+	ret_val->backtrace = NULL;
+	if (ret_val->backtrace_size > 0 && !ct_serialized_buffer_holds(buffer, ret_val->backtrace_size, sizeof(void*))) {
+		ret_val->backtrace_size = 0;
+	}
+	if (ret_val->backtrace_size > 0) {
+		ret_val->backtrace = malloc(sizeof(void*) * ret_val->backtrace_size);
+		if (ret_val->backtrace == NULL) {
+			CT_MALLOC_ERROR_CALLBACK();
+		}
+		ct_deserialize_bytes(buffer, ret_val->backtrace, sizeof(void*) * ret_val->backtrace_size);
+	}
+
+	if (ret_val->stress != NULL) {
+		ret_val->stress = malloc(sizeof(struct ct_stress_report));
+		if (ret_val->stress == NULL) {
+			CT_MALLOC_ERROR_CALLBACK();
+		}
+		ct_deserialize_bytes(buffer, ret_val->stress, sizeof(struct ct_stress_report));
+		if (!ct_serialized_buffer_holds(buffer, ret_val->stress->threads_number, sizeof(struct ct_stress_thread_report))) {
+			ret_val->stress->threads_number = 0;
+		}
+		ret_val->stress->threads = malloc(sizeof(struct ct_stress_thread_report) * ret_val->stress->threads_number);
+		if (ret_val->stress->threads == NULL && ret_val->stress->threads_number > 0) {
+			CT_MALLOC_ERROR_CALLBACK();
+		}
+		ct_deserialize_bytes(buffer, ret_val->stress->threads, sizeof(struct ct_stress_thread_report) * ret_val->stress->threads_number);
+	}
+
+	if (ret_val->benchmark != NULL) {
+		ret_val->benchmark = malloc(sizeof(struct ct_benchmark_report));
+		if (ret_val->benchmark == NULL) {
+			CT_MALLOC_ERROR_CALLBACK();
+		}
+		ct_deserialize_bytes(buffer, ret_val->benchmark, sizeof(struct ct_benchmark_report));
+		ret_val->benchmark->parameter_name = ct_read_arena_string(buffer, arena);
+		if (!ct_serialized_buffer_holds(buffer, ret_val->benchmark->points_number, sizeof(struct ct_benchmark_point))) {
+			ret_val->benchmark->points_number = 0;
+		}
+		ret_val->benchmark->points = malloc(sizeof(struct ct_benchmark_point) * ret_val->benchmark->points_number);
+		if (ret_val->benchmark->points == NULL && ret_val->benchmark->points_number > 0) {
+			CT_MALLOC_ERROR_CALLBACK();
+		}
+		ct_deserialize_bytes(buffer, ret_val->benchmark->points, sizeof(struct ct_benchmark_point) * ret_val->benchmark->points_number);
+	}
+
+	int assertions_number;
+	ct_deserialize_bytes(buffer, &assertions_number, sizeof(assertions_number));
+	ret_val->assertion_reports = ct_list_init();
+	for (int i = 0; i < assertions_number && !buffer->corrupted; i++) {
+		struct ct_assert_report* assertion = malloc(sizeof(struct ct_assert_report));
+		if (assertion == NULL) {
+			CT_MALLOC_ERROR_CALLBACK();
+		}
+		ct_deserialize_bytes(buffer, assertion, sizeof(struct ct_assert_report));
+		assertion->asserted = ct_read_arena_string(buffer, arena);
+		assertion->expected_value = NULL;
+		assertion->expected_str = ct_read_arena_string(buffer, arena);
+		assertion->actual_value = NULL;
+		assertion->actual_str = ct_read_arena_string(buffer, arena);
+		assertion->file_name = ct_read_arena_string(buffer, arena);
+		ct_list_add_tail(ret_val->assertion_reports, assertion);
+	}
+
+	int children_number;
+	ct_deserialize_bytes(buffer, &children_number, sizeof(children_number));
+	for (int i = 0; i < children_number && !buffer->corrupted; i++) {
+		ct_add_snapshot_to_tree(ct_read_snapshot(buffer, arena), ret_val);
+	}
+
+	return ret_val;
+}
+
+struct ct_test_report* ct_deserialize_test_report(struct ct_serialized_buffer* buffer, struct ct_report_arena* arena) {
+	struct ct_test_report* ret_val = malloc(sizeof(struct ct_test_report));
+	if (ret_val == NULL) {
+		CT_MALLOC_ERROR_CALLBACK();
+	}
+
+	ct_deserialize_bytes(buffer, ret_val, sizeof(struct ct_test_report));
+	ret_val->filename = ct_read_string(buffer);
+	ret_val->fuzz_input = ct_read_string(buffer);
+	ret_val->output = ct_read_string(buffer);
+	ret_val->testcase_snapshot = ct_read_snapshot(buffer, arena);
+	//repetitions are linked once every test has been run
+	ret_val->next_repetition = NULL;
+	ret_val->flakiness = NULL;
+
+	return ret_val;
+}
+
@@ -0,0 +1,54 @@
+/*
+ * resource_usage.c
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: koldar
+ */
+
+#include <string.h>
+#include <sys/time.h>
+#include <sys/resource.h>
+
+#include "resource_usage.h"
+
+static long ct_timeval_to_microseconds(struct timeval t);
+
+void ct_sample_resource_usage(struct ct_resource_usage* usage) {
+	struct rusage r;
+
+	if (getrusage(RUSAGE_SELF, &r) != 0) {
+		memset(usage, 0, sizeof(struct ct_resource_usage));
+		return;
+	}
+
+	usage->max_rss = r.ru_maxrss;
+	usage->max_rss_growth = 0;
+	usage->minor_faults = r.ru_minflt;
+	usage->major_faults = r.ru_majflt;
+	usage->voluntary_context_switches = r.ru_nvcsw;
+	usage->involuntary_context_switches = r.ru_nivcsw;
+	usage->user_time = ct_timeval_to_microseconds(r.ru_utime);
+	usage->system_time = ct_timeval_to_microseconds(r.ru_stime);
+}
+
+void ct_begin_resource_usage(struct ct_resource_usage* usage) {
+	ct_sample_resource_usage(usage);
+}
+
+void ct_end_resource_usage(struct ct_resource_usage* usage) {
+	struct ct_resource_usage now;
+	ct_sample_resource_usage(&now);
+
+	usage->max_rss_growth = now.max_rss - usage->max_rss;
+	usage->max_rss = now.max_rss;
+	usage->minor_faults = now.minor_faults - usage->minor_faults;
+	usage->major_faults = now.major_faults - usage->major_faults;
+	usage->voluntary_context_switches = now.voluntary_context_switches - usage->voluntary_context_switches;
+	usage->involuntary_context_switches = now.involuntary_context_switches - usage->involuntary_context_switches;
+	usage->user_time = now.user_time - usage->user_time;
+	usage->system_time = now.system_time - usage->system_time;
+}
+
+static long ct_timeval_to_microseconds(struct timeval t) {
+	return t.tv_sec * 1000000L + t.tv_usec;
+}
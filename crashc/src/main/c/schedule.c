@@ -0,0 +1,255 @@
+/*
+ * schedule.c
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: koldar
+ */
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <errno.h>
+#include <unistd.h>
+#include <sys/types.h>
+#include <sys/wait.h>
+
+#include "schedule.h"
+#include "model.h"
+#include "main_model.h"
+#include "stress.h"
+#include "errors.h"
+
+/**
+ * The id the scheduler knows the calling thread with. -1 if the calling thread is not serialized
+ */
+static _Thread_local int ct_scheduled_thread_id = -1;
+
+/**
+ * The scheduler serializing the calling thread. @null if the calling thread is not serialized
+ */
+static _Thread_local struct ct_scheduler* ct_thread_scheduler = NULL;
+
+static int ct_scheduler_pick_next(struct ct_scheduler* scheduler);
+static void ct_scheduler_switch(struct ct_scheduler* scheduler);
+static void ct_wait_schedule(pid_t* workers, long* seeds, int* workers_number, long* failed_schedules, long* smallest_failed_seed);
+
+struct ct_scheduler* ct_init_scheduler(int threads_number, long seed) {
+	struct ct_scheduler* ret_val = malloc(sizeof(struct ct_scheduler));
+	if (ret_val == NULL) {
+		CT_MALLOC_ERROR_CALLBACK();
+	}
+	ret_val->terminated = calloc(threads_number, sizeof(bool));
+	if (ret_val->terminated == NULL) {
+		CT_MALLOC_ERROR_CALLBACK();
+	}
+
+	pthread_mutex_init(&ret_val->lock, NULL);
+	pthread_cond_init(&ret_val->changed, NULL);
+	ret_val->threads_number = threads_number;
+	ret_val->registered_threads = 0;
+	ret_val->running = -1;
+	ret_val->alive_threads = threads_number;
+	//the state of the generator can't be 0
+	ret_val->random_state = ((unsigned long long) seed) * 0x9E3779B97F4A7C15ULL + 1;
+
+	return ret_val;
+}
+
+void ct_destroy_scheduler(struct ct_scheduler* scheduler) {
+	pthread_cond_destroy(&scheduler->changed);
+	pthread_mutex_destroy(&scheduler->lock);
+	free(scheduler->terminated);
+	free(scheduler);
+}
+
+void ct_scheduler_start(struct ct_scheduler* scheduler) {
+	pthread_mutex_lock(&scheduler->lock);
+	while (scheduler->registered_threads < scheduler->threads_number) {
+		pthread_cond_wait(&scheduler->changed, &scheduler->lock);
+	}
+	scheduler->running = ct_scheduler_pick_next(scheduler);
+	pthread_cond_broadcast(&scheduler->changed);
+	pthread_mutex_unlock(&scheduler->lock);
+}
+
+void ct_scheduler_thread_start(struct ct_scheduler* scheduler, int thread_id) {
+	ct_thread_scheduler = scheduler;
+	ct_scheduled_thread_id = thread_id;
+
+	pthread_mutex_lock(&scheduler->lock);
+	scheduler->registered_threads += 1;
+	pthread_cond_broadcast(&scheduler->changed);
+	while (scheduler->running != thread_id) {
+		pthread_cond_wait(&scheduler->changed, &scheduler->lock);
+	}
+	pthread_mutex_unlock(&scheduler->lock);
+}
+
+void ct_scheduler_thread_end(struct ct_scheduler* scheduler) {
+	pthread_mutex_lock(&scheduler->lock);
+	scheduler->terminated[ct_scheduled_thread_id] = true;
+	scheduler->alive_threads -= 1;
+	scheduler->running = (scheduler->alive_threads > 0) ? ct_scheduler_pick_next(scheduler) : -1;
+	pthread_cond_broadcast(&scheduler->changed);
+	pthread_mutex_unlock(&scheduler->lock);
+
+	ct_thread_scheduler = NULL;
+	ct_scheduled_thread_id = -1;
+}
+
+void ct_yield() {
+	if (ct_thread_scheduler == NULL) {
+		return;
+	}
+	ct_scheduler_switch(ct_thread_scheduler);
+}
+
+int ct_mutex_lock(pthread_mutex_t* mutex) {
+	if (ct_thread_scheduler == NULL) {
+		return pthread_mutex_lock(mutex);
+	}
+
+	ct_yield();
+	//the owner of the mutex can run only if we let it
+	int ret_val;
+	while ((ret_val = pthread_mutex_trylock(mutex)) == EBUSY) {
+		ct_yield();
+	}
+	return ret_val;
+}
+
+int ct_mutex_unlock(pthread_mutex_t* mutex) {
+	int ret_val = pthread_mutex_unlock(mutex);
+	ct_yield();
+	return ret_val;
+}
+
+long ct_explore_schedules(struct ct_model* model, ct_stress_c function, int threads_number, long iterations, long* failed_schedules) {
+	int max_workers = ct_get_workers_number(model);
+
+	ct_allocation_tracker_pause();
+	pid_t* workers = malloc(sizeof(pid_t) * max_workers);
+	long* seeds = malloc(sizeof(long) * max_workers);
+	ct_allocation_tracker_resume();
+	if (workers == NULL || seeds == NULL) {
+		CT_MALLOC_ERROR_CALLBACK();
+	}
+	int workers_number = 0;
+	long smallest_failed_seed = -1;
+	*failed_schedules = 0;
+
+	//the buffered output would be printed by every worker as well
+	fflush(NULL);
+	for (long seed = 0; seed < model->schedule_seeds; seed++) {
+		if (workers_number == max_workers) {
+			ct_wait_schedule(workers, seeds, &workers_number, failed_schedules, &smallest_failed_seed);
+		}
+
+		pid_t pid = fork();
+		if (pid < 0) {
+			perror("CrashC - cannot fork a schedule worker");
+			exit(1);
+		}
+		if (pid == 0) {
+			//the worker process: the result is the exit status
+			_exit(ct_run_stress_schedule(model, function, threads_number, iterations, seed) ? 0 : 1);
+		}
+		workers[workers_number] = pid;
+		seeds[workers_number] = seed;
+		workers_number += 1;
+	}
+	while (workers_number > 0) {
+		ct_wait_schedule(workers, seeds, &workers_number, failed_schedules, &smallest_failed_seed);
+	}
+
+	ct_allocation_tracker_pause();
+	free(seeds);
+	free(workers);
+	ct_allocation_tracker_resume();
+	return smallest_failed_seed;
+}
+
+/**
+ * Chooses the next thread to run among the ones which have not terminated yet
+ *
+ * The caller needs to hold struct ct_scheduler::lock
+ *
+ * @param[inout] scheduler the scheduler to handle
+ * @return the id of the next thread to run
+ */
+static int ct_scheduler_pick_next(struct ct_scheduler* scheduler) {
+	//xorshift64*
+	scheduler->random_state ^= scheduler->random_state >> 12;
+	scheduler->random_state ^= scheduler->random_state << 25;
+	scheduler->random_state ^= scheduler->random_state >> 27;
+	unsigned long long random = scheduler->random_state * 0x2545F4914F6CDD1DULL;
+
+	int chosen = (int) ((random >> 32) % (unsigned long long) scheduler->alive_threads);
+	for (int i = 0; i < scheduler->threads_number; i++) {
+		if (scheduler->terminated[i]) {
+			continue;
+		}
+		if (chosen == 0) {
+			return i;
+		}
+		chosen -= 1;
+	}
+	return -1;
+}
+
+/**
+ * Lets the scheduler choose the next thread to run and waits until the calling thread is chosen again
+ *
+ * @param[inout] scheduler the scheduler to handle
+ */
+static void ct_scheduler_switch(struct ct_scheduler* scheduler) {
+	pthread_mutex_lock(&scheduler->lock);
+	scheduler->running = ct_scheduler_pick_next(scheduler);
+	pthread_cond_broadcast(&scheduler->changed);
+	while (scheduler->running != ct_scheduled_thread_id) {
+		pthread_cond_wait(&scheduler->changed, &scheduler->lock);
+	}
+	pthread_mutex_unlock(&scheduler->lock);
+}
+
+/**
+ * Waits until a schedule worker terminates and collects its result
+ *
+ * @param[inout] workers the processes running right now
+ * @param[inout] seeds the seed each process in \c workers is running
+ * @param[inout] workers_number the number of processes inside \c workers
+ * @param[inout] failed_schedules the number of seeds which have failed so far
+ * @param[inout] smallest_failed_seed the smallest seed which has failed so far, -1 if none has failed yet
+ */
+static void ct_wait_schedule(pid_t* workers, long* seeds, int* workers_number, long* failed_schedules, long* smallest_failed_seed) {
+	int status;
+	pid_t pid = 0;
+
+	//only the workers are waited for, since the code under test may have spawned children of its own
+	for (int i = 0; i < *workers_number && pid == 0; i++) {
+		pid = waitpid(workers[i], &status, WNOHANG);
+	}
+	if (pid == 0) {
+		//no worker has terminated yet, so the first one is waited for
+		while ((pid = waitpid(workers[0], &status, 0)) < 0 && errno == EINTR);
+	}
+	if (pid < 0) {
+		perror("CrashC - cannot wait for a schedule worker");
+		exit(1);
+	}
+
+	for (int i = 0; i < *workers_number; i++) {
+		if (workers[i] != pid) {
+			continue;
+		}
+		if (!WIFEXITED(status) || WEXITSTATUS(status) != 0) {
+			*failed_schedules += 1;
+			if (*smallest_failed_seed < 0 || seeds[i] < *smallest_failed_seed) {
+				*smallest_failed_seed = seeds[i];
+			}
+		}
+		workers[i] = workers[*workers_number - 1];
+		seeds[i] = seeds[*workers_number - 1];
+		*workers_number -= 1;
+		return;
+	}
+}
@@ -57,7 +57,7 @@ struct ct_section* ct_section_get_child(const struct ct_section* parent, int n)
 	}
 }
 
-struct ct_section* ct_section_init(enum ct_section_type type, const char* description, const char* tags) {
+struct ct_section* ct_section_init(enum ct_section_type type, const char* description, ct_tag_hashtable_o* tags) {
 	struct ct_section* ret_val = malloc(sizeof(struct ct_section));
 	if (ret_val == NULL) {
 		CT_MALLOC_ERROR_CALLBACK();
@@ -79,9 +79,10 @@ struct ct_section* ct_section_init(enum ct_section_type type, const char* descri
 	ret_val->loop2 = false;
 	ret_val->next_sibling = NULL;
 	ret_val->parent = NULL;
-	ret_val->tags = ct_ht_init();
-
-	ct_tag_ht_populate(ret_val->tags, tags, CT_TAGS_SEPARATOR);
+	ret_val->tags = tags;
+	ret_val->path_hash = CT_ROOT_PATH_HASH;
+	ret_val->on_target_path = true;
+	ret_val->inside_target = true;
 
 	return ret_val;
 }
@@ -98,42 +99,50 @@ void ct_section_destroy(struct ct_section* section) {
 		return;
 	}
 
-	ct_ht_destroy_with_elements(section->tags, (ct_destroyer_c)(ct_tag_destroy));
 	free((void*) section->description);
 	free((void*) section);
 }
 
-bool ct_section_still_discovering_children(const struct ct_section* section) {
-	return !section->children_number_known;
+unsigned long ct_testcase_key_hash(const struct ct_testcase_key* key) {
+	return key->path_hash * 31 + (unsigned long) key->occurrence;
 }
 
-void ct_section_set_signaled(struct ct_section* section) {
-	section->status = CT_SECTION_SIGNAL_DETECTED;
-}
+unsigned long ct_section_path_hash(unsigned long parent_hash, const char* description, size_t length) {
+	//djb2, like ct_string_hash, so the hash of a path is the hash of the whole string
+	unsigned long hash = ((parent_hash << 5) + parent_hash) + CT_SECTION_PATH_SEPARATOR;
 
-bool ct_section_is_signaled(const struct ct_section* section) {
-	return section->status == CT_SECTION_SIGNAL_DETECTED;
+	for (size_t i = 0; i < length; i++) {
+		hash = ((hash << 5) + hash) + (unsigned char) description[i];
+	}
+	return hash;
 }
 
-void ct_section_set_executed(struct ct_section* section) {
-	section->status = CT_SECTION_PARTIALLY_VISITED;
-}
+void ct_section_site_prepare(struct ct_section_site* site, const char* tags, struct ct_section_site** prepared_sites) {
+	if (site->prepared) {
+		return;
+	}
 
-void ct_section_set_done(struct ct_section* section) {
-	section->status = CT_SECTION_FULLY_VISITED;
+	site->tags = ct_ht_init();
+	if (!ct_tag_ht_populate(site->tags, tags, CT_TAGS_SEPARATOR)) {
+		fprintf(stderr, "CrashC - %s:%d: malformed tags \"%s\": tags can't be empty\n", site->file, site->line, tags);
+	}
+	site->prepared = true;
+	site->next = *prepared_sites;
+	*prepared_sites = site;
 }
 
-void ct_section_set_skipped(struct ct_section* section) {
-	section->status = CT_SECTION_SKIPPED_BY_TAG;
-}
+void ct_section_sites_release(struct ct_section_site** prepared_sites) {
+	struct ct_section_site* site = *prepared_sites;
 
-bool ct_section_still_needs_execution(struct ct_section* section) {
-	if (section->status == CT_SECTION_UNVISITED || section->status == CT_SECTION_PARTIALLY_VISITED) {
-		return true;
-	}
-	else {
-		return false;
+	while (site != NULL) {
+		struct ct_section_site* next = site->next;
+		ct_ht_destroy_with_elements(site->tags, (ct_destroyer_c)(ct_tag_destroy));
+		site->tags = NULL;
+		site->prepared = false;
+		site->next = NULL;
+		site = next;
 	}
+	*prepared_sites = NULL;
 }
 
 int ct_section_get_level(const struct ct_section* section) {
@@ -0,0 +1,280 @@
+/*
+ * section_fork.c
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: koldar
+ */
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <errno.h>
+#include <setjmp.h>
+#include <unistd.h>
+#include <sys/types.h>
+#include <sys/wait.h>
+
+#include "section_fork.h"
+#include "report_serialization.h"
+#include "model.h"
+#include "section.h"
+#include "test_report.h"
+#include "events.h"
+#include "sig_handling.h"
+#include "output_capture.h"
+#include "fuzz.h"
+#include "allocation_tracker.h"
+#include "macros.h"
+#include "errors.h"
+
+struct ct_section_fork* ct_init_section_fork() {
+	struct ct_section_fork* ret_val = malloc(sizeof(struct ct_section_fork));
+	if (ret_val == NULL) {
+		CT_MALLOC_ERROR_CALLBACK();
+	}
+
+	ret_val->channel = -1;
+	ret_val->root = NULL;
+	ret_val->first_report = 0;
+	ret_val->delegated = false;
+	ret_val->collected_reports = ct_list_init();
+	ret_val->arena = ct_init_report_arena();
+
+	return ret_val;
+}
+
+void ct_destroy_section_fork(struct ct_section_fork* section_fork) {
+	ct_list_destroy_with_elements(section_fork->collected_reports, (ct_destroyer_c) ct_destroy_test_report);
+	ct_destroy_report_arena(section_fork->arena);
+	free(section_fork);
+}
+
+/**
+ * Sends the tests this process has completed to the process which forked it and exits
+ *
+ * @param[inout] model the model of the forked process
+ * @param[in] interrupted @true if the last test has been interrupted by a failed assertion or a signal
+ */
+static void ct_send_tests_and_exit(struct ct_model* model, bool interrupted) {
+	struct ct_section_fork* section_fork = model->section_fork;
+
+	ct_allocation_tracker_pause();
+	FILE* out = fdopen(section_fork->channel, "w");
+	if (out == NULL) {
+		_exit(EXIT_FAILURE);
+	}
+
+	int status = section_fork->root->status;
+	fwrite(&status, sizeof(status), 1, out);
+	fwrite(&interrupted, sizeof(interrupted), 1, out);
+	int reports_number = ct_list_size(model->test_reports_list) - section_fork->first_report;
+	fwrite(&reports_number, sizeof(reports_number), 1, out);
+	int index = 0;
+	CT_ITERATE_ON_LIST(model->test_reports_list, cell, report, struct ct_test_report*) {
+		if (index >= section_fork->first_report) {
+			ct_serialize_test_report(out, report);
+		}
+		index += 1;
+	}
+
+	//the output of the tests needs to reach the terminal before the process which forked goes on
+	bool sent = !ferror(out) && fclose(out) == 0;
+	fflush(NULL);
+	_exit(sent ? EXIT_SUCCESS : EXIT_FAILURE);
+}
+
+static bool ct_is_ancestor_of(const struct ct_section* section, const struct ct_section* descendant) {
+	for (const struct ct_section* s = descendant->parent; s != NULL; s = s->parent) {
+		if (s == section) {
+			return true;
+		}
+	}
+	return false;
+}
+
+static void ct_confine_subtree(struct ct_section* section, const struct ct_section* root, bool parent_inside) {
+	section->inside_target = parent_inside || section == root;
+	section->on_target_path = section->inside_target || ct_is_ancestor_of(section, root);
+	for (struct ct_section* child = section->first_child; child != NULL; child = child->next_sibling) {
+		ct_confine_subtree(child, root, section->inside_target);
+	}
+}
+
+/**
+ * Restricts the sections a forked process can enter to the @when it has been forked for, its ancestors and its descendants
+ *
+ * It's the same mechanism used by ::ct_select_section_path. If another section has been selected, the forked process is already confined
+ * unless its @when is inside the selected section.
+ *
+ * @param[inout] model the model of the forked process
+ * @param[in] section the @when the process has been forked for
+ */
+static void ct_confine_to_section(struct ct_model* model, struct ct_section* section) {
+	if (!section->inside_target) {
+		return;
+	}
+	//the sections found from now on are inside the @when only if their parent is
+	ct_ht_clear(model->selected_path_prefixes);
+	model->selected_path_level = ct_section_get_level(section);
+	ct_confine_subtree(model->root_section, section, false);
+}
+
+/**
+ * Reports a @when whose forked process has terminated without sending its tests back
+ *
+ * The tests of the forked process are lost: the running test is kept in their place and fails as if the @when had received a signal.
+ * Like a signal, this interrupts the @testcase.
+ *
+ * @param[inout] model the model of the process which forked
+ * @param[inout] section the @when the process has been forked for
+ * @param[in] exit_status the status of the forked process, as returned by \c waitpid
+ */
+static void ct_section_lost(struct ct_model* model, struct ct_section* section, int exit_status) {
+	struct ct_section_fork* section_fork = model->section_fork;
+	struct ct_test_report* report = ct_list_tail(model->test_reports_list);
+
+	fprintf(stderr, "CrashC - the process running the section \"%s\" has terminated without sending its tests back\n", section->description);
+	struct ct_snapshot* snapshot = ct_add_snapshot_to_tree(ct_init_section_snapshot(section), model->current_snapshot);
+	ct_section_set_signaled(section);
+	snapshot->status = CT_SNAPSHOT_SIGNALED;
+	if (WIFSIGNALED(exit_status)) {
+		section->signal_detected = WTERMSIG(exit_status);
+		snapshot->signal_detected = WTERMSIG(exit_status);
+	}
+	ct_update_test_outcome(report, snapshot);
+	section_fork->delegated = false;
+	ct_allocation_tracker_resume();
+
+	model->current_snapshot = NULL;
+	siglongjmp(model->jump_point, CT_SIGNAL_JUMP_CODE);
+}
+
+bool ct_fork_section(struct ct_model* model, struct ct_section* section) {
+	struct ct_section_fork* section_fork = model->section_fork;
+
+	//a fuzzer runs a single input per process
+	if (ct_is_fuzzing(model)) {
+		return true;
+	}
+
+	int channel[2];
+	if (pipe(channel) != 0) {
+		perror("CrashC - cannot create the pipe of a forked section");
+		exit(EXIT_FAILURE);
+	}
+	//otherwise the buffered output would be written by both processes
+	fflush(NULL);
+	long output_mark = (model->output_capture != NULL) ? ct_output_capture_mark(model->output_capture) : -1;
+	pid_t pid = fork();
+	if (pid < 0) {
+		perror("CrashC - cannot fork a section");
+		exit(EXIT_FAILURE);
+	}
+
+	ct_allocation_tracker_pause();
+	if (pid == 0) {
+		close(channel[0]);
+		if (section_fork->channel >= 0) {
+			close(section_fork->channel);
+		}
+		section_fork->channel = channel[1];
+		section_fork->root = section;
+		//the running test is the first one to send back
+		section_fork->first_report = ct_list_size(model->test_reports_list) - 1;
+		section_fork->delegated = false;
+		//the tests collected so far belong to the process which forked
+		ct_list_destroy_with_elements(section_fork->collected_reports, (ct_destroyer_c) ct_destroy_test_report);
+		section_fork->collected_reports = ct_list_init();
+		//the listeners are notified by the process which collects the tests
+		model->event_dispatcher->subscribed_events = 0;
+		ct_confine_to_section(model, section);
+		ct_allocation_tracker_resume();
+		return true;
+	}
+
+	close(channel[1]);
+	struct ct_serialized_buffer buffer;
+	ct_read_serialized_data(channel[0], &buffer);
+	close(channel[0]);
+
+	int exit_status;
+	while (waitpid(pid, &exit_status, 0) < 0 && errno == EINTR);
+
+	if (!WIFEXITED(exit_status) || WEXITSTATUS(exit_status) != EXIT_SUCCESS) {
+		free(buffer.data);
+		ct_section_lost(model, section, exit_status);
+	}
+	//the forked process has written into the same captured output, but what it has written belongs to its own tests
+	if (model->output_capture != NULL) {
+		ct_output_capture_rewind(model->output_capture, output_mark);
+	}
+
+	int status;
+	bool interrupted;
+	int reports_number;
+	ct_deserialize_bytes(&buffer, &status, sizeof(status));
+	ct_deserialize_bytes(&buffer, &interrupted, sizeof(interrupted));
+	ct_deserialize_bytes(&buffer, &reports_number, sizeof(reports_number));
+	for (int i = 0; i < reports_number && !buffer.corrupted; i++) {
+		ct_list_add_tail(section_fork->collected_reports, ct_deserialize_test_report(&buffer, section_fork->arena));
+	}
+	if (buffer.corrupted) {
+		//the forked process is a copy of this one: it can't have sent anything else than whole tests
+		fprintf(stderr, "CrashC - corrupted tests have been received\n");
+		exit(EXIT_FAILURE);
+	}
+	free(buffer.data);
+	section->status = status;
+	section_fork->delegated = true;
+	ct_allocation_tracker_resume();
+
+	if (interrupted) {
+		//the test process would have stopped running the @testcase as well
+		model->current_snapshot = NULL;
+		siglongjmp(model->jump_point, CT_ASSERT_JUMP_CODE);
+	}
+	return false;
+}
+
+bool ct_section_fork_end_test(struct ct_model* model, struct ct_test_report* report, bool interrupted) {
+	struct ct_section_fork* section_fork = model->section_fork;
+	//if the test has delegated its @when sections, the forked processes have run the actual tests
+	bool ret_val = !section_fork->delegated;
+
+	if (CT_HAS_LISTENERS(model, CT_EVENT_TEST_END)) {
+		CT_ITERATE_ON_LIST(section_fork->collected_reports, cell, collected, struct ct_test_report*) {
+			ct_dispatch_test_end(model, collected);
+		}
+	}
+
+	ct_allocation_tracker_pause();
+	if (!ct_list_is_empty(section_fork->collected_reports)) {
+		//the collected tests take the place of the running one, which goes after them if it's kept
+		ct_list_replace_tail(model->test_reports_list, ct_list_pop(section_fork->collected_reports));
+		if (ret_val) {
+			ct_list_add_tail(section_fork->collected_reports, report);
+		} else {
+			ct_destroy_test_report(report);
+		}
+		if (!ct_list_is_empty(section_fork->collected_reports)) {
+			ct_list_full_transfer(model->test_reports_list, section_fork->collected_reports);
+		}
+	} else if (!ret_val) {
+		ct_list_pop_tail(model->test_reports_list);
+		ct_destroy_test_report(report);
+	}
+	section_fork->delegated = false;
+	ct_allocation_tracker_resume();
+
+	//an interrupted test ends the @testcase
+	if (section_fork->root != NULL && (interrupted || !ct_section_still_needs_execution(section_fork->root))) {
+		ct_send_tests_and_exit(model, interrupted);
+	}
+	return ret_val;
+}
+
+void ct_section_fork_leave(struct ct_model* model) {
+	if (model->section_fork != NULL && model->section_fork->root != NULL) {
+		ct_send_tests_and_exit(model, false);
+	}
+}
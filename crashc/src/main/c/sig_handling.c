@@ -16,30 +16,94 @@
  *
  */
 
+#include <stdlib.h>
+#include <execinfo.h>
+#include <stdbool.h>
+
 #include "sig_handling.h"
 #include "main_model.h"
 
-static void ct_failsig_handler(int signum);
+/**
+ * The signals @crashc considers as a failure of the running test
+ *
+ * The array has exactly ::CT_HANDLED_SIGNALS_NUMBER cells
+ */
+static const int handled_signals[CT_HANDLED_SIGNALS_NUMBER] = {SIGSEGV, SIGBUS, SIGILL, SIGABRT, SIGFPE};
+
+static void ct_failsig_handler(int signum, siginfo_t* info, void* context);
+static int ct_handled_signal_index(int signum);
 
 void ct_register_signal_handlers() {
-	(ct_model)->_crashc_sigaction.sa_handler = ct_failsig_handler;
-	//register signals
-	//TODO add even this signals
-//	if (sigaction(SIGHUP, &sa, NULL) == -1) {
-//		perror("Error: cannot handle SIGHUP"); //Should not happen
-//	}
-//
-//	if (sigaction(SIGUSR1, &sa, NULL) == -1) {
-//		perror("Error: cannot handle SIGUSR1"); //should not happen
-//	}
-//
-//	if (sigaction(SIGINT, &sa, NULL) == -1) {
-//		perror("Error: cannot handle SIGINT"); //should not happen
-//	}
-	//TODO do not register signal if it  is already registers by the program under test itself
-	if (sigaction(SIGFPE, &((ct_model)->_crashc_sigaction), NULL) == -1) {
-		perror("Error: cannot handle SIGFPE"); //should not happen
+	struct sigaction current_action;
+
+	//the handler needs its own stack: otherwise a stack overflow can't be detected at all
+	if ((ct_model)->signal_stack.ss_sp == NULL) {
+		(ct_model)->signal_stack.ss_sp = malloc(CT_SIGNAL_STACK_SIZE);
+		if ((ct_model)->signal_stack.ss_sp == NULL) {
+			CT_MALLOC_ERROR_CALLBACK();
+		}
+		(ct_model)->signal_stack.ss_size = CT_SIGNAL_STACK_SIZE;
+		(ct_model)->signal_stack.ss_flags = 0;
+	}
+	if (sigaltstack(&((ct_model)->signal_stack), NULL) == -1) {
+		perror("Error: cannot install alternate signal stack"); //should not happen
+	}
+
+	//backtrace loads the unwinder lazily the first time it's called: we do it now since that is not async-signal-safe
+	if (CT_BACKTRACE_SIZE > 0) {
+		(ct_model)->backtrace_buffer_size = backtrace((ct_model)->backtrace_buffer, CT_BACKTRACE_SIZE + CT_BACKTRACE_SKIPPED_FRAMES);
+		(ct_model)->backtrace_buffer_size = 0;
+	}
+
+	(ct_model)->_crashc_sigaction.sa_sigaction = ct_failsig_handler;
+	(ct_model)->_crashc_sigaction.sa_flags = SA_SIGINFO | SA_ONSTACK;
+	sigemptyset(&((ct_model)->_crashc_sigaction.sa_mask));
+
+	for (int i = 0; i < CT_HANDLED_SIGNALS_NUMBER; i++) {
+		if (sigaction(handled_signals[i], NULL, &current_action) == -1) {
+			perror("Error: cannot query signal action"); //should not happen
+			continue;
+		}
+		//the program under test handles (or ignores) the signal by itself: we don't clobber its handler
+		if ((current_action.sa_flags & SA_SIGINFO) || current_action.sa_handler != SIG_DFL) {
+			continue;
+		}
+		if (sigaction(handled_signals[i], &((ct_model)->_crashc_sigaction), &((ct_model)->previous_sigactions[i])) == -1) {
+			perror("Error: cannot handle signal"); //should not happen
+			continue;
+		}
+		(ct_model)->signal_handler_installed[i] = true;
+	}
+}
+
+void ct_unregister_signal_handlers() {
+	for (int i = 0; i < CT_HANDLED_SIGNALS_NUMBER; i++) {
+		if (!(ct_model)->signal_handler_installed[i]) {
+			continue;
+		}
+		sigaction(handled_signals[i], &((ct_model)->previous_sigactions[i]), NULL);
+		(ct_model)->signal_handler_installed[i] = false;
 	}
+
+	if ((ct_model)->signal_stack.ss_sp != NULL) {
+		stack_t disabled_stack = { .ss_sp = NULL, .ss_size = 0, .ss_flags = SS_DISABLE };
+		sigaltstack(&disabled_stack, NULL);
+	}
+}
+
+/**
+ * Fetch the position of a signal inside ::handled_signals
+ *
+ * @param[in] signum the signal to look for
+ * @return the index of \c signum inside ::handled_signals or -1 if @crashc doesn't handle \c signum
+ */
+static int ct_handled_signal_index(int signum) {
+	for (int i = 0; i < CT_HANDLED_SIGNALS_NUMBER; i++) {
+		if (handled_signals[i] == signum) {
+			return i;
+		}
+	}
+	return -1;
 }
 
 /**
@@ -51,10 +115,35 @@ void ct_register_signal_handlers() {
  * What we need to do is mark the current running test as failed and update its status
  * in order that it is not run again on the next CT_LOOPER iteration.
  *
+ * If the signal is raised on a worker thread, the signal is recorded and the worker thread jumps back to where it has been started
+ * (see thread_context.h), terminating. Terminating the thread from here, via \c pthread_exit, is not allowed.
+ *
+ * If the signal is raised outside any test, or on a worker thread without a jump point, there is nowhere to jump back to: in this case
+ * the previous signal action is restored and the signal is delivered again.
+ *
  * @param signum an ID representing the signal detected
+ * @param info additional information about the signal, like the faulting address
+ * @param context the user context at the moment of the signal. Unused
  *
  */
-static void ct_failsig_handler(int signum) {
+static void ct_failsig_handler(int signum, siginfo_t* info, void* context) {
+
+	bool main_thread = ct_is_main_thread(ct_model);
+	if (!main_thread) {
+		//we can't jump into the stack of another thread: the signal will be propagated when the main thread merges it
+		ct_record_thread_signal(ct_model, signum, info);
+		ct_thread_jump_back(CT_SIGNAL_JUMP_CODE);
+	}
+
+	if (!main_thread || (ct_model)->current_snapshot == NULL) {
+		int index = ct_handled_signal_index(signum);
+		if (index >= 0) {
+			sigaction(signum, &((ct_model)->previous_sigactions[index]), NULL);
+			(ct_model)->signal_handler_installed[index] = false;
+		}
+		raise(signum);
+		return;
+	}
 
 	//printf("marking section \"%s\" as signal detected!\n", (ct_model)->current_section->description);
     //Mark test as failed code
@@ -62,6 +151,14 @@ static void ct_failsig_handler(int signum) {
 	(ct_model)->current_section->signal_detected = signum;
 
 	(ct_model)->current_snapshot->status = CT_SNAPSHOT_SIGNALED;
+	(ct_model)->current_snapshot->signal_detected = signum;
+	(ct_model)->current_snapshot->signal_code = info->si_code;
+	(ct_model)->current_snapshot->signal_address = info->si_addr;
+	//we can't allocate memory here: the backtrace will be attached to the snapshot after the jump
+	if (CT_BACKTRACE_SIZE > 0) {
+		(ct_model)->backtrace_buffer_size = backtrace((ct_model)->backtrace_buffer, CT_BACKTRACE_SIZE + CT_BACKTRACE_SKIPPED_FRAMES);
+		(ct_model)->signaled_snapshot = (ct_model)->current_snapshot;
+	}
 	struct ct_test_report* report = ct_list_tail((ct_model)->test_reports_list);
 	ct_update_test_outcome(report, (ct_model)->current_snapshot);
 	(ct_model)->current_snapshot = NULL;
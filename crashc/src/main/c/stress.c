@@ -0,0 +1,323 @@
+/*
+ * stress.c
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: koldar
+ */
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <pthread.h>
+#include <time.h>
+
+#include "stress.h"
+#include "schedule.h"
+#include "model.h"
+#include "utils.h"
+#include "errors.h"
+
+/**
+ * What every thread of a stress test needs to know
+ */
+struct ct_stress_thread {
+	ct_stress_c function;
+	int thread_id;
+	long iterations;
+	pthread_barrier_t* barrier;
+	/**
+	 * The scheduler serializing the thread. @null if the thread runs in parallel with the others
+	 */
+	struct ct_scheduler* scheduler;
+	/**
+	 * A uniform sample of the latencies of the iterations the thread has completed, of at most ::CT_STRESS_LATENCY_SAMPLES cells
+	 */
+	long* latencies;
+	/**
+	 * The state of the generator choosing which latencies stay in struct ct_stress_thread::latencies
+	 */
+	unsigned long long random_state;
+	long max_latency;
+	long completed_iterations;
+	struct timespec start_time;
+	struct timespec end_time;
+};
+
+/**
+ * A latency kept by a thread of a stress test, standing for the iterations of the thread which have not been kept as well
+ */
+struct ct_weighted_latency {
+	long latency;
+	/**
+	 * The number of iterations the latency represents
+	 */
+	double weight;
+};
+
+static struct ct_stress_report* ct_run_stress_threads(struct ct_model* model, ct_stress_c function, int threads_number, long iterations, struct ct_scheduler* scheduler);
+static void ct_set_stress_report(struct ct_model* model, struct ct_stress_report* report);
+static void* ct_stress_thread_main(void* arg);
+static void ct_stress_thread_end(void* arg);
+static void ct_keep_latency(struct ct_stress_thread* thread, long iteration, long latency);
+static int ct_compare_latencies(const void* a, const void* b);
+static long ct_latency_percentile(const struct ct_weighted_latency* sorted_latencies, long size, double total_weight, double percentile);
+
+void ct_run_stress(struct ct_model* model, ct_stress_c function, int threads_number, long iterations) {
+	struct ct_stress_report* report;
+
+	if (threads_number <= 0 || iterations <= 0) {
+		fprintf(stderr, "CrashC - a stress test needs a positive number of threads and of iterations, not %d and %ld\n", threads_number, iterations);
+		model->current_snapshot->status = CT_SNAPSHOT_FAILED;
+		return;
+	}
+	if (model->schedule_replay_seed >= 0) {
+		ct_run_stress_schedule(model, function, threads_number, iterations, model->schedule_replay_seed);
+		return;
+	}
+	if (model->schedule_seeds <= 0) {
+		report = ct_run_stress_threads(model, function, threads_number, iterations, NULL);
+		ct_set_stress_report(model, report);
+		return;
+	}
+
+	long failed_schedules;
+	long failed_seed = ct_explore_schedules(model, function, threads_number, iterations, &failed_schedules);
+	//the replay puts in the report the assertions of the failing interleaving
+	ct_run_stress_schedule(model, function, threads_number, iterations, (failed_seed >= 0) ? failed_seed : 0);
+	model->current_snapshot->stress->explored_schedules = model->schedule_seeds;
+	model->current_snapshot->stress->failed_schedules = failed_schedules;
+}
+
+bool ct_run_stress_schedule(struct ct_model* model, ct_stress_c function, int threads_number, long iterations, long seed) {
+	struct ct_scheduler* scheduler;
+
+	ct_allocation_tracker_pause();
+	scheduler = ct_init_scheduler(threads_number, seed);
+	ct_allocation_tracker_resume();
+
+	struct ct_stress_report* report = ct_run_stress_threads(model, function, threads_number, iterations, scheduler);
+	report->schedule_seed = seed;
+	ct_set_stress_report(model, report);
+
+	ct_allocation_tracker_pause();
+	ct_destroy_scheduler(scheduler);
+	ct_allocation_tracker_resume();
+
+	return !ct_thread_reports_have_failed(model);
+}
+
+void ct_destroy_stress_report(struct ct_stress_report* report) {
+	free(report->threads);
+	free(report);
+}
+
+/**
+ * Spawns the threads of a stress test, waits for them and computes the measurements
+ *
+ * @param[inout] model the model to handle
+ * @param[in] function the function every thread runs at every iteration
+ * @param[in] threads_number the number of threads to spawn
+ * @param[in] iterations the number of times each thread calls \c function
+ * @param[inout] scheduler the scheduler serializing the threads. @null to run them in parallel
+ * @return the measurements of the stress test
+ */
+static struct ct_stress_report* ct_run_stress_threads(struct ct_model* model, ct_stress_c function, int threads_number, long iterations, struct ct_scheduler* scheduler) {
+	pthread_barrier_t barrier;
+	long kept_latencies = (iterations < CT_STRESS_LATENCY_SAMPLES) ? iterations : CT_STRESS_LATENCY_SAMPLES;
+
+	ct_allocation_tracker_pause();
+	struct ct_stress_thread* threads = malloc(sizeof(struct ct_stress_thread) * threads_number);
+	pthread_t* thread_ids = malloc(sizeof(pthread_t) * threads_number);
+	long* latencies = malloc(sizeof(long) * threads_number * kept_latencies);
+	struct ct_weighted_latency* distribution = malloc(sizeof(struct ct_weighted_latency) * threads_number * kept_latencies);
+	struct ct_stress_report* report = malloc(sizeof(struct ct_stress_report));
+	if (report != NULL) {
+		report->threads = malloc(sizeof(struct ct_stress_thread_report) * threads_number);
+	}
+	ct_allocation_tracker_resume();
+	if (threads == NULL || thread_ids == NULL || latencies == NULL || distribution == NULL || report == NULL || report->threads == NULL) {
+		CT_MALLOC_ERROR_CALLBACK();
+	}
+
+	pthread_barrier_init(&barrier, NULL, threads_number);
+	for (int i = 0; i < threads_number; i++) {
+		threads[i].function = function;
+		threads[i].thread_id = i;
+		threads[i].iterations = iterations;
+		threads[i].barrier = &barrier;
+		threads[i].scheduler = scheduler;
+		threads[i].latencies = &latencies[i * kept_latencies];
+		threads[i].random_state = ((unsigned long long) i + 1) * 0x9E3779B97F4A7C15ULL;
+		threads[i].max_latency = 0;
+		threads[i].completed_iterations = 0;
+	}
+	for (int i = 0; i < threads_number; i++) {
+		if (pthread_create(&thread_ids[i], NULL, ct_stress_thread_main, &threads[i]) != 0) {
+			fprintf(stderr, "CrashC - cannot create the thread %d of a stress test\n", i);
+			exit(1);
+		}
+	}
+	if (scheduler != NULL) {
+		ct_scheduler_start(scheduler);
+	}
+	for (int i = 0; i < threads_number; i++) {
+		pthread_join(thread_ids[i], NULL);
+	}
+	pthread_barrier_destroy(&barrier);
+
+	//gather the latencies of every thread in a single distribution, where each kept latency stands for the iterations of its thread
+	long total_latencies = 0;
+	double total_weight = 0;
+	report->threads_number = threads_number;
+	report->iterations = iterations;
+	report->max_latency = 0;
+	report->schedule_seed = -1;
+	report->explored_schedules = 0;
+	report->failed_schedules = 0;
+	for (int i = 0; i < threads_number; i++) {
+		struct ct_stress_thread_report* thread_report = &report->threads[i];
+		long kept = (threads[i].completed_iterations < kept_latencies) ? threads[i].completed_iterations : kept_latencies;
+
+		thread_report->completed_iterations = threads[i].completed_iterations;
+		thread_report->elapsed_time = ct_compute_time_gap(threads[i].start_time, threads[i].end_time, "n");
+		thread_report->throughput = (thread_report->elapsed_time > 0) ? (thread_report->completed_iterations * 1e9) / thread_report->elapsed_time : 0;
+		thread_report->max_latency = threads[i].max_latency;
+		for (long j = 0; j < kept; j++) {
+			distribution[total_latencies].latency = threads[i].latencies[j];
+			distribution[total_latencies].weight = ((double) threads[i].completed_iterations) / kept;
+			total_latencies += 1;
+		}
+		total_weight += threads[i].completed_iterations;
+		if (thread_report->max_latency > report->max_latency) {
+			report->max_latency = thread_report->max_latency;
+		}
+	}
+	qsort(distribution, total_latencies, sizeof(struct ct_weighted_latency), ct_compare_latencies);
+	report->latency_p50 = ct_latency_percentile(distribution, total_latencies, total_weight, 0.5);
+	report->latency_p99 = ct_latency_percentile(distribution, total_latencies, total_weight, 0.99);
+	report->latency_p999 = ct_latency_percentile(distribution, total_latencies, total_weight, 0.999);
+
+	ct_allocation_tracker_pause();
+	free(distribution);
+	free(latencies);
+	free(thread_ids);
+	free(threads);
+	ct_allocation_tracker_resume();
+
+	return report;
+}
+
+/**
+ * Stores the measurements of a stress test in struct ct_model::current_snapshot, replacing the previous ones
+ *
+ * @param[inout] model the model to handle
+ * @param[in] report the measurements to store
+ */
+static void ct_set_stress_report(struct ct_model* model, struct ct_stress_report* report) {
+	ct_allocation_tracker_pause();
+	if (model->current_snapshot->stress != NULL) {
+		ct_destroy_stress_report(model->current_snapshot->stress);
+	}
+	model->current_snapshot->stress = report;
+	ct_allocation_tracker_resume();
+}
+
+static void* ct_stress_thread_main(void* arg) {
+	struct ct_stress_thread* thread = arg;
+	struct ct_thread_context* context = ct_get_thread_context();
+	struct timespec iteration_start;
+	struct timespec iteration_end;
+
+	if (thread->scheduler != NULL) {
+		ct_scheduler_thread_start(thread->scheduler, thread->thread_id);
+	} else {
+		pthread_barrier_wait(thread->barrier);
+	}
+
+	//if an assertion fails, the thread is terminated: the cleanup handler still records when the thread stopped
+	pthread_cleanup_push(ct_stress_thread_end, thread);
+	thread->start_time = ct_get_time();
+	//a fatal signal jumps back here instead of where the thread has been started, so that the cleanup handler is run as well
+	bool signaled = false;
+	if (context != NULL) {
+		if (sigsetjmp(context->jump_point, 1)) {
+			signaled = true;
+		}
+	}
+	for (long i = 0; !signaled && i < thread->iterations; i++) {
+		iteration_start = ct_get_time();
+		thread->function(thread->thread_id, i);
+		iteration_end = ct_get_time();
+		ct_keep_latency(thread, i, ct_compute_time_gap(iteration_start, iteration_end, "n"));
+		thread->completed_iterations = i + 1;
+		ct_yield();
+	}
+	pthread_cleanup_pop(1);
+
+	return NULL;
+}
+
+static void ct_stress_thread_end(void* arg) {
+	struct ct_stress_thread* thread = arg;
+	thread->end_time = ct_get_time();
+	if (thread->scheduler != NULL) {
+		ct_scheduler_thread_end(thread->scheduler);
+	}
+}
+
+/**
+ * Records the latency of an iteration of a thread, keeping a uniform sample of at most ::CT_STRESS_LATENCY_SAMPLES latencies
+ *
+ * @param[inout] thread the thread which has completed the iteration
+ * @param[in] iteration the index of the iteration, starting from 0
+ * @param[in] latency the latency, in nanoseconds, of the iteration
+ */
+static void ct_keep_latency(struct ct_stress_thread* thread, long iteration, long latency) {
+	if (latency > thread->max_latency) {
+		thread->max_latency = latency;
+	}
+	if (iteration < CT_STRESS_LATENCY_SAMPLES) {
+		thread->latencies[iteration] = latency;
+		return;
+	}
+
+	//the iteration replaces a kept latency with probability CT_STRESS_LATENCY_SAMPLES / (iteration + 1)
+	thread->random_state ^= thread->random_state >> 12;
+	thread->random_state ^= thread->random_state << 25;
+	thread->random_state ^= thread->random_state >> 27;
+	unsigned long long random = thread->random_state * 0x2545F4914F6CDD1DULL;
+	unsigned long long replaced = (random >> 11) % ((unsigned long long) iteration + 1);
+	if (replaced < CT_STRESS_LATENCY_SAMPLES) {
+		thread->latencies[replaced] = latency;
+	}
+}
+
+static int ct_compare_latencies(const void* a, const void* b) {
+	long latency_a = ((const struct ct_weighted_latency*) a)->latency;
+	long latency_b = ((const struct ct_weighted_latency*) b)->latency;
+	return (latency_a > latency_b) - (latency_a < latency_b);
+}
+
+/**
+ * Computes a percentile of a weighted distribution with the nearest rank method
+ *
+ * @param[in] sorted_latencies the distribution, sorted in ascending order of latency
+ * @param[in] size the number of values within \c sorted_latencies
+ * @param[in] total_weight the sum of the weights of \c sorted_latencies
+ * @param[in] percentile the percentile to compute, between 0 and 1
+ * @return the requested percentile or 0 if the distribution is empty
+ */
+static long ct_latency_percentile(const struct ct_weighted_latency* sorted_latencies, long size, double total_weight, double percentile) {
+	if (size == 0) {
+		return 0;
+	}
+	double rank = percentile * total_weight;
+	double cumulative_weight = 0;
+	for (long i = 0; i < size; i++) {
+		cumulative_weight += sorted_latencies[i].weight;
+		//the tolerance absorbs the rounding of weights which are not integer
+		if (cumulative_weight >= rank - 1e-9) {
+			return sorted_latencies[i].latency;
+		}
+	}
+	return sorted_latencies[size - 1].latency;
+}
@@ -0,0 +1,124 @@
+/*
+ * suite_order.c
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: koldar
+ */
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "suite_order.h"
+#include "model.h"
+#include "progress.h"
+#include "test_report.h"
+#include "list.h"
+#include "errors.h"
+
+bool ct_parse_suite_order(const char* name, enum ct_suite_order* order) {
+	if (strcmp(name, "declaration") == 0) {
+		*order = CT_ORDER_DECLARATION;
+	} else if (strcmp(name, "durations") == 0) {
+		*order = CT_ORDER_DURATION;
+	} else if (strcmp(name, "failures") == 0) {
+		*order = CT_ORDER_FAILURES;
+	} else {
+		return false;
+	}
+	return true;
+}
+
+/**
+ * Computes how early a @testsuite needs to be run
+ *
+ * @param[in] model the model to handle
+ * @param[in] suite the index of the @testsuite in struct ct_model::tests_array
+ * @return the priority of the @testsuite: the higher, the earlier. Negative if the @testsuite is not in the history file
+ */
+static double ct_get_suite_priority(const struct ct_model* model, int suite) {
+	const struct ct_suite_timing* timing = ct_progress_get_suite_history(model->progress, model->suites_names[suite]);
+
+	if (timing == NULL) {
+		return -1;
+	}
+	if (model->suite_order == CT_ORDER_DURATION) {
+		return timing->total_time;
+	}
+	return (timing->tests > 0) ? (double) timing->failed_tests / timing->tests : 0;
+}
+
+void ct_order_suites(struct ct_model* model) {
+	//a worker receives the order from its coordinator (see distribution.h)
+	if (model->suite_order == CT_ORDER_DECLARATION || model->worker_address != NULL) {
+		return;
+	}
+	if (model->progress == NULL) {
+		fprintf(stderr, "CrashC - the order of the test suites needs a history file: they will be run in registration order\n");
+		return;
+	}
+
+	double priorities[MAX_TESTS];
+	for (int i = 0; i < model->suites_array_index; i++) {
+		priorities[i] = ct_get_suite_priority(model, i);
+	}
+
+	//an insertion sort keeps the registration order among equal priorities; the test suites are few
+	for (int i = 1; i < model->suites_array_index; i++) {
+		int suite = model->suites_order[i];
+		double priority = priorities[suite];
+		bool unknown = priority < 0;
+		int j = i - 1;
+		while (j >= 0) {
+			double other = priorities[model->suites_order[j]];
+			bool precedes = unknown ? other >= 0 : other >= 0 && other < priority;
+			if (!precedes) {
+				break;
+			}
+			model->suites_order[j + 1] = model->suites_order[j];
+			j -= 1;
+		}
+		model->suites_order[j + 1] = suite;
+	}
+}
+
+/**
+ * A test and its position in the execution order
+ */
+struct ct_ordered_report {
+	struct ct_test_report* report;
+	int position;
+};
+
+static int ct_compare_ordered_reports(const void* a, const void* b) {
+	const struct ct_ordered_report* first = a;
+	const struct ct_ordered_report* second = b;
+
+	if (first->report->repetition != second->report->repetition) {
+		return first->report->repetition - second->report->repetition;
+	}
+	if (first->report->suite != second->report->suite) {
+		return first->report->suite - second->report->suite;
+	}
+	return first->position - second->position;
+}
+
+void ct_restore_declaration_order(struct ct_model* model) {
+	int reports_number = ct_list_size(model->test_reports_list);
+	if (model->suite_order == CT_ORDER_DECLARATION || reports_number < 2) {
+		return;
+	}
+
+	struct ct_ordered_report* reports = malloc(sizeof(struct ct_ordered_report) * reports_number);
+	if (reports == NULL) {
+		CT_MALLOC_ERROR_CALLBACK();
+	}
+	for (int i = 0; i < reports_number; i++) {
+		reports[i] = (struct ct_ordered_report) { ct_list_pop(model->test_reports_list), i };
+	}
+	qsort(reports, reports_number, sizeof(struct ct_ordered_report), ct_compare_ordered_reports);
+	for (int i = 0; i < reports_number; i++) {
+		ct_list_add_tail(model->test_reports_list, reports[i].report);
+	}
+	free(reports);
+}
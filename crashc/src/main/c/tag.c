@@ -5,6 +5,9 @@
  *      Author: koldar
  */
 
+#include <stdlib.h>
+#include <string.h>
+
 #include "tag.h"
 #include "hashtable.h"
 #include "errors.h"
@@ -63,67 +66,80 @@ int ct_string_hash(const char* str) {
 }
 
 const char* ct_next_tag_in_string(const char* const str, char separator, char* characters_to_ignore, char* output) {
-	char* output_index = NULL;
-	char ch = '\0';
-	const char* input = NULL;
-	bool to_skip = false;
+	char* output_index = output;
+	const char* input = str;
 
 	//I don't use strtok because I don't want to use something with side effects
-	input = str;
-	output_index = &output[0];
-	while (true) {
-		ch = *input;
-
-		//check if the character has to be skipped
-		to_skip = false;
-		for (int i=0; (characters_to_ignore[i])!='\0'; i++) {
-			if (ch == characters_to_ignore[i]) {
-				to_skip = true;
-			}
-		}
-
-		if (!to_skip) {
-			//add the character to the buffer
-			if (ch == separator || ch == '\0') {
-				*output_index = '\0';
-				goto exit;
-			} else {
-				*output_index = ch;
-			}
+	while (*input != separator && *input != '\0') {
+		//ignored characters are not copied in output
+		if (strchr(characters_to_ignore, *input) == NULL) {
+			*output_index = *input;
+			output_index += 1;
 		}
-
-		//go to the next character
-		output_index += 1;
 		input += 1;
 	}
+	*output_index = '\0';
 
-	exit:;
 	if (*input != '\0') {
 		input++;
 	}
 	return input;
 }
 
-void ct_tag_ht_populate(ct_tag_hashtable_o* output, const char* const tags, char separator) {
-	char token[CT_BUFFER_SIZE];
-	char* position_in_buffer = NULL;
-	int token_id;
+bool ct_tag_ht_populate(ct_tag_hashtable_o* output, const char* const tags, char separator) {
+	bool ret_val = true;
+	//a token can't be longer than the whole string
+	char* token = malloc(strlen(tags) + 1);
+	if (token == NULL) {
+		CT_MALLOC_ERROR_CALLBACK();
+	}
 
 	const char* token_string = tags;
-
 	while (*token_string != '\0') {
-		token_string = ct_next_tag_in_string(token_string, separator, "", token);
+		const char* next_token_string = ct_next_tag_in_string(token_string, separator, "", token);
 
 		if (strlen(token) == 0) {
-			return;
+			//2 consecutive separators or a separator at the beginning or at the end of the string
+			ret_val = false;
+		} else {
+			//add the fetched tag inside the section
+			int token_id = ct_string_hash(token);
+			struct ct_tag* tag_with_token_id = ct_ht_get(output, token_id);
+			if (tag_with_token_id == NULL) {
+				tag_with_token_id = ct_tag_init(token);
+				ct_ht_put(output, token_id, tag_with_token_id);
+			}
 		}
 
-		//add the fetched tag inside the section
-		token_id = ct_string_hash(token);
-		struct ct_tag* tag_with_token_id = ct_ht_get(output, token_id);
-		if (tag_with_token_id == NULL) {
-			tag_with_token_id = ct_tag_init(token);
-			ct_ht_put(output, token_id, tag_with_token_id);
+		//a separator at the end of the string generates an empty tag as well
+		if (*next_token_string == '\0' && next_token_string[-1] == separator) {
+			ret_val = false;
 		}
+		token_string = next_token_string;
 	}
+
+	free(token);
+	return ret_val;
+}
+
+bool ct_tag_ht_get_number(const ct_tag_hashtable_o* tags, const char* key, long* value) {
+	size_t key_length = strlen(key);
+
+	CT_ITERATE_VALUES_ON_HT(tags, tag, struct ct_tag*) {
+		const char* name = (tag->name[0] == '[') ? tag->name + 1 : tag->name;
+		if (strncmp(name, key, key_length) != 0 || name[key_length] != ':') {
+			continue;
+		}
+
+		const char* number = name + key_length + 1;
+		char* end = NULL;
+		long parsed = strtol(number, &end, 10);
+		bool closed = (name == tag->name) ? (*end == '\0') : (end[0] == ']' && end[1] == '\0');
+		if (end != number && closed) {
+			*value = parsed;
+			return true;
+		}
+	}
+
+	return false;
 }
@@ -22,12 +22,21 @@ struct ct_test_report* ct_init_test_report(struct ct_snapshot* tc_snapshot) {
 	ret_val->execution_time = 0;
 	ret_val->outcome = CT_TEST_SUCCESS;
 	ret_val->testcase_snapshot = tc_snapshot;
+	ret_val->fuzz_input = NULL;
+	ret_val->repetition = 0;
+	ret_val->suite = 0;
+	ret_val->next_repetition = NULL;
+	ret_val->flakiness = NULL;
+	ret_val->output = NULL;
 
 	return ret_val;
 }
 
 void ct_destroy_test_report(struct ct_test_report* report) {
 	free(report->filename);
+	free(report->fuzz_input);
+	free(report->flakiness);
+	free(report->output);
 	ct_destroy_snapshot_tree(report->testcase_snapshot);
 	free(report);
 
@@ -44,6 +53,25 @@ struct ct_snapshot* ct_init_section_snapshot(struct ct_section* section) {
 	ret_val->type          = section->type;
 	ret_val->status        = CT_SNAPSHOT_OK;
 	ret_val->elapsed_time  = 0;
+	ret_val->signal_detected = 0;
+	ret_val->signal_code = 0;
+	ret_val->signal_address = NULL;
+	ret_val->backtrace = NULL;
+	ret_val->backtrace_size = 0;
+	ret_val->allocations = 0;
+	ret_val->allocated_bytes = 0;
+	ret_val->frees = 0;
+	ret_val->leaked_blocks = 0;
+	ret_val->leaked_bytes = 0;
+	memset(&ret_val->start_time, 0, sizeof(struct timespec));
+	memset(&ret_val->resource_usage, 0, sizeof(struct ct_resource_usage));
+	ret_val->measurements_taken = false;
+	ret_val->hardware_counters.instructions = CT_HARDWARE_COUNTER_UNAVAILABLE;
+	ret_val->hardware_counters.cycles = CT_HARDWARE_COUNTER_UNAVAILABLE;
+	ret_val->hardware_counters.cache_misses = CT_HARDWARE_COUNTER_UNAVAILABLE;
+	ret_val->hardware_counters.branch_misses = CT_HARDWARE_COUNTER_UNAVAILABLE;
+	ret_val->stress = NULL;
+	ret_val->benchmark = NULL;
 	ret_val->assertion_reports = ct_list_init();
 	ret_val->parent = NULL;
 	ret_val->next_sibling = NULL;
@@ -54,6 +82,13 @@ struct ct_snapshot* ct_init_section_snapshot(struct ct_section* section) {
 
 void ct_destroy_snapshot_tree(struct ct_snapshot* snapshot) {
 	free(snapshot->description);
+	free(snapshot->backtrace);
+	if (snapshot->stress != NULL) {
+		ct_destroy_stress_report(snapshot->stress);
+	}
+	if (snapshot->benchmark != NULL) {
+		ct_destroy_benchmark_report(snapshot->benchmark);
+	}
 	ct_list_destroy_with_elements(snapshot->assertion_reports, (ct_destroyer_c) ct_destroy_assert_report);
 
 	struct ct_snapshot* next_child = snapshot->first_child;
@@ -85,6 +120,23 @@ struct ct_snapshot* ct_add_snapshot_to_tree(struct ct_snapshot* to_add, struct c
 	}
 }
 
+void ct_snapshot_set_backtrace(struct ct_snapshot* snapshot, void* const* frames, int frames_number) {
+	free(snapshot->backtrace);
+	snapshot->backtrace = NULL;
+	snapshot->backtrace_size = 0;
+
+	if (frames_number <= 0) {
+		return;
+	}
+
+	snapshot->backtrace = malloc(sizeof(void*) * frames_number);
+	if (snapshot->backtrace == NULL) {
+		CT_MALLOC_ERROR_CALLBACK();
+	}
+	memcpy(snapshot->backtrace, frames, sizeof(void*) * frames_number);
+	snapshot->backtrace_size = frames_number;
+}
+
 void ct_update_snapshot_status(struct ct_section* section, struct ct_snapshot* snapshot) {
 	if (section->status == CT_SECTION_SIGNAL_DETECTED) {
 		snapshot->status = CT_SNAPSHOT_SIGNALED;
@@ -0,0 +1,221 @@
+/*
+ * thread_context.c
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: koldar
+ */
+
+#include <stdlib.h>
+#include <pthread.h>
+
+#include "thread_context.h"
+#include "model.h"
+#include "assertions.h"
+#include "test_report.h"
+#include "events.h"
+#include "sig_handling.h"
+#include "main_model.h"
+#include "errors.h"
+
+/*
+ * The actual pthread_create. It's defined by the linker only when the executable is linked with --wrap=pthread_create:
+ * otherwise it's a weak undefined symbol and its address is NULL
+ */
+extern int __real_pthread_create(pthread_t* thread, const pthread_attr_t* attr, void* (*start)(void*), void* arg) __attribute__((weak));
+
+/**
+ * The context of the calling thread. @null on the main thread and on the threads not spawned via ::__wrap_pthread_create
+ */
+static _Thread_local struct ct_thread_context* ct_thread_context = NULL;
+
+static void* ct_thread_main(void* arg);
+static void ct_release_thread_context(void* arg);
+
+bool ct_is_main_thread(const struct ct_model* model) {
+	return pthread_equal(pthread_self(), model->main_thread);
+}
+
+struct ct_thread_context* ct_get_thread_context() {
+	return ct_thread_context;
+}
+
+struct ct_snapshot* ct_get_thread_snapshot(const struct ct_model* model) {
+	if (ct_thread_context != NULL) {
+		return ct_thread_context->snapshot;
+	}
+	return ct_is_main_thread(model) ? model->current_snapshot : NULL;
+}
+
+int __wrap_pthread_create(pthread_t* thread, const pthread_attr_t* attr, void* (*start)(void*), void* arg) {
+	if (ct_model == NULL) {
+		return __real_pthread_create(thread, attr, start, arg);
+	}
+
+	//the context and its stack are allocated by the spawning thread, so that the new thread has them before running anything
+	ct_allocation_tracker_pause();
+	struct ct_thread_context* context = malloc(sizeof(struct ct_thread_context));
+	void* signal_stack = malloc(CT_SIGNAL_STACK_SIZE);
+	ct_allocation_tracker_resume();
+	if (context == NULL || signal_stack == NULL) {
+		CT_MALLOC_ERROR_CALLBACK();
+	}
+
+	context->start = start;
+	context->arg = arg;
+	context->snapshot = ct_get_thread_snapshot(ct_model);
+	context->signal_stack = (stack_t) { .ss_sp = signal_stack, .ss_size = CT_SIGNAL_STACK_SIZE, .ss_flags = 0 };
+
+	int ret_val = __real_pthread_create(thread, attr, ct_thread_main, context);
+	if (ret_val != 0) {
+		ct_release_thread_context(context);
+	}
+	return ret_val;
+}
+
+void ct_thread_jump_back(int code) {
+	if (ct_thread_context != NULL) {
+		siglongjmp(ct_thread_context->jump_point, code);
+	}
+}
+
+struct ct_thread_assert_report* ct_init_thread_assert_report(struct ct_assert_report* report) {
+	struct ct_thread_assert_report* ret_val = malloc(sizeof(struct ct_thread_assert_report));
+	if (ret_val == NULL) {
+		CT_MALLOC_ERROR_CALLBACK();
+	}
+
+	ret_val->report = report;
+	ret_val->next = NULL;
+
+	return ret_val;
+}
+
+void ct_publish_thread_assert_report(struct ct_model* model, struct ct_thread_assert_report* cell) {
+	cell->next = __atomic_load_n(&model->thread_assert_reports, __ATOMIC_RELAXED);
+	while (!__atomic_compare_exchange_n(&model->thread_assert_reports, &cell->next, cell, true, __ATOMIC_RELEASE, __ATOMIC_RELAXED)) {
+		//cell->next has been updated with the new top of the stack: just try again
+	}
+}
+
+void ct_record_thread_signal(struct ct_model* model, int signum, const siginfo_t* info) {
+	int no_signal = 0;
+
+	//-1 tells other threads the signal information is being written
+	if (!__atomic_compare_exchange_n(&model->thread_signal_detected, &no_signal, -1, false, __ATOMIC_ACQUIRE, __ATOMIC_RELAXED)) {
+		return;
+	}
+	model->thread_signal_code = info->si_code;
+	model->thread_signal_address = info->si_addr;
+	__atomic_store_n(&model->thread_signal_detected, signum, __ATOMIC_RELEASE);
+}
+
+bool ct_thread_reports_have_failed(const struct ct_model* model) {
+	if (__atomic_load_n(&model->thread_signal_detected, __ATOMIC_ACQUIRE) != 0) {
+		return true;
+	}
+
+	struct ct_thread_assert_report* cell = __atomic_load_n(&model->thread_assert_reports, __ATOMIC_ACQUIRE);
+	while (cell != NULL) {
+		if (cell->report->is_mandatory && !cell->report->passed) {
+			return true;
+		}
+		cell = cell->next;
+	}
+	return false;
+}
+
+void ct_merge_thread_reports(struct ct_model* model, struct ct_snapshot* snapshot) {
+	struct ct_thread_assert_report* cell = __atomic_exchange_n(&model->thread_assert_reports, NULL, __ATOMIC_ACQUIRE);
+	struct ct_thread_assert_report* chronological = NULL;
+	bool failed = false;
+
+	//the stack has the most recent assertion on top: we reverse it to keep the order in which assertions have been published
+	while (cell != NULL) {
+		struct ct_thread_assert_report* next = cell->next;
+		cell->next = chronological;
+		chronological = cell;
+		cell = next;
+	}
+
+	ct_allocation_tracker_pause();
+	while (chronological != NULL) {
+		struct ct_thread_assert_report* next = chronological->next;
+		if (snapshot != NULL) {
+			failed = failed || (chronological->report->is_mandatory && !chronological->report->passed);
+			ct_list_add_tail(snapshot->assertion_reports, chronological->report);
+			if (!chronological->report->passed && CT_HAS_LISTENERS(model, CT_EVENT_ASSERT_FAIL)) {
+				ct_dispatch_assert_fail(model, chronological->report);
+			}
+		} else {
+			ct_destroy_assert_report(chronological->report);
+		}
+		free(chronological);
+		chronological = next;
+	}
+	ct_allocation_tracker_resume();
+
+	int signum = __atomic_load_n(&model->thread_signal_detected, __ATOMIC_ACQUIRE);
+	if (signum > 0) {
+		if (snapshot != NULL) {
+			snapshot->status = CT_SNAPSHOT_SIGNALED;
+			snapshot->signal_detected = signum;
+			snapshot->signal_code = model->thread_signal_code;
+			snapshot->signal_address = model->thread_signal_address;
+		}
+		__atomic_store_n(&model->thread_signal_detected, 0, __ATOMIC_RELEASE);
+	}
+
+	if (snapshot == NULL) {
+		return;
+	}
+	if (failed && snapshot->status == CT_SNAPSHOT_OK) {
+		snapshot->status = CT_SNAPSHOT_FAILED;
+	}
+	if (snapshot->status != CT_SNAPSHOT_OK) {
+		ct_update_test_outcome(ct_list_tail(model->test_reports_list), snapshot);
+	}
+}
+
+/**
+ * Runs a worker thread spawned via ::__wrap_pthread_create
+ *
+ * @param[in] arg the struct ct_thread_context of the thread
+ * @return what struct ct_thread_context::start returns, or @null if the thread has raised a fatal signal
+ */
+static void* ct_thread_main(void* arg) {
+	struct ct_thread_context* context = arg;
+	void* ret_val = NULL;
+
+	ct_thread_context = context;
+	//every thread needs its own alternate stack: otherwise a stack overflow on this thread can't be handled
+	sigaltstack(&context->signal_stack, NULL);
+	//the context is released even if the thread calls pthread_exit, like a failed assertion does
+	pthread_cleanup_push(ct_release_thread_context, context);
+	if (sigsetjmp(context->jump_point, 1) == 0) {
+		ret_val = context->start(context->arg);
+	}
+	pthread_cleanup_pop(1);
+
+	return ret_val;
+}
+
+/**
+ * Releases from memory the context of a worker thread
+ *
+ * If the context belongs to the calling thread, the thread stops using its alternate signal stack as well.
+ *
+ * @param[inout] arg the struct ct_thread_context to dispose of
+ */
+static void ct_release_thread_context(void* arg) {
+	struct ct_thread_context* context = arg;
+
+	if (ct_thread_context == context) {
+		stack_t disabled_stack = { .ss_sp = NULL, .ss_size = 0, .ss_flags = SS_DISABLE };
+		sigaltstack(&disabled_stack, NULL);
+		ct_thread_context = NULL;
+	}
+	ct_allocation_tracker_pause();
+	free(context->signal_stack.ss_sp);
+	free(context);
+	ct_allocation_tracker_resume();
+}
@@ -55,7 +55,7 @@ long ct_compute_time_gap(struct timespec start, struct timespec end, const char*
 	sec = end.tv_sec - start.tv_sec;
 	nano_sec = end.tv_nsec - start.tv_nsec;
 
-	ret_val = ((sec * 1E9 + nano_sec) + nano_sec);
+	ret_val = sec * 1000000000L + nano_sec;
 	for (int i = 0; i < format; i++) {
 		ret_val /= 1000;
 	}
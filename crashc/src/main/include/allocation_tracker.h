@@ -0,0 +1,204 @@
+/**
+ * @file
+ *
+ * Module counting the dynamic memory allocations performed by the code under test
+ *
+ * The tracker interposes \c malloc, \c calloc, \c realloc and \c free through the linker \c --wrap option. To enable it, link your
+ * test executable with:
+ *
+ * @code
+ * -Wl,--wrap=malloc,--wrap=calloc,--wrap=realloc,--wrap=free
+ * @endcode
+ *
+ * If the executable is linked without such flags, the wrappers are never called and @crashc behaves exactly like before.
+ * When enabled, every snapshot counts the allocations, the frees and the bytes requested by the code it directly owns; furthermore
+ * every block allocated inside a test and not released by the end of it is considered leaked and makes the test fail.
+ *
+ * Only the allocations performed by the code under test are counted: the ones @crashc performs to build its own data structures are
+ * excluded (see ::ct_allocation_tracker_pause). Memory allocated by a shared library on behalf of the code under test (e.g. \c strdup)
+ * is not wrapped by the linker, hence it is never counted.
+ *
+ * A section can bound the blocks it allocates with a tag like \c max_allocs:0 (see ::CT_MAX_ALLOCATIONS_TAG): a @testcase allocating more blocks,
+ * or a benchmark allocating more blocks per run of its body, becomes ::CT_SNAPSHOT_OVER_ALLOCATED. This keeps hot paths allocation-free over time.
+ *
+ * The tracker can be used by several threads at the same time: allocations performed by the threads spawned by the code under test are
+ * accounted to the snapshot running when the thread has been spawned (see ::ct_get_thread_snapshot). This requires linking with
+ * \c -Wl,--wrap=pthread_create as well: the allocations of the threads spawned without such flag are not accounted to any snapshot.
+ *
+ * @author koldar
+ * @date Oct 19, 2026
+ */
+
+#ifndef ALLOCATION_TRACKER_H_
+#define ALLOCATION_TRACKER_H_
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <pthread.h>
+
+#include "typedefs.h"
+
+/**
+ * The initial number of cells of the table storing the blocks allocated by a test
+ *
+ * It needs to be a power of 2
+ */
+#ifndef CT_ALLOCATION_TABLE_INITIAL_SIZE
+#	define CT_ALLOCATION_TABLE_INITIAL_SIZE 256
+#endif
+
+/**
+ * The key of the tag bounding the blocks a section can allocate
+ *
+ * A section tagged <tt>max_allocs:N</tt> (or <tt>[max_allocs:N]</tt>) fails if it allocates more than \c N blocks. For a @testcase, the blocks
+ * allocated by the whole test but its benchmarks are counted; for a benchmark, the blocks allocated by a single run of its body.
+ * The bound is ignored if the allocation tracker is disabled.
+ */
+#ifndef CT_MAX_ALLOCATIONS_TAG
+#	define CT_MAX_ALLOCATIONS_TAG "max_allocs"
+#endif
+
+/**
+ * Keeps track of the memory blocks allocated by the code under test
+ *
+ * @definition Live block
+ * It's a memory block allocated by the code under test within the current test and not released yet
+ */
+struct ct_allocation_tracker {
+	/**
+	 * @true if the executable has been linked with the allocation wrappers, @false otherwise
+	 *
+	 * If @false, the tracker does nothing at all
+	 */
+	bool enabled;
+	/**
+	 * @true if a test is running right now
+	 *
+	 * Allocations are counted only while a test is running
+	 */
+	bool active;
+	/**
+	 * Lock protecting the table of live blocks and the allocation counters of the snapshots
+	 */
+	pthread_mutex_t lock;
+	/**
+	 * Open addressing table containing the addresses of the live blocks
+	 *
+	 * Empty cells contain @null
+	 */
+	void** blocks;
+	/**
+	 * The size, in bytes, of each block inside ct_allocation_tracker::blocks
+	 */
+	size_t* block_sizes;
+	/**
+	 * The number of cells of ct_allocation_tracker::blocks. Always a power of 2
+	 */
+	size_t capacity;
+	/**
+	 * The number of live blocks
+	 */
+	size_t live_blocks;
+	/**
+	 * The sum of the sizes of all the live blocks
+	 */
+	size_t live_bytes;
+};
+
+/**
+ * Creates a new allocation tracker in memory
+ *
+ * \note
+ * The tracker is enabled only if the allocation wrappers have been linked in the executable
+ *
+ * @return the allocation tracker
+ */
+struct ct_allocation_tracker* ct_init_allocation_tracker();
+
+/**
+ * Releases from memory an allocation tracker
+ *
+ * @param[inout] tracker the tracker to dispose of
+ */
+void ct_destroy_allocation_tracker(struct ct_allocation_tracker* tracker);
+
+/**
+ * Starts counting the allocations performed by the code under test
+ *
+ * Any block tracked so far is forgotten
+ *
+ * @param[inout] tracker the tracker to handle
+ */
+void ct_allocation_tracker_start(struct ct_allocation_tracker* tracker);
+
+/**
+ * Stops counting the allocations performed by the code under test
+ *
+ * The live blocks are still available in the tracker after this call
+ *
+ * @param[inout] tracker the tracker to handle
+ */
+void ct_allocation_tracker_stop(struct ct_allocation_tracker* tracker);
+
+/**
+ * Tells the tracker @crashc is about to perform operations on its own data structures
+ *
+ * Every allocation performed by the calling thread until the matching ::ct_allocation_tracker_resume is not accounted to the code under test.
+ * Calls can be nested. The state is kept per thread, hence no tracker is needed.
+ */
+void ct_allocation_tracker_pause();
+
+/**
+ * Tells the tracker @crashc has finished operating on its own data structures
+ *
+ * @see ct_allocation_tracker_pause
+ */
+void ct_allocation_tracker_resume();
+
+/**
+ * Stores in the snapshot the blocks leaked by the test just finished
+ *
+ * If at least one block has been leaked and the snapshot was ::CT_SNAPSHOT_OK, the snapshot becomes ::CT_SNAPSHOT_LEAKED.
+ *
+ * @param[inout] tracker the tracker to handle
+ * @param[inout] snapshot the snapshot of the @testcase just finished
+ */
+void ct_allocation_tracker_check_leaks(struct ct_allocation_tracker* tracker, struct ct_snapshot* snapshot);
+
+/**
+ * Reads the allocation counters of a snapshot while the code under test may still be updating them
+ *
+ * @param[in] tracker the tracker updating the counters
+ * @param[in] snapshot the snapshot whose counters need to be read
+ * @param[out] allocations ct_snapshot::allocations
+ * @param[out] allocated_bytes ct_snapshot::allocated_bytes
+ * @param[out] frees ct_snapshot::frees
+ */
+void ct_allocation_tracker_read(struct ct_allocation_tracker* tracker, const struct ct_snapshot* snapshot, unsigned long* allocations, size_t* allocated_bytes, unsigned long* frees);
+
+/**
+ * Checks the blocks allocated by the test just finished against the bound of its @testcase
+ *
+ * The blocks allocated by every snapshot of the test are summed, but the ones of the benchmarks, which are bounded per run of their body.
+ * If the sum exceeds the ::CT_MAX_ALLOCATIONS_TAG tag of the @testcase, or a benchmark has exceeded its own bound, and the snapshot
+ * was ::CT_SNAPSHOT_OK, the snapshot becomes ::CT_SNAPSHOT_OVER_ALLOCATED.
+ *
+ * @param[in] tracker the tracker to handle
+ * @param[inout] snapshot the snapshot of the @testcase just finished
+ */
+void ct_allocation_tracker_check_bound(struct ct_allocation_tracker* tracker, struct ct_snapshot* snapshot);
+
+/**
+ * @defgroup allocationWrappers Allocation Wrappers
+ * @brief functions replacing the standard allocation functions when the executable is linked with \c --wrap
+ * @{
+ */
+
+void* __wrap_malloc(size_t size);
+void* __wrap_calloc(size_t number, size_t size);
+void* __wrap_realloc(void* pointer, size_t size);
+void __wrap_free(void* pointer);
+
+///@}
+
+#endif /* ALLOCATION_TRACKER_H_ */
@@ -141,6 +141,8 @@ typedef void (*ct_assert_c)(struct ct_model* model);
  * This macro is not used directly, but it is masked by other macros which actually implement
  * a specific assertion type.
  *
+ * The assertion can be used by any thread: see thread_context.h for the behaviour on worker threads.
+ *
  * @param[in] model a pointer to struct ct_model used
  * @param[in] is_mandatory @true if the assertion needs to be surpassed; @false if the assertion is actually optional
  * @param[in] asserted C code representing the whole content of the assertion. This is likely to be something like <tt>someStuff == someOtherStuff</tt>.
@@ -152,13 +154,14 @@ typedef void (*ct_assert_c)(struct ct_model* model);
 #	error "CrashC - CT_ASSERTION already defined!"
 #endif
 #define CT_ASSERTION(model, is_mandatory, asserted, passed_callback, failed_callback)														\
-	ct_list_add_tail((model)->current_snapshot->assertion_reports, ct_init_assert_report(is_mandatory, #asserted, __FILE__, __LINE__));		\
+	ct_register_assert_report((model), is_mandatory, #asserted, __FILE__, __LINE__);															\
 	if ((asserted) != true) {																												\
 		failed_callback((model));																											\
 	}																																		\
 	else {																																	\
 		passed_callback((model));																											\
 	}																																		\
+	ct_complete_assert_report((model))
 
 //TODO complete the documentation here
 /**
@@ -185,6 +188,32 @@ typedef void (*ct_assert_c)(struct ct_model* model);
  */
 struct ct_assert_report* ct_init_assert_report(bool is_mandatory, char* asserted_text, char* file, unsigned int line);
 
+/**
+ * Creates a new assertion report and makes it the current assertion report of the calling thread
+ *
+ * On the main thread the report is immediately appended to the ones of struct ct_model::current_snapshot; on worker threads
+ * the report is published only when it's complete (see ::ct_complete_assert_report).
+ *
+ * \note
+ * The memory allocated here belongs to @crashc, hence it is never accounted to the code under test
+ *
+ * @param[inout] model the model to handle
+ * @param[in] is_mandatory @true if the assertion needs to be surpassed; @false if the assertion is actually optional
+ * @param[in] asserted_text a string representing the actual C code of assertion
+ * @param[in] file a string representing the file where the assertion is positioned
+ * @param[in] line the line number where the assertion is located in the file \c file
+ */
+void ct_register_assert_report(struct ct_model* model, bool is_mandatory, char* asserted_text, char* file, unsigned int line);
+
+/**
+ * Tells @crashc the current assertion report of the calling thread won't be changed anymore
+ *
+ * On worker threads, the report is published to the main thread. See thread_context.h
+ *
+ * @param[inout] model the model to handle
+ */
+void ct_complete_assert_report(struct ct_model* model);
+
 /**
  * Frees the memory allocated for a particular assertion report
  *
@@ -208,6 +237,8 @@ void ct_assert_do_nothing(struct ct_model* model);
 /**
  * Function used by the general ASSERT macro to handle its failure
  *
+ * On the main thread the function jumps back to the start of the running @testcase; on a worker thread it terminates the calling thread.
+ *
  * @param[in] model the model to handle
  */
 void ct_general_assert_failed(struct ct_model* model);
@@ -0,0 +1,374 @@
+/**
+ * @file
+ *
+ * Module measuring how the running time of a piece of code scales with a parameter, like the size of its input or the number of threads it spawns
+ *
+ * A benchmark (see ::BENCHMARK_RANGE) runs its body for every value of the parameter, doubling it from the first value up to the last one.
+ * For every value the body is timed ::CT_BENCHMARK_SAMPLES times: each sample runs the body enough times in a row to last at least
+ * ::CT_BENCHMARK_MIN_SAMPLE_TIME nanoseconds, so that even fast bodies are measured precisely. The samples farther than 1.5 times the interquartile
+ * range from the quartiles are rejected as outliers (e.g. the ones interrupted by the scheduler); the time of a value is the mean of the other
+ * samples, along with its bootstrap confidence interval.
+ *
+ * The environment of the benchmark can be controlled to make the times less noisy:
+ * \li before the first sample, the CPU spins until its clock frequency is stable, namely until ::CT_BENCHMARK_WARMUP_STABLE_CHUNKS pieces of work
+ * 	in a row take the same time (within ::CT_BENCHMARK_WARMUP_TOLERANCE), or ::CT_BENCHMARK_MAX_WARMUP_TIME nanoseconds have elapsed;
+ * \li with a warm cache (the default) the body is run once, untimed, before the samples of every value;
+ * \li with a cold cache (\c --cold_cache) a buffer as large as the last level cache is written before every sample, and every sample runs the body once;
+ * \li the benchmark can be pinned to a CPU (\c --benchmark_cpu), ideally one isolated from the scheduler (e.g. with the \c isolcpus kernel parameter).
+ * 	The threads spawned by the body inherit such affinity. The previous affinity is restored when the benchmark ends.
+ *
+ * The times are then fitted, with the least squares, to the common complexity classes (see ::ct_complexity) and the class with the smallest
+ * error is reported along with its coefficient. If an output directory is given (\c --benchmark_output) the curve is written there as a CSV file
+ * and as a gnuplot script (with its \c .dat file) drawing the measured times next to the fitted ones.
+ *
+ * @author koldar
+ * @date Oct 19, 2026
+ */
+
+#ifndef BENCHMARK_H_
+#define BENCHMARK_H_
+
+#include <stdbool.h>
+#include <time.h>
+
+#include "typedefs.h"
+
+/**
+ * The number of samples measured for every value of the parameter of a benchmark
+ */
+#ifndef CT_BENCHMARK_SAMPLES
+#	define CT_BENCHMARK_SAMPLES 20
+#endif
+
+/**
+ * The minimum time, in nanoseconds, a sample of a benchmark needs to last
+ */
+#ifndef CT_BENCHMARK_MIN_SAMPLE_TIME
+#	define CT_BENCHMARK_MIN_SAMPLE_TIME 1000000L
+#endif
+
+/**
+ * The maximum time, in nanoseconds, the CPU spins before a benchmark waiting for its clock frequency to stabilize
+ */
+#ifndef CT_BENCHMARK_MAX_WARMUP_TIME
+#	define CT_BENCHMARK_MAX_WARMUP_TIME 100000000L
+#endif
+
+/**
+ * The relative difference within which the times of 2 pieces of work of the warm-up are considered the same
+ */
+#ifndef CT_BENCHMARK_WARMUP_TOLERANCE
+#	define CT_BENCHMARK_WARMUP_TOLERANCE 0.02
+#endif
+
+/**
+ * How many pieces of work in a row need to take the same time for the clock frequency to be considered stable
+ */
+#ifndef CT_BENCHMARK_WARMUP_STABLE_CHUNKS
+#	define CT_BENCHMARK_WARMUP_STABLE_CHUNKS 5
+#endif
+
+/**
+ * The number of resamples computing the bootstrap confidence interval of the time of a value
+ */
+#ifndef CT_BENCHMARK_BOOTSTRAP_RESAMPLES
+#	define CT_BENCHMARK_BOOTSTRAP_RESAMPLES 1000
+#endif
+
+/**
+ * The confidence level of the interval of the time of a value
+ */
+#ifndef CT_BENCHMARK_CONFIDENCE
+#	define CT_BENCHMARK_CONFIDENCE 0.95
+#endif
+
+/**
+ * The size, in bytes, of the buffer flushing the cache if the size of the last level cache can't be known
+ */
+#ifndef CT_BENCHMARK_DEFAULT_CACHE_SIZE
+#	define CT_BENCHMARK_DEFAULT_CACHE_SIZE (32L * 1024 * 1024)
+#endif
+
+/**
+ * The number of words of the CPU masks used to pin a benchmark, hence how many CPUs (64 per word) can be handled
+ */
+#ifndef CT_BENCHMARK_AFFINITY_WORDS
+#	define CT_BENCHMARK_AFFINITY_WORDS 16
+#endif
+
+/**
+ * The complexity classes the times of a benchmark are fitted to
+ */
+enum ct_complexity {
+	///O(1)
+	CT_COMPLEXITY_CONSTANT,
+	///O(log n)
+	CT_COMPLEXITY_LOGARITHMIC,
+	///O(n)
+	CT_COMPLEXITY_LINEAR,
+	///O(n log n)
+	CT_COMPLEXITY_LINEARITHMIC,
+	///O(n^2)
+	CT_COMPLEXITY_QUADRATIC,
+	///O(n^3)
+	CT_COMPLEXITY_CUBIC,
+};
+
+/**
+ * The time measured for a value of the parameter of a benchmark
+ */
+struct ct_benchmark_point {
+	/**
+	 * The value of the parameter
+	 */
+	long parameter;
+	/**
+	 * How many times the body has been run in every sample
+	 */
+	long iterations;
+	/**
+	 * The mean, among the samples which are not outliers, of the time of a single run of the body, in nanoseconds
+	 */
+	double time;
+	/**
+	 * The lower bound of the confidence interval of struct ct_benchmark_point::time
+	 */
+	double time_low;
+	/**
+	 * The upper bound of the confidence interval of struct ct_benchmark_point::time
+	 */
+	double time_high;
+	/**
+	 * The number of samples rejected as outliers
+	 */
+	int outliers;
+	/**
+	 * The mean number of blocks a single run of the body has allocated via \c malloc, \c calloc or \c realloc
+	 *
+	 * The counts of struct ct_benchmark_point are measured over the runs of the samples, outliers included.
+	 * Meaningful only if struct ct_benchmark_report::allocations_counted is @true
+	 */
+	double allocations;
+	/**
+	 * The mean number of bytes a single run of the body has requested
+	 */
+	double allocated_bytes;
+	/**
+	 * The mean number of blocks a single run of the body has released
+	 */
+	double frees;
+};
+
+/**
+ * The measurements of a whole benchmark
+ */
+struct ct_benchmark_report {
+	/**
+	 * The name of the variable holding the parameter in the body of the benchmark
+	 */
+	const char* parameter_name;
+	/**
+	 * The number of items in struct ct_benchmark_report::points
+	 */
+	int points_number;
+	/**
+	 * The times measured, ordered by increasing parameter
+	 */
+	struct ct_benchmark_point* points;
+	/**
+	 * The complexity class fitting the times best
+	 */
+	enum ct_complexity complexity;
+	/**
+	 * The coefficient, in nanoseconds, of struct ct_benchmark_report::complexity: the time for a parameter \c n is about \c coefficient times \c f(n)
+	 */
+	double coefficient;
+	/**
+	 * The root mean square error of the fit, relative to the mean of the times
+	 */
+	double error;
+	/**
+	 * The CPU the benchmark has been pinned to. -1 if it hasn't been pinned
+	 */
+	int cpu;
+	/**
+	 * @true if every sample has been measured with a cold cache
+	 */
+	bool cold_cache;
+	/**
+	 * The time, in nanoseconds, the CPU has spun before the benchmark
+	 */
+	long warmup_time;
+	/**
+	 * @true if the allocation tracker was enabled, hence the allocations of every struct ct_benchmark_point have been counted
+	 */
+	bool allocations_counted;
+};
+
+/**
+ * The state of the benchmark running right now
+ */
+struct ct_benchmark {
+	/**
+	 * The measurements collected so far
+	 */
+	struct ct_benchmark_report* report;
+	/**
+	 * The description of the section of the benchmark
+	 */
+	const char* description;
+	/**
+	 * The index, in struct ct_benchmark_report::points, of the value of the parameter being measured
+	 */
+	int point;
+	/**
+	 * The sample of struct ct_benchmark::point being measured. -1 while the body is run to warm up the cache
+	 */
+	int sample;
+	/**
+	 * The times of a single run of the body measured by the samples of struct ct_benchmark::point
+	 */
+	double samples[CT_BENCHMARK_SAMPLES];
+	/**
+	 * How many times the body has been run in the current sample
+	 */
+	long iteration;
+	/**
+	 * When the current sample has started
+	 */
+	struct timespec sample_start;
+	/**
+	 * ct_snapshot::allocations of the benchmark when the current sample has started
+	 */
+	unsigned long sample_allocations;
+	/**
+	 * ct_snapshot::allocated_bytes of the benchmark when the current sample has started
+	 */
+	size_t sample_allocated_bytes;
+	/**
+	 * ct_snapshot::frees of the benchmark when the current sample has started
+	 */
+	unsigned long sample_frees;
+	/**
+	 * With a cold cache, the buffer written before every sample. @null with a warm cache
+	 */
+	volatile char* flush_buffer;
+	/**
+	 * The size of struct ct_benchmark::flush_buffer
+	 */
+	long flush_size;
+	/**
+	 * If struct ct_benchmark_report::cpu is set, the CPUs the process could run on before the benchmark
+	 */
+	unsigned long previous_affinity[CT_BENCHMARK_AFFINITY_WORDS];
+};
+
+/**
+ * Starts a benchmark in struct ct_model::current_section
+ *
+ * The values of the parameter are \c from, <tt>2 * from</tt>, <tt>4 * from</tt> and so on, up to \c to.
+ * The benchmark is pinned to struct ct_model::benchmark_cpu, if set, and the CPU is warmed up.
+ * If \c from is smaller than 1 or \c to is smaller than \c from, nothing is started and struct ct_model::current_snapshot fails.
+ *
+ * \post
+ * 	\li struct ct_model::benchmark is set, unless the range of the parameter is not valid
+ *
+ * @param[inout] model the model to handle
+ * @param[in] parameter_name the name of the variable holding the parameter, used to label the curve
+ * @param[in] from the first value of the parameter, at least 1
+ * @param[in] to the last value of the parameter, at least \c from
+ * @return the first value of the parameter
+ */
+long ct_start_benchmark(struct ct_model* model, const char* parameter_name, long from, long to);
+
+/**
+ * Ends a run of the body of the benchmark and decides whether it needs to be run again
+ *
+ * When the last sample of the last value has been measured, the times are fitted, the report is stored in struct ct_model::current_snapshot
+ * and, if struct ct_model::benchmark_output is set, the curve is written into such directory. If a value has allocated, per run of the body,
+ * more blocks than the ::CT_MAX_ALLOCATIONS_TAG tag of the benchmark allows, the snapshot becomes ::CT_SNAPSHOT_OVER_ALLOCATED.
+ *
+ * @param[inout] model the model whose struct ct_model::benchmark needs to be handled
+ * @param[inout] parameter the variable holding the parameter. It's updated to the next value to measure
+ * @return @true if the body needs to be run again, @false if the benchmark has ended or has not been started
+ */
+bool ct_benchmark_next(struct ct_model* model, long* parameter);
+
+/**
+ * Computes the time of a value of the parameter of a benchmark from its samples
+ *
+ * The samples farther than 1.5 times the interquartile range from the quartiles are rejected; the confidence interval of the mean
+ * of the others is computed by resampling them ::CT_BENCHMARK_BOOTSTRAP_RESAMPLES times, always with the same random numbers.
+ *
+ * \post
+ * 	\li \c samples are sorted
+ * 	\li struct ct_benchmark_point::time, struct ct_benchmark_point::time_low, struct ct_benchmark_point::time_high and struct ct_benchmark_point::outliers are set
+ *
+ * @param[inout] samples the time of a run of the body measured by every sample
+ * @param[in] samples_number the number of items in \c samples
+ * @param[inout] point the value the samples have been measured for
+ */
+void ct_estimate_benchmark_time(double* samples, int samples_number, struct ct_benchmark_point* point);
+
+/**
+ * Spins until the clock frequency of the CPU is stable
+ *
+ * @return the time, in nanoseconds, spent spinning
+ */
+long ct_benchmark_warmup();
+
+/**
+ * Fits the times of a benchmark to the complexity classes
+ *
+ * \post
+ * 	\li struct ct_benchmark_report::complexity, struct ct_benchmark_report::coefficient and struct ct_benchmark_report::error are set
+ *
+ * @param[inout] report the report whose struct ct_benchmark_report::points need to be fitted
+ */
+void ct_fit_complexity(struct ct_benchmark_report* report);
+
+/**
+ * @param[in] complexity a complexity class
+ * @param[in] n the value of the parameter
+ * @return the value of the function of \c complexity in \c n
+ */
+double ct_complexity_function(enum ct_complexity complexity, long n);
+
+/**
+ * @param[in] complexity a complexity class
+ * @return the big O notation of \c complexity, like \c "O(n log n)"
+ */
+const char* ct_complexity_to_string(enum ct_complexity complexity);
+
+/**
+ * Writes the curve of a benchmark
+ *
+ * The function writes 3 files, named after \c description with every character but letters and digits replaced by \c _ :
+ * \li \c name.csv: the measured time of every value of the parameter, with its confidence interval, the fitted one and the allocations per run;
+ * \li \c name.dat: the same data, read by the gnuplot script;
+ * \li \c name.gp: a gnuplot script drawing the curves into \c name.png. Run it with <tt>gnuplot name.gp</tt> from the directory the tests have been run in.
+ *
+ * @param[in] report the measurements to write
+ * @param[in] directory the directory where the files are written
+ * @param[in] description the description of the benchmark
+ * @return @true if the files have been written, @false otherwise
+ */
+bool ct_write_benchmark_curve(const struct ct_benchmark_report* report, const char* directory, const char* description);
+
+/**
+ * Releases from memory a benchmark report
+ *
+ * @param[inout] report the report to dispose of
+ */
+void ct_destroy_benchmark_report(struct ct_benchmark_report* report);
+
+/**
+ * Releases from memory the state of a benchmark, along with the report it has not stored yet
+ *
+ * If the benchmark has been pinned to a CPU, the previous affinity is restored.
+ *
+ * @param[inout] benchmark the state to dispose of
+ */
+void ct_destroy_benchmark(struct ct_benchmark* benchmark);
+
+#endif /* BENCHMARK_H_ */
@@ -0,0 +1,273 @@
+/**
+ * @file
+ *
+ * Module writing and reading the binary event log of a test run
+ *
+ * The binary event log is a compact alternative to the textual report of ::ct_default_report: when the \c --binary_report command line option
+ * is given, the report producer writes the outcome of the tests in a file as a sequence of events, without formatting a single string.
+ * The standalone \c crashc-report tool can then render the log as text, JUnit XML, JSON or HTML.
+ *
+ * The log starts with the 4 bytes ::CT_BINARY_LOG_MAGIC followed by a byte containing ::CT_BINARY_LOG_VERSION. Then there are the events:
+ * each event is a byte containing its ::ct_binary_event_kind, followed by the length of its payload (4 bytes) and by the payload itself.
+ * Integers are stored in little endian; strings are stored as their length (4 bytes), their characters and a terminating \c '\0'.
+ *
+ * The events of a test are:
+ * \li a ::CT_BINARY_EVENT_TEST_START;
+ * \li a ::CT_BINARY_EVENT_SNAPSHOT_START for the @testcase snapshot, followed by a ::CT_BINARY_EVENT_ASSERTION for each of its assertions,
+ * 	by the events of its children snapshots and by a ::CT_BINARY_EVENT_SNAPSHOT_END;
+ * \li a ::CT_BINARY_EVENT_TEST_END.
+ *
+ * After all the tests there is a single ::CT_BINARY_EVENT_SUMMARY.
+ *
+ * @author koldar
+ * @date Oct 19, 2026
+ */
+
+#ifndef BINARY_REPORT_H_
+#define BINARY_REPORT_H_
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "typedefs.h"
+
+/**
+ * The first bytes of every binary event log
+ */
+#define CT_BINARY_LOG_MAGIC "CTEV"
+
+/**
+ * The version of the binary event log format
+ *
+ * Increase it every time the payload of an event changes
+ */
+#define CT_BINARY_LOG_VERSION 1
+
+/**
+ * The bytes the binary writer accumulates before issuing a \c write
+ */
+#ifndef CT_BINARY_WRITER_BUFFER_SIZE
+#	define CT_BINARY_WRITER_BUFFER_SIZE 65536
+#endif
+
+/**
+ * The kinds of event inside a binary event log
+ */
+enum ct_binary_event_kind {
+	/**
+	 * A test starts. Payload: repetition (4 bytes), fuzz input (string, empty if the test has no fuzz input)
+	 */
+	CT_BINARY_EVENT_TEST_START = 1,
+	/**
+	 * A snapshot starts. Payload: ::ct_section_type (1 byte), ::ct_snapshot_status (1 byte), signal (4 bytes), signal code (4 bytes),
+	 * elapsed time in microseconds (8 bytes), allocations, allocated bytes, frees, leaked blocks, leaked bytes (8 bytes each), description (string)
+	 */
+	CT_BINARY_EVENT_SNAPSHOT_START = 2,
+	/**
+	 * An assertion of the current snapshot. Payload: passed (1 byte), line (4 bytes), asserted, expected, actual and file name (strings)
+	 */
+	CT_BINARY_EVENT_ASSERTION = 3,
+	/**
+	 * The current snapshot ends. No payload
+	 */
+	CT_BINARY_EVENT_SNAPSHOT_END = 4,
+	/**
+	 * A test ends. Payload: ::ct_test_outcome (1 byte)
+	 */
+	CT_BINARY_EVENT_TEST_END = 5,
+	/**
+	 * The run ends. Payload: total, successful, failed and flaky tests (4 bytes each)
+	 */
+	CT_BINARY_EVENT_SUMMARY = 6
+};
+
+/**
+ * A buffered writer of a binary event log
+ *
+ * Every event is built inside struct ct_binary_writer::buffer, which is written into the file only when it's full or when the writer is flushed.
+ */
+struct ct_binary_writer {
+	/**
+	 * The file descriptor where the log is written
+	 */
+	int fd;
+	/**
+	 * The bytes not yet written into struct ct_binary_writer::fd
+	 */
+	unsigned char* buffer;
+	/**
+	 * The number of bytes inside struct ct_binary_writer::buffer
+	 */
+	size_t size;
+	/**
+	 * The number of bytes struct ct_binary_writer::buffer can contain
+	 */
+	size_t capacity;
+	/**
+	 * The position, inside struct ct_binary_writer::buffer, of the event being built
+	 */
+	size_t event_start;
+	/**
+	 * @true if a \c write has failed
+	 */
+	bool failed;
+};
+
+/**
+ * An event read from a binary event log
+ */
+struct ct_binary_event {
+	/**
+	 * The kind of the event
+	 */
+	enum ct_binary_event_kind kind;
+	/**
+	 * The payload of the event
+	 */
+	const unsigned char* payload;
+	/**
+	 * The number of bytes inside struct ct_binary_event::payload
+	 */
+	size_t length;
+	/**
+	 * The position, inside struct ct_binary_event::payload, of the next field to read
+	 */
+	size_t offset;
+};
+
+/**
+ * Writes the whole outcome of the tests as a binary event log
+ *
+ * The log is written in the file at struct ct_model::binary_report_path. Used as struct ct_report_producer::report_producer
+ * when the \c --binary_report option is given.
+ *
+ * @param[inout] model the model to handle
+ */
+void ct_binary_report(struct ct_model* model);
+
+/**
+ * Creates a binary writer and writes the header of the log
+ *
+ * @param[in] fd the file descriptor where the log is written
+ * @return the writer just created
+ */
+struct ct_binary_writer* ct_init_binary_writer(int fd);
+
+/**
+ * Starts an event
+ *
+ * @param[inout] writer the writer to use
+ * @param[in] kind the kind of the event to start
+ */
+void ct_binary_writer_start_event(struct ct_binary_writer* writer, enum ct_binary_event_kind kind);
+
+/**
+ * Ends the event started by ::ct_binary_writer_start_event, computing the length of its payload
+ *
+ * @param[inout] writer the writer to use
+ */
+void ct_binary_writer_end_event(struct ct_binary_writer* writer);
+
+/**
+ * Appends a byte to the payload of the current event
+ *
+ * @param[inout] writer the writer to use
+ * @param[in] value the value to append
+ */
+void ct_binary_writer_u8(struct ct_binary_writer* writer, uint8_t value);
+
+/**
+ * Appends a 4 bytes integer to the payload of the current event
+ *
+ * @param[inout] writer the writer to use
+ * @param[in] value the value to append
+ */
+void ct_binary_writer_u32(struct ct_binary_writer* writer, uint32_t value);
+
+/**
+ * Appends a 8 bytes integer to the payload of the current event
+ *
+ * @param[inout] writer the writer to use
+ * @param[in] value the value to append
+ */
+void ct_binary_writer_u64(struct ct_binary_writer* writer, uint64_t value);
+
+/**
+ * Appends a string to the payload of the current event
+ *
+ * @param[inout] writer the writer to use
+ * @param[in] value the string to append. @null is written as an empty string
+ */
+void ct_binary_writer_string(struct ct_binary_writer* writer, const char* value);
+
+/**
+ * Writes into the file every byte the writer has accumulated
+ *
+ * @param[inout] writer the writer to flush
+ * @return @true if every byte has been written, @false if a \c write has failed
+ */
+bool ct_binary_writer_flush(struct ct_binary_writer* writer);
+
+/**
+ * Releases from memory a binary writer
+ *
+ * \attention
+ * The writer is not flushed and its file descriptor is not closed
+ *
+ * @param[inout] writer the writer to dispose of
+ */
+void ct_destroy_binary_writer(struct ct_binary_writer* writer);
+
+/**
+ * Checks if a buffer starts with the header of a binary event log this version of @crashc can read
+ *
+ * @param[in] data the buffer to check
+ * @param[in] size the number of bytes inside \c data
+ * @return the position of the first event inside \c data or 0 if \c data is not a binary event log
+ */
+size_t ct_binary_log_header_size(const unsigned char* data, size_t size);
+
+/**
+ * Reads an event from a binary event log
+ *
+ * @param[in] data the buffer containing the event
+ * @param[in] size the number of bytes inside \c data
+ * @param[out] event the event read
+ * @return the number of bytes the event occupies inside \c data or 0 if \c data doesn't contain a whole event
+ */
+size_t ct_read_binary_event(const unsigned char* data, size_t size, struct ct_binary_event* event);
+
+/**
+ * Reads a byte from the payload of an event
+ *
+ * @param[inout] event the event to read
+ * @return the value read, 0 if the payload has no bytes left
+ */
+uint8_t ct_binary_event_u8(struct ct_binary_event* event);
+
+/**
+ * Reads a 4 bytes integer from the payload of an event
+ *
+ * @param[inout] event the event to read
+ * @return the value read, 0 if the payload has no bytes left
+ */
+uint32_t ct_binary_event_u32(struct ct_binary_event* event);
+
+/**
+ * Reads a 8 bytes integer from the payload of an event
+ *
+ * @param[inout] event the event to read
+ * @return the value read, 0 if the payload has no bytes left
+ */
+uint64_t ct_binary_event_u64(struct ct_binary_event* event);
+
+/**
+ * Reads a string from the payload of an event
+ *
+ * @param[inout] event the event to read
+ * @return the string read, which points inside the payload; an empty string if the payload has no bytes left
+ */
+const char* ct_binary_event_string(struct ct_binary_event* event);
+
+#endif /* BINARY_REPORT_H_ */
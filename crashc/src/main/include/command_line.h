@@ -14,6 +14,7 @@
 #include <stdio.h>
 
 #include "tag.h"
+#include "typedefs.h"
 
 /**
  * Analyze the command line arguments and populates all the variables involved
@@ -21,10 +22,9 @@
  * @param[in] argc \c argc from main
  * @param[in] args \c args from main
  * @param[in] tag_separator the character used to separate tags in the command line parsing (eg. -I or -E). See \ref tags for further information
- * @param[inout] run_tags hashtable from crashc model. Hashtable must be already initialized. The table will be populated at the end of the function
- * @param[inout] exclude_tags hashtable from crashc model. Hashtable must be already initialized. The table will be populated at the end of the function
+ * @param[inout] model the crashc model. Its tag hashtables must be already initialized: they will be populated at the end of the function
  */
-void ct_parse_args(const int argc, char* const* args, char tag_separator, ct_tag_hashtable_o* run_tags, ct_tag_hashtable_o* exclude_tags);
+void ct_parse_args(const int argc, char* const* args, char tag_separator, struct ct_model* model);
 
 /**
  * Print the help of the command line
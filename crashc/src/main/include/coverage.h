@@ -0,0 +1,172 @@
+/**
+ * @file
+ *
+ * Runs only the @testcase affected by a change, looking at the source files each @testcase covered in a previous run
+ *
+ * The selection needs a coverage index, built by a run with the \c --collect_coverage command line option. Such a run needs the test executable,
+ * and CrashC itself, built with gcov instrumentation (<tt>--coverage</tt>) and with \c CT_COVERAGE defined (e.g. <tt>cmake -DU_COVERAGE=true</tt>).
+ * Before every @testcase the gcov counters are reset; when every test of the @testcase has ended the counters are dumped with \c __gcov_dump
+ * into a temporary directory (set with \c GCOV_PREFIX) and every \c .gcda file with a counter not zero is added to the files the @testcase covers.
+ *
+ * The index is a text file, one record per line:
+ * \li <tt>F name</tt>: an instrumented file, namely the path of its \c .gcda file without the extension. The files are numbered from 0 in the order they appear;
+ * \li <tt>T key occurrence number files...</tt>: a @testcase, identified like in the journal (see ::ct_get_testcase_key), with the number of files it covers
+ * 	followed by their numbers.
+ *
+ * When the \c --changed_files command line option gives the list of the changed files (e.g. the output of <tt>git diff --name-only</tt>), a @testcase is run only if:
+ * \li it's missing from the index, for instance because it has been written after the index;
+ * \li or it covers a file with the same name of a changed one (\c .gcda files are named either after the source file, like \c list.c.gcda, or after the object file, like \c list.gcda).
+ * If a changed file doesn't match any file of the index, as it happens with a header, every @testcase is run: the selection never skips a @testcase the change may break,
+ * but it may run more @testcase than needed.
+ *
+ * The index is meaningful only for the same tests run with the same command line options selecting them.
+ * The code run by forked processes is not covered: while collecting, \c --fork_sections and \c --coordinator are ignored,
+ * and the processes exploring STRESS interleavings or replaying fuzzing inputs are not looked at. A ::FUZZ_TESTCASE is always run.
+ *
+ * @author koldar
+ * @date Oct 19, 2026
+ */
+
+#ifndef COVERAGE_H_
+#define COVERAGE_H_
+
+#include <stdbool.h>
+
+#include "typedefs.h"
+#include "list.h"
+#include "hashtable.h"
+#include "section.h"
+
+/**
+ * A file instrumented by gcov
+ */
+struct ct_covered_file {
+	/**
+	 * The path of the \c .gcda file of the file, without the extension
+	 */
+	char* name;
+	/**
+	 * The number of the file in the index
+	 */
+	int id;
+};
+
+/**
+ * The files covered by a @testcase
+ */
+struct ct_covered_testcase {
+	struct ct_testcase_key key;
+	/**
+	 * The number of items in struct ct_covered_testcase::files
+	 */
+	int files_number;
+	/**
+	 * The struct ct_covered_file::id of the covered files
+	 */
+	int* files;
+};
+
+/**
+ * The state of the coverage collection or of the selection of the @testcase
+ */
+struct ct_coverage {
+	/**
+	 * @true if the coverage is being collected, @false if the @testcase are being selected
+	 */
+	bool collecting;
+	/**
+	 * The file the index is written into once collected. @null while selecting
+	 */
+	char* index_path;
+	/**
+	 * While collecting, the temporary directory gcov dumps the counters into
+	 */
+	char directory[CT_BUFFER_SIZE];
+	/**
+	 * While collecting, the value \c GCOV_PREFIX had before. @null if it wasn't set
+	 */
+	char* previous_prefix;
+	/**
+	 * The instrumented files, ordered by struct ct_covered_file::id. Each value is a struct ct_covered_file
+	 */
+	ct_list_o* files;
+	/**
+	 * struct ct_coverage::files indexed by a hash of their name
+	 */
+	ct_hashtable_o* files_index;
+	/**
+	 * The @testcase in the index, in the order they have been run. Each value is a struct ct_covered_testcase
+	 */
+	ct_list_o* testcases;
+	/**
+	 * struct ct_coverage::testcases indexed by ::ct_testcase_key_hash
+	 */
+	ct_hashtable_o* testcases_index;
+	/**
+	 * While selecting, @true for the struct ct_covered_file::id of the changed files
+	 */
+	bool* changed;
+	/**
+	 * While selecting, @true if a changed file is not in the index, so every @testcase needs to be run
+	 */
+	bool run_everything;
+	/**
+	 * The @testcase running right now. @null before the first one
+	 */
+	const struct ct_section* testcase;
+	/**
+	 * @true if struct ct_coverage::testcase needs to be run
+	 */
+	bool selected;
+	/**
+	 * The number of @testcase skipped because not affected by the changed files
+	 */
+	int skipped_testcases;
+};
+
+/**
+ * Starts collecting the coverage of the @testcase, or selecting them with the coverage collected before
+ *
+ * While collecting, \c --fork_sections and \c --coordinator are disabled, since the coverage of forked processes is not collected.
+ * The process exits if the coverage can't be collected or the index can't be read.
+ *
+ * \post
+ * 	\li struct ct_model::coverage is set
+ *
+ * @param[inout] model the model to handle
+ * @param[in] index_path the coverage index
+ * @param[in] collect @true to collect the coverage and write it into \c index_path, @false to select the @testcase
+ * @param[in] changed_files_path while selecting, the file listing the changed files, one per line. \c "-" to read them from the standard input
+ * @return the state of the coverage
+ */
+struct ct_coverage* ct_enable_coverage(struct ct_model* model, const char* index_path, bool collect, const char* changed_files_path);
+
+/**
+ * Checks whether a @testcase needs to be run and, while collecting, starts collecting its coverage
+ *
+ * The function needs to be called every time access to a @testcase is requested: the first call for a @testcase makes it the running one.
+ *
+ * @param[inout] model the model whose struct ct_model::coverage needs to be handled
+ * @param[in] testcase the section of the @testcase
+ * @return @true if \c testcase needs to be run, @false if it needs to be skipped
+ */
+bool ct_coverage_enter_testcase(struct ct_model* model, const struct ct_section* testcase);
+
+/**
+ * Records the files covered by a @testcase whose tests have all ended
+ *
+ * Nothing is done while selecting, or if \c testcase is not the running one.
+ *
+ * @param[inout] model the model whose struct ct_model::coverage needs to be handled
+ * @param[in] testcase the section of the @testcase
+ */
+void ct_coverage_end_testcase(struct ct_model* model, const struct ct_section* testcase);
+
+/**
+ * Writes the index if the coverage has been collected and releases the state from memory
+ *
+ * @param[inout] coverage the state to dispose of
+ */
+void ct_destroy_coverage(struct ct_coverage* coverage);
+
+#endif /* COVERAGE_H_ */
@@ -47,6 +47,7 @@
 #include <stdlib.h>
 #include <string.h>
 #include <stdio.h>
+#include <stdint.h>
 
 #include "errors.h"
 #include "hashtable.h"
@@ -58,6 +59,21 @@
 #include "main_model.h"
 #include "report_producer.h"
 #include "assertions.h"
+#include "stress.h"
+#include "benchmark.h"
+#include "schedule.h"
+#include "fuzz.h"
+#include "flaky.h"
+#include "binary_report.h"
+#include "events.h"
+#include "progress.h"
+#include "report_serialization.h"
+#include "section_fork.h"
+#include "output_capture.h"
+#include "journal.h"
+#include "distribution.h"
+#include "coverage.h"
+#include "suite_order.h"
 
 /**
  * Callback type of a function representing a general condition that determine if we can access to a particular @containablesection source code
@@ -122,8 +138,9 @@ typedef void (*ct_enter_c)(struct ct_model* model, struct ct_section* section);
  *
  * @param[inout] model the model where we operate on
  * @param[in] func the function to register
+ * @param[in] name the id of the @testsuite, as passed to ::REG_SUITE
  */
-void ct_update_test_array(struct ct_model* model, ct_test_c func);
+void ct_update_test_array(struct ct_model* model, ct_test_c func, const char* name);
 
 /**
  * Function to concretely perform the **access cycle**
@@ -138,7 +155,49 @@ void ct_update_test_array(struct ct_model* model, ct_test_c func);
  * 	\li @true if the section has to be visited;
  * 	\li @false otherwise;
  */
-bool ct_run_once_check_access(struct ct_model* model, struct ct_section* section, ct_access_c cs, ct_enter_c callback, const ct_tag_hashtable_o* restrict run_tags, const ct_tag_hashtable_o* restrict exclude_tags);
+static inline bool ct_run_once_check_access(struct ct_model* model, struct ct_section* section, ct_access_c cs, ct_enter_c callback, const ct_tag_hashtable_o* restrict run_tags, const ct_tag_hashtable_o* restrict exclude_tags) {
+	if (!section->loop2) {
+		return false;
+	}
+
+	//a section out of the path of the selected section is skipped without looking at its tags
+	if (!section->on_target_path) {
+		section->tag_access_granted = false;
+		section->access_granted = false;
+		ct_section_set_skipped(section);
+		return false;
+	}
+
+	//check if the section we're dealing with is compliant with the context tags
+	if (!ct_ht_is_empty(exclude_tags)) {
+		if (ct_have_tag_set_intersection(section->tags, exclude_tags)) {
+			section->tag_access_granted = false;
+			section->access_granted = false;
+			ct_section_set_skipped(section);
+			return false;
+		}
+	}
+
+	if (!ct_ht_is_empty(run_tags)) {
+		if (!ct_have_tag_set_intersection(section->tags, run_tags)) {
+			section->tag_access_granted = false;
+			section->access_granted = false;
+			ct_section_set_skipped(section);
+			return false;
+		}
+	}
+	section->tag_access_granted = true;
+
+	//cs and callback are constant in every containable section macro, so once this function is inlined they are inlined as well
+	section->access_granted = cs(model, section);
+	if (section->access_granted) {
+		callback(model, section);
+		if (CT_HAS_LISTENERS(model, CT_EVENT_SECTION_ENTER)) {
+			ct_dispatch_section_enter(model, section);
+		}
+	}
+	return section->access_granted;
+}
 /**
  * Function supposed to run in the **parent switcher** cycle
  *
@@ -175,12 +234,13 @@ bool ct_run_once_final_work(struct ct_model* model, struct ct_section* section,
  * 				this attribute is set to the metadata representing @testcase.
  * @param[in] type the kind of section to fetch
  * @param[in] description a brief string explaining what this section is and does
- * @param[in] tags a list of tags. See \ref tags for further information
+ * @param[inout] site the site of the @containablesection. It's prepared the first time a section is created out of it
+ * @param[in] tags a list of tags. See \ref tags for further information. Only read when \c site is prepared, so it has to be the same every time the @containablesection is reached
  * @return
  * 	\li a newly created section if we're still computing the children of \c parent
  * 	\li the struct ct_section::current_child -th child of \c parent otherwise
  */
-struct ct_section* ct_fetch_section(struct ct_section* parent, enum ct_section_type type, const char* description, const char* tags);
+struct ct_section* ct_fetch_section(struct ct_section* parent, enum ct_section_type type, const char* description, struct ct_section_site* site, const char* tags);
 
 /**
  * Reset the struct ct_model::current_section global variable to the given one after we have detected a signal
@@ -230,13 +290,30 @@ void ct_reset_section_after_jump(struct ct_model* model, struct ct_section* cons
  * is finally fully visited. Again, you don't access to @when 2 since you've visited @when 1 in this @testcase cycle loop.
  * -# Finally you avoid entering in @when 1 since it's fully visited but you access to @when 2.
  *
+ * When the @when sections run in forked processes (see section_fork.h), only the forked process gains the access.
+ *
  * @param[in] model the model involved
  * @param[in] section the section we're trying to access
  * @return
  * 	\li \true if we can access to section \c section;
  * 	\li \false otherwise
  */
-bool ct_get_access_when(struct ct_model* model, struct ct_section* section);
+static inline bool ct_get_access_when(struct ct_model* model, struct ct_section* section) {
+	//we don't enter in this WHEN if we have already entered in another WHEN of the parent
+	if (section->parent->already_found_when) {
+		return false;
+	}
+
+	//we don't access this WHEN if we have already completed it or if it generated a SECTION_SIGNAL
+	if (section->status == CT_SECTION_FULLY_VISITED || section->status == CT_SECTION_SIGNAL_DETECTED) {
+		return false;
+	}
+
+	if (model->section_fork != NULL) {
+		return ct_fork_section(model, section);
+	}
+	return true;
+}
 
 /**
  * Grants always access
@@ -249,7 +326,22 @@ bool ct_get_access_when(struct ct_model* model, struct ct_section* section);
  * 	\li true if we can access to section \c section;
  * 	\li false otherwise
  */
-bool ct_always_enter(struct ct_model* model, struct ct_section* section);
+static inline bool ct_always_enter(struct ct_model* model, struct ct_section* section) {
+	return true;
+}
+
+/**
+ * Grants access to a @testcase
+ *
+ * A plain @testcase is always accessible, unless the tests are driven by a fuzzer: in that case only ::FUZZ_TESTCASE sections are run.
+ *
+ * @param[in] model the model involved
+ * @param[in] section the section we're trying to access
+ * @return
+ * 	\li true if we can access to section \c section;
+ * 	\li false otherwise
+ */
+bool ct_get_access_testcase(struct ct_model* model, struct ct_section* section);
 
 
 ///@}
@@ -294,6 +386,24 @@ void ct_callback_entering_then(struct ct_model* model, struct ct_section* sectio
  */
 void ct_update_current_snapshot(struct ct_model* model, struct ct_section* section);
 
+/**
+ * Starts measuring the time of a snapshot, plus the operating system resources and the hardware events if they have been requested
+ *
+ * @param[inout] model the global struct ct_model crashC model you manage
+ * @param[inout] snapshot the snapshot of the @containablesection which is starting
+ */
+void ct_start_snapshot_measurements(struct ct_model* model, struct ct_snapshot* snapshot);
+
+/**
+ * Stops measuring the time of a snapshot, plus the operating system resources and the hardware events if they have been requested
+ *
+ * After this call struct ct_snapshot::measurements_taken is @true
+ *
+ * @param[inout] model the global struct ct_model crashC model you manage
+ * @param[inout] snapshot the snapshot of the @containablesection which has just ended
+ */
+void ct_stop_snapshot_measurements(struct ct_model* model, struct ct_snapshot* snapshot);
+
 ///@defgroup afterEntering After Entering Containable struct ct_section Functions
 ///@brief Callbacks that can be used in ::ct_run_once_final_work as callbacks. Set of candidate callbacks to be called after a struct ct_section **access cycle**, **regardless** of its outcome.
 ///These callbacks have the main task to repair struct ct_model::current_section in order to ensure that the @containablesection
@@ -382,6 +492,40 @@ void ct_callback_entering_testcase(struct ct_model* model, struct ct_section* se
 
 ///@}
 
+/**
+ * The parent switcher and the access cycle of a ::CT_CONTAINABLE_SECTION
+ *
+ * Use it only when struct ct_model::current_section has already been set to the section of the @containablesection. See ::CT_CONTAINABLE_SECTION
+ * for the meaning of the parameters.
+ */
+#ifdef CT_CONTAINABLE_SECTION_CYCLES
+#	error "CrashC - CT_CONTAINABLE_SECTION_CYCLES macro already defined!"
+#endif
+#define CT_CONTAINABLE_SECTION_CYCLES(model, condition, access_granted_callback, back_to_parent_callback, exit_access_granted_callback, exit_access_denied_callback)	\
+		for (																																							\
+				(model)->current_section->loop1 = true																													\
+				;																																						\
+				ct_run_once_final_work((model), (model)->current_section, &((model)->current_section), 																	\
+						back_to_parent_callback, exit_access_granted_callback, exit_access_denied_callback																\
+				)																																						\
+				;																																						\
+				/**
+				 *  This code is execute when we have already executed the code
+				 *  inside the container. We assume every post condition of
+				 *  CT_CONTAINABLE_SECTION is satisfied for its children
+				 *  CT_CONTAINABLE_SECTION. Here current_section has not been repaired yet!
+				 */																																						\
+				 (model)->current_section->loop1 = false																												\
+		)																																								\
+		for (																																							\
+				(model)->current_section->loop2 = true																													\
+				;																																						\
+				ct_run_once_check_access((model), (model)->current_section, condition, access_granted_callback, (model)->run_only_if_tags, (model)->exclude_tags)		\
+				;																																						\
+				(model)->current_section->loop2 = false,																												\
+				ct_section_set_executed((model)->current_section)																											\
+		)
+
 /**
  * Main macro of CrashC
  *
@@ -435,32 +579,11 @@ void ct_callback_entering_testcase(struct ct_model* model, struct ct_section* se
 		 * and then we enter in such section. At the end of the execution,
 		 * we return to the parent section
 		 */																																								\
-		(model)->current_section = ct_fetch_section(parent, section_type, description, tags);																			\
+		static struct ct_section_site CT_UV(site) = CT_SECTION_SITE_INITIALIZER;																						\
+		(model)->current_section = ct_fetch_section(parent, section_type, description, &CT_UV(site), tags);															\
 		(model)->current_section->times_encountered += 1;																															\
 		setup_code																																						\
-		for (																																							\
-				(model)->current_section->loop1 = true																													\
-				;																																						\
-				ct_run_once_final_work((model), (model)->current_section, &((model)->current_section), 																	\
-						back_to_parent_callback, exit_access_granted_callback, exit_access_denied_callback																\
-				)																																						\
-				;																																						\
-				/**
-				 *  This code is execute when we have already executed the code
-				 *  inside the container. We assume every post condition of
-				 *  CT_CONTAINABLE_SECTION is satisfied for its children
-				 *  CT_CONTAINABLE_SECTION. Here current_section has not been repaired yet!
-				 */																																						\
-				 (model)->current_section->loop1 = false																												\
-		)																																								\
-		for (																																							\
-				(model)->current_section->loop2 = true																													\
-				;																																						\
-				ct_run_once_check_access((model), (model)->current_section, condition, access_granted_callback, (model)->run_only_if_tags, (model)->exclude_tags)		\
-				;																																						\
-				(model)->current_section->loop2 = false,																												\
-				ct_section_set_executed((model)->current_section)																											\
-		)
+		CT_CONTAINABLE_SECTION_CYCLES((model), condition, access_granted_callback, back_to_parent_callback, exit_access_granted_callback, exit_access_denied_callback)
 
 /**
  * Convenience macro for a NOOP
@@ -481,15 +604,16 @@ void ct_callback_entering_testcase(struct ct_model* model, struct ct_section* se
  * @param[in] section_type a value of type ::ct_section_type representing the type of this @containablesection
  * @param[in] description a value of type <tt>char*</tt> representing a brief description of the section
  * @param[in] tags a value of type <tt>char*</tt> representing all the tags within the section. See \ref tags for further information.
+ * @param[in] condition the condition (whose type is ::ct_access_c) you need to clear in order to gain access to the @containablesection
  */
 #ifdef CT_LOOPER
 #	error "CrashC - CT_LOOPER macro already defined!"
 #endif
-#define CT_LOOPER(model, parent, section_type, description, tags)																									\
+#define CT_LOOPER(model, parent, section_type, description, tags, condition)																						\
 		CT_CONTAINABLE_SECTION(																																		\
 				(model),																																			\
 				parent, section_type, description, tags,																											\
-				ct_always_enter, ct_callback_entering_testcase, 																									\
+				condition, ct_callback_entering_testcase, 																											\
 				ct_exit_callback_reset_container, ct_exit_callback_access_granted_testcase,  ct_exit_callback_do_nothing, 											\
 																																									\
 				(model)->jump_source_testcase = (model)->current_section;																							\
@@ -521,7 +645,7 @@ void ct_callback_entering_testcase(struct ct_model* model, struct ct_section* se
 #ifdef TESTCASE
 #	error "CrashC - TESTCASE macro already defined!"
 #endif
-#define TESTCASE(description, tags) CT_LOOPER(ct_model, ((ct_model)->root_section), CT_TESTCASE_SECTION, description, tags)
+#define TESTCASE(description, tags) CT_LOOPER(ct_model, ((ct_model)->root_section), CT_TESTCASE_SECTION, description, tags, ct_get_access_testcase)
 /**
  * like ::TESTCASE but with the default \c tags value of ""
  *
@@ -532,6 +656,55 @@ void ct_callback_entering_testcase(struct ct_model* model, struct ct_section* se
 #endif
 #define EZ_TESTCASE(description) TESTCASE(description, "")
 
+/**
+ * A @testcase run once for every input of a fuzzer
+ *
+ * Inside the section, \c data (of type <tt>const uint8_t*</tt>) and \c size (of type \c size_t) are the bytes of the input.
+ * Each input generates its own tests, just like a separate @testcase. See fuzz.h for how the inputs are chosen.
+ *
+ * @code
+ * FUZZ_TESTCASE("parser never crashes", data, size) {
+ * 	struct parsed* p = parse(data, size);
+ * 	ASSERT(p != NULL);
+ * }
+ * @endcode
+ *
+ * @param[in] description a value of type <tt>char*</tt> representing a brief description of the section
+ * @param[in] data the name of the variable containing the bytes of the input
+ * @param[in] size the name of the variable containing the number of bytes of the input
+ */
+#ifdef FUZZ_TESTCASE
+#	error "CrashC - FUZZ_TESTCASE macro already defined!"
+#endif
+#define FUZZ_TESTCASE(description, data, size)																														\
+		for (struct ct_fuzz_input* CT_UV(fuzz_input) = ct_fuzz_start(ct_model); CT_UV(fuzz_input) != NULL; CT_UV(fuzz_input) = ct_fuzz_next(ct_model))			\
+			for (size_t size = CT_UV(fuzz_input)->size, CT_UV(fuzz_once) = 1; CT_UV(fuzz_once) == 1; CT_UV(fuzz_once) = 0)										\
+				for (const uint8_t* data = CT_UV(fuzz_input)->data; CT_UV(fuzz_once) == 1; CT_UV(fuzz_once) = 0)													\
+					/* like CT_LOOPER, but made of a single statement so that it can be repeated for every input:											\
+					 * the first phase fetches and claims the section and sets the jump point, the second one runs the section. A jump ends the second phase */			\
+					for (volatile int CT_UV(fuzz_phase) = 0; CT_UV(fuzz_phase) < 2; CT_UV(fuzz_phase)++)														\
+						if (CT_UV(fuzz_phase) == 0) {																												\
+							static struct ct_section_site CT_UV(site) = CT_SECTION_SITE_INITIALIZER;																\
+							(ct_model)->current_section = ct_fetch_section((ct_model)->root_section, CT_TESTCASE_SECTION, description, &CT_UV(site), "");			\
+							(ct_model)->current_section->times_encountered += 1;																					\
+							if (!ct_fuzz_claim(ct_model)) {																											\
+								break;																																\
+							}																																		\
+							(ct_model)->jump_source_testcase = (ct_model)->current_section;																			\
+							if (sigsetjmp((ct_model)->jump_point, 1)) {																								\
+								ct_reset_section_after_jump((ct_model), (ct_model)->current_section, (ct_model)->jump_source_testcase);								\
+							}																																		\
+						} else																																		\
+							for (																																	\
+									;																																\
+									ct_section_still_needs_execution((ct_model)->current_section)																	\
+									;																																\
+							)																																		\
+							CT_CONTAINABLE_SECTION_CYCLES(																											\
+									(ct_model), ct_always_enter, ct_callback_entering_testcase,																		\
+									ct_exit_callback_reset_container, ct_exit_callback_access_granted_testcase, ct_exit_callback_do_nothing							\
+							)
+
 /**
  * A @containablesection where you always gain access to
  *
@@ -612,6 +785,86 @@ void ct_callback_entering_testcase(struct ct_model* model, struct ct_section* se
 #endif
 #define EZ_THEN(description) THEN(description, "")
 
+/**
+ * Represents a @containablesection running a function on several threads at the same time
+ *
+ * Every thread calls \c function \c iterations times. The threads are released together by a barrier, so they compete against each
+ * other right from the start. Assertions failing inside \c function terminate the thread where they failed and make the test fail.
+ * The throughput of every thread and the tail latency of the iterations are added to the report. You always gain access to the section.
+ *
+ * Since C has no way to run a block of code on another thread, the code to stress is a function rather than the body of the section:
+ * put a \c ; right after the macro.
+ *
+ * @code
+ * STRESS("concurrent push", "queue", 8, 10000, push_one_element);
+ * @endcode
+ *
+ * @param[in] description a value of type <tt>char*</tt> representing a brief description of the section
+ * @param[in] tags a value of type <tt>char*</tt> representing all the tags within the section. See \ref tags for further information.
+ * @param[in] threads the number of threads to run at the same time
+ * @param[in] iterations the number of times every thread calls \c function
+ * @param[in] function a function of type ::ct_stress_c containing the code to stress
+ * @see stress.h
+ */
+#ifdef STRESS
+#	error "CrashC - STRESS macro already defined!"
+#endif
+#define STRESS(description, tags, threads, iterations, function) 											\
+		CT_ALWAYS_ENTER((ct_model), CT_STRESS_SECTION, description, tags) {									\
+			ct_run_stress((ct_model), (function), (threads), (iterations));									\
+		}
+
+/**
+ * like ::STRESS but with the default \c tags value of ""
+ */
+#ifdef EZ_STRESS
+#	error "CrashC - EZ_STRESS macro already defined!"
+#endif
+#define EZ_STRESS(description, threads, iterations, function) STRESS(description, "", threads, iterations, function)
+
+/**
+ * Represents a @containablesection measuring how the time of its body scales with a parameter
+ *
+ * The body is run for every value of the parameter, from \c from to \c to doubling it every time, with the variable \c n
+ * (of type \c long) holding the current value. The parameter can be the size of the input the body handles, or the number of threads it spawns.
+ * Every value is run several times, so the body shouldn't leave behind any state. The time of every value, the complexity class fitting them
+ * best and its coefficient are added to the report. You always gain access to the section. See benchmark.h for how the times are measured.
+ *
+ * @code
+ * BENCHMARK_RANGE("sort", "list", n, 1<<10, 1<<24) {
+ * 	fill_randomly(array, n);
+ * 	sort(array, n);
+ * }
+ * @endcode
+ *
+ * A failed assertion in the body interrupts the benchmark. The body can't contain other @containablesection, nor \c break out of the section.
+ * If \c from is smaller than 1 or \c to is smaller than \c from, the section fails without running the body.
+ *
+ * If the allocation tracker is enabled, the blocks allocated by a run of the body are reported as well; tag the section with
+ * \c max_allocs:N to make it fail when a run allocates more than \c N blocks. See ::CT_MAX_ALLOCATIONS_TAG.
+ *
+ * @param[in] description a value of type <tt>char*</tt> representing a brief description of the section
+ * @param[in] tags a value of type <tt>char*</tt> representing all the tags within the section. See \ref tags for further information.
+ * @param[in] n the name of the variable holding the parameter inside the body
+ * @param[in] from the first value of the parameter, at least 1
+ * @param[in] to the last value of the parameter, at least \c from
+ * @see benchmark.h
+ */
+#ifdef BENCHMARK_RANGE
+#	error "CrashC - BENCHMARK_RANGE macro already defined!"
+#endif
+#define BENCHMARK_RANGE(description, tags, n, from, to) 																	\
+		CT_ALWAYS_ENTER((ct_model), CT_BENCHMARK_SECTION, description, tags)												\
+			for (long n = ct_start_benchmark((ct_model), #n, (from), (to)); ct_benchmark_next((ct_model), &n); )
+
+/**
+ * like ::BENCHMARK_RANGE but with the default \c tags value of ""
+ */
+#ifdef EZ_BENCHMARK_RANGE
+#	error "CrashC - EZ_BENCHMARK_RANGE macro already defined!"
+#endif
+#define EZ_BENCHMARK_RANGE(description, n, from, to) BENCHMARK_RANGE(description, "", n, from, to)
+
 //TODO all those functions should be included in the only one global models
 /**
  * Represents the default entry point for @crashc main executable
@@ -619,16 +872,25 @@ void ct_callback_entering_testcase(struct ct_model* model, struct ct_section* se
  * The macro is used to contain all test declarations and to generate the main function for the
  * execution of the various tests.
  *
- * The macro is actually masking a \c main function
+ * The macro is actually masking a \c main function. If \c CT_FUZZER is defined, it masks \c LLVMFuzzerTestOneInput instead:
+ * in that case only ::FUZZ_TESTCASE sections are run, once for every input the fuzzer generates (see fuzz.h), while the code between
+ * ::TESTS_START and ::TESTS_END is run only with the first input, since the model is kept until the fuzzer exits.
  *
  */
 #ifdef TESTS_START
 #	error "CrashC - TESTS_START macro already defined!"
 #endif
-#define TESTS_START int main(const int argc, char* const args[]) { 																\
+#ifndef CT_FUZZER
+#	define TESTS_START int main(const int argc, char* const args[]) { 																\
 		ct_model = ct_setup_default_model();																					\
-		ct_parse_args(argc, args, CT_TAGS_SEPARATOR, (ct_model)->run_only_if_tags, (ct_model)->exclude_tags); 		\
+		ct_parse_args(argc, args, CT_TAGS_SEPARATOR, ct_model); 														\
 		ct_register_signal_handlers();
+#else
+#	define TESTS_START int LLVMFuzzerTestOneInput(const uint8_t* ct_fuzz_data, size_t ct_fuzz_size) {										\
+		if (ct_model == NULL) {																									\
+			ct_model = ct_setup_default_model();																				\
+			/* the model is used by every input: the suites are registered once */
+#endif
 
 ///@defgroup hooks CrashC developer hooks
 ///@brief Represents a list of utility APIs you can use to fully customize @crashc testing execution
@@ -655,16 +917,47 @@ void ct_set_crashc_teardown(ct_teardown_c f);
 #ifdef TESTS_END
 #	error "CrashC - TESTS_END macro already defined!"
 #endif
-#define TESTS_END 																	\
-    for (int i = 0; i < (ct_model)->suites_array_index; i++) { 						\
-    	(ct_model)->tests_array[i](); 												\
-    } 																				\
+#ifndef CT_FUZZER
+#	define TESTS_END 																	\
+	ct_order_suites(ct_model);														\
+	if (ct_distribute(ct_model)) {													\
+		for ((ct_model)->repetition = 0; (ct_model)->repetition < (ct_model)->repetitions; (ct_model)->repetition++) {	\
+			for (int i = 0; i < (ct_model)->suites_array_index; i++) { 				\
+				(ct_model)->current_suite = (ct_model)->suites_order[i];			\
+				if (CT_HAS_LISTENERS((ct_model), CT_EVENT_SUITE_START)) {			\
+					ct_dispatch_suite_start((ct_model), (ct_model)->suites_names[(ct_model)->current_suite]);	\
+				}																	\
+				(ct_model)->tests_array[(ct_model)->current_suite](); 				\
+				ct_section_fork_leave(ct_model);									\
+			} 																		\
+		}																			\
+		ct_distribution_leave(ct_model);											\
+	}																				\
+	ct_unregister_signal_handlers();												\
+	ct_restore_declaration_order(ct_model);											\
+	ct_detect_flaky_tests(ct_model);												\
+	if (CT_HAS_LISTENERS((ct_model), CT_EVENT_RUN_END)) {							\
+		ct_dispatch_run_end(ct_model);												\
+	}																				\
 	(ct_model)->report_producer_implementation->report_producer(ct_model);			\
 	if ((ct_model)->ct_teardown != NULL) {											\
 		(ct_model)->ct_teardown();													\
 	}																				\
 	ct_teardown_default_model(ct_model);											\
+	ct_model = NULL;																\
 } //main function closing bracket
+#else
+#	define TESTS_END 																\
+		atexit(ct_fuzz_teardown);													\
+	}																				\
+	ct_set_fuzz_input(ct_model, ct_fuzz_data, ct_fuzz_size);						\
+    for (int i = 0; i < (ct_model)->suites_array_index; i++) { 						\
+    	(ct_model)->tests_array[i](); 												\
+    } 																				\
+	ct_fuzz_end_input(ct_model);													\
+	return 0;																		\
+} //LLVMFuzzerTestOneInput function closing bracket
+#endif
 
 /**
  * Specifies a function prototype representing a test suite.
@@ -698,7 +991,7 @@ void ct_set_crashc_teardown(ct_teardown_c f);
 #endif
 #define REG_SUITE(id) 									\
      void suite_ ## id(); 								\
-     ct_update_test_array((ct_model), suite_ ## id)
+     ct_update_test_array((ct_model), suite_ ## id, #id)
 
 /**
  * Register a batch of test suites all in one
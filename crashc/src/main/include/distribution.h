@@ -0,0 +1,145 @@
+/**
+ * @file
+ *
+ * Distributes the @testcase among worker processes, possibly running on other hosts
+ *
+ * When the \c --coordinator command line option is given, the test process becomes a coordinator: it listens on the given address,
+ * forks ::ct_get_workers_number local workers and waits for the tests. Other workers, even on other hosts, may join the run by invoking
+ * the same test executable, with the same options, with <tt>--worker</tt> and the address of the coordinator.
+ *
+ * Every worker runs the @testsuite in the order the coordinator has chosen (see suite_order.h), but before entering a @testcase (or a ::FUZZ_TESTCASE) it claims it to the coordinator:
+ * the first worker claiming a @testcase runs it, the other ones skip it. So the workers pull the @testcase as soon as they are free,
+ * and a slow @testcase doesn't hold back the others. When a worker has run every test of a @testcase, it sends the serialized tests
+ * (see report_serialization.h) to the coordinator and drops them.
+ *
+ * The coordinator notifies the tests it receives to the listeners (see events.h), while the listeners of the workers are not notified at all.
+ * The journal (see journal.h) is kept by the coordinator as well: with \c --resume, the @testcase it has completed are never granted to a worker.
+ * When every worker has left, the tests are put in the order the @testcase have been claimed in, namely the order a single process would have run them in,
+ * and the coordinator produces the report as if it had run them itself.
+ *
+ * If a worker dies while running a @testcase, the tests of that @testcase are lost: the coordinator warns about it on the standard error.
+ * The same happens if a worker sends a message the coordinator can't understand (an unexpected type, a message larger than
+ * ::CT_DISTRIBUTION_MAX_MESSAGE_SIZE or tests which can't be deserialized): the coordinator closes the connection of that worker and goes on.
+ *
+ * The messages carry the structures of @crashc as they are laid out in memory (see report_serialization.h): every worker needs to run
+ * the very same test executable as the coordinator, on the same architecture.
+ *
+ * The addresses are either <tt>unix:PATH</tt>, for a UNIX domain socket, or <tt>tcp:HOST:PORT</tt> (the \c tcp: prefix can be omitted).
+ * A coordinator listening on TCP with an empty \c HOST accepts workers from any interface.
+ * Nothing is authenticated: a TCP coordinator needs to be reachable only from trusted hosts.
+ *
+ * @author koldar
+ * @date Oct 19, 2026
+ */
+
+#ifndef DISTRIBUTION_H_
+#define DISTRIBUTION_H_
+
+#include <stdbool.h>
+
+#include "typedefs.h"
+#include "section.h"
+
+/**
+ * The number of pending connections the coordinator accepts
+ */
+#ifndef CT_DISTRIBUTION_BACKLOG
+#	define CT_DISTRIBUTION_BACKLOG 64
+#endif
+
+/**
+ * The largest message, in bytes, the coordinator accepts from a worker
+ */
+#ifndef CT_DISTRIBUTION_MAX_MESSAGE_SIZE
+#	define CT_DISTRIBUTION_MAX_MESSAGE_SIZE (256 * 1024 * 1024)
+#endif
+
+/**
+ * The state of a process taking part in a distributed run
+ */
+struct ct_distribution {
+	/**
+	 * In a worker, the connection to the coordinator. In the coordinator, the listening socket
+	 */
+	int channel;
+	/**
+	 * @true in the coordinator, @false in a worker
+	 */
+	bool coordinator;
+	/**
+	 * In a worker, the last @testcase claimed. @null before the first claim
+	 */
+	const struct ct_section* testcase;
+	/**
+	 * In a worker, @true if struct ct_distribution::testcase has been granted to this worker
+	 */
+	bool granted;
+	/**
+	 * In the coordinator, the memory of the tests received from the workers
+	 */
+	struct ct_report_arena* arena;
+	/**
+	 * In the coordinator, the number of @testcase whose worker has died before sending their tests
+	 */
+	int lost_testcases;
+};
+
+/**
+ * Takes part in a distributed run, if the command line options asked for it
+ *
+ * If struct ct_model::coordinator_address is set, the function serves the @testcase to the workers until every worker has left and
+ * moves the tests received into struct ct_model::test_reports_list. The local workers return from the function as well.
+ * If struct ct_model::worker_address is set, the function connects to the coordinator.
+ *
+ * \pre
+ * 	\li every @testsuite has been registered and ordered
+ * \post
+ * 	\li struct ct_model::distribution is set if the run is distributed
+ *
+ * @param[inout] model the model to handle
+ * @return @true if the calling process needs to run the @testsuite, @false if it's the coordinator and the tests are already in the model
+ */
+bool ct_distribute(struct ct_model* model);
+
+/**
+ * Claims a @testcase to the coordinator
+ *
+ * The function needs to be called every time access to a @testcase is requested: the first call for a @testcase claims it.
+ *
+ * \pre
+ * 	\li the calling process is a worker
+ *
+ * @param[inout] model the model to handle
+ * @param[in] testcase the section of the @testcase
+ * @return @true if the calling worker needs to run \c testcase, @false if another worker has claimed it before
+ */
+bool ct_distribution_claim(struct ct_model* model, const struct ct_section* testcase);
+
+/**
+ * Sends the tests of a @testcase to the coordinator and removes them from struct ct_model::test_reports_list
+ *
+ * Nothing is done if the calling process is not a worker or \c testcase is not the one it has claimed last.
+ *
+ * @param[inout] model the model to handle
+ * @param[in] testcase the section of the @testcase whose tests have all ended
+ */
+void ct_distribution_end_testcase(struct ct_model* model, const struct ct_section* testcase);
+
+/**
+ * Leaves the distributed run and exits if the calling process is a worker
+ *
+ * @param[inout] model the model to handle
+ */
+void ct_distribution_leave(struct ct_model* model);
+
+/**
+ * Releases from memory the state of the distribution
+ *
+ * \pre
+ * 	\li the tests received from the workers have already been released
+ *
+ * @param[inout] distribution the state to dispose of
+ */
+void ct_destroy_distribution(struct ct_distribution* distribution);
+
+#endif /* DISTRIBUTION_H_ */
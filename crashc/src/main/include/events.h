@@ -0,0 +1,155 @@
+/**
+ * @file
+ *
+ * Module notifying listeners about what happens while the tests are running
+ *
+ * A report producer (see report_producer.h) sees the outcome of the tests only once every @testsuite has been run. A **listener** is
+ * notified as soon as something happens instead: when a @testsuite starts, when a section is entered, when an assertion fails,
+ * when a test ends and when the whole run ends.
+ *
+ * A listener subscribes with ::ct_subscribe_listener and may be interested only in some events: callbacks left to @null are never called.
+ * Every event has a bit inside struct ct_event_dispatcher::subscribed_events, set only if at least one listener is interested in it.
+ * @crashc tests such bit with ::CT_HAS_LISTENERS before dispatching an event, so an event nobody is interested in costs a single branch.
+ *
+ * @author koldar
+ * @date Oct 19, 2026
+ */
+
+#ifndef EVENTS_H_
+#define EVENTS_H_
+
+#include <stdbool.h>
+
+#include "typedefs.h"
+
+/**
+ * The maximum number of listeners which can subscribe to a model
+ */
+#ifndef CT_MAX_EVENT_LISTENERS
+#	define CT_MAX_EVENT_LISTENERS 8
+#endif
+
+/**
+ * The events a listener can be notified about
+ *
+ * Each value is a bit of struct ct_event_dispatcher::subscribed_events
+ */
+enum ct_event {
+	CT_EVENT_SUITE_START = 1 << 0,
+	CT_EVENT_SECTION_ENTER = 1 << 1,
+	CT_EVENT_ASSERT_FAIL = 1 << 2,
+	CT_EVENT_TEST_END = 1 << 3,
+	CT_EVENT_RUN_END = 1 << 4
+};
+
+/**
+ * The callbacks of a listener
+ *
+ * Every callback can be @null if the listener is not interested in the corresponding event
+ */
+struct ct_event_listener {
+	ct_suite_start_listener_c on_suite_start;
+	ct_section_enter_listener_c on_section_enter;
+	ct_assert_fail_listener_c on_assert_fail;
+	ct_test_end_listener_c on_test_end;
+	ct_run_end_listener_c on_run_end;
+	/**
+	 * Passed to every callback of the listener
+	 */
+	void* data;
+};
+
+/**
+ * The listeners subscribed to a model
+ */
+struct ct_event_dispatcher {
+	/**
+	 * A bitmask of ::ct_event. A bit is set if at least a listener is interested in the corresponding event
+	 */
+	unsigned int subscribed_events;
+	/**
+	 * The listeners subscribed so far, in subscription order
+	 */
+	struct ct_event_listener listeners[CT_MAX_EVENT_LISTENERS];
+	/**
+	 * The number of cells inside struct ct_event_dispatcher::listeners
+	 */
+	int listeners_number;
+};
+
+/**
+ * Checks if at least a listener is interested in an event
+ *
+ * Use it to avoid calling the dispatch function of an event nobody is interested in.
+ *
+ * @param[in] model the model to handle
+ * @param[in] event a ::ct_event
+ * @return @true if the event needs to be dispatched, @false otherwise
+ */
+#define CT_HAS_LISTENERS(model, event) ((model)->event_dispatcher->subscribed_events & (event))
+
+/**
+ * Creates a dispatcher with no listener
+ *
+ * @return the dispatcher just created
+ */
+struct ct_event_dispatcher* ct_init_event_dispatcher();
+
+/**
+ * Subscribes a listener to the events of a model
+ *
+ * The listener is copied. Listeners are notified in subscription order.
+ *
+ * @param[inout] model the model to handle
+ * @param[in] listener the listener to subscribe
+ * @return @true if the listener has been subscribed, @false if there are already ::CT_MAX_EVENT_LISTENERS listeners
+ */
+bool ct_subscribe_listener(struct ct_model* model, const struct ct_event_listener* listener);
+
+/**
+ * Notifies the listeners that a @testsuite starts
+ *
+ * @param[inout] model the model to handle
+ * @param[in] suite_name the id of the @testsuite
+ */
+void ct_dispatch_suite_start(struct ct_model* model, const char* suite_name);
+
+/**
+ * Notifies the listeners that a section has been entered
+ *
+ * @param[inout] model the model to handle
+ * @param[in] section the section just entered
+ */
+void ct_dispatch_section_enter(struct ct_model* model, struct ct_section* section);
+
+/**
+ * Notifies the listeners that an assertion has failed
+ *
+ * @param[inout] model the model to handle
+ * @param[in] report the report of the failed assertion
+ */
+void ct_dispatch_assert_fail(struct ct_model* model, struct ct_assert_report* report);
+
+/**
+ * Notifies the listeners that a test has ended
+ *
+ * @param[inout] model the model to handle
+ * @param[in] report the report of the test just ended
+ */
+void ct_dispatch_test_end(struct ct_model* model, struct ct_test_report* report);
+
+/**
+ * Notifies the listeners that every @testsuite has been run
+ *
+ * @param[inout] model the model to handle
+ */
+void ct_dispatch_run_end(struct ct_model* model);
+
+/**
+ * Releases from memory a dispatcher
+ *
+ * @param[inout] dispatcher the dispatcher to dispose of
+ */
+void ct_destroy_event_dispatcher(struct ct_event_dispatcher* dispatcher);
+
+#endif /* EVENTS_H_ */
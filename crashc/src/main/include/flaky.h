@@ -0,0 +1,75 @@
+/**
+ * @file
+ *
+ * Module detecting flaky tests by comparing several repetitions of the same test
+ *
+ * When the \c --repeat command line option is greater than 1, every registered @testsuite is run that many times in a row. Each repetition
+ * produces its own struct ct_test_report. Once every repetition has run, the reports of the same test are linked together
+ * (see struct ct_test_report::next_repetition) and compared: a test is **flaky** if its outcome, the status of any of its snapshots or the outcome of any
+ * of its assertions changes between repetitions, or if the test has not been run in every repetition.
+ *
+ * Two reports belong to the same test if they have the same @testcase description and they have been generated by the same loop of such @testcase
+ * (e.g. the reports generated by the second loop of a @testcase with several @when are compared among each other).
+ *
+ * @author koldar
+ * @date Oct 19, 2026
+ */
+
+#ifndef FLAKY_H_
+#define FLAKY_H_
+
+#include <stdbool.h>
+
+#include "typedefs.h"
+
+/**
+ * How a test behaved across all its repetitions
+ */
+struct ct_flakiness {
+	/**
+	 * The number of repetitions where the test has been run
+	 */
+	int runs;
+	/**
+	 * The number of repetitions where the test has failed
+	 */
+	int failed_runs;
+	/**
+	 * @true if the snapshot tree of a repetition differs from the one of the first repetition
+	 */
+	bool snapshots_diverge;
+	/**
+	 * @true if the test is flaky
+	 */
+	bool flaky;
+	/**
+	 * The average time, in microseconds, the test has taken in a repetition
+	 */
+	double elapsed_time_mean;
+	/**
+	 * The variance, in squared microseconds, of the time the test has taken in a repetition
+	 */
+	double elapsed_time_variance;
+};
+
+/**
+ * Links together the reports of the same test and computes, for each test, how it behaved across the repetitions
+ *
+ * The struct ct_flakiness of each test is stored in the report of its first repetition, while struct ct_test_stats::flaky_tests is updated.
+ * Does nothing if struct ct_model::repetitions is not greater than 1.
+ *
+ * @param[inout] model the model to handle
+ */
+void ct_detect_flaky_tests(struct ct_model* model);
+
+/**
+ * Checks if 2 snapshot trees have different statuses or assertion outcomes
+ *
+ * @param[in] a the first snapshot tree
+ * @param[in] b the second snapshot tree
+ * @return @true if the trees have a different shape, if 2 corresponding snapshots have different statuses or if 2 corresponding assertions
+ * 	have different outcomes; @false otherwise
+ */
+bool ct_snapshot_trees_diverge(const struct ct_snapshot* a, const struct ct_snapshot* b);
+
+#endif /* FLAKY_H_ */
@@ -0,0 +1,207 @@
+/**
+ * @file
+ *
+ * Module running a ::FUZZ_TESTCASE over a set of inputs
+ *
+ * A ::FUZZ_TESTCASE can be run in 2 ways:
+ * \li **replay mode**, the default one: the @testcase is run once for every file inside the corpus directory given by the \c --corpus
+ * 	command line option (or once with an empty input if no corpus is given). Files are memory-mapped. If @crashc can use more than one
+ * 	process (see ::ct_get_workers_number), the inputs are first split among several forked processes: each of them sends back the tests of the inputs
+ * 	which passed, while the inputs which failed are run again within the test process, so that their tests are complete. Either way every input
+ * 	ends up in the report, in the same order a single process would have produced. In a distributed run the inputs are not split: the whole
+ * 	::FUZZ_TESTCASE is claimed like a @testcase (see ::ct_fuzz_claim) and run by a single worker;
+ * \li **fuzz mode**, enabled by compiling the tests with ::CT_FUZZER defined: ::TESTS_START and ::TESTS_END generate \c LLVMFuzzerTestOneInput
+ * 	instead of \c main, so the test file can be linked with \c -fsanitize=fuzzer. The model is built by the first call, which registers the
+ * 	@testsuite; every call runs the ::FUZZ_TESTCASE sections (and only them) with the input provided by the fuzzer, then forgets the sections and
+ * 	the tests of that input (see ::ct_fuzz_end_input). The model is released when the fuzzer exits. A failed assertion aborts the process,
+ * 	which is what the fuzzer considers a crash.
+ *
+ * @author koldar
+ * @date Oct 19, 2026
+ */
+
+#ifndef FUZZ_H_
+#define FUZZ_H_
+
+#include <stdio.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "typedefs.h"
+#include "list.h"
+
+/**
+ * A single input of a ::FUZZ_TESTCASE
+ */
+struct ct_fuzz_input {
+	/**
+	 * The file containing the input. @null if the input doesn't come from a file
+	 */
+	char* path;
+	/**
+	 * The bytes of the input
+	 *
+	 * @notnull
+	 */
+	const uint8_t* data;
+	/**
+	 * The number of bytes inside struct ct_fuzz_input::data
+	 */
+	size_t size;
+	/**
+	 * @true if struct ct_fuzz_input::data has been memory-mapped from struct ct_fuzz_input::path
+	 */
+	bool mapped;
+};
+
+/**
+ * The inputs a running ::FUZZ_TESTCASE iterates over
+ */
+struct ct_fuzz_corpus {
+	/**
+	 * Every input of the corpus, sorted by path
+	 */
+	struct ct_fuzz_input* inputs;
+	/**
+	 * The number of cells inside struct ct_fuzz_corpus::inputs
+	 */
+	int inputs_number;
+	/**
+	 * The indexes of the inputs the current process needs to run
+	 */
+	int* selected;
+	/**
+	 * The number of cells inside struct ct_fuzz_corpus::selected
+	 */
+	int selected_number;
+	/**
+	 * The position, inside struct ct_fuzz_corpus::selected, of the input running right now
+	 */
+	int current;
+	/**
+	 * For each input, @true if the input failed in a worker process
+	 *
+	 * Shared among the test process and every worker process. @null if no worker process has been forked
+	 */
+	bool* failed;
+	/**
+	 * @true if the current process is a worker process forked by ::ct_fuzz_start
+	 */
+	bool worker;
+	/**
+	 * The number of test reports there were before the current input started
+	 */
+	int reports_before_input;
+	/**
+	 * In a worker process, the stream sending back to the test process the tests of the inputs which passed. @null otherwise
+	 */
+	FILE* channel;
+	/**
+	 * In the test process, for each input, the tests a worker process has sent back for it, or @null if it has sent nothing.
+	 * @null if no worker process has been forked
+	 */
+	ct_list_o** received;
+	/**
+	 * The first input whose tests in struct ct_fuzz_corpus::received haven't been added to struct ct_model::test_reports_list yet
+	 */
+	int next_received;
+	/**
+	 * In a distributed run, the section of the first input, the one claimed to the coordinator. @null until it has been claimed
+	 */
+	const struct ct_section* claimed_testcase;
+};
+
+/**
+ * Tells @crashc the tests are driven by a fuzzer which provides the given input
+ *
+ * Called by ::TESTS_START when ::CT_FUZZER is defined.
+ *
+ * @param[inout] model the model to handle
+ * @param[in] data the bytes of the input
+ * @param[in] size the number of bytes inside \c data
+ */
+void ct_set_fuzz_input(struct ct_model* model, const uint8_t* data, size_t size);
+
+/**
+ * Forgets the sections and the tests of the input provided by the fuzzer
+ *
+ * Called by ::TESTS_END when ::CT_FUZZER is defined, so that the model can be used with the next input. What has been configured
+ * while registering the @testsuite is kept (see ::ct_reset_tests).
+ *
+ * @param[inout] model the model to handle
+ */
+void ct_fuzz_end_input(struct ct_model* model);
+
+/**
+ * Releases from memory the model used by a fuzzer
+ *
+ * Registered with \c atexit by ::TESTS_END when ::CT_FUZZER is defined, since a fuzzer terminates the process instead of returning.
+ * The function set with ::ct_set_crashc_teardown is run first.
+ */
+void ct_fuzz_teardown();
+
+/**
+ * Checks if the tests are driven by a fuzzer
+ *
+ * @param[in] model the model to handle
+ * @return @true if @crashc is in fuzz mode, @false if it's in replay mode
+ */
+bool ct_is_fuzzing(const struct ct_model* model);
+
+/**
+ * Loads the inputs of a ::FUZZ_TESTCASE and returns the first one to run in this process
+ *
+ * If the inputs are split among worker processes, the function returns in the worker processes as well and waits for them in the test process.
+ * The tests the worker processes send back are added to the model by ::ct_fuzz_next, in the order of their inputs.
+ *
+ * @param[inout] model the model to handle
+ * @return the first input to run or @null if there is no input to run
+ */
+struct ct_fuzz_input* ct_fuzz_start(struct ct_model* model);
+
+/**
+ * Returns the next input of a ::FUZZ_TESTCASE to run in this process
+ *
+ * In a worker process, the tests of the input just run are sent back to the test process if they have all passed. When a worker process
+ * has no input left, the function terminates it.
+ *
+ * @param[inout] model the model to handle
+ * @return the next input to run or @null if every input has been run. In the latter case the inputs are released from memory
+ */
+struct ct_fuzz_input* ct_fuzz_next(struct ct_model* model);
+
+/**
+ * Claims the ::FUZZ_TESTCASE being run to the coordinator of a distributed run
+ *
+ * Only the section of the first input is claimed: the tests of every input are sent to the coordinator together, once the last input has been run.
+ * Nothing is claimed if the run is not distributed.
+ *
+ * \pre
+ * 	\li struct ct_model::current_section is the section of the ::FUZZ_TESTCASE, just fetched for the current input
+ * \post
+ * 	\li if another worker has claimed the ::FUZZ_TESTCASE, its section is skipped and no other input is run
+ *
+ * @param[inout] model the model to handle
+ * @return @true if the current input needs to be run, @false otherwise
+ */
+bool ct_fuzz_claim(struct ct_model* model);
+
+/**
+ * Stores in a test report the file containing the input the running ::FUZZ_TESTCASE is using
+ *
+ * Does nothing if no ::FUZZ_TESTCASE is running or if its input doesn't come from a file
+ *
+ * @param[in] model the model to handle
+ * @param[inout] report the report of the test which is starting
+ */
+void ct_fuzz_update_test_report(struct ct_model* model, struct ct_test_report* report);
+
+/**
+ * Releases from memory the inputs of a ::FUZZ_TESTCASE
+ *
+ * @param[inout] corpus the corpus to dispose of
+ */
+void ct_destroy_fuzz_corpus(struct ct_fuzz_corpus* corpus);
+
+#endif /* FUZZ_H_ */
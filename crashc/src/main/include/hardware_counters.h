@@ -0,0 +1,170 @@
+/**
+ * @file
+ *
+ * Module reading the hardware performance counters of the CPU while a @containablesection runs
+ *
+ * Counters are opened as a single group via \c perf_event_open, so they are all scheduled on the PMU at the same time and their values
+ * are consistent with each other. Only user space events of the test process are counted.
+ *
+ * Counters may be unavailable: the kernel may forbid them (see \c /proc/sys/kernel/perf_event_paranoid), the program may run inside a
+ * container or a virtual machine which does not expose the PMU, or the operating system may not be Linux at all. In all those cases
+ * @crashc keeps working and measures only the elapsed time of each section. A counter the CPU does not support is excluded from the group,
+ * while the other ones keep working.
+ *
+ * You can disable the counters altogether by defining ::CT_HARDWARE_COUNTERS_ENABLED to 0.
+ *
+ * @author koldar
+ * @date Oct 19, 2026
+ */
+
+#ifndef HARDWARE_COUNTERS_H_
+#define HARDWARE_COUNTERS_H_
+
+#include <stdbool.h>
+
+/**
+ * 1 if @crashc should try to open the hardware performance counters, 0 otherwise
+ */
+#ifndef CT_HARDWARE_COUNTERS_ENABLED
+#	define CT_HARDWARE_COUNTERS_ENABLED 1
+#endif
+
+/**
+ * Value of a counter which could not be measured
+ */
+#define CT_HARDWARE_COUNTER_UNAVAILABLE -1
+
+/**
+ * The hardware events @crashc counts
+ *
+ * The values are indexes of struct ct_hardware_counters_group::fds
+ */
+enum ct_hardware_event {
+	CT_HW_INSTRUCTIONS,
+	CT_HW_CYCLES,
+	CT_HW_CACHE_MISSES,
+	CT_HW_BRANCH_MISSES,
+	/**
+	 * Not an event: the number of events in this enumeration
+	 */
+	CT_HW_EVENTS_NUMBER
+};
+
+/**
+ * The values of the hardware counters
+ *
+ * Depending on the context, the structure represents either the values the counters have right now (a sample)
+ * or the events happened in a given period of time (a delta). See ::ct_begin_hardware_counters and ::ct_end_hardware_counters.
+ * Every counter which could not be measured is set to ::CT_HARDWARE_COUNTER_UNAVAILABLE
+ */
+struct ct_hardware_counters {
+	/**
+	 * Instructions retired
+	 */
+	long long instructions;
+	/**
+	 * CPU cycles
+	 */
+	long long cycles;
+	/**
+	 * Cache accesses which missed the last level cache
+	 */
+	long long cache_misses;
+	/**
+	 * Mispredicted branch instructions
+	 */
+	long long branch_misses;
+};
+
+/**
+ * The group of hardware counters opened by @crashc
+ */
+struct ct_hardware_counters_group {
+	/**
+	 * @true if at least one counter has been opened, @false otherwise
+	 *
+	 * If @false, every operation on the group does nothing
+	 */
+	bool available;
+	/**
+	 * The file descriptor of the leader of the group, namely the first counter successfully opened
+	 *
+	 * -1 if the group is not available
+	 */
+	int leader_fd;
+	/**
+	 * The file descriptor of every counter, indexed by ::ct_hardware_event
+	 *
+	 * -1 if the specific counter could not be opened
+	 */
+	int fds[CT_HW_EVENTS_NUMBER];
+	/**
+	 * The position of every counter within the values returned by reading the group, indexed by ::ct_hardware_event
+	 *
+	 * -1 if the specific counter could not be opened
+	 */
+	int positions[CT_HW_EVENTS_NUMBER];
+	/**
+	 * The number of counters successfully opened
+	 */
+	int size;
+};
+
+/**
+ * Opens the hardware counters group, initially disabled
+ *
+ * \note
+ * Never fails: if the counters can't be opened, the returned group is simply not available
+ *
+ * @return the group of counters
+ */
+struct ct_hardware_counters_group* ct_init_hardware_counters_group();
+
+/**
+ * Closes the hardware counters and releases the group from memory
+ *
+ * @param[inout] group the group to dispose of
+ */
+void ct_destroy_hardware_counters_group(struct ct_hardware_counters_group* group);
+
+/**
+ * Starts counting the hardware events
+ *
+ * @param[inout] group the group to enable
+ */
+void ct_hardware_counters_enable(struct ct_hardware_counters_group* group);
+
+/**
+ * Stops counting the hardware events
+ *
+ * @param[inout] group the group to disable
+ */
+void ct_hardware_counters_disable(struct ct_hardware_counters_group* group);
+
+/**
+ * Reads the current values of the hardware counters
+ *
+ * @param[in] group the group to read
+ * @param[out] counters where to store the values
+ * @return @true if the counters have been read, @false otherwise. In the latter case every counter is set to ::CT_HARDWARE_COUNTER_UNAVAILABLE
+ */
+bool ct_read_hardware_counters(const struct ct_hardware_counters_group* group, struct ct_hardware_counters* counters);
+
+/**
+ * Starts measuring the hardware events happening from now on
+ *
+ * @param[in] group the group to read
+ * @param[out] counters the structure which will contain the measurement. After this call it holds a sample
+ */
+void ct_begin_hardware_counters(const struct ct_hardware_counters_group* group, struct ct_hardware_counters* counters);
+
+/**
+ * Stops measuring the hardware events
+ *
+ * @param[in] group the group to read
+ * @param[inout] counters a structure initialized with ::ct_begin_hardware_counters. After this call it holds the events happened between
+ * 	::ct_begin_hardware_counters and this call
+ */
+void ct_end_hardware_counters(const struct ct_hardware_counters_group* group, struct ct_hardware_counters* counters);
+
+#endif /* HARDWARE_COUNTERS_H_ */
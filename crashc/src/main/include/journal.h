@@ -0,0 +1,144 @@
+/**
+ * @file
+ *
+ * A journal of the tests, written while they run, which survives the death of the test process
+ *
+ * The report of a run is produced only when every test has ended: if the process is killed before (e.g. by the OOM killer or by a timeout of
+ * the continuous integration), nothing is left. When a journal is given with the \c --journal command line option, every test is appended to it as soon as it ends.
+ * The journal is opened with \c O_APPEND and every record is written with a single \c write, so a killed process leaves at most its last record truncated.
+ * The journal is flushed to the disk with \c fdatasync at most once every ::CT_JOURNAL_SYNC_PERIOD microseconds.
+ *
+ * The journal is a text file, one record per line:
+ * \li <tt>R</tt>: an invocation of the test program starts;
+ * \li <tt>T key occurrence outcome repetition time path</tt>: a test has ended. \c key and \c occurrence identify its @testcase (see below),
+ * 	\c outcome is either \c S (passed) or \c F (failed), \c time is in microseconds and \c path contains the descriptions of the @testcase and of the @when
+ * 	sections the test entered, separated by ::CT_SECTION_PATH_SEPARATOR;
+ * \li <tt>D key occurrence</tt>: every test of a @testcase has ended.
+ *
+ * A @testcase is identified by the hexadecimal struct ct_section::path_hash of its section and by how many @testcase with the same path have been met before
+ * in the same invocation (see ::ct_get_testcase_key).
+ *
+ * When the test program is invoked again with \c --resume, the @testcase completed in the journal are skipped and the new tests are appended to the same journal.
+ * A @testcase is skipped only if all its tests have ended: the tests of a @testcase interrupted by the death of the process are run again.
+ * Since a skipped @testcase doesn't appear in the report of the resumed invocation, the summary of the whole run is rebuilt from the journal with
+ * <tt>crashc-report --journal</tt>. Resuming is meaningful only if the tests and the command line options selecting them haven't changed.
+ *
+ * @author koldar
+ * @date Oct 19, 2026
+ */
+
+#ifndef JOURNAL_H_
+#define JOURNAL_H_
+
+#include <stdbool.h>
+#include <time.h>
+
+#include "typedefs.h"
+#include "hashtable.h"
+#include "section.h"
+
+/**
+ * The maximum time, in microseconds, a record can stay in the journal without being flushed to the disk
+ */
+#ifndef CT_JOURNAL_SYNC_PERIOD
+#	define CT_JOURNAL_SYNC_PERIOD 1000000
+#endif
+
+/**
+ * The maximum size of a record of the journal. Longer paths are truncated
+ */
+#ifndef CT_JOURNAL_RECORD_SIZE
+#	define CT_JOURNAL_RECORD_SIZE 1024
+#endif
+
+/**
+ * The state of the journal
+ */
+struct ct_journal {
+	/**
+	 * The file descriptor of the journal, opened in append mode
+	 */
+	int file;
+	/**
+	 * The @testcase completed by the previous invocations, indexed by ::ct_testcase_key_hash. Each value is a struct ct_testcase_key
+	 */
+	ct_hashtable_o* completed_testcases;
+	/**
+	 * The @testcase running right now. @null before the first one
+	 */
+	const struct ct_section* testcase;
+	/**
+	 * @true if struct ct_journal::testcase has been completed by a previous invocation
+	 */
+	bool completed;
+	/**
+	 * The number of @testcase skipped because completed by the previous invocations
+	 */
+	int skipped_testcases;
+	/**
+	 * When the journal has been flushed to the disk for the last time
+	 */
+	struct timespec last_sync;
+	/**
+	 * @true if some records have been written after struct ct_journal::last_sync
+	 */
+	bool dirty;
+};
+
+/**
+ * Opens a journal and subscribes the listener writing the tests into it
+ *
+ * \post
+ * 	\li struct ct_model::journal is set to the journal
+ *
+ * @param[inout] model the model to handle
+ * @param[in] path the file of the journal
+ * @param[in] resume @true to keep the content of the journal and skip the @testcase it has completed, @false to empty it
+ * @return the state of the journal
+ */
+struct ct_journal* ct_enable_journal(struct ct_model* model, const char* path, bool resume);
+
+/**
+ * Checks whether a @testcase has been completed by a previous invocation
+ *
+ * The function needs to be called every time access to a @testcase is requested: the first call for a @testcase makes it the running one.
+ *
+ * @param[inout] model the model whose struct ct_model::journal needs to be handled
+ * @param[in] testcase the section of the @testcase
+ * @return @true if \c testcase needs to be skipped, @false otherwise
+ */
+bool ct_journal_testcase_completed(struct ct_model* model, const struct ct_section* testcase);
+
+/**
+ * Records that every test of a @testcase has ended
+ *
+ * @param[inout] model the model whose struct ct_model::journal needs to be handled
+ * @param[in] testcase the section of the @testcase. Nothing is done if it's not the running one, as it happens with a ::FUZZ_TESTCASE
+ */
+void ct_journal_end_testcase(struct ct_model* model, const struct ct_section* testcase);
+
+/**
+ * Checks whether a previous invocation has completed the @testcase with a given key
+ *
+ * @param[in] journal the journal to handle
+ * @param[in] key the key of the @testcase
+ * @return @true if the @testcase has been completed, @false otherwise
+ */
+bool ct_journal_key_completed(const struct ct_journal* journal, const struct ct_testcase_key* key);
+
+/**
+ * Records that every test of the @testcase with a given key has ended
+ *
+ * @param[inout] journal the journal to handle
+ * @param[in] key the key of the @testcase
+ */
+void ct_journal_complete_key(struct ct_journal* journal, const struct ct_testcase_key* key);
+
+/**
+ * Flushes the journal to the disk and releases it from memory
+ *
+ * @param[inout] journal the journal to dispose of
+ */
+void ct_destroy_journal(struct ct_journal* journal);
+
+#endif /* JOURNAL_H_ */
@@ -126,6 +126,30 @@ bool ct_list_is_empty(const ct_list_o* l);
  */
 void* ct_list_pop(ct_list_o* l);
 
+/**
+ * Get and remove the tail from the list \c l
+ *
+ * The operation take \f$O(n)\f$ time, since the list is singly linked
+ *
+ * @param[inout] l the involved list
+ * @return
+ * 	\li The payload at the tail of the list;
+ * 	\li @null Wheter the list is empty;
+ */
+void* ct_list_pop_tail(ct_list_o* l);
+
+/**
+ * Replaces the payload at the tail of the list \c l
+ *
+ * \pre
+ * 	\li \c l is not empty
+ *
+ * @param[inout] l the involved list
+ * @param[in] el the new payload of the tail
+ * @return the payload previously at the tail of the list
+ */
+void* ct_list_replace_tail(ct_list_o* l, const void* el);
+
 /**
  * Fetch the head of the list
  *
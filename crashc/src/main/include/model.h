@@ -16,11 +16,17 @@
 
 #include <signal.h>
 #include <setjmp.h>
+#include <stdbool.h>
+#include <pthread.h>
 
 #include "typedefs.h"
 #include "section.h"
 #include "report_producer.h"
 #include "list.h"
+#include "allocation_tracker.h"
+#include "thread_context.h"
+#include "fuzz.h"
+#include "suite_order.h"
 
 /**
  * The maximum number of registrable suites
@@ -31,6 +37,29 @@
 #   define MAX_TESTS 256
 #endif
 
+/**
+ * The number of fatal signals @crashc intercepts while running tests
+ *
+ * @see ct_register_signal_handlers
+ */
+#define CT_HANDLED_SIGNALS_NUMBER 5
+
+/**
+ * The maximum number of stack frames captured when a test raises a fatal signal
+ *
+ * Set it to 0 to disable backtrace capturing altogether
+ */
+#ifndef CT_BACKTRACE_SIZE
+#	define CT_BACKTRACE_SIZE 64
+#endif
+
+/**
+ * The number of innermost frames which belong to the signal delivery itself rather than to the code under test
+ *
+ * These are the @crashc signal handler and the kernel signal trampoline
+ */
+#define CT_BACKTRACE_SKIPPED_FRAMES 2
+
 /**
  * A collection of required variables used by a run of @crashc to soundly operate
  *
@@ -42,6 +71,22 @@ struct ct_model {
 	 * Array containing the pointers to the testsuites functions
 	 */
 	ct_test_c tests_array[MAX_TESTS];
+	/**
+	 * For each cell of struct ct_model::tests_array, the id of the @testsuite
+	 */
+	const char* suites_names[MAX_TESTS];
+	/**
+	 * The indexes of the cells of struct ct_model::tests_array, in the order the @testsuite are run. See suite_order.h
+	 */
+	int suites_order[MAX_TESTS];
+	/**
+	 * The index, in struct ct_model::tests_array, of the running @testsuite
+	 */
+	int current_suite;
+	/**
+	 * How struct ct_model::suites_order is sorted
+	 */
+	enum ct_suite_order suite_order;
 	/**
 	 * The pointer to the global teardown function
 	 *
@@ -75,6 +120,14 @@ struct ct_model {
 	 * @ref section_tree
 	 */
 	struct ct_section* root_section;
+	/**
+	 * The site of struct ct_model::root_section, which doesn't come from any @containablesection
+	 */
+	struct ct_section_site root_site;
+	/**
+	 * The head of the list of the sites prepared so far. See ::ct_section_site_prepare
+	 */
+	struct ct_section_site* prepared_sites;
 	/**
 	 * Represents the @containablesection we're analyzing right now in a given time when we're running test code.
 	 *
@@ -137,14 +190,85 @@ struct ct_model {
 	 * By faulty test we mean tests which generate the following scenarios:
 	 * \li some signal is detected (i.e. SIGSEGV or SIGFPE);
 	 * \li an assertion failed;
+	 *
+	 * Only ct_model::main_thread can jump here: worker threads jump to their own struct ct_thread_context::jump_point.
 	 */
 	jmp_buf jump_point;
+	/**
+	 * The thread running the tests
+	 *
+	 * It's the only thread which can read or write ct_model::current_section, ct_model::current_snapshot and ct_model::jump_point.
+	 * See thread_context.h
+	 */
+	pthread_t main_thread;
+	/**
+	 * Lock-free stack containing the assertions performed by worker threads which have not been merged into a snapshot yet
+	 *
+	 * @see ct_merge_thread_reports
+	 */
+	struct ct_thread_assert_report* thread_assert_reports;
+	/**
+	 * The first fatal signal raised on a worker thread which has not been merged into a snapshot yet
+	 *
+	 * 0 if no signal has been raised, -1 while a worker thread is recording the signal
+	 */
+	int thread_signal_detected;
+	/**
+	 * The \c si_code of ct_model::thread_signal_detected
+	 */
+	int thread_signal_code;
+	/**
+	 * The faulting address of ct_model::thread_signal_detected
+	 */
+	void* thread_signal_address;
 	/**
 	 * Represents the sigaction flag required for intercepting signals
 	 *
 	 * @see struct ct_model::jump_point
 	 */
 	struct sigaction _crashc_sigaction;
+	/**
+	 * The alternate stack the signal handler of @crashc runs on
+	 *
+	 * A stack overflow inside the code under test leaves no room on the regular stack to run any handler at all.
+	 * Running ::ct_register_signal_handlers handler on its own preallocated stack allows @crashc to detect
+	 * even such faults.
+	 *
+	 * The field \c ss_sp is @null if no alternate stack has been installed yet.
+	 */
+	stack_t signal_stack;
+	/**
+	 * The actions which were associated to each fatal signal before @crashc registered its own handlers.
+	 *
+	 * The i-th cell is meaningful only if the i-th cell of ct_model::signal_handler_installed is @true.
+	 * These are restored by ::ct_unregister_signal_handlers
+	 */
+	struct sigaction previous_sigactions[CT_HANDLED_SIGNALS_NUMBER];
+	/**
+	 * Tells, for each fatal signal, if @crashc has registered its own handler
+	 *
+	 * @crashc won't register a handler for a signal if the program under test has already installed one for it.
+	 */
+	bool signal_handler_installed[CT_HANDLED_SIGNALS_NUMBER];
+	/**
+	 * Buffer where the signal handler stores the backtrace of the code which raised a fatal signal
+	 *
+	 * The signal handler can't safely allocate memory, hence the backtrace is first captured here and then
+	 * copied into the snapshot after we have jumped back to ct_model::jump_point.
+	 * Only the first ct_model::backtrace_buffer_size cells are meaningful. The first ::CT_BACKTRACE_SKIPPED_FRAMES
+	 * cells are never attached to the snapshot
+	 */
+	void* backtrace_buffer[CT_BACKTRACE_SIZE + CT_BACKTRACE_SKIPPED_FRAMES];
+	/**
+	 * The number of frames inside ct_model::backtrace_buffer
+	 */
+	int backtrace_buffer_size;
+	/**
+	 * The snapshot which was running when the last fatal signal has been detected
+	 *
+	 * @null if the backtrace inside ct_model::backtrace_buffer has already been attached to its snapshot
+	 */
+	struct ct_snapshot* signaled_snapshot;
 	/**
 	 * contains severla  statistical informations about the tests.
 	 *
@@ -164,6 +288,195 @@ struct ct_model {
 	 * The file where to write the report on
 	 */
 	FILE* output_file;
+	/**
+	 * Counts the memory allocated by the code under test
+	 *
+	 * @notnull
+	 */
+	struct ct_allocation_tracker* allocation_tracker;
+
+	/**
+	 * @true if every snapshot measures the operating system resources consumed by its section, @false otherwise
+	 *
+	 * Off by default: the resources are sampled twice per snapshot and printed for each of them
+	 */
+	bool measure_resources;
+
+	/**
+	 * The hardware performance counters measuring every snapshot
+	 *
+	 * @null unless the counters have been requested with \c --hardware_counters: only the elapsed time of the snapshots is measured then.
+	 * The group may not be available either: in that case the counters of the snapshots are marked as unavailable
+	 */
+	struct ct_hardware_counters_group* hardware_counters;
+
+	/**
+	 * The number of seeds to explore for every ::STRESS section
+	 *
+	 * If 0, the threads of a stress test run in parallel without any scheduler. See schedule.h
+	 */
+	long schedule_seeds;
+	/**
+	 * A seed to replay for every ::STRESS section. -1 if no seed has to be replayed
+	 *
+	 * If set, ct_model::schedule_seeds is ignored
+	 */
+	long schedule_replay_seed;
+	/**
+	 * The maximum number of processes @crashc can fork to run something in parallel. If not positive, the number of online CPUs is used
+	 *
+	 * See ::ct_get_workers_number
+	 */
+	int workers;
+
+	/**
+	 * The directory containing the inputs of every ::FUZZ_TESTCASE in replay mode. @null if no corpus has been given
+	 */
+	const char* corpus_path;
+	/**
+	 * The input provided by the fuzzer in fuzz mode. @null in replay mode
+	 *
+	 * See fuzz.h
+	 */
+	struct ct_fuzz_input* fuzzer_input;
+	/**
+	 * The inputs of the ::FUZZ_TESTCASE running right now. @null if no ::FUZZ_TESTCASE is running
+	 */
+	struct ct_fuzz_corpus* fuzz_corpus;
+	/**
+	 * The memory of the tests the fuzzing worker processes have sent back which doesn't belong to the tests themselves.
+	 * @null until a ::FUZZ_TESTCASE splits its inputs among worker processes
+	 */
+	struct ct_report_arena* fuzz_arena;
+
+	/**
+	 * The number of times every @testsuite is run. Greater than 1 to detect flaky tests (see flaky.h)
+	 */
+	int repetitions;
+	/**
+	 * The repetition running right now, starting from 0
+	 */
+	int repetition;
+
+	/**
+	 * The file where the binary event log of the run is written (see binary_report.h). @null to produce the textual report
+	 */
+	char* binary_report_path;
+
+	/**
+	 * The listeners notified while the tests are running (see events.h)
+	 */
+	struct ct_event_dispatcher* event_dispatcher;
+	/**
+	 * @true if the progress of the run needs to be shown on the terminal
+	 */
+	bool show_progress;
+	/**
+	 * The file containing the timings of the previous run (see progress.h). @null if there is no such file
+	 */
+	char* history_path;
+	/**
+	 * The state of the progress listener. @null if the listener is not subscribed
+	 */
+	struct ct_progress* progress;
+
+	/**
+	 * Every section created so far, indexed by struct ct_section::path_hash. If several sections have the same path, only the first one is indexed
+	 */
+	ct_hashtable_o* section_index;
+	/**
+	 * How many @testcase with a given path have been met so far, indexed by struct ct_section::path_hash. Each value is a struct ct_testcase_key
+	 */
+	ct_hashtable_o* testcase_occurrences;
+	/**
+	 * The last @testcase passed to ::ct_get_testcase_key. @null before the first call
+	 */
+	const struct ct_section* keyed_testcase;
+	/**
+	 * The key of struct ct_model::keyed_testcase
+	 */
+	struct ct_testcase_key testcase_key;
+	/**
+	 * The path of the section selected with ::ct_select_section_path. @null if every section is run
+	 */
+	const char* selected_section_path;
+	/**
+	 * The hashes of the paths of the selected section and of its ancestors. Each value is the level of the section with such path
+	 */
+	ct_hashtable_o* selected_path_prefixes;
+	/**
+	 * The level of the selected section in the section tree
+	 */
+	int selected_path_level;
+
+	/**
+	 * The state of the mode running every @when in a forked process (see section_fork.h). @null if the mode is disabled
+	 */
+	struct ct_section_fork* section_fork;
+	/**
+	 * The state of the capture of the output of the tests (see output_capture.h). @null if the output is not captured
+	 */
+	struct ct_output_capture* output_capture;
+
+	/**
+	 * The file where the tests are appended as soon as they end (see journal.h). @null if there is no journal
+	 */
+	char* journal_path;
+	/**
+	 * @true if the @testcase completed in struct ct_model::journal_path by a previous invocation need to be skipped
+	 */
+	bool resume;
+	/**
+	 * The state of the journal. @null if there is no journal
+	 */
+	struct ct_journal* journal;
+
+	/**
+	 * The address the coordinator serves the @testcase on (see distribution.h). @null if this process is not a coordinator
+	 */
+	char* coordinator_address;
+	/**
+	 * The address of the coordinator this process runs the @testcase for. @null if this process is not a remote worker
+	 */
+	char* worker_address;
+	/**
+	 * The state of the distribution of the @testcase. @null until ::ct_distribute sets it up, or if the @testcase are not distributed
+	 */
+	struct ct_distribution* distribution;
+
+	/**
+	 * The index of the files covered by the @testcase (see coverage.h). @null if the coverage is not used
+	 */
+	char* coverage_index_path;
+	/**
+	 * @true if the coverage of the @testcase needs to be collected into struct ct_model::coverage_index_path
+	 */
+	bool collect_coverage;
+	/**
+	 * The file listing the changed files, used to select the @testcase with struct ct_model::coverage_index_path. @null to run every @testcase
+	 */
+	char* changed_files_path;
+	/**
+	 * The state of the coverage. @null if the coverage is not used
+	 */
+	struct ct_coverage* coverage;
+
+	/**
+	 * The directory where the curves of the benchmarks are written (see benchmark.h). @null if the curves are not written
+	 */
+	char* benchmark_output;
+	/**
+	 * The state of the benchmark running right now. @null if no benchmark is running
+	 */
+	struct ct_benchmark* benchmark;
+	/**
+	 * The CPU the benchmarks are pinned to. -1 if they are not pinned
+	 */
+	int benchmark_cpu;
+	/**
+	 * @true if the benchmarks are measured with a cold cache, @false if with a warm one
+	 */
+	bool benchmark_cold_cache;
 };
 
 /**
@@ -173,6 +486,72 @@ struct ct_model {
  */
 struct ct_model* ct_setup_default_model();
 
+/**
+ * Computes how many processes @crashc can fork to run something in parallel
+ *
+ * @param[in] model the model to handle
+ * @return struct ct_model::workers if positive, the number of online CPUs otherwise. Always at least 1
+ */
+int ct_get_workers_number(const struct ct_model* model);
+
+/**
+ * Computes the key identifying a @testcase in every process running the same tests
+ *
+ * The @testcase need to be passed in the order they are run: the first call for a @testcase counts it among the ones with the same path.
+ *
+ * @param[inout] model the model to handle
+ * @param[in] testcase the section of the @testcase
+ * @return the key of \c testcase, valid until the function is called for another @testcase
+ */
+const struct ct_testcase_key* ct_get_testcase_key(struct ct_model* model, const struct ct_section* testcase);
+
+/**
+ * Runs only a section, its ancestors and its descendants
+ *
+ * Every other section is skipped before any code inside it is run, just like a section excluded by its tags.
+ *
+ * @param[inout] model the model to handle
+ * @param[in] path the descriptions of the section and of its ancestors, starting from the @testcase, separated by ::CT_SECTION_PATH_SEPARATOR.
+ * 	For example <tt>"list/adding on tail/size increments"</tt>
+ */
+void ct_select_section_path(struct ct_model* model, const char* path);
+
+/**
+ * Adds a section just created to struct ct_model::section_index and decides whether it's on the path of the selected section
+ *
+ * \pre
+ * 	\li the parent of \c section has already been indexed
+ *
+ * @param[inout] model the model to handle
+ * @param[inout] section the section to index
+ */
+void ct_index_section(struct ct_model* model, struct ct_section* section);
+
+/**
+ * Fetches a section from its path
+ *
+ * The lookup usually takes constant time: the section tree is walked only if a section with another path but the same hash has been
+ * indexed first. Only sections already created can be found.
+ *
+ * @param[in] model the model to handle
+ * @param[in] path the path of the section. See ::ct_select_section_path
+ * @return the first section created with such path, or @null if there is none
+ */
+struct ct_section* ct_find_section(const struct ct_model* model, const char* path);
+
+/**
+ * Forgets the tests run so far: their reports are destroyed and the section tree is rebuilt from an empty root
+ *
+ * Without it every @testcase run adds a child to the root, so the sections run later take longer to be fetched.
+ * What has been configured in the model, like the registered @testsuite and the tags, is kept.
+ *
+ * \pre
+ * 	\li no section is being run
+ *
+ * @param[inout] model the model to handle
+ */
+void ct_reset_tests(struct ct_model* model);
+
 /**
  * Destroy every memory allocated by the model
  *
@@ -0,0 +1,138 @@
+/**
+ * @file
+ *
+ * Captures what the tests write on the standard output and on the standard error
+ *
+ * When the capture is enabled with the \c --capture_output command line option, the file descriptors 1 and 2 of every test are redirected
+ * into an in-memory file. When the test ends, the descriptors are restored: if the test has failed, what it has written
+ * is attached to its ::ct_test_report, otherwise it's thrown away. In this way the output of the tests doesn't interleave with the reports
+ * and a terminal doesn't slow down a test printing a lot.
+ *
+ * Only the last ::CT_CAPTURED_OUTPUT_SIZE bytes written by a failed test are kept. Whenever a section is entered, the bytes older than those
+ * are released if the in-memory file holds more than ::CT_CAPTURED_OUTPUT_LIMIT of them, so a test printing a lot doesn't fill the memory.
+ * The progress line is drawn on a duplicate of the original standard error (see ::ct_output_capture_get_original_stderr), which is never captured.
+ *
+ * @author koldar
+ * @date Oct 19, 2026
+ */
+
+#ifndef OUTPUT_CAPTURE_H_
+#define OUTPUT_CAPTURE_H_
+
+#include <stdbool.h>
+#include <stdio.h>
+
+#include "typedefs.h"
+
+/**
+ * The maximum number of bytes of output attached to a failed test. Older bytes are dropped
+ */
+#ifndef CT_CAPTURED_OUTPUT_SIZE
+#	define CT_CAPTURED_OUTPUT_SIZE 65536
+#endif
+
+/**
+ * The number of bytes the in-memory file can hold before the ones older than the last ::CT_CAPTURED_OUTPUT_SIZE are released
+ */
+#ifndef CT_CAPTURED_OUTPUT_LIMIT
+#	define CT_CAPTURED_OUTPUT_LIMIT (4 * CT_CAPTURED_OUTPUT_SIZE)
+#endif
+
+/**
+ * The state of the capture of the output
+ */
+struct ct_output_capture {
+	/**
+	 * The in-memory file receiving the output of the running test
+	 */
+	int file;
+	/**
+	 * A duplicate of the standard output of the process
+	 */
+	int saved_stdout;
+	/**
+	 * A duplicate of the standard error of the process
+	 */
+	int saved_stderr;
+	/**
+	 * A stream writing on the original standard error even while the capture is running. @null until it's requested
+	 */
+	FILE* original_stderr;
+	/**
+	 * The offset of struct ct_output_capture::file before which the bytes have been released
+	 */
+	long released_bytes;
+	/**
+	 * @true if the descriptors 1 and 2 are currently redirected into struct ct_output_capture::file
+	 */
+	bool active;
+};
+
+/**
+ * Creates the state of the capture
+ *
+ * @return the state just created
+ */
+struct ct_output_capture* ct_init_output_capture();
+
+/**
+ * Redirects the standard output and the standard error into an empty in-memory file
+ *
+ * @param[inout] capture the capture to start
+ */
+void ct_output_capture_start(struct ct_output_capture* capture);
+
+/**
+ * Restores the standard output and the standard error
+ *
+ * The function can be called after a \c siglongjmp out of the test: nothing is done if the capture is not running.
+ *
+ * @param[inout] capture the capture to stop
+ * @param[inout] report the test which has just ended. If it has failed, its struct ct_test_report::output is set to what the test has written
+ */
+void ct_output_capture_stop(struct ct_output_capture* capture, struct ct_test_report* report);
+
+/**
+ * Fetches how much the running test has written so far
+ *
+ * @param[in] capture the capture to check
+ * @return the size of the output of the running test. -1 if the capture is not running
+ */
+long ct_output_capture_mark(const struct ct_output_capture* capture);
+
+/**
+ * Throws away what the running test has written after a call of ::ct_output_capture_mark
+ *
+ * Used when a @when has been run by a forked process sharing the same in-memory file: the output of the forked process belongs to its tests only.
+ *
+ * @param[inout] capture the capture to handle
+ * @param[in] mark the value returned by ::ct_output_capture_mark
+ */
+void ct_output_capture_rewind(struct ct_output_capture* capture, long mark);
+
+/**
+ * Releases the bytes written by the running test which would not be attached to its report anyway
+ *
+ * Nothing is done unless the in-memory file holds more than ::CT_CAPTURED_OUTPUT_LIMIT bytes. The size of the file doesn't change,
+ * so the values returned by ::ct_output_capture_mark stay valid.
+ *
+ * @param[inout] capture the capture to handle
+ */
+void ct_output_capture_trim(struct ct_output_capture* capture);
+
+/**
+ * Fetches a stream writing on the standard error the process had before any capture
+ *
+ * @param[inout] capture the capture to handle
+ * @return a stream which is never captured, released together with \c capture. @null if it can't be opened
+ */
+FILE* ct_output_capture_get_original_stderr(struct ct_output_capture* capture);
+
+/**
+ * Releases from memory the state of the capture
+ *
+ * @param[inout] capture the state to dispose of
+ */
+void ct_destroy_output_capture(struct ct_output_capture* capture);
+
+#endif /* OUTPUT_CAPTURE_H_ */
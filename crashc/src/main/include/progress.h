@@ -0,0 +1,192 @@
+/**
+ * @file
+ *
+ * A listener (see events.h) showing the progress of a long run on a terminal
+ *
+ * While the tests run, a single line is kept updated on the terminal: how many tests have ended (out of how many are expected),
+ * how many of them failed, the running @testsuite and @testcase, the elapsed time and an estimate of the remaining time.
+ *
+ * The estimate comes from the timings of a previous run, stored in a **history file** given by the \c --history command line option.
+ * Each line of the file contains how many microseconds a test took, followed by a space and by the description of its @testcase.
+ * The file ends with a line per @testsuite: <tt>S time tests failed_tests id</tt>, with the microseconds its tests took,
+ * how many tests it ran and how many of them failed. They are used to choose the order of the @testsuite (see suite_order.h).
+ * The history file is rewritten at the end of every run. Without a history file the remaining time is unknown.
+ *
+ * @author koldar
+ * @date Oct 19, 2026
+ */
+
+#ifndef PROGRESS_H_
+#define PROGRESS_H_
+
+#include <stdio.h>
+#include <stdbool.h>
+#include <time.h>
+
+#include "typedefs.h"
+#include "hashtable.h"
+#include "list.h"
+
+/**
+ * The minimum time, in microseconds, between 2 updates of the progress line
+ */
+#ifndef CT_PROGRESS_REFRESH_PERIOD
+#	define CT_PROGRESS_REFRESH_PERIOD 100000
+#endif
+
+/**
+ * How long the tests with the same @testcase description took in a previous run
+ */
+struct ct_test_timing {
+	/**
+	 * The description of the @testcase
+	 */
+	char* description;
+	/**
+	 * The sum of the durations, in microseconds, of the tests
+	 */
+	long total_time;
+	/**
+	 * The number of tests with this description
+	 */
+	int tests;
+	/**
+	 * The number of tests with this description which have ended in the current run
+	 */
+	int ended_tests;
+};
+
+/**
+ * How long the tests of a @testsuite took and how many of them failed
+ */
+struct ct_suite_timing {
+	/**
+	 * The id of the @testsuite
+	 */
+	char* name;
+	/**
+	 * The sum of the durations, in microseconds, of the tests
+	 */
+	long total_time;
+	/**
+	 * The number of tests of the @testsuite
+	 */
+	int tests;
+	/**
+	 * The number of failed tests of the @testsuite
+	 */
+	int failed_tests;
+};
+
+/**
+ * The state of the progress listener
+ */
+struct ct_progress {
+	/**
+	 * Where the progress line is drawn. @null if the progress is not shown, but the timings are still recorded
+	 */
+	FILE* output;
+	/**
+	 * The history file. @null if timings are neither read nor written
+	 */
+	const char* history_path;
+	/**
+	 * The timings of the previous run: each value is a struct ct_test_timing, indexed by the hash of its description
+	 */
+	ct_hashtable_o* history;
+	/**
+	 * The number of tests of the previous run
+	 */
+	int expected_tests;
+	/**
+	 * The duration, in microseconds, of the previous run
+	 */
+	long expected_time;
+	/**
+	 * The duration, in microseconds, the tests ended so far took in the previous run
+	 */
+	long expected_ended_time;
+	/**
+	 * The tests ended so far in the current run
+	 */
+	int ended_tests;
+	/**
+	 * The tests failed so far in the current run
+	 */
+	int failed_tests;
+	/**
+	 * The struct ct_test_timing of every test of the current run, in execution order, each one containing a single test
+	 */
+	ct_list_o* timings;
+	/**
+	 * The timings of the @testsuite in the previous run: each value is a struct ct_suite_timing, indexed by the hash of its id
+	 */
+	ct_hashtable_o* suite_history;
+	/**
+	 * The struct ct_suite_timing of every @testsuite of the current run, in execution order
+	 */
+	ct_list_o* suite_timings;
+	/**
+	 * The cell of struct ct_progress::suite_timings of the running @testsuite. @null before the first one
+	 */
+	struct ct_suite_timing* running_suite;
+	/**
+	 * The id of the running @testsuite
+	 */
+	const char* suite_name;
+	/**
+	 * The description of the running @testcase
+	 */
+	const char* testcase_description;
+	/**
+	 * When the run has started
+	 */
+	struct timespec start_time;
+	/**
+	 * When the last test has ended (or the run has started, if no test has ended yet)
+	 */
+	struct timespec last_test_end;
+	/**
+	 * When the progress line has been drawn the last time
+	 */
+	struct timespec last_draw;
+};
+
+/**
+ * Subscribes the progress listener to a model
+ *
+ * @param[inout] model the model to handle
+ * @param[in] output where the progress line is drawn. @null to only record the timings in the history file
+ * @param[in] history_path the history file. @null if there is no history file
+ * @return the state of the listener, released when the model is torn down
+ */
+struct ct_progress* ct_enable_progress(struct ct_model* model, FILE* output, const char* history_path);
+
+/**
+ * Computes how many microseconds the run is expected to last from now on
+ *
+ * The durations of the previous run are scaled by how much faster or slower the tests ended so far have been in this run.
+ *
+ * @param[in] progress the state of the listener
+ * @param[in] elapsed_time the microseconds elapsed since the run has started
+ * @return the expected remaining time in microseconds, or a negative number if it can't be estimated
+ */
+long ct_progress_estimate_remaining_time(const struct ct_progress* progress, long elapsed_time);
+
+/**
+ * Fetches the timings of a @testsuite in the previous run
+ *
+ * @param[in] progress the state of the listener
+ * @param[in] suite_name the id of the @testsuite
+ * @return the timings of the @testsuite, or @null if it's not in the history file
+ */
+const struct ct_suite_timing* ct_progress_get_suite_history(const struct ct_progress* progress, const char* suite_name);
+
+/**
+ * Releases from memory the state of the progress listener
+ *
+ * @param[inout] progress the state to dispose of
+ */
+void ct_destroy_progress(struct ct_progress* progress);
+
+#endif /* PROGRESS_H_ */
@@ -41,6 +41,10 @@ struct ct_test_stats {
 	 *
 	 */
 	unsigned int failed_tests;
+	/**
+	 * The number of flaky tests. Computed only when the tests are repeated: see flaky.h
+	 */
+	unsigned int flaky_tests;
 };
 
 /**
@@ -52,6 +56,9 @@ struct ct_test_stats {
  *
  * This allows for easy customization and high code maintainability. Use this struct to generate your custom test reporter.
  * For example, one may want to create a test reporter which save its data ina mysqlite database.
+ *
+ * The reporters of the optional parts of a snapshot (backtrace, resource usage, performance, stress, flakiness and benchmark) can be @null:
+ * such parts are simply not reported.
  */
 struct ct_report_producer {
 
@@ -63,6 +70,18 @@ struct ct_report_producer {
 
 	ct_assert_reporter_c assert_reporter;
 
+	ct_backtrace_reporter_c backtrace_reporter;
+
+	ct_resource_usage_reporter_c resource_usage_reporter;
+
+	ct_performance_reporter_c performance_reporter;
+
+	ct_stress_reporter_c stress_reporter;
+
+	ct_benchmark_reporter_c benchmark_reporter;
+
+	ct_flakiness_reporter_c flakiness_reporter;
+
 	ct_reporter_c report_producer;
 
 };
@@ -146,8 +165,106 @@ void ct_default_snapshot_tree_report(struct ct_model* model, struct ct_snapshot*
  */
 void ct_default_assertions_report(struct ct_model* model, struct ct_snapshot* snapshot, int level);
 
+/**
+ * Prints the backtrace captured when a snapshot raised a signal, one frame per line
+ *
+ * Frames are resolved into symbols only here, when the report is produced. Link the test executable with \c -rdynamic
+ * to get the names of the functions instead of just their offsets.
+ *
+ * \note
+ * The report will be printed in the file specified by struct ct_model::output_file
+ *
+ * @param[inout] model the model to manage
+ * @param[inout] snapshot the snapshot whose backtrace we need to write into the file
+ * @param[in] level the depth level \c snapshot is in the snapshot tree
+ */
+void ct_default_backtrace_report(struct ct_model* model, struct ct_snapshot* snapshot, int level);
+
+/**
+ * Prints the operating system resources a snapshot has consumed in a single line
+ *
+ * Nothing is printed if the resources of the snapshot have not been measured, either because struct ct_model::measure_resources is @false
+ * or because the test has been interrupted by a signal.
+ *
+ * \note
+ * The report will be printed in the file specified by struct ct_model::output_file
+ *
+ * @param[inout] model the model to manage
+ * @param[inout] snapshot the snapshot whose resource usage we need to write into the file
+ * @param[in] level the depth level \c snapshot is in the snapshot tree
+ */
+void ct_default_resource_usage_report(struct ct_model* model, struct ct_snapshot* snapshot, int level);
+
+/**
+ * Prints the elapsed time of a snapshot, followed by the hardware events which happened in it, in a single line
+ *
+ * Counters which were not available are omitted. Nothing is printed if the hardware counters have not been requested (see struct ct_model::hardware_counters)
+ * or if the snapshot has not been measured.
+ *
+ * \note
+ * The report will be printed in the file specified by struct ct_model::output_file
+ *
+ * @param[inout] model the model to manage
+ * @param[inout] snapshot the snapshot whose measurements we need to write into the file
+ * @param[in] level the depth level \c snapshot is in the snapshot tree
+ */
+void ct_default_performance_report(struct ct_model* model, struct ct_snapshot* snapshot, int level);
+
+/**
+ * Prints the measurements of the stress test a snapshot has run
+ *
+ * The first line shows the tail latency of an iteration; then there is a line for each thread, showing its throughput.
+ * Nothing is printed if the snapshot has not run a stress test.
+ *
+ * \note
+ * The report will be printed in the file specified by struct ct_model::output_file
+ *
+ * @param[inout] model the model to manage
+ * @param[inout] snapshot the snapshot whose stress test we need to write into the file
+ * @param[in] level the depth level \c snapshot is in the snapshot tree
+ */
+void ct_default_stress_report(struct ct_model* model, struct ct_snapshot* snapshot, int level);
+
+/**
+ * Prints the measurements of the benchmark a snapshot has run
+ *
+ * The first line shows the complexity class fitting the times best and how the environment has been controlled; then there is a line
+ * for each value of the parameter, showing its time with the confidence interval.
+ * Nothing is printed if the snapshot has not run a benchmark.
+ *
+ * \note
+ * The report will be printed in the file specified by struct ct_model::output_file
+ *
+ * @param[inout] model the model to manage
+ * @param[inout] snapshot the snapshot whose benchmark we need to write into the file
+ * @param[in] level the depth level \c snapshot is in the snapshot tree
+ */
+void ct_default_benchmark_report(struct ct_model* model, struct ct_snapshot* snapshot, int level);
+
+/**
+ * Prints, in a single line, which repetition generated a test and, for the first repetition, how the test behaved across all of them
+ *
+ * Nothing is printed if the tests have not been repeated.
+ *
+ * \note
+ * The report will be printed in the file specified by struct ct_model::output_file
+ *
+ * @param[inout] model the model to manage
+ * @param[inout] report the report of a repetition of the test
+ */
+void ct_default_flakiness_report(struct ct_model* model, struct ct_test_report* report);
+
 ///@}
 
+/**
+ * Counts the successful and the failed tests inside struct ct_model::test_reports_list
+ *
+ * The counts are stored inside struct ct_model::statistics. Every report producer should call it before producing the summary.
+ *
+ * @param[inout] model the model to handle
+ */
+void ct_update_test_stats(struct ct_model* model);
+
 /**
  * Creates a new initialized structure in the heap
  *
@@ -0,0 +1,125 @@
+/**
+ * @file
+ *
+ * Serializes the tests, so that they can be sent to another process running the same test executable
+ *
+ * A test is serialized with its whole snapshot tree. Strings are sent with their content, while the structures and the other fields
+ * (backtraces, stress and benchmark reports) are copied byte by byte, in the layout and the byte order of the sending machine.
+ * Hence the serialized tests can be read only by the same test executable running on the same architecture: a worker built
+ * differently, or running on a machine with another byte order, sends data the receiver can't make sense of.
+ *
+ * Data which is too short to hold what it declares is detected (see struct ct_serialized_buffer::corrupted), so that a receiver
+ * can drop what it has been sent instead of reading past it.
+ *
+ * The tag tables and the strings of the assertions of a deserialized test are not owned by the test, since in the
+ * sending process they belong to the sections and to the executable. They are kept by a ::ct_report_arena instead, which needs to outlive the tests.
+ *
+ * @author koldar
+ * @date Oct 19, 2026
+ */
+
+#ifndef REPORT_SERIALIZATION_H_
+#define REPORT_SERIALIZATION_H_
+
+#include <stdio.h>
+#include <stddef.h>
+#include <stdbool.h>
+
+#include "typedefs.h"
+#include "list.h"
+
+/**
+ * Some serialized data being deserialized
+ */
+struct ct_serialized_buffer {
+	/**
+	 * The serialized data
+	 */
+	unsigned char* data;
+	/**
+	 * The number of bytes in struct ct_serialized_buffer::data
+	 */
+	size_t size;
+	/**
+	 * The number of bytes already deserialized
+	 */
+	size_t position;
+	/**
+	 * @true if the data has turned out to be shorter than what it declares. Once set, nothing more is read
+	 */
+	bool corrupted;
+};
+
+/**
+ * The memory of the deserialized tests which doesn't belong to any test
+ */
+struct ct_report_arena {
+	/**
+	 * The tag tables of the snapshots. The sites the tags come from may not be prepared in the receiving process, so they are rebuilt
+	 */
+	ct_list_o* tags;
+	/**
+	 * The strings of the assertions
+	 */
+	ct_list_o* strings;
+};
+
+/**
+ * Creates an empty arena
+ *
+ * @return the arena just created
+ */
+struct ct_report_arena* ct_init_report_arena();
+
+/**
+ * Releases from memory an arena
+ *
+ * \pre
+ * 	\li the tests deserialized with \c arena have already been released
+ *
+ * @param[inout] arena the arena to dispose of
+ */
+void ct_destroy_report_arena(struct ct_report_arena* arena);
+
+/**
+ * Serializes a test
+ *
+ * @param[inout] out the stream to write into
+ * @param[in] report the test to serialize
+ */
+void ct_serialize_test_report(FILE* out, const struct ct_test_report* report);
+
+/**
+ * Reads everything another process writes into a pipe, until it closes it
+ *
+ * @param[in] channel the read end of the pipe
+ * @param[out] buffer the data read, ready to be deserialized. struct ct_serialized_buffer::data needs to be released with \c free
+ */
+void ct_read_serialized_data(int channel, struct ct_serialized_buffer* buffer);
+
+/**
+ * Copies the next bytes of the serialized data
+ *
+ * The sender always serializes whole tests, so running out of data means it has sent something this process can't understand:
+ * in that case struct ct_serialized_buffer::corrupted is set and \c output is filled with zeros.
+ *
+ * @param[inout] buffer the serialized data
+ * @param[out] output where to copy the bytes
+ * @param[in] size the number of bytes to copy
+ * @return @true if the bytes have been copied, @false if the data is corrupted
+ */
+bool ct_deserialize_bytes(struct ct_serialized_buffer* buffer, void* output, size_t size);
+
+/**
+ * Deserializes a test written by ::ct_serialize_test_report
+ *
+ * If the data turns out to be corrupted, struct ct_serialized_buffer::corrupted is set: the returned test can still be
+ * released with ::ct_destroy_test_report, but its content is meaningless.
+ *
+ * @param[inout] buffer the serialized data
+ * @param[inout] arena the arena which will own the tags and the assertion strings of the test
+ * @return the test deserialized. It isn't linked to its repetitions yet
+ */
+struct ct_test_report* ct_deserialize_test_report(struct ct_serialized_buffer* buffer, struct ct_report_arena* arena);
+
+#endif /* REPORT_SERIALIZATION_H_ */
@@ -0,0 +1,83 @@
+/**
+ * @file
+ *
+ * Module measuring the operating system resources a @containablesection consumes
+ *
+ * Measurements are taken via \c getrusage, which is just a system call: no text needs to be parsed, so sampling is cheap enough
+ * to be performed every time a snapshot starts and ends.
+ *
+ * @author koldar
+ * @date Oct 19, 2026
+ */
+
+#ifndef RESOURCE_USAGE_H_
+#define RESOURCE_USAGE_H_
+
+/**
+ * The resources consumed by the process
+ *
+ * Depending on the context, the structure represents either the resources consumed by the process since it started (a sample)
+ * or the resources consumed in a given period of time (a delta). See ::ct_begin_resource_usage and ::ct_end_resource_usage
+ */
+struct ct_resource_usage {
+	/**
+	 * The peak resident set size of the process, in kilobytes
+	 *
+	 * This is never a delta: even in a delta it represents the peak reached by the process at the end of the period
+	 */
+	long max_rss;
+	/**
+	 * How much, in kilobytes, ct_resource_usage::max_rss has grown during the period
+	 *
+	 * Always 0 in a sample. A value greater than 0 means the process reached a new memory peak within the period
+	 */
+	long max_rss_growth;
+	/**
+	 * Page faults serviced without any I/O activity
+	 */
+	long minor_faults;
+	/**
+	 * Page faults which required I/O activity
+	 */
+	long major_faults;
+	/**
+	 * Number of times the process voluntarily gave up the CPU, usually because it blocked waiting for a resource (e.g. I/O)
+	 */
+	long voluntary_context_switches;
+	/**
+	 * Number of times the process has been preempted by the scheduler
+	 */
+	long involuntary_context_switches;
+	/**
+	 * CPU time spent in user mode, in microseconds
+	 */
+	long user_time;
+	/**
+	 * CPU time spent in kernel mode, in microseconds
+	 */
+	long system_time;
+};
+
+/**
+ * Samples the resources consumed by the process so far
+ *
+ * @param[out] usage the structure where to store the sample
+ */
+void ct_sample_resource_usage(struct ct_resource_usage* usage);
+
+/**
+ * Starts measuring the resources consumed from now on
+ *
+ * @param[out] usage the structure which will contain the measurement. After this call it holds a sample
+ */
+void ct_begin_resource_usage(struct ct_resource_usage* usage);
+
+/**
+ * Stops measuring the resources consumed
+ *
+ * @param[inout] usage a structure initialized with ::ct_begin_resource_usage. After this call it holds the resources consumed between
+ * 	::ct_begin_resource_usage and this call
+ */
+void ct_end_resource_usage(struct ct_resource_usage* usage);
+
+#endif /* RESOURCE_USAGE_H_ */
@@ -0,0 +1,151 @@
+/**
+ * @file
+ *
+ * Module exploring the thread interleavings of a stress test in a deterministic way
+ *
+ * When schedule exploration is enabled (see the \c --schedule_seeds command line option), the threads of a ::STRESS section don't run in parallel
+ * anymore: they are serialized by a scheduler which lets exactly one thread run at a time. The running thread can be preempted only at
+ * **preemption points**:
+ * \li ::ct_yield, which you can put anywhere in the code under test;
+ * \li ::ct_mutex_lock and ::ct_mutex_unlock, which replace \c pthread_mutex_lock and \c pthread_mutex_unlock;
+ * \li the end of every iteration of the stress test.
+ *
+ * At each preemption point, the scheduler picks the next thread to run with a pseudo random generator initialized with a **seed**: hence a seed
+ * always generates the very same interleaving. Every seed is run in its own process, forked from the test process, and several seeds are run in
+ * parallel. If a seed fails, @crashc replays it within the test process so that its assertions end up in the report: you can replay it again
+ * with the \c --schedule_seed command line option.
+ *
+ * \attention
+ * While serialized, a thread blocking on something other than ::ct_mutex_lock (e.g. \c pthread_mutex_lock or a condition variable)
+ * will block every other thread as well.
+ *
+ * @author koldar
+ * @date Oct 19, 2026
+ */
+
+#ifndef SCHEDULE_H_
+#define SCHEDULE_H_
+
+#include <stdbool.h>
+#include <pthread.h>
+
+#include "typedefs.h"
+
+/**
+ * A scheduler serializing the threads of a stress test
+ */
+struct ct_scheduler {
+	/**
+	 * Lock protecting the whole structure
+	 */
+	pthread_mutex_t lock;
+	/**
+	 * Signaled every time ct_scheduler::running changes or a thread registers itself
+	 */
+	pthread_cond_t changed;
+	/**
+	 * The number of threads the scheduler handles
+	 */
+	int threads_number;
+	/**
+	 * The number of threads which have registered themselves via ::ct_scheduler_thread_start
+	 */
+	int registered_threads;
+	/**
+	 * The id of the only thread allowed to run. -1 if no thread can run
+	 */
+	int running;
+	/**
+	 * For each thread, @true if the thread has terminated
+	 */
+	bool* terminated;
+	/**
+	 * The number of threads which have not terminated yet
+	 */
+	int alive_threads;
+	/**
+	 * The state of the pseudo random generator deciding the interleaving
+	 */
+	unsigned long long random_state;
+};
+
+/**
+ * Creates a new scheduler
+ *
+ * @param[in] threads_number the number of threads to serialize
+ * @param[in] seed the seed generating the interleaving
+ * @return the scheduler
+ */
+struct ct_scheduler* ct_init_scheduler(int threads_number, long seed);
+
+/**
+ * Releases a scheduler from memory
+ *
+ * @param[inout] scheduler the scheduler to dispose of
+ */
+void ct_destroy_scheduler(struct ct_scheduler* scheduler);
+
+/**
+ * Lets the first thread run, once every thread has registered itself
+ *
+ * Called by the thread which has spawned the serialized threads
+ *
+ * @param[inout] scheduler the scheduler to handle
+ */
+void ct_scheduler_start(struct ct_scheduler* scheduler);
+
+/**
+ * Registers the calling thread in the scheduler and waits until it's chosen to run
+ *
+ * @param[inout] scheduler the scheduler to handle
+ * @param[in] thread_id the id of the calling thread, between 0 and struct ct_scheduler::threads_number (excluded)
+ */
+void ct_scheduler_thread_start(struct ct_scheduler* scheduler, int thread_id);
+
+/**
+ * Tells the scheduler the calling thread has terminated, hence another thread can run
+ *
+ * @param[inout] scheduler the scheduler to handle
+ */
+void ct_scheduler_thread_end(struct ct_scheduler* scheduler);
+
+/**
+ * A preemption point: the scheduler may let another thread run
+ *
+ * Does nothing if the calling thread is not serialized by a scheduler, so you can leave the call in the code under test.
+ */
+void ct_yield();
+
+/**
+ * Locks a mutex, letting other serialized threads run while the mutex is held by someone else
+ *
+ * Behaves exactly like \c pthread_mutex_lock if the calling thread is not serialized by a scheduler
+ *
+ * @param[inout] mutex the mutex to lock
+ * @return the value returned by \c pthread_mutex_lock
+ */
+int ct_mutex_lock(pthread_mutex_t* mutex);
+
+/**
+ * Unlocks a mutex and then acts as a preemption point
+ *
+ * @param[inout] mutex the mutex to unlock
+ * @return the value returned by \c pthread_mutex_unlock
+ */
+int ct_mutex_unlock(pthread_mutex_t* mutex);
+
+/**
+ * Runs every seed of the schedule exploration in a separate process
+ *
+ * At most ::ct_get_workers_number processes run at the same time. The state of the test process is never changed.
+ *
+ * @param[inout] model the model to handle
+ * @param[in] function the function every thread of the stress test runs
+ * @param[in] threads_number the number of threads of the stress test
+ * @param[in] iterations the number of iterations of the stress test
+ * @param[out] failed_schedules the number of seeds which failed
+ * @return the smallest seed which failed or -1 if every seed passed
+ */
+long ct_explore_schedules(struct ct_model* model, ct_stress_c function, int threads_number, long iterations, long* failed_schedules);
+
+#endif /* SCHEDULE_H_ */
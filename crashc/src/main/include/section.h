@@ -11,11 +11,17 @@
 #define SECTION_H_
 
 #include <stdbool.h>
+#include <stddef.h>
+#include <time.h>
 
 #include "tag.h"
 #include "errors.h"
 #include "typedefs.h"
 #include "list.h"
+#include "resource_usage.h"
+#include "hardware_counters.h"
+#include "stress.h"
+#include "benchmark.h"
 
 /**
  * Represents the type of a ::ct_section
@@ -43,6 +49,14 @@ enum ct_section_type {
 	 * The section is a then
 	 */
 	CT_THEN_SECTION,
+	/**
+	 * The section is a stress test
+	 */
+	CT_STRESS_SECTION,
+	/**
+	 * The section is a benchmark
+	 */
+	CT_BENCHMARK_SECTION,
 };
 
 /**
@@ -117,6 +131,20 @@ enum ct_snapshot_status {
 	 *
 	 */
 	CT_SNAPSHOT_FAILED,
+
+	/**
+	 * A snapshot of a @testcase which didn't release all the memory it allocated
+	 *
+	 * This is set only if the allocation tracker is enabled. See allocation_tracker.h
+	 */
+	CT_SNAPSHOT_LEAKED,
+
+	/**
+	 * A snapshot which allocated more blocks than the \c max_allocs tag of its section allows
+	 *
+	 * This is set only if the allocation tracker is enabled. See ::ct_allocation_tracker_check_bound
+	 */
+	CT_SNAPSHOT_OVER_ALLOCATED,
 };
 
 /**
@@ -168,6 +196,113 @@ struct ct_snapshot {
 	 */
 	long elapsed_time;
 
+	/**
+	 * The time when the ::ct_section represented by the struct has started running during the specific test
+	 *
+	 * Used to compute ct_snapshot::elapsed_time
+	 */
+	struct timespec start_time;
+
+	/**
+	 * The signal raised while running the code of the ::ct_section represented by the struct
+	 *
+	 * The value is 0 if no signal has been raised within this very snapshot
+	 */
+	int signal_detected;
+
+	/**
+	 * The \c si_code the kernel associated to ct_snapshot::signal_detected
+	 *
+	 * It explains why the signal has been raised (e.g. \c SEGV_MAPERR). Meaningful only when ct_snapshot::signal_detected is not 0
+	 */
+	int signal_code;
+
+	/**
+	 * The faulting address associated to ct_snapshot::signal_detected
+	 *
+	 * Meaningful only when ct_snapshot::signal_detected is not 0
+	 */
+	void* signal_address;
+
+	/**
+	 * The return addresses of the stack frames active when ct_snapshot::signal_detected was raised
+	 *
+	 * The addresses are resolved into symbols only when the report is produced.
+	 * @null if no backtrace has been captured
+	 */
+	void** backtrace;
+
+	/**
+	 * The number of frames inside ct_snapshot::backtrace
+	 */
+	int backtrace_size;
+
+	/**
+	 * The number of blocks the code directly owned by the ::ct_section represented by the struct has allocated
+	 *
+	 * Always 0 if the allocation tracker is disabled. See allocation_tracker.h
+	 */
+	unsigned long allocations;
+
+	/**
+	 * The number of bytes requested by ct_snapshot::allocations
+	 */
+	size_t allocated_bytes;
+
+	/**
+	 * The number of blocks allocated within the test that the code directly owned by the ::ct_section represented by the struct has released
+	 */
+	unsigned long frees;
+
+	/**
+	 * The number of blocks allocated within the test which were never released
+	 *
+	 * Meaningful only for the snapshot of a @testcase
+	 */
+	unsigned long leaked_blocks;
+
+	/**
+	 * The number of bytes of the ct_snapshot::leaked_blocks
+	 */
+	size_t leaked_bytes;
+
+	/**
+	 * The operating system resources consumed while running the ::ct_section represented by the struct, children included
+	 *
+	 * Meaningful only if ct_snapshot::measurements_taken and struct ct_model::measure_resources are @true
+	 */
+	struct ct_resource_usage resource_usage;
+
+	/**
+	 * @true if the measurements of the ::ct_section represented by the struct have been stopped, since the section ended normally
+	 *
+	 * When @true, ct_snapshot::elapsed_time is complete, and so are ct_snapshot::resource_usage and ct_snapshot::hardware_counters
+	 * if they have been requested. It stays @false if the test has been interrupted by a signal or by a failed assertion
+	 */
+	bool measurements_taken;
+
+	/**
+	 * The hardware events happened while running the ::ct_section represented by the struct, children included
+	 *
+	 * Meaningful only if ct_snapshot::measurements_taken is @true and struct ct_model::hardware_counters is not @null.
+	 * Counters which could not be measured are set to ::CT_HARDWARE_COUNTER_UNAVAILABLE
+	 */
+	struct ct_hardware_counters hardware_counters;
+
+	/**
+	 * The measurements of the stress test run by the ::ct_section represented by the struct
+	 *
+	 * @null if the section is not a stress test or if the stress test has not completed
+	 */
+	struct ct_stress_report* stress;
+
+	/**
+	 * The measurements of the benchmark run by the ::ct_section represented by the struct
+	 *
+	 * @null if the section is not a benchmark or if the benchmark has not completed
+	 */
+	struct ct_benchmark_report* benchmark;
+
 	/**
 	 * The list of reports of the assertions executed in the ::ct_section represented.
 	 *
@@ -197,6 +332,56 @@ struct ct_snapshot {
 	struct ct_snapshot* first_child;
 };
 
+/**
+ * The data shared by every ::ct_section created at the same place of the source code
+ *
+ * Every @containablesection macro declares a static site, so what depends only on the source code (like the tags) is computed once,
+ * the first time the @containablesection is reached, and not every time a ::ct_section is created out of it (for instance, when the
+ * @containablesection is inside a loop or when the tests are repeated).
+ */
+struct ct_section_site {
+	/**
+	 * @true if ::ct_section_site_prepare has already been called on this site
+	 */
+	bool prepared;
+	/**
+	 * The file where the @containablesection is
+	 */
+	const char* file;
+	/**
+	 * The line where the @containablesection is
+	 */
+	int line;
+	/**
+	 * The tags of the @containablesection. @null until the site is prepared
+	 */
+	ct_tag_hashtable_o* tags;
+	/**
+	 * The next prepared site. See ::ct_section_site_prepare
+	 */
+	struct ct_section_site* next;
+};
+
+/**
+ * The initializer of a struct ct_section_site of the @containablesection at the current line
+ */
+#define CT_SECTION_SITE_INITIALIZER { false, __FILE__, __LINE__, NULL, NULL }
+
+/**
+ * The character separating the descriptions of the sections in a section path
+ *
+ * For instance, <tt>"list/adding on tail/size increments"</tt> is the path of the @then "size increments" inside
+ * the @when "adding on tail" inside the @testcase "list".
+ */
+#ifndef CT_SECTION_PATH_SEPARATOR
+#	define CT_SECTION_PATH_SEPARATOR '/'
+#endif
+
+/**
+ * The hash of the path of the root section
+ */
+#define CT_ROOT_PATH_HASH 5381UL
+
 /**
  * Main structure representing a piece of testable code
  *
@@ -244,10 +429,33 @@ struct ct_section {
 	/**
 	 * List of tags associated to the section
 	 *
+	 * The table belongs to the struct ct_section_site of the section, hence it is shared by every section created at the same place of the source code.
+	 *
 	 * @notnull
 	 */
 	ct_tag_hashtable_o* tags;
 
+	/**
+	 * The hash of the path of the section, namely the descriptions of its ancestors and of the section itself separated by ::CT_SECTION_PATH_SEPARATOR
+	 *
+	 * It's computed with ::ct_section_path_hash from the one of the parent, so no path is ever built.
+	 */
+	unsigned long path_hash;
+
+	/**
+	 * @true if the section is an ancestor, a descendant or the section selected with ::ct_select_section_path itself
+	 *
+	 * When no section is selected, it's always @true. Sections with this field set to @false are never entered.
+	 */
+	bool on_target_path;
+
+	/**
+	 * @true if the section is the section selected with ::ct_select_section_path or one of its descendants
+	 *
+	 * When no section is selected, it's always @true.
+	 */
+	bool inside_target;
+
 	/**
 	 * determine if ::ct_section::children_number has a meaning
 	 *
@@ -402,10 +610,10 @@ int ct_section_get_level(const struct ct_section* section);
  *
  * @param[in] type the type of this section
  * @param[in] description a text describing briefly the section
- * @param[in] tags a single string containing all the tags associated to the section. See \ref tags
+ * @param[in] tags the tags associated to the section. The section doesn't own them. See \ref tags
  * @return the new ::ct_section instance just created
  */
-struct ct_section* ct_section_init(enum ct_section_type type, const char* description, const char* tags);
+struct ct_section* ct_section_init(enum ct_section_type type, const char* description, ct_tag_hashtable_o* tags);
 /**
  * Destroy a ::ct_section inside the heap
  *
@@ -429,14 +637,18 @@ void ct_section_destroy(struct ct_section* section);
  * 	\li @true if we're still computing the number of children of \c section,
  * 	\li @false otheriwse
  */
-bool ct_section_still_discovering_children(const struct ct_section* section);
+static inline bool ct_section_still_discovering_children(const struct ct_section* section) {
+	return !section->children_number_known;
+}
 
 /**
  * Marks the given section as a section where the related @containablesection raised a signal
  *
  * @param[inout] section the section to alter
  */
-void ct_section_set_signaled(struct ct_section* section);
+static inline void ct_section_set_signaled(struct ct_section* section) {
+	section->status = CT_SECTION_SIGNAL_DETECTED;
+}
 
 /**
  * Check if the related @containablesection has raise a signal
@@ -444,28 +656,36 @@ void ct_section_set_signaled(struct ct_section* section);
  * @param[in] section the section to check
  * @return true if the section was marked as signal detected; false otherwise
  */
-bool ct_section_is_signaled(const struct ct_section* section);
+static inline bool ct_section_is_signaled(const struct ct_section* section) {
+	return section->status == CT_SECTION_SIGNAL_DETECTED;
+}
 
 /**
  * Mark the section as **partially executed**
  *
  * @param[inout] section the section to mark
  */
-void ct_section_set_executed(struct ct_section* section);
+static inline void ct_section_set_executed(struct ct_section* section) {
+	section->status = CT_SECTION_PARTIALLY_VISITED;
+}
 
 /**
  * Mark the section as **fully visited**
  *
  * @param[inout] section the section to mark
  */
-void ct_section_set_done(struct ct_section* section);
+static inline void ct_section_set_done(struct ct_section* section) {
+	section->status = CT_SECTION_FULLY_VISITED;
+}
 
 /**
  * Mark section as a one which we didn't explore because of the tags
  *
  * @param[inout] section the section whose status we need to update
  */
-void ct_section_set_skipped(struct ct_section* section);
+static inline void ct_section_set_skipped(struct ct_section* section) {
+	section->status = CT_SECTION_SKIPPED_BY_TAG;
+}
 
 /**
  * Tells if a given section will be executed again depending on its status.
@@ -475,7 +695,9 @@ void ct_section_set_skipped(struct ct_section* section);
  *  \li @true if the status is either ::CT_SECTION_UNVISITED or ::CT_SECTION_PARTIALLY_VISITED;
  *  \li @false iff the status is either ::CT_SECTION_SKIPPED_BY_TAG, ::CT_SECTION_FULLY_VISITED or ::CT_SECTION_SIGNAL_DETECTED;
  */
-bool ct_section_still_needs_execution(struct ct_section* section);
+static inline bool ct_section_still_needs_execution(const struct ct_section* section) {
+	return section->status == CT_SECTION_UNVISITED || section->status == CT_SECTION_PARTIALLY_VISITED;
+}
 
 /*
  * We use this function to determine whether we can set a section as fully visited.
@@ -495,6 +717,68 @@ bool ct_section_still_needs_execution(struct ct_section* section);
  */
 bool ct_section_is_fully_visited(struct ct_section* section);
 
+/**
+ * Identifies a @testcase across different processes running the same tests
+ *
+ * Several @testcase may have the same path, for instance a @testcase inside a loop, so the path alone is not enough.
+ */
+struct ct_testcase_key {
+	/**
+	 * The struct ct_section::path_hash of the @testcase
+	 */
+	unsigned long path_hash;
+	/**
+	 * How many @testcase with the same path have been met before this one
+	 */
+	int occurrence;
+};
+
+/**
+ * Computes a hash of a ::ct_testcase_key, to index it in a hash table
+ *
+ * @param[in] key the key to hash
+ * @return the hash of \c key
+ */
+unsigned long ct_testcase_key_hash(const struct ct_testcase_key* key);
+
+/**
+ * Computes the hash of the path of a section from the hash of the path of its parent
+ *
+ * The hash is rolling: the hash of <tt>"a/b"</tt> is obtained by extending the hash of <tt>"a"</tt> with <tt>"b"</tt>. Hence
+ * the hashes of every prefix of a path are computed while scanning it once.
+ *
+ * @param[in] parent_hash the hash of the path of the parent. ::CT_ROOT_PATH_HASH for the children of the root section
+ * @param[in] description the description of the section
+ * @param[in] length the number of characters of \c description to consider
+ * @return the hash of the path of the section
+ */
+unsigned long ct_section_path_hash(unsigned long parent_hash, const char* description, size_t length);
+
+/**
+ * Computes the data of a site, unless it has already been done
+ *
+ * The tags are parsed here. If they are malformed (see ::ct_tag_ht_populate), a warning is printed: since a site is prepared only once,
+ * every malformed @containablesection is reported only once.
+ *
+ * \post
+ * 	\li \c site is prepared and it's the head of \c prepared_sites
+ *
+ * @param[inout] site the site to prepare
+ * @param[in] tags the tags of the @containablesection, separated by ::CT_TAGS_SEPARATOR
+ * @param[inout] prepared_sites the head of the list of the sites prepared so far
+ */
+void ct_section_site_prepare(struct ct_section_site* site, const char* tags, struct ct_section_site** prepared_sites);
+
+/**
+ * Releases the data of the prepared sites, so that they can be prepared again
+ *
+ * Sites are static variables, hence they survive the model: after this call they are in the same state they were before
+ * being prepared.
+ *
+ * @param[inout] prepared_sites the head of the list of the prepared sites. It's emptied
+ */
+void ct_section_sites_release(struct ct_section_site** prepared_sites);
+
 /**
  * Generates an image of the section tree useful for debugging purposes
  *
@@ -0,0 +1,123 @@
+/**
+ * @file
+ *
+ * Runs every @when in a forked process, so that the code preceding it is run only once
+ *
+ * Normally, the body of a @testcase is run from the beginning for every path of the section tree: the code preceding the first @when,
+ * and the code of every @when containing other ones, is run once per leaf.
+ *
+ * When this mode is enabled with the \c --fork_sections command line option, whenever a process is granted access to a @when it forks:
+ * \li the forked process enters the @when and runs until the @when has been fully visited. The tests it completes are then sent back to
+ * 	the process which forked it through a pipe and the forked process exits;
+ * \li the process which forked waits for the forked one, collects its tests and goes on to the next @when as if it had visited the @when itself.
+ * 	Since it hasn't entered any @when, the test it was running is discarded.
+ *
+ * In this way the code preceding a @when is run once per node of the section tree and not once per leaf. The outcomes are the same as without
+ * the mode only if the code outside the @when sections has no side effects visible outside the process (like writing a file), since such code is run
+ * both by the forked process and by the one which forked.
+ *
+ * A failed assertion or a signal in a forked process interrupts the @testcase in the process which forked as well, exactly like it happens without the mode.
+ * If a forked process terminates without sending its tests back (e.g. it calls \c exit), its tests are lost and the @when fails as if it had received a signal.
+ *
+ * The tests run by a forked process are notified to the listeners (see events.h) once collected, while the other events of a forked process
+ * are not notified at all.
+ *
+ * @author koldar
+ * @date Oct 19, 2026
+ */
+
+#ifndef SECTION_FORK_H_
+#define SECTION_FORK_H_
+
+#include <stdbool.h>
+
+#include "typedefs.h"
+#include "list.h"
+
+/**
+ * The state of the mode running every @when in a forked process
+ */
+struct ct_section_fork {
+	/**
+	 * The write end of the pipe towards the process which forked this one. -1 in the test process
+	 */
+	int channel;
+	/**
+	 * The @when this process has been forked to visit. @null in the test process
+	 */
+	struct ct_section* root;
+	/**
+	 * The index, in struct ct_model::test_reports_list, of the first test this process needs to send back
+	 */
+	int first_report;
+	/**
+	 * @true if the running test has forked a process for at least a @when
+	 */
+	bool delegated;
+	/**
+	 * The tests collected from the forked processes while the running test is still going on.
+	 * They are added to struct ct_model::test_reports_list when the running test ends
+	 */
+	ct_list_o* collected_reports;
+	/**
+	 * The memory of the collected tests which doesn't belong to the tests themselves
+	 */
+	struct ct_report_arena* arena;
+};
+
+/**
+ * Creates the state of the mode for the test process
+ *
+ * @return the state just created
+ */
+struct ct_section_fork* ct_init_section_fork();
+
+/**
+ * Forks a process to visit a @when
+ *
+ * \pre
+ * 	\li the calling process has been granted access to \c section
+ *
+ * @param[inout] model the model to handle
+ * @param[inout] section the @when to visit
+ * @return
+ * 	\li @true in the forked process, which needs to enter \c section;
+ * 	\li @false in the process which forked, once the forked process has exited. \c section won't be entered anymore.
+ * 	If the forked process has been interrupted by a failed assertion or a signal, or has terminated without sending its tests back,
+ * 	the function doesn't return: it jumps back to the @testcase, like the failed assertion would have done in the process which forked
+ */
+bool ct_fork_section(struct ct_model* model, struct ct_section* section);
+
+/**
+ * Completes a test when every @when runs in a forked process
+ *
+ * The test is discarded if it has delegated some @when to a forked process. The tests collected so far are added to the model and notified to the listeners.
+ * If the calling process has been forked and its @when is fully visited, or the test has been interrupted, the tests are sent back and the process exits.
+ *
+ * @param[inout] model the model to handle
+ * @param[in] report the test which has just ended. It's the last one in struct ct_model::test_reports_list
+ * @param[in] interrupted @true if \c report has been interrupted by a failed assertion or a signal
+ * @return @true if \c report is still in the model and needs to be notified to the listeners, @false if it has been discarded
+ */
+bool ct_section_fork_end_test(struct ct_model* model, struct ct_test_report* report, bool interrupted);
+
+/**
+ * Sends back the tests and exits if the calling process has been forked to visit a @when
+ *
+ * Used when a forked process is about to run something outside its @testcase, which only the test process is entitled to run.
+ *
+ * @param[inout] model the model to handle
+ */
+void ct_section_fork_leave(struct ct_model* model);
+
+/**
+ * Releases from memory the state of the mode
+ *
+ * \pre
+ * 	\li the collected tests have already been released, since they refer to struct ct_section_fork::arena
+ *
+ * @param[inout] section_fork the state to dispose of
+ */
+void ct_destroy_section_fork(struct ct_section_fork* section_fork);
+
+#endif /* SECTION_FORK_H_ */
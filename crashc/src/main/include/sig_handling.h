@@ -32,12 +32,36 @@
 #endif
 #define CT_NO_FLAGS 0
 
+/**
+ * The size, in bytes, of the alternate stack used to handle fatal signals
+ *
+ * The stack needs to be big enough to run the signal handler of @crashc. Enlarge it if you happen to
+ * customize what happens when a signal is detected.
+ */
+#ifndef CT_SIGNAL_STACK_SIZE
+#	define CT_SIGNAL_STACK_SIZE 65536
+#endif
+
 /**
  * Registers all the signal @crashc test framework wants to handle
  *
+ * The handled signals are \c SIGSEGV, \c SIGBUS, \c SIGILL, \c SIGABRT and \c SIGFPE. The handler runs on an alternate signal stack
+ * (see struct ct_model::signal_stack), hence even a stack overflow within the code under test is detected.
+ *
+ * \note
+ * If the program under test has already installed a handler for one of such signals, @crashc won't override it.
+ *
  * \post
- * 	\li struct ct_model::_crashc_sigaction manages all signals
+ * 	\li struct ct_model::_crashc_sigaction manages all signals the program under test doesn't handle by itself
  */
 void ct_register_signal_handlers();
 
+/**
+ * Restores the signal actions which were present before calling ::ct_register_signal_handlers
+ *
+ * \post
+ * 	\li the alternate signal stack is not used anymore
+ */
+void ct_unregister_signal_handlers();
+
 #endif
@@ -0,0 +1,140 @@
+/**
+ * @file
+ *
+ * Module running a piece of code concurrently on several threads to stress the code under test
+ *
+ * A stress test runs a function (see ::ct_stress_c) on a given number of threads for a given number of iterations.
+ * All the threads wait on a barrier before starting, so they really compete against each other right from the first iteration.
+ * Assertions performed by the function are collected from every thread (see thread_context.h). For every thread we measure the throughput,
+ * while for every iteration we measure the latency, so that the tail of the latency distribution can be reported.
+ * Every thread keeps at most ::CT_STRESS_LATENCY_SAMPLES latencies, chosen uniformly among its iterations by reservoir sampling:
+ * the memory of a stress test does not grow with its iterations and the percentiles are exact as long as no thread exceeds the bound.
+ *
+ * @author koldar
+ * @date Oct 19, 2026
+ */
+
+#ifndef STRESS_H_
+#define STRESS_H_
+
+#include <stdbool.h>
+
+#include "typedefs.h"
+
+/**
+ * The maximum number of iteration latencies every thread of a stress test keeps to compute the percentiles
+ */
+#ifndef CT_STRESS_LATENCY_SAMPLES
+#	define CT_STRESS_LATENCY_SAMPLES 4096
+#endif
+
+/**
+ * The measurements of a single thread of a stress test
+ */
+struct ct_stress_thread_report {
+	/**
+	 * The number of iterations the thread has completed
+	 *
+	 * It's less than struct ct_stress_report::iterations if an assertion failed on the thread
+	 */
+	long completed_iterations;
+	/**
+	 * The time, in nanoseconds, the thread spent running its iterations
+	 */
+	long elapsed_time;
+	/**
+	 * The number of iterations completed per second
+	 */
+	double throughput;
+	/**
+	 * The latency, in nanoseconds, of the slowest iteration of the thread
+	 */
+	long max_latency;
+};
+
+/**
+ * The measurements of a whole stress test
+ */
+struct ct_stress_report {
+	/**
+	 * The number of threads which run the stress test
+	 */
+	int threads_number;
+	/**
+	 * The number of iterations each thread needed to perform
+	 */
+	long iterations;
+	/**
+	 * Median latency, in nanoseconds, of an iteration, considering every thread
+	 */
+	long latency_p50;
+	/**
+	 * 99th percentile of the latency, in nanoseconds, of an iteration, considering every thread
+	 */
+	long latency_p99;
+	/**
+	 * 99.9th percentile of the latency, in nanoseconds, of an iteration, considering every thread
+	 */
+	long latency_p999;
+	/**
+	 * The latency, in nanoseconds, of the slowest iteration among all the threads
+	 */
+	long max_latency;
+	/**
+	 * An array of struct ct_stress_report::threads_number cells, one for each thread
+	 */
+	struct ct_stress_thread_report* threads;
+	/**
+	 * The seed generating the thread interleaving of this run. -1 if the threads run in parallel without a scheduler
+	 *
+	 * See schedule.h
+	 */
+	long schedule_seed;
+	/**
+	 * The number of seeds explored before this run. 0 if no exploration has been performed
+	 */
+	long explored_schedules;
+	/**
+	 * The number of explored seeds which failed
+	 */
+	long failed_schedules;
+};
+
+/**
+ * Runs a stress test and stores its measurements in struct ct_model::current_snapshot
+ *
+ * The function returns only when every thread has terminated. If struct ct_model::schedule_replay_seed is set, the threads are serialized
+ * with such seed. Otherwise, if struct ct_model::schedule_seeds is positive, every seed is explored in a separate process and then the smallest
+ * failing seed (or seed 0, if none failed) is replayed within the test process.
+ *
+ * If \c threads_number or \c iterations are not positive, no thread is spawned and the snapshot fails.
+ *
+ * @param[inout] model the model to handle
+ * @param[in] function the function every thread runs at every iteration
+ * @param[in] threads_number the number of threads to spawn
+ * @param[in] iterations the number of times each thread calls \c function
+ */
+void ct_run_stress(struct ct_model* model, ct_stress_c function, int threads_number, long iterations);
+
+/**
+ * Runs a stress test serializing its threads with the interleaving generated by a seed
+ *
+ * The measurements are stored in struct ct_model::current_snapshot, but the assertions of the threads are left in struct ct_model::thread_assert_reports
+ *
+ * @param[inout] model the model to handle
+ * @param[in] function the function every thread runs at every iteration
+ * @param[in] threads_number the number of threads to spawn
+ * @param[in] iterations the number of times each thread calls \c function
+ * @param[in] seed the seed generating the thread interleaving
+ * @return @true if no thread has failed, @false otherwise
+ */
+bool ct_run_stress_schedule(struct ct_model* model, ct_stress_c function, int threads_number, long iterations, long seed);
+
+/**
+ * Releases from memory a stress report
+ *
+ * @param[inout] report the report to dispose of
+ */
+void ct_destroy_stress_report(struct ct_stress_report* report);
+
+#endif /* STRESS_H_ */
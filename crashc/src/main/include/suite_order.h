@@ -0,0 +1,79 @@
+/**
+ * @file
+ *
+ * Chooses the order the @testsuite are run in
+ *
+ * By default the @testsuite are run in the order they have been registered. With the \c --order command line option they are sorted
+ * by what the history file (see progress.h) says about the previous run:
+ * \li \c durations runs first the @testsuite which took longer (the longest processing time first rule), so that the work left at the end,
+ * 	when the processes sharing the run have nothing else to do, is as short as possible;
+ * \li \c failures runs first the @testsuite with the highest ratio of failed tests, so that a broken change is noticed as soon as possible.
+ * In both cases the @testsuite missing from the history file, which have never been timed, are run first, in registration order.
+ *
+ * The \c durations order pays off when several processes share the run: within a single process the total time doesn't change.
+ * In a distributed run (see distribution.h) the order is computed by the coordinator, from its own history file, and sent to every worker,
+ * so that the workers claim the @testcase in the priority the coordinator has chosen. The coordinator keeps the history file up to date
+ * with the tests it receives.
+ *
+ * The @testcase inside a @testsuite are statements of its body, so they are always run in the order they are written.
+ *
+ * The order doesn't change the report: when every test has ended, the tests are sorted back into the order they would have had without the option.
+ *
+ * @author koldar
+ * @date Oct 19, 2026
+ */
+
+#ifndef SUITE_ORDER_H_
+#define SUITE_ORDER_H_
+
+#include <stdbool.h>
+
+#include "typedefs.h"
+
+/**
+ * The criteria the @testsuite can be sorted with
+ */
+enum ct_suite_order {
+	/**
+	 * The @testsuite are run in registration order
+	 */
+	CT_ORDER_DECLARATION,
+	/**
+	 * The @testsuite which took longer in the previous run are run first
+	 */
+	CT_ORDER_DURATION,
+	/**
+	 * The @testsuite with the highest ratio of failed tests in the previous run are run first
+	 */
+	CT_ORDER_FAILURES
+};
+
+/**
+ * Parses the name of an order, as given to the \c --order command line option
+ *
+ * @param[in] name either \c "declaration", \c "durations" or \c "failures"
+ * @param[out] order the order named by \c name
+ * @return @true if \c name is valid, @false otherwise
+ */
+bool ct_parse_suite_order(const char* name, enum ct_suite_order* order);
+
+/**
+ * Sorts struct ct_model::suites_order with struct ct_model::suite_order
+ *
+ * Nothing is done in a worker of a distributed run, which receives the order from its coordinator.
+ *
+ * \pre
+ * 	\li every @testsuite has been registered
+ *
+ * @param[inout] model the model to handle
+ */
+void ct_order_suites(struct ct_model* model);
+
+/**
+ * Sorts the tests in struct ct_model::test_reports_list as if the @testsuite had been run in registration order
+ *
+ * @param[inout] model the model to handle
+ */
+void ct_restore_declaration_order(struct ct_model* model);
+
+#endif /* SUITE_ORDER_H_ */
@@ -99,7 +99,7 @@ int ct_string_hash(const char* str);
  * @param[in] str the string where we need to fetch the next token
  * @param[in] separator a character representing when a token ends and when it starts
  * @param[in] characters_to_ignore a string containing a list of characters we can safely ignore in \c str
- * @param[inout] output a buffer that will contain the token just read
+ * @param[inout] output a buffer that will contain the token just read. It needs to be big enough to contain the whole token
  * @return the first character of the next new token or 0 if we reached the end of the string
  */
 const char* ct_next_tag_in_string(const char* const str, char separator, char* characters_to_ignore, char* output);
@@ -110,10 +110,27 @@ const char* ct_next_tag_in_string(const char* const str, char separator, char* c
  * \post
  * 	\li \c output size increased
  *
+ * Tags have no length limit. Empty tags (generated by 2 consecutive separators or by a separator at the beginning or at the end of \c tags)
+ * make \c tags malformed: they are ignored, but the other tags are still added.
+ *
  * @param[inout] output the hashtable where to add every tag found in \c tags
  * @param[in] tags a string containing tags, each of them separated by \c separator
  * @param[in] separator a character separating 2 tags. No double separators allowed
+ * @return @true if \c tags is well formed, @false otherwise
+ */
+bool ct_tag_ht_populate(ct_tag_hashtable_o* output, const char* const tags, char separator);
+
+/**
+ * Fetch the number a tag associates to a key
+ *
+ * Such a tag has the form <tt>key:number</tt>, optionally enclosed in square brackets (e.g. \c "[max_allocs:0]").
+ * Tags with the key but without a valid number are ignored.
+ *
+ * @param[in] tags the hashtable to look into
+ * @param[in] key the key of the tag to look for
+ * @param[out] value the number the tag associates to \c key. Untouched if there is no such tag
+ * @return @true if \c tags contains a tag associating a number to \c key, @false otherwise
  */
-void ct_tag_ht_populate(ct_tag_hashtable_o* output, const char* const tags, char separator);
+bool ct_tag_ht_get_number(const ct_tag_hashtable_o* tags, const char* key, long* value);
 
 #endif /* TAG_H_ */
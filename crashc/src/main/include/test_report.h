@@ -18,6 +18,7 @@
 #include "errors.h"
 #include "tag.h"
 #include "typedefs.h"
+#include "flaky.h"
 
 /**
  * Represents the possible outcomes of a single test:
@@ -91,13 +92,43 @@ struct ct_test_report {
 	  */
 	 enum ct_test_outcome outcome;
 	/**
-	 * The time that it took to complete the test
+	 * The time, in microseconds, that it took to complete the test, even if it has been interrupted
 	 *
 	 * Note that execution times might be higher than expected due to the necessary
 	 * overhead introduced by the internal code created by @crashc to properly
 	 * guide the tests' execution flow
 	 */
 	long execution_time;
+	/**
+	 * The file containing the input of the ::FUZZ_TESTCASE this test belongs to
+	 *
+	 * @null if the test doesn't belong to a ::FUZZ_TESTCASE or its input doesn't come from a file
+	 */
+	char* fuzz_input;
+	/**
+	 * The repetition which generated this test, starting from 0. See flaky.h
+	 */
+	int repetition;
+	/**
+	 * The index, in struct ct_model::tests_array, of the @testsuite which generated this test. See suite_order.h
+	 */
+	int suite;
+	/**
+	 * The report of the same test generated by the next repetition. @null if this is the last repetition of the test
+	 */
+	struct ct_test_report* next_repetition;
+	/**
+	 * How the test behaved across all its repetitions
+	 *
+	 * Available only in the report of the first repetition of a test, and only if the tests have been repeated; @null otherwise
+	 */
+	struct ct_flakiness* flakiness;
+	/**
+	 * What the test has written on the standard output and on the standard error (see output_capture.h)
+	 *
+	 * Available only if the test has failed and the output has been captured; @null otherwise
+	 */
+	char* output;
 };
 
 /**
@@ -144,6 +175,18 @@ void ct_destroy_snapshot_tree(struct ct_snapshot* snapshot);
  */
 struct ct_snapshot* ct_add_snapshot_to_tree(struct ct_snapshot* to_add, struct ct_snapshot* tree);
 
+/**
+ * Attaches to a snapshot the backtrace captured when a fatal signal has been detected
+ *
+ * \note
+ * The frames are copied, hence \c frames can be safely reused after the call
+ *
+ * @param[inout] snapshot the snapshot where the signal has been raised
+ * @param[in] frames the return addresses of the stack frames
+ * @param[in] frames_number the number of cells in \c frames
+ */
+void ct_snapshot_set_backtrace(struct ct_snapshot* snapshot, void* const* frames, int frames_number);
+
 /**
  * Checks the status of the section associated to a given snapshot in order to change coherently the status of the snapshot.
  *
@@ -0,0 +1,177 @@
+/**
+ * @file
+ *
+ * Module allowing the code under test to use assertions from threads other than the one running the tests
+ *
+ * @crashc runs every test on a single thread, called **main thread**: it's the only one which owns struct ct_model::current_section,
+ * struct ct_model::current_snapshot and struct ct_model::jump_point. Threads spawned by the code under test (**worker threads**) never touch them:
+ * \li every worker thread spawned while the executable is linked with <tt>-Wl,--wrap=pthread_create</tt> gets its own struct ct_thread_context,
+ * 	which holds its jump point, its alternate signal stack and the snapshot it works for, namely the one running when the thread has been spawned;
+ * \li every assertion a worker thread performs is published, without any lock nor allocation, in a stack inside the model. The main thread moves the
+ * 	published assertions into the snapshot of a @containablesection when such section ends;
+ * \li a failed assertion on a worker thread terminates the worker thread only (just like \c pthread_exit). The failure is then propagated
+ * 	to the @testcase owning the section;
+ * \li a fatal signal raised on a worker thread is recorded and the worker thread jumps back to where it has been started, terminating.
+ * 	The snapshot of the section is then marked as signaled. A worker thread without a struct ct_thread_context has nowhere to jump back to:
+ * 	in that case the signal terminates the whole process;
+ * \li the allocations of a worker thread are accounted to the snapshot it works for, under the lock of the allocation tracker.
+ *
+ * Since assertions are merged when a section ends, join the threads you spawn before the section where they have been spawned ends.
+ *
+ * @author koldar
+ * @date Oct 19, 2026
+ */
+
+#ifndef THREAD_CONTEXT_H_
+#define THREAD_CONTEXT_H_
+
+#include <stdbool.h>
+#include <signal.h>
+#include <setjmp.h>
+#include <pthread.h>
+
+#include "typedefs.h"
+
+/**
+ * A cell of the stack containing the assertions performed by worker threads
+ *
+ * The cell is allocated together with its assertion, when the assertion starts, so that publishing it doesn't need any allocation
+ */
+struct ct_thread_assert_report {
+	/**
+	 * The assertion performed by a worker thread
+	 */
+	struct ct_assert_report* report;
+	/**
+	 * The assertion published just before this one. @null if this is the oldest one
+	 */
+	struct ct_thread_assert_report* next;
+};
+
+/**
+ * The state of a worker thread spawned via the wrapper of \c pthread_create
+ */
+struct ct_thread_context {
+	/**
+	 * The function the thread runs
+	 */
+	void* (*start)(void*);
+	/**
+	 * The argument of struct ct_thread_context::start
+	 */
+	void* arg;
+	/**
+	 * The snapshot the thread works for, i.e. the one the spawning thread was working for. @null if no test was running
+	 */
+	struct ct_snapshot* snapshot;
+	/**
+	 * Where the thread jumps back when it raises a fatal signal
+	 *
+	 * It's set just before struct ct_thread_context::start is called. A function running on the thread can set it again
+	 * to handle the signal by itself (for example, to release what other threads are waiting for): it's never restored.
+	 */
+	sigjmp_buf jump_point;
+	/**
+	 * The alternate stack where the signal handler runs on this thread
+	 */
+	stack_t signal_stack;
+};
+
+/**
+ * Checks if the calling thread is the one running the tests
+ *
+ * @param[in] model the model to handle
+ * @return @true if the calling thread is the main thread of \c model, @false if it's a worker thread
+ */
+bool ct_is_main_thread(const struct ct_model* model);
+
+/**
+ * Fetches the context of the calling thread
+ *
+ * The function is async-signal-safe.
+ *
+ * @return the context of the calling thread or @null if the calling thread is the main thread or it hasn't been spawned via the wrapper of \c pthread_create
+ */
+struct ct_thread_context* ct_get_thread_context();
+
+/**
+ * Fetches the snapshot the calling thread works for
+ *
+ * @param[in] model the model to handle
+ * @return struct ct_model::current_snapshot on the main thread, struct ct_thread_context::snapshot on a worker thread with a context, @null otherwise
+ */
+struct ct_snapshot* ct_get_thread_snapshot(const struct ct_model* model);
+
+/**
+ * Spawns a thread with its own struct ct_thread_context
+ *
+ * The linker calls it in place of \c pthread_create when the executable is linked with <tt>-Wl,--wrap=pthread_create</tt>. The arguments and
+ * the return value are the ones of \c pthread_create.
+ */
+int __wrap_pthread_create(pthread_t* thread, const pthread_attr_t* attr, void* (*start)(void*), void* arg);
+
+/**
+ * Terminates the calling worker thread after a fatal signal, by jumping back to struct ct_thread_context::jump_point
+ *
+ * The function is async-signal-safe. It returns only if the calling thread has no context, i.e. it has nowhere to jump back to.
+ *
+ * @param[in] code the value ::sigsetjmp returns after the jump
+ */
+void ct_thread_jump_back(int code);
+
+/**
+ * Prepares the cell which will publish an assertion performed by a worker thread
+ *
+ * @param[in] report the assertion which is starting
+ * @return the cell containing \c report
+ */
+struct ct_thread_assert_report* ct_init_thread_assert_report(struct ct_assert_report* report);
+
+/**
+ * Makes an assertion performed by a worker thread visible to the main thread
+ *
+ * The function is lock-free and doesn't allocate memory. After this call the worker thread can't touch \c cell nor its assertion anymore.
+ *
+ * @param[inout] model the model to handle
+ * @param[in] cell the cell containing the assertion to publish, built by ::ct_init_thread_assert_report
+ */
+void ct_publish_thread_assert_report(struct ct_model* model, struct ct_thread_assert_report* cell);
+
+/**
+ * Records a fatal signal raised on a worker thread
+ *
+ * Only the first signal is recorded until the main thread merges it. The function is async-signal-safe.
+ *
+ * @param[inout] model the model to handle
+ * @param[in] signum the signal raised
+ * @param[in] info additional information about the signal
+ */
+void ct_record_thread_signal(struct ct_model* model, int signum, const siginfo_t* info);
+
+/**
+ * Checks if a mandatory assertion published by worker threads has failed or if a worker thread has raised a signal
+ *
+ * The published assertions are left untouched.
+ *
+ * \note
+ * Call this function only from the main thread, when no worker thread is running
+ *
+ * @param[in] model the model to handle
+ * @return @true if a worker thread has failed, @false otherwise
+ */
+bool ct_thread_reports_have_failed(const struct ct_model* model);
+
+/**
+ * Moves every assertion and signal published by worker threads so far into a snapshot
+ *
+ * If a mandatory assertion has failed or a signal has been raised, the snapshot and the running test are marked as failed.
+ *
+ * \note
+ * Call this function only from the main thread
+ *
+ * @param[inout] model the model to handle
+ * @param[inout] snapshot the snapshot where to move the assertions. If @null, the published assertions and signals are simply discarded
+ */
+void ct_merge_thread_reports(struct ct_model* model, struct ct_snapshot* snapshot);
+
+#endif /* THREAD_CONTEXT_H_ */
@@ -14,6 +14,7 @@ struct ct_model;
 struct ct_section;
 struct ct_test_report;
 struct ct_snapshot;
+struct ct_assert_report;
 
 /**
  * Represents the signature of a function which release a structure from the memory
@@ -28,6 +29,15 @@ typedef void (*ct_destroyer_c)(const void* obj);
  */
 typedef void (*ct_test_c)(void);
 
+/**
+ * Function signature of the code run by every thread of a stress test
+ *
+ * @param[in] thread_id the index of the thread calling the function, from 0 to the number of threads of the stress test (excluded)
+ * @param[in] iteration the iteration the thread is performing, from 0 to the number of iterations of the stress test (excluded)
+ * @see STRESS
+ */
+typedef void (*ct_stress_c)(int thread_id, long iteration);
+
 /**
  * Function signature for a teardown function parameter
  *
@@ -81,6 +91,59 @@ typedef void (*ct_summary_reporter_c)(struct ct_model* model);
  */
 typedef void (*ct_assert_reporter_c)(struct ct_model* model, struct ct_snapshot* snapshot, int level);
 
+/**
+ * This type defines the function pointer to the function used to produce the report of the backtrace captured when a snapshot raised a signal.
+ *
+ * @param[inout] model the model under analysis
+ * @param[in] snapshot the ::ct_snapshot containing the backtrace. The function is called even if the snapshot has no backtrace at all
+ * @param[in] level the depth (in the snapshot tree) of the \c snapshot
+ */
+typedef void (*ct_backtrace_reporter_c)(struct ct_model* model, struct ct_snapshot* snapshot, int level);
+
+/**
+ * This type defines the function pointer to the function used to produce the report of the operating system resources a snapshot has consumed.
+ *
+ * @param[inout] model the model under analysis
+ * @param[in] snapshot the ::ct_snapshot containing the resource usage. The function is called even if the resource usage has not been measured
+ * @param[in] level the depth (in the snapshot tree) of the \c snapshot
+ */
+typedef void (*ct_resource_usage_reporter_c)(struct ct_model* model, struct ct_snapshot* snapshot, int level);
+
+/**
+ * This type defines the function pointer to the function used to produce the report of the elapsed time and of the hardware events of a snapshot.
+ *
+ * @param[inout] model the model under analysis
+ * @param[in] snapshot the ::ct_snapshot containing the measurements. The function is called even if the snapshot has not been measured
+ * @param[in] level the depth (in the snapshot tree) of the \c snapshot
+ */
+typedef void (*ct_performance_reporter_c)(struct ct_model* model, struct ct_snapshot* snapshot, int level);
+
+/**
+ * This type defines the function pointer to the function used to produce the report of the stress test a snapshot has run.
+ *
+ * @param[inout] model the model under analysis
+ * @param[in] snapshot the ::ct_snapshot containing the stress test measurements. The function is called even if the snapshot has not run any stress test
+ * @param[in] level the depth (in the snapshot tree) of the \c snapshot
+ */
+typedef void (*ct_stress_reporter_c)(struct ct_model* model, struct ct_snapshot* snapshot, int level);
+
+/**
+ * This type defines the function pointer to the function used to produce the report of the benchmark a snapshot has run.
+ *
+ * @param[inout] model the model under analysis
+ * @param[in] snapshot the ::ct_snapshot containing the benchmark measurements. The function is called even if the snapshot has not run any benchmark
+ * @param[in] level the depth (in the snapshot tree) of the \c snapshot
+ */
+typedef void (*ct_benchmark_reporter_c)(struct ct_model* model, struct ct_snapshot* snapshot, int level);
+
+/**
+ * This type defines the function pointer to the function used to produce the report of how a test behaved across its repetitions.
+ *
+ * @param[inout] model the model under analysis
+ * @param[in] test_report the report of a repetition of the test. The function is called even if the tests have not been repeated
+ */
+typedef void (*ct_flakiness_reporter_c)(struct ct_model* model, struct ct_test_report* test_report);
+
 /**
  * function pointer type used to create the whole report by calling the other \ref reportFunctionType.
  *
@@ -93,4 +156,56 @@ typedef void (*ct_reporter_c)(struct ct_model* model);
 
 ///@}
 
+/**
+ * @defgroup eventListenerType Event listener types
+ * @brief Represents the function types a struct ct_event_listener can subscribe with
+ * @{
+ */
+
+/**
+ * Function called when a @testsuite starts
+ *
+ * @param[inout] model the model under analysis
+ * @param[in] data the data the listener has subscribed with
+ * @param[in] suite_name the id of the @testsuite as passed to ::REG_SUITE
+ */
+typedef void (*ct_suite_start_listener_c)(struct ct_model* model, void* data, const char* suite_name);
+
+/**
+ * Function called when the execution enters in a section
+ *
+ * @param[inout] model the model under analysis
+ * @param[in] data the data the listener has subscribed with
+ * @param[in] section the section just entered
+ */
+typedef void (*ct_section_enter_listener_c)(struct ct_model* model, void* data, struct ct_section* section);
+
+/**
+ * Function called when an assertion fails
+ *
+ * @param[inout] model the model under analysis
+ * @param[in] data the data the listener has subscribed with
+ * @param[in] report the report of the failed assertion
+ */
+typedef void (*ct_assert_fail_listener_c)(struct ct_model* model, void* data, struct ct_assert_report* report);
+
+/**
+ * Function called when a test ends, either normally or because of a failed assertion or a signal
+ *
+ * @param[inout] model the model under analysis
+ * @param[in] data the data the listener has subscribed with
+ * @param[in] report the report of the test, whose outcome is final
+ */
+typedef void (*ct_test_end_listener_c)(struct ct_model* model, void* data, struct ct_test_report* report);
+
+/**
+ * Function called when every @testsuite has been run, before the report is produced
+ *
+ * @param[inout] model the model under analysis
+ * @param[in] data the data the listener has subscribed with
+ */
+typedef void (*ct_run_end_listener_c)(struct ct_model* model, void* data);
+
+///@}
+
 #endif /* TYPEDEFS_H_ */
@@ -1,5 +1,15 @@
 #!/bin/bash
 
+# Builds a single-header version of CrashC.
+#
+# The headers are always visible, while the sources are compiled only where CRASHC_IMPLEMENTATION is defined.
+# Hence exactly one translation unit of a test program (usually the one with TESTS_START) needs to do:
+#
+#	#define CRASHC_IMPLEMENTATION
+#	#include "crashC.all.in.one.h"
+#
+# while every other translation unit just includes the header.
+
 OUTPUT_FOLDER=$1
 OUTPUT_NAME=$2
 C_FOLDER=$3
@@ -28,10 +38,28 @@ cat "${H_FOLDER}/hashtable.h" >> "${OUTPUT_FOLDER}/${OUTPUT_NAME}"
 cat "${H_FOLDER}/list.h" >> "${OUTPUT_FOLDER}/${OUTPUT_NAME}"
 cat "${H_FOLDER}/tag.h" >> "${OUTPUT_FOLDER}/${OUTPUT_NAME}"
 cat "${H_FOLDER}/utils.h" >> "${OUTPUT_FOLDER}/${OUTPUT_NAME}"
+cat "${H_FOLDER}/resource_usage.h" >> "${OUTPUT_FOLDER}/${OUTPUT_NAME}"
+cat "${H_FOLDER}/hardware_counters.h" >> "${OUTPUT_FOLDER}/${OUTPUT_NAME}"
+cat "${H_FOLDER}/stress.h" >> "${OUTPUT_FOLDER}/${OUTPUT_NAME}"
+cat "${H_FOLDER}/benchmark.h" >> "${OUTPUT_FOLDER}/${OUTPUT_NAME}"
 cat "${H_FOLDER}/section.h" >> "${OUTPUT_FOLDER}/${OUTPUT_NAME}"
 cat "${H_FOLDER}/macros.h" >> "${OUTPUT_FOLDER}/${OUTPUT_NAME}"
 cat "${H_FOLDER}/errors.h" >> "${OUTPUT_FOLDER}/${OUTPUT_NAME}"
-cat "${H_FOLDER}/crashc.h" >> "${OUTPUT_FOLDER}/${OUTPUT_NAME}"
+cat "${H_FOLDER}/allocation_tracker.h" >> "${OUTPUT_FOLDER}/${OUTPUT_NAME}"
+cat "${H_FOLDER}/thread_context.h" >> "${OUTPUT_FOLDER}/${OUTPUT_NAME}"
+cat "${H_FOLDER}/schedule.h" >> "${OUTPUT_FOLDER}/${OUTPUT_NAME}"
+cat "${H_FOLDER}/fuzz.h" >> "${OUTPUT_FOLDER}/${OUTPUT_NAME}"
+cat "${H_FOLDER}/flaky.h" >> "${OUTPUT_FOLDER}/${OUTPUT_NAME}"
+cat "${H_FOLDER}/binary_report.h" >> "${OUTPUT_FOLDER}/${OUTPUT_NAME}"
+cat "${H_FOLDER}/events.h" >> "${OUTPUT_FOLDER}/${OUTPUT_NAME}"
+cat "${H_FOLDER}/progress.h" >> "${OUTPUT_FOLDER}/${OUTPUT_NAME}"
+cat "${H_FOLDER}/report_serialization.h" >> "${OUTPUT_FOLDER}/${OUTPUT_NAME}"
+cat "${H_FOLDER}/section_fork.h" >> "${OUTPUT_FOLDER}/${OUTPUT_NAME}"
+cat "${H_FOLDER}/output_capture.h" >> "${OUTPUT_FOLDER}/${OUTPUT_NAME}"
+cat "${H_FOLDER}/journal.h" >> "${OUTPUT_FOLDER}/${OUTPUT_NAME}"
+cat "${H_FOLDER}/distribution.h" >> "${OUTPUT_FOLDER}/${OUTPUT_NAME}"
+cat "${H_FOLDER}/coverage.h" >> "${OUTPUT_FOLDER}/${OUTPUT_NAME}"
+cat "${H_FOLDER}/suite_order.h" >> "${OUTPUT_FOLDER}/${OUTPUT_NAME}"
 cat "${H_FOLDER}/main_model.h" >> "${OUTPUT_FOLDER}/${OUTPUT_NAME}"
 cat "${H_FOLDER}/model.h" >> "${OUTPUT_FOLDER}/${OUTPUT_NAME}"
 cat "${H_FOLDER}/command_line.h" >> "${OUTPUT_FOLDER}/${OUTPUT_NAME}"
@@ -39,13 +67,17 @@ cat "${H_FOLDER}/sig_handling.h" >> "${OUTPUT_FOLDER}/${OUTPUT_NAME}"
 cat "${H_FOLDER}/test_report.h" >> "${OUTPUT_FOLDER}/${OUTPUT_NAME}"
 cat "${H_FOLDER}/report_producer.h" >> "${OUTPUT_FOLDER}/${OUTPUT_NAME}"
 cat "${H_FOLDER}/assertions.h" >> "${OUTPUT_FOLDER}/${OUTPUT_NAME}"
+#the inline functions of crashc.h need every structure of the model
+cat "${H_FOLDER}/crashc.h" >> "${OUTPUT_FOLDER}/${OUTPUT_NAME}"
 
 #the order is irrelevant
 
+echo "#ifdef CRASHC_IMPLEMENTATION" >> "${OUTPUT_FOLDER}/${OUTPUT_NAME}"
+
 echo "*****************"
-echo $(ls ${C_FOLDER} | grep .c)
+echo $(ls ${C_FOLDER} | grep "\.c$")
 echo "*****************"
-for f in `ls ${C_FOLDER} | grep .c`
+for f in `ls ${C_FOLDER} | grep "\.c$"`
 do
 	echo "outputting ${f}..."
 	cat "${C_FOLDER}/${f}" >> "${OUTPUT_FOLDER}/${OUTPUT_NAME}"
@@ -62,9 +94,10 @@ done
 #cat "${C_FOLDER}/sigHandling.c" >> "${OUTPUT_FOLDER}/${OUTPUT_NAME}"
 #cat "${C_FOLDER}/testReport.c" >> "${OUTPUT_FOLDER}/${OUTPUT_NAME}"
 
+echo "#endif /* CRASHC_IMPLEMENTATION */" >> "${OUTPUT_FOLDER}/${OUTPUT_NAME}"
 echo "#endif /* CRASHC_ALL_IN_ONE_H_ */" >> "${OUTPUT_FOLDER}/${OUTPUT_NAME}"
 
 #remove all the includes of crashc
-sed -ie 's/^\s*#include\s*".*"$//g' "${OUTPUT_FOLDER}/${OUTPUT_NAME}"
+sed -i -e 's/^\s*#include\s*".*"$//g' "${OUTPUT_FOLDER}/${OUTPUT_NAME}"
 
 
@@ -95,6 +95,8 @@ static char* ct_testing_snapshot_status_to_s(enum ct_snapshot_status status) {
 		case CT_SNAPSHOT_OK: return "OK";
 		case CT_SNAPSHOT_SIGNALED: return "SIG";
 		case CT_SNAPSHOT_FAILED: return "FAIL";
+		case CT_SNAPSHOT_LEAKED: return "LEAK";
+		case CT_SNAPSHOT_OVER_ALLOCATED: return "OVER";
 		default: return "???";
 	}
 }
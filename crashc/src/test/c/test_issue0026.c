@@ -0,0 +1,84 @@
+/**
+ * @file
+ *
+ * Checks that every fatal signal is detected, even a stack overflow, and that handlers
+ * installed by the program under test are left untouched
+ *
+ * @author koldar
+ * @date Oct 19, 2026
+ */
+
+#ifdef TEST_0026
+
+#include <signal.h>
+#include <stdio.h>
+#include "crashc.h"
+#include "test_checker.h"
+
+static volatile sig_atomic_t user_handler_called = 0;
+
+static void user_sigbus_handler(int signum) {
+	user_handler_called = 1;
+}
+
+/**
+ * The program under test installs its own handler before @crashc is even set up
+ */
+__attribute__((constructor)) static void install_user_handler() {
+	signal(SIGBUS, user_sigbus_handler);
+}
+
+static int overflow_stack(int depth) {
+	volatile char buffer[1024];
+	buffer[0] = (char) depth;
+	return overflow_stack(depth + 1) + buffer[0];
+}
+
+void check_result() {
+	assert_and_reset_test_checker(
+		"NO-1|stack overflow|SIG_2|W1|SIG_ "
+		"NO-1|abort|SIG_ "
+		"NO-1|illegal instruction|SIG_ "
+		"OK-1|user handler|OK_ "
+	);
+
+	struct ct_test_report* report = ct_list_head(ct_model->test_reports_list);
+	struct ct_snapshot* when_snapshot = report->testcase_snapshot->first_child;
+	if (when_snapshot->signal_detected == SIGSEGV && when_snapshot->signal_address != NULL && when_snapshot->backtrace_size > 0) {
+		printf("OK!\n");
+	} else {
+		printf("KO! signal detected was %d\n", when_snapshot->signal_detected);
+	}
+}
+
+TESTS_START
+REG_SUITE(1);
+ct_set_crashc_teardown(check_result);
+TESTS_END
+
+TESTSUITE(1) {
+	setup_testing_producer(ct_model);
+
+	TESTCASE("stack overflow", "") {
+		WHEN("W1", "") {
+			overflow_stack(0);
+		}
+		WHEN("W2", "") {
+		}
+	}
+
+	TESTCASE("abort", "") {
+		abort();
+	}
+
+	TESTCASE("illegal instruction", "") {
+		__builtin_trap();
+	}
+
+	TESTCASE("user handler", "") {
+		raise(SIGBUS);
+		ASSERT(user_handler_called == 1);
+	}
+}
+
+#endif
@@ -0,0 +1,80 @@
+/**
+ * @file
+ *
+ * Checks that the allocations performed by the code under test are counted per snapshot and
+ * that blocks not released by the end of a test make it fail
+ *
+ * @author koldar
+ * @date Oct 19, 2026
+ */
+
+#ifdef TEST_0072
+
+#include <stdio.h>
+#include <stdlib.h>
+#include "crashc.h"
+#include "test_checker.h"
+
+static void* global_block = NULL;
+
+void check_result() {
+	assert_and_reset_test_checker(
+		"OK-1|no leak|OK_2|W1|OK_ "
+		"NO-1|leak|LEAK_ "
+		"OK-1|realloc|OK_ "
+	);
+
+	struct ct_test_report* report = ct_list_head(ct_model->test_reports_list);
+	struct ct_snapshot* testcase_snapshot = report->testcase_snapshot;
+	struct ct_snapshot* when_snapshot = testcase_snapshot->first_child;
+	if (!ct_model->allocation_tracker->enabled) {
+		printf("KO! the allocation tracker is not enabled\n");
+	} else if (testcase_snapshot->allocations != 1 || when_snapshot->allocations != 2 || when_snapshot->allocated_bytes != 30 || when_snapshot->frees != 2) {
+		printf("KO! allocations were %lu and %lu\n", testcase_snapshot->allocations, when_snapshot->allocations);
+	} else {
+		printf("OK!\n");
+	}
+
+	report = ct_list_get(ct_model->test_reports_list, 1);
+	if (report->testcase_snapshot->leaked_blocks == 1 && report->testcase_snapshot->leaked_bytes == 16) {
+		printf("OK!\n");
+	} else {
+		printf("KO! leaked blocks were %lu\n", report->testcase_snapshot->leaked_blocks);
+	}
+
+	free(global_block);
+}
+
+TESTS_START
+REG_SUITE(1);
+ct_set_crashc_teardown(check_result);
+TESTS_END
+
+TESTSUITE(1) {
+	setup_testing_producer(ct_model);
+
+	TESTCASE("no leak", "") {
+		char* outer = malloc(5);
+		WHEN("W1", "") {
+			char* a = malloc(10);
+			char* b = calloc(5, 4);
+			ASSERT(a != NULL && b != NULL);
+			free(a);
+			free(b);
+		}
+		free(outer);
+	}
+
+	TESTCASE("leak", "") {
+		global_block = malloc(16);
+	}
+
+	TESTCASE("realloc", "") {
+		char* a = malloc(4);
+		a = realloc(a, 64);
+		a = realloc(a, 128);
+		free(a);
+	}
+}
+
+#endif
@@ -0,0 +1,85 @@
+/**
+ * @file
+ *
+ * Checks that, when requested, every snapshot measures the operating system resources consumed by its section
+ *
+ * @author koldar
+ * @date Oct 19, 2026
+ */
+
+#ifdef TEST_0073
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "crashc.h"
+#include "test_checker.h"
+#include "utils.h"
+
+#define TOUCHED_BYTES (16 * 1024 * 1024)
+
+static volatile long sink = 0;
+
+void check_result() {
+	assert_and_reset_test_checker(
+		"OK-1|memory|OK_2|W1|OK_ "
+		"OK-1|cpu|OK_ "
+		"NO-1|interrupted|FAIL_ "
+	);
+
+	struct ct_test_report* report = ct_list_get(ct_model->test_reports_list, 0);
+	struct ct_snapshot* when_snapshot = report->testcase_snapshot->first_child;
+	if (report->testcase_snapshot->measurements_taken && when_snapshot->measurements_taken && when_snapshot->resource_usage.minor_faults > 0
+			&& when_snapshot->resource_usage.max_rss_growth > 0 && report->testcase_snapshot->resource_usage.minor_faults >= when_snapshot->resource_usage.minor_faults) {
+		printf("OK!\n");
+	} else {
+		printf("KO! minor faults were %ld\n", when_snapshot->resource_usage.minor_faults);
+	}
+
+	report = ct_list_get(ct_model->test_reports_list, 1);
+	struct ct_resource_usage* usage = &report->testcase_snapshot->resource_usage;
+	if (usage->user_time + usage->system_time > 0) {
+		printf("OK!\n");
+	} else {
+		printf("KO! no CPU time has been measured\n");
+	}
+
+	report = ct_list_get(ct_model->test_reports_list, 2);
+	if (!report->testcase_snapshot->measurements_taken) {
+		printf("OK!\n");
+	} else {
+		printf("KO! resources of an interrupted test should not be measured\n");
+	}
+}
+
+TESTS_START
+REG_SUITE(1);
+ct_set_crashc_teardown(check_result);
+TESTS_END
+
+TESTSUITE(1) {
+	setup_testing_producer(ct_model);
+	ct_model->measure_resources = true;
+
+	TESTCASE("memory", "") {
+		WHEN("W1", "") {
+			char* buffer = malloc(TOUCHED_BYTES);
+			memset(buffer, 1, TOUCHED_BYTES);
+			sink = buffer[TOUCHED_BYTES - 1];
+			free(buffer);
+		}
+	}
+
+	TESTCASE("cpu", "") {
+		struct timespec start = ct_get_time();
+		while (ct_compute_time_gap(start, ct_get_time(), "m") < 20) {
+			sink += 1;
+		}
+	}
+
+	TESTCASE("interrupted", "") {
+		ASSERT(sink < 0);
+	}
+}
+
+#endif
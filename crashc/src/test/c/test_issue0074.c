@@ -0,0 +1,78 @@
+/**
+ * @file
+ *
+ * Checks that every snapshot measures its elapsed time and, when the hardware counters are requested and available, the hardware events.
+ * When they are not (e.g. inside a container), the counters need to be marked as unavailable
+ *
+ * @author koldar
+ * @date Oct 19, 2026
+ */
+
+#ifdef TEST_0074
+
+#include <stdio.h>
+#include "crashc.h"
+#include "test_checker.h"
+#include "utils.h"
+
+static volatile long sink = 0;
+
+static void spin(long milliseconds) {
+	struct timespec start = ct_get_time();
+	while (ct_compute_time_gap(start, ct_get_time(), "m") < milliseconds) {
+		sink += 1;
+	}
+}
+
+void check_result() {
+	assert_and_reset_test_checker(
+		"OK-1|kernel|OK_2|W1|OK_ "
+	);
+
+	struct ct_test_report* report = ct_list_head(ct_model->test_reports_list);
+	struct ct_snapshot* testcase_snapshot = report->testcase_snapshot;
+	struct ct_snapshot* when_snapshot = testcase_snapshot->first_child;
+
+	if (when_snapshot->elapsed_time >= 20000 && testcase_snapshot->elapsed_time >= when_snapshot->elapsed_time + 10000) {
+		printf("OK!\n");
+	} else {
+		printf("KO! elapsed times were %ld and %ld\n", testcase_snapshot->elapsed_time, when_snapshot->elapsed_time);
+	}
+
+	struct ct_hardware_counters* counters = &when_snapshot->hardware_counters;
+	if (ct_model->hardware_counters->available) {
+		if (counters->instructions > 0 || counters->cycles > 0) {
+			printf("OK!\n");
+		} else {
+			printf("KO! no hardware event has been counted\n");
+		}
+	} else {
+		if (counters->instructions == CT_HARDWARE_COUNTER_UNAVAILABLE && counters->cycles == CT_HARDWARE_COUNTER_UNAVAILABLE
+				&& counters->cache_misses == CT_HARDWARE_COUNTER_UNAVAILABLE && counters->branch_misses == CT_HARDWARE_COUNTER_UNAVAILABLE) {
+			printf("OK!\n");
+		} else {
+			printf("KO! counters should be unavailable\n");
+		}
+	}
+}
+
+TESTS_START
+REG_SUITE(1);
+ct_set_crashc_teardown(check_result);
+TESTS_END
+
+TESTSUITE(1) {
+	setup_testing_producer(ct_model);
+	if (ct_model->hardware_counters == NULL) {
+		ct_model->hardware_counters = ct_init_hardware_counters_group();
+	}
+
+	TESTCASE("kernel", "") {
+		spin(10);
+		WHEN("W1", "") {
+			spin(20);
+		}
+	}
+}
+
+#endif
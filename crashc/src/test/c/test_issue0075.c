@@ -0,0 +1,156 @@
+/**
+ * @file
+ *
+ * Checks that assertions, signals and allocations of threads spawned by the code under test are recorded and propagated to the owning test,
+ * even when a thread overflows its stack or a thread of a stress test crashes
+ *
+ * @author koldar
+ * @date Oct 19, 2026
+ */
+
+#ifdef TEST_0075
+
+#include <stdio.h>
+#include <pthread.h>
+#include "crashc.h"
+#include "test_checker.h"
+
+#define THREADS_NUMBER 4
+#define ASSERTIONS_PER_THREAD 25
+
+static volatile int reached_after_failure = 0;
+
+static void* passing_worker(void* arg) {
+	for (int i = 0; i < ASSERTIONS_PER_THREAD; i++) {
+		ASSERT(i >= 0);
+	}
+	return NULL;
+}
+
+static void* failing_worker(void* arg) {
+	ASSERT(arg == NULL);
+	reached_after_failure = 1;
+	return NULL;
+}
+
+static void* crashing_worker(void* arg) {
+	volatile int* pointer = arg;
+	*pointer = 1;
+	reached_after_failure = 1;
+	return NULL;
+}
+
+static void* allocating_worker(void* arg) {
+	free(malloc(16));
+	return NULL;
+}
+
+static int overflow(volatile int depth) {
+	volatile char frame[1024];
+	frame[0] = (char) depth;
+	return overflow(depth + 1) + frame[0];
+}
+
+static void* overflowing_worker(void* arg) {
+	reached_after_failure = overflow(0);
+	return NULL;
+}
+
+static void crash_first_thread(int thread_id, long iteration) {
+	if (thread_id == 0) {
+		volatile int* pointer = NULL;
+		*pointer = 1;
+	}
+}
+
+static void run_threads(void* (*worker)(void*), void* arg, int threads_number) {
+	pthread_t threads[THREADS_NUMBER];
+	for (int i = 0; i < threads_number; i++) {
+		pthread_create(&threads[i], NULL, worker, arg);
+	}
+	for (int i = 0; i < threads_number; i++) {
+		pthread_join(threads[i], NULL);
+	}
+}
+
+void check_result() {
+	assert_and_reset_test_checker(
+		"OK-1|passing threads|OK_ "
+		"NO-1|failing thread|FAIL_2|W1|FAIL_ "
+		"OK-1|failing thread|OK_2|W2|OK_ "
+		"NO-1|crashing thread|SIG_ "
+		"OK-1|allocating threads|OK_ "
+		"NO-1|overflowing thread|SIG_ "
+		"NO-1|crashing stress thread|SIG_2|crash|SIG_ "
+	);
+
+	struct ct_test_report* report = ct_list_get(ct_model->test_reports_list, 0);
+	if (ct_list_size(report->testcase_snapshot->assertion_reports) == THREADS_NUMBER * ASSERTIONS_PER_THREAD) {
+		printf("OK!\n");
+	} else {
+		printf("KO! %d assertions have been recorded\n", ct_list_size(report->testcase_snapshot->assertion_reports));
+	}
+
+	report = ct_list_get(ct_model->test_reports_list, 3);
+	if (report->testcase_snapshot->signal_detected == SIGSEGV && reached_after_failure == 0) {
+		printf("OK!\n");
+	} else {
+		printf("KO! signal detected was %d\n", report->testcase_snapshot->signal_detected);
+	}
+
+	report = ct_list_get(ct_model->test_reports_list, 4);
+	if (report->testcase_snapshot->allocations == THREADS_NUMBER && report->testcase_snapshot->frees == THREADS_NUMBER) {
+		printf("OK!\n");
+	} else {
+		printf("KO! the threads have allocated %lu blocks and released %lu\n", report->testcase_snapshot->allocations, report->testcase_snapshot->frees);
+	}
+
+	//the cleanup handler of the crashed thread has recorded when it stopped
+	report = ct_list_get(ct_model->test_reports_list, 6);
+	struct ct_stress_report* stress = report->testcase_snapshot->first_child->stress;
+	if (stress != NULL && stress->threads[0].completed_iterations == 0 && stress->threads[0].elapsed_time >= 0 && stress->threads[0].elapsed_time < 10000000000L) {
+		printf("OK!\n");
+	} else {
+		printf("KO! the crashed thread of the stress test has not been terminated properly\n");
+	}
+}
+
+TESTS_START
+REG_SUITE(1);
+ct_set_crashc_teardown(check_result);
+TESTS_END
+
+TESTSUITE(1) {
+	setup_testing_producer(ct_model);
+
+	TESTCASE("passing threads", "") {
+		run_threads(passing_worker, NULL, THREADS_NUMBER);
+	}
+
+	TESTCASE("failing thread", "") {
+		WHEN("W1", "") {
+			run_threads(failing_worker, (void*) &reached_after_failure, 1);
+		}
+		WHEN("W2", "") {
+			ASSERT(reached_after_failure == 0);
+		}
+	}
+
+	TESTCASE("crashing thread", "") {
+		run_threads(crashing_worker, NULL, 1);
+	}
+
+	TESTCASE("allocating threads", "") {
+		run_threads(allocating_worker, NULL, THREADS_NUMBER);
+	}
+
+	TESTCASE("overflowing thread", "") {
+		run_threads(overflowing_worker, NULL, 1);
+	}
+
+	TESTCASE("crashing stress thread", "") {
+		EZ_STRESS("crash", THREADS_NUMBER, 10, crash_first_thread);
+	}
+}
+
+#endif
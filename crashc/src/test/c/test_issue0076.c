@@ -0,0 +1,118 @@
+/**
+ * @file
+ *
+ * Checks that STRESS runs its function concurrently on every thread, collects the assertions of every thread
+ * and measures throughput and latency, even when a thread runs more iterations than the latencies it keeps.
+ * Stress tests without threads or iterations need to fail
+ *
+ * @author koldar
+ * @date Oct 19, 2026
+ */
+
+#ifdef TEST_0076
+
+#include <stdio.h>
+#include "crashc.h"
+#include "test_checker.h"
+
+#define THREADS_NUMBER 4
+#define ITERATIONS 1000
+#define FAILING_THREAD 2
+#define FAILING_ITERATION 10
+
+static long counter = 0;
+
+static void increment(int thread_id, long iteration) {
+	long old_value = __atomic_fetch_add(&counter, 1, __ATOMIC_RELAXED);
+	ASSERT(old_value >= 0);
+}
+
+static void fail_once(int thread_id, long iteration) {
+	ASSERT(thread_id != FAILING_THREAD || iteration != FAILING_ITERATION);
+}
+
+static void do_nothing(int thread_id, long iteration) {
+
+}
+
+void check_result() {
+	assert_and_reset_test_checker(
+		"OK-1|stress|OK_2|counter|OK_ "
+		"NO-1|failing stress|FAIL_2|failing|FAIL_ "
+		"OK-1|long stress|OK_2|long|OK_ "
+		"NO-1|invalid stress|FAIL_2|no threads|FAIL_ "
+		"NO-1|no iterations|FAIL_2|no iterations|FAIL_ "
+	);
+
+	struct ct_test_report* report = ct_list_get(ct_model->test_reports_list, 0);
+	struct ct_snapshot* stress_snapshot = report->testcase_snapshot->first_child;
+	struct ct_stress_report* stress = stress_snapshot->stress;
+	if (counter == THREADS_NUMBER * ITERATIONS && stress != NULL && stress->threads_number == THREADS_NUMBER
+			&& ct_list_size(stress_snapshot->assertion_reports) == THREADS_NUMBER * ITERATIONS
+			&& stress->latency_p50 <= stress->latency_p99 && stress->latency_p99 <= stress->latency_p999 && stress->latency_p999 <= stress->max_latency) {
+		printf("OK!\n");
+	} else {
+		printf("KO! counter was %ld\n", counter);
+	}
+
+	bool all_completed = true;
+	for (int i = 0; i < THREADS_NUMBER; i++) {
+		all_completed = all_completed && stress->threads[i].completed_iterations == ITERATIONS && stress->threads[i].throughput > 0;
+	}
+	printf(all_completed ? "OK!\n" : "KO! some thread did not complete\n");
+
+	report = ct_list_get(ct_model->test_reports_list, 1);
+	stress = report->testcase_snapshot->first_child->stress;
+	if (stress->threads[FAILING_THREAD].completed_iterations == FAILING_ITERATION && stress->threads[0].completed_iterations == ITERATIONS) {
+		printf("OK!\n");
+	} else {
+		printf("KO! failing thread completed %ld iterations\n", stress->threads[FAILING_THREAD].completed_iterations);
+	}
+
+	report = ct_list_get(ct_model->test_reports_list, 2);
+	stress = report->testcase_snapshot->first_child->stress;
+	if (stress->threads[0].completed_iterations == 3 * CT_STRESS_LATENCY_SAMPLES && stress->latency_p50 <= stress->latency_p99
+			&& stress->latency_p99 <= stress->latency_p999 && stress->latency_p999 <= stress->max_latency) {
+		printf("OK!\n");
+	} else {
+		printf("KO! the latencies of a long stress test are inconsistent\n");
+	}
+
+	report = ct_list_get(ct_model->test_reports_list, 3);
+	if (report->testcase_snapshot->first_child->stress == NULL) {
+		printf("OK!\n");
+	} else {
+		printf("KO! a stress test without threads has been run\n");
+	}
+}
+
+TESTS_START
+REG_SUITE(1);
+ct_set_crashc_teardown(check_result);
+TESTS_END
+
+TESTSUITE(1) {
+	setup_testing_producer(ct_model);
+
+	TESTCASE("stress", "") {
+		STRESS("counter", "", THREADS_NUMBER, ITERATIONS, increment);
+	}
+
+	TESTCASE("failing stress", "") {
+		EZ_STRESS("failing", THREADS_NUMBER, ITERATIONS, fail_once);
+	}
+
+	TESTCASE("long stress", "") {
+		EZ_STRESS("long", 1, 3 * CT_STRESS_LATENCY_SAMPLES, do_nothing);
+	}
+
+	TESTCASE("invalid stress", "") {
+		EZ_STRESS("no threads", 0, ITERATIONS, increment);
+	}
+
+	TESTCASE("no iterations", "") {
+		EZ_STRESS("no iterations", THREADS_NUMBER, -1, increment);
+	}
+}
+
+#endif
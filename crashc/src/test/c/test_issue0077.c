@@ -0,0 +1,118 @@
+/**
+ * @file
+ *
+ * Checks that the schedule exploration of STRESS finds a check-then-act race, replays the failing seed deterministically
+ * and lets a correctly locked version pass every seed
+ *
+ * @author koldar
+ * @date Oct 19, 2026
+ */
+
+#ifdef TEST_0077
+
+#include <stdio.h>
+#include <pthread.h>
+#include <unistd.h>
+#include <sys/wait.h>
+#include "crashc.h"
+#include "test_checker.h"
+
+#define THREADS_NUMBER 2
+#define ITERATIONS 1
+#define SEEDS 64
+
+static long balance = 1;
+static pthread_mutex_t balance_lock = PTHREAD_MUTEX_INITIALIZER;
+static int own_child_status = -1;
+
+static void racy_withdraw(int thread_id, long iteration) {
+	if (balance > 0) {
+		ct_yield();
+		balance -= 1;
+	}
+	ASSERT(balance >= 0);
+}
+
+static void locked_withdraw(int thread_id, long iteration) {
+	ct_mutex_lock(&balance_lock);
+	if (balance > 0) {
+		ct_yield();
+		balance -= 1;
+	}
+	ASSERT(balance >= 0);
+	ct_mutex_unlock(&balance_lock);
+}
+
+void check_result() {
+	assert_and_reset_test_checker(
+		"NO-1|racy|FAIL_2|withdraw|FAIL_ "
+		"OK-1|locked|OK_2|withdraw|OK_ "
+		"NO-1|replay|FAIL_2|withdraw|FAIL_ "
+	);
+
+	struct ct_test_report* report = ct_list_get(ct_model->test_reports_list, 0);
+	struct ct_stress_report* racy = report->testcase_snapshot->first_child->stress;
+	if (racy->explored_schedules == SEEDS && racy->failed_schedules > 0 && racy->failed_schedules < SEEDS && racy->schedule_seed >= 0) {
+		printf("OK!\n");
+	} else {
+		printf("KO! %ld seeds out of %ld failed\n", racy->failed_schedules, racy->explored_schedules);
+	}
+
+	report = ct_list_get(ct_model->test_reports_list, 1);
+	struct ct_stress_report* locked = report->testcase_snapshot->first_child->stress;
+	if (locked->explored_schedules == SEEDS && locked->failed_schedules == 0 && locked->schedule_seed == 0) {
+		printf("OK!\n");
+	} else {
+		printf("KO! %ld seeds failed with the lock\n", locked->failed_schedules);
+	}
+
+	report = ct_list_get(ct_model->test_reports_list, 2);
+	struct ct_stress_report* replay = report->testcase_snapshot->first_child->stress;
+	if (replay->explored_schedules == 0 && replay->schedule_seed == racy->schedule_seed) {
+		printf("OK!\n");
+	} else {
+		printf("KO! seed %ld has not been replayed\n", racy->schedule_seed);
+	}
+
+	if (WIFEXITED(own_child_status) && WEXITSTATUS(own_child_status) == 3) {
+		printf("OK!\n");
+	} else {
+		printf("KO! the child spawned by the test has been reaped by the schedule exploration\n");
+	}
+}
+
+TESTS_START
+REG_SUITE(1);
+ct_set_crashc_teardown(check_result);
+TESTS_END
+
+TESTSUITE(1) {
+	setup_testing_producer(ct_model);
+	ct_model->schedule_seeds = SEEDS;
+
+	TESTCASE("racy", "") {
+		balance = 1;
+		STRESS("withdraw", "", THREADS_NUMBER, ITERATIONS, racy_withdraw);
+	}
+
+	TESTCASE("locked", "") {
+		pid_t own_child = fork();
+		if (own_child == 0) {
+			_exit(3);
+		}
+		balance = 1;
+		STRESS("withdraw", "", THREADS_NUMBER, ITERATIONS, locked_withdraw);
+		waitpid(own_child, &own_child_status, 0);
+	}
+
+	TESTCASE("replay", "") {
+		struct ct_test_report* racy_report = ct_list_get(ct_model->test_reports_list, 0);
+
+		balance = 1;
+		ct_model->schedule_replay_seed = racy_report->testcase_snapshot->first_child->stress->schedule_seed;
+		STRESS("withdraw", "", THREADS_NUMBER, ITERATIONS, racy_withdraw);
+		ct_model->schedule_replay_seed = -1;
+	}
+}
+
+#endif
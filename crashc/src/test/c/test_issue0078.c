@@ -0,0 +1,109 @@
+/**
+ * @file
+ *
+ * Checks that FUZZ_TESTCASE replays every file of a corpus, both splitting it among worker processes
+ * and within the test process, and that a plain TESTCASE is unaffected. Either way, every input has its test
+ *
+ * @author koldar
+ * @date Oct 19, 2026
+ */
+
+#ifdef TEST_0078
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include "crashc.h"
+#include "test_checker.h"
+
+static char corpus[] = "/tmp/crashc_corpus_XXXXXX";
+static int inputs_run = 0;
+
+static void write_input(const char* name, const char* content) {
+	char path[256];
+
+	snprintf(path, sizeof(path), "%s/%s", corpus, name);
+	FILE* f = fopen(path, "w");
+	fputs(content, f);
+	fclose(f);
+}
+
+static void remove_corpus() {
+	const char* names[] = {"bad", "empty", "ok1", "ok2"};
+	char path[256];
+
+	for (int i = 0; i < 4; i++) {
+		snprintf(path, sizeof(path), "%s/%s", corpus, names[i]);
+		unlink(path);
+	}
+	rmdir(corpus);
+}
+
+void check_result() {
+	assert_and_reset_test_checker(
+		"NO-1|parallel|FAIL_ "
+		"OK-1|parallel|OK_ "
+		"OK-1|parallel|OK_ "
+		"OK-1|parallel|OK_ "
+		"NO-1|sequential|FAIL_ "
+		"OK-1|sequential|OK_ "
+		"OK-1|sequential|OK_ "
+		"OK-1|sequential|OK_ "
+		"OK-1|plain|OK_ "
+	);
+
+	struct ct_test_report* report = ct_list_get(ct_model->test_reports_list, 0);
+	const char* suffix = "/bad";
+	if (report->fuzz_input != NULL && strcmp(report->fuzz_input + strlen(report->fuzz_input) - strlen(suffix), suffix) == 0) {
+		printf("OK!\n");
+	} else {
+		printf("KO! the failing input is %s\n", report->fuzz_input);
+	}
+
+	//the parallel replay runs only the failing input in the test process
+	if (inputs_run == 1 + 4) {
+		printf("OK!\n");
+	} else {
+		printf("KO! %d inputs run in the test process\n", inputs_run);
+	}
+
+	remove_corpus();
+}
+
+TESTS_START
+REG_SUITE(1);
+ct_set_crashc_teardown(check_result);
+TESTS_END
+
+TESTSUITE(1) {
+	setup_testing_producer(ct_model);
+
+	if (mkdtemp(corpus) == NULL) {
+		printf("KO! cannot create the corpus\n");
+		return;
+	}
+	write_input("ok1", "hello");
+	write_input("ok2", "world");
+	write_input("bad", "crash!");
+	write_input("empty", "");
+	ct_model->corpus_path = corpus;
+
+	ct_model->workers = 2;
+	FUZZ_TESTCASE("parallel", data, size) {
+		inputs_run += 1;
+		ASSERT(size < 5 || memcmp(data, "crash", 5) != 0);
+	}
+
+	ct_model->workers = 1;
+	FUZZ_TESTCASE("sequential", data, size) {
+		inputs_run += 1;
+		ASSERT(size < 5 || memcmp(data, "crash", 5) != 0);
+	}
+
+	TESTCASE("plain", "") {
+		ASSERT(true);
+	}
+}
+
+#endif
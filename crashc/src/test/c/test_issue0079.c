@@ -0,0 +1,77 @@
+/**
+ * @file
+ *
+ * Checks that repeating the test suites flags as flaky only the tests whose outcome changes among the repetitions
+ *
+ * @author koldar
+ * @date Oct 19, 2026
+ */
+
+#ifdef TEST_0079
+
+#include <stdio.h>
+#include <string.h>
+#include "crashc.h"
+#include "test_checker.h"
+
+static struct ct_test_report* find_first_repetition(const char* description) {
+	CT_ITERATE_ON_LIST(ct_model->test_reports_list, report_cell, report, struct ct_test_report*) {
+		if (report->repetition == 0 && strcmp(report->testcase_snapshot->description, description) == 0) {
+			return report;
+		}
+	}
+	return NULL;
+}
+
+void check_result() {
+	assert_and_reset_test_checker(
+		"OK-1|stable|OK_ OK-1|flaky|OK_ "
+		"OK-1|stable|OK_ NO-1|flaky|FAIL_ "
+		"OK-1|stable|OK_ OK-1|flaky|OK_ "
+		"OK-1|stable|OK_ NO-1|flaky|FAIL_ "
+		"OK-1|stable|OK_ OK-1|flaky|OK_ "
+	);
+
+	struct ct_test_report* stable = find_first_repetition("stable");
+	if (stable != NULL && stable->flakiness != NULL && !stable->flakiness->flaky && stable->flakiness->runs == 5 && stable->flakiness->failed_runs == 0) {
+		printf("OK!\n");
+	} else {
+		printf("KO! stable test wrongly classified\n");
+	}
+
+	struct ct_test_report* flaky = find_first_repetition("flaky");
+	if (flaky != NULL && flaky->flakiness != NULL && flaky->flakiness->flaky && flaky->flakiness->snapshots_diverge && flaky->flakiness->runs == 5 && flaky->flakiness->failed_runs == 2) {
+		printf("OK!\n");
+	} else {
+		printf("KO! flaky test wrongly classified\n");
+	}
+
+	if (ct_model->statistics->flaky_tests == 1) {
+		printf("OK!\n");
+	} else {
+		printf("KO! %d flaky tests\n", ct_model->statistics->flaky_tests);
+	}
+}
+
+TESTS_START
+ct_model->repetitions = 5;
+REG_SUITE(1);
+ct_set_crashc_teardown(check_result);
+TESTS_END
+
+static int runs = 0;
+
+TESTSUITE(1) {
+	setup_testing_producer(ct_model);
+
+	TESTCASE("stable", "") {
+		ASSERT(true);
+	}
+
+	TESTCASE("flaky", "") {
+		runs += 1;
+		ASSERT(runs % 2 == 1);
+	}
+}
+
+#endif
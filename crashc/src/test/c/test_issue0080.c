@@ -0,0 +1,155 @@
+/**
+ * @file
+ *
+ * Checks that the binary event log contains every test, snapshot and assertion in the right order
+ * and that events larger than the buffer of the writer survive
+ *
+ * @author koldar
+ * @date Oct 19, 2026
+ */
+
+#ifdef TEST_0080
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include "crashc.h"
+#include "test_checker.h"
+
+#define BIG_STRING_SIZE (3 * CT_BINARY_WRITER_BUFFER_SIZE)
+
+static unsigned char* read_log(const char* path, size_t* size) {
+	FILE* f = fopen(path, "rb");
+	fseek(f, 0, SEEK_END);
+	*size = ftell(f);
+	fseek(f, 0, SEEK_SET);
+	unsigned char* ret_val = malloc(*size);
+	if (fread(ret_val, 1, *size, f) != *size) {
+		printf("KO! cannot read the log\n");
+	}
+	fclose(f);
+	return ret_val;
+}
+
+static void check_model_log() {
+	char path[] = "/tmp/crashc_log_XXXXXX";
+	int fd = mkstemp(path);
+	close(fd);
+
+	ct_model->binary_report_path = path;
+	ct_binary_report(ct_model);
+
+	size_t size;
+	unsigned char* data = read_log(path, &size);
+	size_t position = ct_binary_log_header_size(data, size);
+	size_t read;
+	struct ct_binary_event event;
+	char kinds[64] = "";
+	char descriptions[256] = "";
+
+	while ((read = ct_read_binary_event(data + position, size - position, &event)) > 0 && strlen(kinds) < sizeof(kinds) - 2) {
+		const char* letters = " TSAEXY";
+		strncat(kinds, &letters[event.kind], 1);
+		if (event.kind == CT_BINARY_EVENT_SNAPSHOT_START) {
+			event.offset = 2 + 4 + 4 + 6 * 8;
+			strcat(descriptions, ct_binary_event_string(&event));
+			strcat(descriptions, ",");
+		}
+		if (event.kind == CT_BINARY_EVENT_SUMMARY) {
+			uint32_t total = ct_binary_event_u32(&event);
+			uint32_t successful = ct_binary_event_u32(&event);
+			uint32_t failed = ct_binary_event_u32(&event);
+			printf((total == 3 && successful == 2 && failed == 1) ? "OK!\n" : "KO! wrong summary\n");
+		}
+		position += read;
+	}
+
+	//T=test start, S=snapshot start, A=assertion, E=snapshot end, X=test end, Y=summary
+	if (position == size && strcmp(kinds, "TSSAEEXTSSAEEXTSAEXY") == 0) {
+		printf("OK!\n");
+	} else {
+		printf("KO! events are %s\n", kinds);
+	}
+	if (strcmp(descriptions, "passing,first,passing,second,failing,") == 0) {
+		printf("OK!\n");
+	} else {
+		printf("KO! descriptions are %s\n", descriptions);
+	}
+
+	free(data);
+	unlink(path);
+}
+
+static void check_big_event() {
+	char path[] = "/tmp/crashc_log_XXXXXX";
+	int fd = mkstemp(path);
+	char* big = malloc(BIG_STRING_SIZE + 1);
+
+	memset(big, 'x', BIG_STRING_SIZE);
+	big[BIG_STRING_SIZE] = '\0';
+
+	struct ct_binary_writer* writer = ct_init_binary_writer(fd);
+	for (int i = 0; i < 3; i++) {
+		ct_binary_writer_start_event(writer, CT_BINARY_EVENT_TEST_START);
+		ct_binary_writer_u32(writer, i);
+		ct_binary_writer_string(writer, (i == 1) ? big : "small");
+		ct_binary_writer_end_event(writer);
+	}
+	ct_binary_writer_flush(writer);
+	ct_destroy_binary_writer(writer);
+	close(fd);
+
+	size_t size;
+	unsigned char* data = read_log(path, &size);
+	size_t position = ct_binary_log_header_size(data, size);
+	size_t read;
+	struct ct_binary_event event;
+	bool ok = position > 0;
+
+	for (uint32_t i = 0; (read = ct_read_binary_event(data + position, size - position, &event)) > 0; i++) {
+		ok = ok && event.kind == CT_BINARY_EVENT_TEST_START && ct_binary_event_u32(&event) == i;
+		ok = ok && strcmp(ct_binary_event_string(&event), (i == 1) ? big : "small") == 0;
+		position += read;
+	}
+	printf((ok && position == size) ? "OK!\n" : "KO! big event corrupted\n");
+
+	free(data);
+	free(big);
+	unlink(path);
+}
+
+void check_result() {
+	assert_and_reset_test_checker(
+		"OK-1|passing|OK_2|first|OK_ "
+		"OK-1|passing|OK_2|second|OK_ "
+		"NO-1|failing|FAIL_ "
+	);
+
+	check_model_log();
+	check_big_event();
+}
+
+TESTS_START
+REG_SUITE(1);
+ct_set_crashc_teardown(check_result);
+TESTS_END
+
+TESTSUITE(1) {
+	setup_testing_producer(ct_model);
+
+	TESTCASE("passing", "") {
+		WHEN("first", "") {
+			ASSERT(true);
+		}
+		WHEN("second", "") {
+			ASSERT(true);
+		}
+	}
+
+	TESTCASE("failing", "") {
+		ASSERT(false);
+	}
+}
+
+#endif
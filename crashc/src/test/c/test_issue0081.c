@@ -0,0 +1,124 @@
+/**
+ * @file
+ *
+ * Checks that listeners are notified of every event in the right order and that the progress listener
+ * estimates the remaining time from the history file and rewrites it
+ *
+ * @author koldar
+ * @date Oct 19, 2026
+ */
+
+#ifdef TEST_0081
+
+#include <stdio.h>
+#include <string.h>
+#include <unistd.h>
+#include "crashc.h"
+#include "test_checker.h"
+
+static char events[512] = "";
+static char history[] = "/tmp/crashc_history_XXXXXX";
+
+static void on_suite_start(struct ct_model* model, void* data, const char* suite_name) {
+	sprintf(events + strlen(events), "S(%s) ", suite_name);
+}
+
+static void on_section_enter(struct ct_model* model, void* data, struct ct_section* section) {
+	sprintf(events + strlen(events), "E(%s) ", section->description);
+}
+
+static void on_assert_fail(struct ct_model* model, void* data, struct ct_assert_report* report) {
+	sprintf(events + strlen(events), "F(%s) ", report->asserted);
+}
+
+static void on_test_end(struct ct_model* model, void* data, struct ct_test_report* report) {
+	sprintf(events + strlen(events), "T(%s:%s) ", report->testcase_snapshot->description, report->outcome == CT_TEST_SUCCESS ? "OK" : "KO");
+}
+
+static void on_run_end(struct ct_model* model, void* data) {
+	//the data of the listener is passed back
+	sprintf(events + strlen(events), "R(%s)", (const char*) data);
+}
+
+static void write_history() {
+	int fd = mkstemp(history);
+	FILE* f = fdopen(fd, "w");
+	fprintf(f, "1000 first\n3000 first\n4000 signal\n2000 gone\n");
+	fclose(f);
+}
+
+void check_result() {
+	assert_and_reset_test_checker(
+		"OK-1|first|OK_2|w1|OK_ "
+		"NO-1|first|FAIL_2|w2|FAIL_ "
+		"NO-1|signal|SIG_ "
+	);
+
+	const char* expected = "S(1) E(first) E(w1) T(first:OK) E(first) E(w2) F(1 == 2) T(first:KO) E(signal) T(signal:KO) R(done)";
+	if (strcmp(events, expected) == 0) {
+		printf("OK!\n");
+	} else {
+		printf("KO! events were %s\n", events);
+	}
+
+	//the history has been loaded: every test of the run matched one of the history
+	struct ct_progress* progress = ct_model->progress;
+	if (progress->expected_tests == 4 && progress->expected_time == 10000 && progress->expected_ended_time == 2000 + 2000 + 4000) {
+		printf("OK!\n");
+	} else {
+		printf("KO! expected %d tests, %ld us, %ld us ended\n", progress->expected_tests, progress->expected_time, progress->expected_ended_time);
+	}
+	//the ended tests were twice as fast as in the history: the remaining 2000 us become 1000 us
+	if (ct_progress_estimate_remaining_time(progress, 4000) == 1000) {
+		printf("OK!\n");
+	} else {
+		printf("KO! estimated %ld us\n", ct_progress_estimate_remaining_time(progress, 4000));
+	}
+
+	//the history file is rewritten at the end of the run with the tests which have just been run
+	FILE* f = fopen(history, "r");
+	char line[256];
+	char descriptions[256] = "";
+	while (fgets(line, sizeof(line), f) != NULL) {
+		//the lines of the test suites are checked by test 0087
+		if (line[0] == 'S') {
+			continue;
+		}
+		strcat(descriptions, strchr(line, ' ') + 1);
+	}
+	fclose(f);
+	unlink(history);
+	if (strcmp(descriptions, "first\nfirst\nsignal\n") == 0) {
+		printf("OK!\n");
+	} else {
+		printf("KO! history contains %s\n", descriptions);
+	}
+}
+
+TESTS_START
+write_history();
+struct ct_event_listener listener = {on_suite_start, on_section_enter, on_assert_fail, on_test_end, on_run_end, "done"};
+ct_subscribe_listener(ct_model, &listener);
+ct_enable_progress(ct_model, NULL, history);
+REG_SUITE(1);
+ct_set_crashc_teardown(check_result);
+TESTS_END
+
+TESTSUITE(1) {
+	setup_testing_producer(ct_model);
+
+	TESTCASE("first", "") {
+		WHEN("w1", "") {
+			ASSERT(1 == 1);
+		}
+		WHEN("w2", "") {
+			ASSERT(1 == 2);
+		}
+	}
+
+	TESTCASE("signal", "") {
+		raise(SIGSEGV);
+	}
+}
+
+#endif
@@ -0,0 +1,130 @@
+/**
+ * @file
+ *
+ * Checks that the tags of a @containablesection are parsed once per site, that malformed tags are reported once
+ * and that tags of any length are parsed correctly
+ *
+ * @author koldar
+ * @date Oct 19, 2026
+ */
+
+#ifdef TEST_0082
+
+#include <stdio.h>
+#include <string.h>
+#include <unistd.h>
+#include "crashc.h"
+#include "test_checker.h"
+#include "tag.h"
+
+static char diagnostics[] = "/tmp/crashc_diagnostics_XXXXXX";
+static ct_tag_hashtable_o* loop_tags[3];
+static int loop_sections = 0;
+
+static void check_parsing() {
+	char token[16];
+	const char* next = ct_next_tag_in_string("a-b-c d", ' ', "-", token);
+	if (strcmp(token, "abc") == 0 && strcmp(next, "d") == 0) {
+		printf("OK!\n");
+	} else {
+		printf("KO! token was \"%s\", next was \"%s\"\n", token, next);
+	}
+
+	//an empty tag makes the string malformed, but the following tags are still added
+	ct_tag_hashtable_o* tags = ct_ht_init();
+	bool well_formed = ct_tag_ht_populate(tags, "a  b c", ' ');
+	if (!well_formed && ct_ht_size(tags) == 3) {
+		printf("OK!\n");
+	} else {
+		printf("KO! well formed %d with %d tags\n", well_formed, ct_ht_size(tags));
+	}
+	ct_ht_destroy_with_elements(tags, (ct_destroyer_c) ct_tag_destroy);
+
+	tags = ct_ht_init();
+	well_formed = ct_tag_ht_populate(tags, "a ", ' ');
+	if (!well_formed && ct_ht_size(tags) == 1) {
+		printf("OK!\n");
+	} else {
+		printf("KO! well formed %d with %d tags\n", well_formed, ct_ht_size(tags));
+	}
+	ct_ht_destroy_with_elements(tags, (ct_destroyer_c) ct_tag_destroy);
+
+	//tags longer than CT_BUFFER_SIZE
+	char long_tags[2 * CT_BUFFER_SIZE + 4];
+	memset(long_tags, 'x', sizeof(long_tags) - 1);
+	long_tags[0] = 'y';
+	long_tags[CT_BUFFER_SIZE + 1] = ' ';
+	long_tags[sizeof(long_tags) - 1] = '\0';
+	tags = ct_ht_init();
+	well_formed = ct_tag_ht_populate(tags, long_tags, ' ');
+	if (well_formed && ct_ht_size(tags) == 2) {
+		printf("OK!\n");
+	} else {
+		printf("KO! well formed %d with %d tags\n", well_formed, ct_ht_size(tags));
+	}
+	ct_ht_destroy_with_elements(tags, (ct_destroyer_c) ct_tag_destroy);
+}
+
+void check_result() {
+	assert_and_reset_test_checker(
+		"OK-1|loop|OK_2|w|OK_ OK-1|loop|OK_2|w|OK_ OK-1|loop|OK_2|w|OK_ "
+		"OK-1|malformed|OK_ "
+		"OK-1|malformed|OK_ "
+	);
+
+	//every section created by the same WHEN shares the same tags
+	if (loop_sections == 3 && loop_tags[0] == loop_tags[1] && loop_tags[1] == loop_tags[2] && ct_ht_size(loop_tags[0]) == 2) {
+		printf("OK!\n");
+	} else {
+		printf("KO! %d sections in the loop\n", loop_sections);
+	}
+
+	//the malformed TESTCASE has been reached twice, but it's reported once
+	fflush(stderr);
+	FILE* f = fopen(diagnostics, "r");
+	char line[512];
+	int reports = 0;
+	while (fgets(line, sizeof(line), f) != NULL) {
+		if (strstr(line, "malformed tags \"A  B\"") != NULL) {
+			reports += 1;
+		}
+	}
+	fclose(f);
+	unlink(diagnostics);
+	if (reports == 1) {
+		printf("OK!\n");
+	} else {
+		printf("KO! malformed tags reported %d times\n", reports);
+	}
+
+	check_parsing();
+}
+
+TESTS_START
+close(mkstemp(diagnostics));
+freopen(diagnostics, "w", stderr);
+REG_SUITE(1);
+ct_set_crashc_teardown(check_result);
+TESTS_END
+
+TESTSUITE(1) {
+	setup_testing_producer(ct_model);
+
+	TESTCASE("loop", "") {
+		for (int i = 0; i < 3; i++) {
+			WHEN("w", "LOOP SHARED") {
+				loop_tags[loop_sections] = ct_model->current_section->tags;
+				loop_sections += 1;
+				ASSERT(i >= 0);
+			}
+		}
+	}
+
+	for (int i = 0; i < 2; i++) {
+		TESTCASE("malformed", "A  B") {
+			ASSERT(ct_ht_size(ct_model->current_section->tags) == 2);
+		}
+	}
+}
+
+#endif
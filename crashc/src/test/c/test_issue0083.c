@@ -0,0 +1,76 @@
+/**
+ * @file
+ *
+ * Checks that selecting a section by its path runs only the section, its ancestors and its descendants
+ * and that sections can be found by their path
+ *
+ * @author koldar
+ * @date Oct 19, 2026
+ */
+
+#ifdef TEST_0083
+
+#include <stdio.h>
+#include <string.h>
+#include "crashc.h"
+#include "test_checker.h"
+
+void check_result() {
+	assert_and_reset_test_checker(
+		"OK-1|list|OK_2|adding on tail|OK_3|size increments|OK_4|twice|OK_ "
+	);
+
+	struct ct_section* section = ct_find_section(ct_model, "list/adding on tail/size increments");
+	if (section != NULL && strcmp(section->description, "size increments") == 0 && section->inside_target) {
+		printf("OK!\n");
+	} else {
+		printf("KO! the selected section has not been found\n");
+	}
+
+	//skipped sections are indexed as well, but they are out of the path
+	section = ct_find_section(ct_model, "list/adding on tail/tail changes");
+	if (section != NULL && !section->on_target_path) {
+		printf("OK!\n");
+	} else {
+		printf("KO! the sibling of the selected section has not been found\n");
+	}
+
+	if (ct_find_section(ct_model, "list/adding on head") != NULL && ct_find_section(ct_model, "list/missing") == NULL) {
+		printf("OK!\n");
+	} else {
+		printf("KO! wrong lookups\n");
+	}
+}
+
+TESTS_START
+ct_select_section_path(ct_model, "list/adding on tail/size increments");
+REG_SUITE(1);
+ct_set_crashc_teardown(check_result);
+TESTS_END
+
+TESTSUITE(1) {
+	setup_testing_producer(ct_model);
+
+	TESTCASE("list", "") {
+		WHEN("adding on head", "") {
+			ASSERT(false);
+		}
+		WHEN("adding on tail", "") {
+			THEN("tail changes", "") {
+				ASSERT(false);
+			}
+			THEN("size increments", "") {
+				ASSERT(true);
+				WHEN("twice", "") {
+					ASSERT(true);
+				}
+			}
+		}
+	}
+
+	TESTCASE("map", "") {
+		ASSERT(false);
+	}
+}
+
+#endif
@@ -0,0 +1,90 @@
+/**
+ * @file
+ *
+ * Checks that running every @when in a forked process reports the same tests as running them in the test process,
+ * while the code preceding the @when sections is run once
+ *
+ * @author koldar
+ * @date Oct 19, 2026
+ */
+
+#ifdef TEST_0084
+
+#include <stdio.h>
+#include <unistd.h>
+#include "crashc.h"
+#include "test_checker.h"
+
+static int prefix_runs = 0;
+
+void check_result() {
+	assert_and_reset_test_checker(
+		"NO-1|list|FAIL_2|empty|OK_3|size is zero|OK_3|head is null|FAIL_ "
+		"OK-1|map|OK_2|empty|OK_3|getting|OK_ "
+		"OK-1|map|OK_2|empty|OK_3|removing|OK_ "
+		"OK-1|map|OK_2|one entry|OK_ "
+		//without forking, the whole run would have ended here
+		"NO-1|lost|SIG_2|exiting|SIG_ "
+	);
+
+	//the forked processes run the prefix as well, but their counters are lost with them
+	if (prefix_runs == 1) {
+		printf("OK!\n");
+	} else {
+		printf("KO! the prefix has been run %d times\n", prefix_runs);
+	}
+}
+
+TESTS_START
+ct_model->section_fork = ct_init_section_fork();
+REG_SUITE(1);
+ct_set_crashc_teardown(check_result);
+TESTS_END
+
+TESTSUITE(1) {
+	setup_testing_producer(ct_model);
+
+	TESTCASE("list", "") {
+		WHEN("empty", "") {
+			ASSERT(true);
+			THEN("size is zero", "") {
+				ASSERT(true);
+			}
+			THEN("head is null", "") {
+				ASSERT(false);
+			}
+			WHEN("adding", "") {
+				ASSERT(true);
+			}
+		}
+		WHEN("one element", "") {
+			ASSERT(true);
+		}
+	}
+
+	TESTCASE("map", "") {
+		prefix_runs += 1;
+		WHEN("empty", "") {
+			WHEN("getting", "") {
+				ASSERT(true);
+			}
+			WHEN("removing", "") {
+				ASSERT(true);
+			}
+		}
+		WHEN("one entry", "") {
+			ASSERT(true);
+		}
+	}
+
+	TESTCASE("lost", "") {
+		WHEN("exiting", "") {
+			_exit(3);
+		}
+		WHEN("surviving", "") {
+			ASSERT(true);
+		}
+	}
+}
+
+#endif
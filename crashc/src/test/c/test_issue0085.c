@@ -0,0 +1,111 @@
+/**
+ * @file
+ *
+ * Checks that the output of the tests is captured, attached to the failed tests only, and sent back by forked sections.
+ * The output exceeding the limit of the in-memory file needs to be released, while what is written on the original standard error
+ * (e.g. the progress line) must never be captured
+ *
+ * @author koldar
+ * @date Oct 19, 2026
+ */
+
+#ifdef TEST_0085
+
+#include <stdio.h>
+#include <string.h>
+#include <stdlib.h>
+#include <unistd.h>
+#include "crashc.h"
+#include "test_checker.h"
+
+static void check_output(const struct ct_test_report* report, const char* expected) {
+	if (expected == NULL && report->output == NULL) {
+		printf("OK!\n");
+	} else if (expected != NULL && report->output != NULL && strcmp(report->output, expected) == 0) {
+		printf("OK!\n");
+	} else {
+		printf("KO! output of \"%s\" was \"%s\"\n", report->testcase_snapshot->description, report->output != NULL ? report->output : "(null)");
+	}
+}
+
+static void check_trim() {
+	struct ct_output_capture* capture = ct_init_output_capture();
+	struct ct_test_report report = { 0 };
+	char* chunk = malloc(CT_CAPTURED_OUTPUT_LIMIT);
+	memset(chunk, 'x', CT_CAPTURED_OUTPUT_LIMIT);
+
+	ct_output_capture_start(capture);
+	fprintf(ct_output_capture_get_original_stderr(capture), "progress line\n");
+	fflush(ct_output_capture_get_original_stderr(capture));
+	write(STDOUT_FILENO, chunk, CT_CAPTURED_OUTPUT_LIMIT);
+	write(STDOUT_FILENO, "tail\n", 5);
+	long mark = ct_output_capture_mark(capture);
+	ct_output_capture_trim(capture);
+	bool released = capture->released_bytes > 0 && ct_output_capture_mark(capture) == mark;
+	report.outcome = CT_TEST_FAILURE;
+	ct_output_capture_stop(capture, &report);
+
+	size_t length = (report.output != NULL) ? strlen(report.output) : 0;
+	if (released && length == CT_CAPTURED_OUTPUT_SIZE && strcmp(report.output + length - 5, "tail\n") == 0 && strstr(report.output, "progress") == NULL) {
+		printf("OK!\n");
+	} else {
+		printf("KO! %s released bytes and captured %zu bytes\n", released ? "" : "no", length);
+	}
+
+	free(report.output);
+	free(chunk);
+	ct_destroy_output_capture(capture);
+}
+
+void check_result() {
+	assert_and_reset_test_checker(
+		"OK-1|quiet|OK_ "
+		"NO-1|loud|FAIL_ "
+		"OK-1|forked|OK_2|passing|OK_ "
+		"NO-1|forked|FAIL_2|failing|FAIL_ "
+	);
+
+	check_output(ct_list_get(ct_model->test_reports_list, 0), NULL);
+	check_output(ct_list_get(ct_model->test_reports_list, 1), "printed\nwritten\n");
+	check_output(ct_list_get(ct_model->test_reports_list, 2), NULL);
+	//the output before the WHEN has been written by the process which forked
+	check_output(ct_list_get(ct_model->test_reports_list, 3), "prefix\nfailing\n");
+
+	check_trim();
+}
+
+TESTS_START
+ct_model->output_capture = ct_init_output_capture();
+ct_model->section_fork = ct_init_section_fork();
+REG_SUITE(1);
+ct_set_crashc_teardown(check_result);
+TESTS_END
+
+TESTSUITE(1) {
+	setup_testing_producer(ct_model);
+
+	TESTCASE("quiet", "") {
+		printf("KO! this output should have been thrown away\n");
+		ASSERT(true);
+	}
+
+	TESTCASE("loud", "") {
+		printf("printed\n");
+		fflush(stdout);
+		write(STDERR_FILENO, "written\n", 8);
+		ASSERT(false);
+	}
+
+	TESTCASE("forked", "") {
+		printf("prefix\n");
+		WHEN("passing", "") {
+			printf("KO! this output should have been thrown away\n");
+		}
+		WHEN("failing", "") {
+			printf("failing\n");
+			ASSERT(false);
+		}
+	}
+}
+
+#endif
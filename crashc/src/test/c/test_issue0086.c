@@ -0,0 +1,135 @@
+/**
+ * @file
+ *
+ * Checks that the tests are appended to the journal and that a resumed run skips only the completed testcases
+ *
+ * @author koldar
+ * @date Oct 19, 2026
+ */
+
+#ifdef TEST_0086
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include "crashc.h"
+#include "test_checker.h"
+
+static char journal_path[] = "/tmp/crashc-journal-XXXXXX";
+static long previous_size;
+
+static unsigned long testcase_hash(const char* description) {
+	return ct_section_path_hash(ct_model->root_section->path_hash, description, strlen(description));
+}
+
+/**
+ * Writes the journal of an invocation killed while running the testcase "partial"
+ */
+static void write_previous_invocation() {
+	int fd = mkstemp(journal_path);
+	FILE* file = fdopen(fd, "w");
+
+	fprintf(file, "R\n");
+	fprintf(file, "T %lx 0 S 0 10 done\n", testcase_hash("done"));
+	fprintf(file, "D %lx 0\n", testcase_hash("done"));
+	fprintf(file, "T %lx 0 F 0 10 partial/first\n", testcase_hash("partial"));
+	previous_size = ftell(file);
+	//the record being written when the process has been killed
+	fprintf(file, "D %lx", testcase_hash("partial"));
+	fclose(file);
+}
+
+static void check_line(FILE* file, const char* expected_type, const char* expected_testcase, int expected_occurrence, char expected_outcome, const char* expected_path) {
+	char* line = NULL;
+	size_t line_size = 0;
+	unsigned long hash = 0;
+	int occurrence = -1;
+	char outcome = '?';
+	int path = 0;
+	bool ok = false;
+
+	if (getline(&line, &line_size, file) > 0) {
+		line[strcspn(line, "\n")] = '\0';
+		if (strcmp(expected_type, "R") == 0) {
+			ok = strcmp(line, "R") == 0;
+		} else if (strcmp(expected_type, "D") == 0) {
+			ok = sscanf(line, "D %lx %d", &hash, &occurrence) == 2 && hash == testcase_hash(expected_testcase) && occurrence == expected_occurrence;
+		} else {
+			ok = sscanf(line, "T %lx %d %c %*d %*d %n", &hash, &occurrence, &outcome, &path) == 3 && path > 0 &&
+					hash == testcase_hash(expected_testcase) && occurrence == expected_occurrence &&
+					outcome == expected_outcome && strcmp(&line[path], expected_path) == 0;
+		}
+	}
+	if (ok) {
+		printf("OK!\n");
+	} else {
+		printf("KO! expected a %s record of \"%s\", got \"%s\"\n", expected_type, expected_testcase, line != NULL ? line : "(null)");
+	}
+	free(line);
+}
+
+void check_result() {
+	assert_and_reset_test_checker(
+		"OK-1|partial|OK_2|first|OK_ "
+		"OK-1|partial|OK_2|second|OK_ "
+		"OK-1|done|OK_ "
+		"NO-1|failing|FAIL_ "
+	);
+
+	if (ct_model->journal->skipped_testcases == 1) {
+		printf("OK!\n");
+	} else {
+		printf("KO! %d testcases have been skipped instead of 1\n", ct_model->journal->skipped_testcases);
+	}
+
+	FILE* file = fopen(journal_path, "r");
+	fseek(file, previous_size, SEEK_SET);
+	check_line(file, "R", NULL, 0, ' ', NULL);
+	check_line(file, "T", "partial", 0, 'S', "partial/first");
+	check_line(file, "T", "partial", 0, 'S', "partial/second");
+	check_line(file, "D", "partial", 0, ' ', NULL);
+	check_line(file, "T", "done", 1, 'S', "done");
+	check_line(file, "D", "done", 1, ' ', NULL);
+	check_line(file, "T", "failing", 0, 'F', "failing");
+	check_line(file, "D", "failing", 0, ' ', NULL);
+	if (fgetc(file) == EOF) {
+		printf("OK!\n");
+	} else {
+		printf("KO! the journal has more records than expected\n");
+	}
+	fclose(file);
+	unlink(journal_path);
+}
+
+TESTS_START
+write_previous_invocation();
+ct_enable_journal(ct_model, journal_path, true);
+REG_SUITE(1);
+ct_set_crashc_teardown(check_result);
+TESTS_END
+
+TESTSUITE(1) {
+	setup_testing_producer(ct_model);
+
+	TESTCASE("done", "") {
+		printf("KO! a testcase completed in the journal has been run again\n");
+	}
+
+	TESTCASE("partial", "") {
+		WHEN("first", "") {
+		}
+		WHEN("second", "") {
+		}
+	}
+
+	//the second testcase with the same path hasn't been completed yet
+	TESTCASE("done", "") {
+	}
+
+	TESTCASE("failing", "") {
+		ASSERT(false);
+	}
+}
+
+#endif
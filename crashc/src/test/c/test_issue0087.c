@@ -0,0 +1,121 @@
+/**
+ * @file
+ *
+ * Checks that the test suites are run in the order chosen from the history file and that the report keeps the declaration order
+ *
+ * @author koldar
+ * @date Oct 19, 2026
+ */
+
+#ifdef TEST_0087
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include "crashc.h"
+#include "test_checker.h"
+
+static char history_path[] = "/tmp/crashc-history-XXXXXX";
+static char run_order[CT_BUFFER_SIZE] = "";
+
+static void write_history() {
+	int fd = mkstemp(history_path);
+	FILE* file = fdopen(fd, "w");
+
+	fprintf(file, "5 quick test\n");
+	fprintf(file, "S 10 4 3 quick\n");
+	fprintf(file, "S 1000 10 1 slow\n");
+	fclose(file);
+}
+
+static void check_order(const char* actual, const char* expected) {
+	if (strcmp(actual, expected) == 0) {
+		printf("OK!\n");
+	} else {
+		printf("KO! the order was \"%s\" instead of \"%s\"\n", actual, expected);
+	}
+}
+
+static void check_suites_order(const char* expected) {
+	char actual[CT_BUFFER_SIZE] = "";
+
+	for (int i = 0; i < ct_model->suites_array_index; i++) {
+		strcat(actual, ct_model->suites_names[ct_model->suites_order[i]]);
+		strcat(actual, " ");
+	}
+	check_order(actual, expected);
+}
+
+void check_result() {
+	//the report is in declaration order
+	assert_and_reset_test_checker(
+		"OK-1|quick test|OK_ "
+		"OK-1|slow test|OK_ "
+		"NO-1|new test|FAIL_ "
+	);
+
+	//the test suites missing from the history come first
+	check_order(run_order, "new slow quick ");
+
+	ct_model->suite_order = CT_ORDER_FAILURES;
+	for (int i = 0; i < ct_model->suites_array_index; i++) {
+		ct_model->suites_order[i] = i;
+	}
+	ct_order_suites(ct_model);
+	check_suites_order("new quick slow ");
+
+	//the history of the test suites has been updated
+	FILE* file = fopen(history_path, "r");
+	char* line = NULL;
+	size_t line_size = 0;
+	char suites[CT_BUFFER_SIZE] = "";
+	while (getline(&line, &line_size, file) > 0) {
+		long time;
+		int tests;
+		int failed_tests;
+		char name[CT_BUFFER_SIZE];
+		if (sscanf(line, "S %ld %d %d %299s", &time, &tests, &failed_tests, name) == 4) {
+			sprintf(&suites[strlen(suites)], "%s:%d:%d ", name, tests, failed_tests);
+		}
+	}
+	free(line);
+	fclose(file);
+	unlink(history_path);
+	check_order(suites, "new:1:1 slow:1:0 quick:1:0 ");
+}
+
+TESTS_START
+write_history();
+ct_enable_progress(ct_model, NULL, history_path);
+ct_model->suite_order = CT_ORDER_DURATION;
+REG_SUITES(quick, slow, new);
+ct_set_crashc_teardown(check_result);
+TESTS_END
+
+TESTSUITE(quick) {
+	setup_testing_producer(ct_model);
+	strcat(run_order, "quick ");
+
+	TESTCASE("quick test", "") {
+	}
+}
+
+TESTSUITE(slow) {
+	setup_testing_producer(ct_model);
+	strcat(run_order, "slow ");
+
+	TESTCASE("slow test", "") {
+	}
+}
+
+TESTSUITE(new) {
+	setup_testing_producer(ct_model);
+	strcat(run_order, "new ");
+
+	TESTCASE("new test", "") {
+		ASSERT(false);
+	}
+}
+
+#endif
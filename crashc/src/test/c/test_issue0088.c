@@ -0,0 +1,151 @@
+/**
+ * @file
+ *
+ * Checks that a coordinator distributes the testcases among its local workers and merges their tests in a single report
+ *
+ * @author koldar
+ * @date Oct 19, 2026
+ */
+
+#ifdef TEST_0088
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <fcntl.h>
+#include "crashc.h"
+#include "test_checker.h"
+
+static char socket_address[CT_BUFFER_SIZE];
+static char run_log_path[] = "/tmp/crashc-run-log-XXXXXX";
+
+/**
+ * Logs that a worker has run a piece of a test. The workers are different processes, so the log is a file
+ */
+static void log_run(const char* name) {
+	char line[CT_BUFFER_SIZE];
+	int fd = open(run_log_path, O_WRONLY | O_APPEND);
+	int length = snprintf(line, sizeof(line), "%s %d\n", name, (int) getpid());
+
+	if (write(fd, line, length) != length) {
+		printf("KO! cannot write the run log\n");
+	}
+	close(fd);
+}
+
+static void check_run_log() {
+	FILE* file = fopen(run_log_path, "r");
+	char name[CT_BUFFER_SIZE];
+	int pid;
+	int first_pid = -1;
+	bool several_workers = false;
+	char names[CT_BUFFER_SIZE] = "";
+
+	while (fscanf(file, "%299s %d", name, &pid) == 2) {
+		strcat(names, name);
+		strcat(names, " ");
+		if (first_pid < 0) {
+			first_pid = pid;
+		} else if (pid != first_pid) {
+			several_workers = true;
+		}
+	}
+	fclose(file);
+	unlink(run_log_path);
+
+	//every piece has been run exactly once, but not necessarily in order
+	const char* expected[] = { "slow ", "first ", "second ", "failing ", "other " };
+	bool ok = strlen(names) == strlen("slow first second loop loop failing other ") && strstr(names, "loop loop ") != NULL;
+	for (int i = 0; i < 5; i++) {
+		char* found = strstr(names, expected[i]);
+		ok = ok && found != NULL && strstr(found + 1, expected[i]) == NULL;
+	}
+	if (ok) {
+		printf("OK!\n");
+	} else {
+		printf("KO! the workers have run \"%s\"\n", names);
+	}
+
+	if (several_workers) {
+		printf("OK!\n");
+	} else {
+		printf("KO! a single worker has run every testcase\n");
+	}
+}
+
+void check_result() {
+	assert_and_reset_test_checker(
+		"OK-1|slow|OK_ "
+		"OK-1|partial|OK_2|first|OK_ "
+		"OK-1|partial|OK_2|second|OK_ "
+		"OK-1|loop|OK_ "
+		"OK-1|loop|OK_ "
+		"NO-1|failing|FAIL_ "
+		"OK-1|other|OK_ "
+	);
+
+	//the assertions have been received along with the tests
+	struct ct_test_report* failed = ct_list_get(ct_model->test_reports_list, 5);
+	struct ct_assert_report* assertion = ct_list_head(failed->testcase_snapshot->assertion_reports);
+	if (assertion != NULL && strcmp(assertion->asserted, "1 == 2") == 0 && strstr(assertion->file_name, "test_issue0088.c") != NULL) {
+		printf("OK!\n");
+	} else {
+		printf("KO! the failed assertion hasn't been received\n");
+	}
+
+	check_run_log();
+
+	if (access(&socket_address[strlen("unix:")], F_OK) != 0) {
+		printf("OK!\n");
+	} else {
+		printf("KO! the socket of the coordinator has been left behind\n");
+	}
+}
+
+TESTS_START
+close(mkstemp(run_log_path));
+snprintf(socket_address, sizeof(socket_address), "unix:/tmp/crashc-coordinator-%d", (int) getpid());
+ct_model->coordinator_address = socket_address;
+ct_model->workers = 2;
+//the coordinator doesn't run any testsuite, so the producer is set up here
+setup_testing_producer(ct_model);
+REG_SUITES(1, 2);
+ct_set_crashc_teardown(check_result);
+TESTS_END
+
+TESTSUITE(1) {
+	TESTCASE("slow", "") {
+		log_run("slow");
+		//the other worker claims the next testcases meanwhile
+		usleep(300000);
+	}
+
+	TESTCASE("partial", "") {
+		WHEN("first", "") {
+			log_run("first");
+		}
+		WHEN("second", "") {
+			log_run("second");
+		}
+	}
+
+	for (int i = 0; i < 2; i++) {
+		TESTCASE("loop", "") {
+			log_run("loop");
+		}
+	}
+
+	TESTCASE("failing", "") {
+		log_run("failing");
+		ASSERT(1 == 2);
+	}
+}
+
+TESTSUITE(2) {
+	TESTCASE("other", "") {
+		log_run("other");
+	}
+}
+
+#endif
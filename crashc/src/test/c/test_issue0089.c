@@ -0,0 +1,99 @@
+/**
+ * @file
+ *
+ * Checks that only the testcases covering the changed files, or missing from the coverage index, are run
+ *
+ * @author koldar
+ * @date Oct 19, 2026
+ */
+
+#ifdef TEST_0089
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include "crashc.h"
+#include "test_checker.h"
+
+static char index_path[] = "/tmp/crashc-coverage-index-XXXXXX";
+static char changed_files_path[] = "/tmp/crashc-changed-files-XXXXXX";
+
+static unsigned long testcase_hash(const char* description) {
+	return ct_section_path_hash(ct_model->root_section->path_hash, description, strlen(description));
+}
+
+/**
+ * Writes the index a run collecting the coverage would have written, and the files changed since then
+ */
+static void write_coverage() {
+	FILE* file = fdopen(mkstemp(index_path), "w");
+	fprintf(file, "F /build/CMakeFiles/lib.dir/src/list.c\n");
+	fprintf(file, "F /build/CMakeFiles/lib.dir/src/map.c\n");
+	//the .gcda file of an object file built without CMake
+	fprintf(file, "F /build/tree\n");
+	fprintf(file, "T %lx 0 1 0\n", testcase_hash("list"));
+	fprintf(file, "T %lx 0 1 1\n", testcase_hash("map"));
+	fprintf(file, "T %lx 0 2 0 1\n", testcase_hash("both"));
+	fprintf(file, "T %lx 0 1 2\n", testcase_hash("tree"));
+	fprintf(file, "T %lx 0 0\n", testcase_hash("nothing"));
+	fclose(file);
+
+	file = fdopen(mkstemp(changed_files_path), "w");
+	fprintf(file, "lib/src/map.c\n");
+	fprintf(file, "\n");
+	fprintf(file, "lib/src/tree.c\n");
+	fclose(file);
+}
+
+void check_result() {
+	assert_and_reset_test_checker(
+		"OK-1|map|OK_ "
+		"OK-1|both|OK_ "
+		"OK-1|tree|OK_ "
+		"OK-1|new|OK_ "
+	);
+
+	if (ct_model->coverage->skipped_testcases == 2 && !ct_model->coverage->run_everything) {
+		printf("OK!\n");
+	} else {
+		printf("KO! %d testcases have been skipped instead of 2\n", ct_model->coverage->skipped_testcases);
+	}
+
+	unlink(index_path);
+	unlink(changed_files_path);
+}
+
+TESTS_START
+write_coverage();
+ct_enable_coverage(ct_model, index_path, false, changed_files_path);
+REG_SUITE(1);
+ct_set_crashc_teardown(check_result);
+TESTS_END
+
+TESTSUITE(1) {
+	setup_testing_producer(ct_model);
+
+	TESTCASE("list", "") {
+		printf("KO! a testcase not covering the changed files has been run\n");
+	}
+
+	TESTCASE("map", "") {
+	}
+
+	TESTCASE("both", "") {
+	}
+
+	TESTCASE("tree", "") {
+	}
+
+	TESTCASE("nothing", "") {
+		printf("KO! a testcase not covering the changed files has been run\n");
+	}
+
+	//written after the index has been collected
+	TESTCASE("new", "") {
+	}
+}
+
+#endif
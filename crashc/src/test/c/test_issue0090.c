@@ -0,0 +1,197 @@
+/**
+ * @file
+ *
+ * Checks that BENCHMARK_RANGE measures its body for every value of the parameter, fits the times to a complexity class
+ * and writes the curve as a CSV file and as a gnuplot script. Checks as well that a range of the parameter which is not valid fails the section
+ *
+ * @author koldar
+ * @date Oct 19, 2026
+ */
+
+#ifdef TEST_0090
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include "crashc.h"
+#include "test_checker.h"
+
+static char output_directory[] = "/tmp/crashc-benchmark-XXXXXX";
+
+/**
+ * Fits the times given by a function of the parameter
+ */
+static struct ct_benchmark_report* fit(double (*time)(long n)) {
+	static struct ct_benchmark_point points[8];
+	static struct ct_benchmark_report report;
+
+	for (int i = 0; i < 8; i++) {
+		points[i].parameter = 16L << i;
+		points[i].iterations = 1;
+		points[i].time = time(points[i].parameter);
+	}
+	report.parameter_name = "n";
+	report.points = points;
+	report.points_number = 8;
+	ct_fit_complexity(&report);
+	return &report;
+}
+
+static double constant(long n) {
+	return 100 + (n % 3);
+}
+
+static double linearithmic(long n) {
+	return 3 * ct_complexity_function(CT_COMPLEXITY_LINEARITHMIC, n);
+}
+
+static double quadratic(long n) {
+	return 0.5 * n * n + 10 * n;
+}
+
+static void check_fit() {
+	struct ct_benchmark_report* report = fit(constant);
+	if (report->complexity == CT_COMPLEXITY_CONSTANT && report->coefficient > 100 && report->coefficient < 102) {
+		printf("OK!\n");
+	} else {
+		printf("KO! constant times fitted as %s\n", ct_complexity_to_string(report->complexity));
+	}
+
+	report = fit(linearithmic);
+	if (report->complexity == CT_COMPLEXITY_LINEARITHMIC && report->coefficient > 2.99 && report->coefficient < 3.01 && report->error < 0.001) {
+		printf("OK!\n");
+	} else {
+		printf("KO! n log n times fitted as %s with coefficient %f\n", ct_complexity_to_string(report->complexity), report->coefficient);
+	}
+
+	report = fit(quadratic);
+	if (report->complexity == CT_COMPLEXITY_QUADRATIC && report->coefficient > 0.49 && report->coefficient < 0.51) {
+		printf("OK!\n");
+	} else {
+		printf("KO! quadratic times fitted as %s with coefficient %f\n", ct_complexity_to_string(report->complexity), report->coefficient);
+	}
+}
+
+static void check_curve() {
+	char path[CT_BUFFER_SIZE];
+	char line[CT_BUFFER_SIZE];
+	int rows = 0;
+	bool header = false;
+
+	snprintf(path, sizeof(path), "%s/sum_of_n_numbers.csv", output_directory);
+	FILE* csv = fopen(path, "r");
+	if (csv != NULL) {
+		while (fgets(line, sizeof(line), csv) != NULL) {
+			rows += 1;
+			header = header || strcmp(line, "n,iterations,time_ns,time_low_ns,time_high_ns,outliers,fitted_time_ns,allocations,allocated_bytes,frees\n") == 0;
+		}
+		fclose(csv);
+		unlink(path);
+	}
+	if (header && rows == 9) {
+		printf("OK!\n");
+	} else {
+		printf("KO! the CSV of the curve has %d rows\n", rows);
+	}
+
+	snprintf(path, sizeof(path), "%s/sum_of_n_numbers.dat", output_directory);
+	bool dat = unlink(path) == 0;
+	snprintf(path, sizeof(path), "%s/sum_of_n_numbers.gp", output_directory);
+	FILE* script = fopen(path, "r");
+	bool plot = false;
+	if (script != NULL) {
+		while (fgets(line, sizeof(line), script) != NULL) {
+			plot = plot || strncmp(line, "plot ", strlen("plot ")) == 0;
+		}
+		fclose(script);
+		unlink(path);
+	}
+	if (dat && plot) {
+		printf("OK!\n");
+	} else {
+		printf("KO! the gnuplot script of the curve hasn't been written\n");
+	}
+	rmdir(output_directory);
+}
+
+void check_result() {
+	assert_and_reset_test_checker(
+		"OK-1|sum|OK_2|sum of n numbers|OK_ "
+		"NO-1|failing|FAIL_2|interrupted|FAIL_ "
+		"OK-1|after failing|OK_2|single value|OK_ "
+		"NO-1|invalid ranges|FAIL_2|from zero|FAIL_2|backwards|FAIL_ "
+	);
+
+	struct ct_test_report* report = ct_list_get(ct_model->test_reports_list, 0);
+	struct ct_benchmark_report* benchmark = report->testcase_snapshot->first_child->benchmark;
+	bool ok = benchmark != NULL && benchmark->points_number == 7 && strcmp(benchmark->parameter_name, "n") == 0;
+	for (int i = 0; ok && i < 7; i++) {
+		ok = benchmark->points[i].parameter == (256L << i) && benchmark->points[i].iterations >= 1 && benchmark->points[i].time > 0;
+	}
+	//64 times the numbers to sum can't take less time
+	if (ok && benchmark->points[6].time > benchmark->points[0].time) {
+		printf("OK!\n");
+	} else {
+		printf("KO! the benchmark hasn't measured every value of the parameter\n");
+	}
+
+	report = ct_list_get(ct_model->test_reports_list, 1);
+	if (report->testcase_snapshot->first_child->benchmark == NULL) {
+		printf("OK!\n");
+	} else {
+		printf("KO! an interrupted benchmark has a report\n");
+	}
+
+	report = ct_list_get(ct_model->test_reports_list, 2);
+	benchmark = report->testcase_snapshot->first_child->benchmark;
+	if (benchmark != NULL && benchmark->points_number == 1 && benchmark->points[0].parameter == 1 && strcmp(benchmark->parameter_name, "threads") == 0) {
+		printf("OK!\n");
+	} else {
+		printf("KO! the benchmark after the interrupted one hasn't been measured\n");
+	}
+
+	check_fit();
+	check_curve();
+}
+
+TESTS_START
+ct_model->benchmark_output = mkdtemp(output_directory);
+REG_SUITE(1);
+ct_set_crashc_teardown(check_result);
+TESTS_END
+
+TESTSUITE(1) {
+	setup_testing_producer(ct_model);
+
+	TESTCASE("sum", "") {
+		BENCHMARK_RANGE("sum of n numbers", "", n, 1 << 8, 1 << 14) {
+			volatile long sum = 0;
+			for (long i = 0; i < n; i++) {
+				sum += i;
+			}
+		}
+	}
+
+	TESTCASE("failing", "") {
+		EZ_BENCHMARK_RANGE("interrupted", n, 1, 1 << 10) {
+			ASSERT(n < 64);
+		}
+	}
+
+	TESTCASE("after failing", "") {
+		EZ_BENCHMARK_RANGE("single value", threads, 1, 1) {
+		}
+	}
+
+	TESTCASE("invalid ranges", "") {
+		EZ_BENCHMARK_RANGE("from zero", n, 0, 8) {
+			printf("KO! a benchmark starting from 0 has been run\n");
+		}
+		EZ_BENCHMARK_RANGE("backwards", n, 8, 4) {
+			printf("KO! a benchmark going backwards has been run\n");
+		}
+	}
+}
+
+#endif
@@ -0,0 +1,142 @@
+/**
+ * @file
+ *
+ * Checks that the benchmarks reject the outlier samples, compute a confidence interval, warm up the cache
+ * or flush it, and are pinned to the requested CPU
+ *
+ * @author koldar
+ * @date Oct 19, 2026
+ */
+
+#ifdef TEST_0091
+
+#include <stdio.h>
+#include <string.h>
+#include <unistd.h>
+#include <sys/syscall.h>
+#include "crashc.h"
+#include "test_checker.h"
+
+static unsigned long initial_affinity[CT_BENCHMARK_AFFINITY_WORDS];
+static bool pinned_in_body = true;
+static bool restored_after_benchmark = false;
+static bool restored_after_interruption = false;
+static long warm_runs = 0;
+static long cold_runs = 0;
+
+static void get_affinity(unsigned long* affinity) {
+	memset(affinity, 0, sizeof(unsigned long) * CT_BENCHMARK_AFFINITY_WORDS);
+	syscall(SYS_sched_getaffinity, 0, sizeof(unsigned long) * CT_BENCHMARK_AFFINITY_WORDS, affinity);
+}
+
+static void check_estimate() {
+	double samples[] = { 10, 10, 11, 9, 1000, 10, 10, 9, 11, 10 };
+	struct ct_benchmark_point point;
+
+	ct_estimate_benchmark_time(samples, 10, &point);
+	if (point.outliers == 1 && point.time == 10 && point.time_low >= 9 && point.time_low < 10 && point.time_high > 10 && point.time_high <= 11) {
+		printf("OK!\n");
+	} else {
+		printf("KO! the time is %f [%f, %f] with %d outliers\n", point.time, point.time_low, point.time_high, point.outliers);
+	}
+}
+
+void check_result() {
+	assert_and_reset_test_checker(
+		"OK-1|warm|OK_2|warm cache|OK_ "
+		"OK-1|cold|OK_2|cold cache|OK_ "
+		"NO-1|interrupted|FAIL_2|pinned|FAIL_ "
+		"OK-1|after interrupted|OK_ "
+	);
+
+	//every value is run once to warm up the cache, then to find how many runs a sample needs (1 + 2 + ... + iterations / 2), then for every sample
+	struct ct_test_report* report = ct_list_get(ct_model->test_reports_list, 0);
+	struct ct_benchmark_report* benchmark = report->testcase_snapshot->first_child->benchmark;
+	long expected_runs = 0;
+	bool ok = benchmark->cpu == -1 && !benchmark->cold_cache && benchmark->warmup_time > 0;
+	for (int i = 0; i < benchmark->points_number; i++) {
+		struct ct_benchmark_point* point = &benchmark->points[i];
+		expected_runs += (CT_BENCHMARK_SAMPLES + 1) * point->iterations;
+		ok = ok && point->time_low <= point->time && point->time <= point->time_high && point->outliers < CT_BENCHMARK_SAMPLES;
+	}
+	if (ok && warm_runs == expected_runs) {
+		printf("OK!\n");
+	} else {
+		printf("KO! the body with a warm cache has been run %ld times instead of %ld\n", warm_runs, expected_runs);
+	}
+
+	report = ct_list_get(ct_model->test_reports_list, 1);
+	benchmark = report->testcase_snapshot->first_child->benchmark;
+	ok = benchmark->cpu == 0 && benchmark->cold_cache && benchmark->points_number == 2;
+	for (int i = 0; i < benchmark->points_number; i++) {
+		ok = ok && benchmark->points[i].iterations == 1;
+	}
+	//with a cold cache every sample runs the body once, and there is no need to warm it up
+	if (ok && cold_runs == 2 * CT_BENCHMARK_SAMPLES) {
+		printf("OK!\n");
+	} else {
+		printf("KO! the body with a cold cache has been run %ld times\n", cold_runs);
+	}
+
+	if (pinned_in_body && restored_after_benchmark) {
+		printf("OK!\n");
+	} else {
+		printf("KO! the benchmark hasn't been pinned to CPU 0 or its affinity hasn't been restored\n");
+	}
+
+	if (restored_after_interruption) {
+		printf("OK!\n");
+	} else {
+		printf("KO! the affinity hasn't been restored after an interrupted benchmark\n");
+	}
+
+	check_estimate();
+}
+
+TESTS_START
+get_affinity(initial_affinity);
+REG_SUITE(1);
+ct_set_crashc_teardown(check_result);
+TESTS_END
+
+TESTSUITE(1) {
+	setup_testing_producer(ct_model);
+
+	TESTCASE("warm", "") {
+		EZ_BENCHMARK_RANGE("warm cache", n, 1, 4) {
+			warm_runs += 1;
+		}
+	}
+
+	TESTCASE("cold", "") {
+		ct_model->benchmark_cpu = 0;
+		ct_model->benchmark_cold_cache = true;
+		EZ_BENCHMARK_RANGE("cold cache", n, 1, 2) {
+			unsigned long affinity[CT_BENCHMARK_AFFINITY_WORDS];
+			get_affinity(affinity);
+			pinned_in_body = pinned_in_body && affinity[0] == 1;
+			cold_runs += 1;
+		}
+		unsigned long affinity[CT_BENCHMARK_AFFINITY_WORDS];
+		get_affinity(affinity);
+		restored_after_benchmark = memcmp(affinity, initial_affinity, sizeof(affinity)) == 0;
+		ct_model->benchmark_cpu = -1;
+		ct_model->benchmark_cold_cache = false;
+	}
+
+	TESTCASE("interrupted", "") {
+		ct_model->benchmark_cpu = 0;
+		EZ_BENCHMARK_RANGE("pinned", n, 1, 2) {
+			ASSERT(false);
+		}
+	}
+
+	TESTCASE("after interrupted", "") {
+		unsigned long affinity[CT_BENCHMARK_AFFINITY_WORDS];
+		ct_model->benchmark_cpu = -1;
+		get_affinity(affinity);
+		restored_after_interruption = ct_model->benchmark == NULL && memcmp(affinity, initial_affinity, sizeof(affinity)) == 0;
+	}
+}
+
+#endif
@@ -0,0 +1,121 @@
+/**
+ * @file
+ *
+ * Checks that the benchmarks report the allocations of a run of their body and that
+ * the max_allocs tag bounds the blocks a @testcase or a benchmark can allocate
+ *
+ * @author koldar
+ * @date Oct 19, 2026
+ */
+
+#ifdef TEST_0092
+
+#include <stdio.h>
+#include <stdlib.h>
+#include "crashc.h"
+#include "test_checker.h"
+
+static void check_tag() {
+	ct_tag_hashtable_o* tags = ct_ht_init();
+	long bound = -1;
+
+	ct_tag_ht_populate(tags, "fast max_allocs:x [max_allocs:3", ' ');
+	bool malformed = ct_tag_ht_get_number(tags, CT_MAX_ALLOCATIONS_TAG, &bound);
+	ct_tag_ht_populate(tags, "[max_allocs:12]", ' ');
+	bool bracketed = ct_tag_ht_get_number(tags, CT_MAX_ALLOCATIONS_TAG, &bound);
+	if (!malformed && bracketed && bound == 12) {
+		printf("OK!\n");
+	} else {
+		printf("KO! the bound read from the tags is %ld\n", bound);
+	}
+	ct_ht_destroy_with_elements(tags, (ct_destroyer_c) ct_tag_destroy);
+}
+
+void check_result() {
+	assert_and_reset_test_checker(
+		"OK-1|allocation free|OK_2|sum|OK_ "
+		"NO-1|allocating benchmark|OVER_2|two blocks|OVER_ "
+		"NO-1|bounded testcase|OVER_2|W1|OK_ "
+		"OK-1|within bound|OK_2|W1|OK_2|unbounded|OK_ "
+	);
+
+	struct ct_test_report* report = ct_list_get(ct_model->test_reports_list, 0);
+	struct ct_benchmark_report* benchmark = report->testcase_snapshot->first_child->benchmark;
+	bool ok = ct_model->allocation_tracker->enabled && benchmark->allocations_counted;
+	for (int i = 0; i < benchmark->points_number; i++) {
+		ok = ok && benchmark->points[i].allocations == 0 && benchmark->points[i].allocated_bytes == 0 && benchmark->points[i].frees == 0;
+	}
+	if (ok) {
+		printf("OK!\n");
+	} else {
+		printf("KO! an allocation free benchmark has allocated\n");
+	}
+
+	//the warm-up run and the calibration are not counted, hence the means are exact
+	report = ct_list_get(ct_model->test_reports_list, 1);
+	benchmark = report->testcase_snapshot->first_child->benchmark;
+	ok = benchmark->points_number == 3;
+	for (int i = 0; ok && i < benchmark->points_number; i++) {
+		struct ct_benchmark_point* point = &benchmark->points[i];
+		ok = point->allocations == 2 && point->allocated_bytes == point->parameter + 8 && point->frees == 2;
+		if (!ok) {
+			printf("KO! n = %ld allocated %f blocks (%f bytes) and released %f per run\n", point->parameter, point->allocations, point->allocated_bytes, point->frees);
+		}
+	}
+	if (ok) {
+		printf("OK!\n");
+	}
+
+	check_tag();
+}
+
+TESTS_START
+REG_SUITE(1);
+ct_set_crashc_teardown(check_result);
+TESTS_END
+
+TESTSUITE(1) {
+	setup_testing_producer(ct_model);
+
+	TESTCASE("allocation free", "max_allocs:0") {
+		BENCHMARK_RANGE("sum", "[max_allocs:0]", n, 1, 4) {
+			volatile long sum = 0;
+			for (long i = 0; i < n; i++) {
+				sum += i;
+			}
+		}
+	}
+
+	TESTCASE("allocating benchmark", "") {
+		BENCHMARK_RANGE("two blocks", "max_allocs:1", n, 1, 4) {
+			char* a = malloc(n);
+			char* b = calloc(1, 8);
+			free(a);
+			free(b);
+		}
+	}
+
+	TESTCASE("bounded testcase", "max_allocs:2") {
+		char* a = malloc(4);
+		char* b = malloc(4);
+		WHEN("W1", "") {
+			free(malloc(4));
+		}
+		free(a);
+		free(b);
+	}
+
+	TESTCASE("within bound", "max_allocs:2") {
+		char* a = malloc(4);
+		WHEN("W1", "") {
+			free(malloc(4));
+		}
+		//the benchmarks are bounded by their own tag
+		EZ_BENCHMARK_RANGE("unbounded", n, 1, 1) {
+			free(malloc(n));
+		}
+		free(a);
+	}
+}
+
+#endif
@@ -0,0 +1,61 @@
+/**
+ * @file
+ *
+ * Checks that sections whose paths have the same hash are neither entered nor found in place of each other
+ *
+ * @author koldar
+ * @date Oct 19, 2026
+ */
+
+#ifdef TEST_0093
+
+#include <stdio.h>
+#include <string.h>
+#include "crashc.h"
+#include "test_checker.h"
+
+void check_result() {
+	//"Ab" and "BA" have the same djb2 hash, hence so do their paths
+	assert_and_reset_test_checker(
+		"OK-1|hash|OK_2|BA|OK_ "
+	);
+
+	if (ct_section_path_hash(CT_ROOT_PATH_HASH, "Ab", 2) != ct_section_path_hash(CT_ROOT_PATH_HASH, "BA", 2)) {
+		printf("KO! the descriptions don't collide\n");
+	}
+
+	struct ct_section* first = ct_find_section(ct_model, "hash/Ab");
+	struct ct_section* second = ct_find_section(ct_model, "hash/BA");
+	if (first != NULL && second != NULL && strcmp(first->description, "Ab") == 0 && strcmp(second->description, "BA") == 0 && !first->on_target_path) {
+		printf("OK!\n");
+	} else {
+		printf("KO! a section has been found in place of another one with the same hash\n");
+	}
+
+	if (ct_find_section(ct_model, "hash/BA/Ab") == NULL) {
+		printf("OK!\n");
+	} else {
+		printf("KO! a missing section has been found\n");
+	}
+}
+
+TESTS_START
+ct_select_section_path(ct_model, "hash/BA");
+REG_SUITE(1);
+ct_set_crashc_teardown(check_result);
+TESTS_END
+
+TESTSUITE(1) {
+	setup_testing_producer(ct_model);
+
+	TESTCASE("hash", "") {
+		WHEN("Ab", "") {
+			ASSERT(false);
+		}
+		WHEN("BA", "") {
+			ASSERT(true);
+		}
+	}
+}
+
+#endif
@@ -0,0 +1,117 @@
+/**
+ * @file
+ *
+ * Checks that the backtrace of a stack overflow is captured on the alternate signal stack, every time it happens,
+ * and that a report producer without the optional reporters can still report it
+ *
+ * @author koldar
+ * @date Oct 19, 2026
+ */
+
+#ifdef TEST_0094
+
+#include <stdio.h>
+#include <string.h>
+#include <signal.h>
+#include "crashc.h"
+#include "test_checker.h"
+
+static int overflow_stack(int depth) {
+	volatile char buffer[1024];
+	buffer[0] = (char) depth;
+	return overflow_stack(depth + 1) + buffer[0];
+}
+
+/**
+ * @return how many frames of the backtrace of a snapshot are inside ::overflow_stack
+ */
+static int frames_in_overflow_stack(const struct ct_snapshot* snapshot) {
+	int ret_val = 0;
+	for (int i = 0; i < snapshot->backtrace_size; i++) {
+		char* frame = snapshot->backtrace[i];
+		if (frame >= (char*) overflow_stack && frame < ((char*) overflow_stack) + 256) {
+			ret_val += 1;
+		}
+	}
+	return ret_val;
+}
+
+static void check_minimal_producer(struct ct_test_report* report) {
+	struct ct_report_producer producer;
+	char line[CT_BUFFER_SIZE];
+	bool outcome = false;
+	bool frames = false;
+
+	struct ct_report_producer* previous_producer = ct_model->report_producer_implementation;
+	producer = *previous_producer;
+	producer.backtrace_reporter = NULL;
+	producer.resource_usage_reporter = NULL;
+	producer.performance_reporter = NULL;
+	producer.stress_reporter = NULL;
+	producer.flakiness_reporter = NULL;
+	producer.benchmark_reporter = NULL;
+	FILE* previous_file = ct_model->output_file;
+	ct_model->report_producer_implementation = &producer;
+	ct_model->output_file = tmpfile();
+	ct_default_test_report(ct_model, report);
+
+	rewind(ct_model->output_file);
+	while (fgets(line, sizeof(line), ct_model->output_file) != NULL) {
+		outcome = outcome || strcmp(line, "Outcome: FAILURE\n") == 0;
+		frames = frames || strstr(line, "#0 ") != NULL;
+	}
+	fclose(ct_model->output_file);
+	ct_model->output_file = previous_file;
+	ct_model->report_producer_implementation = previous_producer;
+
+	if (outcome && !frames) {
+		printf("OK!\n");
+	} else {
+		printf("KO! the report without the optional reporters is wrong\n");
+	}
+}
+
+void check_result() {
+	assert_and_reset_test_checker(
+		"NO-1|first overflow|SIG_ "
+		"OK-1|between|OK_ "
+		"NO-1|second overflow|SIG_ "
+	);
+
+	for (int i = 0; i < 3; i += 2) {
+		struct ct_test_report* report = ct_list_get(ct_model->test_reports_list, i);
+		struct ct_snapshot* snapshot = report->testcase_snapshot;
+		//the recursion is deeper than the backtrace, so most of the frames are inside overflow_stack
+		if (snapshot->signal_detected == SIGSEGV && snapshot->backtrace_size > CT_BACKTRACE_SIZE / 2 && frames_in_overflow_stack(snapshot) > snapshot->backtrace_size / 2) {
+			printf("OK!\n");
+		} else {
+			printf("KO! overflow %d has a backtrace of %d frames, %d inside the recursion\n", i, snapshot->backtrace_size, frames_in_overflow_stack(snapshot));
+		}
+	}
+
+	check_minimal_producer(ct_list_get(ct_model->test_reports_list, 0));
+}
+
+TESTS_START
+REG_SUITE(1);
+ct_set_crashc_teardown(check_result);
+TESTS_END
+
+TESTSUITE(1) {
+	setup_testing_producer(ct_model);
+
+	TESTCASE("first overflow", "") {
+		overflow_stack(0);
+	}
+
+	TESTCASE("between", "") {
+		ASSERT(true);
+	}
+
+	//the alternate stack needs to be usable again after the first overflow
+	TESTCASE("second overflow", "") {
+		overflow_stack(0);
+	}
+}
+
+#endif
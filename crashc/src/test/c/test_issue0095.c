@@ -0,0 +1,119 @@
+/**
+ * @file
+ *
+ * Checks that a coordinator survives a worker sending corrupted tests: the connection of such worker is closed,
+ * the test case it has claimed is lost and the tests of the other workers are reported as usual.
+ * Checks as well that a FUZZ_TESTCASE is claimed like a TESTCASE, both first in its suite and after other test cases
+ *
+ * @author koldar
+ * @date Oct 19, 2026
+ */
+
+#ifdef TEST_0095
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+#include <unistd.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include "crashc.h"
+#include "test_checker.h"
+
+static char socket_address[CT_BUFFER_SIZE];
+
+/**
+ * Sends a message with the same framing a worker uses
+ */
+static void send_message(int channel, char type, const struct ct_testcase_key* key, const void* data, uint32_t size) {
+	unsigned char message[CT_BUFFER_SIZE];
+
+	message[0] = type;
+	memcpy(&message[1], key, sizeof(struct ct_testcase_key));
+	memcpy(&message[1 + sizeof(struct ct_testcase_key)], &size, sizeof(size));
+	memcpy(&message[1 + sizeof(struct ct_testcase_key) + sizeof(size)], data, size);
+	if (write(channel, message, 1 + sizeof(struct ct_testcase_key) + sizeof(size) + size) < 0) {
+		_exit(EXIT_FAILURE);
+	}
+}
+
+/**
+ * Claims a testcase nobody has, then sends a single test which is cut short
+ */
+static void run_rogue_worker() {
+	struct sockaddr_un address = { .sun_family = AF_UNIX };
+	struct ct_testcase_key key = { 123456789UL, 0 };
+	int truncated[2] = { 1, 0 };
+	char granted;
+
+	//the coordinator is still serving the slow testcase meanwhile
+	usleep(100000);
+	strncpy(address.sun_path, &socket_address[strlen("unix:")], sizeof(address.sun_path) - 1);
+	int channel = socket(AF_UNIX, SOCK_STREAM, 0);
+	if (connect(channel, (struct sockaddr*) &address, sizeof(address)) != 0) {
+		_exit(EXIT_FAILURE);
+	}
+	send_message(channel, 'C', &key, "rogue", 5);
+	if (read(channel, &granted, sizeof(granted)) != sizeof(granted)) {
+		_exit(EXIT_FAILURE);
+	}
+	send_message(channel, 'T', &key, truncated, sizeof(truncated));
+	close(channel);
+	_exit(EXIT_SUCCESS);
+}
+
+void check_result() {
+	assert_and_reset_test_checker(
+		"OK-1|slow|OK_ "
+		"OK-1|other|OK_ "
+		"OK-1|fuzzed last|OK_ "
+		"OK-1|fuzzed first|OK_ "
+		"OK-1|after fuzzed|OK_ "
+	);
+
+	if (ct_model->distribution->lost_testcases == 1) {
+		printf("OK!\n");
+	} else {
+		printf("KO! %d test cases have been lost\n", ct_model->distribution->lost_testcases);
+	}
+}
+
+TESTS_START
+snprintf(socket_address, sizeof(socket_address), "unix:/tmp/crashc-coordinator-%d", (int) getpid());
+ct_model->coordinator_address = socket_address;
+ct_model->workers = 2;
+setup_testing_producer(ct_model);
+fflush(NULL);
+if (fork() == 0) {
+	run_rogue_worker();
+}
+REG_SUITES(1, 2);
+ct_set_crashc_teardown(check_result);
+TESTS_END
+
+TESTSUITE(1) {
+	TESTCASE("slow", "") {
+		usleep(500000);
+	}
+
+	TESTCASE("other", "") {
+		ASSERT(true);
+	}
+
+	FUZZ_TESTCASE("fuzzed last", data, size) {
+		ASSERT(size == 0);
+	}
+}
+
+TESTSUITE(2) {
+	FUZZ_TESTCASE("fuzzed first", data, size) {
+		ASSERT(size == 0);
+	}
+
+	TESTCASE("after fuzzed", "") {
+		ASSERT(true);
+	}
+}
+
+#endif
@@ -0,0 +1,166 @@
+/**
+ * @file
+ *
+ * Checks that the workers of a distributed run claim the testcases in the order the coordinator has chosen from its history file,
+ * even a worker without any history file, and that the coordinator updates the history with the tests it receives
+ *
+ * @author koldar
+ * @date Oct 19, 2026
+ */
+
+#ifdef TEST_0096
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <fcntl.h>
+#include "crashc.h"
+#include "test_checker.h"
+
+static char socket_address[CT_BUFFER_SIZE];
+static char history_path[] = "/tmp/crashc-history-XXXXXX";
+static char run_log_path[] = "/tmp/crashc-run-log-XXXXXX";
+
+static void write_history() {
+	int fd = mkstemp(history_path);
+	FILE* file = fdopen(fd, "w");
+
+	fprintf(file, "S 10 2 0 quick\n");
+	fprintf(file, "S 1000 2 0 slow\n");
+	fclose(file);
+}
+
+/**
+ * Logs that a worker has run a testcase of a test suite. The workers are different processes, so the log is a file
+ */
+static void log_run(const char* suite) {
+	char line[CT_BUFFER_SIZE];
+	int fd = open(run_log_path, O_WRONLY | O_APPEND);
+	int length = snprintf(line, sizeof(line), "%s %d\n", suite, (int) getpid());
+
+	if (write(fd, line, length) != length) {
+		printf("KO! cannot write the run log\n");
+	}
+	close(fd);
+	usleep(150000);
+}
+
+/**
+ * Checks that every worker has run the test suites in the order "new slow quick"
+ */
+static void check_run_log() {
+	FILE* file = fopen(run_log_path, "r");
+	char suite[CT_BUFFER_SIZE];
+	int pid;
+	int pids[2] = { -1, -1 };
+	int ranks[2] = { 0, 0 };
+	bool ok = true;
+
+	while (fscanf(file, "%299s %d", suite, &pid) == 2) {
+		int rank = (strcmp(suite, "new") == 0) ? 0 : (strcmp(suite, "slow") == 0) ? 1 : 2;
+		int worker = (pids[0] < 0 || pids[0] == pid) ? 0 : 1;
+		pids[worker] = pid;
+		ok = ok && rank >= ranks[worker];
+		ranks[worker] = rank;
+	}
+	fclose(file);
+	unlink(run_log_path);
+
+	if (ok) {
+		printf("OK!\n");
+	} else {
+		printf("KO! a worker has not followed the order of the coordinator\n");
+	}
+}
+
+static void check_history() {
+	FILE* file = fopen(history_path, "r");
+	char* line = NULL;
+	size_t line_size = 0;
+	char suites[CT_BUFFER_SIZE] = "";
+
+	while (getline(&line, &line_size, file) > 0) {
+		long time;
+		int tests;
+		int failed_tests;
+		char name[CT_BUFFER_SIZE];
+		if (sscanf(line, "S %ld %d %d %299s", &time, &tests, &failed_tests, name) == 4 && time >= 2 * 150000) {
+			sprintf(&suites[strlen(suites)], "%s:%d:%d ", name, tests, failed_tests);
+		}
+	}
+	free(line);
+	fclose(file);
+	unlink(history_path);
+
+	if (strcmp(suites, "new:2:1 slow:2:0 quick:2:0 ") == 0) {
+		printf("OK!\n");
+	} else {
+		printf("KO! the history of the test suites is \"%s\"\n", suites);
+	}
+}
+
+void check_result() {
+	//the report is in declaration order
+	assert_and_reset_test_checker(
+		"OK-1|quick 1|OK_ "
+		"OK-1|quick 2|OK_ "
+		"OK-1|slow 1|OK_ "
+		"OK-1|slow 2|OK_ "
+		"OK-1|new 1|OK_ "
+		"NO-1|new 2|FAIL_ "
+	);
+
+	check_run_log();
+	check_history();
+}
+
+TESTS_START
+close(mkstemp(run_log_path));
+snprintf(socket_address, sizeof(socket_address), "unix:/tmp/crashc-coordinator-%d", (int) getpid());
+fflush(NULL);
+if (fork() == 0) {
+	//a worker joining later, with neither a history file nor an order
+	usleep(200000);
+	ct_model->worker_address = socket_address;
+} else {
+	write_history();
+	ct_enable_progress(ct_model, NULL, history_path);
+	ct_model->suite_order = CT_ORDER_DURATION;
+	ct_model->coordinator_address = socket_address;
+	ct_model->workers = 1;
+}
+setup_testing_producer(ct_model);
+REG_SUITES(quick, slow, new);
+ct_set_crashc_teardown(check_result);
+TESTS_END
+
+TESTSUITE(quick) {
+	TESTCASE("quick 1", "") {
+		log_run("quick");
+	}
+	TESTCASE("quick 2", "") {
+		log_run("quick");
+	}
+}
+
+TESTSUITE(slow) {
+	TESTCASE("slow 1", "") {
+		log_run("slow");
+	}
+	TESTCASE("slow 2", "") {
+		log_run("slow");
+	}
+}
+
+TESTSUITE(new) {
+	TESTCASE("new 1", "") {
+		log_run("new");
+	}
+	TESTCASE("new 2", "") {
+		log_run("new");
+		ASSERT(false);
+	}
+}
+
+#endif
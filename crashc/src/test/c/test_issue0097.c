@@ -0,0 +1,139 @@
+/**
+ * @file
+ *
+ * Checks that splitting the inputs of a FUZZ_TESTCASE among worker processes gives the same tests, in the same order,
+ * as running them within the test process, and that the listeners are notified of the tests run by the workers
+ *
+ * @author koldar
+ * @date Oct 19, 2026
+ */
+
+#ifdef TEST_0097
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include "crashc.h"
+#include "test_checker.h"
+
+#define INPUTS_NUMBER 5
+
+static char corpus[] = "/tmp/crashc_corpus_XXXXXX";
+//the failing input is run by the same worker of the last one
+static const char* names[INPUTS_NUMBER] = {"1", "2-crash", "3", "4", "5"};
+static int tests_ended = 0;
+
+static void on_test_end(struct ct_model* model, void* data, struct ct_test_report* report) {
+	tests_ended += 1;
+}
+
+static void remove_corpus() {
+	char path[256];
+
+	for (int i = 0; i < INPUTS_NUMBER; i++) {
+		snprintf(path, sizeof(path), "%s/%s", corpus, names[i]);
+		unlink(path);
+	}
+	rmdir(corpus);
+}
+
+/**
+ * Checks that the tests of a FUZZ_TESTCASE follow the order of the inputs
+ *
+ * @param[in] first the index of the first test of the FUZZ_TESTCASE
+ */
+static void check_inputs_order(int first) {
+	for (int i = 0; i < 2 * INPUTS_NUMBER; i++) {
+		struct ct_test_report* report = ct_list_get(ct_model->test_reports_list, first + i);
+		const char* name = names[i / 2];
+		if (report->fuzz_input == NULL || strcmp(report->fuzz_input + strlen(report->fuzz_input) - strlen(name), name) != 0) {
+			printf("KO! test %d has input %s instead of %s\n", first + i, report->fuzz_input, name);
+			return;
+		}
+	}
+	printf("OK!\n");
+}
+
+void check_result() {
+	assert_and_reset_test_checker(
+		"OK-1|parallel|OK_2|size|OK_ "
+		"OK-1|parallel|OK_2|content|OK_ "
+		"OK-1|parallel|OK_2|size|OK_ "
+		"NO-1|parallel|FAIL_2|content|FAIL_ "
+		"OK-1|parallel|OK_2|size|OK_ "
+		"OK-1|parallel|OK_2|content|OK_ "
+		"OK-1|parallel|OK_2|size|OK_ "
+		"OK-1|parallel|OK_2|content|OK_ "
+		"OK-1|parallel|OK_2|size|OK_ "
+		"OK-1|parallel|OK_2|content|OK_ "
+		"OK-1|sequential|OK_2|size|OK_ "
+		"OK-1|sequential|OK_2|content|OK_ "
+		"OK-1|sequential|OK_2|size|OK_ "
+		"NO-1|sequential|FAIL_2|content|FAIL_ "
+		"OK-1|sequential|OK_2|size|OK_ "
+		"OK-1|sequential|OK_2|content|OK_ "
+		"OK-1|sequential|OK_2|size|OK_ "
+		"OK-1|sequential|OK_2|content|OK_ "
+		"OK-1|sequential|OK_2|size|OK_ "
+		"OK-1|sequential|OK_2|content|OK_ "
+	);
+
+	ct_update_test_stats(ct_model);
+	struct ct_test_stats* stats = ct_model->statistics;
+	if (stats->total_tests == 4 * INPUTS_NUMBER && stats->successful_tests == 4 * INPUTS_NUMBER - 2 && stats->failed_tests == 2 && tests_ended == 4 * INPUTS_NUMBER) {
+		printf("OK!\n");
+	} else {
+		printf("KO! %u tests, %u passed, %u failed, %d notified\n", stats->total_tests, stats->successful_tests, stats->failed_tests, tests_ended);
+	}
+
+	check_inputs_order(0);
+	check_inputs_order(2 * INPUTS_NUMBER);
+	remove_corpus();
+}
+
+TESTS_START
+struct ct_event_listener listener = {NULL, NULL, NULL, on_test_end, NULL, NULL};
+ct_subscribe_listener(ct_model, &listener);
+REG_SUITE(1);
+ct_set_crashc_teardown(check_result);
+TESTS_END
+
+TESTSUITE(1) {
+	setup_testing_producer(ct_model);
+
+	if (mkdtemp(corpus) == NULL) {
+		printf("KO! cannot create the corpus\n");
+		return;
+	}
+	for (int i = 0; i < INPUTS_NUMBER; i++) {
+		char path[256];
+		snprintf(path, sizeof(path), "%s/%s", corpus, names[i]);
+		FILE* f = fopen(path, "w");
+		fputs(names[i], f);
+		fclose(f);
+	}
+	ct_model->corpus_path = corpus;
+
+	ct_model->workers = 3;
+	FUZZ_TESTCASE("parallel", data, size) {
+		WHEN("size", "") {
+			ASSERT(size > 0);
+		}
+		WHEN("content", "") {
+			ASSERT(size != strlen(names[1]) || memcmp(data, names[1], size) != 0);
+		}
+	}
+
+	ct_model->workers = 1;
+	FUZZ_TESTCASE("sequential", data, size) {
+		WHEN("size", "") {
+			ASSERT(size > 0);
+		}
+		WHEN("content", "") {
+			ASSERT(size != strlen(names[1]) || memcmp(data, names[1], size) != 0);
+		}
+	}
+}
+
+#endif
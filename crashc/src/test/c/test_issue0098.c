@@ -0,0 +1,107 @@
+/**
+ * @file
+ *
+ * Checks that a worker exits, without running anything, when its coordinator sends an order of the test suites
+ * which is not a permutation of the test suites of the worker
+ *
+ * @author koldar
+ * @date Oct 19, 2026
+ */
+
+#ifdef TEST_0098
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <sys/wait.h>
+#include "crashc.h"
+#include "test_checker.h"
+
+static char socket_address[CT_BUFFER_SIZE];
+
+/**
+ * Acts as a coordinator sending a wrong order to a single worker
+ *
+ * @param[in] listener the socket the worker connects to
+ * @param[in] worker the process of the worker
+ * @param[in] order the order of the 2 test suites to send
+ */
+static void send_wrong_order(int listener, pid_t worker, const int* order) {
+	unsigned char request[CT_BUFFER_SIZE];
+	int suites_number = 2;
+	int status;
+
+	int channel = accept(listener, NULL, NULL);
+	//the request of the order has no payload
+	if (channel < 0 || recv(channel, request, 1 + sizeof(struct ct_testcase_key) + sizeof(uint32_t), MSG_WAITALL) <= 0 || request[0] != 'O') {
+		printf("KO! the worker has not asked for the order\n");
+		return;
+	}
+	if (write(channel, &suites_number, sizeof(suites_number)) < 0 || write(channel, order, sizeof(int) * suites_number) < 0) {
+		printf("KO! cannot send the order\n");
+		return;
+	}
+
+	//a worker following the order would claim its first test case
+	ssize_t received = recv(channel, request, sizeof(request), 0);
+	close(channel);
+	waitpid(worker, &status, 0);
+	if (received == 0 && WIFEXITED(status) && WEXITSTATUS(status) == EXIT_FAILURE) {
+		printf("OK!\n");
+	} else {
+		printf("KO! the worker has sent %zd bytes after the order {%d, %d}\n", received, order[0], order[1]);
+	}
+}
+
+void check_result() {
+	assert_and_reset_test_checker(
+		"OK-1|first|OK_ "
+		"OK-1|second|OK_ "
+	);
+}
+
+TESTS_START
+static const int orders[2][2] = { { 0, 5 }, { 1, 1 } };
+struct sockaddr_un address = { .sun_family = AF_UNIX };
+
+snprintf(socket_address, sizeof(socket_address), "unix:/tmp/crashc-coordinator-%d", (int) getpid());
+strncpy(address.sun_path, &socket_address[strlen("unix:")], sizeof(address.sun_path) - 1);
+int listener = socket(AF_UNIX, SOCK_STREAM, 0);
+if (bind(listener, (struct sockaddr*) &address, sizeof(address)) != 0 || listen(listener, 1) != 0) {
+	printf("KO! cannot listen on %s\n", address.sun_path);
+}
+for (int i = 0; i < 2; i++) {
+	fflush(NULL);
+	pid_t worker = fork();
+	if (worker == 0) {
+		close(listener);
+		ct_model->worker_address = socket_address;
+		break;
+	}
+	send_wrong_order(listener, worker, orders[i]);
+}
+if (ct_model->worker_address == NULL) {
+	close(listener);
+	unlink(address.sun_path);
+	setup_testing_producer(ct_model);
+	ct_set_crashc_teardown(check_result);
+}
+REG_SUITES(1, 2);
+TESTS_END
+
+TESTSUITE(1) {
+	TESTCASE("first", "") {
+		ASSERT(true);
+	}
+}
+
+TESTSUITE(2) {
+	TESTCASE("second", "") {
+		ASSERT(true);
+	}
+}
+
+#endif
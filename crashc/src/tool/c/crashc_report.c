@@ -0,0 +1,726 @@
+/*
+ * crashc_report.c
+ *
+ * Standalone tool rendering a binary event log produced by @crashc with the --binary_report option,
+ * or summarizing a journal produced with the --journal option
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: koldar
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdbool.h>
+#include <getopt.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+#include "binary_report.h"
+#include "report_producer.h"
+#include "list.h"
+
+/**
+ * The maximum depth of a snapshot tree the tool can render
+ */
+#define CT_REPORT_MAX_DEPTH 256
+
+/**
+ * The data of a ::CT_BINARY_EVENT_SNAPSHOT_START event
+ */
+struct ct_snapshot_event {
+	const char* type;
+	const char* status;
+	int signal;
+	int signal_code;
+	uint64_t elapsed_time;
+	uint64_t allocations;
+	uint64_t allocated_bytes;
+	uint64_t frees;
+	uint64_t leaked_blocks;
+	uint64_t leaked_bytes;
+	const char* description;
+};
+
+/**
+ * The data of a ::CT_BINARY_EVENT_ASSERTION event
+ */
+struct ct_assertion_event {
+	bool passed;
+	unsigned int line;
+	const char* asserted;
+	const char* expected;
+	const char* actual;
+	const char* file;
+};
+
+/**
+ * The state of the rendering of a binary event log
+ */
+struct ct_renderer_state {
+	FILE* out;
+	/**
+	 * The depth of the current snapshot. 0 is the @testcase snapshot, -1 means no snapshot has started
+	 */
+	int depth;
+	/**
+	 * The number of tests rendered so far
+	 */
+	int tests;
+	/**
+	 * For each depth, the number of assertions the snapshot has
+	 */
+	int assertions[CT_REPORT_MAX_DEPTH];
+	/**
+	 * For each depth, the number of children the snapshot has
+	 */
+	int children[CT_REPORT_MAX_DEPTH];
+	/**
+	 * The summary of the run, read before rendering anything
+	 */
+	unsigned int summary[4];
+	/**
+	 * The repetition and the fuzz input of the current test
+	 */
+	unsigned int repetition;
+	const char* input;
+};
+
+/**
+ * The functions rendering each event in a given format
+ */
+struct ct_renderer {
+	const char* name;
+	void (*start)(struct ct_renderer_state* state);
+	void (*test_start)(struct ct_renderer_state* state);
+	void (*snapshot_start)(struct ct_renderer_state* state, const struct ct_snapshot_event* snapshot);
+	void (*assertion)(struct ct_renderer_state* state, const struct ct_assertion_event* assertion);
+	void (*snapshot_end)(struct ct_renderer_state* state);
+	void (*test_end)(struct ct_renderer_state* state, bool success);
+	void (*end)(struct ct_renderer_state* state);
+};
+
+static void indent(struct ct_renderer_state* state, int level) {
+	for (int i = 0; i < level; i++) {
+		fputc('\t', state->out);
+	}
+}
+
+/**
+ * Prints a string escaping the characters which are special in XML and HTML
+ */
+static void print_xml(FILE* out, const char* s) {
+	for (; *s != '\0'; s++) {
+		switch (*s) {
+		case '<': fputs("&lt;", out); break;
+		case '>': fputs("&gt;", out); break;
+		case '&': fputs("&amp;", out); break;
+		case '"': fputs("&quot;", out); break;
+		case '\'': fputs("&apos;", out); break;
+		default: fputc(*s, out);
+		}
+	}
+}
+
+/**
+ * Prints a quoted JSON string
+ */
+static void print_json(FILE* out, const char* s) {
+	fputc('"', out);
+	for (; *s != '\0'; s++) {
+		switch (*s) {
+		case '"': fputs("\\\"", out); break;
+		case '\\': fputs("\\\\", out); break;
+		case '\n': fputs("\\n", out); break;
+		case '\t': fputs("\\t", out); break;
+		case '\r': fputs("\\r", out); break;
+		default:
+			if ((unsigned char) *s < 0x20) {
+				fprintf(out, "\\u%04x", (unsigned char) *s);
+			} else {
+				fputc(*s, out);
+			}
+		}
+	}
+	fputc('"', out);
+}
+
+// ******************************* TEXT *******************************
+
+static void text_start(struct ct_renderer_state* state) {
+}
+
+static void text_test_start(struct ct_renderer_state* state) {
+	fprintf(state->out, " ---------- TEST REPORT ----------\n\n");
+	if (state->input[0] != '\0') {
+		fprintf(state->out, "Input: %s\n\n", state->input);
+	}
+}
+
+static void text_snapshot_start(struct ct_renderer_state* state, const struct ct_snapshot_event* snapshot) {
+	indent(state, state->depth);
+	if (snapshot->signal != 0) {
+		fprintf(state->out, "%s : %s -> %s (%s, code %d)\n", snapshot->type, snapshot->description, snapshot->status, strsignal(snapshot->signal), snapshot->signal_code);
+	} else {
+		fprintf(state->out, "%s : %s -> %s\n", snapshot->type, snapshot->description, snapshot->status);
+	}
+	if (snapshot->allocations > 0 || snapshot->frees > 0 || snapshot->leaked_blocks > 0) {
+		indent(state, state->depth + 1);
+		fprintf(state->out, "Allocations: %lu (%lu bytes), frees: %lu", snapshot->allocations, snapshot->allocated_bytes, snapshot->frees);
+		if (snapshot->leaked_blocks > 0) {
+			fprintf(state->out, ", leaked: %lu blocks (%lu bytes)", snapshot->leaked_blocks, snapshot->leaked_bytes);
+		}
+		fputc('\n', state->out);
+	}
+	indent(state, state->depth + 1);
+	fprintf(state->out, "Time: %lu us\n", snapshot->elapsed_time);
+}
+
+static void text_assertion(struct ct_renderer_state* state, const struct ct_assertion_event* assertion) {
+	indent(state, state->depth + 1);
+	if (assertion->passed) {
+		fprintf(state->out, "Assertion \"%s\" - OK\n", assertion->asserted);
+	} else {
+		fprintf(state->out, "Assertion \"%s\" - FAILED - Expected: %s, Actual: %s (%s:%u)\n", assertion->asserted, assertion->expected, assertion->actual, assertion->file, assertion->line);
+	}
+}
+
+static void text_snapshot_end(struct ct_renderer_state* state) {
+}
+
+static void text_test_end(struct ct_renderer_state* state, bool success) {
+	fprintf(state->out, "\nOutcome: %s\n", success ? "SUCCESS" : "FAILURE");
+	fprintf(state->out, "\n --------------------------------\n\n\n");
+}
+
+static void text_end(struct ct_renderer_state* state) {
+	fprintf(state->out, "Total tests: %u\n", state->summary[0]);
+	fprintf(state->out, "Successful tests: %u\n", state->summary[1]);
+	fprintf(state->out, "Failed tests: %u\n", state->summary[2]);
+	if (state->summary[0] > 0) {
+		fprintf(state->out, "Percentage of successful tests: %.2f%%\n", ((double) state->summary[1] / state->summary[0]) * 100);
+	}
+	if (state->summary[3] > 0) {
+		fprintf(state->out, "Flaky tests: %u\n", state->summary[3]);
+	}
+}
+
+// ******************************* JUNIT *******************************
+
+static void junit_start(struct ct_renderer_state* state) {
+	fprintf(state->out, "<?xml version=\"1.0\" encoding=\"UTF-8\"?>\n");
+	fprintf(state->out, "<testsuites tests=\"%u\" failures=\"%u\">\n", state->summary[0], state->summary[2]);
+	fprintf(state->out, "\t<testsuite name=\"crashc\" tests=\"%u\" failures=\"%u\">\n", state->summary[0], state->summary[2]);
+}
+
+static void junit_test_start(struct ct_renderer_state* state) {
+}
+
+static void junit_snapshot_start(struct ct_renderer_state* state, const struct ct_snapshot_event* snapshot) {
+	if (state->depth == 0) {
+		fprintf(state->out, "\t\t<testcase name=\"");
+		print_xml(state->out, snapshot->description);
+		if (state->input[0] != '\0') {
+			fprintf(state->out, " [");
+			print_xml(state->out, state->input);
+			fprintf(state->out, "]");
+		}
+		fprintf(state->out, "\" classname=\"crashc.repetition%u\" time=\"%.6f\">\n", state->repetition, snapshot->elapsed_time / 1e6);
+	}
+	if (snapshot->signal != 0) {
+		fprintf(state->out, "\t\t\t<error type=\"%s\" message=\"", strsignal(snapshot->signal));
+		print_xml(state->out, snapshot->description);
+		fprintf(state->out, "\"/>\n");
+	}
+}
+
+static void junit_assertion(struct ct_renderer_state* state, const struct ct_assertion_event* assertion) {
+	if (assertion->passed) {
+		return;
+	}
+	fprintf(state->out, "\t\t\t<failure message=\"");
+	print_xml(state->out, assertion->asserted);
+	fprintf(state->out, "\">Expected: ");
+	print_xml(state->out, assertion->expected);
+	fprintf(state->out, ", Actual: ");
+	print_xml(state->out, assertion->actual);
+	fprintf(state->out, " (");
+	print_xml(state->out, assertion->file);
+	fprintf(state->out, ":%u)</failure>\n", assertion->line);
+}
+
+static void junit_snapshot_end(struct ct_renderer_state* state) {
+}
+
+static void junit_test_end(struct ct_renderer_state* state, bool success) {
+	fprintf(state->out, "\t\t</testcase>\n");
+}
+
+static void junit_end(struct ct_renderer_state* state) {
+	fprintf(state->out, "\t</testsuite>\n");
+	fprintf(state->out, "</testsuites>\n");
+}
+
+// ******************************* JSON *******************************
+
+static void json_start(struct ct_renderer_state* state) {
+	fprintf(state->out, "{\"tests\":[");
+}
+
+static void json_test_start(struct ct_renderer_state* state) {
+	if (state->tests > 0) {
+		fputc(',', state->out);
+	}
+	fprintf(state->out, "\n{\"repetition\":%u,\"input\":", state->repetition);
+	print_json(state->out, state->input);
+	fprintf(state->out, ",\"snapshot\":");
+}
+
+static void json_snapshot_start(struct ct_renderer_state* state, const struct ct_snapshot_event* snapshot) {
+	if (state->depth > 0) {
+		if (state->children[state->depth - 1] == 0) {
+			fprintf(state->out, "],\"children\":[");
+		} else {
+			fputc(',', state->out);
+		}
+	}
+	fprintf(state->out, "{\"type\":\"%s\",\"description\":", snapshot->type);
+	print_json(state->out, snapshot->description);
+	fprintf(state->out, ",\"status\":\"%s\",\"signal\":%d,\"elapsed_time\":%lu,\"allocations\":%lu,\"allocated_bytes\":%lu,\"frees\":%lu,\"leaked_blocks\":%lu,\"leaked_bytes\":%lu,\"assertions\":[",
+			snapshot->status, snapshot->signal, snapshot->elapsed_time,
+			snapshot->allocations, snapshot->allocated_bytes, snapshot->frees, snapshot->leaked_blocks, snapshot->leaked_bytes
+	);
+}
+
+static void json_assertion(struct ct_renderer_state* state, const struct ct_assertion_event* assertion) {
+	if (state->assertions[state->depth] > 0) {
+		fputc(',', state->out);
+	}
+	fprintf(state->out, "{\"passed\":%s,\"asserted\":", assertion->passed ? "true" : "false");
+	print_json(state->out, assertion->asserted);
+	fprintf(state->out, ",\"expected\":");
+	print_json(state->out, assertion->expected);
+	fprintf(state->out, ",\"actual\":");
+	print_json(state->out, assertion->actual);
+	fprintf(state->out, ",\"file\":");
+	print_json(state->out, assertion->file);
+	fprintf(state->out, ",\"line\":%u}", assertion->line);
+}
+
+static void json_snapshot_end(struct ct_renderer_state* state) {
+	if (state->children[state->depth] == 0) {
+		fprintf(state->out, "],\"children\":[]}");
+	} else {
+		fprintf(state->out, "]}");
+	}
+}
+
+static void json_test_end(struct ct_renderer_state* state, bool success) {
+	fprintf(state->out, ",\"outcome\":\"%s\"}", success ? "SUCCESS" : "FAILURE");
+}
+
+static void json_end(struct ct_renderer_state* state) {
+	fprintf(state->out, "\n],\"summary\":{\"total\":%u,\"successful\":%u,\"failed\":%u,\"flaky\":%u}}\n",
+			state->summary[0], state->summary[1], state->summary[2], state->summary[3]
+	);
+}
+
+// ******************************* HTML *******************************
+
+static void html_start(struct ct_renderer_state* state) {
+	fprintf(state->out,
+			"<!DOCTYPE html>\n<html>\n<head>\n<meta charset=\"utf-8\">\n<title>CrashC report</title>\n"
+			"<style>body{font-family:monospace}.OK,.SUCCESS{color:green}.FAILED,.SIGNALED,.LEAKED,.OVER_ALLOCATED,.FAILURE{color:red}</style>\n"
+			"</head>\n<body>\n<h1>CrashC report</h1>\n"
+			"<p>Total tests: %u, successful: %u, <span class=\"FAILURE\">failed: %u</span>, flaky: %u</p>\n",
+			state->summary[0], state->summary[1], state->summary[2], state->summary[3]
+	);
+}
+
+static void html_test_start(struct ct_renderer_state* state) {
+	fprintf(state->out, "<div class=\"test\">\n");
+	if (state->input[0] != '\0') {
+		fprintf(state->out, "<p>Input: ");
+		print_xml(state->out, state->input);
+		fprintf(state->out, "</p>\n");
+	}
+	fprintf(state->out, "<ul>\n");
+}
+
+static void html_snapshot_start(struct ct_renderer_state* state, const struct ct_snapshot_event* snapshot) {
+	fprintf(state->out, "<li><span class=\"%s\">%s : ", snapshot->status, snapshot->type);
+	print_xml(state->out, snapshot->description);
+	fprintf(state->out, " &rarr; %s", snapshot->status);
+	if (snapshot->signal != 0) {
+		fprintf(state->out, " (%s)", strsignal(snapshot->signal));
+	}
+	fprintf(state->out, "</span> %lu us\n<ul>\n", snapshot->elapsed_time);
+}
+
+static void html_assertion(struct ct_renderer_state* state, const struct ct_assertion_event* assertion) {
+	fprintf(state->out, "<li class=\"%s\">Assertion &quot;", assertion->passed ? "OK" : "FAILED");
+	print_xml(state->out, assertion->asserted);
+	if (assertion->passed) {
+		fprintf(state->out, "&quot; - OK</li>\n");
+	} else {
+		fprintf(state->out, "&quot; - FAILED - Expected: ");
+		print_xml(state->out, assertion->expected);
+		fprintf(state->out, ", Actual: ");
+		print_xml(state->out, assertion->actual);
+		fprintf(state->out, "</li>\n");
+	}
+}
+
+static void html_snapshot_end(struct ct_renderer_state* state) {
+	fprintf(state->out, "</ul>\n</li>\n");
+}
+
+static void html_test_end(struct ct_renderer_state* state, bool success) {
+	fprintf(state->out, "</ul>\n<p class=\"%s\">Outcome: %s</p>\n</div>\n<hr>\n", success ? "SUCCESS" : "FAILURE", success ? "SUCCESS" : "FAILURE");
+}
+
+static void html_end(struct ct_renderer_state* state) {
+	fprintf(state->out, "</body>\n</html>\n");
+}
+
+static const struct ct_renderer renderers[] = {
+	{"text", text_start, text_test_start, text_snapshot_start, text_assertion, text_snapshot_end, text_test_end, text_end},
+	{"junit", junit_start, junit_test_start, junit_snapshot_start, junit_assertion, junit_snapshot_end, junit_test_end, junit_end},
+	{"json", json_start, json_test_start, json_snapshot_start, json_assertion, json_snapshot_end, json_test_end, json_end},
+	{"html", html_start, html_test_start, html_snapshot_start, html_assertion, html_snapshot_end, html_test_end, html_end},
+	{NULL}
+};
+
+static const char* section_type_string(unsigned int type) {
+	return (type <= CT_BENCHMARK_SECTION) ? ct_section_type_to_string(type) : "UNKNOWN";
+}
+
+static const char* snapshot_status_string(unsigned int status) {
+	return (status <= CT_SNAPSHOT_OVER_ALLOCATED) ? ct_snapshot_status_to_string(status) : "UNKNOWN";
+}
+
+/**
+ * Renders a whole binary event log
+ *
+ * @return @true if the log is well formed, @false otherwise
+ */
+static bool render(const struct ct_renderer* renderer, FILE* out, const unsigned char* data, size_t size) {
+	struct ct_renderer_state state;
+	struct ct_binary_event event;
+	size_t header = ct_binary_log_header_size(data, size);
+	size_t position;
+	size_t read;
+
+	if (header == 0) {
+		fprintf(stderr, "crashc-report: not a CrashC binary event log, or a log of an unsupported version\n");
+		return false;
+	}
+
+	memset(&state, 0, sizeof(state));
+	state.out = out;
+	state.depth = -1;
+	state.input = "";
+
+	//the summary is the last event, but some formats need it at the beginning
+	for (position = header; (read = ct_read_binary_event(data + position, size - position, &event)) > 0; position += read) {
+		if (event.kind == CT_BINARY_EVENT_SUMMARY) {
+			for (int i = 0; i < 4; i++) {
+				state.summary[i] = ct_binary_event_u32(&event);
+			}
+		}
+	}
+	if (position != size) {
+		fprintf(stderr, "crashc-report: the log is truncated at byte %zu\n", position);
+		return false;
+	}
+
+	renderer->start(&state);
+	for (position = header; (read = ct_read_binary_event(data + position, size - position, &event)) > 0; position += read) {
+		switch (event.kind) {
+		case CT_BINARY_EVENT_TEST_START: {
+			state.repetition = ct_binary_event_u32(&event);
+			state.input = ct_binary_event_string(&event);
+			renderer->test_start(&state);
+			break;
+		}
+		case CT_BINARY_EVENT_SNAPSHOT_START: {
+			struct ct_snapshot_event snapshot;
+			snapshot.type = section_type_string(ct_binary_event_u8(&event));
+			snapshot.status = snapshot_status_string(ct_binary_event_u8(&event));
+			snapshot.signal = (int) ct_binary_event_u32(&event);
+			snapshot.signal_code = (int) ct_binary_event_u32(&event);
+			snapshot.elapsed_time = ct_binary_event_u64(&event);
+			snapshot.allocations = ct_binary_event_u64(&event);
+			snapshot.allocated_bytes = ct_binary_event_u64(&event);
+			snapshot.frees = ct_binary_event_u64(&event);
+			snapshot.leaked_blocks = ct_binary_event_u64(&event);
+			snapshot.leaked_bytes = ct_binary_event_u64(&event);
+			snapshot.description = ct_binary_event_string(&event);
+
+			if (state.depth + 1 >= CT_REPORT_MAX_DEPTH) {
+				fprintf(stderr, "crashc-report: snapshot tree deeper than %d\n", CT_REPORT_MAX_DEPTH);
+				return false;
+			}
+			state.depth += 1;
+			renderer->snapshot_start(&state, &snapshot);
+			if (state.depth > 0) {
+				state.children[state.depth - 1] += 1;
+			}
+			state.assertions[state.depth] = 0;
+			state.children[state.depth] = 0;
+			break;
+		}
+		case CT_BINARY_EVENT_ASSERTION: {
+			struct ct_assertion_event assertion;
+			assertion.passed = ct_binary_event_u8(&event);
+			assertion.line = ct_binary_event_u32(&event);
+			assertion.asserted = ct_binary_event_string(&event);
+			assertion.expected = ct_binary_event_string(&event);
+			assertion.actual = ct_binary_event_string(&event);
+			assertion.file = ct_binary_event_string(&event);
+
+			if (state.depth < 0) {
+				fprintf(stderr, "crashc-report: assertion outside of a snapshot\n");
+				return false;
+			}
+			renderer->assertion(&state, &assertion);
+			state.assertions[state.depth] += 1;
+			break;
+		}
+		case CT_BINARY_EVENT_SNAPSHOT_END: {
+			if (state.depth < 0) {
+				fprintf(stderr, "crashc-report: unbalanced snapshot end\n");
+				return false;
+			}
+			renderer->snapshot_end(&state);
+			state.depth -= 1;
+			break;
+		}
+		case CT_BINARY_EVENT_TEST_END: {
+			renderer->test_end(&state, ct_binary_event_u8(&event) == CT_TEST_SUCCESS);
+			state.tests += 1;
+			state.depth = -1;
+			break;
+		}
+		default: {
+			//the summary has already been read; unknown events are skipped
+			break;
+		}
+		}
+	}
+	renderer->end(&state);
+
+	return true;
+}
+
+/**
+ * Adds a test of a completed testcase to the summary of a journal
+ *
+ * @param[in] record the record of the test
+ * @param[inout] tests the number of tests in the summary
+ * @param[inout] failures the records of the failed tests in the summary. \c record is moved here if the test has failed, otherwise it's released
+ */
+static void commit_journal_test(char* record, int* tests, ct_list_o* failures) {
+	char outcome = 'S';
+
+	sscanf(record, "T %*x %*d %c", &outcome);
+	*tests += 1;
+	if (outcome == 'S') {
+		free(record);
+	} else {
+		ct_list_add_tail(failures, record);
+	}
+}
+
+/**
+ * Prints the summary of the tests appended to a journal by one or more invocations of a test executable
+ *
+ * The tests of a testcase count only once the testcase has been completed. The tests of a testcase interrupted by the end of an invocation
+ * have been run again by the following one; the ones interrupted by the end of the last invocation are shown as unfinished.
+ *
+ * @param[in] in the journal
+ * @param[inout] out where the summary is written
+ */
+static void summarize_journal(FILE* in, FILE* out) {
+	ct_list_o* pending = ct_list_init();
+	ct_list_o* failures = ct_list_init();
+	int invocations = 0;
+	int testcases = 0;
+	int tests = 0;
+	int rerun_tests = 0;
+	char* line = NULL;
+	size_t line_size = 0;
+	ssize_t length;
+
+	while ((length = getline(&line, &line_size, in)) > 0) {
+		if (line[length - 1] != '\n') {
+			//the last record of a killed invocation may be truncated
+			break;
+		}
+		line[length - 1] = '\0';
+
+		switch (line[0]) {
+		case 'R': {
+			invocations += 1;
+			rerun_tests += ct_list_size(pending);
+			ct_list_clear(pending);
+			break;
+		}
+		case 'T': {
+			int occurrence = 0;
+			sscanf(line, "T %*x %d", &occurrence);
+			if (occurrence < 0) {
+				//a test of a FUZZ_TESTCASE doesn't belong to a testcase
+				commit_journal_test(strdup(line), &tests, failures);
+			} else {
+				ct_list_add_tail(pending, strdup(line));
+			}
+			break;
+		}
+		case 'D': {
+			testcases += 1;
+			while (!ct_list_is_empty(pending)) {
+				commit_journal_test(ct_list_pop(pending), &tests, failures);
+			}
+			break;
+		}
+		default: {
+			break;
+		}
+		}
+	}
+	free(line);
+
+	fprintf(out, "Invocations: %d\n", invocations);
+	fprintf(out, "Completed test cases: %d\n", testcases);
+	fprintf(out, "Tests: %d, passed: %d, failed: %d\n", tests, tests - ct_list_size(failures), ct_list_size(failures));
+	if (rerun_tests > 0) {
+		fprintf(out, "Tests run again after an interrupted invocation: %d\n", rerun_tests);
+	}
+	if (!ct_list_is_empty(pending)) {
+		fprintf(out, "Unfinished tests of the last invocation: %d\n", ct_list_size(pending));
+	}
+	CT_ITERATE_ON_LIST(failures, failure_cell, failure, char*) {
+		int repetition = 0;
+		int path = 0;
+		sscanf(failure, "T %*x %*d %*c %d %*d %n", &repetition, &path);
+		fprintf(out, "FAILURE %s", &failure[path]);
+		if (repetition > 0) {
+			fprintf(out, " (repetition %d)", repetition + 1);
+		}
+		fprintf(out, "\n");
+	}
+
+	ct_list_destroy_with_elements(pending, (ct_destroyer_c) free);
+	ct_list_destroy_with_elements(failures, (ct_destroyer_c) free);
+}
+
+static void print_help(FILE* out) {
+	fprintf(out,
+			"Usage: crashc-report [--format text|junit|json|html] [--output FILE] LOG\n"
+			"       crashc-report --journal [--output FILE] JOURNAL\n"
+			"Renders the binary event log LOG produced by a CrashC test executable run with --binary_report,\n"
+			"or summarizes the JOURNAL produced by one or more runs with --journal.\n"
+			"\n"
+			"  -f, --format   the format of the output. Default to text\n"
+			"  -o, --output   the file where the output is written. Default to the standard output\n"
+			"  -j, --journal  the input is a journal\n"
+			"  -h, --help     shows this help\n"
+	);
+}
+
+int main(int argc, char* argv[]) {
+	static struct option long_options[] = {
+		{"format",	required_argument,	0,	'f'},
+		{"output",	required_argument,	0,	'o'},
+		{"journal",	no_argument,		0,	'j'},
+		{"help",	no_argument,		0,	'h'},
+		{0,			0,					0,	0}
+	};
+	const char* format = "text";
+	const char* output = NULL;
+	bool journal = false;
+	int c;
+
+	while ((c = getopt_long(argc, argv, "f:o:jh", long_options, NULL)) != -1) {
+		switch (c) {
+		case 'f': format = optarg; break;
+		case 'o': output = optarg; break;
+		case 'j': journal = true; break;
+		case 'h': print_help(stdout); return 0;
+		default: print_help(stderr); return 2;
+		}
+	}
+	if (optind != argc - 1) {
+		print_help(stderr);
+		return 2;
+	}
+
+	if (journal) {
+		FILE* in = fopen(argv[optind], "r");
+		if (in == NULL) {
+			fprintf(stderr, "crashc-report: cannot read \"%s\"\n", argv[optind]);
+			return 1;
+		}
+		FILE* out = (output != NULL) ? fopen(output, "w") : stdout;
+		if (out == NULL) {
+			fprintf(stderr, "crashc-report: cannot create \"%s\"\n", output);
+			fclose(in);
+			return 1;
+		}
+		summarize_journal(in, out);
+		fclose(in);
+		if (out != stdout) {
+			fclose(out);
+		}
+		return 0;
+	}
+
+	const struct ct_renderer* renderer = renderers;
+	while (renderer->name != NULL && strcmp(renderer->name, format) != 0) {
+		renderer++;
+	}
+	if (renderer->name == NULL) {
+		fprintf(stderr, "crashc-report: unknown format \"%s\"\n", format);
+		return 2;
+	}
+
+	int fd = open(argv[optind], O_RDONLY);
+	struct stat file_stat;
+	if (fd < 0 || fstat(fd, &file_stat) != 0) {
+		fprintf(stderr, "crashc-report: cannot read \"%s\"\n", argv[optind]);
+		return 1;
+	}
+	size_t size = file_stat.st_size;
+	const unsigned char* data = NULL;
+	if (size > 0) {
+		data = mmap(NULL, size, PROT_READ, MAP_PRIVATE, fd, 0);
+		if (data == MAP_FAILED) {
+			fprintf(stderr, "crashc-report: cannot map \"%s\"\n", argv[optind]);
+			close(fd);
+			return 1;
+		}
+	}
+	close(fd);
+
+	FILE* out = stdout;
+	if (output != NULL) {
+		out = fopen(output, "w");
+		if (out == NULL) {
+			fprintf(stderr, "crashc-report: cannot create \"%s\"\n", output);
+			return 1;
+		}
+	}
+
+	bool ok = render(renderer, out, (data != NULL) ? data : (const unsigned char*) "", size);
+
+	if (out != stdout) {
+		fclose(out);
+	}
+	if (data != NULL) {
+		munmap((void*) data, size);
+	}
+	return ok ? 0 : 1;
+}